@@ -10,6 +10,7 @@ Archive Common
 #include <unistd.h>
 
 #include "command/archive/common.h"
+#include "common/crypto/cipherBlock.h"
 #include "common/debug.h"
 #include "common/fork.h"
 #include "common/log.h"
@@ -52,6 +53,102 @@ archiveAsyncSpoolQueue(ArchiveMode archiveMode)
     FUNCTION_TEST_RETURN((archiveMode == archiveModeGet ? STORAGE_SPOOL_ARCHIVE_IN_STR : STORAGE_SPOOL_ARCHIVE_OUT_STR));
 }
 
+/***********************************************************************************************************************************
+Dictionaries loaded by archiveDictLoad() are cached for the life of the process since a dictionary never changes once written and
+all the WAL compressed for an archive id generally uses the same dictionary
+***********************************************************************************************************************************/
+typedef struct ArchiveDictCache
+{
+    const Storage *storage;                                         // Repo storage
+    const String *archivePath;                                      // Archive id path
+    unsigned int dictId;                                            // Dictionary id
+    const Buffer *dict;                                             // Dictionary
+} ArchiveDictCache;
+
+static struct ArchiveDictLocal
+{
+    MemContext *memContext;                                         // Mem context for the cache
+    List *cacheList;                                                // Dictionaries loaded so far
+} archiveDictLocal;
+
+/**********************************************************************************************************************************/
+const Buffer *
+archiveDictLoad(void *const data, const unsigned int dictId)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM_P(VOID, data);
+        FUNCTION_LOG_PARAM(UINT, dictId);
+    FUNCTION_LOG_END();
+
+    ASSERT(data != NULL);
+
+    const ArchiveDictLoadData *const loadData = data;
+    const Buffer *result = NULL;
+
+    // Search the cache for the dictionary
+    if (archiveDictLocal.cacheList != NULL)
+    {
+        for (unsigned int cacheIdx = 0; cacheIdx < lstSize(archiveDictLocal.cacheList); cacheIdx++)
+        {
+            const ArchiveDictCache *const cache = lstGet(archiveDictLocal.cacheList, cacheIdx);
+
+            if (cache->storage == loadData->storage && cache->dictId == dictId && strEq(cache->archivePath, loadData->archivePath))
+            {
+                result = cache->dict;
+                break;
+            }
+        }
+    }
+    // Else create the cache
+    else
+    {
+        MEM_CONTEXT_BEGIN(memContextTop())
+        {
+            MEM_CONTEXT_NEW_BEGIN("ArchiveDictLocal")
+            {
+                archiveDictLocal.memContext = MEM_CONTEXT_NEW();
+                archiveDictLocal.cacheList = lstNewP(sizeof(ArchiveDictCache));
+            }
+            MEM_CONTEXT_NEW_END();
+        }
+        MEM_CONTEXT_END();
+    }
+
+    // Load the dictionary and add it to the cache
+    if (result == NULL)
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            StorageRead *const read = storageNewReadP(
+                loadData->storage,
+                strNewFmt("%s/" ARCHIVE_DICT_PATH "/%08x" ARCHIVE_DICT_EXT, strZ(loadData->archivePath), dictId));
+
+            cipherBlockFilterGroupAdd(
+                ioReadFilterGroup(storageReadIo(read)), loadData->cipherType, cipherModeDecrypt, loadData->cipherPass);
+
+            Buffer *const dict = storageGetP(read);
+
+            MEM_CONTEXT_BEGIN(archiveDictLocal.memContext)
+            {
+                const ArchiveDictCache cache =
+                {
+                    .storage = loadData->storage,
+                    .archivePath = strDup(loadData->archivePath),
+                    .dictId = dictId,
+                    .dict = bufMove(dict, archiveDictLocal.memContext),
+                };
+
+                lstAdd(archiveDictLocal.cacheList, &cache);
+                result = cache.dict;
+            }
+            MEM_CONTEXT_END();
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+
+    FUNCTION_LOG_RETURN_CONST(BUFFER, result);
+}
+
 /**********************************************************************************************************************************/
 void
 archiveAsyncErrorClear(ArchiveMode archiveMode, const String *archiveFile)
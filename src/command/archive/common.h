@@ -20,6 +20,7 @@ typedef enum
 } ArchiveMode;
 
 #include "common/compress/helper.h"
+#include "common/crypto/common.h"
 #include "common/type/stringList.h"
 #include "storage/storage.h"
 
@@ -62,9 +63,34 @@ WAL segment constants
 #define WAL_TIMELINE_HISTORY_REGEXP                                 "^[0-F]{8}.history$"
     STRING_DECLARE(WAL_TIMELINE_HISTORY_REGEXP_STR);
 
+/***********************************************************************************************************************************
+Compression dictionary constants
+
+Dictionaries are stored in the archive id path and named with the dictionary id that is recorded in each compressed frame. A
+dictionary never changes once written and decompression can find the dictionary it requires without consulting archive.info.
+***********************************************************************************************************************************/
+#define ARCHIVE_DICT_PATH                                           "dict"
+#define ARCHIVE_DICT_EXT                                            ".dict"
+#define ARCHIVE_DICT_REGEXP                                         "^[0-f]{8}\\" ARCHIVE_DICT_EXT "$"
+
+/***********************************************************************************************************************************
+Data required to load a compression dictionary with archiveDictLoad()
+***********************************************************************************************************************************/
+typedef struct ArchiveDictLoadData
+{
+    const Storage *storage;                                         // Repo storage
+    const String *archivePath;                                      // Archive id path, e.g. STORAGE_REPO_ARCHIVE "/14-1"
+    CipherType cipherType;                                          // Repo cipher type
+    const String *cipherPass;                                       // Repo archive cipher pass
+} ArchiveDictLoadData;
+
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
+// Load a compression dictionary from the archive. This is passed as dictLoad to decompressFilterP() with ArchiveDictLoadData. The
+// dictionary is cached for the life of the process so it is only loaded once per repo and archive id.
+const Buffer *archiveDictLoad(void *data, unsigned int dictId);
+
 // Remove errors for an archive file.  This should be done before forking the async process to prevent a race condition where an
 // old error may be reported rather than waiting for the async process to succeed or fail.
 void archiveAsyncErrorClear(ArchiveMode archiveMode, const String *archiveFile);
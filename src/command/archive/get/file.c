@@ -67,7 +67,19 @@ ArchiveGetFileResult archiveGetFile(
 
                 if (compressType != compressTypeNone)
                 {
-                    ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(destination)), decompressFilter(compressType));
+                    ArchiveDictLoadData *const dictLoadData = memNew(sizeof(ArchiveDictLoadData));
+
+                    *dictLoadData = (ArchiveDictLoadData)
+                    {
+                        .storage = storageRepoIdx(actual->repoIdx),
+                        .archivePath = strNewFmt(STORAGE_REPO_ARCHIVE "/%s", strZ(actual->archiveId)),
+                        .cipherType = actual->cipherType,
+                        .cipherPass = actual->cipherPassArchive,
+                    };
+
+                    ioFilterGroupAdd(
+                        ioWriteFilterGroup(storageWriteIo(destination)),
+                        decompressFilterP(compressType, .dictLoad = archiveDictLoad, .dictLoadData = dictLoadData));
                     compressible = false;
                 }
 
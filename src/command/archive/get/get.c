@@ -17,7 +17,9 @@ Archive Get Command
 #include "common/log.h"
 #include "common/memContext.h"
 #include "common/regExp.h"
+#include "common/type/json.h"
 #include "common/wait.h"
+#include "common/watch.h"
 #include "config/config.h"
 #include "config/exec.h"
 #include "info/infoArchive.h"
@@ -515,6 +517,147 @@ archiveGetCheck(const StringList *archiveRequestList)
     FUNCTION_LOG_RETURN_STRUCT(result);
 }
 
+/***********************************************************************************************************************************
+Queue statistics are stored in the spool path so the queue size can adapt to the rate that PostgreSQL consumes WAL segments and the
+time required by the async process to fetch them from the repository. The file is written by the main process when the async
+process is launched and updated by the async process when it has fetched segments. Both happen while holding the archive lock.
+***********************************************************************************************************************************/
+#define QUEUE_STAT_FILE                                             STORAGE_SPOOL_ARCHIVE "/in.stat"
+
+#define QUEUE_STAT_KEY_FETCH_TIME                                   "fetch-time"
+    VARIANT_STRDEF_STATIC(QUEUE_STAT_KEY_FETCH_TIME_VAR, QUEUE_STAT_KEY_FETCH_TIME);
+#define QUEUE_STAT_KEY_LAST                                         "last"
+    VARIANT_STRDEF_STATIC(QUEUE_STAT_KEY_LAST_VAR, QUEUE_STAT_KEY_LAST);
+#define QUEUE_STAT_KEY_TIME                                         "time"
+    VARIANT_STRDEF_STATIC(QUEUE_STAT_KEY_TIME_VAR, QUEUE_STAT_KEY_TIME);
+#define QUEUE_STAT_KEY_TOTAL                                        "total"
+    VARIANT_STRDEF_STATIC(QUEUE_STAT_KEY_TOTAL_VAR, QUEUE_STAT_KEY_TOTAL);
+
+typedef struct QueueStat
+{
+    TimeMSec time;                                                  // Time the async process was last launched
+    unsigned int total;                                             // Segments in the queue when the async process was launched
+    const String *last;                                             // Last segment in the queue when the async process was launched
+    TimeMSec fetchTime;                                             // Time required by the async process to fetch segments
+} QueueStat;
+
+static QueueStat
+queueStatRead(void)
+{
+    FUNCTION_LOG_VOID(logLevelDebug);
+
+    QueueStat result = {0};
+
+    const Buffer *const buffer = storageGetP(storageNewReadP(storageSpool(), STRDEF(QUEUE_STAT_FILE), .ignoreMissing = true));
+
+    // The statistics only tune the queue size so if they cannot be read then proceed as if there were none
+    if (buffer != NULL)
+    {
+        TRY_BEGIN()
+        {
+            const KeyValue *const stat = jsonToKv(strNewBuf(buffer));
+            const Variant *const time = kvGet(stat, QUEUE_STAT_KEY_TIME_VAR);
+            const Variant *const total = kvGet(stat, QUEUE_STAT_KEY_TOTAL_VAR);
+            const Variant *const last = kvGet(stat, QUEUE_STAT_KEY_LAST_VAR);
+            const Variant *const fetchTime = kvGet(stat, QUEUE_STAT_KEY_FETCH_TIME_VAR);
+
+            if (time == NULL || total == NULL || last == NULL || varType(last) != varTypeString || fetchTime == NULL)
+                THROW(FormatError, "missing or invalid key");
+
+            const QueueStat statRead =
+            {
+                .time = varUInt64Force(time),
+                .total = varUIntForce(total),
+                .last = varStr(last),
+                .fetchTime = varUInt64Force(fetchTime),
+            };
+
+            result = statRead;
+        }
+        CATCH_ANY()
+        {
+            LOG_DETAIL_FMT(
+                "unable to read queue statistics from '" QUEUE_STAT_FILE "', ignoring: [%s] %s", errorTypeName(errorType()),
+                errorMessage());
+        }
+        TRY_END();
+    }
+
+    FUNCTION_LOG_RETURN_STRUCT(result);
+}
+
+static void
+queueStatWrite(const QueueStat *const stat)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM_P(VOID, stat);
+    FUNCTION_LOG_END();
+
+    ASSERT(stat != NULL);
+    ASSERT(stat->last != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        KeyValue *const kv = kvNew();
+
+        kvPut(kv, QUEUE_STAT_KEY_TIME_VAR, VARUINT64(stat->time));
+        kvPut(kv, QUEUE_STAT_KEY_TOTAL_VAR, VARUINT(stat->total));
+        kvPut(kv, QUEUE_STAT_KEY_LAST_VAR, VARSTR(stat->last));
+        kvPut(kv, QUEUE_STAT_KEY_FETCH_TIME_VAR, VARUINT64(stat->fetchTime));
+
+        storagePutP(storageNewWriteP(storageSpoolWrite(), STRDEF(QUEUE_STAT_FILE)), BUFSTR(jsonFromKv(kv)));
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Determine how many WAL segments should be in the queue. Without statistics from a prior async process the queue is sized by
+archive-get-queue-max. Otherwise the queue holds the segments PostgreSQL is expected to consume during two async runs, based on the
+rate segments were consumed since the last launch and the time the async process took to fetch them. If the requested segment is
+past the end of the prior queue then PostgreSQL had to wait, so the queue is at least doubled.
+***********************************************************************************************************************************/
+static unsigned int
+queueTotal(
+    const QueueStat *const stat, const String *const walSegment, const unsigned int queueRemain, const TimeMSec timeNow,
+    const unsigned int queueTotalMax)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, stat);
+        FUNCTION_TEST_PARAM(STRING, walSegment);
+        FUNCTION_TEST_PARAM(UINT, queueRemain);
+        FUNCTION_TEST_PARAM(TIME_MSEC, timeNow);
+        FUNCTION_TEST_PARAM(UINT, queueTotalMax);
+    FUNCTION_TEST_END();
+
+    ASSERT(stat != NULL);
+    ASSERT(walSegment != NULL);
+
+    unsigned int result = queueTotalMax;
+
+    if (stat->fetchTime > 0 && timeNow > stat->time)
+    {
+        const unsigned int consumed = stat->total > queueRemain ? stat->total - queueRemain : 0;
+        const TimeMSec elapsed = timeNow - stat->time;
+        const uint64_t need = ((uint64_t)consumed * stat->fetchTime * 2 + elapsed - 1) / elapsed;
+
+        result = need < queueTotalMax ? (unsigned int)need : queueTotalMax;
+
+        if (strCmp(walSegment, stat->last) > 0 && result < stat->total * 2)
+            result = stat->total * 2;
+
+        if (result > queueTotalMax)
+            result = queueTotalMax;
+    }
+
+    // The queue total must be at least 2 or it doesn't make sense to have async turned on at all
+    if (result < 2)
+        result = 2;
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 /***********************************************************************************************************************************
 Clean the queue and prepare a list of WAL segments that the async process should get
 ***********************************************************************************************************************************/
@@ -637,11 +780,21 @@ cmdArchiveGet(void)
             bool queueFull = false;                                     // Is the queue half or more full?
             bool forked = false;                                        // Has the async process been forked yet?
 
-            // Loop and wait for the WAL segment to be pushed
+            // Loop and wait for the WAL segment to be found. Wake when a WAL segment or status file is written to the spool rather
+            // than sleeping the full interval.
+            Watch *watch = watchNew();
+            bool watching = false;
             Wait *wait = waitNew(cfgOptionUInt64(cfgOptArchiveTimeout));
 
+            waitWatchSet(wait, watch);
+
             do
             {
+                // Watch the spool path before checking the queue so a WAL segment written after the check is not missed. The path
+                // is created before the async process is launched so it may not exist yet.
+                if (!watching)
+                    watching = watchPathAdd(watch, storagePathP(storageSpool(), STORAGE_SPOOL_ARCHIVE_IN_STR));
+
                 // Check if the WAL segment is already in the queue
                 found = storageExistsP(storageSpool(), strNewFmt(STORAGE_SPOOL_ARCHIVE_IN "/%s", strZ(walSegment)));
 
@@ -701,8 +854,15 @@ cmdArchiveGet(void)
                         // Get size of the WAL segment
                         uint64_t walSegmentSize = storageInfoP(storageLocal(), walDestination).size;
 
-                        // Use WAL segment size to estimate queue size and determine if the async process should be launched
-                        queueFull = strLstSize(queue) * walSegmentSize > cfgOptionUInt64(cfgOptArchiveGetQueueMax) / 2;
+                        // Use WAL segment size to estimate queue size and determine if the async process should be launched. Use
+                        // the queue size chosen when the async process was last launched if it is smaller than the queue max.
+                        const QueueStat stat = queueStatRead();
+                        uint64_t queueSize = cfgOptionUInt64(cfgOptArchiveGetQueueMax);
+
+                        if (stat.total > 0 && stat.total * walSegmentSize < queueSize)
+                            queueSize = stat.total * walSegmentSize;
+
+                        queueFull = strLstSize(queue) * walSegmentSize > queueSize / 2;
                     }
                 }
 
@@ -730,12 +890,32 @@ cmdArchiveGet(void)
                     StringList *commandExec = cfgExecParam(cfgCmdArchiveGet, cfgCmdRoleAsync, optionReplace, true, false);
                     strLstInsert(commandExec, 0, cfgExe());
 
+                    // Determine the queue size from statistics gathered since the async process was last launched
+                    QueueStat stat = queueStatRead();
+                    const TimeMSec timeNow = timeMSec();
+
+                    stat.total = queueTotal(
+                        &stat, walSegment,
+                        strLstSize(
+                            storageListP(storageSpool(), STORAGE_SPOOL_ARCHIVE_IN_STR, .expression = WAL_SEGMENT_REGEXP_STR)),
+                        timeNow, (unsigned int)(cfgOptionUInt64(cfgOptArchiveGetQueueMax) / pgControl.walSegmentSize));
+                    stat.time = timeNow;
+
                     // Clean the current queue using the list of WAL that we ideally want in the queue.  queueNeed()
                     // will return the list of WAL needed to fill the queue and this will be passed to the async process.
                     const StringList *queue = queueNeed(
-                        walSegment, found, cfgOptionUInt64(cfgOptArchiveGetQueueMax), pgControl.walSegmentSize,
+                        walSegment, found, (uint64_t)stat.total * pgControl.walSegmentSize, pgControl.walSegmentSize,
                         pgControl.version);
 
+                    // Store the last segment in the ideal queue so the next launch can tell if PostgreSQL waited on the queue
+                    stat.last = strLstGet(
+                        walSegmentRange(
+                            found ? walSegmentNext(walSegment, pgControl.walSegmentSize, pgControl.version) : walSegment,
+                            pgControl.walSegmentSize, pgControl.version, stat.total),
+                        stat.total - 1);
+
+                    queueStatWrite(&stat);
+
                     for (unsigned int queueIdx = 0; queueIdx < strLstSize(queue); queueIdx++)
                         strLstAdd(commandExec, strLstGet(queue, queueIdx));
 
@@ -897,6 +1077,7 @@ cmdArchiveGetAsync(void)
                     "" : strZ(strNewFmt("...%s", strZ(strLstGet(cfgCommandParam(), strLstSize(cfgCommandParam()) - 1)))));
 
             // Check for archive files
+            const TimeMSec timeBegin = timeMSec();
             ArchiveGetCheckResult checkResult = archiveGetCheck(cfgCommandParam());
 
             // If any files are missing get the first one (used to construct the "unable to find" warning)
@@ -912,9 +1093,16 @@ cmdArchiveGetAsync(void)
                 ArchiveGetAsyncData jobData = {.archiveFileMapList = checkResult.archiveFileMapList};
 
                 ProtocolParallel *parallelExec = protocolParallelNew(
-                    cfgOptionUInt64(cfgOptProtocolTimeout) / 2, archiveGetAsyncCallback, &jobData);
+                    cfgOptionUInt64(cfgOptProtocolTimeout) / 2, cfgOptionUInt(cfgOptJobQueueMax), archiveGetAsyncCallback,
+                    &jobData);
+
+                // The queue size adapts to demand so do not start more processes than there are files to get
+                unsigned int processMax = cfgOptionUInt(cfgOptProcessMax);
+
+                if (processMax > lstSize(checkResult.archiveFileMapList))
+                    processMax = lstSize(checkResult.archiveFileMapList);
 
-                for (unsigned int processIdx = 1; processIdx <= cfgOptionUInt(cfgOptProcessMax); processIdx++)
+                for (unsigned int processIdx = 1; processIdx <= processMax; processIdx++)
                     protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypeRepo, 0, processIdx));
 
                 // Process jobs
@@ -991,6 +1179,15 @@ cmdArchiveGetAsync(void)
                     }
                 }
                 while (!protocolParallelDone(parallelExec));
+
+                // Update queue statistics with the time required to fetch the files so the main process can size the next queue
+                QueueStat stat = queueStatRead();
+
+                if (stat.total > 0)
+                {
+                    stat.fetchTime = timeMSec() - timeBegin;
+                    queueStatWrite(&stat);
+                }
             }
 
             // Log an error from archiveGetCheck() after any existing files have been fetched. This ordering is important because we
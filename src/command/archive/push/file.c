@@ -92,11 +92,248 @@ archivePushFileIo(ArchivePushFileIoType type, IoWrite *write, const Buffer *buff
     FUNCTION_TEST_RETURN(result);
 }
 
+/***********************************************************************************************************************************
+Dictionaries known to be stored in each repo are cached for the life of the process so the repos are not listed and the dictionary
+is not loaded again for every WAL segment pushed
+***********************************************************************************************************************************/
+typedef struct ArchivePushDictCache
+{
+    unsigned int repoIdx;                                           // Repo index
+    const String *archiveId;                                        // Archive id
+    unsigned int dictId;                                            // Dictionary id
+    const Buffer *dict;                                             // Dictionary
+} ArchivePushDictCache;
+
+static struct ArchivePushDictLocal
+{
+    MemContext *memContext;                                         // Mem context for the cache
+    List *cacheList;                                                // Dictionaries stored in each repo
+} archivePushDictLocal;
+
+// Find the dictionary cached for a repo and archive id
+static const ArchivePushDictCache *
+archivePushDictCacheFind(const unsigned int repoIdx, const String *const archiveId)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(UINT, repoIdx);
+        FUNCTION_TEST_PARAM(STRING, archiveId);
+    FUNCTION_TEST_END();
+
+    ASSERT(archiveId != NULL);
+
+    if (archivePushDictLocal.cacheList != NULL)
+    {
+        for (unsigned int cacheIdx = 0; cacheIdx < lstSize(archivePushDictLocal.cacheList); cacheIdx++)
+        {
+            const ArchivePushDictCache *const cache = lstGet(archivePushDictLocal.cacheList, cacheIdx);
+
+            if (cache->repoIdx == repoIdx && strEq(cache->archiveId, archiveId))
+                FUNCTION_TEST_RETURN(cache);
+        }
+    }
+
+    FUNCTION_TEST_RETURN(NULL);
+}
+
+// Cache the dictionary for a repo and archive id. The dictionary must already be in the cache mem context.
+static void
+archivePushDictCacheAdd(
+    const unsigned int repoIdx, const String *const archiveId, const unsigned int dictId, const Buffer *const dict)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(UINT, repoIdx);
+        FUNCTION_TEST_PARAM(STRING, archiveId);
+        FUNCTION_TEST_PARAM(UINT, dictId);
+        FUNCTION_TEST_PARAM(BUFFER, dict);
+    FUNCTION_TEST_END();
+
+    ASSERT(archiveId != NULL);
+    ASSERT(dict != NULL);
+    ASSERT(archivePushDictLocal.memContext != NULL);
+
+    MEM_CONTEXT_BEGIN(archivePushDictLocal.memContext)
+    {
+        const ArchivePushDictCache cache = {.repoIdx = repoIdx, .archiveId = strDup(archiveId), .dictId = dictId, .dict = dict};
+
+        lstAdd(archivePushDictLocal.cacheList, &cache);
+    }
+    MEM_CONTEXT_END();
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Get the compression dictionary for the archive id
+
+The dictionary already stored in the repos is used when there is one. Otherwise a dictionary is trained from the WAL segment being
+pushed, which is a good sample since WAL for a cluster tends to repeat the same page and record layouts. The dictionary is then
+stored in each repo that does not have it so every repo can decompress the WAL that it receives. NULL is returned when a dictionary
+could not be trained or stored.
+***********************************************************************************************************************************/
+#define ARCHIVE_PUSH_DICT_SIZE                                      (110 * 1024)
+#define ARCHIVE_PUSH_DICT_SAMPLE_SIZE                               (8 * 1024)
+
+static const Buffer *
+archivePushDict(
+    const String *const walSource, const CompressType compressType, const List *const repoList, bool *const destinationCopy,
+    StringList *const errorList)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, walSource);
+        FUNCTION_LOG_PARAM(ENUM, compressType);
+        FUNCTION_LOG_PARAM_P(VOID, repoList);
+        FUNCTION_LOG_PARAM_P(BOOL, destinationCopy);
+        FUNCTION_LOG_PARAM(STRING_LIST, errorList);
+    FUNCTION_LOG_END();
+
+    ASSERT(walSource != NULL);
+    ASSERT(compressDictSupported(compressType));
+    ASSERT(repoList != NULL);
+    ASSERT(destinationCopy != NULL);
+    ASSERT(errorList != NULL);
+
+    const Buffer *result = NULL;
+
+    // Create the cache
+    if (archivePushDictLocal.memContext == NULL)
+    {
+        MEM_CONTEXT_BEGIN(memContextTop())
+        {
+            MEM_CONTEXT_NEW_BEGIN("ArchivePushDictLocal")
+            {
+                archivePushDictLocal.memContext = MEM_CONTEXT_NEW();
+                archivePushDictLocal.cacheList = lstNewP(sizeof(ArchivePushDictCache));
+            }
+            MEM_CONTEXT_NEW_END();
+        }
+        MEM_CONTEXT_END();
+    }
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        Buffer *dict = NULL;
+
+        // Get the first dictionary cached or found in the repos. When there is more than one in a repo the lowest id is used so all
+        // pushes agree.
+        for (unsigned int repoListIdx = 0; repoListIdx < lstSize(repoList); repoListIdx++)
+        {
+            const ArchivePushFileRepoData *const repoData = lstGet(repoList, repoListIdx);
+
+            if (!destinationCopy[repoListIdx])
+                continue;
+
+            const ArchivePushDictCache *const cache = archivePushDictCacheFind(repoData->repoIdx, repoData->archiveId);
+
+            if (cache != NULL)
+            {
+                result = cache->dict;
+                break;
+            }
+
+            TRY_BEGIN()
+            {
+                const String *const dictPath = strNewFmt(
+                    STORAGE_REPO_ARCHIVE "/%s/" ARCHIVE_DICT_PATH, strZ(repoData->archiveId));
+                const StringList *const dictList = strLstSort(
+                    storageListP(storageRepoIdx(repoData->repoIdx), dictPath, .expression = STRDEF(ARCHIVE_DICT_REGEXP)),
+                    sortOrderAsc);
+
+                if (!strLstEmpty(dictList))
+                {
+                    StorageRead *const read = storageNewReadP(
+                        storageRepoIdx(repoData->repoIdx), strNewFmt("%s/%s", strZ(dictPath), strZ(strLstGet(dictList, 0))));
+
+                    cipherBlockFilterGroupAdd(
+                        ioReadFilterGroup(storageReadIo(read)), repoData->cipherType, cipherModeDecrypt, repoData->cipherPass);
+
+                    dict = storageGetP(read);
+                }
+            }
+            CATCH_ANY()
+            {
+                archivePushErrorAdd(errorList, repoData->repoIdx);
+                destinationCopy[repoListIdx] = false;
+            }
+            TRY_END();
+
+            // Cache the dictionary for the repo it was loaded from
+            if (dict != NULL)
+            {
+                result = bufMove(dict, archivePushDictLocal.memContext);
+                archivePushDictCacheAdd(repoData->repoIdx, repoData->archiveId, compressDictId(compressType, result), result);
+                break;
+            }
+        }
+
+        // Else train a dictionary from the WAL segment
+        if (result == NULL)
+        {
+            dict = compressDictTrain(
+                compressType, storageGetP(storageNewReadP(storageLocal(), walSource)), ARCHIVE_PUSH_DICT_SAMPLE_SIZE,
+                ARCHIVE_PUSH_DICT_SIZE);
+        }
+
+        // Store the dictionary in repos that do not have it
+        if (result != NULL || dict != NULL)
+        {
+            const unsigned int dictId = compressDictId(compressType, result != NULL ? result : dict);
+
+            for (unsigned int repoListIdx = 0; repoListIdx < lstSize(repoList); repoListIdx++)
+            {
+                const ArchivePushFileRepoData *const repoData = lstGet(repoList, repoListIdx);
+
+                if (!destinationCopy[repoListIdx])
+                    continue;
+
+                // Skip the repo when the dictionary is already known to be stored
+                const ArchivePushDictCache *const cache = archivePushDictCacheFind(repoData->repoIdx, repoData->archiveId);
+
+                if (cache != NULL && cache->dictId == dictId)
+                    continue;
+
+                TRY_BEGIN()
+                {
+                    const String *const dictFile = strNewFmt(
+                        STORAGE_REPO_ARCHIVE "/%s/" ARCHIVE_DICT_PATH "/%08x" ARCHIVE_DICT_EXT, strZ(repoData->archiveId),
+                        dictId);
+
+                    if (!storageExistsP(storageRepoIdx(repoData->repoIdx), dictFile))
+                    {
+                        StorageWrite *const write = storageNewWriteP(storageRepoIdxWrite(repoData->repoIdx), dictFile);
+
+                        cipherBlockFilterGroupAdd(
+                            ioWriteFilterGroup(storageWriteIo(write)), repoData->cipherType, cipherModeEncrypt,
+                            repoData->cipherPass);
+
+                        storagePutP(write, result != NULL ? result : dict);
+                    }
+
+                    // Keep a trained dictionary once it has been stored in a repo
+                    if (result == NULL)
+                        result = bufMove(dict, archivePushDictLocal.memContext);
+
+                    archivePushDictCacheAdd(repoData->repoIdx, repoData->archiveId, dictId, result);
+                }
+                CATCH_ANY()
+                {
+                    archivePushErrorAdd(errorList, repoData->repoIdx);
+                    destinationCopy[repoListIdx] = false;
+                }
+                TRY_END();
+            }
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_CONST(BUFFER, result);
+}
+
 /**********************************************************************************************************************************/
 ArchivePushFileResult
 archivePushFile(
     const String *walSource, bool headerCheck, unsigned int pgVersion, uint64_t pgSystemId, const String *archiveFile,
-    CompressType compressType, int compressLevel, const List *const repoList, const StringList *const priorErrorList)
+    CompressType compressType, int compressLevel, unsigned int compressThread, bool compressDict, const List *const repoList,
+    const StringList *const priorErrorList)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING, walSource);
@@ -106,6 +343,8 @@ archivePushFile(
         FUNCTION_LOG_PARAM(STRING, archiveFile);
         FUNCTION_LOG_PARAM(ENUM, compressType);
         FUNCTION_LOG_PARAM(INT, compressLevel);
+        FUNCTION_LOG_PARAM(UINT, compressThread);
+        FUNCTION_LOG_PARAM(BOOL, compressDict);
         FUNCTION_LOG_PARAM_P(VOID, repoList);
         FUNCTION_LOG_PARAM(STRING_LIST, priorErrorList);
     FUNCTION_LOG_END();
@@ -238,8 +477,16 @@ archivePushFile(
             // If the file will be compressed then add compression filter
             if (isSegment && compressType != compressTypeNone)
             {
+                // Get the dictionary when requested and supported by the compression type
+                const Buffer *dict = NULL;
+
+                if (compressDict && compressDictSupported(compressType))
+                    dict = archivePushDict(walSource, compressType, repoList, destinationCopy, errorList);
+
                 compressExtCat(archiveDestination, compressType);
-                ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(source)), compressFilter(compressType, compressLevel));
+                ioFilterGroupAdd(
+                    ioReadFilterGroup(storageReadIo(source)),
+                    compressFilterP(compressType, compressLevel, .threadTotal = compressThread, .dict = dict));
                 compressible = false;
             }
 
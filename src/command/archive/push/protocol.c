@@ -26,14 +26,14 @@ archivePushFileProtocol(PackRead *const param, ProtocolServer *const server)
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
-        // Read parameters
-        const String *const walSource = pckReadStrP(param);
+        // Options that apply to all files
         const bool headerCheck = pckReadBoolP(param);
         const unsigned int pgVersion = pckReadU32P(param);
         const uint64_t pgSystemId = pckReadU64P(param);
-        const String *const archiveFile = pckReadStrP(param);
         const CompressType compressType = pckReadU32P(param);
         const int compressLevel = pckReadI32P(param);
+        const unsigned int compressThread = pckReadU32P(param);
+        const bool compressDict = pckReadBoolP(param);
         const StringList *const priorErrorList = pckReadStrLstP(param);
 
         // Read repo data
@@ -56,12 +56,38 @@ archivePushFileProtocol(PackRead *const param, ProtocolServer *const server)
 
         pckReadArrayEndP(param);
 
-        // Push file
-        const ArchivePushFileResult fileResult = archivePushFile(
-            walSource, headerCheck, pgVersion, pgSystemId, archiveFile, compressType, compressLevel, repoList, priorErrorList);
+        // Push each file in the batch. Errors are returned per file rather than thrown so a single failure does not prevent the
+        // status of the other files in the batch from being reported.
+        PackWrite *const resultPack = protocolPackNew();
+
+        while (!pckReadNullP(param))
+        {
+            const String *const walSource = pckReadStrP(param);
+            const String *const archiveFile = pckReadStrP(param);
+
+            pckWriteStrP(resultPack, archiveFile);
+
+            TRY_BEGIN()
+            {
+                const ArchivePushFileResult fileResult = archivePushFile(
+                    walSource, headerCheck, pgVersion, pgSystemId, archiveFile, compressType, compressLevel, compressThread,
+                    compressDict, repoList, priorErrorList);
+
+                pckWriteI32P(resultPack, 0);
+                pckWriteStrP(resultPack, NULL);
+                pckWriteStrLstP(resultPack, fileResult.warnList);
+            }
+            CATCH_ANY()
+            {
+                pckWriteI32P(resultPack, errorCode());
+                pckWriteStrP(resultPack, STR(errorMessage()));
+                pckWriteStrLstP(resultPack, NULL);
+            }
+            TRY_END();
+        }
 
         // Return result
-        protocolServerDataPut(server, pckWriteStrLstP(protocolPackNew(), fileResult.warnList));
+        protocolServerDataPut(server, resultPack);
         protocolServerDataEndPut(server);
     }
     MEM_CONTEXT_TEMP_END();
@@ -16,6 +16,7 @@ Archive Push Command
 #include "common/log.h"
 #include "common/memContext.h"
 #include "common/wait.h"
+#include "common/watch.h"
 #include "config/config.h"
 #include "config/exec.h"
 #include "info/infoArchive.h"
@@ -124,15 +125,16 @@ archivePushReadyList(const String *walPath)
 Determine which WAL files need to be pushed to the archive when in async mode
 
 This is the heart of the "look ahead" functionality in async archiving.  Any files in the out directory that do not end in ok are
-removed and any ok files that do not have a corresponding ready file in archive_status (meaning it has been acknowledged by
-PostgreSQL) are removed.  Then all ready files that do not have a corresponding ok file (meaning it has already been processed) are
-returned for processing.
+removed (except error files for WAL files in errorKeepList, which may be NULL) and any ok files that do not have a corresponding
+ready file in archive_status (meaning it has been acknowledged by PostgreSQL) are removed.  Then all ready files that do not have a
+corresponding ok file (meaning it has already been processed) are returned for processing.
 ***********************************************************************************************************************************/
 static StringList *
-archivePushProcessList(const String *walPath)
+archivePushProcessList(const String *const walPath, const StringList *const errorKeepList)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(STRING, walPath);
+        FUNCTION_LOG_PARAM(STRING_LIST, errorKeepList);
     FUNCTION_LOG_END();
 
     ASSERT(walPath != NULL);
@@ -157,7 +159,9 @@ archivePushProcessList(const String *walPath)
 
             if (strEndsWithZ(statusFile, STATUS_EXT_OK))
                 strLstAdd(okList, strSubN(statusFile, 0, strSize(statusFile) - STATUS_EXT_OK_SIZE));
-            else
+            // Keep the error so the archive_command continues to report it until the WAL file is retried
+            else if (!(errorKeepList != NULL && strEndsWithZ(statusFile, STATUS_EXT_ERROR) &&
+                       strLstExists(errorKeepList, strSubN(statusFile, 0, strSize(statusFile) - STATUS_EXT_ERROR_SIZE))))
             {
                 storageRemoveP(
                     storageSpoolWrite(), strNewFmt(STORAGE_SPOOL_ARCHIVE_OUT "/%s", strZ(statusFile)), .errorOnMissing = true);
@@ -338,11 +342,21 @@ cmdArchivePush(void)
                     cfgOptionName(cfgOptPgPath));
             }
 
-            // Loop and wait for the WAL segment to be pushed
+            // Loop and wait for the WAL segment to be pushed. Wake when a status file is written to the spool rather than sleeping
+            // the full interval.
+            Watch *watch = watchNew();
+            bool watching = false;
             Wait *wait = waitNew(cfgOptionUInt64(cfgOptArchiveTimeout));
 
+            waitWatchSet(wait, watch);
+
             do
             {
+                // Watch the spool path before checking status so a status written after the check is not missed. The path is
+                // created by the async process so it may not exist yet.
+                if (!watching)
+                    watching = watchPathAdd(watch, storagePathP(storageSpool(), STORAGE_SPOOL_ARCHIVE_OUT_STR));
+
                 // Check if the WAL segment has been pushed.  Errors will not be thrown on the first try to allow the async process
                 // a chance to fix them.
                 pushed = archiveAsyncStatus(archiveModePush, archiveFile, throwOnError, true);
@@ -413,7 +427,8 @@ cmdArchivePush(void)
                 // Push the file to the archive
                 ArchivePushFileResult fileResult = archivePushFile(
                     walFile, cfgOptionBool(cfgOptArchiveHeaderCheck), archiveInfo.pgVersion, archiveInfo.pgSystemId, archiveFile,
-                    compressTypeEnum(cfgOptionStr(cfgOptCompressType)), cfgOptionInt(cfgOptCompressLevel), archiveInfo.repoList,
+                    compressTypeEnum(cfgOptionStr(cfgOptCompressType)), cfgOptionInt(cfgOptCompressLevel),
+                    cfgOptionUInt(cfgOptCompressThread), cfgOptionBool(cfgOptArchivePushDict), archiveInfo.repoList,
                     archiveInfo.errorList);
 
                 // If a warning was returned then log it
@@ -430,17 +445,97 @@ cmdArchivePush(void)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Maximum number of WAL files to push in a single job. Batching reduces the per-job overhead when many WAL files are ready but status
+files are only written when the job completes, so the batch size is limited to keep the archive_command from waiting too long.
+***********************************************************************************************************************************/
+#define ARCHIVE_PUSH_BATCH_MAX                                      8
+
+/***********************************************************************************************************************************
+Wait before retrying a WAL file that could not be pushed. The wait doubles with each failure up to the maximum so a repository that
+is unavailable is not retried every time the process wakes.
+***********************************************************************************************************************************/
+#define ARCHIVE_PUSH_RETRY_WAIT_MIN                                 (5 * MSEC_PER_SEC)
+#define ARCHIVE_PUSH_RETRY_WAIT_MAX                                 (60 * MSEC_PER_SEC)
+
 /**********************************************************************************************************************************/
+// WAL file that could not be pushed
+typedef struct ArchivePushAsyncRetry
+{
+    String *walFile;                                                // WAL file
+    TimeMSec retryTime;                                             // Time when the WAL file can be retried
+    TimeMSec retryWait;                                             // Wait before the retry
+} ArchivePushAsyncRetry;
+
 typedef struct ArchivePushAsyncData
 {
     const String *walPath;                                          // Path to pg_wal/pg_xlog
     const StringList *walFileList;                                  // List of wal files to process
+    List *retryList;                                                // WAL files that could not be pushed
+    unsigned int pushTotal;                                         // WAL files pushed by the last process
     unsigned int walFileIdx;                                        // Current index in the list to be processed
+    unsigned int batchSize;                                         // WAL files to push per job
     CompressType compressType;                                      // Type of compression for WAL segments
     int compressLevel;                                              // Compression level for wal files
+    unsigned int compressThread;                                    // Compression threads for wal files
+    bool compressDict;                                              // Compress wal segments with a dictionary
     ArchivePushCheckResult archiveInfo;                             // Archive info
 } ArchivePushAsyncData;
 
+// Log and write the status file for a WAL file that could not be pushed and schedule a retry
+static void
+archivePushAsyncError(
+    ArchivePushAsyncData *const jobData, const unsigned int processId, const String *const walFile, const int code,
+    const String *const message)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, jobData);
+        FUNCTION_TEST_PARAM(UINT, processId);
+        FUNCTION_TEST_PARAM(STRING, walFile);
+        FUNCTION_TEST_PARAM(INT, code);
+        FUNCTION_TEST_PARAM(STRING, message);
+    FUNCTION_TEST_END();
+
+    LOG_WARN_PID_FMT(
+        processId, "could not push WAL file '%s' to the archive (will be retried): [%d] %s", strZ(walFile), code, strZ(message));
+
+    archiveAsyncStatusErrorWrite(archiveModePush, walFile, code, message);
+
+    // Double the wait when the WAL file has already failed
+    ArchivePushAsyncRetry *retry = lstFind(jobData->retryList, &walFile);
+
+    if (retry == NULL)
+    {
+        MEM_CONTEXT_BEGIN(lstMemContext(jobData->retryList))
+        {
+            retry = lstAdd(
+                jobData->retryList, &(ArchivePushAsyncRetry){.walFile = strDup(walFile), .retryWait = ARCHIVE_PUSH_RETRY_WAIT_MIN});
+        }
+        MEM_CONTEXT_END();
+    }
+    else
+        retry->retryWait = retry->retryWait * 2 < ARCHIVE_PUSH_RETRY_WAIT_MAX ? retry->retryWait * 2 : ARCHIVE_PUSH_RETRY_WAIT_MAX;
+
+    retry->retryTime = timeMSec() + retry->retryWait;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+// Remove a WAL file from the retry list, e.g. because it was pushed
+static void
+archivePushAsyncRetryRemove(List *const retryList, const unsigned int retryIdx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(LIST, retryList);
+        FUNCTION_TEST_PARAM(UINT, retryIdx);
+    FUNCTION_TEST_END();
+
+    strFree(((ArchivePushAsyncRetry *)lstGet(retryList, retryIdx))->walFile);
+    lstRemoveIdx(retryList, retryIdx);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 static ProtocolParallelJob *
 archivePushAsyncCallback(void *data, unsigned int clientIdx)
 {
@@ -457,19 +552,18 @@ archivePushAsyncCallback(void *data, unsigned int clientIdx)
 
     if (jobData->walFileIdx < strLstSize(jobData->walFileList))
     {
-        const String *walFile = strLstGet(jobData->walFileList, jobData->walFileIdx);
-        jobData->walFileIdx++;
+        const unsigned int walFileIdxBegin = jobData->walFileIdx;
 
         ProtocolCommand *const command = protocolCommandNew(PROTOCOL_COMMAND_ARCHIVE_PUSH_FILE);
         PackWrite *const param = protocolCommandParam(command);
 
-        pckWriteStrP(param, strNewFmt("%s/%s", strZ(jobData->walPath), strZ(walFile)));
         pckWriteBoolP(param, cfgOptionBool(cfgOptArchiveHeaderCheck));
         pckWriteU32P(param, jobData->archiveInfo.pgVersion);
         pckWriteU64P(param, jobData->archiveInfo.pgSystemId);
-        pckWriteStrP(param, walFile);
         pckWriteU32P(param, jobData->compressType);
         pckWriteI32P(param, jobData->compressLevel);
+        pckWriteU32P(param, jobData->compressThread);
+        pckWriteBoolP(param, jobData->compressDict);
         pckWriteStrLstP(param, jobData->archiveInfo.errorList);
 
         // Add data for each repo to push to
@@ -489,12 +583,187 @@ archivePushAsyncCallback(void *data, unsigned int clientIdx)
 
         pckWriteArrayEndP(param);
 
-        FUNCTION_TEST_RETURN(protocolParallelJobNew(VARSTR(walFile), command));
+        // Add WAL files to the batch
+        do
+        {
+            const String *const walFile = strLstGet(jobData->walFileList, jobData->walFileIdx);
+
+            pckWriteStrP(param, strNewFmt("%s/%s", strZ(jobData->walPath), strZ(walFile)));
+            pckWriteStrP(param, walFile);
+
+            jobData->walFileIdx++;
+        }
+        while (jobData->walFileIdx < strLstSize(jobData->walFileList) &&
+               jobData->walFileIdx - walFileIdxBegin < jobData->batchSize);
+
+        FUNCTION_TEST_RETURN(protocolParallelJobNew(VARUINT(walFileIdxBegin), command));
     }
 
     FUNCTION_TEST_RETURN(NULL);
 }
 
+/***********************************************************************************************************************************
+Push a list of ready WAL files and write a status file for each. The number of WAL files pushed is stored in pushTotal.
+***********************************************************************************************************************************/
+static void
+archivePushAsyncProcess(ArchivePushAsyncData *const jobData)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM_P(VOID, jobData);
+    FUNCTION_LOG_END();
+
+    ASSERT(jobData != NULL);
+    ASSERT(!strLstEmpty(jobData->walFileList));
+
+    jobData->pushTotal = 0;
+
+    LOG_INFO_FMT(
+        "push %u WAL file(s) to archive: %s%s", strLstSize(jobData->walFileList), strZ(strLstGet(jobData->walFileList, 0)),
+        strLstSize(jobData->walFileList) == 1 ?
+            "" : strZ(strNewFmt("...%s", strZ(strLstGet(jobData->walFileList, strLstSize(jobData->walFileList) - 1)))));
+
+    // Drop files if queue max has been exceeded
+    if (cfgOptionTest(cfgOptArchivePushQueueMax) && archivePushDrop(jobData->walPath, jobData->walFileList))
+    {
+        for (unsigned int walFileIdx = 0; walFileIdx < strLstSize(jobData->walFileList); walFileIdx++)
+        {
+            const String *walFile = strLstGet(jobData->walFileList, walFileIdx);
+            const String *warning = archivePushDropWarning(walFile, cfgOptionUInt64(cfgOptArchivePushQueueMax));
+
+            archiveAsyncStatusOkWrite(archiveModePush, walFile, warning);
+            LOG_WARN(strZ(warning));
+        }
+    }
+    // Else continue processing
+    else
+    {
+        // Check archive info for each repo
+        jobData->archiveInfo = archivePushCheck(true);
+
+        // Split WAL files evenly between processes so all processes have work, up to the batch max
+        const unsigned int processMax = cfgOptionUInt(cfgOptProcessMax);
+
+        jobData->batchSize = (strLstSize(jobData->walFileList) + processMax - 1) / processMax;
+
+        if (jobData->batchSize > ARCHIVE_PUSH_BATCH_MAX)
+            jobData->batchSize = ARCHIVE_PUSH_BATCH_MAX;
+
+        // Create the parallel executor
+        ProtocolParallel *parallelExec = protocolParallelNew(
+            cfgOptionUInt64(cfgOptProtocolTimeout) / 2, cfgOptionUInt(cfgOptJobQueueMax), archivePushAsyncCallback, jobData);
+
+        for (unsigned int processIdx = 1; processIdx <= processMax; processIdx++)
+            protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypeRepo, 0, processIdx));
+
+        // Process jobs
+        do
+        {
+            unsigned int completed = protocolParallelProcess(parallelExec);
+
+            for (unsigned int jobIdx = 0; jobIdx < completed; jobIdx++)
+            {
+                protocolKeepAlive();
+
+                // Get the job and the index of the first WAL file in the batch
+                ProtocolParallelJob *job = protocolParallelResult(parallelExec);
+                unsigned int processId = protocolParallelJobProcessId(job);
+                const unsigned int walFileIdxBegin = varUInt(protocolParallelJobKey(job));
+
+                // The job was successful so report the status of each WAL file in the batch
+                if (protocolParallelJobErrorCode(job) == 0)
+                {
+                    PackRead *const jobResult = protocolParallelJobResult(job);
+
+                    while (!pckReadNullP(jobResult))
+                    {
+                        const String *const walFile = pckReadStrP(jobResult);
+                        const int fileErrorCode = pckReadI32P(jobResult);
+                        const String *const fileErrorMessage = pckReadStrP(jobResult);
+                        const StringList *const fileWarnList = pckReadStrLstP(jobResult);
+
+                        // The WAL file was pushed
+                        if (fileErrorCode == 0)
+                        {
+                            // Output file warnings
+                            for (unsigned int warnIdx = 0; warnIdx < strLstSize(fileWarnList); warnIdx++)
+                                LOG_WARN_PID(processId, strZ(strLstGet(fileWarnList, warnIdx)));
+
+                            // Log success
+                            LOG_DETAIL_PID_FMT(processId, "pushed WAL file '%s' to the archive", strZ(walFile));
+
+                            // Write the status file
+                            archiveAsyncStatusOkWrite(
+                                archiveModePush, walFile, strLstEmpty(fileWarnList) ? NULL : strLstJoin(fileWarnList, "\n"));
+
+                            // No need to retry the WAL file
+                            const unsigned int retryIdx = lstFindIdx(jobData->retryList, &walFile);
+
+                            if (retryIdx != LIST_NOT_FOUND)
+                                archivePushAsyncRetryRemove(jobData->retryList, retryIdx);
+
+                            jobData->pushTotal++;
+                        }
+                        // Else the WAL file errored
+                        else
+                            archivePushAsyncError(jobData, processId, walFile, fileErrorCode, fileErrorMessage);
+                    }
+                }
+                // Else the job errored so none of the WAL files in the batch were pushed
+                else
+                {
+                    for (unsigned int walFileIdx = walFileIdxBegin;
+                         walFileIdx < strLstSize(jobData->walFileList) && walFileIdx - walFileIdxBegin < jobData->batchSize;
+                         walFileIdx++)
+                    {
+                        archivePushAsyncError(
+                            jobData, processId, strLstGet(jobData->walFileList, walFileIdx), protocolParallelJobErrorCode(job),
+                            protocolParallelJobErrorMessage(job));
+                    }
+                }
+
+                protocolParallelJobFree(job);
+            }
+        }
+        while (!protocolParallelDone(parallelExec));
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Wait for more WAL files to be marked ready. Returns false when no WAL files have been pushed for the grace period so the process can
+exit, even if WAL files are still failing. Wake at least once per second to check for ready WAL files in case the watch cannot
+report changes.
+***********************************************************************************************************************************/
+#define ARCHIVE_PUSH_GRACE_WAIT_MAX                                 MSEC_PER_SEC
+
+static bool
+archivePushAsyncGrace(Watch *const watch, const TimeMSec grace, const TimeMSec pushTime)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(WATCH, watch);
+        FUNCTION_LOG_PARAM(TIMEMSEC, grace);
+        FUNCTION_LOG_PARAM(TIMEMSEC, pushTime);
+    FUNCTION_LOG_END();
+
+    ASSERT(watch != NULL);
+
+    bool result = false;
+    const TimeMSec elapsed = timeMSec() - pushTime;
+
+    if (elapsed < grace)
+    {
+        watchWait(watch, grace - elapsed < ARCHIVE_PUSH_GRACE_WAIT_MAX ? grace - elapsed : ARCHIVE_PUSH_GRACE_WAIT_MAX);
+
+        // Keep remotes used to check the archive from timing out while idle
+        protocolKeepAlive();
+
+        result = true;
+    }
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
+
 void
 cmdArchivePushAsync(void)
 {
@@ -518,97 +787,77 @@ cmdArchivePushAsync(void)
             .walPath = strLstGet(commandParam, 0),
             .compressType = compressTypeEnum(cfgOptionStr(cfgOptCompressType)),
             .compressLevel = cfgOptionInt(cfgOptCompressLevel),
+            .compressThread = cfgOptionUInt(cfgOptCompressThread),
+            .compressDict = cfgOptionBool(cfgOptArchivePushDict),
+            .retryList = lstNewP(sizeof(ArchivePushAsyncRetry), .comparator = lstComparatorStr),
         };
 
         TRY_BEGIN()
         {
-            // Test for stop file
-            lockStopTest();
-
-            // Get a list of WAL files that are ready for processing
-            jobData.walFileList = archivePushProcessList(jobData.walPath);
+            // Watch archive_status before the first check for ready WAL files so a WAL file marked ready while pushing is not
+            // missed. No watch is needed when the process will exit as soon as the ready WAL files have been pushed.
+            const TimeMSec grace = cfgOptionUInt64(cfgOptArchivePushGrace);
+            Watch *const watch = watchNew();
 
-            // The archive-push:async command should not have been called unless there are WAL files to process
-            if (strLstEmpty(jobData.walFileList))
-                THROW(AssertError, "no WAL files to process");
+            if (grace > 0)
+                watchPathAdd(watch, strNewFmt("%s/" PG_PATH_ARCHIVE_STATUS, strZ(jobData.walPath)));
 
-            LOG_INFO_FMT(
-                "push %u WAL file(s) to archive: %s%s", strLstSize(jobData.walFileList), strZ(strLstGet(jobData.walFileList, 0)),
-                strLstSize(jobData.walFileList) == 1 ?
-                    "" : strZ(strNewFmt("...%s", strZ(strLstGet(jobData.walFileList, strLstSize(jobData.walFileList) - 1)))));
+            bool first = true;
+            TimeMSec pushTime = timeMSec();
 
-            // Drop files if queue max has been exceeded
-            if (cfgOptionTest(cfgOptArchivePushQueueMax) && archivePushDrop(jobData.walPath, jobData.walFileList))
+            do
             {
-                for (unsigned int walFileIdx = 0; walFileIdx < strLstSize(jobData.walFileList); walFileIdx++)
+                MEM_CONTEXT_TEMP_BEGIN()
                 {
-                    const String *walFile = strLstGet(jobData.walFileList, walFileIdx);
-                    const String *warning = archivePushDropWarning(walFile, cfgOptionUInt64(cfgOptArchivePushQueueMax));
+                    // Test for stop file
+                    lockStopTest();
 
-                    archiveAsyncStatusOkWrite(archiveModePush, walFile, warning);
-                    LOG_WARN(strZ(warning));
-                }
-            }
-            // Else continue processing
-            else
-            {
-                // Check archive info for each repo
-                jobData.archiveInfo = archivePushCheck(true);
-
-                // Create the parallel executor
-                ProtocolParallel *parallelExec = protocolParallelNew(
-                    cfgOptionUInt64(cfgOptProtocolTimeout) / 2, archivePushAsyncCallback, &jobData);
+                    // Get WAL files that cannot be retried yet
+                    const TimeMSec timeCurrent = timeMSec();
+                    StringList *const retryWaitList = strLstNew();
 
-                for (unsigned int processIdx = 1; processIdx <= cfgOptionUInt(cfgOptProcessMax); processIdx++)
-                    protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypeRepo, 0, processIdx));
-
-                // Process jobs
-                do
-                {
-                    unsigned int completed = protocolParallelProcess(parallelExec);
-
-                    for (unsigned int jobIdx = 0; jobIdx < completed; jobIdx++)
+                    for (unsigned int retryIdx = 0; retryIdx < lstSize(jobData.retryList); retryIdx++)
                     {
-                        protocolKeepAlive();
+                        const ArchivePushAsyncRetry *const retry = lstGet(jobData.retryList, retryIdx);
 
-                        // Get the job and job key
-                        ProtocolParallelJob *job = protocolParallelResult(parallelExec);
-                        unsigned int processId = protocolParallelJobProcessId(job);
-                        const String *walFile = varStr(protocolParallelJobKey(job));
+                        if (retry->retryTime > timeCurrent)
+                            strLstAdd(retryWaitList, retry->walFile);
+                    }
 
-                        // The job was successful
-                        if (protocolParallelJobErrorCode(job) == 0)
-                        {
-                            // Output file warnings
-                            StringList *fileWarnList = pckReadStrLstP(protocolParallelJobResult(job));
+                    strLstSort(retryWaitList, sortOrderAsc);
 
-                            for (unsigned int warnIdx = 0; warnIdx < strLstSize(fileWarnList); warnIdx++)
-                                LOG_WARN_PID(processId, strZ(strLstGet(fileWarnList, warnIdx)));
+                    // Get a list of WAL files that are ready for processing
+                    const StringList *const walFileList = archivePushProcessList(jobData.walPath, retryWaitList);
 
-                            // Log success
-                            LOG_DETAIL_PID_FMT(processId, "pushed WAL file '%s' to the archive", strZ(walFile));
+                    // The archive-push:async command should not have been called unless there are WAL files to process
+                    if (first && strLstEmpty(walFileList))
+                        THROW(AssertError, "no WAL files to process");
 
-                            // Write the status file
-                            archiveAsyncStatusOkWrite(
-                                archiveModePush, walFile, strLstEmpty(fileWarnList) ? NULL : strLstJoin(fileWarnList, "\n"));
-                        }
-                        // Else the job errored
-                        else
-                        {
-                            LOG_WARN_PID_FMT(
-                                processId,
-                                "could not push WAL file '%s' to the archive (will be retried): [%d] %s", strZ(walFile),
-                                protocolParallelJobErrorCode(job), strZ(protocolParallelJobErrorMessage(job)));
+                    // Forget WAL files that no longer need to be pushed, e.g. dropped or pushed by another process
+                    for (unsigned int retryIdx = lstSize(jobData.retryList); retryIdx > 0; retryIdx--)
+                    {
+                        if (!strLstExists(walFileList, ((ArchivePushAsyncRetry *)lstGet(jobData.retryList, retryIdx - 1))->walFile))
+                            archivePushAsyncRetryRemove(jobData.retryList, retryIdx - 1);
+                    }
 
-                            archiveAsyncStatusErrorWrite(
-                                archiveModePush, walFile, protocolParallelJobErrorCode(job), protocolParallelJobErrorMessage(job));
-                        }
+                    // Skip WAL files that cannot be retried yet
+                    jobData.walFileList = strLstMergeAnti(walFileList, retryWaitList);
+
+                    if (!strLstEmpty(jobData.walFileList))
+                    {
+                        jobData.walFileIdx = 0;
+                        archivePushAsyncProcess(&jobData);
 
-                        protocolParallelJobFree(job);
+                        // Only pushed WAL files extend the grace period so the process exits when pushes keep failing
+                        if (jobData.pushTotal > 0)
+                            pushTime = timeMSec();
                     }
                 }
-                while (!protocolParallelDone(parallelExec));
+                MEM_CONTEXT_TEMP_END();
+
+                first = false;
             }
+            while (archivePushAsyncGrace(watch, grace, pushTime));
         }
         // On any global error write a single error file to cover all unprocessed files
         CATCH_ANY()
@@ -0,0 +1,166 @@
+/***********************************************************************************************************************************
+Backup Analyze Filter
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include "command/backup/analyze.h"
+#include "command/backup/pageChecksum.h"
+#include "common/crypto/hash.h"
+#include "common/debug.h"
+#include "common/io/filter/filter.intern.h"
+#include "common/io/filter/size.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/type/keyValue.h"
+#include "common/type/object.h"
+#include "postgres/interface.h"
+
+/***********************************************************************************************************************************
+Filter type constant
+***********************************************************************************************************************************/
+STRING_EXTERN(BACKUP_ANALYZE_FILTER_TYPE_STR,                       BACKUP_ANALYZE_FILTER_TYPE);
+
+/***********************************************************************************************************************************
+Size of the slices that input buffers are split into. This should be small enough to fit in the CPU cache and must be a multiple of
+the page size so the page checksum filter does not see misaligned pages.
+***********************************************************************************************************************************/
+#define BACKUP_ANALYZE_SLICE_SIZE                                   (PG_PAGE_SIZE_DEFAULT * 4)
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+typedef struct BackupAnalyze
+{
+    MemContext *memContext;                                         // Mem context of filter
+
+    IoFilter *hash;                                                 // SHA1 hash of the input
+    IoFilter *pageChecksum;                                         // Page checksums (NULL when not checked)
+    uint64_t size;                                                  // Total size of all input
+} BackupAnalyze;
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+String *
+backupAnalyzeToLog(const BackupAnalyze *this)
+{
+    return strNewFmt("{pageChecksum: %s, size: %" PRIu64 "}", cvtBoolToConstZ(this->pageChecksum != NULL), this->size);
+}
+
+#define FUNCTION_LOG_BACKUP_ANALYZE_TYPE                                                                                           \
+    BackupAnalyze *
+#define FUNCTION_LOG_BACKUP_ANALYZE_FORMAT(value, buffer, bufferSize)                                                              \
+    FUNCTION_LOG_STRING_OBJECT_FORMAT(value, backupAnalyzeToLog, buffer, bufferSize)
+
+/***********************************************************************************************************************************
+Analyze the input
+***********************************************************************************************************************************/
+static void
+backupAnalyzeProcess(THIS_VOID, const Buffer *const input)
+{
+    THIS(BackupAnalyze);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(BACKUP_ANALYZE, this);
+        FUNCTION_LOG_PARAM(BUFFER, input);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(input != NULL);
+
+    // Do all calculations on each slice while it is still in the CPU cache
+    for (size_t sliceOffset = 0; sliceOffset < bufUsed(input); sliceOffset += BACKUP_ANALYZE_SLICE_SIZE)
+    {
+        const size_t sliceSize =
+            bufUsed(input) - sliceOffset < BACKUP_ANALYZE_SLICE_SIZE ? bufUsed(input) - sliceOffset : BACKUP_ANALYZE_SLICE_SIZE;
+        const Buffer *const slice = BUF(bufPtrConst(input) + sliceOffset, sliceSize);
+
+        ioFilterProcessIn(this->hash, slice);
+
+        if (this->pageChecksum != NULL)
+            ioFilterProcessIn(this->pageChecksum, slice);
+    }
+
+    this->size += bufUsed(input);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Return filter result
+***********************************************************************************************************************************/
+static Variant *
+backupAnalyzeResult(THIS_VOID)
+{
+    THIS(BackupAnalyze);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(BACKUP_ANALYZE, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    KeyValue *const result = kvNew();
+
+    kvPut(result, VARSTR(CRYPTO_HASH_FILTER_TYPE_STR), ioFilterResult(this->hash));
+    kvPut(result, VARSTR(SIZE_FILTER_TYPE_STR), VARUINT64(this->size));
+
+    if (this->pageChecksum != NULL)
+        kvPut(result, VARSTR(PAGE_CHECKSUM_FILTER_TYPE_STR), ioFilterResult(this->pageChecksum));
+
+    FUNCTION_LOG_RETURN(VARIANT, varNewKv(result));
+}
+
+/**********************************************************************************************************************************/
+IoFilter *
+backupAnalyzeNew(
+    const bool pageChecksum, const unsigned int segmentNo, const unsigned int segmentPageTotal, const uint64_t lsnLimit)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(BOOL, pageChecksum);
+        FUNCTION_LOG_PARAM(UINT, segmentNo);
+        FUNCTION_LOG_PARAM(UINT, segmentPageTotal);
+        FUNCTION_LOG_PARAM(UINT64, lsnLimit);
+    FUNCTION_LOG_END();
+
+    IoFilter *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("BackupAnalyze")
+    {
+        BackupAnalyze *driver = memNew(sizeof(BackupAnalyze));
+
+        *driver = (BackupAnalyze)
+        {
+            .memContext = memContextCurrent(),
+            .hash = cryptoHashNew(HASH_TYPE_SHA1_STR),
+            .pageChecksum = pageChecksum ? pageChecksumNew(segmentNo, segmentPageTotal, lsnLimit) : NULL,
+        };
+
+        // Create param list. Page checksum params are only needed when page checksums are checked.
+        VariantList *paramList = NULL;
+
+        if (pageChecksum)
+        {
+            paramList = varLstNew();
+            varLstAdd(paramList, varNewUInt(segmentNo));
+            varLstAdd(paramList, varNewUInt(segmentPageTotal));
+            varLstAdd(paramList, varNewUInt64(lsnLimit));
+        }
+
+        this = ioFilterNewP(
+            BACKUP_ANALYZE_FILTER_TYPE_STR, driver, paramList, .in = backupAnalyzeProcess, .result = backupAnalyzeResult);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(IO_FILTER, this);
+}
+
+IoFilter *
+backupAnalyzeNewVar(const VariantList *const paramList)
+{
+    if (paramList == NULL)
+        return backupAnalyzeNew(false, 0, 0, 0);
+
+    return backupAnalyzeNew(
+        true, varUIntForce(varLstGet(paramList, 0)), varUIntForce(varLstGet(paramList, 1)), varUInt64(varLstGet(paramList, 2)));
+}
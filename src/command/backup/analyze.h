@@ -0,0 +1,29 @@
+/***********************************************************************************************************************************
+Backup Analyze Filter
+
+Calculate the SHA1 checksum and size of a PostgreSQL file and, optionally, check the page checksums in a single pass. Each buffer is
+processed in slices small enough to stay in the CPU cache while all the calculations are done, rather than each calculation making a
+separate pass over the entire buffer as happens when the crypto hash, size, and page checksum filters are added individually.
+
+The result is a KeyValue with the results of the individual calculations keyed on the filter type that would have produced them,
+i.e. CRYPTO_HASH_FILTER_TYPE_STR, SIZE_FILTER_TYPE_STR, and PAGE_CHECKSUM_FILTER_TYPE_STR.
+***********************************************************************************************************************************/
+#ifndef COMMAND_BACKUP_ANALYZE_H
+#define COMMAND_BACKUP_ANALYZE_H
+
+#include "common/io/filter/filter.h"
+
+/***********************************************************************************************************************************
+Filter type constant
+***********************************************************************************************************************************/
+#define BACKUP_ANALYZE_FILTER_TYPE                                  "backupAnalyze"
+    STRING_DECLARE(BACKUP_ANALYZE_FILTER_TYPE_STR);
+
+/***********************************************************************************************************************************
+Constructors
+***********************************************************************************************************************************/
+// Page checksums are only checked when pageChecksum is true. The remaining parameters are the same as pageChecksumNew().
+IoFilter *backupAnalyzeNew(bool pageChecksum, unsigned int segmentNo, unsigned int segmentPageTotal, uint64_t lsnLimit);
+IoFilter *backupAnalyzeNewVar(const VariantList *paramList);
+
+#endif
@@ -11,6 +11,7 @@ Backup Command
 #include "command/archive/common.h"
 #include "command/control/common.h"
 #include "command/backup/backup.h"
+#include "command/backup/blockMap.h"
 #include "command/backup/common.h"
 #include "command/backup/file.h"
 #include "command/backup/protocol.h"
@@ -573,6 +574,8 @@ void backupResumeCallback(void *data, const StorageInfo *info)
                 removeReason = "missing in manifest";
             else if (file->reference != NULL)
                 removeReason = "reference in manifest";
+            else if (file->blockIncrSize != 0)
+                removeReason = "block incremental";
             else if (fileResume == NULL)
                 removeReason = "missing in resumed manifest";
             else if (fileResume->reference != NULL)
@@ -590,7 +593,7 @@ void backupResumeCallback(void *data, const StorageInfo *info)
             {
                 manifestFileUpdate(
                     resumeData->manifest, manifestName, file->size, fileResume->sizeRepo, fileResume->checksumSha1, NULL,
-                    fileResume->checksumPage, fileResume->checksumPageError, fileResume->checksumPageErrorList);
+                    fileResume->checksumPage, fileResume->checksumPageError, fileResume->checksumPageErrorList, 0, 0);
             }
 
             // Remove the file if it could not be resumed
@@ -879,6 +882,272 @@ backupStart(BackupData *backupData)
     FUNCTION_LOG_RETURN_STRUCT(result);
 }
 
+/***********************************************************************************************************************************
+Scan pg paths in parallel before the manifest is built
+
+Each top-level path in the data directory, each database path in base, and each tablespace is listed recursively by a local process.
+The manifest build uses these lists rather than listing each path in turn, which is especially slow when pg is remote. Excluded
+top-level paths are not scanned. If a scan fails then the paths are listed again by the manifest build, which will report the error
+if there is one.
+***********************************************************************************************************************************/
+typedef struct BackupScanJobData
+{
+    const StringList *pathList;                                     // Paths to scan (relative to the data directory)
+    unsigned int pathIdx;                                           // Index of the next path to scan
+} BackupScanJobData;
+
+static ProtocolParallelJob *
+backupScanJobCallback(void *const data, const unsigned int clientIdx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, data);
+        FUNCTION_TEST_PARAM(UINT, clientIdx);
+    FUNCTION_TEST_END();
+
+    ASSERT(data != NULL);
+
+    // No special logic based on the client, we'll just get the next job
+    (void)clientIdx;
+
+    ProtocolParallelJob *result = NULL;
+    BackupScanJobData *const jobData = data;
+
+    if (jobData->pathIdx < strLstSize(jobData->pathList))
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            const String *const path = strLstGet(jobData->pathList, jobData->pathIdx);
+
+            ProtocolCommand *const command = protocolCommandNew(PROTOCOL_COMMAND_BACKUP_SCAN);
+            pckWriteStrP(protocolCommandParam(command), path);
+
+            result = protocolParallelJobMove(protocolParallelJobNew(VARSTR(path), command), memContextPrior());
+            jobData->pathIdx++;
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+// Add a path to the scan result
+static void
+backupScanPathAdd(List *const pathList, const String *const path)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(LIST, pathList);
+        FUNCTION_TEST_PARAM(STRING, path);
+    FUNCTION_TEST_END();
+
+    ASSERT(pathList != NULL);
+    ASSERT(path != NULL);
+
+    MEM_CONTEXT_BEGIN(lstMemContext(pathList))
+    {
+        lstAdd(
+            pathList,
+            &(ManifestBuildPath){.path = strDup(path), .infoList = lstNewP(sizeof(StorageInfo), .comparator = lstComparatorStr)});
+    }
+    MEM_CONTEXT_END();
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+// Add the results of a scan job. Subpaths are listed depth first so the path of each file/link/path is always on the stack.
+static void
+backupScanResult(List *const pathList, StringList *const ownerList, const String *const path, PackRead *const read)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(LIST, pathList);
+        FUNCTION_LOG_PARAM(STRING_LIST, ownerList);
+        FUNCTION_LOG_PARAM(STRING, path);
+        FUNCTION_LOG_PARAM(PACK_READ, read);
+    FUNCTION_LOG_END();
+
+    ASSERT(pathList != NULL);
+    ASSERT(ownerList != NULL);
+    ASSERT(path != NULL);
+    ASSERT(read != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Stack of paths being listed. Each path is stored by name relative to the scanned path and by index in the path list.
+        StringList *const stackName = strLstNew();
+        List *const stackIdx = lstNewP(sizeof(unsigned int));
+
+        strLstAdd(stackName, EMPTY_STR);
+        lstAdd(stackIdx, &(unsigned int){lstSize(pathList)});
+        backupScanPathAdd(pathList, path);
+
+        MEM_CONTEXT_TEMP_RESET_BEGIN()
+        {
+            while (!pckReadNullP(read))
+            {
+                const String *const name = pckReadStrP(read);
+                const String *const parent = strPath(name);
+
+                // Pop paths until the parent of this file/link/path is on top
+                while (!strEq(strLstGet(stackName, strLstSize(stackName) - 1), parent))
+                {
+                    strLstRemoveIdx(stackName, strLstSize(stackName) - 1);
+                    lstRemoveLast(stackIdx);
+                }
+
+                // Add info to the parent path
+                List *const infoList =
+                    ((ManifestBuildPath *)lstGet(pathList, *(unsigned int *)lstGet(stackIdx, lstSize(stackIdx) - 1)))->infoList;
+
+                StorageInfo info = {.exists = true, .level = storageInfoLevelDetail};
+                info.type = (StorageType)pckReadU32P(read);
+                info.timeModified = pckReadTimeP(read);
+                info.size = pckReadU64P(read);
+                info.mode = pckReadModeP(read);
+                info.user = strLstAddIfMissing(ownerList, pckReadStrP(read));
+                info.group = strLstAddIfMissing(ownerList, pckReadStrP(read));
+
+                MEM_CONTEXT_BEGIN(lstMemContext(pathList))
+                {
+                    info.name = strBase(name);
+                    info.linkDestination = pckReadStrP(read);
+
+                    lstAdd(infoList, &info);
+                }
+                MEM_CONTEXT_END();
+
+                // Push paths so their contents can be added
+                if (info.type == storageTypePath)
+                {
+                    strLstAdd(stackName, name);
+                    lstAdd(stackIdx, &(unsigned int){lstSize(pathList)});
+                    backupScanPathAdd(pathList, strNewFmt("%s/%s", strZ(path), strZ(name)));
+                }
+
+                // Reset the memory context occasionally
+                MEM_CONTEXT_TEMP_RESET(1000);
+            }
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+static List *
+backupScan(const BackupData *const backupData, const StringList *const excludeList)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(BACKUP_DATA, backupData);
+        FUNCTION_LOG_PARAM(STRING_LIST, excludeList);
+    FUNCTION_LOG_END();
+
+    ASSERT(backupData != NULL);
+
+    List *const result = lstNewP(sizeof(ManifestBuildPath), .comparator = lstComparatorStr);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const Storage *const storagePg = backupData->storagePrimary;
+        const String *const pgPath = storagePathP(storagePg, NULL);
+        StringList *const ownerList = strLstNew();
+        StringList *const pathList = strLstNew();
+
+        // Get the top-level paths to scan. The base path and pg_tblspc are listed here so the databases and tablespaces they
+        // contain can be scanned in parallel.
+        const StringList *const topList = strLstSort(storageListP(storagePg, pgPath, .errorOnMissing = true), sortOrderAsc);
+
+        for (unsigned int topIdx = 0; topIdx < strLstSize(topList); topIdx++)
+        {
+            const String *const name = strLstGet(topList, topIdx);
+
+            // Skip excluded paths since their contents will not be in the backup
+            if (excludeList != NULL &&
+                (strLstExists(excludeList, name) || strLstExists(excludeList, strNewFmt("%s/", strZ(name)))))
+                continue;
+
+            const StorageInfo info = storageInfoP(storagePg, strNewFmt("%s/%s", strZ(pgPath), strZ(name)), .ignoreMissing = true);
+
+            if (!info.exists)
+                continue;
+
+            if (info.type == storageTypePath && (strEqZ(name, PG_PATH_BASE) || strEqZ(name, PG_PATH_PGTBLSPC)))
+            {
+                // Scan databases and tablespaces, which are paths in base and links in pg_tblspc
+                const StorageType subType = strEqZ(name, PG_PATH_BASE) ? storageTypePath : storageTypeLink;
+                const StringList *const subList = strLstSort(
+                    storageListP(storagePg, strNewFmt("%s/%s", strZ(pgPath), strZ(name))), sortOrderAsc);
+
+                for (unsigned int subIdx = 0; subIdx < strLstSize(subList); subIdx++)
+                {
+                    const String *const subPath = strNewFmt("%s/%s", strZ(name), strZ(strLstGet(subList, subIdx)));
+
+                    if (storageInfoP(storagePg, strNewFmt("%s/%s", strZ(pgPath), strZ(subPath)), .ignoreMissing = true).type ==
+                            subType)
+                    {
+                        strLstAdd(pathList, subPath);
+                    }
+                }
+            }
+            else if (info.type == storageTypePath)
+                strLstAdd(pathList, name);
+        }
+
+        // Scan paths in parallel
+        BackupScanJobData jobData = {.pathList = pathList};
+
+        ProtocolParallel *const parallelExec = protocolParallelNew(
+            cfgOptionUInt64(cfgOptProtocolTimeout) / 2, cfgOptionUInt(cfgOptJobQueueMax), backupScanJobCallback, &jobData);
+
+        for (unsigned int processIdx = 1; processIdx <= cfgOptionUInt(cfgOptProcessMax); processIdx++)
+            protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypePg, backupData->pgIdxPrimary, processIdx));
+
+        MEM_CONTEXT_TEMP_RESET_BEGIN()
+        {
+            do
+            {
+                const unsigned int completed = protocolParallelProcess(parallelExec);
+
+                for (unsigned int jobIdx = 0; jobIdx < completed; jobIdx++)
+                {
+                    ProtocolParallelJob *const job = protocolParallelResult(parallelExec);
+
+                    // Errors are ignored since the path will be listed again by the manifest build
+                    if (protocolParallelJobErrorCode(job) == 0)
+                    {
+                        backupScanResult(
+                            result, ownerList, strNewFmt("%s/%s", strZ(pgPath), strZ(varStr(protocolParallelJobKey(job)))),
+                            protocolParallelJobResult(job));
+                    }
+                    else
+                    {
+                        LOG_DETAIL_PID_FMT(
+                            protocolParallelJobProcessId(job), "unable to scan '%s': %s", strZ(varStr(protocolParallelJobKey(job))),
+                            strZ(protocolParallelJobErrorMessage(job)));
+                    }
+
+                    protocolParallelJobFree(job);
+                }
+
+                // A keep-alive is required here for the remote holding open the backup connection
+                protocolKeepAlive();
+
+                // Reset the memory context occasionally so we don't use too much memory or slow down processing
+                MEM_CONTEXT_TEMP_RESET(1000);
+            }
+            while (!protocolParallelDone(parallelExec));
+        }
+        MEM_CONTEXT_TEMP_END();
+
+        // Owners are referenced by the scan results so they must be kept
+        strLstMove(ownerList, lstMemContext(result));
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    lstSort(result, sortOrderAsc);
+
+    FUNCTION_LOG_RETURN(LIST, result);
+}
+
 /***********************************************************************************************************************************
 Stop the backup
 ***********************************************************************************************************************************/
@@ -919,7 +1188,8 @@ backupFilePut(BackupData *backupData, Manifest *manifest, const String *name, ti
             if (compressType != compressTypeNone)
             {
                 ioFilterGroupAdd(
-                    ioWriteFilterGroup(storageWriteIo(write)), compressFilter(compressType, cfgOptionInt(cfgOptCompressLevel)));
+                    ioWriteFilterGroup(storageWriteIo(write)),
+                    compressFilterP(compressType, cfgOptionInt(cfgOptCompressLevel)));
             }
 
             // Add encryption filter if required
@@ -1018,13 +1288,13 @@ Log the results of a job and throw errors
 ***********************************************************************************************************************************/
 static uint64_t
 backupJobResult(
-    Manifest *manifest, const String *host, const String *const fileName, StringList *fileRemove, ProtocolParallelJob *const job,
-    const uint64_t sizeTotal, uint64_t sizeCopied)
+    Manifest *const manifest, const String *const host, const Storage *const storagePg, StringList *const fileRemove,
+    ProtocolParallelJob *const job, const uint64_t sizeTotal, uint64_t sizeCopied)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(MANIFEST, manifest);
         FUNCTION_LOG_PARAM(STRING, host);
-        FUNCTION_LOG_PARAM(STRING, fileName);
+        FUNCTION_LOG_PARAM(STORAGE, storagePg);
         FUNCTION_LOG_PARAM(STRING_LIST, fileRemove);
         FUNCTION_LOG_PARAM(PROTOCOL_PARALLEL_JOB, job);
         FUNCTION_LOG_PARAM(UINT64, sizeTotal);
@@ -1032,7 +1302,7 @@ backupJobResult(
     FUNCTION_LOG_END();
 
     ASSERT(manifest != NULL);
-    ASSERT(fileName != NULL);
+    ASSERT(storagePg != NULL);
     ASSERT(fileRemove != NULL);
     ASSERT(job != NULL);
 
@@ -1041,141 +1311,149 @@ backupJobResult(
     {
         MEM_CONTEXT_TEMP_BEGIN()
         {
-            const ManifestFile *const file = manifestFileFind(manifest, varStr(protocolParallelJobKey(job)));
             const unsigned int processId = protocolParallelJobProcessId(job);
-
+            const uint64_t bundleId = varType(protocolParallelJobKey(job)) == varTypeUInt64 ?
+                varUInt64(protocolParallelJobKey(job)) : 0;
             PackRead *const jobResult = protocolParallelJobResult(job);
-            const BackupCopyResult copyResult = (BackupCopyResult)pckReadU32P(jobResult);
-            const uint64_t copySize = pckReadU64P(jobResult);
-            const uint64_t repoSize = pckReadU64P(jobResult);
-            const String *const copyChecksum = pckReadStrP(jobResult);
-            const KeyValue *const checksumPageResult = varKv(jsonToVar(pckReadStrP(jobResult, .defaultValue = NULL_STR)));
-
-            // Increment backup copy progress
-            sizeCopied += copySize;
-
-            // Create log file name
-            const String *fileLog = host == NULL ? fileName : strNewFmt("%s:%s", strZ(host), strZ(fileName));
-
-            // Format log strings
-            const String *const logProgress =
-                strNewFmt(
-                    "%s, %" PRIu64 "%%", strZ(strSizeFormat(copySize)), sizeTotal == 0 ? 100 : sizeCopied * 100 / sizeTotal);
-            const String *const logChecksum = copySize != 0 ? strNewFmt(" checksum %s", strZ(copyChecksum)) : EMPTY_STR;
 
-            // If the file is in a prior backup and nothing changed, just log it
-            if (copyResult == backupCopyResultNoOp)
-            {
-                LOG_DETAIL_PID_FMT(
-                    processId, "match file from prior backup %s (%s)%s", strZ(fileLog), strZ(logProgress), strZ(logChecksum));
-            }
-            // Else if the repo matched the expect checksum, just log it
-            else if (copyResult == backupCopyResultChecksum)
-            {
-                LOG_DETAIL_PID_FMT(
-                    processId, "checksum resumed file %s (%s)%s", strZ(fileLog), strZ(logProgress), strZ(logChecksum));
-            }
-            // Else if the file was removed during backup add it to the list of files to be removed from the manifest when the
-            // backup is complete.  It can't be removed right now because that will invalidate the pointers that are being used for
-            // processing.
-            else if (copyResult == backupCopyResultSkip)
-            {
-                LOG_DETAIL_PID_FMT(processId, "skip file removed by database %s", strZ(fileLog));
-                strLstAdd(fileRemove, file->name);
-            }
-            // Else file was copied so update manifest
-            else
+            while (!pckReadNullP(jobResult))
             {
-                // If the file had to be recopied then warn that there may be an issue with corruption in the repository
-                // ??? This should really be below the message below for more context -- can be moved after the migration
-                // ??? The name should be a pg path not manifest name -- can be fixed after the migration
-                if (copyResult == backupCopyResultReCopy)
+                const ManifestFile *const file = manifestFileFind(manifest, pckReadStrP(jobResult));
+                const BackupCopyResult copyResult = (BackupCopyResult)pckReadU32P(jobResult);
+                const uint64_t copySize = pckReadU64P(jobResult);
+                const uint64_t bundleOffset = pckReadU64P(jobResult);
+                const uint64_t repoSize = pckReadU64P(jobResult);
+                const String *const copyChecksum = pckReadStrP(jobResult);
+                const KeyValue *const checksumPageResult = varKv(jsonToVar(pckReadStrP(jobResult, .defaultValue = NULL_STR)));
+
+                // Increment backup copy progress
+                sizeCopied += copySize;
+
+                // Create log file name
+                const String *const fileName = storagePathP(storagePg, manifestPathPg(file->name));
+                const String *fileLog = host == NULL ? fileName : strNewFmt("%s:%s", strZ(host), strZ(fileName));
+
+                // Format log strings
+                const String *const logProgress =
+                    strNewFmt(
+                        "%s, %" PRIu64 "%%", strZ(strSizeFormat(copySize)), sizeTotal == 0 ? 100 : sizeCopied * 100 / sizeTotal);
+                const String *const logChecksum = copySize != 0 ? strNewFmt(" checksum %s", strZ(copyChecksum)) : EMPTY_STR;
+
+                // If the file is in a prior backup and nothing changed, just log it
+                if (copyResult == backupCopyResultNoOp)
                 {
-                    LOG_WARN_FMT(
-                        "resumed backup file %s does not have expected checksum %s. The file will be recopied and backup will"
-                        " continue but this may be an issue unless the resumed backup path in the repository is known to be"
-                        " corrupted.\n"
-                        "NOTE: this does not indicate a problem with the PostgreSQL page checksums.",
-                        strZ(file->name), file->checksumSha1);
+                    LOG_DETAIL_PID_FMT(
+                        processId, "match file from prior backup %s (%s)%s", strZ(fileLog), strZ(logProgress), strZ(logChecksum));
+                }
+                // Else if the repo matched the expect checksum, just log it
+                else if (copyResult == backupCopyResultChecksum)
+                {
+                    LOG_DETAIL_PID_FMT(
+                        processId, "checksum resumed file %s (%s)%s", strZ(fileLog), strZ(logProgress), strZ(logChecksum));
+                }
+                // Else if the file was removed during backup add it to the list of files to be removed from the manifest when
+                // the backup is complete.  It can't be removed right now because that will invalidate the pointers that are being
+                // used for processing.
+                else if (copyResult == backupCopyResultSkip)
+                {
+                    LOG_DETAIL_PID_FMT(processId, "skip file removed by database %s", strZ(fileLog));
+                    strLstAdd(fileRemove, file->name);
                 }
+                // Else file was copied so update manifest
+                else
+                {
+                    // If the file had to be recopied then warn that there may be an issue with corruption in the repository
+                    // ??? This should really be below the message below for more context -- can be moved after the migration
+                    // ??? The name should be a pg path not manifest name -- can be fixed after the migration
+                    if (copyResult == backupCopyResultReCopy)
+                    {
+                        LOG_WARN_FMT(
+                            "resumed backup file %s does not have expected checksum %s. The file will be recopied and backup will"
+                            " continue but this may be an issue unless the resumed backup path in the repository is known to be"
+                            " corrupted.\n"
+                            "NOTE: this does not indicate a problem with the PostgreSQL page checksums.",
+                            strZ(file->name), file->checksumSha1);
+                    }
 
-                LOG_DETAIL_PID_FMT(processId, "backup file %s (%s)%s", strZ(fileLog), strZ(logProgress), strZ(logChecksum));
+                    LOG_DETAIL_PID_FMT(processId, "backup file %s (%s)%s", strZ(fileLog), strZ(logProgress), strZ(logChecksum));
 
-                // If the file had page checksums calculated during the copy
-                ASSERT((!file->checksumPage && checksumPageResult == NULL) || (file->checksumPage && checksumPageResult != NULL));
+                    // If the file had page checksums calculated during the copy
+                    ASSERT(
+                        (!file->checksumPage && checksumPageResult == NULL) || (file->checksumPage && checksumPageResult != NULL));
 
-                bool checksumPageError = false;
-                const VariantList *checksumPageErrorList = NULL;
+                    bool checksumPageError = false;
+                    const VariantList *checksumPageErrorList = NULL;
 
-                if (checksumPageResult != NULL)
-                {
-                    // If the checksum was valid
-                    if (!varBool(kvGet(checksumPageResult, VARSTRDEF("valid"))))
+                    if (checksumPageResult != NULL)
                     {
-                        checksumPageError = true;
-
-                        if (!varBool(kvGet(checksumPageResult, VARSTRDEF("align"))))
+                        // If the checksum was valid
+                        if (!varBool(kvGet(checksumPageResult, VARSTRDEF("valid"))))
                         {
-                            checksumPageErrorList = NULL;
-
-                            // ??? Update formatting after migration
-                            LOG_WARN_FMT(
-                                "page misalignment in file %s: file size %" PRIu64 " is not divisible by page size %u",
-                                strZ(fileLog), copySize, PG_PAGE_SIZE_DEFAULT);
-                        }
-                        else
-                        {
-                            // Format the page checksum errors
-                            checksumPageErrorList = varVarLst(kvGet(checksumPageResult, VARSTRDEF("error")));
-                            ASSERT(!varLstEmpty(checksumPageErrorList));
-
-                            String *error = strNew();
-                            unsigned int errorTotalMin = 0;
+                            checksumPageError = true;
 
-                            for (unsigned int errorIdx = 0; errorIdx < varLstSize(checksumPageErrorList); errorIdx++)
+                            if (!varBool(kvGet(checksumPageResult, VARSTRDEF("align"))))
                             {
-                                const Variant *const errorItem = varLstGet(checksumPageErrorList, errorIdx);
+                                checksumPageErrorList = NULL;
 
-                                // Add a comma if this is not the first item
-                                if (errorIdx != 0)
-                                    strCatZ(error, ", ");
+                                // ??? Update formatting after migration
+                                LOG_WARN_FMT(
+                                    "page misalignment in file %s: file size %" PRIu64 " is not divisible by page size %u",
+                                    strZ(fileLog), copySize, PG_PAGE_SIZE_DEFAULT);
+                            }
+                            else
+                            {
+                                // Format the page checksum errors
+                                checksumPageErrorList = varVarLst(kvGet(checksumPageResult, VARSTRDEF("error")));
+                                ASSERT(!varLstEmpty(checksumPageErrorList));
 
-                                // If an error range
-                                if (varType(errorItem) == varTypeVariantList)
-                                {
-                                    const VariantList *const errorItemList = varVarLst(errorItem);
-                                    ASSERT(varLstSize(errorItemList) == 2);
+                                String *error = strNew();
+                                unsigned int errorTotalMin = 0;
 
-                                    strCatFmt(
-                                        error, "%" PRIu64 "-%" PRIu64, varUInt64(varLstGet(errorItemList, 0)),
-                                        varUInt64(varLstGet(errorItemList, 1)));
-                                    errorTotalMin += 2;
-                                }
-                                // Else a single error
-                                else
+                                for (unsigned int errorIdx = 0; errorIdx < varLstSize(checksumPageErrorList); errorIdx++)
                                 {
-                                    ASSERT(varType(errorItem) == varTypeUInt64);
-
-                                    strCatFmt(error, "%" PRIu64, varUInt64(errorItem));
-                                    errorTotalMin++;
+                                    const Variant *const errorItem = varLstGet(checksumPageErrorList, errorIdx);
+
+                                    // Add a comma if this is not the first item
+                                    if (errorIdx != 0)
+                                        strCatZ(error, ", ");
+
+                                    // If an error range
+                                    if (varType(errorItem) == varTypeVariantList)
+                                    {
+                                        const VariantList *const errorItemList = varVarLst(errorItem);
+                                        ASSERT(varLstSize(errorItemList) == 2);
+
+                                        strCatFmt(
+                                            error, "%" PRIu64 "-%" PRIu64, varUInt64(varLstGet(errorItemList, 0)),
+                                            varUInt64(varLstGet(errorItemList, 1)));
+                                        errorTotalMin += 2;
+                                    }
+                                    // Else a single error
+                                    else
+                                    {
+                                        ASSERT(varType(errorItem) == varTypeUInt64);
+
+                                        strCatFmt(error, "%" PRIu64, varUInt64(errorItem));
+                                        errorTotalMin++;
+                                    }
                                 }
-                            }
 
-                            // Make message plural when appropriate
-                            const String *const plural = errorTotalMin > 1 ? STRDEF("s") : EMPTY_STR;
+                                // Make message plural when appropriate
+                                const String *const plural = errorTotalMin > 1 ? STRDEF("s") : EMPTY_STR;
 
-                            // ??? Update formatting after migration
-                            LOG_WARN_FMT(
-                                "invalid page checksum%s found in file %s at page%s %s", strZ(plural), strZ(fileLog), strZ(plural),
-                                strZ(error));
+                                // ??? Update formatting after migration
+                                LOG_WARN_FMT(
+                                    "invalid page checksum%s found in file %s at page%s %s", strZ(plural), strZ(fileLog),
+                                    strZ(plural), strZ(error));
+                            }
                         }
                     }
-                }
 
-                // Update file info and remove any reference to the file's existence in a prior backup
-                manifestFileUpdate(
-                    manifest, file->name, copySize, repoSize, strZ(copyChecksum), VARSTR(NULL), file->checksumPage,
-                    checksumPageError, checksumPageErrorList);
+                    // Update file info and remove any reference to the file's existence in a prior backup
+                    manifestFileUpdate(
+                        manifest, file->name, copySize, repoSize, strZ(copyChecksum), VARSTR(NULL), file->checksumPage,
+                        checksumPageError, checksumPageErrorList, bundleId, bundleOffset);
+                }
             }
         }
         MEM_CONTEXT_TEMP_END();
@@ -1224,6 +1502,41 @@ backupManifestSaveCopy(Manifest *const manifest, const String *cipherPassBackup)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Save the backup manifest in the binary format, which is faster to load than the ini format
+***********************************************************************************************************************************/
+static void
+backupManifestSavePack(Manifest *const manifest, const String *const cipherPassBackup)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(MANIFEST, manifest);
+        FUNCTION_TEST_PARAM(STRING, cipherPassBackup);
+    FUNCTION_LOG_END();
+
+    ASSERT(manifest != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Open file for write
+        IoWrite *write = storageWriteIo(
+            storageNewWriteP(
+                storageRepoWrite(),
+                strNewFmt(
+                    STORAGE_REPO_BACKUP "/%s/" BACKUP_MANIFEST_FILE BACKUP_MANIFEST_PACK_EXT,
+                    strZ(manifestData(manifest)->backupLabel))));
+
+        // Add encryption filter if required
+        cipherBlockFilterGroupAdd(
+            ioWriteFilterGroup(write), cfgOptionStrId(cfgOptRepoCipherType), cipherModeEncrypt, cipherPassBackup);
+
+        // Save file
+        manifestSavePack(manifest, write);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 Process the backup manifest
 ***********************************************************************************************************************************/
@@ -1392,6 +1705,10 @@ backupJobQueueNext(unsigned int clientIdx, int queueIdx, unsigned int queueTotal
     FUNCTION_TEST_RETURN(queueIdx);
 }
 
+// Minimum size counted toward the bundle size for each file. Every file in a bundle adds to the job command, the job result, and
+// the manifest, so without a minimum a bundle of empty or very small files would have no limit on the number of files.
+#define BACKUP_BUNDLE_FILE_SIZE_MIN                                 4096
+
 // Callback to fetch backup jobs for the parallel executor
 typedef struct BackupJobData
 {
@@ -1401,12 +1718,36 @@ typedef struct BackupJobData
     const String *const cipherSubPass;                              // Passphrase used to encrypt files in the backup
     const CompressType compressType;                                // Backup compression type
     const int compressLevel;                                        // Compress level if backup is compressed
+    const unsigned int compressThread;                              // Compress threads if backup is compressed
     const bool delta;                                               // Is this a checksum delta backup?
+    const bool cacheDrop;                                           // Drop pg files from the page cache after reading?
     const uint64_t lsnStart;                                        // Starting lsn for the backup
+    const bool bundle;                                              // Bundle files?
+    const uint64_t bundleSize;                                      // Target bundle size
+    const uint64_t bundleLimit;                                     // Limit on files to bundle
 
     List *queueList;                                                // List of processing queues
+    uint64_t bundleId;                                              // Bundle id
 } BackupJobData;
 
+// Can the file be stored in a bundle? Files that need to be checked (delta or resume), files stored in a prior backup, and block
+// incremental files are stored individually.
+static bool
+backupJobBundle(const BackupJobData *const jobData, const ManifestFile *const file)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, jobData);
+        FUNCTION_TEST_PARAM(MANIFEST_FILE, file);
+    FUNCTION_TEST_END();
+
+    ASSERT(jobData != NULL);
+    ASSERT(file != NULL);
+
+    FUNCTION_TEST_RETURN(
+        jobData->bundle && file->size <= jobData->bundleLimit && file->reference == NULL && file->checksumSha1[0] == '\0' &&
+        file->blockIncrSize == 0);
+}
+
 static ProtocolParallelJob *backupJobCallback(void *data, unsigned int clientIdx)
 {
     FUNCTION_TEST_BEGIN();
@@ -1436,33 +1777,80 @@ static ProtocolParallelJob *backupJobCallback(void *data, unsigned int clientIdx
 
             if (!lstEmpty(queue))
             {
-                const ManifestFile *file = *(ManifestFile **)lstGet(queue, 0);
+                const ManifestFile *const fileFirst = *(ManifestFile **)lstGet(queue, 0);
+                const bool bundle = backupJobBundle(jobData, fileFirst);
+                uint64_t bundleId = 0;
+
+                if (bundle)
+                {
+                    jobData->bundleId++;
+                    bundleId = jobData->bundleId;
+                }
 
                 // Create backup job
                 ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_BACKUP_FILE);
                 PackWrite *const param = protocolCommandParam(command);
 
-                pckWriteStrP(param, manifestPathPg(file->name));
-                pckWriteBoolP(param, !strEq(file->name, STRDEF(MANIFEST_TARGET_PGDATA "/" PG_PATH_GLOBAL "/" PG_FILE_PGCONTROL)));
-                pckWriteU64P(param, file->size);
-                pckWriteBoolP(param, !file->primary);
-                pckWriteStrP(param, file->checksumSha1[0] != 0 ? STR(file->checksumSha1) : NULL);
-                pckWriteBoolP(param, file->checksumPage);
-                pckWriteU64P(param, jobData->lsnStart);
-                pckWriteStrP(param, file->name);
-                pckWriteBoolP(param, file->reference != NULL);
+                pckWriteStrP(param, jobData->backupLabel);
+                pckWriteU64P(param, bundleId);
                 pckWriteU32P(param, jobData->compressType);
                 pckWriteI32P(param, jobData->compressLevel);
-                pckWriteStrP(param, jobData->backupLabel);
+                pckWriteU32P(param, jobData->compressThread);
                 pckWriteBoolP(param, jobData->delta);
+                pckWriteBoolP(param, jobData->cacheDrop);
                 pckWriteU64P(param, jobData->cipherSubPass == NULL ? cipherTypeNone : cipherTypeAes256Cbc);
                 pckWriteStrP(param, jobData->cipherSubPass);
 
-                // Remove job from the queue
-                lstRemoveIdx(queue, 0);
+                // Add files to the job. A bundle gets files until the bundle size is reached (but always at least one file). Files
+                // that cannot be bundled are skipped and left in the queue for a later job.
+                unsigned int fileIdx = 0;
+                uint64_t bundleSize = 0;
 
-                // Assign job to result
-                result = protocolParallelJobMove(protocolParallelJobNew(VARSTR(file->name), command), memContextPrior());
+                while (fileIdx < lstSize(queue))
+                {
+                    const ManifestFile *const file = *(ManifestFile **)lstGet(queue, fileIdx);
+                    const uint64_t fileSizeBundle =
+                        file->size < BACKUP_BUNDLE_FILE_SIZE_MIN ? BACKUP_BUNDLE_FILE_SIZE_MIN : file->size;
+
+                    if (bundle)
+                    {
+                        if (!backupJobBundle(jobData, file))
+                        {
+                            fileIdx++;
+                            continue;
+                        }
+
+                        if (bundleSize > 0 && bundleSize + fileSizeBundle > jobData->bundleSize)
+                            break;
+                    }
+
+                    pckWriteStrP(param, manifestPathPg(file->name));
+                    pckWriteBoolP(
+                        param, !strEq(file->name, STRDEF(MANIFEST_TARGET_PGDATA "/" PG_PATH_GLOBAL "/" PG_FILE_PGCONTROL)));
+                    pckWriteU64P(param, file->size);
+                    pckWriteBoolP(param, !file->primary);
+                    pckWriteStrP(param, file->checksumSha1[0] != 0 ? STR(file->checksumSha1) : NULL);
+                    pckWriteBoolP(param, file->deltaCopy);
+                    pckWriteBoolP(param, file->checksumPage);
+                    pckWriteU64P(param, jobData->lsnStart);
+                    pckWriteStrP(param, file->name);
+                    pckWriteBoolP(param, file->reference != NULL);
+                    pckWriteU64P(param, file->blockIncrSize);
+                    pckWriteStrP(param, file->blockIncrMapPrior);
+
+                    bundleSize += fileSizeBundle;
+
+                    // Remove file from the queue
+                    lstRemoveIdx(queue, fileIdx);
+
+                    // Only bundles can have more than one file
+                    if (!bundle)
+                        break;
+                }
+
+                // Assign job to result. Bundles are keyed on the bundle id so the results can be stored in the manifest.
+                result = protocolParallelJobMove(
+                    protocolParallelJobNew(bundle ? VARUINT64(bundleId) : VARSTR(fileFirst->name), command), memContextPrior());
 
                 // Break out of the loop early since we found a job
                 break;
@@ -1499,6 +1887,7 @@ backupProcess(BackupData *backupData, Manifest *manifest, const String *lsnStart
         const String *const backupPathExp = strNewFmt(STORAGE_REPO_BACKUP "/%s", strZ(backupLabel));
         bool hardLink = cfgOptionBool(cfgOptRepoHardlink) && storageFeature(storageRepoWrite(), storageFeatureHardLink);
         bool backupStandby = cfgOptionBool(cfgOptBackupStandby);
+        const bool bundle = cfgOptionBool(cfgOptRepoBundle);
 
         // If this is a full backup or hard-linked and paths are supported then create all paths explicitly so that empty paths will
         // exist in to repo.  Also create tablspace symlinks when symlinks are available,  This makes it possible for the user to
@@ -1546,17 +1935,22 @@ backupProcess(BackupData *backupData, Manifest *manifest, const String *lsnStart
             .backupStandby = backupStandby,
             .compressType = compressTypeEnum(cfgOptionStr(cfgOptCompressType)),
             .compressLevel = cfgOptionInt(cfgOptCompressLevel),
+            .compressThread = cfgOptionUInt(cfgOptCompressThread),
             .cipherType = cfgOptionStrId(cfgOptRepoCipherType),
             .cipherSubPass = manifestCipherSubPass(manifest),
             .delta = cfgOptionBool(cfgOptDelta),
+            .cacheDrop = cfgOptionBool(cfgOptBackupCacheDrop),
             .lsnStart = cfgOptionBool(cfgOptOnline) ? pgLsnFromStr(lsnStart) : 0xFFFFFFFFFFFFFFFF,
+            .bundle = bundle,
+            .bundleSize = bundle ? cfgOptionUInt64(cfgOptRepoBundleSize) : 0,
+            .bundleLimit = bundle ? cfgOptionUInt64(cfgOptRepoBundleLimit) : 0,
         };
 
         uint64_t sizeTotal = backupProcessQueue(manifest, &jobData.queueList);
 
         // Create the parallel executor
         ProtocolParallel *parallelExec = protocolParallelNew(
-            cfgOptionUInt64(cfgOptProtocolTimeout) / 2, backupJobCallback, &jobData);
+            cfgOptionUInt64(cfgOptProtocolTimeout) / 2, cfgOptionUInt(cfgOptJobQueueMax), backupJobCallback, &jobData);
 
         // First client is always on the primary
         protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypePg, backupData->pgIdxPrimary, 1));
@@ -1595,10 +1989,8 @@ backupProcess(BackupData *backupData, Manifest *manifest, const String *lsnStart
                     sizeCopied = backupJobResult(
                         manifest,
                         backupStandby && protocolParallelJobProcessId(job) > 1 ? backupData->hostStandby : backupData->hostPrimary,
-                        storagePathP(
-                            protocolParallelJobProcessId(job) > 1 ? storagePgIdx(pgIdx) : backupData->storagePrimary,
-                            manifestPathPg(manifestFileFind(manifest, varStr(protocolParallelJobKey(job)))->name)),
-                        fileRemove, job, sizeTotal, sizeCopied);
+                        protocolParallelJobProcessId(job) > 1 ? storagePgIdx(pgIdx) : backupData->storagePrimary, fileRemove, job,
+                        sizeTotal, sizeCopied);
                 }
 
                 // A keep-alive is required here for the remote holding open the backup connection
@@ -1640,8 +2032,9 @@ backupProcess(BackupData *backupData, Manifest *manifest, const String *lsnStart
             // if hardlinking is enabled the link will need to be created.
             if (file->reference != NULL)
             {
-                // If hardlinking is enabled then create a hardlink for files that have not changed since the last backup
-                if (hardLink)
+                // If hardlinking is enabled then create a hardlink for files that have not changed since the last backup. Files
+                // bundled in a prior backup cannot be linked.
+                if (hardLink && file->bundleId == 0)
                 {
                     LOG_DETAIL_FMT("hardlink %s to %s",  strZ(file->name), strZ(file->reference));
 
@@ -1758,12 +2151,30 @@ backupArchiveCheckCopy(Manifest *manifest, unsigned int walSegmentSize, const St
                         if (archiveCompressType != backupCompressType)
                         {
                             if (archiveCompressType != compressTypeNone)
-                                ioFilterGroupAdd(filterGroup, decompressFilter(archiveCompressType));
+                            {
+                                ArchiveDictLoadData *const dictLoadData = memNew(sizeof(ArchiveDictLoadData));
+
+                                *dictLoadData = (ArchiveDictLoadData)
+                                {
+                                    .storage = storageRepo(),
+                                    .archivePath = strNewFmt(STORAGE_REPO_ARCHIVE "/%s", strZ(archiveId)),
+                                    .cipherType = cfgOptionStrId(cfgOptRepoCipherType),
+                                    .cipherPass = infoArchiveCipherPass(infoArchive),
+                                };
+
+                                ioFilterGroupAdd(
+                                    filterGroup,
+                                    decompressFilterP(
+                                        archiveCompressType, .dictLoad = archiveDictLoad, .dictLoadData = dictLoadData));
+                            }
 
                             if (backupCompressType != compressTypeNone)
                             {
                                 ioFilterGroupAdd(
-                                    filterGroup, compressFilter(backupCompressType, cfgOptionInt(cfgOptCompressLevel)));
+                                    filterGroup,
+                                    compressFilterP(
+                                        backupCompressType, cfgOptionInt(cfgOptCompressLevel),
+                                        .threadTotal = cfgOptionUInt(cfgOptCompressThread)));
                             }
                         }
 
@@ -1845,6 +2256,10 @@ backupComplete(InfoBackup *const infoBackup, Manifest *const manifest)
             storageNewWriteP(
                 storageRepoWrite(), strNewFmt(STORAGE_REPO_BACKUP "/%s/" BACKUP_MANIFEST_FILE, strZ(backupLabel))));
 
+        // Save the binary manifest after the ini manifest so it is only present for complete backups. Commands that load the
+        // manifest fall back to the ini manifest if the binary manifest is missing.
+        backupManifestSavePack(manifest, infoPgCipherPass(infoBackupPg(infoBackup)));
+
         // Copy a compressed version of the manifest to history. If the repo is encrypted then the passphrase to open the manifest
         // is required.  We can't just do a straight copy since the destination needs to be compressed and that must happen before
         // encryption in order to be efficient. Compression will always be gz for compatibility and since it is always available.
@@ -1862,7 +2277,7 @@ backupComplete(InfoBackup *const infoBackup, Manifest *const manifest)
                     STORAGE_REPO_BACKUP "/" BACKUP_PATH_HISTORY "/%s/%s.manifest%s", strZ(strSubN(backupLabel, 0, 4)),
                     strZ(backupLabel), strZ(compressExtStr(compressTypeGz))));
 
-        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(manifestWrite)), compressFilter(compressTypeGz, 9));
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(manifestWrite)), compressFilterP(compressTypeGz, 9));
 
         cipherBlockFilterGroupAdd(
             ioWriteFilterGroup(storageWriteIo(manifestWrite)), cfgOptionStrId(cfgOptRepoCipherType), cipherModeEncrypt,
@@ -1932,15 +2347,48 @@ cmdBackup(void)
         // Start the backup
         BackupStartResult backupStartResult = backupStart(backupData);
 
+        // Scan the data directory in parallel when there is more than one process
+        const StringList *const excludeList = strLstNewVarLst(cfgOptionLst(cfgOptExclude));
+        List *const pathList = cfgOptionUInt(cfgOptProcessMax) > 1 ? backupScan(backupData, excludeList) : NULL;
+
         // Build the manifest
         Manifest *manifest = manifestNewBuild(
             backupData->storagePrimary, infoPg.version, infoPg.catalogVersion, cfgOptionBool(cfgOptOnline),
-            cfgOptionBool(cfgOptChecksumPage), strLstNewVarLst(cfgOptionLst(cfgOptExclude)), backupStartResult.tablespaceList);
+            cfgOptionBool(cfgOptChecksumPage), excludeList, backupStartResult.tablespaceList, pathList);
+
+        // The scan is no longer needed
+        lstFree(pathList);
 
         // Validate the manifest using the copy start time
         manifestBuildValidate(
             manifest, cfgOptionBool(cfgOptDelta), backupTime(backupData, true), compressTypeEnum(cfgOptionStr(cfgOptCompressType)));
 
+        // Enable block incremental when requested. Files stored in blocks are not complete in the backup path when blocks are
+        // stored in prior backups so hardlinks cannot be used to make each backup look like a full backup.
+        if (cfgOptionBool(cfgOptRepoBlock))
+        {
+            if (cfgOptionBool(cfgOptRepoHardlink))
+            {
+                LOG_WARN_FMT(
+                    "option '%s' is not valid with '%s', block incremental is disabled",
+                    cfgOptionIdxName(cfgOptRepoBlock, cfgOptionGroupIdxDefault(cfgOptGrpRepo)),
+                    cfgOptionIdxName(cfgOptRepoHardlink, cfgOptionGroupIdxDefault(cfgOptGrpRepo)));
+            }
+            else
+                manifestBuildBlockIncr(manifest, BLOCK_INCR_SIZE);
+        }
+
+        // Bundled files cannot be linked individually so bundling is disabled when hardlinks are enabled
+        if (cfgOptionBool(cfgOptRepoBundle) && cfgOptionBool(cfgOptRepoHardlink))
+        {
+            LOG_WARN_FMT(
+                "option '%s' is not valid with '%s', bundling is disabled",
+                cfgOptionIdxName(cfgOptRepoBundle, cfgOptionGroupIdxDefault(cfgOptGrpRepo)),
+                cfgOptionIdxName(cfgOptRepoHardlink, cfgOptionGroupIdxDefault(cfgOptGrpRepo)));
+
+            cfgOptionSet(cfgOptRepoBundle, cfgSourceParam, BOOL_FALSE_VAR);
+        }
+
         // Build an incremental backup if type is not full (manifestPrior will be freed in this call)
         if (!backupBuildIncr(infoBackup, manifest, manifestPrior, backupStartResult.walSegmentName))
             manifestCipherSubPassSet(manifest, cipherPassGen(cfgOptionStrId(cfgOptRepoCipherType)));
@@ -0,0 +1,228 @@
+/***********************************************************************************************************************************
+Block Incremental Map
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <string.h>
+
+#include "command/backup/blockMap.h"
+#include "common/crypto/cipherBlock.h"
+#include "common/debug.h"
+#include "common/io/filter/group.h"
+#include "common/log.h"
+#include "common/type/pack.h"
+#include "storage/helper.h"
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+struct BlockMap
+{
+    BlockMapPub pub;                                                // Publicly accessible variables
+};
+
+/**********************************************************************************************************************************/
+BlockMap *
+blockMapNew(void)
+{
+    FUNCTION_TEST_VOID();
+
+    BlockMap *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("BlockMap")
+    {
+        this = memNew(sizeof(BlockMap));
+
+        *this = (BlockMap)
+        {
+            .pub =
+            {
+                .memContext = MEM_CONTEXT_NEW(),
+                .itemList = lstNewP(sizeof(BlockMapItem)),
+                .referenceList = strLstNew(),
+            },
+        };
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_TEST_RETURN(this);
+}
+
+/**********************************************************************************************************************************/
+BlockMap *
+blockMapNewRead(IoRead *const map)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(IO_READ, map);
+    FUNCTION_LOG_END();
+
+    ASSERT(map != NULL);
+
+    BlockMap *this = blockMapNew();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        PackRead *const read = pckReadNew(map);
+
+        // Read references
+        const StringList *const referenceList = pckReadStrLstP(read);
+
+        for (unsigned int referenceIdx = 0; referenceIdx < strLstSize(referenceList); referenceIdx++)
+            strLstAdd(this->pub.referenceList, strLstGet(referenceList, referenceIdx));
+
+        // Read blocks
+        const unsigned int blockTotal = pckReadU32P(read);
+
+        pckReadArrayBeginP(read);
+
+        for (unsigned int blockIdx = 0; blockIdx < blockTotal; blockIdx++)
+        {
+            BlockMapItem item = {0};
+
+            pckReadObjBeginP(read);
+            item.reference = pckReadU32P(read);
+            item.slot = pckReadU64P(read);
+
+            const Buffer *const checksum = pckReadBinP(read);
+            CHECK(bufUsed(checksum) == HASH_TYPE_SHA1_SIZE);
+            memcpy(item.checksum, bufPtrConst(checksum), HASH_TYPE_SHA1_SIZE);
+
+            pckReadObjEndP(read);
+
+            CHECK(item.reference < strLstSize(this->pub.referenceList));
+            blockMapAdd(this, &item);
+        }
+
+        pckReadArrayEndP(read);
+        pckReadEndP(read);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(BLOCK_MAP, this);
+}
+
+/**********************************************************************************************************************************/
+unsigned int
+blockMapReferenceIdx(BlockMap *const this, const String *const reference)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BLOCK_MAP, this);
+        FUNCTION_TEST_PARAM(STRING, reference);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(reference != NULL);
+
+    unsigned int result = lstFindIdx((List *)this->pub.referenceList, &reference);
+
+    if (result == LIST_NOT_FOUND)
+    {
+        result = strLstSize(this->pub.referenceList);
+        strLstAdd(this->pub.referenceList, reference);
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+void
+blockMapWrite(const BlockMap *const this, IoWrite *const output)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(BLOCK_MAP, this);
+        FUNCTION_LOG_PARAM(IO_WRITE, output);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(output != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        PackWrite *const write = pckWriteNew(output);
+
+        // Write references
+        pckWriteStrLstP(write, this->pub.referenceList);
+
+        // Write blocks
+        pckWriteU32P(write, blockMapSize(this));
+        pckWriteArrayBeginP(write);
+
+        for (unsigned int blockIdx = 0; blockIdx < blockMapSize(this); blockIdx++)
+        {
+            const BlockMapItem *const item = blockMapGet(this, blockIdx);
+
+            pckWriteObjBeginP(write);
+            pckWriteU32P(write, item->reference);
+            pckWriteU64P(write, item->slot);
+            pckWriteBinP(write, BUF(item->checksum, HASH_TYPE_SHA1_SIZE));
+            pckWriteObjEndP(write);
+        }
+
+        pckWriteArrayEndP(write);
+        pckWriteEndP(write);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+String *
+blockMapPath(const String *const backupLabel, const String *const repoFile, const CompressType compressType)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, backupLabel);
+        FUNCTION_TEST_PARAM(STRING, repoFile);
+        FUNCTION_TEST_PARAM(ENUM, compressType);
+    FUNCTION_TEST_END();
+
+    ASSERT(backupLabel != NULL);
+    ASSERT(repoFile != NULL);
+
+    FUNCTION_TEST_RETURN(
+        strNewFmt(
+            STORAGE_REPO_BACKUP "/%s/%s" BLOCK_MAP_EXT "%s", strZ(backupLabel), strZ(repoFile),
+            strZ(compressExtStr(compressType))));
+}
+
+/**********************************************************************************************************************************/
+BlockMap *
+blockMapLoad(
+    const Storage *const storage, const String *const mapPath, const CompressType compressType, const String *const cipherPass)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE, storage);
+        FUNCTION_LOG_PARAM(STRING, mapPath);
+        FUNCTION_LOG_PARAM(ENUM, compressType);
+        FUNCTION_TEST_PARAM(STRING, cipherPass);
+    FUNCTION_LOG_END();
+
+    ASSERT(storage != NULL);
+    ASSERT(mapPath != NULL);
+
+    BlockMap *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        IoRead *const read = storageReadIo(storageNewReadP(storage, mapPath));
+
+        if (cipherPass != NULL)
+        {
+            ioFilterGroupAdd(
+                ioReadFilterGroup(read), cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTR(cipherPass), NULL));
+        }
+
+        if (compressType != compressTypeNone)
+            ioFilterGroupAdd(ioReadFilterGroup(read), decompressFilterP(compressType));
+
+        ioReadOpen(read);
+
+        result = blockMapNewRead(read);
+        blockMapMove(result, memContextPrior());
+
+        ioReadClose(read);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(BLOCK_MAP, result);
+}
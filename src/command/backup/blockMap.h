@@ -0,0 +1,142 @@
+/***********************************************************************************************************************************
+Block Incremental Map
+
+The block map describes how to reassemble a block incremental file from blocks stored in the current and prior backups. There is an
+entry for each block in the file that records the backup where the block is stored, the position (slot) of the block in that
+backup's repository file, and a checksum used to detect changed blocks in subsequent backups.
+
+Blocks are always stored in ascending order in the repository file so each referenced repository file can be read sequentially
+during restore, i.e. no seeks are required even for storage that does not support them.
+***********************************************************************************************************************************/
+#ifndef COMMAND_BACKUP_BLOCKMAP_H
+#define COMMAND_BACKUP_BLOCKMAP_H
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+typedef struct BlockMap BlockMap;
+
+#include "common/compress/helper.h"
+#include "common/crypto/hash.h"
+#include "common/io/read.h"
+#include "common/io/write.h"
+#include "common/type/list.h"
+#include "common/type/object.h"
+#include "common/type/stringList.h"
+#include "storage/storage.h"
+
+/***********************************************************************************************************************************
+Constants
+***********************************************************************************************************************************/
+// Size of blocks used for block incremental files. Files smaller than this size are always copied in full.
+#define BLOCK_INCR_SIZE                                             ((uint64_t)128 * 1024)
+
+// Extension of the map file that is stored next to the block incremental file in the repository
+#define BLOCK_MAP_EXT                                               ".blockmap"
+
+/***********************************************************************************************************************************
+Map item
+***********************************************************************************************************************************/
+typedef struct BlockMapItem
+{
+    unsigned int reference;                                         // Index of the backup (in the reference list) storing the block
+    uint64_t slot;                                                  // Position of the block in the referenced repository file
+    unsigned char checksum[HASH_TYPE_SHA1_SIZE];                    // Checksum of the block
+} BlockMapItem;
+
+/***********************************************************************************************************************************
+Constructors
+***********************************************************************************************************************************/
+BlockMap *blockMapNew(void);
+
+// New block map from IO
+BlockMap *blockMapNewRead(IoRead *map);
+
+/***********************************************************************************************************************************
+Getters/Setters
+***********************************************************************************************************************************/
+typedef struct BlockMapPub
+{
+    MemContext *memContext;                                         // Mem context
+    List *itemList;                                                 // List of block map items
+    StringList *referenceList;                                      // List of backups referenced by the map
+} BlockMapPub;
+
+// Get a block map item
+__attribute__((always_inline)) static inline const BlockMapItem *
+blockMapGet(const BlockMap *const this, const unsigned int mapIdx)
+{
+    return (const BlockMapItem *)lstGet(THIS_PUB(BlockMap)->itemList, mapIdx);
+}
+
+// Get the backup label for a reference index
+__attribute__((always_inline)) static inline const String *
+blockMapReference(const BlockMap *const this, const unsigned int referenceIdx)
+{
+    return strLstGet(THIS_PUB(BlockMap)->referenceList, referenceIdx);
+}
+
+// Number of backups referenced by the map
+__attribute__((always_inline)) static inline unsigned int
+blockMapReferenceTotal(const BlockMap *const this)
+{
+    return strLstSize(THIS_PUB(BlockMap)->referenceList);
+}
+
+// Number of blocks in the map
+__attribute__((always_inline)) static inline unsigned int
+blockMapSize(const BlockMap *const this)
+{
+    return lstSize(THIS_PUB(BlockMap)->itemList);
+}
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Add a block to the map
+__attribute__((always_inline)) static inline void
+blockMapAdd(BlockMap *const this, const BlockMapItem *const item)
+{
+    lstAdd(THIS_PUB(BlockMap)->itemList, item);
+}
+
+// Move to a new parent mem context
+__attribute__((always_inline)) static inline BlockMap *
+blockMapMove(BlockMap *const this, MemContext *const parentNew)
+{
+    return objMove(this, parentNew);
+}
+
+// Get the index of a reference, adding it to the reference list when missing
+unsigned int blockMapReferenceIdx(BlockMap *this, const String *reference);
+
+// Write the map to IO
+void blockMapWrite(const BlockMap *this, IoWrite *output);
+
+/***********************************************************************************************************************************
+Helper functions
+***********************************************************************************************************************************/
+// Repository path of the block map for a file in a backup
+String *blockMapPath(const String *backupLabel, const String *repoFile, CompressType compressType);
+
+// Load a block map from the repository. The map is decrypted with aes-256-cbc when a cipher pass is provided.
+BlockMap *blockMapLoad(const Storage *storage, const String *mapPath, CompressType compressType, const String *cipherPass);
+
+/***********************************************************************************************************************************
+Destructor
+***********************************************************************************************************************************/
+__attribute__((always_inline)) static inline void
+blockMapFree(BlockMap *const this)
+{
+    objFree(this);
+}
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_BLOCK_MAP_TYPE                                                                                                \
+    BlockMap *
+#define FUNCTION_LOG_BLOCK_MAP_FORMAT(value, buffer, bufferSize)                                                                   \
+    objToLog(value, "BlockMap", buffer, bufferSize)
+
+#endif
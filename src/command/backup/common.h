@@ -13,6 +13,7 @@ Common Functions and Definitions for Backup and Expire Commands
 /***********************************************************************************************************************************
 Backup constants
 ***********************************************************************************************************************************/
+#define BACKUP_PATH_BUNDLE                                          "bundle"
 #define BACKUP_PATH_HISTORY                                         "backup.history"
 
 /***********************************************************************************************************************************
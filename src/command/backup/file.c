@@ -5,6 +5,9 @@ Backup File
 
 #include <string.h>
 
+#include "command/backup/analyze.h"
+#include "command/backup/blockMap.h"
+#include "command/backup/common.h"
 #include "command/backup/file.h"
 #include "command/backup/pageChecksum.h"
 #include "common/crypto/cipherBlock.h"
@@ -33,247 +36,482 @@ segmentNumber(const String *pgFile)
     FUNCTION_TEST_RETURN(regExpMatchOne(STRDEF("\\.[0-9]+$"), pgFile) ? cvtZToUInt(strrchr(strZ(pgFile), '.') + 1) : 0);
 }
 
+/***********************************************************************************************************************************
+Copy a file block by block, storing only blocks that have changed since the prior block map. Returns the new block map.
+***********************************************************************************************************************************/
+static BlockMap *
+backupFileBlockIncr(
+    IoRead *const read, IoWrite *const write, const uint64_t blockIncrSize, const BlockMap *const blockMapPrior,
+    const String *const backupLabel)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(IO_READ, read);
+        FUNCTION_LOG_PARAM(IO_WRITE, write);
+        FUNCTION_LOG_PARAM(UINT64, blockIncrSize);
+        FUNCTION_LOG_PARAM(BLOCK_MAP, blockMapPrior);
+        FUNCTION_LOG_PARAM(STRING, backupLabel);
+    FUNCTION_LOG_END();
+
+    ASSERT(read != NULL);
+    ASSERT(write != NULL);
+    ASSERT(blockIncrSize > 0);
+    ASSERT(backupLabel != NULL);
+
+    BlockMap *const result = blockMapNew();
+    const unsigned int referenceCurrent = blockMapReferenceIdx(result, backupLabel);
+    Buffer *const block = bufNew((size_t)blockIncrSize);
+    unsigned int blockIdx = 0;
+    uint64_t slot = 0;
+
+    MEM_CONTEXT_TEMP_RESET_BEGIN()
+    {
+        do
+        {
+            // Read the next block. Only the last block in the file can be smaller than the block size.
+            bufUsedZero(block);
+            ioRead(read, block);
+
+            if (bufEmpty(block))
+                break;
+
+            // Use the block from the prior backup if the checksum has not changed
+            const Buffer *const checksum = cryptoHashOne(HASH_TYPE_SHA1_STR, block);
+            const BlockMapItem *const blockMapItemPrior =
+                blockMapPrior != NULL && blockIdx < blockMapSize(blockMapPrior) ? blockMapGet(blockMapPrior, blockIdx) : NULL;
+            BlockMapItem blockMapItem = {0};
+
+            memcpy(blockMapItem.checksum, bufPtrConst(checksum), HASH_TYPE_SHA1_SIZE);
+
+            if (blockMapItemPrior != NULL && memcmp(blockMapItemPrior->checksum, blockMapItem.checksum, HASH_TYPE_SHA1_SIZE) == 0)
+            {
+                blockMapItem.reference = blockMapReferenceIdx(
+                    result, blockMapReference(blockMapPrior, blockMapItemPrior->reference));
+                blockMapItem.slot = blockMapItemPrior->slot;
+            }
+            // Else store the block in the current backup
+            else
+            {
+                ioWrite(write, block);
+
+                blockMapItem.reference = referenceCurrent;
+                blockMapItem.slot = slot;
+                slot++;
+            }
+
+            blockMapAdd(result, &blockMapItem);
+            blockIdx++;
+
+            // Free the checksum periodically
+            MEM_CONTEXT_TEMP_RESET(1000);
+        }
+        while (!ioReadEof(read));
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    bufFree(block);
+
+    FUNCTION_LOG_RETURN(BLOCK_MAP, result);
+}
+
 /**********************************************************************************************************************************/
-BackupFileResult
+List *
 backupFile(
-    const String *pgFile, bool pgFileIgnoreMissing, uint64_t pgFileSize, bool pgFileCopyExactSize, const String *pgFileChecksum,
-    bool pgFileChecksumPage, uint64_t pgFileChecksumPageLsnLimit, const String *repoFile, bool repoFileHasReference,
-    CompressType repoFileCompressType, int repoFileCompressLevel, const String *backupLabel, bool delta, CipherType cipherType,
-    const String *cipherPass)
+    const String *const backupLabel, const uint64_t bundleId, const CompressType repoFileCompressType,
+    const int repoFileCompressLevel, const unsigned int repoFileCompressThread, const bool delta, const bool cacheDrop,
+    const CipherType cipherType, const String *const cipherPass, const List *const fileList)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
-        FUNCTION_LOG_PARAM(STRING, pgFile);                         // Database file to copy to the repo
-        FUNCTION_LOG_PARAM(BOOL, pgFileIgnoreMissing);              // Is it OK if the database file is missing?
-        FUNCTION_LOG_PARAM(UINT64, pgFileSize);                     // Size of the database file
-        FUNCTION_LOG_PARAM(BOOL, pgFileCopyExactSize);              // Copy only pgFileSize bytes even if the file has grown
-        FUNCTION_LOG_PARAM(STRING, pgFileChecksum);                 // Checksum to verify the database file
-        FUNCTION_LOG_PARAM(BOOL, pgFileChecksumPage);               // Should page checksums be validated
-        FUNCTION_LOG_PARAM(UINT64, pgFileChecksumPageLsnLimit);     // Upper LSN limit to which page checksums must be valid
-        FUNCTION_LOG_PARAM(STRING, repoFile);                       // Destination in the repo to copy the pg file
-        FUNCTION_LOG_PARAM(BOOL, repoFileHasReference);             // Does the repo file exist in a prior backup in the set?
-        FUNCTION_LOG_PARAM(ENUM, repoFileCompressType);             // Compress type for repo file
-        FUNCTION_LOG_PARAM(INT,  repoFileCompressLevel);            // Compression level for repo file
         FUNCTION_LOG_PARAM(STRING, backupLabel);                    // Label of current backup
+        FUNCTION_LOG_PARAM(UINT64, bundleId);                       // Bundle id (0 if not bundled)
+        FUNCTION_LOG_PARAM(ENUM, repoFileCompressType);             // Compress type for repo file
+        FUNCTION_LOG_PARAM(INT, repoFileCompressLevel);             // Compression level for repo file
+        FUNCTION_LOG_PARAM(UINT, repoFileCompressThread);           // Compression threads for repo file
         FUNCTION_LOG_PARAM(BOOL, delta);                            // Is the delta option on?
+        FUNCTION_LOG_PARAM(BOOL, cacheDrop);                        // Drop pg files from the page cache after reading?
         FUNCTION_LOG_PARAM(STRING_ID, cipherType);                  // Encryption type
         FUNCTION_TEST_PARAM(STRING, cipherPass);                    // Password to access the repo file if encrypted
+        FUNCTION_LOG_PARAM(LIST, fileList);                         // List of files to backup
     FUNCTION_LOG_END();
 
-    ASSERT(pgFile != NULL);
-    ASSERT(repoFile != NULL);
     ASSERT(backupLabel != NULL);
     ASSERT((cipherType == cipherTypeNone && cipherPass == NULL) || (cipherType != cipherTypeNone && cipherPass != NULL));
+    ASSERT(fileList != NULL && !lstEmpty(fileList));
 
     // Backup file results
-    BackupFileResult result = {.backupCopyResult = backupCopyResultCopy};
+    List *result = NULL;
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
-        // Generate complete repo path and add compression extension if needed
-        const String *repoPathFile = strNewFmt(
-            STORAGE_REPO_BACKUP "/%s/%s%s", strZ(backupLabel), strZ(repoFile), strZ(compressExtStr(repoFileCompressType)));
+        result = lstNewP(sizeof(BackupFileResult));
 
-        // If checksum is defined then the file needs to be checked. If delta option then check the DB and possibly the repo, else
-        // just check the repo.
-        if (pgFileChecksum != NULL)
+        // Is the file compressible during the copy?
+        const bool compressible = repoFileCompressType == compressTypeNone && cipherType == cipherTypeNone;
+
+        // Bundle write is opened when the first file is copied and is shared by all files in the bundle
+        StorageWrite *writeBundle = NULL;
+        uint64_t bundleOffset = 0;
+
+        for (unsigned int fileIdx = 0; fileIdx < lstSize(fileList); fileIdx++)
         {
-            // Does the file in pg match the checksum and size passed?
-            bool pgFileMatch = false;
+            const BackupFile *const file = lstGet(fileList, fileIdx);
+
+            ASSERT(file->pgFile != NULL);
+            ASSERT(file->manifestFile != NULL);
+            ASSERT(file->blockIncrSize != 0 || file->blockIncrMapPrior == NULL);
+            ASSERT(bundleId == 0 || (file->pgFileChecksum == NULL && !file->manifestFileHasReference && file->blockIncrSize == 0));
+
+            BackupFileResult *const fileResult = lstAdd(
+                result, &(BackupFileResult){.manifestFile = file->manifestFile, .backupCopyResult = backupCopyResultCopy});
 
-            // If delta, then check the DB checksum and possibly the repo. If the checksum does not match in either case then
-            // recopy.
-            if (delta)
+            MEM_CONTEXT_TEMP_BEGIN()
             {
-                // Generate checksum/size for the pg file. Only read as many bytes as passed in pgFileSize.  If the file has grown
-                // since the manifest was built we don't need to consider the extra bytes since they will be replayed from WAL
-                // during recovery.
-                IoRead *read = storageReadIo(
-                    storageNewReadP(
-                        storagePg(), pgFile, .ignoreMissing = pgFileIgnoreMissing,
-                        .limit = pgFileCopyExactSize ? VARUINT64(pgFileSize) : NULL));
-                ioFilterGroupAdd(ioReadFilterGroup(read), cryptoHashNew(HASH_TYPE_SHA1_STR));
-                ioFilterGroupAdd(ioReadFilterGroup(read), ioSizeNew());
-
-                // If the pg file exists check the checksum/size
-                if (ioReadDrain(read))
+                // Generate complete repo path and add compression extension if needed
+                const String *const repoPathFile = strNewFmt(
+                    STORAGE_REPO_BACKUP "/%s/%s%s", strZ(backupLabel), strZ(file->manifestFile),
+                    strZ(compressExtStr(repoFileCompressType)));
+
+                // If the file in the prior backup has probably changed then copy it while checking the checksum so it is only read
+                // once. The copy is removed below if the checksum matches. Bundled and block incremental files are always checked
+                // first since the copy cannot be easily removed from a bundle and block incremental also writes a block map.
+                const bool deltaCopy =
+                    delta && file->pgFileChecksum != NULL && file->manifestFileHasReference && file->pgFileDeltaCopy &&
+                    bundleId == 0 && file->blockIncrSize == 0;
+
+                // If checksum is defined then the file needs to be checked. If delta option then check the DB and possibly the
+                // repo, else just check the repo.
+                if (file->pgFileChecksum != NULL && !deltaCopy)
                 {
-                    const String *pgTestChecksum = varStr(
-                        ioFilterGroupResult(ioReadFilterGroup(read), CRYPTO_HASH_FILTER_TYPE_STR));
-                    uint64_t pgTestSize = varUInt64Force(ioFilterGroupResult(ioReadFilterGroup(read), SIZE_FILTER_TYPE_STR));
+                    // Does the file in pg match the checksum and size passed?
+                    bool pgFileMatch = false;
 
-                    // Does the pg file match?
-                    if (pgFileSize == pgTestSize && strEq(pgFileChecksum, pgTestChecksum))
+                    // If delta, then check the DB checksum and possibly the repo. If the checksum does not match in either case
+                    // then recopy.
+                    if (delta)
                     {
-                        pgFileMatch = true;
+                        // Generate checksum/size for the pg file. Only read as many bytes as passed in pgFileSize.  If the file has
+                        // grown since the manifest was built we don't need to consider the extra bytes since they will be replayed
+                        // from WAL during recovery.
+                        IoRead *read = storageReadIo(
+                            storageNewReadP(
+                                storagePg(), file->pgFile, .ignoreMissing = file->pgFileIgnoreMissing, .noCache = cacheDrop,
+                                .limit = file->pgFileCopyExactSize ? VARUINT64(file->pgFileSize) : NULL));
+                        ioFilterGroupAdd(ioReadFilterGroup(read), backupAnalyzeNew(false, 0, 0, 0));
 
-                        // If it matches and is a reference to a previous backup then no need to copy the file
-                        if (repoFileHasReference)
+                        // If the pg file exists check the checksum/size
+                        if (ioReadDrain(read))
                         {
-                            MEM_CONTEXT_PRIOR_BEGIN()
+                            const KeyValue *const analyze = varKv(
+                                ioFilterGroupResult(ioReadFilterGroup(read), BACKUP_ANALYZE_FILTER_TYPE_STR));
+                            const String *pgTestChecksum = varStr(kvGet(analyze, VARSTR(CRYPTO_HASH_FILTER_TYPE_STR)));
+                            uint64_t pgTestSize = varUInt64Force(kvGet(analyze, VARSTR(SIZE_FILTER_TYPE_STR)));
+
+                            // Does the pg file match?
+                            if (file->pgFileSize == pgTestSize && strEq(file->pgFileChecksum, pgTestChecksum))
                             {
-                                result.backupCopyResult = backupCopyResultNoOp;
-                                result.copySize = pgTestSize;
-                                result.copyChecksum = strDup(pgTestChecksum);
+                                pgFileMatch = true;
+
+                                // If it matches and is a reference to a previous backup then no need to copy the file
+                                if (file->manifestFileHasReference)
+                                {
+                                    MEM_CONTEXT_BEGIN(lstMemContext(result))
+                                    {
+                                        fileResult->backupCopyResult = backupCopyResultNoOp;
+                                        fileResult->copySize = pgTestSize;
+                                        fileResult->copyChecksum = strDup(pgTestChecksum);
+                                    }
+                                    MEM_CONTEXT_END();
+                                }
                             }
-                            MEM_CONTEXT_PRIOR_END();
                         }
+                        // Else the source file is missing from the database so skip this file
+                        else
+                            fileResult->backupCopyResult = backupCopyResultSkip;
                     }
-                }
-                // Else the source file is missing from the database so skip this file
-                else
-                    result.backupCopyResult = backupCopyResultSkip;
-            }
 
-            // If this is not a delta backup or it is and the file exists and the checksum from the DB matches, then also test the
-            // checksum of the file in the repo (unless it is in a prior backup) and if the checksum doesn't match, then there may
-            // be corruption in the repo, so recopy
-            if (!delta || !repoFileHasReference)
-            {
-                // If this is a delta backup and the file is missing from the DB, then remove it from the repo (backupManifestUpdate
-                // will remove it from the manifest)
-                if (result.backupCopyResult == backupCopyResultSkip)
-                {
-                    storageRemoveP(storageRepoWrite(), repoPathFile);
+                    // If this is not a delta backup or it is and the file exists and the checksum from the DB matches, then also
+                    // test the checksum of the file in the repo (unless it is in a prior backup) and if the checksum doesn't match,
+                    // then there may be corruption in the repo, so recopy
+                    if (!delta || !file->manifestFileHasReference)
+                    {
+                        // If this is a delta backup and the file is missing from the DB, then remove it from the repo
+                        // (backupManifestUpdate will remove it from the manifest)
+                        if (fileResult->backupCopyResult == backupCopyResultSkip)
+                        {
+                            storageRemoveP(storageRepoWrite(), repoPathFile);
+                        }
+                        else if (!delta || pgFileMatch)
+                        {
+                            // Check the repo file in a try block because on error (e.g. missing or corrupt file that can't be
+                            // decrypted or decompressed) we should recopy rather than ending the backup.
+                            TRY_BEGIN()
+                            {
+                                // Generate checksum/size for the repo file
+                                IoRead *read = storageReadIo(storageNewReadP(storageRepo(), repoPathFile));
+
+                                if (cipherType != cipherTypeNone)
+                                {
+                                    ioFilterGroupAdd(
+                                        ioReadFilterGroup(read),
+                                        cipherBlockNew(cipherModeDecrypt, cipherType, BUFSTR(cipherPass), NULL));
+                                }
+
+                                // Decompress the file if compressed
+                                if (repoFileCompressType != compressTypeNone)
+                                    ioFilterGroupAdd(ioReadFilterGroup(read), decompressFilterP(repoFileCompressType));
+
+                                ioFilterGroupAdd(ioReadFilterGroup(read), cryptoHashNew(HASH_TYPE_SHA1_STR));
+                                ioFilterGroupAdd(ioReadFilterGroup(read), ioSizeNew());
+
+                                ioReadDrain(read);
+
+                                // Test checksum/size
+                                const String *pgTestChecksum = varStr(
+                                    ioFilterGroupResult(ioReadFilterGroup(read), CRYPTO_HASH_FILTER_TYPE_STR));
+                                uint64_t pgTestSize = varUInt64Force(
+                                    ioFilterGroupResult(ioReadFilterGroup(read), SIZE_FILTER_TYPE_STR));
+
+                                // No need to recopy if checksum/size match
+                                if (file->pgFileSize == pgTestSize && strEq(file->pgFileChecksum, pgTestChecksum))
+                                {
+                                    MEM_CONTEXT_BEGIN(lstMemContext(result))
+                                    {
+                                        fileResult->backupCopyResult = backupCopyResultChecksum;
+                                        fileResult->copySize = pgTestSize;
+                                        fileResult->copyChecksum = strDup(pgTestChecksum);
+                                    }
+                                    MEM_CONTEXT_END();
+                                }
+                                // Else recopy when repo file is not as expected
+                                else
+                                    fileResult->backupCopyResult = backupCopyResultReCopy;
+                            }
+                            // Recopy on any kind of error
+                            CATCH_ANY()
+                            {
+                                fileResult->backupCopyResult = backupCopyResultReCopy;
+                            }
+                            TRY_END();
+                        }
+                    }
                 }
-                else if (!delta || pgFileMatch)
+
+                // Copy the file
+                if (fileResult->backupCopyResult == backupCopyResultCopy || fileResult->backupCopyResult == backupCopyResultReCopy)
                 {
-                    // Check the repo file in a try block because on error (e.g. missing or corrupt file that can't be decrypted or
-                    // decompressed) we should recopy rather than ending the backup.
-                    TRY_BEGIN()
+                    // Setup pg file for read. Only read as many bytes as passed in pgFileSize.  If the file is growing it does no
+                    // good to copy data past the end of the size recorded in the manifest since those blocks will need to be
+                    // replayed from WAL during recovery.
+                    StorageRead *read = storageNewReadP(
+                        storagePg(), file->pgFile, .ignoreMissing = file->pgFileIgnoreMissing, .compressible = compressible,
+                        .noCache = cacheDrop, .limit = file->pgFileCopyExactSize ? VARUINT64(file->pgFileSize) : NULL);
+
+                    // Calculate checksum and size, and check page checksums if requested, in a single pass
+                    ioFilterGroupAdd(
+                        ioReadFilterGroup(storageReadIo(read)),
+                        backupAnalyzeNew(
+                            file->pgFileChecksumPage, segmentNumber(file->pgFile), PG_SEGMENT_PAGE_DEFAULT,
+                            file->pgFileChecksumPageLsnLimit));
+
+                    // Setup the repo file for write. There is no need to write the file atomically (e.g. via a temp file on Posix)
+                    // because checksums are tested on resume after a failed backup. The path does not need to be synced for each
+                    // file because all paths are synced at the end of the backup. Bundled files are written to the bundle, which
+                    // is only created when the first file is copied since all the files in the bundle may be missing.
+                    StorageWrite *write = writeBundle;
+
+                    if (bundleId == 0)
                     {
-                        // Generate checksum/size for the repo file
-                        IoRead *read = storageReadIo(storageNewReadP(storageRepo(), repoPathFile));
+                        write = storageNewWriteP(
+                            storageRepoWrite(), repoPathFile, .compressible = compressible, .noAtomic = true, .noSyncPath = true);
+                    }
 
-                        if (cipherType != cipherTypeNone)
-                        {
-                            ioFilterGroupAdd(
-                                ioReadFilterGroup(read), cipherBlockNew(cipherModeDecrypt, cipherType, BUFSTR(cipherPass), NULL));
-                        }
+                    // Compress and encrypt during the read unless the file is block incremental. Block incremental only writes
+                    // changed blocks to the repo so the filters must be on the write. Bundled files are always compressed and
+                    // encrypted on the read so each file in the bundle is an independent stream.
+                    IoFilterGroup *const filterGroupRepo =
+                        file->blockIncrSize == 0 ?
+                            ioReadFilterGroup(storageReadIo(read)) : ioWriteFilterGroup(storageWriteIo(write));
 
-                        // Decompress the file if compressed
-                        if (repoFileCompressType != compressTypeNone)
-                            ioFilterGroupAdd(ioReadFilterGroup(read), decompressFilter(repoFileCompressType));
+                    // Add compression
+                    if (repoFileCompressType != compressTypeNone)
+                    {
+                        ioFilterGroupAdd(
+                            filterGroupRepo,
+                            compressFilterP(repoFileCompressType, repoFileCompressLevel, .threadTotal = repoFileCompressThread));
+                    }
 
-                        ioFilterGroupAdd(ioReadFilterGroup(read), cryptoHashNew(HASH_TYPE_SHA1_STR));
-                        ioFilterGroupAdd(ioReadFilterGroup(read), ioSizeNew());
+                    // If there is a cipher then add the encrypt filter
+                    if (cipherType != cipherTypeNone)
+                        ioFilterGroupAdd(filterGroupRepo, cipherBlockNew(cipherModeEncrypt, cipherType, BUFSTR(cipherPass), NULL));
 
-                        ioReadDrain(read);
+                    if (bundleId == 0)
+                        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(write)), ioSizeNew());
 
-                        // Test checksum/size
-                        const String *pgTestChecksum = varStr(
-                            ioFilterGroupResult(ioReadFilterGroup(read), CRYPTO_HASH_FILTER_TYPE_STR));
-                        uint64_t pgTestSize = varUInt64Force(ioFilterGroupResult(ioReadFilterGroup(read), SIZE_FILTER_TYPE_STR));
+                    // Open the source and destination and copy the file
+                    bool copied;
+
+                    // Copy the file into the bundle and count the bytes written since the size filter on the bundle write covers
+                    // all files in the bundle
+                    if (bundleId != 0)
+                    {
+                        copied = ioReadOpen(storageReadIo(read));
 
-                        // No need to recopy if checksum/size match
-                        if (pgFileSize == pgTestSize && strEq(pgFileChecksum, pgTestChecksum))
+                        if (copied)
                         {
-                            MEM_CONTEXT_PRIOR_BEGIN()
+                            // Open the bundle on the first copy
+                            if (writeBundle == NULL)
                             {
-                                result.backupCopyResult = backupCopyResultChecksum;
-                                result.copySize = pgTestSize;
-                                result.copyChecksum = strDup(pgTestChecksum);
+                                MEM_CONTEXT_PRIOR_BEGIN()
+                                {
+                                    writeBundle = storageNewWriteP(
+                                        storageRepoWrite(),
+                                        strNewFmt(
+                                            STORAGE_REPO_BACKUP "/%s/" BACKUP_PATH_BUNDLE "/%" PRIu64, strZ(backupLabel),
+                                            bundleId),
+                                        .compressible = compressible, .noAtomic = true, .noSyncPath = true);
+                                }
+                                MEM_CONTEXT_PRIOR_END();
+
+                                ioWriteOpen(storageWriteIo(writeBundle));
+                            }
+
+                            Buffer *const buffer = bufNew(ioBufferSize());
+
+                            do
+                            {
+                                ioRead(storageReadIo(read), buffer);
+                                ioWrite(storageWriteIo(writeBundle), buffer);
+                                fileResult->repoSize += bufUsed(buffer);
+                                bufUsedZero(buffer);
                             }
-                            MEM_CONTEXT_PRIOR_END();
+                            while (!ioReadEof(storageReadIo(read)));
+
+                            ioReadClose(storageReadIo(read));
+
+                            fileResult->bundleOffset = bundleOffset;
+                            bundleOffset += fileResult->repoSize;
                         }
-                        // Else recopy when repo file is not as expected
-                        else
-                            result.backupCopyResult = backupCopyResultReCopy;
                     }
-                    // Recopy on any kind of error
-                    CATCH_ANY()
+                    else if (file->blockIncrSize == 0)
+                        copied = storageCopy(read, write);
+                    // Else copy only changed blocks and write the block map
+                    else
                     {
-                        result.backupCopyResult = backupCopyResultReCopy;
-                    }
-                    TRY_END();
-                }
-            }
-        }
+                        copied = ioReadOpen(storageReadIo(read));
 
-        // Copy the file
-        if (result.backupCopyResult == backupCopyResultCopy || result.backupCopyResult == backupCopyResultReCopy)
-        {
-            // Is the file compressible during the copy?
-            bool compressible = repoFileCompressType == compressTypeNone && cipherType == cipherTypeNone;
-
-            // Setup pg file for read. Only read as many bytes as passed in pgFileSize.  If the file is growing it does no good to
-            // copy data past the end of the size recorded in the manifest since those blocks will need to be replayed from WAL
-            // during recovery.
-            StorageRead *read = storageNewReadP(
-                storagePg(), pgFile, .ignoreMissing = pgFileIgnoreMissing, .compressible = compressible,
-                .limit = pgFileCopyExactSize ? VARUINT64(pgFileSize) : NULL);
-            ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(read)), cryptoHashNew(HASH_TYPE_SHA1_STR));
-            ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(read)), ioSizeNew());
-
-            // Add page checksum filter
-            if (pgFileChecksumPage)
-            {
-                ioFilterGroupAdd(
-                    ioReadFilterGroup(storageReadIo(read)), pageChecksumNew(segmentNumber(pgFile), PG_SEGMENT_PAGE_DEFAULT,
-                    pgFileChecksumPageLsnLimit));
-            }
+                        if (copied)
+                        {
+                            // Load the prior block map
+                            BlockMap *blockMapPrior = NULL;
 
-            // Add compression
-            if (repoFileCompressType != compressTypeNone)
-            {
-                ioFilterGroupAdd(
-                    ioReadFilterGroup(storageReadIo(read)), compressFilter(repoFileCompressType, repoFileCompressLevel));
-            }
+                            if (file->blockIncrMapPrior != NULL)
+                            {
+                                blockMapPrior = blockMapLoad(
+                                    storageRepo(), blockMapPath(file->blockIncrMapPrior, file->manifestFile, repoFileCompressType),
+                                    repoFileCompressType, cipherPass);
+                            }
 
-            // If there is a cipher then add the encrypt filter
-            if (cipherType != cipherTypeNone)
-            {
-                ioFilterGroupAdd(
-                    ioReadFilterGroup(
-                        storageReadIo(read)), cipherBlockNew(cipherModeEncrypt, cipherType, BUFSTR(cipherPass), NULL));
-            }
+                            // Copy changed blocks
+                            ioWriteOpen(storageWriteIo(write));
 
-            // Setup the repo file for write. There is no need to write the file atomically (e.g. via a temp file on Posix) because
-            // checksums are tested on resume after a failed backup. The path does not need to be synced for each file because all
-            // paths are synced at the end of the backup.
-            StorageWrite *write = storageNewWriteP(
-                storageRepoWrite(), repoPathFile, .compressible = compressible, .noAtomic = true, .noSyncPath = true);
-            ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(write)), ioSizeNew());
+                            const BlockMap *const blockMap = backupFileBlockIncr(
+                                storageReadIo(read), storageWriteIo(write), file->blockIncrSize, blockMapPrior, backupLabel);
 
-            // Open the source and destination and copy the file
-            if (storageCopy(read, write))
-            {
-                MEM_CONTEXT_PRIOR_BEGIN()
-                {
-                    // Get sizes and checksum
-                    result.copySize = varUInt64Force(
-                        ioFilterGroupResult(ioReadFilterGroup(storageReadIo(read)), SIZE_FILTER_TYPE_STR));
-                    result.copyChecksum = strDup(
-                        varStr(ioFilterGroupResult(ioReadFilterGroup(storageReadIo(read)), CRYPTO_HASH_FILTER_TYPE_STR)));
-                    result.repoSize =
-                        varUInt64Force(ioFilterGroupResult(ioWriteFilterGroup(storageWriteIo(write)), SIZE_FILTER_TYPE_STR));
-
-                    // Get results of page checksum validation
-                    if (pgFileChecksumPage)
+                            ioReadClose(storageReadIo(read));
+                            ioWriteClose(storageWriteIo(write));
+
+                            // Write the block map
+                            StorageWrite *const writeMap = storageNewWriteP(
+                                storageRepoWrite(), blockMapPath(backupLabel, file->manifestFile, repoFileCompressType),
+                                .noAtomic = true, .noSyncPath = true);
+
+                            if (repoFileCompressType != compressTypeNone)
+                            {
+                                ioFilterGroupAdd(
+                                    ioWriteFilterGroup(storageWriteIo(writeMap)),
+                                    compressFilterP(repoFileCompressType, repoFileCompressLevel));
+                            }
+
+                            if (cipherType != cipherTypeNone)
+                            {
+                                ioFilterGroupAdd(
+                                    ioWriteFilterGroup(storageWriteIo(writeMap)),
+                                    cipherBlockNew(cipherModeEncrypt, cipherType, BUFSTR(cipherPass), NULL));
+                            }
+
+                            ioWriteOpen(storageWriteIo(writeMap));
+                            blockMapWrite(blockMap, storageWriteIo(writeMap));
+                            ioWriteClose(storageWriteIo(writeMap));
+                        }
+                    }
+
+                    if (copied)
                     {
-                        result.pageChecksumResult = kvDup(
-                            varKv(ioFilterGroupResult(ioReadFilterGroup(storageReadIo(read)), PAGE_CHECKSUM_FILTER_TYPE_STR)));
+                        const KeyValue *const analyze = varKv(
+                            ioFilterGroupResult(ioReadFilterGroup(storageReadIo(read)), BACKUP_ANALYZE_FILTER_TYPE_STR));
+
+                        MEM_CONTEXT_BEGIN(lstMemContext(result))
+                        {
+                            // Get sizes and checksum
+                            fileResult->copySize = varUInt64Force(kvGet(analyze, VARSTR(SIZE_FILTER_TYPE_STR)));
+                            fileResult->copyChecksum = strDup(varStr(kvGet(analyze, VARSTR(CRYPTO_HASH_FILTER_TYPE_STR))));
+
+                            if (bundleId == 0)
+                            {
+                                fileResult->repoSize = varUInt64Force(
+                                    ioFilterGroupResult(ioWriteFilterGroup(storageWriteIo(write)), SIZE_FILTER_TYPE_STR));
+                            }
+
+                            // Get results of page checksum validation
+                            if (file->pgFileChecksumPage)
+                            {
+                                fileResult->pageChecksumResult = kvDup(
+                                    varKv(kvGet(analyze, VARSTR(PAGE_CHECKSUM_FILTER_TYPE_STR))));
+                            }
+                        }
+                        MEM_CONTEXT_END();
+
+                        // If the file was copied while checking the checksum and matches a file in a prior backup then the copy is
+                        // not needed
+                        if (deltaCopy && file->pgFileSize == fileResult->copySize &&
+                            strEq(file->pgFileChecksum, fileResult->copyChecksum))
+                        {
+                            storageRemoveP(storageRepoWrite(), repoPathFile, .errorOnMissing = true);
+
+                            fileResult->backupCopyResult = backupCopyResultNoOp;
+                            fileResult->repoSize = 0;
+                            fileResult->pageChecksumResult = NULL;
+                        }
                     }
+                    // Else if source file is missing and the read setup indicated ignore a missing file, the database removed it
+                    // so skip it
+                    else
+                        fileResult->backupCopyResult = backupCopyResultSkip;
+                }
+
+                // If the file was copied get the repo size only if the storage can store the files with a different size than what
+                // was written. This has to be checked after the file is at rest because filesystem compression may affect the
+                // actual repo size and this cannot be calculated in stream. Bundled files are not checked since the size in the
+                // bundle is needed to read the file.
+                //
+                // If the file was checksummed then get the size in all cases since we don't already have it.
+                if (((fileResult->backupCopyResult == backupCopyResultCopy ||
+                      fileResult->backupCopyResult == backupCopyResultReCopy) &&
+                     bundleId == 0 && storageFeature(storageRepo(), storageFeatureCompress)) ||
+                    fileResult->backupCopyResult == backupCopyResultChecksum)
+                {
+                    fileResult->repoSize = storageInfoP(storageRepo(), repoPathFile).size;
                 }
-                MEM_CONTEXT_PRIOR_END();
             }
-            // Else if source file is missing and the read setup indicated ignore a missing file, the database removed it so skip it
-            else
-                result.backupCopyResult = backupCopyResultSkip;
+            MEM_CONTEXT_TEMP_END();
         }
 
-        // If the file was copied get the repo size only if the storage can store the files with a different size than what was
-        // written. This has to be checked after the file is at rest because filesystem compression may affect the actual repo size
-        // and this cannot be calculated in stream.
-        //
-        // If the file was checksummed then get the size in all cases since we don't already have it.
-        if (((result.backupCopyResult == backupCopyResultCopy || result.backupCopyResult == backupCopyResultReCopy) &&
-                storageFeature(storageRepo(), storageFeatureCompress)) ||
-            result.backupCopyResult == backupCopyResultChecksum)
-        {
-            result.repoSize = storageInfoP(storageRepo(), repoPathFile).size;
-        }
+        // Close the bundle
+        if (writeBundle != NULL)
+            ioWriteClose(storageWriteIo(writeBundle));
+
+        lstMove(result, memContextPrior());
     }
     MEM_CONTEXT_TEMP_END();
 
-    FUNCTION_LOG_RETURN_STRUCT(result);
+    FUNCTION_LOG_RETURN(LIST, result);
 }
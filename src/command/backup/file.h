@@ -7,6 +7,7 @@ Backup File
 #include "common/compress/helper.h"
 #include "common/crypto/common.h"
 #include "common/type/keyValue.h"
+#include "common/type/list.h"
 
 /***********************************************************************************************************************************
 Backup file types
@@ -23,20 +24,38 @@ typedef enum
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
-// Copy a file from the PostgreSQL data directory to the repository
+// Files to copy from the PostgreSQL data directory to the repository
+typedef struct BackupFile
+{
+    const String *pgFile;                                           // Pg file to backup
+    bool pgFileIgnoreMissing;                                       // Ignore missing pg file
+    uint64_t pgFileSize;                                            // Expected pg file size
+    bool pgFileCopyExactSize;                                       // Copy only pg expected size
+    const String *pgFileChecksum;                                   // Expected pg file checksum
+    bool pgFileDeltaCopy;                                           // Copy while checking the expected checksum on delta?
+    bool pgFileChecksumPage;                                        // Validate page checksums?
+    uint64_t pgFileChecksumPageLsnLimit;                            // Upper limit of pages to validate
+    const String *manifestFile;                                     // Repo file
+    bool manifestFileHasReference;                                  // Reference to prior backup, if any
+    uint64_t blockIncrSize;                                         // Block size for block incremental (0 if not block incr)
+    const String *blockIncrMapPrior;                                // Prior backup containing the block map (if any)
+} BackupFile;
+
 typedef struct BackupFileResult
 {
+    const String *manifestFile;                                     // Manifest file
     BackupCopyResult backupCopyResult;
     uint64_t copySize;
     String *copyChecksum;
+    uint64_t bundleOffset;                                          // Offset in bundle if any
     uint64_t repoSize;
     KeyValue *pageChecksumResult;
 } BackupFileResult;
 
-BackupFileResult backupFile(
-    const String *pgFile, bool pgFileIgnoreMissing, uint64_t pgFileSize, bool pgFileCopyExactSize, const String *pgFileChecksum,
-    bool pgFileChecksumPage, uint64_t pgFileChecksumPageLsnLimit, const String *repoFile, bool repoFileHasReference,
-    CompressType repoFileCompressType, int repoFileCompressLevel, const String *backupLabel, bool delta, CipherType cipherType,
-    const String *cipherPass);
+// Copy a list of files to the repository. When bundleId is not zero all files are stored in a single bundle file.
+List *backupFile(
+    const String *backupLabel, uint64_t bundleId, CompressType repoFileCompressType, int repoFileCompressLevel,
+    unsigned int repoFileCompressThread, bool delta, bool cacheDrop, CipherType cipherType, const String *cipherPass,
+    const List *fileList);
 
 #endif
@@ -18,6 +18,11 @@ Filter type constant
 ***********************************************************************************************************************************/
 STRING_EXTERN(PAGE_CHECKSUM_FILTER_TYPE_STR,                        PAGE_CHECKSUM_FILTER_TYPE);
 
+/***********************************************************************************************************************************
+Pages to checksum per call to pgPageChecksumMulti()
+***********************************************************************************************************************************/
+#define PAGE_CHECKSUM_BATCH                                         64
+
 /***********************************************************************************************************************************
 Object type
 ***********************************************************************************************************************************/
@@ -94,14 +99,26 @@ pageChecksumProcess(THIS_VOID, const Buffer *input)
     // Verify the checksums of complete pages in the buffer
     if (this->valid)
     {
+        // Only full pages can be checksummed so a partial page at the end is excluded
+        const unsigned int pageFullTotal = (unsigned int)(bufUsed(input) / PG_PAGE_SIZE_DEFAULT);
+        uint16_t pageChecksum[PAGE_CHECKSUM_BATCH];
+
         for (unsigned int pageIdx = 0; pageIdx < pageTotal; pageIdx++)
         {
-            // Get a non-const pointer which is required by pgPageChecksumTest() below. ??? This is not entirely kosher since we are
-            // being passed a const buffer and we should deinitely not be modifying the contents.  When pgPageChecksumTest() returns
-            // the data should be the same, but there's no question that some munging occurs.  Should we make a copy of the page
-            // before passing it into pgPageChecksumTest()?
+            // Get a non-const pointer which is required by pgPageChecksumMulti() below. ??? This is not entirely kosher since we
+            // are being passed a const buffer and we should deinitely not be modifying the contents.  When pgPageChecksumMulti()
+            // returns the data should be the same, but there's no question that some munging occurs.  Should we make a copy of the
+            // page before passing it into pgPageChecksumMulti()?
             unsigned char *pagePtr = UNCONSTIFY(unsigned char *, bufPtrConst(input)) + (pageIdx * PG_PAGE_SIZE_DEFAULT);
 
+            // Calculate checksums for the next batch of full pages
+            if (pageIdx % PAGE_CHECKSUM_BATCH == 0 && pageIdx < pageFullTotal)
+            {
+                pgPageChecksumMulti(
+                    pagePtr, pageFullTotal - pageIdx < PAGE_CHECKSUM_BATCH ? pageFullTotal - pageIdx : PAGE_CHECKSUM_BATCH,
+                    this->pageNoOffset + pageIdx, pageChecksum);
+            }
+
             // Get a pointer to the page header at the beginning of the page
             const PageHeaderData *pageHeader = (const PageHeaderData *)pagePtr;
 
@@ -116,7 +133,8 @@ pageChecksumProcess(THIS_VOID, const Buffer *input)
                 // LSN is after the backup started so checksum is not tested because pages may be torn
                 pageLsn >= this->lsnLimit ||
                 // Checksum is valid if a full page
-                ((this->align || pageIdx < pageTotal - 1) && pageHeader->pd_checksum == pgPageChecksum(pagePtr, blockNo))))
+                ((this->align || pageIdx < pageTotal - 1) &&
+                    pageHeader->pd_checksum == pageChecksum[pageIdx % PAGE_CHECKSUM_BATCH])))
             {
                 MEM_CONTEXT_BEGIN(this->memContext)
                 {
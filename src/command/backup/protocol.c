@@ -27,35 +27,118 @@ backupFileProtocol(PackRead *const param, ProtocolServer *const server)
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
-        // Backup file
-        const String *const pgFile = pckReadStrP(param);
-        const bool pgFileIgnoreMissing = pckReadBoolP(param);
-        const uint64_t pgFileSize = pckReadU64P(param);
-        const bool pgFileCopyExactSize = pckReadBoolP(param);
-        const String *const pgFileChecksum = pckReadStrP(param);
-        const bool pgFileChecksumPage = pckReadBoolP(param);
-        const uint64_t pgFileChecksumPageLsnLimit = pckReadU64P(param);
-        const String *const repoFile = pckReadStrP(param);
-        const bool repoFileHasReference = pckReadBoolP(param);
+        // Backup options that apply to all files
+        const String *const backupLabel = pckReadStrP(param);
+        const uint64_t bundleId = pckReadU64P(param);
         const CompressType repoFileCompressType = (CompressType)pckReadU32P(param);
         const int repoFileCompressLevel = pckReadI32P(param);
-        const String *const backupLabel = pckReadStrP(param);
+        const unsigned int repoFileCompressThread = pckReadU32P(param);
         const bool delta = pckReadBoolP(param);
+        const bool cacheDrop = pckReadBoolP(param);
         const CipherType cipherType = (CipherType)pckReadU64P(param);
         const String *const cipherPass = pckReadStrP(param);
 
-        const BackupFileResult result = backupFile(
-            pgFile, pgFileIgnoreMissing, pgFileSize, pgFileCopyExactSize, pgFileChecksum, pgFileChecksumPage,
-            pgFileChecksumPageLsnLimit, repoFile, repoFileHasReference, repoFileCompressType, repoFileCompressLevel,
-            backupLabel, delta, cipherType, cipherPass);
+        // Build the file list
+        List *const fileList = lstNewP(sizeof(BackupFile));
+
+        while (!pckReadNullP(param))
+        {
+            BackupFile file = {.pgFile = pckReadStrP(param)};
+            file.pgFileIgnoreMissing = pckReadBoolP(param);
+            file.pgFileSize = pckReadU64P(param);
+            file.pgFileCopyExactSize = pckReadBoolP(param);
+            file.pgFileChecksum = pckReadStrP(param);
+            file.pgFileDeltaCopy = pckReadBoolP(param);
+            file.pgFileChecksumPage = pckReadBoolP(param);
+            file.pgFileChecksumPageLsnLimit = pckReadU64P(param);
+            file.manifestFile = pckReadStrP(param);
+            file.manifestFileHasReference = pckReadBoolP(param);
+            file.blockIncrSize = pckReadU64P(param);
+            file.blockIncrMapPrior = pckReadStrP(param);
+
+            lstAdd(fileList, &file);
+        }
+
+        // Backup files
+        const List *const result = backupFile(
+            backupLabel, bundleId, repoFileCompressType, repoFileCompressLevel, repoFileCompressThread, delta, cacheDrop,
+            cipherType, cipherPass, fileList);
 
         // Return result
         PackWrite *const resultPack = protocolPackNew();
-        pckWriteU32P(resultPack, result.backupCopyResult);
-        pckWriteU64P(resultPack, result.copySize);
-        pckWriteU64P(resultPack, result.repoSize);
-        pckWriteStrP(resultPack, result.copyChecksum);
-        pckWriteStrP(resultPack, result.pageChecksumResult != NULL ? jsonFromKv(result.pageChecksumResult) : NULL);
+
+        for (unsigned int resultIdx = 0; resultIdx < lstSize(result); resultIdx++)
+        {
+            const BackupFileResult *const fileResult = lstGet(result, resultIdx);
+
+            pckWriteStrP(resultPack, fileResult->manifestFile);
+            pckWriteU32P(resultPack, fileResult->backupCopyResult);
+            pckWriteU64P(resultPack, fileResult->copySize);
+            pckWriteU64P(resultPack, fileResult->bundleOffset);
+            pckWriteU64P(resultPack, fileResult->repoSize);
+            pckWriteStrP(resultPack, fileResult->copyChecksum);
+            pckWriteStrP(
+                resultPack, fileResult->pageChecksumResult != NULL ? jsonFromKv(fileResult->pageChecksumResult) : NULL);
+        }
+
+        protocolServerDataPut(server, resultPack);
+        protocolServerDataEndPut(server);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+// Callback to write info for each file/link/path found by the scan
+static void
+backupScanProtocolCallback(void *const data, const StorageInfo *const info)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, data);
+        FUNCTION_TEST_PARAM(STORAGE_INFO, info);
+    FUNCTION_TEST_END();
+
+    ASSERT(data != NULL);
+    ASSERT(info != NULL);
+
+    // Skip the . path since info for the scanned path is not needed
+    if (!strEq(info->name, DOT_STR))
+    {
+        PackWrite *const write = data;
+
+        pckWriteStrP(write, info->name);
+        pckWriteU32P(write, info->type);
+        pckWriteTimeP(write, info->timeModified);
+        pckWriteU64P(write, info->size);
+        pckWriteModeP(write, info->mode);
+        pckWriteStrP(write, info->user);
+        pckWriteStrP(write, info->group);
+        pckWriteStrP(write, info->linkDestination);
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+void
+backupScanProtocol(PackRead *const param, ProtocolServer *const server)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(PACK_READ, param);
+        FUNCTION_LOG_PARAM(PROTOCOL_SERVER, server);
+    FUNCTION_LOG_END();
+
+    ASSERT(param != NULL);
+    ASSERT(server != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *const path = pckReadStrP(param);
+
+        // Recursively list the path. Subpaths are listed immediately after they are found so the list is depth first.
+        PackWrite *const resultPack = protocolPackNew();
+
+        storageInfoListP(storagePg(), path, backupScanProtocolCallback, resultPack, .recurse = true, .sortOrder = sortOrderAsc);
 
         protocolServerDataPut(server, resultPack);
         protocolServerDataEndPut(server);
@@ -12,13 +12,16 @@ Functions
 ***********************************************************************************************************************************/
 // Process protocol requests
 void backupFileProtocol(PackRead *param, ProtocolServer *server);
+void backupScanProtocol(PackRead *param, ProtocolServer *server);
 
 /***********************************************************************************************************************************
 Protocol commands for ProtocolServerHandler arrays passed to protocolServerProcess()
 ***********************************************************************************************************************************/
 #define PROTOCOL_COMMAND_BACKUP_FILE                                STRID5("bp-f", 0x36e020)
+#define PROTOCOL_COMMAND_BACKUP_SCAN                                STRID5("bp-s", 0x9ee020)
 
 #define PROTOCOL_SERVER_HANDLER_BACKUP_LIST                                                                                        \
-    {.command = PROTOCOL_COMMAND_BACKUP_FILE, .handler = backupFileProtocol},
+    {.command = PROTOCOL_COMMAND_BACKUP_FILE, .handler = backupFileProtocol},                                                     \
+    {.command = PROTOCOL_COMMAND_BACKUP_SCAN, .handler = backupScanProtocol},
 
 #endif
@@ -6,6 +6,7 @@ Expire Command
 #include "command/archive/common.h"
 #include "command/backup/common.h"
 #include "command/control/common.h"
+#include "command/expire/protocol.h"
 #include "common/time.h"
 #include "common/type/list.h"
 #include "common/debug.h"
@@ -15,6 +16,7 @@ Expire Command
 #include "info/infoBackup.h"
 #include "info/manifest.h"
 #include "protocol/helper.h"
+#include "protocol/parallel.h"
 #include "storage/helper.h"
 
 #include <stdlib.h>
@@ -35,6 +37,141 @@ typedef struct ArchiveRange
     const String *stop;
 } ArchiveRange;
 
+/***********************************************************************************************************************************
+Queue of paths and files to remove from the repo. Removals are queued while expiring and then performed all at once so they can be
+distributed to local processes when process-max > 1. This matters most for object stores where each removal is a round trip.
+***********************************************************************************************************************************/
+typedef struct ExpireRemove
+{
+    const String *path;                                             // Path or file to remove
+    bool recurse;                                                   // Remove a path and everything in it? Else remove a file.
+} ExpireRemove;
+
+typedef struct ExpireRemoveJobData
+{
+    const List *removeList;                                         // Paths and files to remove
+    unsigned int removeIdx;                                         // Index of the next path or file to remove
+    unsigned int repoIdx;                                           // Repo to remove from
+} ExpireRemoveJobData;
+
+static void
+expireRemoveAdd(List *const removeList, const String *const path, const bool recurse)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(LIST, removeList);
+        FUNCTION_TEST_PARAM(STRING, path);
+        FUNCTION_TEST_PARAM(BOOL, recurse);
+    FUNCTION_TEST_END();
+
+    ASSERT(removeList != NULL);
+    ASSERT(path != NULL);
+
+    MEM_CONTEXT_BEGIN(lstMemContext(removeList))
+    {
+        lstAdd(removeList, &(ExpireRemove){.path = strDup(path), .recurse = recurse});
+    }
+    MEM_CONTEXT_END();
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+static ProtocolParallelJob *
+expireRemoveJobCallback(void *const data, const unsigned int clientIdx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, data);
+        FUNCTION_TEST_PARAM(UINT, clientIdx);
+    FUNCTION_TEST_END();
+
+    ASSERT(data != NULL);
+
+    // No special logic based on the client, we'll just get the next job
+    (void)clientIdx;
+
+    ProtocolParallelJob *result = NULL;
+    ExpireRemoveJobData *const jobData = data;
+
+    if (jobData->removeIdx < lstSize(jobData->removeList))
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            const ExpireRemove *const remove = lstGet(jobData->removeList, jobData->removeIdx);
+
+            ProtocolCommand *const command = protocolCommandNew(PROTOCOL_COMMAND_EXPIRE_REMOVE);
+            PackWrite *const param = protocolCommandParam(command);
+
+            pckWriteU32P(param, jobData->repoIdx);
+            pckWriteStrP(param, remove->path);
+            pckWriteBoolP(param, remove->recurse);
+
+            result = protocolParallelJobMove(protocolParallelJobNew(VARSTR(remove->path), command), memContextPrior());
+            jobData->removeIdx++;
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+static void
+expireRemove(const List *const removeList, const unsigned int repoIdx)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(LIST, removeList);
+        FUNCTION_LOG_PARAM(UINT, repoIdx);
+    FUNCTION_LOG_END();
+
+    ASSERT(removeList != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Remove in this process when there is nothing to gain from starting local processes
+        if (cfgOptionUInt(cfgOptProcessMax) == 1 || lstSize(removeList) <= 1)
+        {
+            for (unsigned int removeIdx = 0; removeIdx < lstSize(removeList); removeIdx++)
+            {
+                const ExpireRemove *const remove = lstGet(removeList, removeIdx);
+
+                if (remove->recurse)
+                    storagePathRemoveP(storageRepoIdxWrite(repoIdx), remove->path, .recurse = true);
+                else
+                    storageRemoveP(storageRepoIdxWrite(repoIdx), remove->path);
+            }
+        }
+        // Else distribute removals to local processes
+        else
+        {
+            ExpireRemoveJobData jobData = {.removeList = removeList, .repoIdx = repoIdx};
+
+            ProtocolParallel *const parallelExec = protocolParallelNew(
+                cfgOptionUInt64(cfgOptProtocolTimeout) / 2, cfgOptionUInt(cfgOptJobQueueMax), expireRemoveJobCallback, &jobData);
+
+            for (unsigned int processIdx = 1; processIdx <= cfgOptionUInt(cfgOptProcessMax); processIdx++)
+                protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypeRepo, repoIdx, processIdx));
+
+            do
+            {
+                const unsigned int completed = protocolParallelProcess(parallelExec);
+
+                for (unsigned int jobIdx = 0; jobIdx < completed; jobIdx++)
+                {
+                    ProtocolParallelJob *const job = protocolParallelResult(parallelExec);
+
+                    // Stop on the first error since the repo is probably not in a state where more removals will succeed
+                    if (protocolParallelJobErrorCode(job) != 0)
+                        THROW_CODE(protocolParallelJobErrorCode(job), strZ(protocolParallelJobErrorMessage(job)));
+
+                    protocolParallelJobFree(job);
+                }
+            }
+            while (!protocolParallelDone(parallelExec));
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 Given a backup label, expire a backup and all its dependents (if any).
 ***********************************************************************************************************************************/
@@ -67,7 +204,11 @@ expireBackup(InfoBackup *infoBackup, const String *backupLabel, unsigned int rep
             // Execute the real expiration and deletion only if the dry-run option is disabled
             if (!cfgOptionValid(cfgOptDryRun) || !cfgOptionBool(cfgOptDryRun))
             {
-                // Remove the manifest files to invalidate the backup
+                // Remove the manifest files to invalidate the backup. The binary manifest is removed first so it is never present
+                // without the ini manifest.
+                storageRemoveP(
+                    storageRepoIdxWrite(repoIdx),
+                    strNewFmt(STORAGE_REPO_BACKUP "/%s/" BACKUP_MANIFEST_FILE BACKUP_MANIFEST_PACK_EXT, strZ(removeBackupLabel)));
                 storageRemoveP(
                     storageRepoIdxWrite(repoIdx),
                     strNewFmt(STORAGE_REPO_BACKUP "/%s/" BACKUP_MANIFEST_FILE, strZ(removeBackupLabel)));
@@ -379,6 +520,9 @@ removeExpiredArchive(InfoBackup *infoBackup, bool timeBasedFullRetention, unsign
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
+        // Paths and files are queued for removal and removed together at the end
+        List *const removeList = lstNewP(sizeof(ExpireRemove));
+
         // Get the retention options. repo-archive-retention-type always has a value as it defaults to "full"
         const BackupType archiveRetentionType = (BackupType)cfgOptionIdxStrId(cfgOptRepoRetentionArchiveType, repoIdx);
         unsigned int archiveRetention = cfgOptionIdxTest(
@@ -532,7 +676,7 @@ removeExpiredArchive(InfoBackup *infoBackup, bool timeBasedFullRetention, unsign
 
                                 // Execute the real expiration and deletion only if the dry-run option is disabled
                                 if (!cfgOptionValid(cfgOptDryRun) || !cfgOptionBool(cfgOptDryRun))
-                                    storagePathRemoveP(storageRepoIdxWrite(repoIdx), fullPath, .recurse = true);
+                                    expireRemoveAdd(removeList, fullPath, true);
                             }
 
                             // Continue to next directory
@@ -662,10 +806,9 @@ removeExpiredArchive(InfoBackup *infoBackup, bool timeBasedFullRetention, unsign
                                     // Execute the real expiration and deletion only if the dry-run mode is disabled
                                     if (!cfgOptionValid(cfgOptDryRun) || !cfgOptionBool(cfgOptDryRun))
                                     {
-                                        storagePathRemoveP(
-                                            storageRepoIdxWrite(repoIdx),
-                                            strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(archiveId), strZ(walPath)),
-                                            .recurse = true);
+                                        expireRemoveAdd(
+                                            removeList, strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(archiveId), strZ(walPath)),
+                                            true);
                                     }
 
                                     archiveExpire.total++;
@@ -711,11 +854,12 @@ removeExpiredArchive(InfoBackup *infoBackup, bool timeBasedFullRetention, unsign
                                             // Execute the real expiration and deletion only if the dry-run mode is disabled
                                             if (!cfgOptionValid(cfgOptDryRun) || !cfgOptionBool(cfgOptDryRun))
                                             {
-                                                storageRemoveP(
-                                                    storageRepoIdxWrite(repoIdx),
+                                                expireRemoveAdd(
+                                                    removeList,
                                                     strNewFmt(
                                                         STORAGE_REPO_ARCHIVE "/%s/%s/%s", strZ(archiveId), strZ(walPath),
-                                                        strZ(walSubPath)));
+                                                        strZ(walSubPath)),
+                                                    false);
                                             }
 
                                             // Track that this archive was removed
@@ -762,9 +906,9 @@ removeExpiredArchive(InfoBackup *infoBackup, bool timeBasedFullRetention, unsign
                                     // Execute the real expiration and deletion only if the dry-run mode is disabled
                                     if (!cfgOptionValid(cfgOptDryRun) || !cfgOptionBool(cfgOptDryRun))
                                     {
-                                        storageRemoveP(
-                                            storageRepoIdxWrite(repoIdx),
-                                            strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(archiveId), strZ(historyFile)));
+                                        expireRemoveAdd(
+                                            removeList,
+                                            strNewFmt(STORAGE_REPO_ARCHIVE "/%s/%s", strZ(archiveId), strZ(historyFile)), false);
                                     }
 
                                     LOG_INFO_FMT(
@@ -778,6 +922,8 @@ removeExpiredArchive(InfoBackup *infoBackup, bool timeBasedFullRetention, unsign
                 }
             }
         }
+
+        expireRemove(removeList, repoIdx);
     }
     MEM_CONTEXT_TEMP_END();
 
@@ -842,6 +988,8 @@ removeExpiredBackup(InfoBackup *infoBackup, const String *adhocBackupLabel, unsi
     }
 
     // Remove non-current backups from disk
+    List *const removeList = lstNewP(sizeof(ExpireRemove));
+
     for (; backupIdx < strLstSize(backupList); backupIdx++)
     {
         if (!strLstExists(currentBackupList, strLstGet(backupList, backupIdx)))
@@ -852,14 +1000,12 @@ removeExpiredBackup(InfoBackup *infoBackup, const String *adhocBackupLabel, unsi
 
             // Execute the real expiration and deletion only if the dry-run mode is disabled
             if (!cfgOptionValid(cfgOptDryRun) || !cfgOptionBool(cfgOptDryRun))
-            {
-                storagePathRemoveP(
-                    storageRepoIdxWrite(repoIdx), strNewFmt(STORAGE_REPO_BACKUP "/%s", strZ(strLstGet(backupList, backupIdx))),
-                    .recurse = true);
-            }
+                expireRemoveAdd(removeList, strNewFmt(STORAGE_REPO_BACKUP "/%s", strZ(strLstGet(backupList, backupIdx))), true);
         }
     }
 
+    expireRemove(removeList, repoIdx);
+
     FUNCTION_LOG_RETURN_VOID();
 }
 
@@ -0,0 +1,41 @@
+/***********************************************************************************************************************************
+Expire Protocol Handler
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include "command/expire/protocol.h"
+#include "common/debug.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "storage/helper.h"
+
+/**********************************************************************************************************************************/
+void
+expireRemoveProtocol(PackRead *const param, ProtocolServer *const server)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(PACK_READ, param);
+        FUNCTION_LOG_PARAM(PROTOCOL_SERVER, server);
+    FUNCTION_LOG_END();
+
+    ASSERT(param != NULL);
+    ASSERT(server != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const unsigned int repoIdx = pckReadU32P(param);
+        const String *const path = pckReadStrP(param);
+        const bool recurse = pckReadBoolP(param);
+
+        // Remove the path and everything in it or a single file
+        if (recurse)
+            storagePathRemoveP(storageRepoIdxWrite(repoIdx), path, .recurse = true);
+        else
+            storageRemoveP(storageRepoIdxWrite(repoIdx), path);
+
+        protocolServerDataEndPut(server);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
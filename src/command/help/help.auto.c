@@ -182,7 +182,7 @@ static const unsigned char helpDataPack[] =
         0x79, 0x25, // Summary
             0x45, 0x78, 0x70, 0x69, 0x72, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
             0x65, 0x78, 0x63, 0x65, 0x65, 0x64, 0x20, 0x72, 0x65, 0x74, 0x65, 0x6E, 0x74, 0x69, 0x6F, 0x6E, 0x2E,
-        0x78, 0xBD, 0x0A, // Description
+        0x78, 0xDC, 0x0B, // Description
             0x70, 0x67, 0x42, 0x61, 0x63, 0x6B, 0x52, 0x65, 0x73, 0x74, 0x20, 0x64, 0x6F, 0x65, 0x73, 0x20, 0x66, 0x75, 0x6C, 0x6C,
             0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x72, 0x6F, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x62, 0x61, 0x73,
             0x65, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x74, 0x65, 0x6E, 0x74, 0x69, 0x6F, 0x6E, 0x20,
@@ -250,7 +250,15 @@ static const unsigned char helpDataPack[] =
             0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x70,
             0x65, 0x72, 0x66, 0x6F, 0x72, 0x6D, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x79, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x74, 0x68,
             0x65, 0x20, 0x65, 0x78, 0x70, 0x69, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x73, 0x20,
-            0x72, 0x75, 0x6E, 0x2E,
+            0x72, 0x75, 0x6E, 0x2E, 0x0A, 0x0A,
+            0x57, 0x68, 0x65, 0x6E, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x2D, 0x6D, 0x61, 0x78, 0x20, 0x69, 0x73, 0x20,
+            0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x6F, 0x6E, 0x65, 0x2C, 0x20, 0x65, 0x78,
+            0x70, 0x69, 0x72, 0x65, 0x64, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x57, 0x41,
+            0x4C, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x72,
+            0x61, 0x6C, 0x6C, 0x65, 0x6C, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x67, 0x72, 0x65,
+            0x61, 0x74, 0x6C, 0x79, 0x20, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x69, 0x6D, 0x65,
+            0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x65, 0x78, 0x70, 0x69, 0x72, 0x65, 0x20,
+            0x6F, 0x6E, 0x20, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x73, 0x2E,
 
         // help command
         // -------------------------------------------------------------------------------------------------------------------------
@@ -650,6 +658,39 @@ static const unsigned char helpDataPack[] =
             0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x64, 0x65, 0x74, 0x61,
             0x69, 0x6C, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x65, 0x78, 0x61, 0x6D, 0x70, 0x6C, 0x65, 0x73, 0x2E,
 
+        // server command
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x79, 0x12, // Summary
+            0x70, 0x67, 0x42, 0x61, 0x63, 0x6B, 0x52, 0x65, 0x73, 0x74, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x2E,
+        0x78, 0x87, 0x04, // Description
+            0x54, 0x68, 0x65, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x73, 0x20, 0x70, 0x67,
+            0x42, 0x61, 0x63, 0x6B, 0x52, 0x65, 0x73, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x73, 0x20, 0x74, 0x6F,
+            0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x74, 0x65,
+            0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x54, 0x4C, 0x53, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x65,
+            0x61, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x53, 0x53, 0x48, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65,
+            0x72, 0x20, 0x72, 0x75, 0x6E, 0x73, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x69, 0x6E, 0x75, 0x6F, 0x75, 0x73, 0x6C, 0x79, 0x20,
+            0x61, 0x6E, 0x64, 0x20, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x73, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69,
+            0x6F, 0x6E, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x74, 0x68, 0x61,
+            0x74, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74, 0x20, 0x61, 0x20, 0x63, 0x65, 0x72, 0x74, 0x69, 0x66, 0x69, 0x63,
+            0x61, 0x74, 0x65, 0x20, 0x74, 0x72, 0x75, 0x73, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x6C, 0x73, 0x2D, 0x73,
+            0x65, 0x72, 0x76, 0x65, 0x72, 0x2D, 0x63, 0x61, 0x2D, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x75,
+            0x74, 0x68, 0x6F, 0x72, 0x69, 0x7A, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x6C, 0x73, 0x2D, 0x73, 0x65, 0x72, 0x76,
+            0x65, 0x72, 0x2D, 0x61, 0x75, 0x74, 0x68, 0x2E, 0x20, 0x41, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65,
+            0x73, 0x73, 0x20, 0x69, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x6B, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x61, 0x63,
+            0x68, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x63, 0x6F, 0x73, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x67,
+            0x42, 0x61, 0x63, 0x6B, 0x52, 0x65, 0x73, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67,
+            0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69,
+            0x73, 0x20, 0x70, 0x61, 0x69, 0x64, 0x20, 0x6F, 0x6E, 0x63, 0x65, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73, 0x20, 0x72, 0x61, 0x74, 0x68, 0x65,
+            0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x72, 0x65, 0x6D,
+            0x6F, 0x74, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E, 0x0A, 0x0A,
+            0x43, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72,
+            0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x75, 0x73, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72,
+            0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x68, 0x6F, 0x73, 0x74, 0x2D, 0x74, 0x79, 0x70, 0x65,
+            0x3D, 0x74, 0x6C, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x70, 0x67, 0x2D, 0x68, 0x6F, 0x73, 0x74, 0x2D, 0x74, 0x79, 0x70, 0x65,
+            0x3D, 0x74, 0x6C, 0x73, 0x2E,
+
         // stanza-create command
         // -------------------------------------------------------------------------------------------------------------------------
         0x79, 0x20, // Summary
@@ -922,7 +963,7 @@ static const unsigned char helpDataPack[] =
             0x4D, 0x61, 0x78, 0x69, 0x6D, 0x75, 0x6D, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
             0x70, 0x67, 0x42, 0x61, 0x63, 0x6B, 0x52, 0x65, 0x73, 0x74, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x67,
             0x65, 0x74, 0x20, 0x71, 0x75, 0x65, 0x75, 0x65, 0x2E,
-        0x78, 0x94, 0x02, // Description
+        0x78, 0xC8, 0x04, // Description
             0x53, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x61, 0x78, 0x69, 0x6D, 0x75,
             0x6D, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76,
             0x65, 0x2D, 0x67, 0x65, 0x74, 0x20, 0x71, 0x75, 0x65, 0x75, 0x65, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x61, 0x72, 0x63,
@@ -932,6 +973,22 @@ static const unsigned char helpDataPack[] =
             0x20, 0x61, 0x6E, 0x64, 0x20, 0x69, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x70, 0x65, 0x65,
             0x64, 0x20, 0x70, 0x72, 0x6F, 0x76, 0x69, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x74, 0x6F, 0x20, 0x50,
             0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x2E, 0x0A, 0x0A,
+            0x54, 0x68, 0x65, 0x20, 0x71, 0x75, 0x65, 0x75, 0x65, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x73, 0x6D,
+            0x61, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x61, 0x78, 0x69, 0x6D,
+            0x75, 0x6D, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x69,
+            0x73, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x75, 0x6D, 0x69, 0x6E, 0x67, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x73, 0x6C, 0x6F, 0x77,
+            0x6C, 0x79, 0x20, 0x65, 0x6E, 0x6F, 0x75, 0x67, 0x68, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x66, 0x65, 0x77, 0x65, 0x72,
+            0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x65, 0x65, 0x64, 0x65, 0x64,
+            0x20, 0x74, 0x6F, 0x20, 0x6B, 0x65, 0x65, 0x70, 0x20, 0x61, 0x68, 0x65, 0x61, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x72, 0x65,
+            0x70, 0x6C, 0x61, 0x79, 0x2C, 0x20, 0x62, 0x61, 0x73, 0x65, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72,
+            0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x68, 0x61, 0x73, 0x20, 0x62, 0x65, 0x65,
+            0x6E, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x75, 0x6D, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74,
+            0x69, 0x6D, 0x65, 0x20, 0x74, 0x61, 0x6B, 0x65, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x66, 0x65, 0x74, 0x63, 0x68, 0x20, 0x57,
+            0x41, 0x4C, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F,
+            0x72, 0x79, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x71, 0x75, 0x65, 0x75, 0x65, 0x20, 0x67, 0x72, 0x6F, 0x77, 0x73, 0x20,
+            0x62, 0x61, 0x63, 0x6B, 0x20, 0x74, 0x6F, 0x77, 0x61, 0x72, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x61, 0x78, 0x69,
+            0x6D, 0x75, 0x6D, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x79, 0x20, 0x73, 0x70, 0x65, 0x65,
+            0x64, 0x73, 0x20, 0x75, 0x70, 0x2E, 0x0A, 0x0A,
             0x53, 0x69, 0x7A, 0x65, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x65, 0x64, 0x20,
             0x69, 0x6E, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x28, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x29, 0x20, 0x6F,
             0x72, 0x20, 0x4B, 0x42, 0x2C, 0x20, 0x4D, 0x42, 0x2C, 0x20, 0x47, 0x42, 0x2C, 0x20, 0x54, 0x42, 0x2C, 0x20, 0x6F, 0x72,
@@ -1040,6 +1097,85 @@ static const unsigned char helpDataPack[] =
             0x61, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x70, 0x75, 0x73, 0x68, 0x20, 0x63,
             0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E,
 
+        // archive-push-dict option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x07, // Section
+            0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65,
+        0x78, 0x27, // Summary
+            0x43, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20,
+            0x74, 0x72, 0x61, 0x69, 0x6E, 0x65, 0x64, 0x20, 0x64, 0x69, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x72, 0x79, 0x2E,
+        0x78, 0xAB, 0x04, // Description
+            0x57, 0x41, 0x4C, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E,
+            0x20, 0x6D, 0x61, 0x6E, 0x79, 0x20, 0x73, 0x69, 0x6D, 0x69, 0x6C, 0x61, 0x72, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x72, 0x64,
+            0x73, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x61, 0x20, 0x7A, 0x73, 0x74, 0x20, 0x64, 0x69, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x61,
+            0x72, 0x79, 0x20, 0x74, 0x72, 0x61, 0x69, 0x6E, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x57, 0x41, 0x4C, 0x20,
+            0x63, 0x61, 0x6E, 0x20, 0x69, 0x6D, 0x70, 0x72, 0x6F, 0x76, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x70,
+            0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x2C, 0x20, 0x65, 0x73, 0x70, 0x65, 0x63,
+            0x69, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x61, 0x74, 0x20, 0x6C, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72,
+            0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x73, 0x2E, 0x20, 0x57, 0x68, 0x65, 0x6E, 0x20,
+            0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x2C, 0x20, 0x70, 0x67, 0x42, 0x61, 0x63, 0x6B, 0x52, 0x65, 0x73, 0x74, 0x20,
+            0x74, 0x72, 0x61, 0x69, 0x6E, 0x73, 0x20, 0x61, 0x20, 0x64, 0x69, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x72, 0x79, 0x20,
+            0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x73,
+            0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x70, 0x75, 0x73, 0x68, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x65, 0x61, 0x63,
+            0x68, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x20, 0x69, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x74, 0x6F,
+            0x72, 0x65, 0x73, 0x20, 0x69, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69,
+            0x74, 0x6F, 0x72, 0x79, 0x2E, 0x20, 0x4C, 0x61, 0x74, 0x65, 0x72, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x73, 0x65, 0x67, 0x6D,
+            0x65, 0x6E, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20,
+            0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x64, 0x69, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x72, 0x79,
+            0x2E, 0x0A, 0x0A,
+            0x54, 0x68, 0x65, 0x20, 0x64, 0x69, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x72, 0x79, 0x20, 0x69, 0x73, 0x20, 0x6C, 0x6F,
+            0x61, 0x64, 0x65, 0x64, 0x20, 0x61, 0x75, 0x74, 0x6F, 0x6D, 0x61, 0x74, 0x69, 0x63, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x62,
+            0x79, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x67, 0x65, 0x74, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x61,
+            0x20, 0x57, 0x41, 0x4C, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65,
+            0x73, 0x20, 0x69, 0x74, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E,
+            0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x20, 0x61, 0x74, 0x20,
+            0x61, 0x6E, 0x79, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x61, 0x66, 0x66,
+            0x65, 0x63, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x2E, 0x0A, 0x0A,
+            0x54, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x73, 0x20, 0x6E, 0x6F, 0x20, 0x65,
+            0x66, 0x66, 0x65, 0x63, 0x74, 0x20, 0x75, 0x6E, 0x6C, 0x65, 0x73, 0x73, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73,
+            0x73, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x20, 0x69, 0x73, 0x20, 0x7A, 0x73, 0x74, 0x2E,
+
+        // archive-push-grace option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x07, // Section
+            0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65,
+        0x78, 0x3E, // Summary
+            0x54, 0x69, 0x6D, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x68, 0x72, 0x6F, 0x6E, 0x6F, 0x75,
+            0x73, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x70, 0x75, 0x73, 0x68, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65,
+            0x73, 0x73, 0x20, 0x77, 0x61, 0x69, 0x74, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x57, 0x41,
+            0x4C, 0x2E,
+        0x78, 0xB4, 0x04, // Description
+            0x42, 0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x73, 0x79, 0x6E, 0x63,
+            0x68, 0x72, 0x6F, 0x6E, 0x6F, 0x75, 0x73, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D, 0x70, 0x75, 0x73, 0x68,
+            0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x65, 0x78, 0x69, 0x74, 0x73, 0x20, 0x61, 0x73, 0x20, 0x73, 0x6F,
+            0x6F, 0x6E, 0x20, 0x61, 0x73, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x57, 0x41, 0x4C, 0x20,
+            0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x62, 0x65, 0x65, 0x6E, 0x20, 0x70,
+            0x75, 0x73, 0x68, 0x65, 0x64, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x61, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x70, 0x72, 0x6F, 0x63,
+            0x65, 0x73, 0x73, 0x20, 0x28, 0x61, 0x6E, 0x64, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70,
+            0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65, 0x73, 0x29, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65, 0x20, 0x73, 0x74,
+            0x61, 0x72, 0x74, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x57,
+            0x41, 0x4C, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x20, 0x57, 0x68, 0x65, 0x6E, 0x20, 0x61, 0x20, 0x67,
+            0x72, 0x61, 0x63, 0x65, 0x20, 0x70, 0x65, 0x72, 0x69, 0x6F, 0x64, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74,
+            0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x73, 0x74, 0x61, 0x79, 0x73, 0x20, 0x72, 0x75, 0x6E,
+            0x6E, 0x69, 0x6E, 0x67, 0x2C, 0x20, 0x70, 0x75, 0x73, 0x68, 0x65, 0x73, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x73, 0x65, 0x67,
+            0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x61, 0x73, 0x20, 0x73, 0x6F, 0x6F, 0x6E, 0x20, 0x61, 0x73, 0x20, 0x50, 0x6F, 0x73,
+            0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x6D, 0x61, 0x72, 0x6B, 0x73, 0x20, 0x74, 0x68, 0x65, 0x6D, 0x20, 0x72,
+            0x65, 0x61, 0x64, 0x79, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x65, 0x78, 0x69, 0x74, 0x73, 0x20, 0x6F, 0x6E, 0x6C, 0x79,
+            0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x6E, 0x6F, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E,
+            0x74, 0x73, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x62, 0x65, 0x65, 0x6E, 0x20, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x66,
+            0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x72, 0x61, 0x63, 0x65, 0x20, 0x70, 0x65, 0x72, 0x69, 0x6F, 0x64, 0x2E,
+            0x0A, 0x0A,
+            0x4F, 0x6E, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x73, 0x75, 0x70, 0x70,
+            0x6F, 0x72, 0x74, 0x20, 0x69, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x69,
+            0x73, 0x20, 0x6E, 0x6F, 0x74, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x57, 0x41, 0x4C, 0x20,
+            0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6D, 0x61, 0x72, 0x6B, 0x65, 0x64, 0x20,
+            0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x72, 0x61, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x63, 0x68,
+            0x65, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x65, 0x72, 0x69, 0x6F, 0x64, 0x69, 0x63, 0x61, 0x6C, 0x6C, 0x79, 0x2E,
+            0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x68, 0x61,
+            0x73, 0x20, 0x61, 0x6E, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x61, 0x72, 0x63,
+            0x68, 0x69, 0x76, 0x65, 0x2D, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x69, 0x73, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65,
+            0x64, 0x2E,
+
         // archive-push-queue-max option
         // -------------------------------------------------------------------------------------------------------------------------
         0x7B, 0x07, // Section
@@ -1117,6 +1253,41 @@ static const unsigned char helpDataPack[] =
             0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x63, 0x79, 0x20, 0x74, 0x6F,
             0x20, 0x62, 0x65, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x64, 0x2E,
 
+        // backup-cache-drop option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x06, // Section
+            0x62, 0x61, 0x63, 0x6B, 0x75, 0x70,
+        0x78, 0x3B, // Summary
+            0x44, 0x72, 0x6F, 0x70, 0x20, 0x63, 0x6C, 0x75, 0x73, 0x74, 0x65, 0x72, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x66,
+            0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x20, 0x61,
+            0x66, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64, 0x2E,
+        0x78, 0xE1, 0x03, // Description
+            0x41, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x72, 0x65, 0x61, 0x64, 0x73, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79,
+            0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6C, 0x75, 0x73, 0x74, 0x65, 0x72,
+            0x20, 0x6F, 0x6E, 0x63, 0x65, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x65, 0x76, 0x69,
+            0x63, 0x74, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65,
+            0x53, 0x51, 0x4C, 0x20, 0x69, 0x73, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x6C, 0x79, 0x20, 0x75, 0x73, 0x69, 0x6E,
+            0x67, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6E, 0x67,
+            0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x2E, 0x20,
+            0x57, 0x68, 0x65, 0x6E, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x2C, 0x20, 0x70, 0x67, 0x42, 0x61, 0x63, 0x6B,
+            0x52, 0x65, 0x73, 0x74, 0x20, 0x61, 0x64, 0x76, 0x69, 0x73, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6B, 0x65, 0x72,
+            0x6E, 0x65, 0x6C, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x63, 0x6C, 0x75, 0x73, 0x74, 0x65, 0x72, 0x20,
+            0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x74, 0x69, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x61,
+            0x6E, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x64, 0x72, 0x6F, 0x70, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x70, 0x61, 0x67,
+            0x65, 0x73, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x61, 0x63, 0x68, 0x65, 0x20, 0x6F, 0x6E,
+            0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x62, 0x65, 0x65, 0x6E, 0x20, 0x72, 0x65,
+            0x61, 0x64, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x69, 0x6D, 0x70, 0x61, 0x63, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20,
+            0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x65, 0x72, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x6E, 0x63, 0x65, 0x20, 0x6F,
+            0x66, 0x20, 0x61, 0x20, 0x62, 0x75, 0x73, 0x79, 0x20, 0x63, 0x6C, 0x75, 0x73, 0x74, 0x65, 0x72, 0x20, 0x62, 0x75, 0x74,
+            0x20, 0x6D, 0x61, 0x79, 0x20, 0x6D, 0x61, 0x6B, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70,
+            0x20, 0x69, 0x74, 0x73, 0x65, 0x6C, 0x66, 0x20, 0x73, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x6C, 0x79, 0x20, 0x73, 0x6C, 0x6F,
+            0x77, 0x65, 0x72, 0x2E, 0x0A, 0x0A,
+            0x54, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x73, 0x20, 0x6E, 0x6F, 0x20, 0x65,
+            0x66, 0x66, 0x65, 0x63, 0x74, 0x20, 0x6F, 0x6E, 0x20, 0x70, 0x6C, 0x61, 0x74, 0x66, 0x6F, 0x72, 0x6D, 0x73, 0x20, 0x74,
+            0x68, 0x61, 0x74, 0x20, 0x64, 0x6F, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x70,
+            0x6F, 0x73, 0x69, 0x78, 0x5F, 0x66, 0x61, 0x64, 0x76, 0x69, 0x73, 0x65, 0x28, 0x29, 0x2E,
+
         // backup-standby option
         // -------------------------------------------------------------------------------------------------------------------------
         0x7B, 0x06, // Section
@@ -1299,6 +1470,53 @@ static const unsigned char helpDataPack[] =
             0x6F, 0x6E, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6C, 0x77, 0x61, 0x79, 0x73, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65,
             0x64, 0x2E,
 
+        // compress-thread option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x07, // Section
+            0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C,
+        0x78, 0x23, // Summary
+            0x54, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x63, 0x6F, 0x6D, 0x70,
+            0x72, 0x65, 0x73, 0x73, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E,
+        0x78, 0xDF, 0x05, // Description
+            0x42, 0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x66, 0x69, 0x6C, 0x65,
+            0x20, 0x69, 0x73, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20,
+            0x73, 0x69, 0x6E, 0x67, 0x6C, 0x65, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6F, 0x70,
+            0x79, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E, 0x20, 0x57, 0x68, 0x65, 0x6E, 0x20,
+            0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x7A, 0x73, 0x74, 0x20, 0x61, 0x6E,
+            0x64, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x2D, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20, 0x69, 0x73,
+            0x20, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x6F, 0x6E, 0x65, 0x2C, 0x20, 0x65,
+            0x61, 0x63, 0x68, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73,
+            0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x6D, 0x61, 0x6E, 0x79, 0x20, 0x77, 0x6F, 0x72, 0x6B,
+            0x65, 0x72, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x69, 0x73, 0x20,
+            0x6D, 0x6F, 0x73, 0x74, 0x20, 0x75, 0x73, 0x65, 0x66, 0x75, 0x6C, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x66, 0x65, 0x77,
+            0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x6C, 0x69, 0x67, 0x68, 0x74,
+            0x2C, 0x20, 0x65, 0x2E, 0x67, 0x2E, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x61, 0x72, 0x63, 0x68, 0x69, 0x76, 0x65, 0x2D,
+            0x70, 0x75, 0x73, 0x68, 0x20, 0x69, 0x73, 0x20, 0x70, 0x75, 0x73, 0x68, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x73, 0x69,
+            0x6E, 0x67, 0x6C, 0x65, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x6F, 0x72, 0x20,
+            0x61, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6F, 0x70, 0x79, 0x69, 0x6E, 0x67, 0x20,
+            0x61, 0x20, 0x66, 0x65, 0x77, 0x20, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x2C, 0x20, 0x61,
+            0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x6C,
+            0x65, 0x76, 0x65, 0x6C, 0x20, 0x69, 0x73, 0x20, 0x68, 0x69, 0x67, 0x68, 0x20, 0x65, 0x6E, 0x6F, 0x75, 0x67, 0x68, 0x20,
+            0x74, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x43, 0x50, 0x55, 0x2E, 0x0A, 0x0A,
+            0x54, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x64, 0x64, 0x69, 0x74,
+            0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x2D, 0x6D, 0x61, 0x78, 0x20, 0x73,
+            0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F,
+            0x66, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64,
+            0x73, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x75, 0x70, 0x20, 0x74, 0x6F, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65,
+            0x73, 0x73, 0x2D, 0x6D, 0x61, 0x78, 0x20, 0x2A, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x2D, 0x74, 0x68,
+            0x72, 0x65, 0x61, 0x64, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x73,
+            0x20, 0x69, 0x67, 0x6E, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20, 0x63,
+            0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x79, 0x70, 0x65, 0x73, 0x20, 0x73, 0x69, 0x6E,
+            0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x7A, 0x32, 0x2C, 0x20, 0x67, 0x7A, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20,
+            0x6C, 0x7A, 0x34, 0x20, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x69, 0x65, 0x73, 0x20, 0x64, 0x6F, 0x20, 0x6E, 0x6F, 0x74,
+            0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E,
+            0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x2C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x74,
+            0x68, 0x65, 0x20, 0x7A, 0x73, 0x74, 0x20, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x79, 0x20, 0x77, 0x61, 0x73, 0x20, 0x62,
+            0x75, 0x69, 0x6C, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x20,
+            0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x2E,
+
         // compress-type option
         // -------------------------------------------------------------------------------------------------------------------------
         0x7B, 0x07, // Section
@@ -1749,7 +1967,7 @@ static const unsigned char helpDataPack[] =
                     0x75, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x73, 0x75, 0x6D, 0x73, 0x2E,
             0x00, // Command restore override end
 
-            0x50, // Command stanza-create override begin
+            0x51, // Command stanza-create override begin
                 0x28, // Internal
                 0x78, 0x16, // Summary
                     0x46, 0x6F, 0x72, 0x63, 0x65, 0x20, 0x73, 0x74, 0x61, 0x6E, 0x7A, 0x61, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74,
@@ -1844,6 +2062,66 @@ static const unsigned char helpDataPack[] =
             0x65, 0x76, 0x65, 0x6E, 0x20, 0x69, 0x66, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x61,
             0x20, 0x73, 0x69, 0x6E, 0x67, 0x6C, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x2E,
 
+        // io-uring option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x07, // Section
+            0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C,
+        0x78, 0x1A, // Summary
+            0x55, 0x73, 0x65, 0x20, 0x69, 0x6F, 0x5F, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x66, 0x69, 0x6C,
+            0x65, 0x20, 0x49, 0x2F, 0x4F, 0x2E,
+        0x78, 0x94, 0x03, // Description
+            0x55, 0x73, 0x65, 0x20, 0x4C, 0x69, 0x6E, 0x75, 0x78, 0x20, 0x69, 0x6F, 0x5F, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x74,
+            0x6F, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x66, 0x69, 0x6C,
+            0x65, 0x73, 0x20, 0x6F, 0x6E, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x78, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x61, 0x67, 0x65, 0x2C,
+            0x20, 0x69, 0x2E, 0x65, 0x2E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C,
+            0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x61, 0x6E, 0x64, 0x20,
+            0x61, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x78, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x20,
+            0x53, 0x65, 0x76, 0x65, 0x72, 0x61, 0x6C, 0x20, 0x72, 0x65, 0x61, 0x64, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x71, 0x75,
+            0x65, 0x75, 0x65, 0x64, 0x20, 0x61, 0x68, 0x65, 0x61, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65,
+            0x73, 0x73, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x65, 0x6E, 0x63, 0x72, 0x79, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x65,
+            0x74, 0x63, 0x2E, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x73, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6C,
+            0x65, 0x74, 0x65, 0x20, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x68, 0x72, 0x6F, 0x6E, 0x6F, 0x75, 0x73, 0x6C, 0x79, 0x20, 0x73,
+            0x6F, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6E, 0x67, 0x6C, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x63,
+            0x61, 0x6E, 0x20, 0x6B, 0x65, 0x65, 0x70, 0x20, 0x66, 0x61, 0x73, 0x74, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x61, 0x67, 0x65,
+            0x20, 0x62, 0x75, 0x73, 0x79, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x65, 0x61, 0x64, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x6C, 0x74,
+            0x65, 0x72, 0x6E, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x20, 0x49, 0x2F, 0x4F,
+            0x20, 0x61, 0x6E, 0x64, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x2E, 0x0A, 0x0A,
+            0x49, 0x66, 0x20, 0x69, 0x6F, 0x5F, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73,
+            0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6B, 0x65, 0x72, 0x6E,
+            0x65, 0x6C, 0x20, 0x28, 0x6F, 0x72, 0x20, 0x69, 0x73, 0x20, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x29, 0x20,
+            0x74, 0x68, 0x65, 0x6E, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x69, 0x6E, 0x67, 0x20, 0x49, 0x2F, 0x4F, 0x20, 0x69, 0x73,
+            0x20, 0x75, 0x73, 0x65, 0x64, 0x2E,
+
+        // job-queue-max option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x07, // Section
+            0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C,
+        0x78, 0x1F, // Summary
+            0x4D, 0x61, 0x78, 0x20, 0x6A, 0x6F, 0x62, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x20, 0x70,
+            0x65, 0x72, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x2E,
+        0x78, 0x9B, 0x03, // Description
+            0x42, 0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x6C, 0x6F, 0x63, 0x61,
+            0x6C, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 0x6E, 0x74, 0x20, 0x61, 0x20,
+            0x6E, 0x65, 0x77, 0x20, 0x6A, 0x6F, 0x62, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x74,
+            0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x69, 0x74, 0x73, 0x20, 0x70, 0x72, 0x69,
+            0x6F, 0x72, 0x20, 0x6A, 0x6F, 0x62, 0x20, 0x68, 0x61, 0x73, 0x20, 0x62, 0x65, 0x65, 0x6E, 0x20, 0x72, 0x65, 0x63, 0x65,
+            0x69, 0x76, 0x65, 0x64, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73,
+            0x20, 0x69, 0x73, 0x20, 0x69, 0x64, 0x6C, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x20, 0x72, 0x6F, 0x75, 0x6E, 0x64,
+            0x20, 0x74, 0x72, 0x69, 0x70, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x20, 0x6A, 0x6F, 0x62, 0x73, 0x2E, 0x20,
+            0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x6A, 0x6F, 0x62, 0x2D, 0x71, 0x75, 0x65, 0x75, 0x65, 0x2D, 0x6D, 0x61,
+            0x78, 0x20, 0x68, 0x69, 0x67, 0x68, 0x65, 0x72, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x73, 0x20, 0x6D, 0x6F, 0x72, 0x65,
+            0x20, 0x6A, 0x6F, 0x62, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x73, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20,
+            0x65, 0x61, 0x63, 0x68, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20,
+            0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64,
+            0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x69, 0x6D, 0x70, 0x72, 0x6F, 0x76, 0x65, 0x20,
+            0x70, 0x65, 0x72, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x6E, 0x63, 0x65, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65,
+            0x72, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6D, 0x61, 0x6E, 0x79, 0x20, 0x73, 0x6D, 0x61, 0x6C, 0x6C, 0x20, 0x66, 0x69,
+            0x6C, 0x65, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x57, 0x41, 0x4C, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x20,
+            0x74, 0x6F, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x2E, 0x20, 0x52, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x73, 0x20,
+            0x61, 0x72, 0x65, 0x20, 0x73, 0x74, 0x69, 0x6C, 0x6C, 0x20, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x20, 0x69,
+            0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6A, 0x6F, 0x62, 0x73,
+            0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x73, 0x65, 0x6E, 0x74, 0x2E,
+
         // job-retry option
         // -------------------------------------------------------------------------------------------------------------------------
         0x2A, // Internal
@@ -2177,7 +2455,7 @@ static const unsigned char helpDataPack[] =
                     0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x2E,
             0x00, // Command backup override end
 
-            0x5A, 0x01, // Command stanza-create override begin
+            0x5B, 0x01, // Command stanza-create override begin
                 0x79, 0x1C, // Summary
                     0x43, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x6F, 0x6E, 0x20, 0x61, 0x6E, 0x20, 0x6F, 0x6E, 0x6C, 0x69, 0x6E,
                     0x65, 0x20, 0x63, 0x6C, 0x75, 0x73, 0x74, 0x65, 0x72, 0x2E,
@@ -2323,10 +2601,43 @@ static const unsigned char helpDataPack[] =
 
         0x00, // Command overrides end
 
-        // pg-host-cmd option
+        // pg-host-ca-file option
         // -------------------------------------------------------------------------------------------------------------------------
         0x79, 0x06, // Section
             0x73, 0x74, 0x61, 0x6E, 0x7A, 0x61,
+        0x78, 0x2B, // Summary
+            0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x63, 0x65, 0x72, 0x74,
+            0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x61, 0x75, 0x74, 0x68, 0x6F, 0x72, 0x69, 0x74, 0x79, 0x20, 0x66, 0x69,
+            0x6C, 0x65, 0x2E,
+        0x78, 0x6E, // Description
+            0x55, 0x73, 0x65, 0x20, 0x61, 0x20, 0x43, 0x41, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20,
+            0x74, 0x68, 0x61, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x20, 0x64, 0x65, 0x66, 0x61,
+            0x75, 0x6C, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x76, 0x65, 0x72, 0x69, 0x66, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x65,
+            0x72, 0x74, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74, 0x65, 0x64, 0x20,
+            0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x68, 0x6F,
+            0x73, 0x74, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x2E,
+
+        // pg-host-cert-file option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x06, // Section
+            0x73, 0x74, 0x61, 0x6E, 0x7A, 0x61,
+        0x78, 0x21, // Summary
+            0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x63, 0x65, 0x72, 0x74,
+            0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E,
+        0x78, 0x9D, 0x01, // Description
+            0x53, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53,
+            0x51, 0x4C, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x74, 0x6F, 0x20, 0x70, 0x72,
+            0x6F, 0x76, 0x65, 0x20, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x79, 0x2E,
+            0x20, 0x54, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x6F, 0x6E, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x6F, 0x66, 0x20,
+            0x74, 0x68, 0x65, 0x20, 0x63, 0x65, 0x72, 0x74, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x6D, 0x75, 0x73, 0x74,
+            0x20, 0x62, 0x65, 0x20, 0x61, 0x75, 0x74, 0x68, 0x6F, 0x72, 0x69, 0x7A, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x6C,
+            0x73, 0x2D, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x2D, 0x61, 0x75, 0x74, 0x68, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x2E,
+
+        // pg-host-cmd option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x06, // Section
+            0x73, 0x74, 0x61, 0x6E, 0x7A, 0x61,
         0x78, 0x2B, // Summary
             0x70, 0x67, 0x42, 0x61, 0x63, 0x6B, 0x52, 0x65, 0x73, 0x74, 0x20, 0x65, 0x78, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20,
             0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x68, 0x6F,
@@ -2413,6 +2724,18 @@ static const unsigned char helpDataPack[] =
             0x68, 0x61, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67,
             0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x61, 0x74, 0x68, 0x2E,
 
+        // pg-host-key-file option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x06, // Section
+            0x73, 0x74, 0x61, 0x6E, 0x7A, 0x61,
+        0x78, 0x19, // Summary
+            0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x6B, 0x65, 0x79, 0x20,
+            0x66, 0x69, 0x6C, 0x65, 0x2E,
+        0x78, 0x2C, // Description
+            0x50, 0x72, 0x6F, 0x76, 0x65, 0x73, 0x20, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x20, 0x63, 0x65, 0x72, 0x74, 0x69, 0x66,
+            0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x77, 0x61, 0x73, 0x20, 0x73, 0x65, 0x6E, 0x74, 0x20, 0x62, 0x79, 0x20, 0x6F, 0x77,
+            0x6E, 0x65, 0x72, 0x2E,
+
         // pg-host-port option
         // -------------------------------------------------------------------------------------------------------------------------
         0x7B, 0x06, // Section
@@ -2421,23 +2744,56 @@ static const unsigned char helpDataPack[] =
             0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x70, 0x6F, 0x72, 0x74,
             0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x70, 0x67, 0x2D, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x69, 0x73, 0x20, 0x73, 0x65, 0x74,
             0x2E,
-        0x78, 0x6F, // Description
+        0x78, 0xFC, 0x01, // Description
             0x55, 0x73, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x73,
             0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x61, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74,
             0x20, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72,
             0x65, 0x53, 0x51, 0x4C, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x2E, 0x20,
-            0x43, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x6C, 0x79, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x53, 0x53, 0x48, 0x20, 0x69,
-            0x73, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x65, 0x64,
+            0x57, 0x68, 0x65, 0x6E, 0x20, 0x70, 0x67, 0x2D, 0x68, 0x6F, 0x73, 0x74, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x73, 0x73,
+            0x68, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C,
+            0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x6F, 0x72, 0x74,
+            0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x77, 0x68, 0x61, 0x74, 0x65, 0x76, 0x65, 0x72, 0x20, 0x69, 0x73,
+            0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20,
+            0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x62, 0x79,
+            0x20, 0x63, 0x6D, 0x64, 0x2D, 0x73, 0x73, 0x68, 0x2E, 0x20, 0x57, 0x68, 0x65, 0x6E, 0x20, 0x70, 0x67, 0x2D, 0x68, 0x6F,
+            0x73, 0x74, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x74, 0x6C, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x66, 0x61,
+            0x75, 0x6C, 0x74, 0x20, 0x69, 0x73, 0x20, 0x38, 0x34, 0x33, 0x32, 0x2E,
 
         0x10, // Deprecated names begin
             0x78, 0x0B, // db-ssh-port
                 0x64, 0x62, 0x2D, 0x73, 0x73, 0x68, 0x2D, 0x70, 0x6F, 0x72, 0x74,
         0x00, // Deprecated names end
 
-        // pg-host-user option
+        // pg-host-type option
         // -------------------------------------------------------------------------------------------------------------------------
         0x7A, 0x06, // Section
             0x73, 0x74, 0x61, 0x6E, 0x7A, 0x61,
+        0x78, 0x1E, // Summary
+            0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x70, 0x72, 0x6F, 0x74,
+            0x6F, 0x63, 0x6F, 0x6C, 0x20, 0x74, 0x79, 0x70, 0x65, 0x2E,
+        0x78, 0xA9, 0x02, // Description
+            0x54, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63,
+            0x6F, 0x6C, 0x20, 0x74, 0x79, 0x70, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74,
+            0x65, 0x64, 0x3A, 0x0A, 0x0A, 0x0A,
+            0x2A, 0x20, 0x73, 0x73, 0x68, 0x20, 0x2D, 0x20, 0x53, 0x65, 0x63, 0x75, 0x72, 0x65, 0x20, 0x53, 0x68, 0x65, 0x6C, 0x6C,
+            0x2E, 0x20, 0x41, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x74, 0x65, 0x20, 0x69, 0x73, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x65,
+            0x64, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20,
+            0x68, 0x6F, 0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61,
+            0x6E, 0x64, 0x2E, 0x0A,
+            0x2A, 0x20, 0x74, 0x6C, 0x73, 0x20, 0x2D, 0x20, 0x70, 0x67, 0x42, 0x61, 0x63, 0x6B, 0x52, 0x65, 0x73, 0x74, 0x20, 0x54,
+            0x4C, 0x53, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x2E, 0x20, 0x43, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x73, 0x20,
+            0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20,
+            0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6C, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x72, 0x75, 0x6E, 0x6E,
+            0x69, 0x6E, 0x67, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51,
+            0x4C, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x61, 0x76, 0x6F, 0x69, 0x64, 0x73,
+            0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x53, 0x48, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x75, 0x70,
+            0x20, 0x6F, 0x76, 0x65, 0x72, 0x68, 0x65, 0x61, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x63,
+            0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E,
+
+        // pg-host-user option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x06, // Section
+            0x73, 0x74, 0x61, 0x6E, 0x7A, 0x61,
         0x78, 0x2F, // Summary
             0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x6C, 0x6F, 0x67, 0x6F,
             0x6E, 0x20, 0x75, 0x73, 0x65, 0x72, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x70, 0x67, 0x2D, 0x68, 0x6F, 0x73, 0x74, 0x20,
@@ -2600,6 +2956,55 @@ static const unsigned char helpDataPack[] =
             0x74, 0x20, 0x69, 0x74, 0x20, 0x69, 0x6D, 0x70, 0x61, 0x63, 0x74, 0x73, 0x20, 0x64, 0x61, 0x74, 0x61, 0x62, 0x61, 0x73,
             0x65, 0x20, 0x70, 0x65, 0x72, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x6E, 0x63, 0x65, 0x2E,
 
+        // protocol-mux option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x07, // Section
+            0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C,
+        0x78, 0x3E, // Summary
+            0x4D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 0x78, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 0x72, 0x6F, 0x63,
+            0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65,
+            0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x65, 0x72, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x74, 0x65, 0x20, 0x68, 0x6F, 0x73,
+            0x74, 0x2E,
+        0x78, 0xE6, 0x05, // Description
+            0x42, 0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x70, 0x72, 0x6F, 0x63,
+            0x65, 0x73, 0x73, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65,
+            0x73, 0x73, 0x2D, 0x6D, 0x61, 0x78, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x73, 0x20, 0x69, 0x74, 0x73, 0x20, 0x6F, 0x77, 0x6E,
+            0x20, 0x53, 0x53, 0x48, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x65,
+            0x61, 0x63, 0x68, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x74, 0x65, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x69, 0x74, 0x20, 0x6E,
+            0x65, 0x65, 0x64, 0x73, 0x2E, 0x20, 0x57, 0x68, 0x65, 0x6E, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x2D,
+            0x6D, 0x75, 0x78, 0x20, 0x69, 0x73, 0x20, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6E,
+            0x67, 0x6C, 0x65, 0x20, 0x53, 0x53, 0x48, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69,
+            0x73, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x72, 0x65, 0x6D,
+            0x6F, 0x74, 0x65, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F,
+            0x63, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x20, 0x69, 0x74, 0x2C, 0x20, 0x77, 0x68, 0x69,
+            0x63, 0x68, 0x20, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65,
+            0x72, 0x20, 0x6F, 0x66, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x61, 0x6E, 0x64,
+            0x20, 0x61, 0x75, 0x74, 0x68, 0x65, 0x6E, 0x74, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x6F, 0x6E, 0x20,
+            0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x74, 0x65, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x77, 0x68, 0x65, 0x6E,
+            0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x2D, 0x6D, 0x61, 0x78, 0x20, 0x69, 0x73, 0x20, 0x6C, 0x61, 0x72, 0x67,
+            0x65, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x74, 0x65, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73,
+            0x20, 0x61, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20,
+            0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x70, 0x72, 0x6F,
+            0x63, 0x65, 0x73, 0x73, 0x20, 0x73, 0x6F, 0x20, 0x77, 0x6F, 0x72, 0x6B, 0x20, 0x69, 0x73, 0x20, 0x73, 0x74, 0x69, 0x6C,
+            0x6C, 0x20, 0x70, 0x65, 0x72, 0x66, 0x6F, 0x72, 0x6D, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6C,
+            0x6C, 0x65, 0x6C, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x74, 0x65, 0x20, 0x68, 0x6F,
+            0x73, 0x74, 0x2E, 0x0A, 0x0A,
+            0x54, 0x68, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x6F, 0x6E,
+            0x6C, 0x79, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x20, 0x61, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F,
+            0x6E, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x62, 0x6C, 0x65,
+            0x20, 0x74, 0x6F, 0x20, 0x6B, 0x65, 0x65, 0x70, 0x20, 0x75, 0x70, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x65, 0x61, 0x63,
+            0x68, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x70,
+            0x75, 0x74, 0x20, 0x6D, 0x61, 0x79, 0x20, 0x62, 0x65, 0x20, 0x6C, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E,
+            0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E,
+            0x73, 0x20, 0x69, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x74, 0x77, 0x6F, 0x72, 0x6B, 0x20, 0x69, 0x73, 0x20,
+            0x66, 0x61, 0x73, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x6F, 0x6D, 0x65, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73,
+            0x73, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x6C, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20,
+            0x6F, 0x74, 0x68, 0x65, 0x72, 0x73, 0x2E, 0x20, 0x54, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+            0x68, 0x61, 0x73, 0x20, 0x6E, 0x6F, 0x20, 0x65, 0x66, 0x66, 0x65, 0x63, 0x74, 0x20, 0x6F, 0x6E, 0x20, 0x72, 0x65, 0x6D,
+            0x6F, 0x74, 0x65, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x2D,
+            0x68, 0x6F, 0x73, 0x74, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x20, 0x6F, 0x72, 0x20, 0x70, 0x67, 0x2D, 0x68, 0x6F, 0x73, 0x74,
+            0x2D, 0x74, 0x79, 0x70, 0x65, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x6C, 0x73, 0x2E,
+
         // protocol-timeout option
         // -------------------------------------------------------------------------------------------------------------------------
         0x7B, 0x07, // Section
@@ -2708,10 +3113,18 @@ static const unsigned char helpDataPack[] =
 
         0x00, // Command overrides end
 
-        // remote-type option
+        // remote-mux option
         // -------------------------------------------------------------------------------------------------------------------------
         0x28, // Internal
 
+        // remote-mux-path option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x2D, 0x01, // Internal
+
+        // remote-type option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x2D, 0x01, // Internal
+
         // repo option
         // -------------------------------------------------------------------------------------------------------------------------
         0x7E, 0x01, 0x0A, // Section
@@ -2819,6 +3232,143 @@ static const unsigned char helpDataPack[] =
             0x2A, 0x20, 0x73, 0x61, 0x73, 0x20, 0x2D, 0x20, 0x53, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 0x61, 0x63, 0x63, 0x65, 0x73,
             0x73, 0x20, 0x73, 0x69, 0x67, 0x6E, 0x61, 0x74, 0x75, 0x72, 0x65,
 
+        // repo-block option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x0A, // Section
+            0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
+        0x78, 0x20, // Summary
+            0x45, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x69, 0x6E, 0x63, 0x72, 0x65, 0x6D, 0x65,
+            0x6E, 0x74, 0x61, 0x6C, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x2E,
+        0x78, 0xB6, 0x05, // Description
+            0x42, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x69, 0x6E, 0x63, 0x72, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x6C, 0x20, 0x61, 0x6C,
+            0x6C, 0x6F, 0x77, 0x73, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x67, 0x72, 0x61, 0x6E, 0x75, 0x6C,
+            0x61, 0x72, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x73, 0x20, 0x62, 0x79, 0x20, 0x73, 0x70, 0x6C, 0x69, 0x74, 0x74,
+            0x69, 0x6E, 0x67, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B,
+            0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x65, 0x64,
+            0x20, 0x75, 0x70, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x6E, 0x74, 0x6C, 0x79, 0x2E, 0x20, 0x54,
+            0x68, 0x69, 0x73, 0x20, 0x73, 0x61, 0x76, 0x65, 0x73, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x74,
+            0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x69,
+            0x6D, 0x65, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x61, 0x20, 0x73, 0x6D, 0x61, 0x6C, 0x6C,
+            0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x61, 0x20, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x20, 0x66, 0x69, 0x6C,
+            0x65, 0x20, 0x68, 0x61, 0x73, 0x20, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x64, 0x2C, 0x20, 0x65, 0x2E, 0x67, 0x2E, 0x20,
+            0x61, 0x20, 0x66, 0x65, 0x77, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x31, 0x47, 0x42,
+            0x20, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x65, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x20, 0x45,
+            0x61, 0x63, 0x68, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x69, 0x6E, 0x63, 0x72, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61,
+            0x6C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74,
+            0x68, 0x20, 0x61, 0x20, 0x6D, 0x61, 0x70, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x72, 0x64, 0x73,
+            0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x73, 0x75, 0x6D, 0x20, 0x6F, 0x66, 0x20, 0x65, 0x61, 0x63,
+            0x68, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B,
+            0x75, 0x70, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x69,
+            0x73, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x2E, 0x20, 0x4F, 0x6E, 0x6C, 0x79, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B,
+            0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x64, 0x20,
+            0x73, 0x69, 0x6E, 0x63, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x69, 0x6F, 0x72, 0x20, 0x62, 0x61, 0x63, 0x6B,
+            0x75, 0x70, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x70, 0x69, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65,
+            0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x72, 0x65, 0x61, 0x73, 0x73, 0x65, 0x6D, 0x62, 0x6C, 0x65, 0x73, 0x20, 0x74, 0x68,
+            0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x73, 0x20, 0x73,
+            0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20,
+            0x61, 0x6E, 0x64, 0x20, 0x70, 0x72, 0x69, 0x6F, 0x72, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x73, 0x20, 0x69, 0x6E,
+            0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x74, 0x2E, 0x0A, 0x0A,
+            0x42, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x69, 0x6E, 0x63, 0x72, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x61, 0x6C, 0x20, 0x69, 0x73,
+            0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x74, 0x69, 0x62, 0x6C, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68,
+            0x20, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x68, 0x61, 0x72, 0x64, 0x6C, 0x69, 0x6E, 0x6B, 0x20, 0x73, 0x69, 0x6E, 0x63, 0x65,
+            0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70,
+            0x20, 0x70, 0x61, 0x74, 0x68, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65,
+            0x74, 0x65, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73,
+            0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x72, 0x69, 0x6F, 0x72, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75,
+            0x70, 0x73, 0x2E,
+
+        // repo-bundle option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x0A, // Section
+            0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
+        0x78, 0x1B, // Summary
+            0x42, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x72, 0x65, 0x70, 0x6F,
+            0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x2E,
+        0x78, 0xAB, 0x03, // Description
+            0x42, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x20, 0x28, 0x63, 0x6F, 0x6D, 0x62, 0x69, 0x6E, 0x65, 0x29, 0x20, 0x73, 0x6D, 0x61,
+            0x6C, 0x6C, 0x65, 0x72, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65,
+            0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66,
+            0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68,
+            0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x2E, 0x20, 0x57, 0x72, 0x69, 0x74, 0x69, 0x6E,
+            0x67, 0x20, 0x66, 0x65, 0x77, 0x65, 0x72, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x69, 0x73, 0x20, 0x67, 0x65, 0x6E,
+            0x65, 0x72, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x20, 0x65, 0x66, 0x66, 0x69, 0x63, 0x69, 0x65, 0x6E,
+            0x74, 0x2C, 0x20, 0x65, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6C, 0x6C, 0x79, 0x20, 0x6F, 0x6E, 0x20, 0x6F, 0x62, 0x6A,
+            0x65, 0x63, 0x74, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x73, 0x20, 0x73, 0x75, 0x63, 0x68, 0x20, 0x61, 0x73, 0x20, 0x53,
+            0x33, 0x2E, 0x0A, 0x0A,
+            0x45, 0x61, 0x63, 0x68, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C,
+            0x65, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x72, 0x65, 0x73, 0x73, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20,
+            0x65, 0x6E, 0x63, 0x72, 0x79, 0x70, 0x74, 0x65, 0x64, 0x20, 0x69, 0x6E, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x6E,
+            0x74, 0x6C, 0x79, 0x20, 0x73, 0x6F, 0x20, 0x69, 0x74, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x74,
+            0x72, 0x69, 0x65, 0x76, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x64,
+            0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6F, 0x75, 0x74, 0x20, 0x72, 0x65, 0x61, 0x64, 0x69, 0x6E,
+            0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75,
+            0x6E, 0x64, 0x6C, 0x65, 0x2E, 0x0A, 0x0A,
+            0x42, 0x75, 0x6E, 0x64, 0x6C, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x70,
+            0x61, 0x74, 0x69, 0x62, 0x6C, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x68, 0x61, 0x72,
+            0x64, 0x6C, 0x69, 0x6E, 0x6B, 0x20, 0x73, 0x69, 0x6E, 0x63, 0x65, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x64, 0x20,
+            0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x63, 0x61, 0x6E, 0x6E, 0x6F, 0x74, 0x20, 0x62, 0x65, 0x20, 0x6C, 0x69, 0x6E, 0x6B,
+            0x65, 0x64, 0x20, 0x69, 0x6E, 0x64, 0x69, 0x76, 0x69, 0x64, 0x75, 0x61, 0x6C, 0x6C, 0x79, 0x2E,
+
+        // repo-bundle-limit option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x0A, // Section
+            0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
+        0x78, 0x17, // Summary
+            0x4C, 0x69, 0x6D, 0x69, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C,
+            0x65, 0x73, 0x2E,
+        0x78, 0x92, 0x02, // Description
+            0x53, 0x69, 0x7A, 0x65, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73,
+            0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x69, 0x6E, 0x63, 0x6C, 0x75, 0x64,
+            0x65, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x73, 0x2E, 0x20, 0x46, 0x69, 0x6C, 0x65, 0x73,
+            0x20, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x73, 0x69,
+            0x7A, 0x65, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x64, 0x20, 0x73, 0x65,
+            0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 0x6C, 0x79, 0x2E, 0x0A, 0x0A,
+            0x42, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x64, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x63, 0x61, 0x6E, 0x6E, 0x6F, 0x74,
+            0x20, 0x62, 0x65, 0x20, 0x72, 0x65, 0x75, 0x73, 0x65, 0x64, 0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x61, 0x20, 0x62, 0x61,
+            0x63, 0x6B, 0x75, 0x70, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x64, 0x2C, 0x20, 0x73, 0x6F, 0x20,
+            0x74, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x73,
+            0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x61, 0x6E, 0x20,
+            0x62, 0x65, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x65, 0x64, 0x2C, 0x20, 0x69, 0x2E, 0x65, 0x2E, 0x20, 0x68, 0x69, 0x67,
+            0x68, 0x65, 0x72, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x20, 0x69, 0x6E,
+            0x20, 0x66, 0x65, 0x77, 0x65, 0x72, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6D, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x66, 0x69, 0x6C,
+            0x65, 0x73, 0x2E,
+
+        // repo-bundle-size option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x0A, // Section
+            0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
+        0x78, 0x1D, // Summary
+            0x54, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x66, 0x69, 0x6C, 0x65,
+            0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x73, 0x2E,
+        0x78, 0x86, 0x04, // Description
+            0x44, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x20, 0x73, 0x69,
+            0x7A, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x77, 0x69, 0x6C,
+            0x6C, 0x20, 0x62, 0x65, 0x20, 0x61, 0x64, 0x64, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6E, 0x67,
+            0x6C, 0x65, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x2E, 0x20, 0x4D, 0x6F, 0x73, 0x74, 0x20, 0x62, 0x75, 0x6E, 0x64,
+            0x6C, 0x65, 0x73, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x73, 0x6D, 0x61, 0x6C, 0x6C, 0x65, 0x72, 0x20,
+            0x74, 0x68, 0x61, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x62, 0x75, 0x74, 0x20, 0x69,
+            0x74, 0x20, 0x69, 0x73, 0x20, 0x70, 0x6F, 0x73, 0x73, 0x69, 0x62, 0x6C, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x73,
+            0x6F, 0x6D, 0x65, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x73, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x6C, 0x79,
+            0x20, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x72, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x64, 0x6F, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73,
+            0x65, 0x74, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68,
+            0x65, 0x20, 0x6D, 0x61, 0x78, 0x69, 0x6D, 0x75, 0x6D, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20,
+            0x79, 0x6F, 0x75, 0x72, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x20, 0x61, 0x6C, 0x6C,
+            0x6F, 0x77, 0x73, 0x2E, 0x0A, 0x0A,
+            0x46, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x73, 0x6D, 0x61, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x34,
+            0x4B, 0x69, 0x42, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x34,
+            0x4B, 0x69, 0x42, 0x20, 0x74, 0x6F, 0x77, 0x61, 0x72, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C,
+            0x65, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C,
+            0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x20, 0x6F, 0x72, 0x20, 0x76, 0x65, 0x72, 0x79, 0x20,
+            0x73, 0x6D, 0x61, 0x6C, 0x6C, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x64, 0x6F, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x63,
+            0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x20, 0x61, 0x6E, 0x20, 0x75, 0x6E, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x65, 0x64, 0x20,
+            0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x2E, 0x0A, 0x0A,
+            0x49, 0x6E, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C, 0x2C, 0x20, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F,
+            0x74, 0x20, 0x61, 0x20, 0x67, 0x6F, 0x6F, 0x64, 0x20, 0x69, 0x64, 0x65, 0x61, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x65, 0x74,
+            0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x6F, 0x20, 0x68, 0x69, 0x67,
+            0x68, 0x20, 0x62, 0x65, 0x63, 0x61, 0x75, 0x73, 0x65, 0x20, 0x72, 0x65, 0x74, 0x72, 0x69, 0x65, 0x73, 0x20, 0x77, 0x69,
+            0x6C, 0x6C, 0x20, 0x6E, 0x65, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x64, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20,
+            0x65, 0x6E, 0x74, 0x69, 0x72, 0x65, 0x20, 0x62, 0x75, 0x6E, 0x64, 0x6C, 0x65, 0x2E,
+
         // repo-cipher-pass option
         // -------------------------------------------------------------------------------------------------------------------------
         0x7B, 0x0A, // Section
@@ -2993,7 +3543,7 @@ static const unsigned char helpDataPack[] =
                 0x28, // Internal
             0x00, // Command expire override end
 
-            0x58, 0x01, // Command stanza-create override begin
+            0x59, 0x01, // Command stanza-create override begin
                 0x28, // Internal
             0x00, // Command stanza-create override end
 
@@ -3007,10 +3557,43 @@ static const unsigned char helpDataPack[] =
 
         0x00, // Command overrides end
 
-        // repo-host-cmd option
+        // repo-host-ca-file option
         // -------------------------------------------------------------------------------------------------------------------------
         0x79, 0x0A, // Section
             0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
+        0x78, 0x2B, // Summary
+            0x52, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x63, 0x65, 0x72, 0x74,
+            0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x61, 0x75, 0x74, 0x68, 0x6F, 0x72, 0x69, 0x74, 0x79, 0x20, 0x66, 0x69,
+            0x6C, 0x65, 0x2E,
+        0x78, 0x6E, // Description
+            0x55, 0x73, 0x65, 0x20, 0x61, 0x20, 0x43, 0x41, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x20,
+            0x74, 0x68, 0x61, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6D, 0x20, 0x64, 0x65, 0x66, 0x61,
+            0x75, 0x6C, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x76, 0x65, 0x72, 0x69, 0x66, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x65,
+            0x72, 0x74, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6E, 0x74, 0x65, 0x64, 0x20,
+            0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x68, 0x6F,
+            0x73, 0x74, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x2E,
+
+        // repo-host-cert-file option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x0A, // Section
+            0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
+        0x78, 0x21, // Summary
+            0x52, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x63, 0x65, 0x72, 0x74,
+            0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E,
+        0x78, 0x9D, 0x01, // Description
+            0x53, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F,
+            0x72, 0x79, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x74, 0x6F, 0x20, 0x70, 0x72,
+            0x6F, 0x76, 0x65, 0x20, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x20, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x74, 0x79, 0x2E,
+            0x20, 0x54, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x6F, 0x6E, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x6F, 0x66, 0x20,
+            0x74, 0x68, 0x65, 0x20, 0x63, 0x65, 0x72, 0x74, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x6D, 0x75, 0x73, 0x74,
+            0x20, 0x62, 0x65, 0x20, 0x61, 0x75, 0x74, 0x68, 0x6F, 0x72, 0x69, 0x7A, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x6C,
+            0x73, 0x2D, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x2D, 0x61, 0x75, 0x74, 0x68, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x2E,
+
+        // repo-host-cmd option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x0A, // Section
+            0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
         0x78, 0x2B, // Summary
             0x70, 0x67, 0x42, 0x61, 0x63, 0x6B, 0x52, 0x65, 0x73, 0x74, 0x20, 0x65, 0x78, 0x65, 0x20, 0x70, 0x61, 0x74, 0x68, 0x20,
             0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x68, 0x6F,
@@ -3097,6 +3680,18 @@ static const unsigned char helpDataPack[] =
             0x68, 0x61, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67,
             0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x70, 0x61, 0x74, 0x68, 0x2E,
 
+        // repo-host-key-file option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x0A, // Section
+            0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
+        0x78, 0x19, // Summary
+            0x52, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x6B, 0x65, 0x79, 0x20,
+            0x66, 0x69, 0x6C, 0x65, 0x2E,
+        0x78, 0x2C, // Description
+            0x50, 0x72, 0x6F, 0x76, 0x65, 0x73, 0x20, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x20, 0x63, 0x65, 0x72, 0x74, 0x69, 0x66,
+            0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x77, 0x61, 0x73, 0x20, 0x73, 0x65, 0x6E, 0x74, 0x20, 0x62, 0x79, 0x20, 0x6F, 0x77,
+            0x6E, 0x65, 0x72, 0x2E,
+
         // repo-host-port option
         // -------------------------------------------------------------------------------------------------------------------------
         0x7B, 0x0A, // Section
@@ -3105,23 +3700,56 @@ static const unsigned char helpDataPack[] =
             0x52, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x70, 0x6F, 0x72, 0x74,
             0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x69, 0x73, 0x20, 0x73,
             0x65, 0x74, 0x2E,
-        0x78, 0x6F, // Description
+        0x78, 0x80, 0x02, // Description
             0x55, 0x73, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x73,
             0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x61, 0x20, 0x6E, 0x6F, 0x6E, 0x2D, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74,
             0x20, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69,
             0x74, 0x6F, 0x72, 0x79, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x2E, 0x20,
-            0x43, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x6C, 0x79, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x53, 0x53, 0x48, 0x20, 0x69,
-            0x73, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x65, 0x64,
+            0x57, 0x68, 0x65, 0x6E, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x68, 0x6F, 0x73, 0x74, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x3D,
+            0x73, 0x73, 0x68, 0x20, 0x74, 0x68, 0x65, 0x72, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6E, 0x6F, 0x20, 0x64, 0x65, 0x66, 0x61,
+            0x75, 0x6C, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x6F,
+            0x72, 0x74, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x77, 0x68, 0x61, 0x74, 0x65, 0x76, 0x65, 0x72, 0x20,
+            0x69, 0x73, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68,
+            0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20,
+            0x62, 0x79, 0x20, 0x63, 0x6D, 0x64, 0x2D, 0x73, 0x73, 0x68, 0x2E, 0x20, 0x57, 0x68, 0x65, 0x6E, 0x20, 0x72, 0x65, 0x70,
+            0x6F, 0x2D, 0x68, 0x6F, 0x73, 0x74, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x74, 0x6C, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20,
+            0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x69, 0x73, 0x20, 0x38, 0x34, 0x33, 0x32, 0x2E,
 
         0x10, // Deprecated names begin
             0x78, 0x0F, // backup-ssh-port
                 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x2D, 0x73, 0x73, 0x68, 0x2D, 0x70, 0x6F, 0x72, 0x74,
         0x00, // Deprecated names end
 
-        // repo-host-user option
+        // repo-host-type option
         // -------------------------------------------------------------------------------------------------------------------------
         0x7A, 0x0A, // Section
             0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
+        0x78, 0x1E, // Summary
+            0x52, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x70, 0x72, 0x6F, 0x74,
+            0x6F, 0x63, 0x6F, 0x6C, 0x20, 0x74, 0x79, 0x70, 0x65, 0x2E,
+        0x78, 0xA9, 0x02, // Description
+            0x54, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x6C, 0x6C, 0x6F, 0x77, 0x69, 0x6E, 0x67, 0x20, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63,
+            0x6F, 0x6C, 0x20, 0x74, 0x79, 0x70, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74,
+            0x65, 0x64, 0x3A, 0x0A, 0x0A, 0x0A,
+            0x2A, 0x20, 0x73, 0x73, 0x68, 0x20, 0x2D, 0x20, 0x53, 0x65, 0x63, 0x75, 0x72, 0x65, 0x20, 0x53, 0x68, 0x65, 0x6C, 0x6C,
+            0x2E, 0x20, 0x41, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x74, 0x65, 0x20, 0x69, 0x73, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x65,
+            0x64, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20,
+            0x68, 0x6F, 0x73, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61,
+            0x6E, 0x64, 0x2E, 0x0A,
+            0x2A, 0x20, 0x74, 0x6C, 0x73, 0x20, 0x2D, 0x20, 0x70, 0x67, 0x42, 0x61, 0x63, 0x6B, 0x52, 0x65, 0x73, 0x74, 0x20, 0x54,
+            0x4C, 0x53, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x2E, 0x20, 0x43, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x73, 0x20,
+            0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20,
+            0x74, 0x68, 0x61, 0x74, 0x20, 0x69, 0x73, 0x20, 0x61, 0x6C, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x72, 0x75, 0x6E, 0x6E,
+            0x69, 0x6E, 0x67, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72,
+            0x79, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x61, 0x76, 0x6F, 0x69, 0x64, 0x73,
+            0x20, 0x74, 0x68, 0x65, 0x20, 0x53, 0x53, 0x48, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x75, 0x70,
+            0x20, 0x6F, 0x76, 0x65, 0x72, 0x68, 0x65, 0x61, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x63,
+            0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x2E,
+
+        // repo-host-user option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x0A, // Section
+            0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
         0x78, 0x2B, // Summary
             0x52, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x75, 0x73, 0x65, 0x72,
             0x20, 0x77, 0x68, 0x65, 0x6E, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x69, 0x73, 0x20, 0x73,
@@ -3585,6 +4213,52 @@ static const unsigned char helpDataPack[] =
             0x73, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x65, 0x6D, 0x70, 0x6F, 0x72, 0x61, 0x72, 0x79, 0x20, 0x63,
             0x72, 0x65, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x61, 0x6C, 0x73, 0x2E,
 
+        // repo-s3-upload-concurrency option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x0A, // Section
+            0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
+        0x78, 0x25, // Summary
+            0x4D, 0x61, 0x78, 0x20, 0x63, 0x6F, 0x6E, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20,
+            0x75, 0x70, 0x6C, 0x6F, 0x61, 0x64, 0x73, 0x20, 0x70, 0x65, 0x72, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E,
+        0x78, 0xD7, 0x05, // Description
+            0x46, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x74, 0x68,
+            0x65, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x75, 0x70, 0x6C, 0x6F,
+            0x61, 0x64, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x53, 0x33, 0x20, 0x69, 0x6E, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x2E,
+            0x20, 0x42, 0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x70, 0x61, 0x72,
+            0x74, 0x20, 0x6D, 0x75, 0x73, 0x74, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x62, 0x65, 0x66, 0x6F,
+            0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x69, 0x73, 0x20,
+            0x73, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x75, 0x70, 0x6C, 0x6F, 0x61, 0x64, 0x20,
+            0x72, 0x61, 0x74, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6E, 0x67, 0x6C, 0x65, 0x20, 0x66, 0x69,
+            0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x6C, 0x61, 0x74, 0x65, 0x6E, 0x63, 0x79, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x64, 0x70,
+            0x6F, 0x69, 0x6E, 0x74, 0x2E, 0x20, 0x49, 0x6E, 0x63, 0x72, 0x65, 0x61, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x69,
+            0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x73, 0x20, 0x6D, 0x6F, 0x72, 0x65,
+            0x20, 0x70, 0x61, 0x72, 0x74, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x75, 0x70, 0x6C, 0x6F, 0x61, 0x64, 0x65,
+            0x64, 0x20, 0x63, 0x6F, 0x6E, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x6C, 0x79, 0x2C, 0x20, 0x65, 0x61, 0x63, 0x68,
+            0x20, 0x6F, 0x6E, 0x20, 0x61, 0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65,
+            0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x0A, 0x0A,
+            0x45, 0x61, 0x63, 0x68, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x69, 0x73, 0x20, 0x73, 0x74, 0x69, 0x6C, 0x6C, 0x20, 0x73,
+            0x65, 0x6E, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x75, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x20, 0x74,
+            0x68, 0x65, 0x20, 0x6E, 0x65, 0x78, 0x74, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x61, 0x64,
+            0x2C, 0x20, 0x73, 0x6F, 0x20, 0x63, 0x6F, 0x6E, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x63, 0x79, 0x20, 0x6F, 0x76, 0x65,
+            0x72, 0x6C, 0x61, 0x70, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x73, 0x70, 0x65, 0x6E, 0x74,
+            0x20, 0x77, 0x61, 0x69, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x64,
+            0x70, 0x6F, 0x69, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61,
+            0x63, 0x6B, 0x6E, 0x6F, 0x77, 0x6C, 0x65, 0x64, 0x67, 0x65, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x70, 0x61, 0x72, 0x74,
+            0x20, 0x72, 0x61, 0x74, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x72, 0x61,
+            0x6E, 0x73, 0x66, 0x65, 0x72, 0x20, 0x69, 0x74, 0x73, 0x65, 0x6C, 0x66, 0x2E, 0x20, 0x45, 0x61, 0x63, 0x68, 0x20, 0x70,
+            0x61, 0x72, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x20, 0x68, 0x6F, 0x6C, 0x64, 0x73, 0x20,
+            0x61, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20,
+            0x65, 0x6E, 0x64, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x20, 0x63, 0x6F, 0x70, 0x79, 0x20,
+            0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x74, 0x20, 0x69, 0x6E, 0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72,
+            0x79, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x20, 0x75,
+            0x70, 0x6C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x61, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x6D, 0x61, 0x79, 0x20,
+            0x75, 0x73, 0x65, 0x20, 0x75, 0x70, 0x20, 0x74, 0x6F, 0x20, 0x28, 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x73, 0x33, 0x2D, 0x75,
+            0x70, 0x6C, 0x6F, 0x61, 0x64, 0x2D, 0x63, 0x6F, 0x6E, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x63, 0x79, 0x20, 0x2B, 0x20,
+            0x31, 0x29, 0x20, 0x26, 0x74, 0x69, 0x6D, 0x65, 0x73, 0x3B, 0x20, 0x35, 0x4D, 0x69, 0x42, 0x20, 0x6F, 0x66, 0x20, 0x6D,
+            0x65, 0x6D, 0x6F, 0x72, 0x79, 0x2C, 0x20, 0x65, 0x2E, 0x67, 0x2E, 0x20, 0x38, 0x35, 0x4D, 0x69, 0x42, 0x20, 0x61, 0x74,
+            0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x61, 0x78, 0x69, 0x6D, 0x75, 0x6D, 0x20, 0x6F, 0x66, 0x20, 0x31, 0x36, 0x2E,
+
         // repo-s3-uri-style option
         // -------------------------------------------------------------------------------------------------------------------------
         0x7B, 0x0A, // Section
@@ -3688,10 +4362,42 @@ static const unsigned char helpDataPack[] =
                 0x72, 0x65, 0x70, 0x6F, 0x2D, 0x73, 0x33, 0x2D, 0x70, 0x6F, 0x72, 0x74,
         0x00, // Deprecated names end
 
-        // repo-storage-verify-tls option
+        // repo-storage-read-concurrency option
         // -------------------------------------------------------------------------------------------------------------------------
         0x7A, 0x0A, // Section
             0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
+        0x78, 0x24, // Summary
+            0x4D, 0x61, 0x78, 0x20, 0x63, 0x6F, 0x6E, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65,
+            0x20, 0x72, 0x65, 0x61, 0x64, 0x73, 0x20, 0x70, 0x65, 0x72, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E,
+        0x78, 0xB5, 0x03, // Description
+            0x42, 0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x66, 0x69, 0x6C, 0x65,
+            0x20, 0x69, 0x73, 0x20, 0x64, 0x6F, 0x77, 0x6E, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20,
+            0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x61, 0x67, 0x65, 0x20, 0x28, 0x65, 0x2E, 0x67, 0x2E, 0x20, 0x53, 0x33,
+            0x2C, 0x20, 0x41, 0x7A, 0x75, 0x72, 0x65, 0x29, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x73, 0x69, 0x6E, 0x67,
+            0x6C, 0x65, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64,
+            0x6F, 0x77, 0x6E, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x72, 0x61, 0x74, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x20, 0x73,
+            0x69, 0x6E, 0x67, 0x6C, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x69, 0x73, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x65,
+            0x64, 0x20, 0x62, 0x79, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x70, 0x75, 0x74, 0x20,
+            0x6F, 0x66, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x53,
+            0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68,
+            0x69, 0x67, 0x68, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x73, 0x70, 0x6C, 0x69, 0x74,
+            0x73, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x74, 0x6F, 0x20, 0x38, 0x4D, 0x69, 0x42, 0x20, 0x72, 0x61,
+            0x6E, 0x67, 0x65, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x64, 0x6F, 0x77, 0x6E, 0x6C, 0x6F, 0x61, 0x64, 0x73, 0x20, 0x75,
+            0x70, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x6D, 0x61, 0x6E, 0x79, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65,
+            0x73, 0x20, 0x63, 0x6F, 0x6E, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x6C, 0x79, 0x2C, 0x20, 0x65, 0x61, 0x63, 0x68,
+            0x20, 0x6F, 0x6E, 0x20, 0x61, 0x20, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65,
+            0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x73, 0x20, 0x61, 0x72,
+            0x65, 0x20, 0x73, 0x74, 0x69, 0x6C, 0x6C, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x6F, 0x72, 0x64, 0x65,
+            0x72, 0x2E, 0x0A, 0x0A,
+            0x45, 0x61, 0x63, 0x68, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x6C, 0x69, 0x67, 0x68, 0x74,
+            0x20, 0x68, 0x6F, 0x6C, 0x64, 0x73, 0x20, 0x61, 0x20, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+            0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x65, 0x6E, 0x64, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x20, 0x66, 0x6F, 0x72, 0x20,
+            0x65, 0x61, 0x63, 0x68, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x2E,
+
+        // repo-storage-verify-tls option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x0A, // Section
+            0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
         0x78, 0x26, // Summary
             0x52, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x61, 0x67, 0x65, 0x20, 0x63,
             0x65, 0x72, 0x74, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x76, 0x65, 0x72, 0x69, 0x66, 0x79, 0x2E,
@@ -3889,7 +4595,7 @@ static const unsigned char helpDataPack[] =
                     0x75, 0x70, 0x20, 0x74, 0x6F, 0x20, 0x72, 0x65, 0x73, 0x74, 0x6F, 0x72, 0x65, 0x2E,
             0x00, // Command restore override end
 
-            0x55, // Command verify override begin
+            0x56, // Command verify override begin
                 0x28, // Internal
                 0x78, 0x15, // Summary
                     0x42, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x76, 0x65, 0x72, 0x69,
@@ -4359,6 +5065,208 @@ static const unsigned char helpDataPack[] =
             0x50, 0x49, 0x4E, 0x54, 0x56, 0x4C, 0x20, 0x73, 0x6F, 0x63, 0x6B, 0x65, 0x74, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E,
             0x2E,
 
+        // throttle-read option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x07, // Section
+            0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C,
+        0x78, 0x1A, // Summary
+            0x4D, 0x61, 0x78, 0x69, 0x6D, 0x75, 0x6D, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x61, 0x67, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64,
+            0x20, 0x72, 0x61, 0x74, 0x65, 0x2E,
+        0x78, 0x95, 0x05, // Description
+            0x4C, 0x69, 0x6D, 0x69, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x61, 0x74, 0x65, 0x2C, 0x20, 0x69, 0x6E, 0x20,
+            0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x70, 0x65, 0x72, 0x20, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x2C, 0x20, 0x74, 0x68,
+            0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65,
+            0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x73, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20,
+            0x66, 0x72, 0x6F, 0x6D, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x61, 0x6E, 0x64, 0x20,
+            0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x61, 0x67, 0x65, 0x2E, 0x20,
+            0x54, 0x68, 0x65, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20,
+            0x62, 0x79, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20,
+            0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x61, 0x20, 0x68, 0x6F, 0x73,
+            0x74, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x69, 0x74, 0x20, 0x64, 0x6F, 0x65, 0x73, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6E, 0x65,
+            0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x62, 0x65, 0x20, 0x61, 0x64, 0x6A, 0x75, 0x73, 0x74, 0x65, 0x64, 0x20, 0x77, 0x68,
+            0x65, 0x6E, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x2D, 0x6D, 0x61, 0x78, 0x20, 0x69, 0x73, 0x20, 0x63, 0x68,
+            0x61, 0x6E, 0x67, 0x65, 0x64, 0x2E, 0x20, 0x52, 0x65, 0x61, 0x64, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6E, 0x6F, 0x74,
+            0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x2E,
+            0x0A, 0x0A,
+            0x54, 0x68, 0x65, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x73, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x63, 0x68,
+            0x61, 0x6E, 0x67, 0x65, 0x64, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x61, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E,
+            0x64, 0x20, 0x69, 0x73, 0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x62, 0x79, 0x20, 0x77, 0x72, 0x69, 0x74,
+            0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x76,
+            0x61, 0x6C, 0x75, 0x65, 0x2C, 0x20, 0x65, 0x2E, 0x67, 0x2E, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x74, 0x74, 0x6C, 0x65, 0x2D,
+            0x72, 0x65, 0x61, 0x64, 0x3D, 0x35, 0x30, 0x4D, 0x42, 0x2C, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x70, 0x65, 0x72, 0x20, 0x6C,
+            0x69, 0x6E, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x5B, 0x6C, 0x6F, 0x63, 0x6B, 0x2D, 0x70, 0x61, 0x74, 0x68, 0x5D, 0x2F, 0x5B,
+            0x73, 0x74, 0x61, 0x6E, 0x7A, 0x61, 0x5D, 0x2E, 0x74, 0x68, 0x72, 0x6F, 0x74, 0x74, 0x6C, 0x65, 0x2E, 0x20, 0x4C, 0x69,
+            0x6D, 0x69, 0x74, 0x73, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x20, 0x6F, 0x76,
+            0x65, 0x72, 0x72, 0x69, 0x64, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x75, 0x72, 0x65,
+            0x64, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x61, 0x72, 0x65, 0x20, 0x63, 0x68, 0x65,
+            0x63, 0x6B, 0x65, 0x64, 0x20, 0x6F, 0x6E, 0x63, 0x65, 0x20, 0x70, 0x65, 0x72, 0x20, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64,
+            0x2E, 0x20, 0x41, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x6F, 0x66, 0x20, 0x30, 0x20, 0x72, 0x65, 0x6D, 0x6F, 0x76,
+            0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x2E, 0x0A, 0x0A,
+            0x53, 0x69, 0x7A, 0x65, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x65, 0x64, 0x20,
+            0x69, 0x6E, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x28, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x29, 0x20, 0x6F,
+            0x72, 0x20, 0x4B, 0x42, 0x2C, 0x20, 0x4D, 0x42, 0x2C, 0x20, 0x47, 0x42, 0x2C, 0x20, 0x54, 0x42, 0x2C, 0x20, 0x6F, 0x72,
+            0x20, 0x50, 0x42, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70,
+            0x6C, 0x69, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x70, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x31,
+            0x30, 0x32, 0x34, 0x2E,
+
+        // throttle-read-iops option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x07, // Section
+            0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C,
+        0x78, 0x2B, // Summary
+            0x4D, 0x61, 0x78, 0x69, 0x6D, 0x75, 0x6D, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x61, 0x67, 0x65, 0x20, 0x72, 0x65, 0x61, 0x64,
+            0x20, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x70, 0x65, 0x72, 0x20, 0x73, 0x65, 0x63, 0x6F,
+            0x6E, 0x64, 0x2E,
+        0x78, 0xA2, 0x02, // Description
+            0x4C, 0x69, 0x6D, 0x69, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66,
+            0x20, 0x72, 0x65, 0x61, 0x64, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x73, 0x20, 0x70, 0x65, 0x72, 0x20, 0x73,
+            0x65, 0x63, 0x6F, 0x6E, 0x64, 0x20, 0x6D, 0x61, 0x64, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72,
+            0x65, 0x53, 0x51, 0x4C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20,
+            0x73, 0x74, 0x6F, 0x72, 0x61, 0x67, 0x65, 0x2E, 0x20, 0x45, 0x61, 0x63, 0x68, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73,
+            0x74, 0x20, 0x72, 0x65, 0x61, 0x64, 0x73, 0x20, 0x61, 0x74, 0x20, 0x6D, 0x6F, 0x73, 0x74, 0x20, 0x62, 0x75, 0x66, 0x66,
+            0x65, 0x72, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x2C, 0x20, 0x73, 0x6F, 0x20, 0x74, 0x68,
+            0x69, 0x73, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x20, 0x6D, 0x6F, 0x73, 0x74, 0x6C, 0x79, 0x20, 0x61, 0x66, 0x66, 0x65,
+            0x63, 0x74, 0x73, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73,
+            0x6D, 0x61, 0x6C, 0x6C, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x75, 0x66, 0x66,
+            0x65, 0x72, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x73, 0x68, 0x61,
+            0x72, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x63, 0x68, 0x61, 0x6E, 0x67,
+            0x65, 0x64, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x20,
+            0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x77, 0x61, 0x79, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x72, 0x6F,
+            0x74, 0x74, 0x6C, 0x65, 0x2D, 0x72, 0x65, 0x61, 0x64, 0x2E,
+
+        // throttle-write option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x07, // Section
+            0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C,
+        0x78, 0x1B, // Summary
+            0x4D, 0x61, 0x78, 0x69, 0x6D, 0x75, 0x6D, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x61, 0x67, 0x65, 0x20, 0x77, 0x72, 0x69, 0x74,
+            0x65, 0x20, 0x72, 0x61, 0x74, 0x65, 0x2E,
+        0x78, 0xB7, 0x02, // Description
+            0x4C, 0x69, 0x6D, 0x69, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x61, 0x74, 0x65, 0x2C, 0x20, 0x69, 0x6E, 0x20,
+            0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x70, 0x65, 0x72, 0x20, 0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x2C, 0x20, 0x74, 0x68,
+            0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x75, 0x70, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65,
+            0x73, 0x74, 0x6F, 0x72, 0x65, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x73, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65,
+            0x20, 0x74, 0x6F, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67, 0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72,
+            0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x61, 0x67, 0x65, 0x2E, 0x20, 0x54,
+            0x68, 0x65, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x20, 0x69, 0x73, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 0x61,
+            0x6E, 0x64, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x64, 0x20, 0x77, 0x68,
+            0x69, 0x6C, 0x65, 0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73,
+            0x61, 0x6D, 0x65, 0x20, 0x77, 0x61, 0x79, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x74, 0x74, 0x6C, 0x65, 0x2D,
+            0x72, 0x65, 0x61, 0x64, 0x2E, 0x0A, 0x0A,
+            0x53, 0x69, 0x7A, 0x65, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65, 0x20, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x65, 0x64, 0x20,
+            0x69, 0x6E, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x28, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x29, 0x20, 0x6F,
+            0x72, 0x20, 0x4B, 0x42, 0x2C, 0x20, 0x4D, 0x42, 0x2C, 0x20, 0x47, 0x42, 0x2C, 0x20, 0x54, 0x42, 0x2C, 0x20, 0x6F, 0x72,
+            0x20, 0x50, 0x42, 0x20, 0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70,
+            0x6C, 0x69, 0x65, 0x72, 0x20, 0x69, 0x73, 0x20, 0x61, 0x20, 0x70, 0x6F, 0x77, 0x65, 0x72, 0x20, 0x6F, 0x66, 0x20, 0x31,
+            0x30, 0x32, 0x34, 0x2E,
+
+        // throttle-write-iops option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x07, // Section
+            0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x6C,
+        0x78, 0x2C, // Summary
+            0x4D, 0x61, 0x78, 0x69, 0x6D, 0x75, 0x6D, 0x20, 0x73, 0x74, 0x6F, 0x72, 0x61, 0x67, 0x65, 0x20, 0x77, 0x72, 0x69, 0x74,
+            0x65, 0x20, 0x6F, 0x70, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x20, 0x70, 0x65, 0x72, 0x20, 0x73, 0x65, 0x63,
+            0x6F, 0x6E, 0x64, 0x2E,
+        0x78, 0xB0, 0x01, // Description
+            0x4C, 0x69, 0x6D, 0x69, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x6F, 0x66,
+            0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x73, 0x20, 0x70, 0x65, 0x72, 0x20,
+            0x73, 0x65, 0x63, 0x6F, 0x6E, 0x64, 0x20, 0x6D, 0x61, 0x64, 0x65, 0x20, 0x74, 0x6F, 0x20, 0x50, 0x6F, 0x73, 0x74, 0x67,
+            0x72, 0x65, 0x53, 0x51, 0x4C, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x6F, 0x72, 0x79,
+            0x20, 0x73, 0x74, 0x6F, 0x72, 0x61, 0x67, 0x65, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x6C, 0x69, 0x6D, 0x69, 0x74, 0x20,
+            0x69, 0x73, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62, 0x65,
+            0x20, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x64, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69,
+            0x6E, 0x67, 0x20, 0x69, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x61, 0x6D, 0x65, 0x20, 0x77, 0x61, 0x79, 0x20, 0x61,
+            0x73, 0x20, 0x74, 0x68, 0x72, 0x6F, 0x74, 0x74, 0x6C, 0x65, 0x2D, 0x72, 0x65, 0x61, 0x64, 0x2E,
+
+        // tls-server-address option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x06, // Section
+            0x73, 0x65, 0x72, 0x76, 0x65, 0x72,
+        0x78, 0x13, // Summary
+            0x54, 0x4C, 0x53, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x2E,
+        0x78, 0x46, // Description
+            0x49, 0x50, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x20, 0x6F, 0x72, 0x20, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x6E,
+            0x61, 0x6D, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20,
+            0x6C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x20, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74,
+            0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x73, 0x2E,
+
+        // tls-server-auth option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x06, // Section
+            0x73, 0x65, 0x72, 0x76, 0x65, 0x72,
+        0x78, 0x1E, // Summary
+            0x54, 0x4C, 0x53, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x61, 0x75, 0x74, 0x68, 0x6F, 0x72, 0x69, 0x7A, 0x65,
+            0x64, 0x20, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x73, 0x2E,
+        0x78, 0x84, 0x03, // Description
+            0x43, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x75, 0x74, 0x68, 0x6F, 0x72, 0x69, 0x7A,
+            0x65, 0x64, 0x20, 0x6F, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x62, 0x79, 0x20,
+            0x76, 0x65, 0x72, 0x69, 0x66, 0x79, 0x69, 0x6E, 0x67, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x63, 0x65, 0x72, 0x74,
+            0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x69, 0x6E, 0x67,
+            0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x63, 0x65, 0x72, 0x74, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x63,
+            0x6F, 0x6D, 0x6D, 0x6F, 0x6E, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6E, 0x73, 0x74, 0x20, 0x74,
+            0x68, 0x65, 0x20, 0x6C, 0x69, 0x73, 0x74, 0x20, 0x6F, 0x66, 0x20, 0x73, 0x74, 0x61, 0x6E, 0x7A, 0x61, 0x73, 0x20, 0x74,
+            0x68, 0x65, 0x79, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x20, 0x61,
+            0x63, 0x63, 0x65, 0x73, 0x73, 0x2E, 0x20, 0x54, 0x68, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x20, 0x6F, 0x66,
+            0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x69, 0x73, 0x20, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74,
+            0x2D, 0x63, 0x6E, 0x3D, 0x73, 0x74, 0x61, 0x6E, 0x7A, 0x61, 0x31, 0x2C, 0x73, 0x74, 0x61, 0x6E, 0x7A, 0x61, 0x32, 0x20,
+            0x61, 0x6E, 0x64, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x62,
+            0x65, 0x20, 0x72, 0x65, 0x70, 0x65, 0x61, 0x74, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20,
+            0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x2E, 0x20, 0x41, 0x20, 0x73, 0x74, 0x61, 0x6E, 0x7A, 0x61, 0x20, 0x6C, 0x69, 0x73,
+            0x74, 0x20, 0x6F, 0x66, 0x20, 0x2A, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6C,
+            0x69, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x73,
+            0x74, 0x61, 0x6E, 0x7A, 0x61, 0x73, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x69, 0x73, 0x20, 0x72, 0x65, 0x71,
+            0x75, 0x69, 0x72, 0x65, 0x64, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6D, 0x6D, 0x61, 0x6E, 0x64, 0x73, 0x20, 0x74,
+            0x68, 0x61, 0x74, 0x20, 0x64, 0x6F, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x79, 0x20, 0x61,
+            0x20, 0x73, 0x74, 0x61, 0x6E, 0x7A, 0x61, 0x2E,
+
+        // tls-server-ca-file option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x06, // Section
+            0x73, 0x65, 0x72, 0x76, 0x65, 0x72,
+        0x78, 0x23, // Summary
+            0x54, 0x4C, 0x53, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x63, 0x65, 0x72, 0x74, 0x69, 0x66, 0x69, 0x63, 0x61,
+            0x74, 0x65, 0x20, 0x61, 0x75, 0x74, 0x68, 0x6F, 0x72, 0x69, 0x74, 0x69, 0x65, 0x73, 0x2E,
+        0x78, 0x4E, // Description
+            0x43, 0x68, 0x65, 0x63, 0x6B, 0x73, 0x20, 0x74, 0x68, 0x61, 0x74, 0x20, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x20, 0x63,
+            0x65, 0x72, 0x74, 0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x69, 0x67, 0x6E,
+            0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x61, 0x20, 0x74, 0x72, 0x75, 0x73, 0x74, 0x65, 0x64, 0x20, 0x63, 0x65, 0x72, 0x74,
+            0x69, 0x66, 0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x61, 0x75, 0x74, 0x68, 0x6F, 0x72, 0x69, 0x74, 0x79, 0x2E,
+
+        // tls-server-cert-file option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x06, // Section
+            0x73, 0x65, 0x72, 0x76, 0x65, 0x72,
+        0x78, 0x1C, // Summary
+            0x54, 0x4C, 0x53, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x63, 0x65, 0x72, 0x74, 0x69, 0x66, 0x69, 0x63, 0x61,
+            0x74, 0x65, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E,
+        0x78, 0x2F, // Description
+            0x53, 0x65, 0x6E, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x20, 0x74,
+            0x6F, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x69, 0x64,
+            0x65, 0x6E, 0x74, 0x69, 0x74, 0x79, 0x2E,
+
+        // tls-server-key-file option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x06, // Section
+            0x73, 0x65, 0x72, 0x76, 0x65, 0x72,
+        0x78, 0x14, // Summary
+            0x54, 0x4C, 0x53, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x66, 0x69, 0x6C, 0x65, 0x2E,
+        0x78, 0x2C, // Description
+            0x50, 0x72, 0x6F, 0x76, 0x65, 0x73, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x63, 0x65, 0x72, 0x74, 0x69, 0x66,
+            0x69, 0x63, 0x61, 0x74, 0x65, 0x20, 0x77, 0x61, 0x73, 0x20, 0x73, 0x65, 0x6E, 0x74, 0x20, 0x62, 0x79, 0x20, 0x6F, 0x77,
+            0x6E, 0x65, 0x72, 0x2E,
+
+        // tls-server-port option
+        // -------------------------------------------------------------------------------------------------------------------------
+        0x7B, 0x06, // Section
+            0x73, 0x65, 0x72, 0x76, 0x65, 0x72,
+        0x78, 0x10, // Summary
+            0x54, 0x4C, 0x53, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x70, 0x6F, 0x72, 0x74, 0x2E,
+        0x78, 0x33, // Description
+            0x50, 0x6F, 0x72, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x77, 0x69, 0x6C, 0x6C,
+            0x20, 0x6C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x20, 0x6F, 0x6E, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x6C, 0x69, 0x65, 0x6E,
+            0x74, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x73, 0x2E,
+
         // type option
         // -------------------------------------------------------------------------------------------------------------------------
         0x17, // Command overrides begin
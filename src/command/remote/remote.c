@@ -3,17 +3,25 @@ Remote Command
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
+#include <signal.h>
 #include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
 
 #include "command/control/common.h"
 #include "common/debug.h"
+#include "common/fork.h"
 #include "common/io/fdRead.h"
 #include "common/io/fdWrite.h"
 #include "common/log.h"
+#include "common/type/json.h"
 #include "config/config.h"
+#include "config/load.h"
+#include "config/parse.h"
 #include "config/protocol.h"
 #include "db/protocol.h"
 #include "protocol/helper.h"
+#include "protocol/mux.h"
 #include "protocol/server.h"
 #include "storage/remote/protocol.h"
 
@@ -27,6 +35,127 @@ static const ProtocolServerHandler commandRemoteHandlerList[] =
     PROTOCOL_SERVER_HANDLER_STORAGE_REMOTE_LIST
 };
 
+/**********************************************************************************************************************************/
+StringList *
+cmdRemoteParam(const VariantList *const clientParamList, const bool server)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(VARIANT_LIST, clientParamList);
+        FUNCTION_LOG_PARAM(BOOL, server);
+    FUNCTION_LOG_END();
+
+    ASSERT(clientParamList != NULL);
+
+    StringList *const result = strLstNew();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        strLstAdd(result, cfgExe());
+
+        // Add the configuration options used to start this process
+        static const ConfigOption optionConfigList[] = {cfgOptConfig, cfgOptConfigIncludePath, cfgOptConfigPath};
+
+        for (unsigned int optionIdx = 0; optionIdx < sizeof(optionConfigList) / sizeof(ConfigOption); optionIdx++)
+        {
+            const ConfigOption optionId = optionConfigList[optionIdx];
+
+            if (cfgOptionNegate(optionId))
+                strLstAdd(result, strNewFmt("--no-%s", cfgOptionName(optionId)));
+            else if (cfgOptionSource(optionId) != cfgSourceDefault)
+                strLstAdd(result, strNewFmt("--%s=%s", cfgOptionName(optionId), strZ(cfgOptionStr(optionId))));
+        }
+
+        // Add the client options, skipping any that would change the configuration files
+        const unsigned int paramTotal = varLstSize(clientParamList);
+
+        if (paramTotal == 0 || !strEndsWithZ(varStr(varLstGet(clientParamList, paramTotal - 1)), ":" CONFIG_COMMAND_ROLE_REMOTE))
+            THROW(ProtocolError, "server can only start remote commands");
+
+        for (unsigned int paramIdx = 0; paramIdx < paramTotal; paramIdx++)
+        {
+            const String *const param = varStr(varLstGet(clientParamList, paramIdx));
+
+            if (paramIdx < paramTotal - 1)
+            {
+                if (!strBeginsWithZ(param, "--"))
+                    THROW_FMT(ProtocolError, "server expected an option but client sent '%s'", strZ(param));
+
+                // The server only allows options that do not select paths, hosts, or storage since these must be loaded from its
+                // own configuration
+                if (server)
+                {
+                    const int valueIdx = strChr(param, '=');
+                    const CfgParseOptionResult option = cfgParseOptionP(
+                        strSubN(param, 2, (valueIdx == -1 ? strSize(param) : (size_t)valueIdx) - 2));
+
+                    if (!option.found || !protocolServerOptionValid(option.id))
+                        THROW_FMT(ProtocolError, "server does not allow client option '%s'", strZ(param));
+                }
+            }
+
+            if (!strBeginsWithZ(param, "--" CFGOPT_CONFIG) && !strBeginsWithZ(param, "--no-" CFGOPT_CONFIG) &&
+                !strBeginsWithZ(param, "--reset-" CFGOPT_CONFIG))
+            {
+                strLstAdd(result, param);
+            }
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(STRING_LIST, result);
+}
+
+/**********************************************************************************************************************************/
+void
+cmdRemoteProcess(ProtocolServer *const server)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(PROTOCOL_SERVER, server);
+    FUNCTION_LOG_END();
+
+    ASSERT(server != NULL);
+
+    // Acquire a lock if this command needs one.  We'll use the noop that is always sent from the client right after the handshake
+    // to return an error.  We can't take a lock earlier than this because we want the error to go back through the protocol layer.
+    volatile bool success = false;
+
+    TRY_BEGIN()
+    {
+        // Get the command. No need to check parameters since we know this is the first noop.
+        CHECK(protocolServerCommandGet(server).id == PROTOCOL_COMMAND_NOOP);
+
+        // Only try the lock if this is process 0, i.e. the remote started from the main process
+        if (cfgOptionUInt(cfgOptProcess) == 0)
+        {
+            // Acquire a lock if this command requires a lock
+            if (cfgLockRemoteRequired())
+            {
+                // Make sure the local host is not stopped
+                lockStopTest();
+
+                // Acquire the lock
+                lockAcquire(
+                    cfgOptionStr(cfgOptLockPath), cfgOptionStr(cfgOptStanza), cfgOptionStr(cfgOptExecId), cfgLockType(), 0, true);
+            }
+        }
+
+        // Notify the client of success
+        protocolServerDataEndPut(server);
+        success = true;
+    }
+    CATCH_ANY()
+    {
+        protocolServerError(server, errorCode(), STR(errorMessage()), STR(errorStackTrace()));
+    }
+    TRY_END();
+
+    // If not successful we'll just exit
+    if (success)
+        protocolServerProcess(server, NULL, commandRemoteHandlerList, PROTOCOL_SERVER_HANDLER_LIST_SIZE(commandRemoteHandlerList));
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 void
 cmdRemote(int fdRead, int fdWrite)
@@ -36,51 +165,114 @@ cmdRemote(int fdRead, int fdWrite)
     MEM_CONTEXT_TEMP_BEGIN()
     {
         String *name = strNewFmt(PROTOCOL_SERVICE_REMOTE "-%s", strZ(cfgOptionDisplay(cfgOptProcess)));
-        ProtocolServer *server = protocolServerNew(
-            name, PROTOCOL_SERVICE_REMOTE_STR, ioFdReadNewOpen(name, fdRead, cfgOptionUInt64(cfgOptProtocolTimeout)),
-            ioFdWriteNewOpen(name, fdWrite, cfgOptionUInt64(cfgOptProtocolTimeout)));
 
-        // Acquire a lock if this command needs one.  We'll use the noop that is always sent from the client right after the
-        // handshake to return an error.  We can't take a lock earlier than this because we want the error to go back through the
-        // protocol layer.
+        cmdRemoteProcess(
+            protocolServerNew(
+                name, PROTOCOL_SERVICE_REMOTE_STR, ioFdReadNewOpen(name, fdRead, cfgOptionUInt64(cfgOptProtocolTimeout)),
+                ioFdWriteNewOpen(name, fdWrite, cfgOptionUInt64(cfgOptProtocolTimeout))));
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Process a channel opened on the mux. The client sends the options for the remote on the channel and then the remote is started the
+same way as for a TLS server, except that no authorization is required since the client already authenticated via SSH.
+***********************************************************************************************************************************/
+static void
+cmdRemoteMuxChannel(const unsigned int channelId, const int fd)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(UINT, channelId);
+        FUNCTION_LOG_PARAM(INT, fd);
+    FUNCTION_LOG_END();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *const name = strNewFmt(PROTOCOL_SERVICE_REMOTE " mux channel %u", channelId);
+        const TimeMSec timeout = cfgOptionUInt64(cfgOptProtocolTimeout);
+        IoRead *const read = ioFdReadNewOpen(name, fd, timeout);
+        IoWrite *const write = ioFdWriteNewOpen(name, fd, timeout);
+
+        // Read the options sent by the client
+        const VariantList *const clientParamList = jsonToVarLst(ioReadLine(read));
+
+        // Create the protocol server and start the remote if the configuration loads
+        ProtocolServer *const server = protocolServerNew(name, PROTOCOL_SERVICE_REMOTE_STR, read, write);
         volatile bool success = false;
 
         TRY_BEGIN()
         {
-            // Get the command. No need to check parameters since we know this is the first noop.
-            CHECK(protocolServerCommandGet(server).id == PROTOCOL_COMMAND_NOOP);
+            const StringList *const paramList = cmdRemoteParam(clientParamList, false);
 
-            // Only try the lock if this is process 0, i.e. the remote started from the main process
-            if (cfgOptionUInt(cfgOptProcess) == 0)
-            {
-                // Acquire a lock if this command requires a lock
-                if (cfgLockRemoteRequired())
-                {
-                    // Make sure the local host is not stopped
-                    lockStopTest();
-
-                    // Acquire the lock
-                    lockAcquire(
-                        cfgOptionStr(cfgOptLockPath), cfgOptionStr(cfgOptStanza), cfgOptionStr(cfgOptExecId), cfgLockType(), 0,
-                        true);
-                }
-            }
+            cfgLoad(strLstSize(paramList), strLstPtr(paramList));
+            CHECK(cfgCommandRole() == cfgCmdRoleRemote);
 
-            // Notify the client of success
-            protocolServerDataEndPut(server);
             success = true;
         }
         CATCH_ANY()
         {
+            // Return the error in response to the noop that the client sends right after the handshake
+            CHECK(protocolServerCommandGet(server).id == PROTOCOL_COMMAND_NOOP);
             protocolServerError(server, errorCode(), STR(errorMessage()), STR(errorStackTrace()));
         }
         TRY_END();
 
-        // If not successful we'll just exit
         if (success)
+            cmdRemoteProcess(server);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+cmdRemoteMux(const int fdRead, const int fdWrite)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(INT, fdRead);
+        FUNCTION_LOG_PARAM(INT, fdWrite);
+    FUNCTION_LOG_END();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        ProtocolMux *const mux = protocolMuxNew(fdRead, fdWrite, -1, -1);
+
+        // Do not wait for children to exit since each child handles its own errors
+        signal(SIGCHLD, SIG_IGN);
+
+        unsigned int channelId;
+        bool child = false;
+
+        // Fork a child to process each channel opened by the client until the client closes the connection
+        while (!child && (channelId = protocolMuxProcess(mux)) != 0)
         {
-            protocolServerProcess(
-                server, NULL, commandRemoteHandlerList, PROTOCOL_SERVER_HANDLER_LIST_SIZE(commandRemoteHandlerList));
+            int socketPair[2];
+
+            THROW_ON_SYS_ERROR(
+                socketpair(AF_UNIX, SOCK_STREAM, 0, socketPair) == -1, KernelError, "unable to create mux channel socket pair");
+
+            if (forkSafe() == 0)
+            {
+                child = true;
+
+                // Restore the default handler so the child can wait on the processes it starts
+                signal(SIGCHLD, SIG_DFL);
+
+                // Close the sockets of other channels so they see eof when their own processes exit
+                close(socketPair[0]);
+                protocolMuxFree(mux);
+
+                cmdRemoteMuxChannel(channelId, socketPair[1]);
+            }
+            // Else the parent relays the channel
+            else
+            {
+                close(socketPair[1]);
+                protocolMuxChannelAdd(mux, channelId, socketPair[0]);
+            }
         }
     }
     MEM_CONTEXT_TEMP_END();
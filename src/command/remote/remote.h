@@ -4,10 +4,27 @@ Remote Command
 #ifndef COMMAND_REMOTE_REMOTE_H
 #define COMMAND_REMOTE_REMOTE_H
 
+#include "common/type/stringList.h"
+#include "common/type/variantList.h"
+#include "protocol/server.h"
+
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
 // Remote command
 void cmdRemote(int fdRead, int fdWrite);
 
+// Remote command that relays many remotes over a single connection. A remote is started for each channel opened by the client.
+void cmdRemoteMux(int fdRead, int fdWrite);
+
+// Build the argument list used to load the configuration for a remote when the options were sent by the client over a connection
+// rather than on the command line. Options that select the configuration files are ignored since the remote always uses the
+// configuration it was started with. Only remote commands are allowed so all parameters must be options except the last, which must
+// be a command with the remote role. When server is true the client options are limited to those allowed by the server, see
+// protocolServerOptionValid(), and any other option is an error.
+StringList *cmdRemoteParam(const VariantList *clientParamList, bool server);
+
+// Process remote requests on a protocol server that has already been created, e.g. by the server command on a TLS session
+void cmdRemoteProcess(ProtocolServer *server);
+
 #endif
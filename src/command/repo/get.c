@@ -129,12 +129,12 @@ storageGetProcess(IoWrite *destination)
                                 // Find the manifest passphrase
                                 if (!strEq(strLstGet(filePathSplitLst, 2), STRDEF(BACKUP_PATH_HISTORY)) &&
                                     !strEndsWithZ(file, BACKUP_MANIFEST_FILE) &&
-                                    !strEndsWithZ(file, BACKUP_MANIFEST_FILE INFO_COPY_EXT))
+                                    !strEndsWithZ(file, BACKUP_MANIFEST_FILE INFO_COPY_EXT) &&
+                                    !strEndsWithZ(file, BACKUP_MANIFEST_FILE BACKUP_MANIFEST_PACK_EXT))
                                 {
-                                    const Manifest *manifest = manifestLoadFile(
+                                    cipherPass = manifestCipherSubPassLoadFile(
                                         storageRepo(), strNewFmt(STORAGE_PATH_BACKUP "/%s/%s/%s", strZ(stanza),
                                         strZ(strLstGet(filePathSplitLst, 2)), BACKUP_MANIFEST_FILE), repoCipherType, cipherPass);
-                                    cipherPass = manifestCipherSubPass(manifest);
                                 }
                             }
                         }
@@ -7,6 +7,8 @@ Restore File
 #include <unistd.h>
 #include <utime.h>
 
+#include "command/backup/blockMap.h"
+#include "command/backup/common.h"
 #include "command/restore/file.h"
 #include "common/crypto/cipherBlock.h"
 #include "common/crypto/hash.h"
@@ -18,12 +20,132 @@ Restore File
 #include "config/config.h"
 #include "storage/helper.h"
 
+/***********************************************************************************************************************************
+Reassemble a block incremental file from blocks stored in the backup and prior backups
+***********************************************************************************************************************************/
+static void
+restoreFileBlockIncr(
+    IoWrite *const write, const String *const repoFile, const unsigned int repoIdx, const String *const repoFileReference,
+    const CompressType repoFileCompressType, const uint64_t blockIncrSize, const uint64_t pgFileSize,
+    const String *const cipherPass)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(IO_WRITE, write);
+        FUNCTION_LOG_PARAM(STRING, repoFile);
+        FUNCTION_LOG_PARAM(UINT, repoIdx);
+        FUNCTION_LOG_PARAM(STRING, repoFileReference);
+        FUNCTION_LOG_PARAM(ENUM, repoFileCompressType);
+        FUNCTION_LOG_PARAM(UINT64, blockIncrSize);
+        FUNCTION_LOG_PARAM(UINT64, pgFileSize);
+        FUNCTION_TEST_PARAM(STRING, cipherPass);
+    FUNCTION_LOG_END();
+
+    ASSERT(write != NULL);
+    ASSERT(blockIncrSize > 0);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Load the block map from the backup where the file was last copied
+        const BlockMap *const blockMap = blockMapLoad(
+            storageRepoIdx(repoIdx), blockMapPath(repoFileReference, repoFile, repoFileCompressType), repoFileCompressType,
+            cipherPass);
+
+        // The map must contain all the blocks in the file
+        const uint64_t blockTotal = (pgFileSize + blockIncrSize - 1) / blockIncrSize;
+
+        if (blockMapSize(blockMap) != blockTotal)
+        {
+            THROW_FMT(
+                FormatError, "block map for '%s' has %u block(s) but %" PRIu64 " expected", strZ(repoFile), blockMapSize(blockMap),
+                blockTotal);
+        }
+
+        // Repo files are opened when first referenced and then read sequentially since blocks are stored in order
+        const unsigned int referenceTotal = blockMapReferenceTotal(blockMap);
+        IoRead **const readList = memNew(sizeof(IoRead *) * referenceTotal);
+        uint64_t *const slotList = memNew(sizeof(uint64_t) * referenceTotal);
+        Buffer *const block = bufNew((size_t)blockIncrSize);
+
+        for (unsigned int referenceIdx = 0; referenceIdx < referenceTotal; referenceIdx++)
+        {
+            readList[referenceIdx] = NULL;
+            slotList[referenceIdx] = 0;
+        }
+
+        ioWriteOpen(write);
+
+        for (unsigned int blockIdx = 0; blockIdx < blockMapSize(blockMap); blockIdx++)
+        {
+            const BlockMapItem *const blockMapItem = blockMapGet(blockMap, blockIdx);
+            const String *const reference = blockMapReference(blockMap, blockMapItem->reference);
+
+            // Open the repo file that contains the block
+            if (readList[blockMapItem->reference] == NULL)
+            {
+                IoRead *const read = storageReadIo(
+                    storageNewReadP(
+                        storageRepoIdx(repoIdx),
+                        strNewFmt(
+                            STORAGE_REPO_BACKUP "/%s/%s%s", strZ(reference), strZ(repoFile),
+                            strZ(compressExtStr(repoFileCompressType)))));
+
+                if (cipherPass != NULL)
+                {
+                    ioFilterGroupAdd(
+                        ioReadFilterGroup(read), cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTR(cipherPass), NULL));
+                }
+
+                if (repoFileCompressType != compressTypeNone)
+                    ioFilterGroupAdd(ioReadFilterGroup(read), decompressFilterP(repoFileCompressType));
+
+                ioReadOpen(read);
+                readList[blockMapItem->reference] = read;
+            }
+
+            IoRead *const read = readList[blockMapItem->reference];
+
+            // Skip blocks that were replaced in later backups. These are never the last block in the repo file so they are always
+            // a full block.
+            while (slotList[blockMapItem->reference] < blockMapItem->slot)
+            {
+                bufUsedZero(block);
+
+                if (ioRead(read, block) != blockIncrSize)
+                    THROW_FMT(FileReadError, "unable to skip block in '%s/%s'", strZ(reference), strZ(repoFile));
+
+                slotList[blockMapItem->reference]++;
+            }
+
+            // Copy the block. Only the last block in the file can be smaller than the block size.
+            const size_t blockSize =
+                blockIdx == blockTotal - 1 ? (size_t)(pgFileSize - blockIdx * blockIncrSize) : (size_t)blockIncrSize;
+
+            bufUsedZero(block);
+            bufLimitSet(block, blockSize);
+
+            if (ioRead(read, block) != blockSize)
+                THROW_FMT(FileReadError, "unable to read block %u from '%s/%s'", blockIdx, strZ(reference), strZ(repoFile));
+
+            bufLimitClear(block);
+            ioWrite(write, block);
+
+            slotList[blockMapItem->reference]++;
+        }
+
+        ioWriteClose(write);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 bool
 restoreFile(
     const String *repoFile, unsigned int repoIdx, const String *repoFileReference, CompressType repoFileCompressType,
-    const String *pgFile, const String *pgFileChecksum, bool pgFileZero, uint64_t pgFileSize, time_t pgFileModified,
-    mode_t pgFileMode, const String *pgFileUser, const String *pgFileGroup, time_t copyTimeBegin, bool delta, bool deltaForce,
+    uint64_t repoFileBundleId, uint64_t repoFileBundleOffset, uint64_t repoFileSize, uint64_t blockIncrSize, const String *pgFile,
+    const String *pgFileChecksum, bool pgFileZero, uint64_t pgFileSize, time_t pgFileModified, mode_t pgFileMode,
+    const String *pgFileUser, const String *pgFileGroup, time_t copyTimeBegin, bool delta, bool deltaForce,
     const String *cipherPass)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
@@ -31,6 +153,10 @@ restoreFile(
         FUNCTION_LOG_PARAM(UINT, repoIdx);
         FUNCTION_LOG_PARAM(STRING, repoFileReference);
         FUNCTION_LOG_PARAM(ENUM, repoFileCompressType);
+        FUNCTION_LOG_PARAM(UINT64, repoFileBundleId);
+        FUNCTION_LOG_PARAM(UINT64, repoFileBundleOffset);
+        FUNCTION_LOG_PARAM(UINT64, repoFileSize);
+        FUNCTION_LOG_PARAM(UINT64, blockIncrSize);
         FUNCTION_LOG_PARAM(STRING, pgFile);
         FUNCTION_LOG_PARAM(STRING, pgFileChecksum);
         FUNCTION_LOG_PARAM(BOOL, pgFileZero);
@@ -47,6 +173,7 @@ restoreFile(
 
     ASSERT(repoFile != NULL);
     ASSERT(repoFileReference != NULL);
+    ASSERT(repoFileBundleId == 0 || blockIncrSize == 0);
     ASSERT(pgFile != NULL);
 
     // Was the file copied?
@@ -55,6 +182,13 @@ restoreFile(
     // Is the file compressible during the copy?
     bool compressible = true;
 
+    // Does the file exist in the pg data directory so a delta can be written?
+    bool pgFileExists = false;
+
+    // Does the file match the backup if the delta write skips every page? The file is not hashed before the copy since the delta
+    // write would have to read it again whenever it does not match.
+    bool pgFileMatch = false;
+
     MEM_CONTEXT_TEMP_BEGIN()
     {
         // Perform delta if requested.  Delta zero-length files to avoid overwriting the file if the timestamp is correct.
@@ -65,6 +199,8 @@ restoreFile(
 
             if (info.exists)
             {
+                pgFileExists = true;
+
                 // If force then use size/timestamp delta
                 if (deltaForce)
                 {
@@ -73,40 +209,26 @@ restoreFile(
                         result = false;
                 }
                 // Else use size and checksum
-                else
+                else if (info.size == pgFileSize)
                 {
-                    // Only continue delta if the file size is as expected
-                    if (info.size == pgFileSize)
+                    // No need to copy a zero-length file but set the time back to backup time. This helps with unit testing, but
+                    // also presents a pristine version of the database after restore.
+                    if (pgFileSize == 0)
                     {
-                        // Generate checksum for the file if size is not zero
-                        IoRead *read = NULL;
-
-                        if (info.size != 0)
+                        if (info.timeModified != pgFileModified)
                         {
-                            read = storageReadIo(storageNewReadP(storagePgWrite(), pgFile));
-                            ioFilterGroupAdd(ioReadFilterGroup(read), cryptoHashNew(HASH_TYPE_SHA1_STR));
-                            ioReadDrain(read);
+                            THROW_ON_SYS_ERROR_FMT(
+                                utime(
+                                    strZ(storagePathP(storagePg(), pgFile)),
+                                    &((struct utimbuf){.actime = pgFileModified, .modtime = pgFileModified})) == -1,
+                                FileInfoError, "unable to set time for '%s'", strZ(storagePathP(storagePg(), pgFile)));
                         }
 
-                        // If size and checksum are equal then no need to copy the file
-                        if (pgFileSize == 0 ||
-                            strEq(
-                                pgFileChecksum, varStr(ioFilterGroupResult(ioReadFilterGroup(read), CRYPTO_HASH_FILTER_TYPE_STR))))
-                        {
-                            // Even if hash/size are the same set the time back to backup time.  This helps with unit testing, but
-                            // also presents a pristine version of the database after restore.
-                            if (info.timeModified != pgFileModified)
-                            {
-                                THROW_ON_SYS_ERROR_FMT(
-                                    utime(
-                                        strZ(storagePathP(storagePg(), pgFile)),
-                                        &((struct utimbuf){.actime = pgFileModified, .modtime = pgFileModified})) == -1,
-                                    FileInfoError, "unable to set time for '%s'", strZ(storagePathP(storagePg(), pgFile)));
-                            }
-
-                            result = false;
-                        }
+                        result = false;
                     }
+                    // Else the delta write compares the file with the backup
+                    else
+                        pgFileMatch = true;
                 }
             }
         }
@@ -114,13 +236,19 @@ restoreFile(
         // Copy file from repository to database or create zero-length/sparse file
         if (result)
         {
-            // Create destination file
+            // Create destination file. When the file is copied, blocks of zeroes are skipped rather than written and space for the
+            // entire file is preallocated so the file is not fragmented and the skipped blocks do not need to be allocated later.
+            // If the file already exists for a delta then only pages that differ from the backup are written, so a file that has
+            // drifted by a few pages is not rewritten in full.
+            const bool copy = pgFileSize != 0 && !pgFileZero;
+
             StorageWrite *pgFileWrite = storageNewWriteP(
                 storagePgWrite(), pgFile, .modeFile = pgFileMode, .user = pgFileUser, .group = pgFileGroup,
-                .timeModified = pgFileModified, .noAtomic = true, .noCreatePath = true, .noSyncPath = true);
+                .timeModified = pgFileModified, .noAtomic = true, .noCreatePath = true, .noSyncPath = true, .sparse = copy,
+                .delta = copy && pgFileExists, .preallocate = copy ? pgFileSize : 0);
 
             // If size is zero/sparse no need to actually copy
-            if (pgFileSize == 0 || pgFileZero)
+            if (!copy)
             {
                 ioWriteOpen(storageWriteIo(pgFileWrite));
 
@@ -142,17 +270,17 @@ restoreFile(
             {
                 IoFilterGroup *filterGroup = ioWriteFilterGroup(storageWriteIo(pgFileWrite));
 
-                // Add decryption filter
-                if (cipherPass != NULL)
+                // Add decryption filter. Block incremental files are decrypted as each repo file is read.
+                if (cipherPass != NULL && blockIncrSize == 0)
                 {
                     ioFilterGroupAdd(filterGroup, cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTR(cipherPass), NULL));
                     compressible = false;
                 }
 
-                // Add decompression filter
-                if (repoFileCompressType != compressTypeNone)
+                // Add decompression filter. Block incremental files are decompressed as each repo file is read.
+                if (repoFileCompressType != compressTypeNone && blockIncrSize == 0)
                 {
-                    ioFilterGroupAdd(filterGroup, decompressFilter(repoFileCompressType));
+                    ioFilterGroupAdd(filterGroup, decompressFilterP(repoFileCompressType));
                     compressible = false;
                 }
 
@@ -162,15 +290,36 @@ restoreFile(
                 // Add size filter
                 ioFilterGroupAdd(filterGroup, ioSizeNew());
 
-                // Copy file
-                storageCopyP(
-                    storageNewReadP(
-                        storageRepoIdx(repoIdx),
-                        strNewFmt(
-                            STORAGE_REPO_BACKUP "/%s/%s%s", strZ(repoFileReference), strZ(repoFile),
-                            strZ(compressExtStr(repoFileCompressType))),
-                        .compressible = compressible),
-                    pgFileWrite);
+                // Copy file. Bundled files are read from their offset in the bundle.
+                if (repoFileBundleId != 0)
+                {
+                    storageCopyP(
+                        storageNewReadP(
+                            storageRepoIdx(repoIdx),
+                            strNewFmt(
+                                STORAGE_REPO_BACKUP "/%s/" BACKUP_PATH_BUNDLE "/%" PRIu64, strZ(repoFileReference),
+                                repoFileBundleId),
+                            .compressible = compressible, .offset = repoFileBundleOffset, .limit = VARUINT64(repoFileSize)),
+                        pgFileWrite);
+                }
+                else if (blockIncrSize == 0)
+                {
+                    storageCopyP(
+                        storageNewReadP(
+                            storageRepoIdx(repoIdx),
+                            strNewFmt(
+                                STORAGE_REPO_BACKUP "/%s/%s%s", strZ(repoFileReference), strZ(repoFile),
+                                strZ(compressExtStr(repoFileCompressType))),
+                            .compressible = compressible),
+                        pgFileWrite);
+                }
+                // Else reassemble the file from blocks
+                else
+                {
+                    restoreFileBlockIncr(
+                        storageWriteIo(pgFileWrite), repoFile, repoIdx, repoFileReference, repoFileCompressType, blockIncrSize,
+                        pgFileSize, cipherPass);
+                }
 
                 // Validate checksum
                 if (!strEq(pgFileChecksum, varStr(ioFilterGroupResult(filterGroup, CRYPTO_HASH_FILTER_TYPE_STR))))
@@ -180,6 +329,10 @@ restoreFile(
                         "error restoring '%s': actual checksum '%s' does not match expected checksum '%s'", strZ(pgFile),
                         strZ(varStr(ioFilterGroupResult(filterGroup, CRYPTO_HASH_FILTER_TYPE_STR))), strZ(pgFileChecksum));
                 }
+
+                // The file was not copied when size and checksum matched and no pages were written
+                if (pgFileMatch && storageWriteDeltaMatch(pgFileWrite))
+                    result = false;
             }
         }
     }
@@ -31,6 +31,10 @@ restoreFileProtocol(PackRead *const param, ProtocolServer *const server)
         const unsigned int repoIdx = pckReadU32P(param);
         const String *const repoFileReference = pckReadStrP(param);
         const CompressType repoFileCompressType = (CompressType)pckReadU32P(param);
+        const uint64_t repoFileBundleId = pckReadU64P(param);
+        const uint64_t repoFileBundleOffset = pckReadU64P(param);
+        const uint64_t repoFileSize = pckReadU64P(param);
+        const uint64_t blockIncrSize = pckReadU64P(param);
         const String *const pgFile = pckReadStrP(param);
         const String *const pgFileChecksum = pckReadStrP(param);
         const bool pgFileZero = pckReadBoolP(param);
@@ -45,8 +49,9 @@ restoreFileProtocol(PackRead *const param, ProtocolServer *const server)
         const String *const cipherPass = pckReadStrP(param);
 
         const bool result = restoreFile(
-            repoFile, repoIdx, repoFileReference, repoFileCompressType, pgFile, pgFileChecksum, pgFileZero, pgFileSize,
-            pgFileModified, pgFileMode, pgFileUser, pgFileGroup, copyTimeBegin, delta, deltaForce, cipherPass);
+            repoFile, repoIdx, repoFileReference, repoFileCompressType, repoFileBundleId, repoFileBundleOffset, repoFileSize,
+            blockIncrSize, pgFile, pgFileChecksum, pgFileZero, pgFileSize, pgFileModified, pgFileMode, pgFileUser, pgFileGroup,
+            copyTimeBegin, delta, deltaForce, cipherPass);
 
         // Return result
         protocolServerDataPut(server, pckWriteBoolP(protocolPackNew(), result));
@@ -2144,6 +2144,10 @@ static ProtocolParallelJob *restoreJobCallback(void *data, unsigned int clientId
                 pckWriteU32P(param, jobData->repoIdx);
                 pckWriteStrP(param, file->reference != NULL ? file->reference : manifestData(jobData->manifest)->backupLabel);
                 pckWriteU32P(param, manifestData(jobData->manifest)->backupOptionCompressType);
+                pckWriteU64P(param, file->bundleId);
+                pckWriteU64P(param, file->bundleOffset);
+                pckWriteU64P(param, file->sizeRepo);
+                pckWriteU64P(param, file->blockIncrSize);
                 pckWriteStrP(param, restoreFilePgPath(jobData->manifest, file->name));
                 pckWriteStrP(param, STR(file->checksumSha1));
                 pckWriteBoolP(param, restoreFileZeroed(file->name, jobData->zeroExp));
@@ -2249,7 +2253,7 @@ cmdRestore(void)
 
         // Create the parallel executor
         ProtocolParallel *parallelExec = protocolParallelNew(
-            cfgOptionUInt64(cfgOptProtocolTimeout) / 2, restoreJobCallback, &jobData);
+            cfgOptionUInt64(cfgOptProtocolTimeout) / 2, cfgOptionUInt(cfgOptJobQueueMax), restoreJobCallback, &jobData);
 
         for (unsigned int processIdx = 1; processIdx <= cfgOptionUInt(cfgOptProcessMax); processIdx++)
             protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypeRepo, 0, processIdx));
@@ -0,0 +1,157 @@
+/***********************************************************************************************************************************
+Server Command
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <signal.h>
+
+#include "command/remote/remote.h"
+#include "command/server/server.h"
+#include "common/debug.h"
+#include "common/fork.h"
+#include "common/io/socket/server.h"
+#include "common/io/tls/server.h"
+#include "common/log.h"
+#include "common/type/json.h"
+#include "config/config.h"
+#include "config/load.h"
+#include "protocol/helper.h"
+#include "protocol/server.h"
+
+/***********************************************************************************************************************************
+Authorized stanza that allows access to all stanzas
+***********************************************************************************************************************************/
+#define SERVER_AUTH_ALL                                             "*"
+
+/***********************************************************************************************************************************
+Load the configuration requested by the client and check that the client is authorized. Errors are returned to the client.
+***********************************************************************************************************************************/
+static bool
+cmdServerConfig(
+    ProtocolServer *const server, const VariantList *const clientParamList, const String *const peerName,
+    const StringList *const stanzaList)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(PROTOCOL_SERVER, server);
+        FUNCTION_LOG_PARAM(VARIANT_LIST, clientParamList);
+        FUNCTION_LOG_PARAM(STRING, peerName);
+        FUNCTION_LOG_PARAM(STRING_LIST, stanzaList);
+    FUNCTION_LOG_END();
+
+    ASSERT(server != NULL);
+    ASSERT(clientParamList != NULL);
+    ASSERT(peerName != NULL);
+
+    volatile bool result = false;
+
+    TRY_BEGIN()
+    {
+        const StringList *const paramList = cmdRemoteParam(clientParamList, true);
+
+        cfgLoad(strLstSize(paramList), strLstPtr(paramList));
+        CHECK(cfgCommandRole() == cfgCmdRoleRemote);
+
+        // The client must be authorized for the stanza or all stanzas. Commands without a stanza require access to all stanzas.
+        if (stanzaList == NULL ||
+            (!strLstExists(stanzaList, STRDEF(SERVER_AUTH_ALL)) &&
+             (!cfgOptionTest(cfgOptStanza) || !strLstExists(stanzaList, cfgOptionStr(cfgOptStanza)))))
+        {
+            THROW_FMT(
+                ProtocolError, "access denied to %s for client '%s'",
+                cfgOptionTest(cfgOptStanza) ? strZ(strNewFmt("stanza '%s'", strZ(cfgOptionStr(cfgOptStanza)))) : "all stanzas",
+                strZ(peerName));
+        }
+
+        result = true;
+    }
+    CATCH_ANY()
+    {
+        // Return the error in response to the noop that the client sends right after the handshake
+        CHECK(protocolServerCommandGet(server).id == PROTOCOL_COMMAND_NOOP);
+        protocolServerError(server, errorCode(), STR(errorMessage()), STR(errorStackTrace()));
+    }
+    TRY_END();
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
+
+/**********************************************************************************************************************************/
+void
+cmdServer(const unsigned int connectionMax)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(UINT, connectionMax);
+    FUNCTION_LOG_END();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const TimeMSec timeout = cfgOptionUInt64(cfgOptProtocolTimeout);
+        IoServer *const tlsServer = tlsServerNew(
+            cfgOptionStr(cfgOptTlsServerAddress), cfgOptionStr(cfgOptTlsServerCaFile), cfgOptionStr(cfgOptTlsServerKeyFile),
+            cfgOptionStr(cfgOptTlsServerCertFile), timeout);
+        IoServer *const socketServer = sckServerNew(
+            cfgOptionStr(cfgOptTlsServerAddress), cfgOptionUInt(cfgOptTlsServerPort), timeout);
+
+        // Do not wait for children to exit since each child handles its own errors
+        signal(SIGCHLD, SIG_IGN);
+
+        LOG_INFO_FMT("listening on %s", strZ(ioServerName(socketServer)));
+
+        unsigned int connectionTotal = 0;
+        bool child = false;
+
+        do
+        {
+            // Accept a new connection
+            IoSession *const socketSession = ioServerAccept(socketServer, NULL);
+
+            // Fork a child to process the connection
+            if (forkSafe() == 0)
+            {
+                child = true;
+
+                // Restore the default handler so the child can wait on the processes it starts
+                signal(SIGCHLD, SIG_DFL);
+
+                // The child will not accept new connections
+                ioServerFree(socketServer);
+
+                // Negotiate TLS and get the list of stanzas the client is authorized to access
+                IoSession *const tlsSession = ioServerAccept(tlsServer, socketSession);
+                StringList *stanzaList = NULL;
+
+                ASSERT(ioSessionAuthenticated(tlsSession));
+
+                if (cfgOptionTest(cfgOptTlsServerAuth))
+                {
+                    const Variant *const stanzaListVar = kvGet(
+                        cfgOptionKv(cfgOptTlsServerAuth), VARSTR(ioSessionPeerName(tlsSession)));
+
+                    if (stanzaListVar != NULL)
+                        stanzaList = strLstNewSplitZ(varStr(stanzaListVar), ",");
+                }
+
+                // Read the options sent by the client
+                const VariantList *const clientParamList = jsonToVarLst(ioReadLine(ioSessionIoRead(tlsSession)));
+
+                // Create the protocol server and start the remote if the configuration loads and the client is authorized
+                ProtocolServer *const server = protocolServerNew(
+                    strNewFmt(PROTOCOL_SERVICE_REMOTE " server on '%s'", strZ(ioSessionPeerName(tlsSession))),
+                    PROTOCOL_SERVICE_REMOTE_STR, ioSessionIoRead(tlsSession), ioSessionIoWrite(tlsSession));
+
+                if (cmdServerConfig(server, clientParamList, ioSessionPeerName(tlsSession), stanzaList))
+                    cmdRemoteProcess(server);
+            }
+            // Else the parent closes its copy of the session and waits for the next connection
+            else
+            {
+                ioSessionFree(socketSession);
+                connectionTotal++;
+            }
+        }
+        while (!child && (connectionMax == 0 || connectionTotal < connectionMax));
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
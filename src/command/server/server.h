@@ -0,0 +1,14 @@
+/***********************************************************************************************************************************
+Server Command
+***********************************************************************************************************************************/
+#ifndef COMMAND_SERVER_SERVER_H
+#define COMMAND_SERVER_SERVER_H
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Accept connections from TLS clients and process remote requests. Runs until connectionMax connections have been accepted (0 means
+// unlimited, which is the only value used outside of testing).
+void cmdServer(unsigned int connectionMax);
+
+#endif
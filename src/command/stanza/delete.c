@@ -40,6 +40,9 @@ manifestDelete(const Storage *storageRepoWriteStanza)
     // Delete all manifest files
     for (unsigned int idx = 0; idx < strLstSize(backupList); idx++)
     {
+        storageRemoveP(
+            storageRepoWriteStanza,
+            strNewFmt(STORAGE_REPO_BACKUP "/%s/" BACKUP_MANIFEST_FILE BACKUP_MANIFEST_PACK_EXT, strZ(strLstGet(backupList, idx))));
         storageRemoveP(
             storageRepoWriteStanza, strNewFmt(STORAGE_REPO_BACKUP "/%s/" BACKUP_MANIFEST_FILE, strZ(strLstGet(backupList, idx))));
         storageRemoveP(
@@ -3,6 +3,8 @@ Verify File
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
+#include "command/archive/common.h"
+#include "command/backup/blockMap.h"
 #include "command/verify/file.h"
 #include "common/crypto/cipherBlock.h"
 #include "common/crypto/hash.h"
@@ -14,15 +16,116 @@ Verify File
 #include "common/log.h"
 #include "storage/helper.h"
 
+/***********************************************************************************************************************************
+Verify the blocks stored in a block incremental repo file. The repo file does not contain the entire file when blocks are stored in
+prior backups so each block is verified against the checksum in the block map.
+***********************************************************************************************************************************/
+static VerifyResult
+verifyFileBlockIncr(
+    const String *const filePathName, const uint64_t fileSize, const uint64_t blockIncrSize, const String *const cipherPass)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, filePathName);
+        FUNCTION_LOG_PARAM(UINT64, fileSize);
+        FUNCTION_LOG_PARAM(UINT64, blockIncrSize);
+        FUNCTION_TEST_PARAM(STRING, cipherPass);
+    FUNCTION_LOG_END();
+
+    ASSERT(filePathName != NULL);
+    ASSERT(blockIncrSize > 0);
+
+    VerifyResult result = verifyOk;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const CompressType compressType = compressTypeFromName(filePathName);
+        const String *const mapPathName = strNewFmt(
+            "%s" BLOCK_MAP_EXT "%s", strZ(compressExtStrip(filePathName, compressType)), strZ(compressExtStr(compressType)));
+
+        // Prepare the file for reading
+        IoRead *const read = storageReadIo(storageNewReadP(storageRepo(), filePathName, .ignoreMissing = true));
+
+        if (cipherPass != NULL)
+        {
+            ioFilterGroupAdd(
+                ioReadFilterGroup(read), cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTR(cipherPass), NULL));
+        }
+
+        if (compressType != compressTypeNone)
+            ioFilterGroupAdd(ioReadFilterGroup(read), decompressFilterP(compressType));
+
+        // If the file and map exist then check each block stored in the file
+        if (ioReadOpen(read) && storageExistsP(storageRepo(), mapPathName))
+        {
+            const BlockMap *const blockMap = blockMapLoad(storageRepo(), mapPathName, compressType, cipherPass);
+            Buffer *const block = bufNew((size_t)blockIncrSize);
+            uint64_t slot = 0;
+
+            // Blocks stored in this file always belong to the first reference in the map
+            for (unsigned int blockIdx = 0; blockIdx < blockMapSize(blockMap); blockIdx++)
+            {
+                const BlockMapItem *const blockMapItem = blockMapGet(blockMap, blockIdx);
+
+                if (blockMapItem->reference != 0)
+                    continue;
+
+                // Only the last block in the file can be smaller than the block size
+                const size_t blockSize =
+                    blockIdx == blockMapSize(blockMap) - 1 ?
+                        (size_t)(fileSize - (uint64_t)blockIdx * blockIncrSize) : (size_t)blockIncrSize;
+
+                bufUsedZero(block);
+                bufLimitSet(block, blockSize);
+
+                if (blockMapItem->slot != slot || ioRead(read, block) != blockSize)
+                {
+                    result = verifySizeInvalid;
+                    break;
+                }
+
+                if (!bufEq(cryptoHashOne(HASH_TYPE_SHA1_STR, block), BUF(blockMapItem->checksum, HASH_TYPE_SHA1_SIZE)))
+                {
+                    result = verifyChecksumMismatch;
+                    break;
+                }
+
+                slot++;
+            }
+
+            // There should be no data left in the file
+            if (result == verifyOk)
+            {
+                bufUsedZero(block);
+                bufLimitClear(block);
+
+                if (ioRead(read, block) != 0)
+                    result = verifySizeInvalid;
+            }
+
+            ioReadClose(read);
+        }
+        else
+            result = verifyFileMissing;
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(ENUM, result);
+}
+
 /**********************************************************************************************************************************/
 VerifyResult
 verifyFile(
-    const String *filePathName, const String *fileChecksum, uint64_t fileSize, const String *cipherPass)
+    const String *filePathName, uint64_t offset, const Variant *limit, CompressType compressType, const String *fileChecksum,
+    uint64_t fileSize, uint64_t blockIncrSize, const String *cipherPass)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING, filePathName);                   // Fully qualified file name
+        FUNCTION_LOG_PARAM(UINT64, offset);                         // Offset to read in file
+        FUNCTION_LOG_PARAM(VARIANT, limit);                         // Limit to read from file
+        FUNCTION_LOG_PARAM(ENUM, compressType);                     // Compression type
         FUNCTION_LOG_PARAM(STRING, fileChecksum);                   // Checksum for the file
         FUNCTION_LOG_PARAM(UINT64, fileSize);                       // Size of file
+        FUNCTION_LOG_PARAM(UINT64, blockIncrSize);                  // Block size for block incremental (0 if not block incr)
         FUNCTION_TEST_PARAM(STRING, cipherPass);                    // Password to access the repo file if encrypted
     FUNCTION_LOG_END();
 
@@ -32,45 +135,74 @@ verifyFile(
     // Is the file valid?
     VerifyResult result = verifyOk;
 
-    MEM_CONTEXT_TEMP_BEGIN()
+    // Block incremental files are verified block by block
+    if (blockIncrSize != 0)
+        result = verifyFileBlockIncr(filePathName, fileSize, blockIncrSize, cipherPass);
+    // Else verify the checksum and size of the entire file
+    else
     {
-        // Prepare the file for reading
-        IoRead *read = storageReadIo(storageNewReadP(storageRepo(), filePathName, .ignoreMissing = true));
-        IoFilterGroup *filterGroup = ioReadFilterGroup(read);
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            // Prepare the file for reading
+            IoRead *read = storageReadIo(
+                storageNewReadP(storageRepo(), filePathName, .ignoreMissing = true, .offset = offset, .limit = limit));
+            IoFilterGroup *filterGroup = ioReadFilterGroup(read);
 
-        // Add decryption filter
-        if (cipherPass != NULL)
-            ioFilterGroupAdd(filterGroup, cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTR(cipherPass), NULL));
+            // Add decryption filter
+            if (cipherPass != NULL)
+                ioFilterGroupAdd(filterGroup, cipherBlockNew(cipherModeDecrypt, cipherTypeAes256Cbc, BUFSTR(cipherPass), NULL));
+
+            // Add decompression filter. WAL may be compressed with a dictionary stored in the archive id path, which is two levels
+            // up from the WAL segment.
+            if (compressType != compressTypeNone)
+            {
+                ArchiveDictLoadData *dictLoadData = NULL;
 
-        // Add decompression filter
-        if (compressTypeFromName(filePathName) != compressTypeNone)
-            ioFilterGroupAdd(filterGroup, decompressFilter(compressTypeFromName(filePathName)));
+                if (strBeginsWithZ(filePathName, STORAGE_REPO_ARCHIVE "/"))
+                {
+                    dictLoadData = memNew(sizeof(ArchiveDictLoadData));
 
-        // Add sha1 filter
-        ioFilterGroupAdd(filterGroup, cryptoHashNew(HASH_TYPE_SHA1_STR));
+                    *dictLoadData = (ArchiveDictLoadData)
+                    {
+                        .storage = storageRepo(),
+                        .archivePath = strPath(strPath(filePathName)),
+                        .cipherType = cipherPass != NULL ? cipherTypeAes256Cbc : cipherTypeNone,
+                        .cipherPass = cipherPass,
+                    };
+                }
 
-        // Add size filter
-        ioFilterGroupAdd(filterGroup, ioSizeNew());
+                ioFilterGroupAdd(
+                    filterGroup,
+                    decompressFilterP(
+                        compressType, .dictLoad = dictLoadData != NULL ? archiveDictLoad : NULL, .dictLoadData = dictLoadData));
+            }
 
-        // Add IoSink so the file data is not transmitted from the remote
-        ioFilterGroupAdd(filterGroup, ioSinkNew());
+            // Add sha1 filter
+            ioFilterGroupAdd(filterGroup, cryptoHashNew(HASH_TYPE_SHA1_STR));
 
-        // If the file exists check the checksum/size
-        if (ioReadDrain(read))
-        {
-            // Validate checksum
-            if (!strEq(fileChecksum, varStr(ioFilterGroupResult(filterGroup, CRYPTO_HASH_FILTER_TYPE_STR))))
+            // Add size filter
+            ioFilterGroupAdd(filterGroup, ioSizeNew());
+
+            // Add IoSink so the file data is not transmitted from the remote
+            ioFilterGroupAdd(filterGroup, ioSinkNew());
+
+            // If the file exists check the checksum/size
+            if (ioReadDrain(read))
             {
-                result = verifyChecksumMismatch;
+                // Validate checksum
+                if (!strEq(fileChecksum, varStr(ioFilterGroupResult(filterGroup, CRYPTO_HASH_FILTER_TYPE_STR))))
+                {
+                    result = verifyChecksumMismatch;
+                }
+                // If the size can be checked, do so
+                else if (fileSize != varUInt64Force(ioFilterGroupResult(ioReadFilterGroup(read), SIZE_FILTER_TYPE_STR)))
+                    result = verifySizeInvalid;
             }
-            // If the size can be checked, do so
-            else if (fileSize != varUInt64Force(ioFilterGroupResult(ioReadFilterGroup(read), SIZE_FILTER_TYPE_STR)))
-                result = verifySizeInvalid;
+            else
+                result = verifyFileMissing;
         }
-        else
-            result = verifyFileMissing;
+        MEM_CONTEXT_TEMP_END();
     }
-    MEM_CONTEXT_TEMP_END();
 
     FUNCTION_LOG_RETURN_STRUCT(result);
 }
@@ -9,6 +9,7 @@ Verify Protocol Handler
 #include "common/io/io.h"
 #include "common/log.h"
 #include "common/memContext.h"
+#include "common/type/json.h"
 #include "config/config.h"
 #include "storage/helper.h"
 
@@ -28,11 +29,16 @@ verifyFileProtocol(PackRead *const param, ProtocolServer *const server)
     {
         // Verify file
         const String *const filePathName = pckReadStrP(param);
+        const uint64_t offset = pckReadU64P(param);
+        const Variant *const limit = jsonToVar(pckReadStrP(param));
+        const CompressType compressType = (CompressType)pckReadU32P(param);
         const String *const fileChecksum = pckReadStrP(param);
         const uint64_t fileSize = pckReadU64P(param);
+        const uint64_t blockIncrSize = pckReadU64P(param);
         const String *const cipherPass = pckReadStrP(param);
 
-        const VerifyResult result = verifyFile(filePathName, fileChecksum, fileSize, cipherPass);
+        const VerifyResult result = verifyFile(
+            filePathName, offset, limit, compressType, fileChecksum, fileSize, blockIncrSize, cipherPass);
 
         // Return result
         protocolServerDataPut(server, pckWriteU32P(protocolPackNew(), result));
@@ -10,15 +10,18 @@ Verify the contents of the repository.
 #include <unistd.h>
 
 #include "command/archive/common.h"
+#include "command/backup/common.h"
 #include "command/check/common.h"
 #include "command/verify/file.h"
 #include "command/verify/protocol.h"
 #include "common/compress/helper.h"
 #include "common/crypto/cipherBlock.h"
 #include "common/debug.h"
+#include "common/io/bufferWrite.h"
 #include "common/io/fdWrite.h"
 #include "common/io/io.h"
 #include "common/log.h"
+#include "common/type/json.h"
 #include "config/config.h"
 #include "info/infoArchive.h"
 #include "info/infoBackup.h"
@@ -177,7 +180,7 @@ verifyFileLoad(const String *pathFileName, const String *cipherPass)
 
     // If the file is compressed, add a decompression filter
     if (compressTypeFromName(pathFileName) != compressTypeNone)
-        ioFilterGroupAdd(ioReadFilterGroup(read), decompressFilter(compressTypeFromName(pathFileName)));
+        ioFilterGroupAdd(ioReadFilterGroup(read), decompressFilterP(compressTypeFromName(pathFileName)));
 
     FUNCTION_TEST_RETURN(result);
 }
@@ -211,6 +214,8 @@ verifyInfoFile(const String *pathFileName, bool keepFile, const String *cipherPa
                     result.backup = infoBackupMove(infoBackupNewLoad(infoRead), memContextPrior());
                 else if (strBeginsWith(pathFileName, INFO_ARCHIVE_PATH_FILE_STR))
                     result.archive = infoArchiveMove(infoArchiveNewLoad(infoRead), memContextPrior());
+                else if (strEndsWithZ(pathFileName, BACKUP_MANIFEST_PACK_EXT))
+                    result.manifest = manifestMove(manifestNewLoadPack(infoRead), memContextPrior());
                 else
                     result.manifest = manifestMove(manifestNewLoad(infoRead), memContextPrior());
             }
@@ -293,6 +298,38 @@ verifyArchiveInfoFile(void)
     FUNCTION_LOG_RETURN(INFO_ARCHIVE, result);
 }
 
+/***********************************************************************************************************************************
+Does the binary manifest describe the same backup as the ini manifest? Restore loads the binary manifest when it exists so it must
+match the manifest that is verified. Both are saved in the ini format for the comparison so every field is compared.
+***********************************************************************************************************************************/
+static bool
+verifyManifestPackMatch(Manifest *const manifest, Manifest *const manifestPack)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(MANIFEST, manifest);
+        FUNCTION_TEST_PARAM(MANIFEST, manifestPack);
+    FUNCTION_TEST_END();
+
+    ASSERT(manifest != NULL);
+    ASSERT(manifestPack != NULL);
+
+    bool result = false;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        Buffer *const manifestIni = bufNew(0);
+        Buffer *const manifestPackIni = bufNew(0);
+
+        manifestSave(manifest, ioBufferWriteNew(manifestIni));
+        manifestSave(manifestPack, ioBufferWriteNew(manifestPackIni));
+
+        result = bufEq(manifestIni, manifestPackIni);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 /***********************************************************************************************************************************
 Get the backup.info file
 ***********************************************************************************************************************************/
@@ -429,6 +466,29 @@ verifyManifestFile(
             }
         }
 
+        // Check the binary manifest when there is a usable ini manifest to compare it to. Backups made by versions that did not
+        // write the binary manifest will not have one. A binary manifest that cannot be loaded is not fatal since restore falls
+        // back to the ini manifest, but one that does not match would cause restore to use different files than were verified.
+        if (result != NULL)
+        {
+            const String *const filePackName = strNewFmt("%s" BACKUP_MANIFEST_PACK_EXT, strZ(fileName));
+
+            if (storageExistsP(storageRepo(), filePackName))
+            {
+                const VerifyInfoFile verifyManifestPack = verifyInfoFile(filePackName, true, cipherPass);
+
+                if (verifyManifestPack.errorCode == 0 && !verifyManifestPackMatch(result, verifyManifestPack.manifest))
+                {
+                    LOG_ERROR_FMT(
+                        errorTypeCode(&FileInvalidError), "backup '%s' manifest.pack does not match manifest, skipping",
+                        strZ(backupResult->backupLabel));
+
+                    manifestFree(result);
+                    result = NULL;
+                }
+            }
+        }
+
         // If found a usable manifest then check that the database it was based on is in the history
         if (result != NULL)
         {
@@ -758,8 +818,12 @@ verifyArchive(void *data)
                         PackWrite *const param = protocolCommandParam(command);
 
                         pckWriteStrP(param, filePathName);
+                        pckWriteU64P(param, 0);
+                        pckWriteStrP(param, jsonFromVar(NULL));
+                        pckWriteU32P(param, compressTypeFromName(filePathName));
                         pckWriteStrP(param, checksum);
                         pckWriteU64P(param, archiveResult->pgWalInfo.size);
+                        pckWriteU64P(param, 0);
                         pckWriteStrP(param, jobData->walCipherPass);
 
                         // Assign job to result, prepending the archiveId to the key for consistency with backup processing
@@ -975,17 +1039,44 @@ verifyBackup(void *data)
                         strZ(compressExtStr((manifestData(jobData->manifest))->backupOptionCompressType)));
                 }
 
-                // If constructed file name is not null then send it off for processing
-                if (filePathName != NULL)
+                // A bundled file that is empty in the repo has nothing to read, so it is valid as long as the expected size is zero
+                if (filePathName != NULL && fileData->bundleId != 0 && fileData->sizeRepo == 0 && fileData->size == 0)
                 {
+                    backupResult->totalFileValid++;
+                }
+                // Else if constructed file name is not null then send it off for processing
+                else if (filePathName != NULL)
+                {
+                    const CompressType compressType = manifestData(jobData->manifest)->backupOptionCompressType;
+
                     // Set up the job
                     ProtocolCommand *command = protocolCommandNew(PROTOCOL_COMMAND_VERIFY_FILE);
                     PackWrite *const param = protocolCommandParam(command);
 
-                    pckWriteStrP(param, filePathName);
+                    // Bundled files are read from the bundle at the offset where they were stored
+                    if (fileData->bundleId != 0)
+                    {
+                        pckWriteStrP(
+                            param,
+                            strNewFmt(
+                                STORAGE_REPO_BACKUP "/%s/" BACKUP_PATH_BUNDLE "/%" PRIu64,
+                                strZ(fileData->reference != NULL ? fileData->reference : backupResult->backupLabel),
+                                fileData->bundleId));
+                        pckWriteU64P(param, fileData->bundleOffset);
+                        pckWriteStrP(param, jsonFromVar(VARUINT64(fileData->sizeRepo)));
+                    }
+                    else
+                    {
+                        pckWriteStrP(param, filePathName);
+                        pckWriteU64P(param, 0);
+                        pckWriteStrP(param, jsonFromVar(NULL));
+                    }
+
+                    pckWriteU32P(param, compressType);
                     // If the checksum is not present in the manifest, it will be calculated by manifest load
                     pckWriteStrP(param, STR(fileData->checksumSha1));
                     pckWriteU64P(param, fileData->size);
+                    pckWriteU64P(param, fileData->blockIncrSize);
                     pckWriteStrP(param, jobData->backupCipherPass);
 
                     // Assign job to result (prepend backup label being processed to the key since some files are in a prior backup)
@@ -1488,7 +1579,7 @@ verifyProcess(unsigned int *errorTotal)
 
                 // Create the parallel executor
                 ProtocolParallel *parallelExec = protocolParallelNew(
-                    cfgOptionUInt64(cfgOptProtocolTimeout) / 2, verifyJobCallback, &jobData);
+                    cfgOptionUInt64(cfgOptProtocolTimeout) / 2, cfgOptionUInt(cfgOptJobQueueMax), verifyJobCallback, &jobData);
 
                 for (unsigned int processIdx = 1; processIdx <= cfgOptionUInt(cfgOptProcessMax); processIdx++)
                     protocolParallelClientAdd(parallelExec, protocolLocalGet(protocolStorageTypeRepo, 0, processIdx));
@@ -39,8 +39,13 @@ static const struct CompressHelperLocal
     const String *const ext;                                        // File extension with period prefixed
     const char *compressType;                                       // Type of the compression filter
     IoFilter *(*compressNew)(int);                                  // Function to create new compression filter
+    IoFilter *(*compressThreadNew)(int, unsigned int);              // Function to create new compression filter with threads
+    IoFilter *(*compressDictNew)(int, unsigned int, const Buffer *); // Function to create new compression filter with dictionary
     const char *decompressType;                                     // Type of the decompression filter
     IoFilter *(*decompressNew)(void);                               // Function to create new decompression filter
+    IoFilter *(*decompressDictNew)(CompressDictLoad, void *);       // Function to create new decompression filter with dictionary
+    Buffer *(*dictTrain)(const Buffer *, size_t, size_t);           // Function to train a dictionary
+    unsigned int (*dictId)(const Buffer *);                         // Function to get the id of a dictionary
     int levelDefault;                                               // Default compression level
 } compressHelperLocal[] =
 {
@@ -82,9 +87,13 @@ static const struct CompressHelperLocal
         .ext = STRDEF("." ZST_EXT),
 #ifdef HAVE_LIBZST
         .compressType = ZST_COMPRESS_FILTER_TYPE,
-        .compressNew = zstCompressNew,
+        .compressThreadNew = zstCompressNew,
+        .compressDictNew = zstCompressDictNew,
         .decompressType = ZST_DECOMPRESS_FILTER_TYPE,
         .decompressNew = zstDecompressNew,
+        .decompressDictNew = zstDecompressDictNew,
+        .dictTrain = zstDictTrain,
+        .dictId = zstDictId,
         .levelDefault = 3,
 #endif
     },
@@ -135,7 +144,7 @@ compressTypePresent(CompressType type)
 
     ASSERT(type < COMPRESS_LIST_SIZE);
 
-    if (type != compressTypeNone && compressHelperLocal[type].compressNew == NULL)
+    if (type != compressTypeNone && compressHelperLocal[type].compressType == NULL)
         THROW_FMT(OptionInvalidValueError, PROJECT_NAME " not compiled with %s support", strZ(compressHelperLocal[type].type));
 
     FUNCTION_TEST_RETURN_VOID();
@@ -190,20 +199,48 @@ compressLevelDefault(CompressType type)
     FUNCTION_TEST_RETURN(compressHelperLocal[type].levelDefault);
 }
 
+/***********************************************************************************************************************************
+Create a compression filter. Types that do not support threads ignore threadTotal.
+***********************************************************************************************************************************/
+static IoFilter *
+compressFilterNew(const struct CompressHelperLocal *const compress, const int level, const unsigned int threadTotal)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, compress);
+        FUNCTION_TEST_PARAM(INT, level);
+        FUNCTION_TEST_PARAM(UINT, threadTotal);
+    FUNCTION_TEST_END();
+
+    ASSERT(compress != NULL);
+
+    if (compress->compressThreadNew != NULL)
+        FUNCTION_TEST_RETURN(compress->compressThreadNew(level, threadTotal));
+
+    FUNCTION_TEST_RETURN(compress->compressNew(level));
+}
+
 /**********************************************************************************************************************************/
 IoFilter *
-compressFilter(CompressType type, int level)
+compressFilter(const CompressType type, const int level, const CompressFilterParam param)
 {
     FUNCTION_TEST_BEGIN();
         FUNCTION_TEST_PARAM(ENUM, type);
         FUNCTION_TEST_PARAM(INT, level);
+        FUNCTION_TEST_PARAM(UINT, param.threadTotal);
+        FUNCTION_TEST_PARAM(BUFFER, param.dict);
     FUNCTION_TEST_END();
 
     ASSERT(type < COMPRESS_LIST_SIZE);
     ASSERT(type != compressTypeNone);
     compressTypePresent(type);
 
-    FUNCTION_TEST_RETURN(compressHelperLocal[type].compressNew(level));
+    if (param.dict != NULL)
+    {
+        ASSERT(compressHelperLocal[type].compressDictNew != NULL);
+        FUNCTION_TEST_RETURN(compressHelperLocal[type].compressDictNew(level, param.threadTotal, param.dict));
+    }
+
+    FUNCTION_TEST_RETURN(compressFilterNew(&compressHelperLocal[type], level, param.threadTotal));
 }
 
 /**********************************************************************************************************************************/
@@ -225,7 +262,9 @@ compressFilterVar(const String *filterType, const VariantList *filterParamList)
 
         if (compress->compressType != NULL && strEqZ(filterType, compress->compressType))
         {
-            result = compress->compressNew(varIntForce(varLstGet(filterParamList, 0)));
+            result = compressFilterNew(
+                compress, varIntForce(varLstGet(filterParamList, 0)),
+                varLstSize(filterParamList) > 1 ? varUIntForce(varLstGet(filterParamList, 1)) : 0);
             break;
         }
         else if (compress->decompressType != NULL && strEqZ(filterType, compress->decompressType))
@@ -240,19 +279,68 @@ compressFilterVar(const String *filterType, const VariantList *filterParamList)
 
 /**********************************************************************************************************************************/
 IoFilter *
-decompressFilter(CompressType type)
+decompressFilter(const CompressType type, const DecompressFilterParam param)
 {
     FUNCTION_TEST_BEGIN();
         FUNCTION_TEST_PARAM(ENUM, type);
+        FUNCTION_TEST_PARAM(FUNCTIONP, param.dictLoad);
+        FUNCTION_TEST_PARAM_P(VOID, param.dictLoadData);
     FUNCTION_TEST_END();
 
     ASSERT(type < COMPRESS_LIST_SIZE);
     ASSERT(type != compressTypeNone);
     compressTypePresent(type);
 
+    // Only types that support dictionaries need the loader. Data compressed with other types never requires a dictionary.
+    if (param.dictLoad != NULL && compressHelperLocal[type].decompressDictNew != NULL)
+        FUNCTION_TEST_RETURN(compressHelperLocal[type].decompressDictNew(param.dictLoad, param.dictLoadData));
+
     FUNCTION_TEST_RETURN(compressHelperLocal[type].decompressNew());
 }
 
+/**********************************************************************************************************************************/
+bool
+compressDictSupported(const CompressType type)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ENUM, type);
+    FUNCTION_TEST_END();
+
+    ASSERT(type < COMPRESS_LIST_SIZE);
+
+    FUNCTION_TEST_RETURN(compressHelperLocal[type].dictTrain != NULL);
+}
+
+/**********************************************************************************************************************************/
+Buffer *
+compressDictTrain(const CompressType type, const Buffer *const sample, const size_t sampleSize, const size_t dictSize)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(ENUM, type);
+        FUNCTION_LOG_PARAM(BUFFER, sample);
+        FUNCTION_LOG_PARAM(SIZE, sampleSize);
+        FUNCTION_LOG_PARAM(SIZE, dictSize);
+    FUNCTION_LOG_END();
+
+    ASSERT(compressDictSupported(type));
+
+    FUNCTION_LOG_RETURN(BUFFER, compressHelperLocal[type].dictTrain(sample, sampleSize, dictSize));
+}
+
+/**********************************************************************************************************************************/
+unsigned int
+compressDictId(const CompressType type, const Buffer *const dict)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ENUM, type);
+        FUNCTION_TEST_PARAM(BUFFER, dict);
+    FUNCTION_TEST_END();
+
+    ASSERT(compressDictSupported(type));
+
+    FUNCTION_TEST_RETURN(compressHelperLocal[type].dictId(dict));
+}
+
 /**********************************************************************************************************************************/
 const String *
 compressExtStr(CompressType type)
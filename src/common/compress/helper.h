@@ -26,6 +26,7 @@ typedef enum
     compressTypeXz,                                                 // xz/lzma
 } CompressType;
 
+#include <common/type/param.h>
 #include <common/type/string.h>
 #include <common/io/filter/group.h>
 
@@ -53,14 +54,47 @@ const String *compressTypeStr(CompressType type);
 CompressType compressTypeFromName(const String *name);
 
 // Compression filter for the specified type.  Error when compress type is none or invalid.
-IoFilter *compressFilter(CompressType type, int level);
+typedef struct CompressFilterParam
+{
+    VAR_PARAM_HEADER;
+    unsigned int threadTotal;                                       // Threads to use for compression (only zst supports threads)
+    const Buffer *dict;                                             // Dictionary from compressDictTrain() (only zst)
+} CompressFilterParam;
+
+#define compressFilterP(type, level, ...)                                                                                          \
+    compressFilter(type, level, (CompressFilterParam){VAR_PARAM_INIT, __VA_ARGS__})
+
+IoFilter *compressFilter(CompressType type, int level, CompressFilterParam param);
 
 // Compression/decompression filter based on string type and a parameter list.  This is useful when a filter must be created on a
 // remote system since the filter type and parameters can be passed through a protocol.
 IoFilter *compressFilterVar(const String *filterType, const VariantList *filterParamList);
 
+// Callback to load the dictionary with the specified id when compressed data requires one. The dictionary is not freed by the
+// caller so the callback may cache it.
+typedef const Buffer *(*CompressDictLoad)(void *data, unsigned int dictId);
+
 // Decompression filter for the specified type.  Error when compress type is none or invalid.
-IoFilter *decompressFilter(CompressType type);
+typedef struct DecompressFilterParam
+{
+    VAR_PARAM_HEADER;
+    CompressDictLoad dictLoad;                                      // Load dictionary required by the compressed data (only zst)
+    void *dictLoadData;                                             // Data passed to dictLoad
+} DecompressFilterParam;
+
+#define decompressFilterP(type, ...)                                                                                               \
+    decompressFilter(type, (DecompressFilterParam){VAR_PARAM_INIT, __VA_ARGS__})
+
+IoFilter *decompressFilter(CompressType type, DecompressFilterParam param);
+
+// Does the compression type support dictionaries?
+bool compressDictSupported(CompressType type);
+
+// Train a dictionary from a buffer of equal size samples. NULL is returned when a dictionary cannot be trained from the samples.
+Buffer *compressDictTrain(CompressType type, const Buffer *sample, size_t sampleSize, size_t dictSize);
+
+// Get the id of a dictionary. The id is stored with data compressed using the dictionary and passed to CompressDictLoad.
+unsigned int compressDictId(CompressType type, const Buffer *dict);
 
 // Get extension for the current compression type
 const String *compressExtStr(CompressType type);
@@ -5,6 +5,7 @@ ZST Common
 
 #ifdef HAVE_LIBZST
 
+#include <zdict.h>
 #include <zstd.h>
 
 // Check the version -- this is done in configure but it makes sense to be sure
@@ -14,6 +15,8 @@ ZST Common
 
 #include "common/compress/zst/common.h"
 #include "common/debug.h"
+#include "common/log.h"
+#include "common/memContext.h"
 
 /**********************************************************************************************************************************/
 size_t
@@ -29,4 +32,63 @@ zstError(size_t error)
     FUNCTION_TEST_RETURN(error);
 }
 
+/**********************************************************************************************************************************/
+Buffer *
+zstDictTrain(const Buffer *const sample, const size_t sampleSize, const size_t dictSize)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(BUFFER, sample);
+        FUNCTION_LOG_PARAM(SIZE, sampleSize);
+        FUNCTION_LOG_PARAM(SIZE, dictSize);
+    FUNCTION_LOG_END();
+
+    ASSERT(sample != NULL);
+    ASSERT(sampleSize > 0);
+    ASSERT(dictSize > 0);
+
+    Buffer *result = NULL;
+
+    // Dictionaries can only be loaded into a compression context with the advanced API, which was stabilized in 1.4.0
+#if ZSTD_VERSION_NUMBER >= 10400
+    const unsigned int sampleTotal = (unsigned int)(bufUsed(sample) / sampleSize);
+
+    if (sampleTotal > 0)
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            size_t *const sampleSizeList = memNew(sizeof(size_t) * sampleTotal);
+
+            for (unsigned int sampleIdx = 0; sampleIdx < sampleTotal; sampleIdx++)
+                sampleSizeList[sampleIdx] = sampleSize;
+
+            Buffer *const dict = bufNew(dictSize);
+            const size_t dictUsed = ZDICT_trainFromBuffer(
+                bufPtr(dict), bufSize(dict), bufPtrConst(sample), sampleSizeList, sampleTotal);
+
+            if (!ZDICT_isError(dictUsed))
+            {
+                bufUsedSet(dict, dictUsed);
+                result = bufMove(dict, memContextPrior());
+            }
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+#endif
+
+    FUNCTION_LOG_RETURN(BUFFER, result);
+}
+
+/**********************************************************************************************************************************/
+unsigned int
+zstDictId(const Buffer *const dict)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BUFFER, dict);
+    FUNCTION_TEST_END();
+
+    ASSERT(dict != NULL);
+
+    FUNCTION_TEST_RETURN(ZDICT_getDictID(bufPtrConst(dict), bufUsed(dict)));
+}
+
 #endif // HAVE_LIBZST
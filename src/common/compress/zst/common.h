@@ -8,6 +8,8 @@ Developed using the documentation in https://github.com/facebook/zstd/blob/v1.0.
 
 #include <stddef.h>
 
+#include "common/type/buffer.h"
+
 /***********************************************************************************************************************************
 ZST extension
 ***********************************************************************************************************************************/
@@ -20,6 +22,13 @@ Functions
 ***********************************************************************************************************************************/
 size_t zstError(size_t error);
 
+// Train a dictionary from a buffer of equal size samples. NULL is returned when a dictionary cannot be trained, e.g. when the
+// samples are too uniform to be useful or the library does not support dictionaries.
+Buffer *zstDictTrain(const Buffer *sample, size_t sampleSize, size_t dictSize);
+
+// Get the id that identifies the dictionary in compressed frames
+unsigned int zstDictId(const Buffer *dict);
+
 #endif // HAVE_LIBZST
 
 #endif
@@ -28,6 +28,7 @@ typedef struct ZstCompress
     MemContext *memContext;                                         // Context to store data
     ZSTD_CStream *context;                                          // Compression context
     int level;                                                      // Compression level
+    unsigned int threadTotal;                                       // Threads used for compression (0 or 1 for no worker threads)
     IoFilter *filter;                                               // Filter interface
 
     bool inputSame;                                                 // Is the same input required on the next process call?
@@ -42,8 +43,8 @@ static String *
 zstCompressToLog(const ZstCompress *this)
 {
     return strNewFmt(
-        "{level: %d, inputSame: %s, inputOffset: %zu, flushing: %s}", this->level, cvtBoolToConstZ(this->inputSame),
-        this->inputOffset, cvtBoolToConstZ(this->flushing));
+        "{level: %d, threadTotal: %u, inputSame: %s, inputOffset: %zu, flushing: %s}", this->level, this->threadTotal,
+        cvtBoolToConstZ(this->inputSame), this->inputOffset, cvtBoolToConstZ(this->flushing));
 }
 
 #define FUNCTION_LOG_ZST_COMPRESS_TYPE                                                                                             \
@@ -115,8 +116,8 @@ zstCompressProcess(THIS_VOID, const Buffer *uncompressed, Buffer *compressed)
         // If the input buffer was not entirely consumed then set inputSame and store the offset where processing will restart
         if (in.pos < in.size)
         {
-            // Output buffer should be completely full
-            ASSERT(out.pos == out.size);
+            // Output buffer should be completely full unless worker threads are busy and cannot accept more input yet
+            ASSERT(out.pos == out.size || this->threadTotal > 1);
 
             this->inputSame = true;
             this->inputOffset += in.pos;
@@ -170,10 +171,24 @@ zstCompressInputSame(const THIS_VOID)
 
 /**********************************************************************************************************************************/
 IoFilter *
-zstCompressNew(int level)
+zstCompressNew(const int level, const unsigned int threadTotal)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(INT, level);
+        FUNCTION_LOG_PARAM(UINT, threadTotal);
+    FUNCTION_LOG_END();
+
+    FUNCTION_LOG_RETURN(IO_FILTER, zstCompressDictNew(level, threadTotal, NULL));
+}
+
+/**********************************************************************************************************************************/
+IoFilter *
+zstCompressDictNew(const int level, const unsigned int threadTotal, const Buffer *const dict)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(INT, level);
+        FUNCTION_LOG_PARAM(UINT, threadTotal);
+        FUNCTION_LOG_PARAM(BUFFER, dict);
     FUNCTION_LOG_END();
 
     ASSERT(level >= 0);
@@ -189,6 +204,7 @@ zstCompressNew(int level)
             .memContext = MEM_CONTEXT_NEW(),
             .context = ZSTD_createCStream(),
             .level = level,
+            .threadTotal = threadTotal,
         };
 
         // Set callback to ensure zst context is freed
@@ -197,9 +213,31 @@ zstCompressNew(int level)
         // Initialize context
         zstError(ZSTD_initCStream(driver->context, driver->level));
 
-        // Create param list
+        // Compress with worker threads when requested. The calling thread only moves data in and out of the context while the
+        // workers compress in the background. Worker threads were added to the stable API in 1.4.0 and are only available when
+        // the library was built with multithread support, so if the parameter is rejected compress without worker threads.
+#if ZSTD_VERSION_NUMBER >= 10400
+        if (driver->threadTotal > 1 && ZSTD_isError(ZSTD_CCtx_setParameter(driver->context, ZSTD_c_nbWorkers, (int)threadTotal)))
+            driver->threadTotal = 0;
+#else
+        driver->threadTotal = 0;
+#endif
+
+        // Load the dictionary, which is copied into the context. zstDictTrain() does not create dictionaries when the library is
+        // older than 1.4.0 so there is no need to handle that case here.
+        if (dict != NULL)
+        {
+#if ZSTD_VERSION_NUMBER >= 10400
+            zstError(ZSTD_CCtx_loadDictionary(driver->context, bufPtrConst(dict), bufUsed(dict)));
+#else
+            THROW(AssertError, "zst dictionary requires library version >= 1.4.0");
+#endif
+        }
+
+        // Create param list. The dictionary is not included so a filter with a dictionary must be created locally.
         VariantList *paramList = varLstNew();
         varLstAdd(paramList, varNewInt(level));
+        varLstAdd(paramList, varNewUInt(threadTotal));
 
         // Create filter interface
         this = ioFilterNewP(
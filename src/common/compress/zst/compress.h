@@ -19,7 +19,12 @@ Filter type constant
 /***********************************************************************************************************************************
 Constructors
 ***********************************************************************************************************************************/
-IoFilter *zstCompressNew(int level);
+// When threadTotal > 1 compression is done by that many worker threads, which is useful for large files at higher levels
+IoFilter *zstCompressNew(int level, unsigned int threadTotal);
+
+// Compress with a dictionary created by zstDictTrain(). The dictionary id is stored in each frame so the decompressor can tell
+// which dictionary is required.
+IoFilter *zstCompressDictNew(int level, unsigned int threadTotal, const Buffer *dict);
 
 #endif
 
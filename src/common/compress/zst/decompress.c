@@ -20,6 +20,12 @@ Filter type constant
 ***********************************************************************************************************************************/
 STRING_EXTERN(ZST_DECOMPRESS_FILTER_TYPE_STR,                       ZST_DECOMPRESS_FILTER_TYPE);
 
+/***********************************************************************************************************************************
+Maximum size of a frame header. The dictionary id is in the frame header so the header must be complete before the dictionary can be
+loaded.
+***********************************************************************************************************************************/
+#define ZST_DECOMPRESS_HEADER_MAX                                   18
+
 /***********************************************************************************************************************************
 Object type
 ***********************************************************************************************************************************/
@@ -28,7 +34,12 @@ typedef struct ZstDecompress
     MemContext *memContext;                                         // Context to store data
     ZSTD_DStream *context;                                          // Decompression context
     IoFilter *filter;                                               // Filter interface
+    CompressDictLoad dictLoad;                                      // Callback to load a dictionary
+    void *dictLoadData;                                             // Data passed to the dictionary callback
 
+    bool dictChecked;                                               // Has the first frame been checked for a dictionary?
+    unsigned char header[ZST_DECOMPRESS_HEADER_MAX];                // First frame header
+    size_t headerSize;                                              // Size of first frame header copied so far
     bool inputSame;                                                 // Is the same input required on the next process call?
     size_t inputOffset;                                             // Current offset in input buffer
     bool frameDone;                                                 // Has the current frame completed?
@@ -70,6 +81,46 @@ zstDecompressFreeResource(THIS_VOID)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Size of the frame header. The size is not known until the frame header descriptor has been read so the size returned may increase as
+more of the header is available. Data that does not begin with the zst magic number is left to the decompressor to report.
+***********************************************************************************************************************************/
+static size_t
+zstDecompressHeaderSize(const unsigned char *const header, const size_t headerSize)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(UCHARDATA, header);
+        FUNCTION_TEST_PARAM(SIZE, headerSize);
+    FUNCTION_TEST_END();
+
+    ASSERT(header != NULL);
+
+    // The magic number and frame header descriptor are required to calculate the header size
+    if (headerSize < 5)
+        FUNCTION_TEST_RETURN(5);
+
+    if (((uint32_t)header[0] | (uint32_t)header[1] << 8 | (uint32_t)header[2] << 16 | (uint32_t)header[3] << 24) !=
+            ZSTD_MAGICNUMBER)
+    {
+        FUNCTION_TEST_RETURN(headerSize);
+    }
+
+    // Add the optional window descriptor, dictionary id, and frame content size to the magic number and frame header descriptor
+    static const size_t dictIdSize[] = {0, 1, 2, 4};
+    static const size_t contentSize[] = {0, 2, 4, 8};
+    const unsigned char descriptor = header[4];
+    const bool singleSegment = (descriptor >> 5 & 1) != 0;
+    size_t result = singleSegment ? 5 : 6;
+
+    result += dictIdSize[descriptor & 3] + contentSize[descriptor >> 6];
+
+    // Frame content size is always present for single segment frames
+    if (singleSegment && descriptor >> 6 == 0)
+        result++;
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 /***********************************************************************************************************************************
 Decompress data
 ***********************************************************************************************************************************/
@@ -103,9 +154,53 @@ zstDecompressProcess(THIS_VOID, const Buffer *compressed, Buffer *decompressed)
         ZSTD_inBuffer in = {.src = bufPtrConst(compressed) + this->inputOffset, .size = bufUsed(compressed) - this->inputOffset};
         ZSTD_outBuffer out = {.dst = bufRemainsPtr(decompressed), .size = bufRemains(decompressed)};
 
-        // Perform decompression. Track frame done so we can detect unexpected EOF.
-        this->frameDone = zstError(ZSTD_decompressStream(this->context, &out, &in)) == 0;
-        bufUsedInc(decompressed, out.pos);
+        // Load the dictionary required by the first frame, if any. All frames in the data are expected to use the same dictionary.
+        // The first frame header is copied until complete since it may be split between inputs.
+        if (!this->dictChecked)
+        {
+            size_t headerRequired;
+
+            while (
+                this->headerSize < (headerRequired = zstDecompressHeaderSize(this->header, this->headerSize)) && in.pos < in.size)
+            {
+                this->header[this->headerSize++] = ((const unsigned char *)in.src)[in.pos++];
+            }
+
+            if (this->headerSize >= headerRequired)
+            {
+#if ZSTD_VERSION_NUMBER >= 10400
+                const unsigned int dictId = ZSTD_getDictID_fromFrame(this->header, this->headerSize);
+
+                if (dictId != 0)
+                {
+                    if (this->dictLoad == NULL)
+                        THROW_FMT(FormatError, "zst dictionary %u is required but cannot be loaded", dictId);
+
+                    MEM_CONTEXT_TEMP_BEGIN()
+                    {
+                        const Buffer *const dict = this->dictLoad(this->dictLoadData, dictId);
+                        zstError(ZSTD_DCtx_loadDictionary(this->context, bufPtrConst(dict), bufUsed(dict)));
+                    }
+                    MEM_CONTEXT_TEMP_END();
+                }
+#endif
+
+                // Decompress the header. No output is produced so the header will be entirely consumed.
+                ZSTD_inBuffer header = {.src = this->header, .size = this->headerSize};
+
+                zstError(ZSTD_decompressStream(this->context, &out, &header));
+                CHECK(header.pos == header.size);
+
+                this->dictChecked = true;
+            }
+        }
+
+        // Perform decompression once the first frame header is complete. Track frame done so we can detect unexpected EOF.
+        if (this->dictChecked)
+        {
+            this->frameDone = zstError(ZSTD_decompressStream(this->context, &out, &in)) == 0;
+            bufUsedInc(decompressed, out.pos);
+        }
 
         // If the input buffer was not entirely consumed then set inputSame and store the offset where processing will restart
         if (in.pos < in.size)
@@ -166,6 +261,17 @@ IoFilter *
 zstDecompressNew(void)
 {
     FUNCTION_LOG_VOID(logLevelTrace);
+    FUNCTION_LOG_RETURN(IO_FILTER, zstDecompressDictNew(NULL, NULL));
+}
+
+/**********************************************************************************************************************************/
+IoFilter *
+zstDecompressDictNew(const CompressDictLoad dictLoad, void *const dictLoadData)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(FUNCTIONP, dictLoad);
+        FUNCTION_LOG_PARAM_P(VOID, dictLoadData);
+    FUNCTION_LOG_END();
 
     IoFilter *this = NULL;
 
@@ -177,6 +283,8 @@ zstDecompressNew(void)
         {
             .memContext = MEM_CONTEXT_NEW(),
             .context = ZSTD_createDStream(),
+            .dictLoad = dictLoad,
+            .dictLoadData = dictLoadData,
         };
 
         // Set callback to ensure zst context is freed
@@ -8,6 +8,7 @@ Decompress IO from the zst format.
 #ifndef COMMON_COMPRESS_ZST_DECOMPRESS_H
 #define COMMON_COMPRESS_ZST_DECOMPRESS_H
 
+#include "common/compress/helper.h"
 #include "common/io/filter/filter.h"
 
 /***********************************************************************************************************************************
@@ -21,6 +22,10 @@ Constructors
 ***********************************************************************************************************************************/
 IoFilter *zstDecompressNew(void);
 
+// Decompress data that may have been compressed with a dictionary. The dictionary is loaded with the callback only when the first
+// frame requires one.
+IoFilter *zstDecompressDictNew(CompressDictLoad dictLoad, void *dictLoadData);
+
 #endif
 
 #endif // HAVE_LIBZST
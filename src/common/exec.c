@@ -301,6 +301,23 @@ execFdRead(const THIS_VOID)
     FUNCTION_TEST_RETURN(this->fdRead);
 }
 
+/***********************************************************************************************************************************
+Get the write file descriptor
+***********************************************************************************************************************************/
+static int
+execFdWrite(const THIS_VOID)
+{
+    THIS(const Exec);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(EXEC, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->fdWrite);
+}
+
 /**********************************************************************************************************************************/
 void
 execOpen(Exec *this)
@@ -365,7 +382,7 @@ execOpen(Exec *this)
     // Create wrapper interfaces that check process state
     this->pub.ioReadExec = ioReadNewP(this, .block = true, .read = execRead, .eof = execEof, .fd = execFdRead);
     ioReadOpen(execIoRead(this));
-    this->pub.ioWriteExec = ioWriteNewP(this, .write = execWrite);
+    this->pub.ioWriteExec = ioWriteNewP(this, .write = execWrite, .fd = execFdWrite);
     ioWriteOpen(execIoWrite(this));
 
     // Set a callback so the file descriptors will get freed
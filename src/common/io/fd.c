@@ -3,13 +3,22 @@ File Descriptor Functions
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
+#include <fcntl.h>
 #include <poll.h>
+#include <sys/ioctl.h>
 
 #include "common/debug.h"
 #include "common/io/fd.h"
 #include "common/log.h"
 #include "common/wait.h"
 
+/***********************************************************************************************************************************
+F_GETPIPE_SZ is only declared when _GNU_SOURCE is defined but the value is part of the stable Linux ABI
+***********************************************************************************************************************************/
+#if defined(__linux__) && !defined(F_GETPIPE_SZ)
+    #define F_GETPIPE_SZ                                            1032
+#endif
+
 /***********************************************************************************************************************************
 Use poll() to determine when data is ready to read/write on a socket. Retry after EINTR with whatever time is left on the timer.
 ***********************************************************************************************************************************/
@@ -100,3 +109,33 @@ fdReady(int fd, bool read, bool write, TimeMSec timeout)
 
     FUNCTION_LOG_RETURN(BOOL, result > 0);
 }
+
+/**********************************************************************************************************************************/
+size_t
+fdWriteSpace(const int fd)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(INT, fd);
+    FUNCTION_LOG_END();
+
+    ASSERT(fd >= 0);
+
+    size_t result = 0;
+
+#if defined(FIONSPACE)
+    // BSD/macOS report the free space directly
+    int space;
+
+    if (ioctl(fd, FIONSPACE, &space) == 0 && space > 0)
+        result = (size_t)space;
+#elif defined(F_GETPIPE_SZ)
+    // Linux reports the pipe capacity and the bytes waiting to be read, which also works on the write end of the pipe
+    const int size = fcntl(fd, F_GETPIPE_SZ);
+    int used;
+
+    if (size != -1 && ioctl(fd, FIONREAD, &used) == 0 && size > used)
+        result = (size_t)(size - used);
+#endif
+
+    FUNCTION_LOG_RETURN(SIZE, result);
+}
@@ -26,4 +26,8 @@ fdReadyWrite(const int fd, const TimeMSec timeout)
     return fdReady(fd, false, true, timeout);
 }
 
+// Bytes that can be written to a pipe without blocking. Zero is returned when the fd is not a pipe or the free space cannot be
+// determined on this platform, so callers must treat zero as no space.
+size_t fdWriteSpace(int fd);
+
 #endif
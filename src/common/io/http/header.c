@@ -5,6 +5,7 @@ HTTP Header
 
 #include "common/debug.h"
 #include "common/io/http/header.h"
+#include "common/io/http/request.h"
 #include "common/memContext.h"
 #include "common/type/keyValue.h"
 
@@ -162,6 +163,38 @@ httpHeaderPut(HttpHeader *this, const String *key, const String *value)
     FUNCTION_TEST_RETURN(this);
 }
 
+/**********************************************************************************************************************************/
+HttpHeader *
+httpHeaderPutRange(HttpHeader *const this, const uint64_t offset, const Variant *const limit)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(HTTP_HEADER, this);
+        FUNCTION_TEST_PARAM(UINT64, offset);
+        FUNCTION_TEST_PARAM(VARIANT, limit);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(limit == NULL || varType(limit) == varTypeUInt64);
+    ASSERT(limit == NULL || varUInt64(limit) > 0);
+
+    // Only add the range header when the entire file is not being requested
+    if (offset != 0 || limit != NULL)
+    {
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            String *const range = strNewFmt(HTTP_HEADER_RANGE_BYTES "=%" PRIu64 "-", offset);
+
+            if (limit != NULL)
+                strCatFmt(range, "%" PRIu64, offset + varUInt64(limit) - 1);
+
+            httpHeaderPut(this, HTTP_HEADER_RANGE_STR, range);
+        }
+        MEM_CONTEXT_TEMP_END();
+    }
+
+    FUNCTION_TEST_RETURN(this);
+}
+
 /**********************************************************************************************************************************/
 bool
 httpHeaderRedact(const HttpHeader *this, const String *key)
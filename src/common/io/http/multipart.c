@@ -0,0 +1,115 @@
+/***********************************************************************************************************************************
+HTTP Multipart
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <ctype.h>
+#include <string.h>
+
+#include "common/debug.h"
+#include "common/io/http/multipart.h"
+#include "common/io/http/response.h"
+#include "common/type/convert.h"
+
+/***********************************************************************************************************************************
+Response codes that can be retried
+***********************************************************************************************************************************/
+#define HTTP_MULTIPART_CODE_RETRY_CLASS                             5
+
+/**********************************************************************************************************************************/
+List *
+httpMultipartStatusList(const Buffer *const response, const unsigned int partTotal)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(BUFFER, response);
+        FUNCTION_TEST_PARAM(UINT, partTotal);
+    FUNCTION_TEST_END();
+
+    ASSERT(response != NULL);
+    ASSERT(partTotal > 0);
+
+    List *const result = lstNewP(sizeof(HttpMultipartStatus));
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const StringList *const lineList = strLstNewSplitZ(strNewBuf(response), "\n");
+        bool *const partFound = memNew(sizeof(bool) * partTotal);
+        bool idFound = false;
+        unsigned int id = 0;
+
+        for (unsigned int partIdx = 0; partIdx < partTotal; partIdx++)
+            partFound[partIdx] = false;
+
+        for (unsigned int lineIdx = 0; lineIdx < strLstSize(lineList); lineIdx++)
+        {
+            const String *const line = strTrim(strDup(strLstGet(lineList, lineIdx)));
+
+            // Get the id from the Content-ID, skipping any text before the number
+            if (strBeginsWithZ(strLower(strDup(line)), "content-id:"))
+            {
+                const char *idZ = strZ(line) + strlen("content-id:");
+
+                while (*idZ != '\0' && !isdigit((unsigned char)*idZ))
+                    idZ++;
+
+                size_t idSize = 0;
+
+                while (isdigit((unsigned char)idZ[idSize]))
+                    idSize++;
+
+                id = cvtZToUInt(strZ(strNewN(idZ, idSize)));
+                idFound = true;
+            }
+            // Add the status of the part
+            else if (strBeginsWithZ(line, "HTTP/1.1 ") && strSize(line) >= 12)
+            {
+                if (!idFound)
+                    THROW_FMT(FormatError, "multipart response status '%s' has no Content-ID", strZ(line));
+
+                if (id >= partTotal)
+                    THROW_FMT(FormatError, "multipart response has invalid Content-ID %u", id);
+
+                if (partFound[id])
+                    THROW_FMT(FormatError, "multipart response has duplicate Content-ID %u", id);
+
+                partFound[id] = true;
+
+                MEM_CONTEXT_BEGIN(lstMemContext(result))
+                {
+                    const HttpMultipartStatus status =
+                    {
+                        .id = id,
+                        .code = cvtZToUInt(strZ(strSubN(line, 9, 3))),
+                        .reason = strTrim(strSub(line, 12)),
+                    };
+
+                    lstAdd(result, &status);
+                }
+                MEM_CONTEXT_END();
+
+                idFound = false;
+            }
+        }
+
+        // Error on any part with no status, e.g. when the response was truncated
+        for (unsigned int partIdx = 0; partIdx < partTotal; partIdx++)
+        {
+            if (!partFound[partIdx])
+                THROW_FMT(FormatError, "multipart response is missing status for Content-ID %u", partIdx);
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+bool
+httpMultipartStatusRetry(const unsigned int code)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(UINT, code);
+    FUNCTION_TEST_END();
+
+    FUNCTION_TEST_RETURN(code == HTTP_RESPONSE_CODE_TOO_MANY_REQUESTS || code / 100 == HTTP_MULTIPART_CODE_RETRY_CLASS);
+}
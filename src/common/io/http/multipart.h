@@ -0,0 +1,35 @@
+/***********************************************************************************************************************************
+HTTP Multipart
+
+Parse multipart/mixed responses to batch requests, e.g. GCS JSON API batch or Azure Blob Batch. Each part of the response contains
+the complete HTTP response to one part of the request.
+***********************************************************************************************************************************/
+#ifndef COMMON_IO_HTTP_MULTIPART_H
+#define COMMON_IO_HTTP_MULTIPART_H
+
+#include "common/type/buffer.h"
+#include "common/type/list.h"
+#include "common/type/string.h"
+
+/***********************************************************************************************************************************
+Status of a response part
+***********************************************************************************************************************************/
+typedef struct HttpMultipartStatus
+{
+    unsigned int id;                                                // Content-ID of the matching request part
+    unsigned int code;                                              // Response code
+    const String *reason;                                           // Response reason
+} HttpMultipartStatus;
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Get a list of HttpMultipartStatus with the status of each part of the response. The Content-ID of each part must contain the
+// numeric Content-ID of the matching request part, e.g. 3 or <response-3>. Request parts are numbered from zero and each of the
+// partTotal parts must have exactly one status in the response, so a truncated response is an error rather than a success.
+List *httpMultipartStatusList(const Buffer *response, unsigned int partTotal);
+
+// Can a part that failed with the response code be retried? Rate limit (429) and server (5xx) errors can be retried.
+bool httpMultipartStatusRetry(unsigned int code);
+
+#endif
@@ -20,6 +20,7 @@ struct IoRead
     Buffer *input;                                                  // Input buffer
     Buffer *output;                                                 // Internal output buffer (extra output from buffered reads)
     size_t outputPos;                                               // Current position in the internal output buffer
+    IoThrottle *throttle;                                           // Throttle driver reads (NULL if not throttled)
 };
 
 /**********************************************************************************************************************************/
@@ -141,6 +142,9 @@ ioReadInternal(IoRead *this, Buffer *buffer, bool block)
 
                     this->pub.interface.read(this->pub.driver, this->input, block);
                     bufLimitClear(this->input);
+
+                    if (this->throttle != NULL && !bufEmpty(this->input))
+                        ioThrottleConsume(this->throttle, bufUsed(this->input));
                 }
                 // Set input to NULL and flush (no need to actually free the buffer here as it will be freed with the mem context)
                 else
@@ -375,6 +379,19 @@ ioReadReady(IoRead *this, IoReadReadyParam param)
     FUNCTION_LOG_RETURN(BOOL, result);
 }
 
+/**********************************************************************************************************************************/
+bool
+ioReadBuffered(const IoRead *const this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_READ, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->output != NULL && bufUsed(this->output) > this->outputPos);
+}
+
 /**********************************************************************************************************************************/
 void
 ioReadClose(IoRead *this)
@@ -400,6 +417,22 @@ ioReadClose(IoRead *this)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/**********************************************************************************************************************************/
+void
+ioReadThrottleSet(IoRead *const this, IoThrottle *const throttle)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_READ, this);
+        FUNCTION_TEST_PARAM(IO_THROTTLE, throttle);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    this->throttle = throttle;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 int
 ioReadFd(const IoRead *this)
@@ -16,6 +16,7 @@ typedef struct IoRead IoRead;
 
 #include "common/io/filter/group.h"
 #include "common/io/read.intern.h"
+#include "common/io/throttle.h"
 #include "common/type/buffer.h"
 #include "common/type/object.h"
 
@@ -47,6 +48,9 @@ ioReadFilterGroup(IoRead *const this)
 // File descriptor for the read object. Not all read objects have a file descriptor and -1 will be returned in that case.
 int ioReadFd(const IoRead *this);
 
+// Throttle driver reads. The throttle is owned by the caller and must not be freed before the read object.
+void ioReadThrottleSet(IoRead *this, IoThrottle *throttle);
+
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
@@ -82,6 +86,10 @@ typedef struct IoReadReadyParam
 
 bool ioReadReady(IoRead *this, IoReadReadyParam param);
 
+// Is data buffered internally? Data read ahead by ioReadSmall() or ioReadLine() is not visible to ioReadReady() or to select() on
+// the file descriptor, so callers that wait on the file descriptor must check for buffered data first.
+bool ioReadBuffered(const IoRead *this);
+
 // Close the IO
 void ioReadClose(IoRead *this);
 
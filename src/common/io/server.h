@@ -0,0 +1,73 @@
+/***********************************************************************************************************************************
+Io Server Interface
+
+Accept sessions from protocol clients. For example, a TLS server can be created with tlsServerNew() and then new TLS sessions can be
+accepted with ioServerAccept(). Servers are layered the same way as clients, e.g. a TLS server accepts the sessions that were
+accepted by a socket server and negotiates TLS on top of them.
+***********************************************************************************************************************************/
+#ifndef COMMON_IO_SERVER_H
+#define COMMON_IO_SERVER_H
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+typedef struct IoServer IoServer;
+
+#include "common/io/server.intern.h"
+#include "common/io/session.h"
+#include "common/type/object.h"
+
+/***********************************************************************************************************************************
+Getters/Setters
+***********************************************************************************************************************************/
+typedef struct IoServerPub
+{
+    MemContext *memContext;                                         // Mem context
+    void *driver;                                                   // Driver object
+    const IoServerInterface *interface;                             // Driver interface
+} IoServerPub;
+
+// Name that identifies the server
+__attribute__((always_inline)) static inline const String *
+ioServerName(const IoServer *const this)
+{
+    return THIS_PUB(IoServer)->interface->name(THIS_PUB(IoServer)->driver);
+}
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Accept a new session. The session parameter should be NULL unless the server is layered on another server.
+__attribute__((always_inline)) static inline IoSession *
+ioServerAccept(IoServer *const this, IoSession *const session)
+{
+    return THIS_PUB(IoServer)->interface->accept(THIS_PUB(IoServer)->driver, session);
+}
+
+// Move to a new parent mem context
+__attribute__((always_inline)) static inline IoServer *
+ioServerMove(IoServer *const this, MemContext *const parentNew)
+{
+    return objMove(this, parentNew);
+}
+
+/***********************************************************************************************************************************
+Destructor
+***********************************************************************************************************************************/
+__attribute__((always_inline)) static inline void
+ioServerFree(IoServer *const this)
+{
+    objFree(this);
+}
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+String *ioServerToLog(const IoServer *this);
+
+#define FUNCTION_LOG_IO_SERVER_TYPE                                                                                                \
+    IoServer *
+#define FUNCTION_LOG_IO_SERVER_FORMAT(value, buffer, bufferSize)                                                                   \
+    FUNCTION_LOG_STRING_OBJECT_FORMAT(value, ioServerToLog, buffer, bufferSize)
+
+#endif
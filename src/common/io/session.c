@@ -49,6 +49,22 @@ ioSessionNew(void *driver, const IoSessionInterface *interface)
     FUNCTION_LOG_RETURN(IO_SESSION, this);
 }
 
+/**********************************************************************************************************************************/
+void
+ioSessionAuthenticatedSet(IoSession *const this, const bool authenticated)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_SESSION, this);
+        FUNCTION_TEST_PARAM(BOOL, authenticated);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    this->pub.authenticated = authenticated;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 int
 ioSessionFd(IoSession *this)
@@ -62,6 +78,27 @@ ioSessionFd(IoSession *this)
     FUNCTION_TEST_RETURN(this->pub.interface->fd == NULL ? -1 : this->pub.interface->fd(this->pub.driver));
 }
 
+/**********************************************************************************************************************************/
+void
+ioSessionPeerNameSet(IoSession *const this, const String *const peerName)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_SESSION, this);
+        FUNCTION_TEST_PARAM(STRING, peerName);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    MEM_CONTEXT_BEGIN(this->pub.memContext)
+    {
+        strFree(this->pub.peerName);
+        this->pub.peerName = strDup(peerName);
+    }
+    MEM_CONTEXT_END();
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 String *
 ioSessionToLog(const IoSession *this)
@@ -36,8 +36,19 @@ typedef struct IoSessionPub
     MemContext *memContext;                                         // Mem context
     void *driver;                                                   // Driver object
     const IoSessionInterface *interface;                            // Driver interface
+    bool authenticated;                                             // Is the session authenticated?
+    String *peerName;                                               // Name of peer (exact meaning depends on driver)
 } IoSessionPub;
 
+// Is the session authenticated? The exact meaning of "authenticated" will vary by driver type.
+__attribute__((always_inline)) static inline bool
+ioSessionAuthenticated(const IoSession *const this)
+{
+    return THIS_PUB(IoSession)->authenticated;
+}
+
+void ioSessionAuthenticatedSet(IoSession *this, bool authenticated);
+
 // Session file descriptor, -1 if none
 int ioSessionFd(IoSession *this);
 
@@ -55,6 +66,15 @@ ioSessionIoWrite(IoSession *const this)
     return THIS_PUB(IoSession)->interface->ioWrite(THIS_PUB(IoSession)->driver);
 }
 
+// Name of peer, e.g. the common name of a certificate presented by a TLS client. NULL if not set by the driver.
+__attribute__((always_inline)) static inline const String *
+ioSessionPeerName(const IoSession *const this)
+{
+    return THIS_PUB(IoSession)->peerName;
+}
+
+void ioSessionPeerNameSet(IoSession *this, const String *peerName);
+
 // Session role
 __attribute__((always_inline)) static inline IoSessionRole
 ioSessionRole(const IoSession *const this)
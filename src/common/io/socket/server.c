@@ -0,0 +1,234 @@
+/***********************************************************************************************************************************
+Socket Server
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "common/debug.h"
+#include "common/log.h"
+#include "common/io/server.h"
+#include "common/io/socket/common.h"
+#include "common/io/socket/server.h"
+#include "common/io/socket/session.h"
+#include "common/memContext.h"
+#include "common/stat.h"
+#include "common/type/object.h"
+
+/***********************************************************************************************************************************
+Statistics constants
+***********************************************************************************************************************************/
+STRING_EXTERN(SOCKET_STAT_SERVER_STR,                               SOCKET_STAT_SERVER);
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+typedef struct SocketServer
+{
+    MemContext *memContext;                                         // Mem context
+    String *address;                                                // Address to listen on (hostname or IP)
+    unsigned int port;                                              // Port to listen on
+    String *name;                                                   // Socket name (address:port)
+    int socket;                                                     // Socket used to listen for connections
+    TimeMSec timeout;                                               // Timeout for any i/o operation (connect, read, etc.)
+} SocketServer;
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+static String *
+sckServerToLog(const THIS_VOID)
+{
+    THIS(const SocketServer);
+
+    return strNewFmt("{address: %s, port: %u, timeout: %" PRIu64 "}", strZ(this->address), this->port, this->timeout);
+}
+
+#define FUNCTION_LOG_SOCKET_SERVER_TYPE                                                                                            \
+    SocketServer *
+#define FUNCTION_LOG_SOCKET_SERVER_FORMAT(value, buffer, bufferSize)                                                               \
+    FUNCTION_LOG_STRING_OBJECT_FORMAT(value, sckServerToLog, buffer, bufferSize)
+
+/***********************************************************************************************************************************
+Free the listening socket
+***********************************************************************************************************************************/
+static void
+sckServerFreeResource(THIS_VOID)
+{
+    THIS(SocketServer);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(SOCKET_SERVER, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    close(this->socket);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+static IoSession *
+sckServerAccept(THIS_VOID, IoSession *const session)
+{
+    THIS(SocketServer);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(SOCKET_SERVER, this);
+        FUNCTION_LOG_PARAM(IO_SESSION, session);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(session == NULL);
+
+    IoSession *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Accept the connection
+        struct sockaddr_in addr;
+        unsigned int len = sizeof(addr);
+        int fd = accept(this->socket, (struct sockaddr *)&addr, &len);
+
+        THROW_ON_SYS_ERROR(fd < 0, FileOpenError, "unable to accept socket");
+
+        // Create the session
+        TRY_BEGIN()
+        {
+            sckOptionSet(fd);
+
+            MEM_CONTEXT_PRIOR_BEGIN()
+            {
+                result = sckSessionNew(ioSessionRoleServer, fd, this->address, this->port, this->timeout);
+            }
+            MEM_CONTEXT_PRIOR_END();
+        }
+        CATCH_ANY()
+        {
+            close(fd);
+            RETHROW();
+        }
+        TRY_END();
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(IO_SESSION, result);
+}
+
+/**********************************************************************************************************************************/
+static const String *
+sckServerName(THIS_VOID)
+{
+    THIS(SocketServer);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(SOCKET_SERVER, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->name);
+}
+
+/**********************************************************************************************************************************/
+static const IoServerInterface sckServerInterface =
+{
+    .type = IO_SERVER_SOCKET_TYPE,
+    .name = sckServerName,
+    .accept = sckServerAccept,
+    .toLog = sckServerToLog,
+};
+
+IoServer *
+sckServerNew(const String *const address, const unsigned int port, const TimeMSec timeout)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug)
+        FUNCTION_LOG_PARAM(STRING, address);
+        FUNCTION_LOG_PARAM(UINT, port);
+        FUNCTION_LOG_PARAM(TIME_MSEC, timeout);
+    FUNCTION_LOG_END();
+
+    ASSERT(address != NULL);
+    ASSERT(port > 0);
+
+    IoServer *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("SocketServer")
+    {
+        SocketServer *const driver = memNew(sizeof(SocketServer));
+
+        *driver = (SocketServer)
+        {
+            .memContext = MEM_CONTEXT_NEW(),
+            .address = strDup(address),
+            .port = port,
+            .name = strNewFmt("%s:%u", strZ(address), port),
+            .socket = -1,
+            .timeout = timeout,
+        };
+
+        // Lookup the address to listen on
+        struct addrinfo hints = (struct addrinfo)
+        {
+            .ai_family = AF_UNSPEC,
+            .ai_flags = AI_PASSIVE,
+            .ai_socktype = SOCK_STREAM,
+            .ai_protocol = IPPROTO_TCP,
+        };
+
+        char portZ[CVT_BASE10_BUFFER_SIZE];
+        cvtUIntToZ(port, portZ, sizeof(portZ));
+
+        struct addrinfo *addressInfo;
+        int resultAddr;
+
+        if ((resultAddr = getaddrinfo(strZ(address), portZ, &hints, &addressInfo)) != 0)
+        {
+            THROW_FMT(
+                HostConnectError, "unable to get address for '%s': [%d] %s", strZ(address), resultAddr, gai_strerror(resultAddr));
+        }
+
+        TRY_BEGIN()
+        {
+            // Create the socket
+            THROW_ON_SYS_ERROR_FMT(
+                (driver->socket = socket(addressInfo->ai_family, addressInfo->ai_socktype, addressInfo->ai_protocol)) == -1,
+                FileOpenError, "unable to create socket for '%s'", strZ(driver->name));
+
+            memContextCallbackSet(driver->memContext, sckServerFreeResource, driver);
+
+            // Set the address as reusable so the server can be restarted without waiting for old connections to time out
+            int socketValue = 1;
+
+            THROW_ON_SYS_ERROR_FMT(
+                setsockopt(driver->socket, SOL_SOCKET, SO_REUSEADDR, &socketValue, sizeof(int)) == -1, FileOpenError,
+                "unable to set SO_REUSEADDR for '%s'", strZ(driver->name));
+
+            // Bind the address and listen for connections
+            THROW_ON_SYS_ERROR_FMT(
+                bind(driver->socket, addressInfo->ai_addr, addressInfo->ai_addrlen) == -1, FileOpenError,
+                "unable to bind socket for '%s'", strZ(driver->name));
+
+            THROW_ON_SYS_ERROR_FMT(
+                listen(driver->socket, SOMAXCONN) == -1, FileOpenError, "unable to listen on socket for '%s'",
+                strZ(driver->name));
+        }
+        FINALLY()
+        {
+            freeaddrinfo(addressInfo);
+        }
+        TRY_END();
+
+        statInc(SOCKET_STAT_SERVER_STR);
+
+        this = ioServerNew(driver, &sckServerInterface);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(IO_SERVER, this);
+}
@@ -0,0 +1,28 @@
+/***********************************************************************************************************************************
+Socket Server
+
+A simple socket server intended to accept sessions from clients that access services exposed via a socket.
+***********************************************************************************************************************************/
+#ifndef COMMON_IO_SOCKET_SERVER_H
+#define COMMON_IO_SOCKET_SERVER_H
+
+#include "common/io/server.h"
+#include "common/time.h"
+
+/***********************************************************************************************************************************
+Io server type
+***********************************************************************************************************************************/
+#define IO_SERVER_SOCKET_TYPE                                       STRID5("socket", 0x28558df30)
+
+/***********************************************************************************************************************************
+Statistics constants
+***********************************************************************************************************************************/
+#define SOCKET_STAT_SERVER                                          "socket.server"         // Servers created
+    STRING_DECLARE(SOCKET_STAT_SERVER_STR);
+
+/***********************************************************************************************************************************
+Constructors
+***********************************************************************************************************************************/
+IoServer *sckServerNew(const String *address, unsigned int port, TimeMSec timeout);
+
+#endif
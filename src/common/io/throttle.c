@@ -0,0 +1,223 @@
+/***********************************************************************************************************************************
+IO Throttle
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "common/debug.h"
+#include "common/io/throttle.h"
+#include "common/log.h"
+#include "common/memContext.h"
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+// Virtual clocks (in usec since the epoch) that are stored in the state file when shared
+typedef struct IoThrottleState
+{
+    uint64_t byteTime;                                              // When bytes consumed so far will have been paid for
+    uint64_t opTime;                                                // When operations consumed so far will have been paid for
+} IoThrottleState;
+
+struct IoThrottle
+{
+    MemContext *memContext;                                         // Mem context
+    const String *statePath;                                        // State file shared between processes (NULL if not shared)
+    int fd;                                                         // State file descriptor (-1 if not open)
+    IoThrottleState state;                                          // State when not shared
+    IoThrottleLimitCallback *callback;                              // Get current limits
+    void *callbackData;                                             // Data to pass to callback
+    IoThrottleLimit limit;                                          // Current limits
+    uint64_t limitTime;                                             // When limits were last refreshed (usec)
+};
+
+/***********************************************************************************************************************************
+Current time in usec and sleep. These are separate functions so a virtual clock can be substituted for testing.
+***********************************************************************************************************************************/
+#define IO_THROTTLE_USEC_PER_MSEC                                   ((uint64_t)1000)
+#define IO_THROTTLE_USEC_PER_SEC                                    (IO_THROTTLE_USEC_PER_MSEC * MSEC_PER_SEC)
+
+static uint64_t
+ioThrottleTime(void)
+{
+    FUNCTION_TEST_VOID();
+
+    struct timeval currentTime;
+    gettimeofday(&currentTime, NULL);
+
+    FUNCTION_TEST_RETURN((uint64_t)currentTime.tv_sec * IO_THROTTLE_USEC_PER_SEC + (uint64_t)currentTime.tv_usec);
+}
+
+static void
+ioThrottleSleep(const uint64_t sleepTime)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(UINT64, sleepTime);
+    FUNCTION_TEST_END();
+
+    sleepMSec((sleepTime + IO_THROTTLE_USEC_PER_MSEC - 1) / IO_THROTTLE_USEC_PER_MSEC);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Close the state file
+***********************************************************************************************************************************/
+static void
+ioThrottleFreeResource(THIS_VOID)
+{
+    THIS(IoThrottle);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(IO_THROTTLE, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    if (this->fd != -1)
+        close(this->fd);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+IoThrottle *
+ioThrottleNew(const String *const statePath, IoThrottleLimitCallback *const callback, void *const callbackData)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING, statePath);
+        FUNCTION_LOG_PARAM(FUNCTIONP, callback);
+        FUNCTION_LOG_PARAM_P(VOID, callbackData);
+    FUNCTION_LOG_END();
+
+    ASSERT(callback != NULL);
+
+    IoThrottle *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("IoThrottle")
+    {
+        this = memNew(sizeof(IoThrottle));
+
+        *this = (IoThrottle)
+        {
+            .memContext = MEM_CONTEXT_NEW(),
+            .statePath = strDup(statePath),
+            .fd = -1,
+            .callback = callback,
+            .callbackData = callbackData,
+            .limit = callback(callbackData),
+            .limitTime = ioThrottleTime(),
+        };
+
+        memContextCallbackSet(this->memContext, ioThrottleFreeResource, this);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(IO_THROTTLE, this);
+}
+
+/***********************************************************************************************************************************
+Advance a virtual clock by the cost of the operation. The clock is never allowed to fall more than a burst behind the current time
+so that idle time cannot be saved up and spent all at once.
+***********************************************************************************************************************************/
+static void
+ioThrottleClock(uint64_t *const clock, const uint64_t timeNow, const uint64_t rate, const uint64_t amount)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(UINT64, clock);
+        FUNCTION_TEST_PARAM(UINT64, timeNow);
+        FUNCTION_TEST_PARAM(UINT64, rate);
+        FUNCTION_TEST_PARAM(UINT64, amount);
+    FUNCTION_TEST_END();
+
+    if (rate > 0)
+    {
+        const uint64_t timeMin = timeNow - IO_THROTTLE_BURST * IO_THROTTLE_USEC_PER_MSEC;
+
+        if (*clock < timeMin)
+            *clock = timeMin;
+
+        *clock += amount * IO_THROTTLE_USEC_PER_SEC / rate;
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+ioThrottleConsume(IoThrottle *const this, const size_t size)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(IO_THROTTLE, this);
+        FUNCTION_LOG_PARAM(SIZE, size);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    // Refresh limits
+    if (ioThrottleTime() - this->limitTime >= IO_THROTTLE_REFRESH * IO_THROTTLE_USEC_PER_MSEC)
+    {
+        this->limit = this->callback(this->callbackData);
+        this->limitTime = ioThrottleTime();
+    }
+
+    if (this->limit.byteRate > 0 || this->limit.opRate > 0)
+    {
+        // Open the state file on first use
+        if (this->statePath != NULL && this->fd == -1)
+        {
+            THROW_ON_SYS_ERROR_FMT(
+                (this->fd = open(strZ(this->statePath), O_RDWR | O_CREAT | O_CLOEXEC, 0640)) == -1, FileOpenError,
+                "unable to open throttle state file '%s'", strZ(this->statePath));
+        }
+
+        // Lock and read shared state
+        IoThrottleState state = this->state;
+
+        if (this->fd != -1)
+        {
+            THROW_ON_SYS_ERROR_FMT(
+                flock(this->fd, LOCK_EX) == -1, FileOpenError, "unable to lock throttle state file '%s'", strZ(this->statePath));
+
+            // A new file will be empty so start the clocks from zero
+            const ssize_t readSize = pread(this->fd, &state, sizeof(state), 0);
+
+            THROW_ON_SYS_ERROR_FMT(
+                readSize == -1, FileReadError, "unable to read throttle state file '%s'", strZ(this->statePath));
+
+            if ((size_t)readSize != sizeof(state))
+                state = (IoThrottleState){0};
+        }
+
+        // Advance the clocks
+        const uint64_t timeNow = ioThrottleTime();
+
+        ioThrottleClock(&state.byteTime, timeNow, this->limit.byteRate, size);
+        ioThrottleClock(&state.opTime, timeNow, this->limit.opRate, 1);
+
+        // Write and unlock shared state
+        if (this->fd != -1)
+        {
+            THROW_ON_SYS_ERROR_FMT(
+                pwrite(this->fd, &state, sizeof(state), 0) != (ssize_t)sizeof(state), FileWriteError,
+                "unable to write throttle state file '%s'", strZ(this->statePath));
+            THROW_ON_SYS_ERROR_FMT(
+                flock(this->fd, LOCK_UN) == -1, FileOpenError, "unable to unlock throttle state file '%s'",
+                strZ(this->statePath));
+        }
+        else
+            this->state = state;
+
+        // Sleep until the operation has been paid for
+        const uint64_t timeWait = state.byteTime > state.opTime ? state.byteTime : state.opTime;
+
+        if (timeWait > timeNow)
+            ioThrottleSleep(timeWait - timeNow);
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
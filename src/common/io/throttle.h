@@ -0,0 +1,67 @@
+/***********************************************************************************************************************************
+IO Throttle
+
+Limit the rate of bytes and operations passing through IoRead/IoWrite objects that share the throttle. Each driver read or write is
+one operation and the caller sleeps when it gets ahead of the limits.
+
+Limits are enforced using a virtual clock (the time when the bucket will next be empty), which allows bursts of up to
+IO_THROTTLE_BURST of work before sleeping. The clock can be kept in a file so that all processes using the same file share the
+limits. Otherwise the limits apply to the current process only.
+***********************************************************************************************************************************/
+#ifndef COMMON_IO_THROTTLE_H
+#define COMMON_IO_THROTTLE_H
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+typedef struct IoThrottle IoThrottle;
+
+#include "common/time.h"
+#include "common/type/object.h"
+#include "common/type/string.h"
+
+/***********************************************************************************************************************************
+Limits (0 for no limit). The callback is called when the throttle is created and then at most once per IO_THROTTLE_REFRESH so the
+limits can be changed while IO is in progress.
+***********************************************************************************************************************************/
+#define IO_THROTTLE_BURST                                           (MSEC_PER_SEC / 10)
+#define IO_THROTTLE_REFRESH                                         MSEC_PER_SEC
+
+typedef struct IoThrottleLimit
+{
+    uint64_t byteRate;                                              // Bytes per second
+    uint64_t opRate;                                                // Operations per second
+} IoThrottleLimit;
+
+typedef IoThrottleLimit IoThrottleLimitCallback(void *callbackData);
+
+/***********************************************************************************************************************************
+Constructors
+***********************************************************************************************************************************/
+// The state file is created when the first limited operation is throttled. If NULL then the throttle is not shared.
+IoThrottle *ioThrottleNew(const String *statePath, IoThrottleLimitCallback *callback, void *callbackData);
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Count an operation of the specified size and sleep if the limits have been exceeded
+void ioThrottleConsume(IoThrottle *this, size_t size);
+
+/***********************************************************************************************************************************
+Destructor
+***********************************************************************************************************************************/
+__attribute__((always_inline)) static inline void
+ioThrottleFree(IoThrottle *const this)
+{
+    objFree(this);
+}
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_IO_THROTTLE_TYPE                                                                                              \
+    IoThrottle *
+#define FUNCTION_LOG_IO_THROTTLE_FORMAT(value, buffer, bufferSize)                                                                 \
+    objToLog(value, "IoThrottle", buffer, bufferSize)
+
+#endif
@@ -14,6 +14,7 @@ TLS Client
 #include "common/io/client.h"
 #include "common/io/io.h"
 #include "common/io/tls/client.h"
+#include "common/io/tls/common.h"
 #include "common/io/tls/session.h"
 #include "common/memContext.h"
 #include "common/stat.h"
@@ -79,30 +80,6 @@ tlsClientFreeResource(THIS_VOID)
     FUNCTION_LOG_RETURN_VOID();
 }
 
-/***********************************************************************************************************************************
-Convert an ASN1 string used in certificates to a String
-***********************************************************************************************************************************/
-static String *
-asn1ToStr(ASN1_STRING *nameAsn1)
-{
-    FUNCTION_TEST_BEGIN();
-        FUNCTION_TEST_PARAM_P(VOID, nameAsn1);
-    FUNCTION_TEST_END();
-
-    // The name should not be null
-    if (nameAsn1 == NULL)                                                                                           // {vm_covered}
-        THROW(CryptoError, "TLS certificate name entry is missing");
-
-    FUNCTION_TEST_RETURN(                                                                                           // {vm_covered}
-        strNewN(
-#if OPENSSL_VERSION_NUMBER < 0x10100000L
-            (const char *)ASN1_STRING_data(nameAsn1),
-#else
-            (const char *)ASN1_STRING_get0_data(nameAsn1),
-#endif
-            (size_t)ASN1_STRING_length(nameAsn1)));
-}
-
 /***********************************************************************************************************************************
 Check if a name from the server certificate matches the hostname
 
@@ -187,7 +164,7 @@ tlsClientHostVerify(const String *host, X509 *certificate)
                 altNameFound = true;                                                                                // {vm_covered}
 
                 if (name->type == GEN_DNS)                                                                          // {vm_covered}
-                    result = tlsClientHostVerifyName(host, asn1ToStr(name->d.dNSName));                             // {vm_covered}
+                    result = tlsClientHostVerifyName(host, tlsAsn1ToStr(name->d.dNSName));                          // {vm_covered}
 
                 if (result != false)                                                                                // {vm_covered}
                     break;                                                                                          // {vm_covered}
@@ -208,7 +185,7 @@ tlsClientHostVerify(const String *host, X509 *certificate)
 
             result = tlsClientHostVerifyName(                                                                       // {vm_covered}
                 host,                                                                                               // {vm_covered}
-                asn1ToStr(X509_NAME_ENTRY_get_data(X509_NAME_get_entry(subjectName, commonNameIndex))));            // {vm_covered}
+                tlsAsn1ToStr(X509_NAME_ENTRY_get_data(X509_NAME_get_entry(subjectName, commonNameIndex))));         // {vm_covered}
         }
     }
     MEM_CONTEXT_TEMP_END();                                                                                         // {vm_covered}
@@ -338,18 +315,23 @@ static const IoClientInterface tlsClientInterface =
 };
 
 IoClient *
-tlsClientNew(IoClient *ioClient, const String *host, TimeMSec timeout, bool verifyPeer, const String *caFile, const String *caPath)
+tlsClientNew(
+    IoClient *const ioClient, const String *const host, const TimeMSec timeout, const bool verifyPeer,
+    const TlsClientNewParam param)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug)
         FUNCTION_LOG_PARAM(IO_CLIENT, ioClient);
         FUNCTION_LOG_PARAM(STRING, host);
         FUNCTION_LOG_PARAM(TIME_MSEC, timeout);
         FUNCTION_LOG_PARAM(BOOL, verifyPeer);
-        FUNCTION_LOG_PARAM(STRING, caFile);
-        FUNCTION_LOG_PARAM(STRING, caPath);
+        FUNCTION_LOG_PARAM(STRING, param.caFile);
+        FUNCTION_LOG_PARAM(STRING, param.caPath);
+        FUNCTION_LOG_PARAM(STRING, param.certFile);
+        FUNCTION_LOG_PARAM(STRING, param.keyFile);
     FUNCTION_LOG_END();
 
     ASSERT(ioClient != NULL);
+    ASSERT((param.certFile == NULL && param.keyFile == NULL) || (param.certFile != NULL && param.keyFile != NULL));
 
     IoClient *this = NULL;
 
@@ -368,34 +350,19 @@ tlsClientNew(IoClient *ioClient, const String *host, TimeMSec timeout, bool veri
 
         // Setup TLS context
         // -------------------------------------------------------------------------------------------------------------------------
-        cryptoInit();
-
-        // Select the TLS method to use.  To maintain compatibility with older versions of OpenSSL we need to use an SSL method,
-        // but SSL versions will be excluded in SSL_CTX_set_options().
-        const SSL_METHOD *method = SSLv23_method();
-        cryptoError(method == NULL, "unable to load TLS method");
-
-        // Create the TLS context
-        driver->context = SSL_CTX_new(method);
-        cryptoError(driver->context == NULL, "unable to create TLS context");
-
+        driver->context = tlsContext();
         memContextCallbackSet(driver->memContext, tlsClientFreeResource, driver);
 
-        // Exclude SSL versions to only allow TLS and also disable compression
-        SSL_CTX_set_options(driver->context, (long)(SSL_OP_ALL | SSL_OP_NO_SSLv2 | SSL_OP_NO_SSLv3 | SSL_OP_NO_COMPRESSION));
-
-        // Disable auto-retry to prevent SSL_read() from hanging
-        SSL_CTX_clear_mode(driver->context, SSL_MODE_AUTO_RETRY);
-
         // Set location of CA certificates if the server certificate will be verified
         // -------------------------------------------------------------------------------------------------------------------------
         if (driver->verifyPeer)
         {
             // If the user specified a location
-            if (caFile != NULL || caPath != NULL)                                                                   // {vm_covered}
+            if (param.caFile != NULL || param.caPath != NULL)                                                       // {vm_covered}
             {
                 cryptoError(                                                                                        // {vm_covered}
-                    SSL_CTX_load_verify_locations(driver->context, strZNull(caFile), strZNull(caPath)) != 1,        // {vm_covered}
+                    SSL_CTX_load_verify_locations(                                                                  // {vm_covered}
+                        driver->context, strZNull(param.caFile), strZNull(param.caPath)) != 1,                      // {vm_covered}
                     "unable to set user-defined CA certificate location");                                          // {vm_covered}
             }
             // Else use the defaults
@@ -406,6 +373,11 @@ tlsClientNew(IoClient *ioClient, const String *host, TimeMSec timeout, bool veri
             }
         }
 
+        // Load certificate and key, if specified, so the client can be authenticated by the server
+        // -------------------------------------------------------------------------------------------------------------------------
+        if (param.certFile != NULL)
+            tlsCertKeyLoad(driver->context, param.certFile, param.keyFile);
+
         statInc(TLS_STAT_CLIENT_STR);
 
         // Create client interface
@@ -10,6 +10,8 @@ This object is intended to be used for multiple TLS sessions so ioClientOpen() c
 #define COMMON_IO_TLS_CLIENT_H
 
 #include "common/io/client.h"
+#include "common/time.h"
+#include "common/type/param.h"
 
 /***********************************************************************************************************************************
 Io client type
@@ -29,8 +31,19 @@ Statistics constants
 /***********************************************************************************************************************************
 Constructors
 ***********************************************************************************************************************************/
-IoClient *tlsClientNew(
-    IoClient *ioClient, const String *host, TimeMSec timeout, bool verifyPeer, const String *caFile, const String *caPath);
+typedef struct TlsClientNewParam
+{
+    VAR_PARAM_HEADER;
+    const String *caFile;                                           // Certificate authority file
+    const String *caPath;                                           // Certificate authority path
+    const String *certFile;                                         // Client certificate file (used when the server verifies peer)
+    const String *keyFile;                                          // Client key file (must be set when certFile is set)
+} TlsClientNewParam;
+
+#define tlsClientNewP(ioClient, host, timeout, verifyPeer, ...)                                                                    \
+    tlsClientNew(ioClient, host, timeout, verifyPeer, (TlsClientNewParam){VAR_PARAM_INIT, __VA_ARGS__})
+
+IoClient *tlsClientNew(IoClient *ioClient, const String *host, TimeMSec timeout, bool verifyPeer, TlsClientNewParam param);
 
 /***********************************************************************************************************************************
 Functions
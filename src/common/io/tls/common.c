@@ -0,0 +1,115 @@
+/***********************************************************************************************************************************
+TLS Common
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <string.h>
+
+#include <openssl/err.h>
+
+#include "common/crypto/common.h"
+#include "common/debug.h"
+#include "common/io/tls/common.h"
+#include "common/log.h"
+
+/**********************************************************************************************************************************/
+SSL_CTX *
+tlsContext(void)
+{
+    FUNCTION_TEST_VOID();
+
+    cryptoInit();
+
+    // Select the TLS method to use. To maintain compatibility with older versions of OpenSSL we need to use an SSL method, but SSL
+    // versions will be excluded in SSL_CTX_set_options().
+    const SSL_METHOD *const method = SSLv23_method();
+    cryptoError(method == NULL, "unable to load TLS method");
+
+    // Create the TLS context
+    SSL_CTX *const result = SSL_CTX_new(method);
+    cryptoError(result == NULL, "unable to create TLS context");
+
+    // Exclude SSL versions to only allow TLS and also disable compression
+    SSL_CTX_set_options(result, (long)(SSL_OP_ALL | SSL_OP_NO_SSLv2 | SSL_OP_NO_SSLv3 | SSL_OP_NO_COMPRESSION));
+
+    // Disable auto-retry to prevent SSL_read() from hanging
+    SSL_CTX_clear_mode(result, SSL_MODE_AUTO_RETRY);
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+void
+tlsCertKeyLoad(SSL_CTX *const context, const String *const certFile, const String *const keyFile)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM_P(VOID, context);
+        FUNCTION_LOG_PARAM(STRING, certFile);
+        FUNCTION_LOG_PARAM(STRING, keyFile);
+    FUNCTION_LOG_END();
+
+    ASSERT(context != NULL);
+    ASSERT(certFile != NULL);
+    ASSERT(keyFile != NULL);
+
+    if (SSL_CTX_use_certificate_chain_file(context, strZ(certFile)) != 1)
+        cryptoErrorCode(ERR_get_error(), strZ(strNewFmt("unable to load cert file '%s'", strZ(certFile))));
+
+    if (SSL_CTX_use_PrivateKey_file(context, strZ(keyFile), SSL_FILETYPE_PEM) != 1)
+        cryptoErrorCode(ERR_get_error(), strZ(strNewFmt("unable to load key file '%s'", strZ(keyFile))));
+
+    if (SSL_CTX_check_private_key(context) != 1)
+    {
+        cryptoErrorCode(
+            ERR_get_error(), strZ(strNewFmt("cert '%s' and key '%s' do not match", strZ(certFile), strZ(keyFile))));
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+String *
+tlsAsn1ToStr(ASN1_STRING *const nameAsn1)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, nameAsn1);
+    FUNCTION_TEST_END();
+
+    // The name should not be null
+    if (nameAsn1 == NULL)                                                                                           // {vm_covered}
+        THROW(CryptoError, "TLS certificate name entry is missing");
+
+    FUNCTION_TEST_RETURN(                                                                                           // {vm_covered}
+        strNewN(
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
+            (const char *)ASN1_STRING_data(nameAsn1),
+#else
+            (const char *)ASN1_STRING_get0_data(nameAsn1),
+#endif
+            (size_t)ASN1_STRING_length(nameAsn1)));
+}
+
+/**********************************************************************************************************************************/
+String *
+tlsCertCommonName(X509 *const certificate)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM_P(VOID, certificate);
+    FUNCTION_LOG_END();
+
+    ASSERT(certificate != NULL);
+
+    X509_NAME *const subjectName = X509_get_subject_name(certificate);
+    CHECK(subjectName != NULL);
+
+    const int commonNameIndex = X509_NAME_get_index_by_NID(subjectName, NID_commonName, -1);
+    CHECK(commonNameIndex >= 0);
+
+    String *const result = tlsAsn1ToStr(X509_NAME_ENTRY_get_data(X509_NAME_get_entry(subjectName, commonNameIndex)));
+
+    // Reject embedded nulls in the common name to prevent attacks like CVE-2009-4034
+    if (strlen(strZ(result)) != strSize(result))
+        THROW(CryptoError, "TLS certificate name contains embedded null");
+
+    FUNCTION_LOG_RETURN(STRING, result);
+}
@@ -0,0 +1,27 @@
+/***********************************************************************************************************************************
+TLS Common
+***********************************************************************************************************************************/
+#ifndef COMMON_IO_TLS_COMMON_H
+#define COMMON_IO_TLS_COMMON_H
+
+#include <openssl/ssl.h>
+#include <openssl/x509v3.h>
+
+#include "common/type/string.h"
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Create a TLS context with the options shared by clients and servers, i.e. only TLS is allowed and compression is disabled
+SSL_CTX *tlsContext(void);
+
+// Load a certificate and the matching private key into a TLS context
+void tlsCertKeyLoad(SSL_CTX *context, const String *certFile, const String *keyFile);
+
+// Convert an ASN1 string used in certificates to a String
+String *tlsAsn1ToStr(ASN1_STRING *nameAsn1);
+
+// Get the common name from a certificate
+String *tlsCertCommonName(X509 *certificate);
+
+#endif
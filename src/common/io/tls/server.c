@@ -0,0 +1,211 @@
+/***********************************************************************************************************************************
+TLS Server
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <openssl/err.h>
+
+#include "common/crypto/common.h"
+#include "common/debug.h"
+#include "common/io/server.h"
+#include "common/io/tls/client.h"
+#include "common/io/tls/common.h"
+#include "common/io/tls/server.h"
+#include "common/io/tls/session.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/stat.h"
+#include "common/type/object.h"
+
+/***********************************************************************************************************************************
+Statistics constants
+***********************************************************************************************************************************/
+STRING_EXTERN(TLS_STAT_SERVER_STR,                                  TLS_STAT_SERVER);
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+typedef struct TlsServer
+{
+    MemContext *memContext;                                         // Mem context
+    String *host;                                                   // Host name used to identify the server
+    TimeMSec timeout;                                               // Timeout for any i/o operation (connect, read, etc.)
+
+    SSL_CTX *context;                                               // TLS context
+} TlsServer;
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+static String *
+tlsServerToLog(const THIS_VOID)
+{
+    THIS(const TlsServer);
+
+    return strNewFmt("{host: %s, timeout: %" PRIu64 "}", strZ(this->host), this->timeout);
+}
+
+#define FUNCTION_LOG_TLS_SERVER_TYPE                                                                                               \
+    TlsServer *
+#define FUNCTION_LOG_TLS_SERVER_FORMAT(value, buffer, bufferSize)                                                                  \
+    FUNCTION_LOG_STRING_OBJECT_FORMAT(value, tlsServerToLog, buffer, bufferSize)
+
+/***********************************************************************************************************************************
+Free context
+***********************************************************************************************************************************/
+static void
+tlsServerFreeResource(THIS_VOID)
+{
+    THIS(TlsServer);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(TLS_SERVER, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    SSL_CTX_free(this->context);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Negotiate TLS on a session accepted by the underlying server and verify the client certificate
+***********************************************************************************************************************************/
+static IoSession *
+tlsServerAccept(THIS_VOID, IoSession *const ioSession)
+{
+    THIS(TlsServer);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(TLS_SERVER, this);
+        FUNCTION_LOG_PARAM(IO_SESSION, ioSession);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(ioSession != NULL);
+    ASSERT(ioSessionRole(ioSession) == ioSessionRoleServer);
+
+    IoSession *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Create internal TLS session. If there is a failure before the TlsSession object is created there may be a leak of the TLS
+        // session but this is likely to result in program termination so it doesn't seem worth coding for.
+        SSL *session = SSL_new(this->context);
+        cryptoError(session == NULL, "unable to create TLS session");
+
+        // Create the TLS session. The handshake will fail if the client does not present a certificate signed by the CA.
+        result = tlsSessionNew(session, ioSession, this->timeout);
+
+        // Verify that the chain of trust leads to a valid CA and mark the session as authenticated with the certificate common name
+        // as the peer name
+        const long verifyResult = SSL_get_verify_result(session);
+
+        if (verifyResult != X509_V_OK)
+        {
+            THROW_FMT(
+                CryptoError, "unable to verify certificate presented by client: [%ld] %s", verifyResult,
+                X509_verify_cert_error_string(verifyResult));
+        }
+
+        X509 *const certificate = SSL_get_peer_certificate(session);
+
+        if (certificate == NULL)
+            THROW(CryptoError, "no certificate presented by the TLS client");
+
+        TRY_BEGIN()
+        {
+            ioSessionPeerNameSet(result, tlsCertCommonName(certificate));
+        }
+        FINALLY()
+        {
+            X509_free(certificate);
+        }
+        TRY_END();
+
+        ioSessionAuthenticatedSet(result, true);
+        ioSessionMove(result, memContextPrior());
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    statInc(TLS_STAT_SESSION_STR);
+
+    FUNCTION_LOG_RETURN(IO_SESSION, result);
+}
+
+/**********************************************************************************************************************************/
+static const String *
+tlsServerName(THIS_VOID)
+{
+    THIS(TlsServer);
+
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(TLS_SERVER, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    FUNCTION_TEST_RETURN(this->host);
+}
+
+/**********************************************************************************************************************************/
+static const IoServerInterface tlsServerInterface =
+{
+    .type = IO_SERVER_TLS_TYPE,
+    .name = tlsServerName,
+    .accept = tlsServerAccept,
+    .toLog = tlsServerToLog,
+};
+
+IoServer *
+tlsServerNew(
+    const String *const host, const String *const caFile, const String *const keyFile, const String *const certFile,
+    const TimeMSec timeout)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug)
+        FUNCTION_LOG_PARAM(STRING, host);
+        FUNCTION_LOG_PARAM(STRING, caFile);
+        FUNCTION_LOG_PARAM(STRING, keyFile);
+        FUNCTION_LOG_PARAM(STRING, certFile);
+        FUNCTION_LOG_PARAM(TIME_MSEC, timeout);
+    FUNCTION_LOG_END();
+
+    ASSERT(host != NULL);
+    ASSERT(caFile != NULL);
+    ASSERT(keyFile != NULL);
+    ASSERT(certFile != NULL);
+
+    IoServer *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("TlsServer")
+    {
+        TlsServer *const driver = memNew(sizeof(TlsServer));
+
+        *driver = (TlsServer)
+        {
+            .memContext = MEM_CONTEXT_NEW(),
+            .host = strDup(host),
+            .timeout = timeout,
+        };
+
+        // Setup TLS context
+        driver->context = tlsContext();
+        memContextCallbackSet(driver->memContext, tlsServerFreeResource, driver);
+
+        // Load server certificate and key
+        tlsCertKeyLoad(driver->context, certFile, keyFile);
+
+        // Load the CA used to verify client certificates and require clients to present a certificate
+        cryptoError(
+            SSL_CTX_load_verify_locations(driver->context, strZ(caFile), NULL) != 1, "unable to set CA certificate location");
+        SSL_CTX_set_verify(driver->context, SSL_VERIFY_PEER | SSL_VERIFY_FAIL_IF_NO_PEER_CERT, NULL);
+
+        statInc(TLS_STAT_SERVER_STR);
+
+        this = ioServerNew(driver, &tlsServerInterface);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(IO_SERVER, this);
+}
@@ -0,0 +1,32 @@
+/***********************************************************************************************************************************
+TLS Server
+
+A TLS server that accepts sessions from a lower level server (usually a SocketServer) and negotiates TLS on top of them. Clients are
+required to present a certificate signed by the configured CA. If the certificate is valid the session will be marked as
+authenticated and the peer name will be set to the certificate common name so the caller can decide what the client is allowed to
+do.
+***********************************************************************************************************************************/
+#ifndef COMMON_IO_TLS_SERVER_H
+#define COMMON_IO_TLS_SERVER_H
+
+#include "common/io/server.h"
+#include "common/time.h"
+
+/***********************************************************************************************************************************
+Io server type
+***********************************************************************************************************************************/
+#define IO_SERVER_TLS_TYPE                                          STRID5("tls", 0x4d940)
+
+/***********************************************************************************************************************************
+Statistics constants
+***********************************************************************************************************************************/
+#define TLS_STAT_SERVER                                             "tls.server"        // Servers created
+    STRING_DECLARE(TLS_STAT_SERVER_STR);
+
+/***********************************************************************************************************************************
+Constructors
+***********************************************************************************************************************************/
+IoServer *tlsServerNew(
+    const String *host, const String *caFile, const String *keyFile, const String *certFile, TimeMSec timeout);
+
+#endif
@@ -20,6 +20,7 @@ struct IoWrite
     void *driver;                                                   // Driver object
     IoWriteInterface interface;                                     // Driver interface
     Buffer *output;                                                 // Output buffer
+    IoThrottle *throttle;                                           // Throttle driver writes (NULL if not throttled)
 
 #ifdef DEBUG
     bool filterGroupSet;                                            // Were filters set?
@@ -63,6 +64,28 @@ ioWriteNew(void *driver, IoWriteInterface interface)
     FUNCTION_LOG_RETURN(IO_WRITE, this);
 }
 
+/***********************************************************************************************************************************
+Write the output buffer to the driver
+***********************************************************************************************************************************/
+static void
+ioWriteDriver(IoWrite *const this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_WRITE, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(!bufEmpty(this->output));
+
+    if (this->throttle != NULL)
+        ioThrottleConsume(this->throttle, bufUsed(this->output));
+
+    this->interface.write(this->driver, this->output);
+    bufUsedZero(this->output);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 void
 ioWriteOpen(IoWrite *this)
@@ -114,8 +137,7 @@ ioWrite(IoWrite *this, const Buffer *buffer)
             // Write data if the buffer is full
             if (bufRemains(this->output) == 0)
             {
-                this->interface.write(this->driver, this->output);
-                bufUsedZero(this->output);
+                ioWriteDriver(this);
             }
         }
         while (ioFilterGroupInputSame(this->pub.filterGroup));
@@ -210,8 +232,7 @@ ioWriteFlush(IoWrite *this)
 
     if (!bufEmpty(this->output))
     {
-        this->interface.write(this->driver, this->output);
-        bufUsedZero(this->output);
+        ioWriteDriver(this);
     }
 
     FUNCTION_LOG_RETURN_VOID();
@@ -236,8 +257,7 @@ ioWriteClose(IoWrite *this)
         // Write data if the buffer is full or if this is the last buffer to be written
         if (bufRemains(this->output) == 0 || (ioFilterGroupDone(this->pub.filterGroup) && !bufEmpty(this->output)))
         {
-            this->interface.write(this->driver, this->output);
-            bufUsedZero(this->output);
+            ioWriteDriver(this);
         }
     }
     while (!ioFilterGroupDone(this->pub.filterGroup));
@@ -256,6 +276,22 @@ ioWriteClose(IoWrite *this)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/**********************************************************************************************************************************/
+void
+ioWriteThrottleSet(IoWrite *const this, IoThrottle *const throttle)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_WRITE, this);
+        FUNCTION_TEST_PARAM(IO_THROTTLE, throttle);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    this->throttle = throttle;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 int
 ioWriteFd(const IoWrite *this)
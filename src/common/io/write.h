@@ -14,6 +14,7 @@ Object type
 typedef struct IoWrite IoWrite;
 
 #include "common/io/filter/group.h"
+#include "common/io/throttle.h"
 #include "common/io/write.intern.h"
 #include "common/type/buffer.h"
 #include "common/type/object.h"
@@ -37,6 +38,9 @@ ioWriteFilterGroup(IoWrite *const this)
 // File descriptor for the write object. Not all write objects have a file descriptor and -1 will be returned in that case.
 int ioWriteFd(const IoWrite *this);
 
+// Throttle driver writes. The throttle is owned by the caller and must not be freed before the write object.
+void ioWriteThrottleSet(IoWrite *this, IoThrottle *throttle);
+
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
@@ -31,6 +31,9 @@ typedef struct MemContextAlloc
     unsigned int size:32;                                           // Allocation size (4GB max)
 } MemContextAlloc;
 
+// Allocation index used for allocations in an arena, which are not in the allocation list
+#define MEM_CONTEXT_ALLOC_IDX_ARENA                                 UINT32_MAX
+
 // Get the allocation buffer pointer given the allocation header pointer
 #define MEM_CONTEXT_ALLOC_BUFFER(header)                            ((MemContextAlloc *)header + 1)
 
@@ -45,12 +48,35 @@ typedef struct MemContextAlloc
         alloc->allocIdx < memContextStack[memContextCurrentStackIdx].memContext->allocListSize &&                                  \
         memContextStack[memContextCurrentStackIdx].memContext->allocList[alloc->allocIdx]);
 
+// Is the allocation in an arena? The pointer is checked first so invalid allocations fall through to ASSERT_ALLOC_VALID().
+#define MEM_CONTEXT_ALLOC_ARENA(alloc)                                                                                             \
+    (alloc != NULL && (uintptr_t)alloc != (uintptr_t)-sizeof(MemContextAlloc) && alloc->allocIdx == MEM_CONTEXT_ALLOC_IDX_ARENA)
+
+/***********************************************************************************************************************************
+Arena chunk header. Small allocations in an arena context are bump allocated from chunks that are only freed when the context is
+freed. The first chunk is small so contexts with few allocations do not waste memory, and each chunk after is twice the size of the
+prior chunk up to a maximum.
+***********************************************************************************************************************************/
+#define MEM_CONTEXT_ARENA_CHUNK_SIZE_MIN                            ((size_t)4 * 1024)
+#define MEM_CONTEXT_ARENA_CHUNK_SIZE_MAX                            ((size_t)64 * 1024)
+
+// Larger allocations are made individually so they can be freed and resized
+#define MEM_CONTEXT_ARENA_ALLOC_SIZE_MAX                            ((size_t)512)
+
+typedef struct MemContextArenaChunk
+{
+    struct MemContextArenaChunk *prior;                             // Prior chunk (chunks are freed in reverse order)
+    size_t size;                                                    // Size of the chunk (excluding this header)
+    size_t used;                                                    // Space used in the chunk
+} MemContextArenaChunk;
+
 /***********************************************************************************************************************************
 Contains information about the memory context
 ***********************************************************************************************************************************/
 struct MemContext
 {
     MemContextState state;                                          // Current state of the context
+    bool arena;                                                     // Are small allocations bump allocated from chunks?
     const char *name;                                               // Indicates what the context is being used for
 
     MemContext *contextParent;                                      // All contexts have a parent except top
@@ -64,6 +90,8 @@ struct MemContext
     unsigned int allocListSize;                                     // Size of alloc list (not the actual count of allocations)
     unsigned int allocFreeIdx;                                      // Index of first free space in the alloc list
 
+    MemContextArenaChunk *arenaChunk;                               // Current arena chunk (NULL when no chunk has been allocated)
+
     void (*callbackFunction)(void *);                               // Function to call before the context is freed
     void *callbackArgument;                                         // Argument to pass to callback function
 };
@@ -259,12 +287,15 @@ memContextNewIndex(MemContext *memContext, bool allowFree)
     FUNCTION_TEST_RETURN(memContext->contextChildFreeIdx);
 }
 
-/**********************************************************************************************************************************/
-MemContext *
-memContextNew(const char *name)
+/***********************************************************************************************************************************
+Create a new mem context
+***********************************************************************************************************************************/
+static MemContext *
+memContextNewInternal(const char *const name, const bool arena)
 {
     FUNCTION_TEST_BEGIN();
         FUNCTION_TEST_PARAM(STRINGZ, name);
+        FUNCTION_TEST_PARAM(BOOL, arena);
     FUNCTION_TEST_END();
 
     ASSERT(name != NULL);
@@ -294,6 +325,7 @@ memContextNew(const char *name)
 
         // Set new context active
         .state = memContextStateActive,
+        .arena = arena,
 
         // Set current context as the parent
         .contextParent = contextCurrent,
@@ -317,6 +349,26 @@ memContextNew(const char *name)
     FUNCTION_TEST_RETURN(this);
 }
 
+MemContext *
+memContextNew(const char *const name)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRINGZ, name);
+    FUNCTION_TEST_END();
+
+    FUNCTION_TEST_RETURN(memContextNewInternal(name, false));
+}
+
+MemContext *
+memContextNewArena(const char *const name)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRINGZ, name);
+    FUNCTION_TEST_END();
+
+    FUNCTION_TEST_RETURN(memContextNewInternal(name, true));
+}
+
 /**********************************************************************************************************************************/
 void
 memContextCallbackSet(MemContext *this, void (*callbackFunction)(void *), void *callbackArgument)
@@ -372,6 +424,52 @@ memContextCallbackClear(MemContext *this)
     FUNCTION_TEST_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Bump allocate memory from the current arena chunk, allocating a new chunk when there is not enough space
+***********************************************************************************************************************************/
+static MemContextAlloc *
+memContextAllocArena(MemContext *const this, const size_t size)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(MEM_CONTEXT, this);
+        FUNCTION_TEST_PARAM(SIZE, size);
+    FUNCTION_TEST_END();
+
+    ASSERT(this->arena);
+    ASSERT(size <= MEM_CONTEXT_ARENA_ALLOC_SIZE_MAX);
+
+    // Round up the allocation so the next allocation has the same alignment as this one
+    const size_t allocSize = (sizeof(MemContextAlloc) + size + sizeof(MemContextAlloc) - 1) & ~(sizeof(MemContextAlloc) - 1);
+
+    // Allocate a new chunk if there is not enough space in the current chunk
+    MemContextArenaChunk *chunk = this->arenaChunk;
+
+    if (chunk == NULL || chunk->size - chunk->used < allocSize)
+    {
+        const size_t chunkSize =
+            chunk == NULL ? MEM_CONTEXT_ARENA_CHUNK_SIZE_MIN :
+                (chunk->size * 2 > MEM_CONTEXT_ARENA_CHUNK_SIZE_MAX ? MEM_CONTEXT_ARENA_CHUNK_SIZE_MAX : chunk->size * 2);
+
+        MemContextArenaChunk *const chunkNew = memAllocInternal(sizeof(MemContextArenaChunk) + chunkSize);
+        *chunkNew = (MemContextArenaChunk){.prior = chunk, .size = chunkSize};
+
+        this->arenaChunk = chunk = chunkNew;
+    }
+
+    // Allocate from the chunk
+    MemContextAlloc *const result = (MemContextAlloc *)((unsigned char *)(chunk + 1) + chunk->used);
+
+    *result = (MemContextAlloc)
+    {
+        .allocIdx = MEM_CONTEXT_ALLOC_IDX_ARENA,
+        .size = (unsigned int)(sizeof(MemContextAlloc) + size),
+    };
+
+    chunk->used += allocSize;
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 /***********************************************************************************************************************************
 Find an available slot in the memory context's allocation list and allocate memory
 ***********************************************************************************************************************************/
@@ -382,9 +480,14 @@ memContextAllocNew(size_t size)
         FUNCTION_TEST_PARAM(SIZE, size);
     FUNCTION_TEST_END();
 
-    // Find space for the new allocation
     MemContext *contextCurrent = memContextStack[memContextCurrentStackIdx].memContext;
 
+    // Small allocations in an arena context are allocated from a chunk
+    if (contextCurrent->arena && size <= MEM_CONTEXT_ARENA_ALLOC_SIZE_MAX)
+        FUNCTION_TEST_RETURN(memContextAllocArena(contextCurrent, size));
+
+    // Find space for the new allocation
+
     for (; contextCurrent->allocFreeIdx < contextCurrent->allocListSize; contextCurrent->allocFreeIdx++)
         if (contextCurrent->allocList[contextCurrent->allocFreeIdx] == NULL)
             break;
@@ -445,6 +548,20 @@ memContextAllocResize(MemContextAlloc *alloc, size_t size)
         FUNCTION_TEST_PARAM(SIZE, size);
     FUNCTION_TEST_END();
 
+    // Arena allocations cannot be resized in place so make a new allocation and copy the contents. The old allocation is freed with
+    // the context.
+    if (MEM_CONTEXT_ALLOC_ARENA(alloc))
+    {
+        ASSERT(memContextStack[memContextCurrentStackIdx].memContext->arena);
+
+        MemContextAlloc *const result = memContextAllocNew(size);
+        const size_t sizeOld = alloc->size - sizeof(MemContextAlloc);
+
+        memcpy(MEM_CONTEXT_ALLOC_BUFFER(result), MEM_CONTEXT_ALLOC_BUFFER(alloc), sizeOld < size ? sizeOld : size);
+
+        FUNCTION_TEST_RETURN(result);
+    }
+
     ASSERT_ALLOC_VALID(alloc);
 
     // Resize the allocation
@@ -506,6 +623,14 @@ memFree(void *buffer)
         FUNCTION_TEST_PARAM_P(VOID, buffer);
     FUNCTION_TEST_END();
 
+    // Arena allocations are freed with the context
+    if (MEM_CONTEXT_ALLOC_ARENA(MEM_CONTEXT_ALLOC_HEADER(buffer)))
+    {
+        ASSERT(memContextStack[memContextCurrentStackIdx].memContext->arena);
+        FUNCTION_TEST_RETURN_VOID();
+        return;
+    }
+
     ASSERT_ALLOC_VALID(MEM_CONTEXT_ALLOC_HEADER(buffer));
 
     // Get the allocation
@@ -759,6 +884,10 @@ memContextSize(const MemContext *this)
             result += this->allocList[allocIdx]->size;
     }
 
+    // Add arena chunks
+    for (const MemContextArenaChunk *chunk = this->arenaChunk; chunk != NULL; chunk = chunk->prior)
+        result += sizeof(MemContextArenaChunk) + chunk->size;
+
     FUNCTION_TEST_RETURN(result);
 }
 
@@ -857,6 +986,15 @@ memContextFree(MemContext *this)
                 this->allocListSize = 0;
             }
 
+            // Free arena chunks
+            while (this->arenaChunk != NULL)
+            {
+                MemContextArenaChunk *const chunkPrior = this->arenaChunk->prior;
+
+                memFreeInternal(this->arenaChunk);
+                this->arenaChunk = chunkPrior;
+            }
+
             // If the context index is lower than the current free index in the parent then replace it
             if (this->contextParent != NULL && this->contextParentIdx < this->contextParent->contextChildFreeIdx)
                 this->contextParent->contextChildFreeIdx = this->contextParentIdx;
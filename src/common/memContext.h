@@ -141,6 +141,10 @@ MEM_CONTEXT_TEMP_END();
 
 <Prior memory context is restored>
 <Temp memory context is freed>
+
+MEM_CONTEXT_TEMP_RESET_BEGIN() creates the temp context with memContextNewArena() since loops that reset the temp context usually
+make many small allocations that are never freed individually. MEM_CONTEXT_TEMP_RESET() frees the temp context and creates a new one
+after the specified number of calls.
 ***********************************************************************************************************************************/
 #define MEM_CONTEXT_TEMP()                                                                                                         \
     MEM_CONTEXT_TEMP_memContext
@@ -152,8 +156,11 @@ MEM_CONTEXT_TEMP_END();
         memContextSwitch(MEM_CONTEXT_TEMP());
 
 #define MEM_CONTEXT_TEMP_RESET_BEGIN()                                                                                             \
-    MEM_CONTEXT_TEMP_BEGIN()                                                                                                       \
-    unsigned int MEM_CONTEXT_TEMP_loopTotal = 0;
+    do                                                                                                                             \
+    {                                                                                                                              \
+        MemContext *MEM_CONTEXT_TEMP() = memContextNewArena("temporary");                                                          \
+        memContextSwitch(MEM_CONTEXT_TEMP());                                                                                      \
+        unsigned int MEM_CONTEXT_TEMP_loopTotal = 0;
 
 #define MEM_CONTEXT_TEMP_RESET(resetTotal)                                                                                         \
     do                                                                                                                             \
@@ -164,7 +171,7 @@ MEM_CONTEXT_TEMP_END();
         {                                                                                                                          \
             memContextSwitchBack();                                                                                                \
             memContextDiscard();                                                                                                   \
-            MEM_CONTEXT_TEMP() = memContextNew("temporary");                                                                       \
+            MEM_CONTEXT_TEMP() = memContextNewArena("temporary");                                                                  \
             memContextSwitch(MEM_CONTEXT_TEMP());                                                                                  \
             MEM_CONTEXT_TEMP_loopTotal = 0;                                                                                        \
         }                                                                                                                          \
@@ -201,6 +208,12 @@ Use the MEM_CONTEXT*() macros when possible rather than reimplement the boilerpl
 // memContextDisard() before switching back from the parent context.
 MemContext *memContextNew(const char *name);
 
+// Create a new mem context where small allocations are bump allocated from chunks owned by the context. This is faster and uses
+// less memory than memContextNew() when there are many small allocations, but memFree() does not release small allocations and
+// memResize() copies them, so the memory is only released when the context is freed. Otherwise the context behaves exactly like
+// a context created with memContextNew().
+MemContext *memContextNewArena(const char *name);
+
 // Switch to a context making it the current mem context
 void memContextSwitch(MemContext *this);
 
@@ -67,14 +67,16 @@ lstClear(List *this)
 
     ASSERT(this != NULL);
 
-    if (this->list != NULL)
+    if (this->listAlloc != NULL)
     {
         MEM_CONTEXT_BEGIN(lstMemContext(this))
         {
-            memFree(this->list);
+            memFree(this->listAlloc);
         }
         MEM_CONTEXT_END();
 
+        this->listAlloc = NULL;
+        this->list = NULL;
         this->pub.listSize = 0;
         this->listSizeMax = 0;
     }
@@ -569,8 +569,10 @@ pckReadTag(PackRead *this, unsigned int *id, PackTypeMap typeMap, bool peek)
             break;
         }
 
-        // Read data for the field being skipped if this is not the field requested
-        if (packTypeMapData[this->tagNextTypeMap].size && this->tagNextValue != 0)
+        // Read data for the field being skipped if this is not the field requested. Types without a value in the tag (e.g. pack)
+        // always have a size.
+        if (packTypeMapData[this->tagNextTypeMap].size &&
+            (this->tagNextValue != 0 || !packTypeMapData[this->tagNextTypeMap].valueSingleBit))
         {
             size_t sizeExpected = (size_t)pckReadU64Internal(this);
 
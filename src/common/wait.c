@@ -18,6 +18,7 @@ struct Wait
     TimeMSec sleepTime;                                             // Next sleep time (in usec)
     TimeMSec sleepPrevTime;                                         // Previous time slept (in usec)
     TimeMSec beginTime;                                             // Time the wait began (in epoch usec)
+    Watch *watch;                                                   // Wake early on changes (NULL to sleep)
 };
 
 /**********************************************************************************************************************************/
@@ -63,6 +64,22 @@ waitNew(TimeMSec waitTime)
     FUNCTION_LOG_RETURN(WAIT, this);
 }
 
+/**********************************************************************************************************************************/
+void
+waitWatchSet(Wait *const this, Watch *const watch)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(WAIT, this);
+        FUNCTION_TEST_PARAM(WATCH, watch);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    this->watch = watch;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 bool
 waitMore(Wait *this)
@@ -78,8 +95,11 @@ waitMore(Wait *this)
     // If sleep is 0 then the wait time has already ended
     if (this->sleepTime > 0)
     {
-        // Sleep required amount
-        sleepMSec(this->sleepTime);
+        // Sleep required amount, or less if the watch reports a change
+        if (this->watch != NULL)
+            watchWait(this->watch, this->sleepTime);
+        else
+            sleepMSec(this->sleepTime);
 
         // Get the end time
         TimeMSec elapsedTime = timeMSec() - this->beginTime;
@@ -11,6 +11,7 @@ typedef struct Wait Wait;
 
 #include "common/time.h"
 #include "common/type/object.h"
+#include "common/watch.h"
 
 /***********************************************************************************************************************************
 Constructors
@@ -33,6 +34,9 @@ waitRemaining(const Wait *const this)
     return THIS_PUB(Wait)->remainTime;
 }
 
+// Wake early when the watch reports a change rather than always sleeping the full interval. The watch is not owned by the wait.
+void waitWatchSet(Wait *this, Watch *watch);
+
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
@@ -0,0 +1,164 @@
+/***********************************************************************************************************************************
+Path Watcher
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <errno.h>
+#include <limits.h>
+#include <poll.h>
+#include <string.h>
+#include <unistd.h>
+
+#ifdef HAVE_INOTIFY
+    #include <sys/inotify.h>
+#endif
+
+#include "common/debug.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/watch.h"
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+struct Watch
+{
+    MemContext *memContext;                                         // Mem context
+    int fd;                                                         // inotify file descriptor (-1 if not available)
+    unsigned int pathTotal;                                         // Number of paths being watched
+};
+
+/***********************************************************************************************************************************
+Close the inotify file descriptor
+***********************************************************************************************************************************/
+#ifdef HAVE_INOTIFY
+
+static void
+watchFreeResource(THIS_VOID)
+{
+    THIS(Watch);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(WATCH, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    if (this->fd != -1)
+        close(this->fd);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+#endif
+
+/**********************************************************************************************************************************/
+Watch *
+watchNew(void)
+{
+    FUNCTION_LOG_VOID(logLevelTrace);
+
+    Watch *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("Watch")
+    {
+        this = memNew(sizeof(Watch));
+
+        *this = (Watch)
+        {
+            .memContext = MEM_CONTEXT_NEW(),
+            .fd = -1,
+        };
+
+#ifdef HAVE_INOTIFY
+        // Failure is not an error since waiting falls back to sleeping, e.g. when the per-user inotify instance limit is reached
+        this->fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+        if (this->fd == -1)
+            LOG_DEBUG_FMT("unable to initialize inotify: [%d] %s", errno, strerror(errno));
+        else
+            memContextCallbackSet(this->memContext, watchFreeResource, this);
+#endif
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(WATCH, this);
+}
+
+/**********************************************************************************************************************************/
+bool
+watchPathAdd(Watch *const this, const String *const path)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(WATCH, this);
+        FUNCTION_LOG_PARAM(STRING, path);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(path != NULL);
+
+    bool result = false;
+
+#ifdef HAVE_INOTIFY
+    if (this->fd != -1)
+    {
+        // Files written in place are reported on close and files written atomically are reported when moved into the path
+        if (inotify_add_watch(this->fd, strZ(path), IN_CLOSE_WRITE | IN_MOVED_TO | IN_ONLYDIR) == -1)
+        {
+            if (errno != ENOENT)
+                THROW_SYS_ERROR_FMT(PathOpenError, "unable to watch path '%s'", strZ(path));
+        }
+        else
+        {
+            this->pathTotal++;
+            result = true;
+        }
+    }
+#endif
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
+
+/**********************************************************************************************************************************/
+bool
+watchWait(Watch *const this, const TimeMSec timeout)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(WATCH, this);
+        FUNCTION_LOG_PARAM(TIMEMSEC, timeout);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(timeout <= INT_MAX);
+
+    bool result = false;
+
+    // Nothing can be reported so sleep for the full timeout
+    if (this->pathTotal == 0)
+        sleepMSec(timeout);
+#ifdef HAVE_INOTIFY
+    else
+    {
+        struct pollfd pollFd = {.fd = this->fd, .events = POLLIN};
+        const int pollResult = poll(&pollFd, 1, (int)timeout);
+
+        // An interrupted wait is reported as a timeout since the caller will check again anyway
+        THROW_ON_SYS_ERROR(pollResult == -1 && errno != EINTR, KernelError, "unable to poll inotify");
+
+        if (pollResult > 0)
+        {
+            // Drain all pending events since they only indicate that something changed. An overflow of the event queue is also
+            // just a change.
+            char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+
+            while (read(this->fd, buffer, sizeof(buffer)) > 0);
+
+            THROW_ON_SYS_ERROR(errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR, KernelError, "unable to read inotify");
+
+            result = true;
+        }
+    }
+#endif
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
@@ -0,0 +1,54 @@
+/***********************************************************************************************************************************
+Path Watcher
+
+Wakes a waiting process when files are written or moved into one or more paths so it does not need to poll for changes.
+Uses inotify when available. Otherwise no paths can be watched and watchWait() sleeps for the full timeout, which is the same
+behavior as polling.
+
+A watch only reports that something changed, not what changed, so the caller must still check for the condition it is waiting on
+after each wake. Add paths before checking so that a change made between the check and the wait is not missed.
+***********************************************************************************************************************************/
+#ifndef COMMON_WATCH_H
+#define COMMON_WATCH_H
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+typedef struct Watch Watch;
+
+#include "common/time.h"
+#include "common/type/object.h"
+#include "common/type/string.h"
+
+/***********************************************************************************************************************************
+Constructors
+***********************************************************************************************************************************/
+Watch *watchNew(void);
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Add a path to the watch. Returns false if the path does not exist (or paths cannot be watched) so the caller can try again later.
+bool watchPathAdd(Watch *this, const String *path);
+
+// Wait until a change is reported in a watched path or the timeout expires. Returns true if a change was reported.
+bool watchWait(Watch *this, TimeMSec timeout);
+
+/***********************************************************************************************************************************
+Destructor
+***********************************************************************************************************************************/
+__attribute__((always_inline)) static inline void
+watchFree(Watch *const this)
+{
+    objFree(this);
+}
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_WATCH_TYPE                                                                                                    \
+    Watch *
+#define FUNCTION_LOG_WATCH_FORMAT(value, buffer, bufferSize)                                                                       \
+    objToLog(value, "Watch", buffer, bufferSize)
+
+#endif
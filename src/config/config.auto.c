@@ -152,6 +152,17 @@ static const ConfigCommandData configCommandData[CFG_COMMAND_TOTAL] = CONFIG_COM
         CONFIG_COMMAND_LOCK_TYPE(lockTypeNone)
     )
 
+    CONFIG_COMMAND
+    (
+        CONFIG_COMMAND_NAME(CFGCMD_SERVER)
+
+        CONFIG_COMMAND_LOG_FILE(true)
+        CONFIG_COMMAND_LOG_LEVEL_DEFAULT(logLevelInfo)
+        CONFIG_COMMAND_LOCK_REQUIRED(false)
+        CONFIG_COMMAND_LOCK_REMOTE_REQUIRED(false)
+        CONFIG_COMMAND_LOCK_TYPE(lockTypeNone)
+    )
+
     CONFIG_COMMAND
     (
         CONFIG_COMMAND_NAME(CFGCMD_STANZA_CREATE)
@@ -22,6 +22,7 @@ Command constants
 #define CFGCMD_REPO_PUT                                             "repo-put"
 #define CFGCMD_REPO_RM                                              "repo-rm"
 #define CFGCMD_RESTORE                                              "restore"
+#define CFGCMD_SERVER                                               "server"
 #define CFGCMD_STANZA_CREATE                                        "stanza-create"
 #define CFGCMD_STANZA_DELETE                                        "stanza-delete"
 #define CFGCMD_STANZA_UPGRADE                                       "stanza-upgrade"
@@ -30,7 +31,7 @@ Command constants
 #define CFGCMD_VERIFY                                               "verify"
 #define CFGCMD_VERSION                                              "version"
 
-#define CFG_COMMAND_TOTAL                                           20
+#define CFG_COMMAND_TOTAL                                           21
 
 /***********************************************************************************************************************************
 Option group constants
@@ -47,8 +48,11 @@ Option constants
 #define CFGOPT_ARCHIVE_HEADER_CHECK                                 "archive-header-check"
 #define CFGOPT_ARCHIVE_MODE                                         "archive-mode"
 #define CFGOPT_ARCHIVE_MODE_CHECK                                   "archive-mode-check"
+#define CFGOPT_ARCHIVE_PUSH_DICT                                    "archive-push-dict"
+#define CFGOPT_ARCHIVE_PUSH_GRACE                                   "archive-push-grace"
 #define CFGOPT_ARCHIVE_PUSH_QUEUE_MAX                               "archive-push-queue-max"
 #define CFGOPT_ARCHIVE_TIMEOUT                                      "archive-timeout"
+#define CFGOPT_BACKUP_CACHE_DROP                                    "backup-cache-drop"
 #define CFGOPT_BACKUP_STANDBY                                       "backup-standby"
 #define CFGOPT_BUFFER_SIZE                                          "buffer-size"
 #define CFGOPT_CHECKSUM_PAGE                                        "checksum-page"
@@ -57,6 +61,7 @@ Option constants
 #define CFGOPT_COMPRESS                                             "compress"
 #define CFGOPT_COMPRESS_LEVEL                                       "compress-level"
 #define CFGOPT_COMPRESS_LEVEL_NETWORK                               "compress-level-network"
+#define CFGOPT_COMPRESS_THREAD                                      "compress-thread"
 #define CFGOPT_COMPRESS_TYPE                                        "compress-type"
 #define CFGOPT_CONFIG                                               "config"
 #define CFGOPT_CONFIG_INCLUDE_PATH                                  "config-include-path"
@@ -73,6 +78,8 @@ Option constants
 #define CFGOPT_FORCE                                                "force"
 #define CFGOPT_IGNORE_MISSING                                       "ignore-missing"
 #define CFGOPT_IO_TIMEOUT                                           "io-timeout"
+#define CFGOPT_IO_URING                                             "io-uring"
+#define CFGOPT_JOB_QUEUE_MAX                                        "job-queue-max"
 #define CFGOPT_JOB_RETRY                                            "job-retry"
 #define CFGOPT_JOB_RETRY_INTERVAL                                   "job-retry-interval"
 #define CFGOPT_LINK_ALL                                             "link-all"
@@ -91,10 +98,13 @@ Option constants
 #define CFGOPT_PG                                                   "pg"
 #define CFGOPT_PROCESS                                              "process"
 #define CFGOPT_PROCESS_MAX                                          "process-max"
+#define CFGOPT_PROTOCOL_MUX                                         "protocol-mux"
 #define CFGOPT_PROTOCOL_TIMEOUT                                     "protocol-timeout"
 #define CFGOPT_RAW                                                  "raw"
 #define CFGOPT_RECOVERY_OPTION                                      "recovery-option"
 #define CFGOPT_RECURSE                                              "recurse"
+#define CFGOPT_REMOTE_MUX                                           "remote-mux"
+#define CFGOPT_REMOTE_MUX_PATH                                      "remote-mux-path"
 #define CFGOPT_REMOTE_TYPE                                          "remote-type"
 #define CFGOPT_REPO                                                 "repo"
 #define CFGOPT_RESUME                                               "resume"
@@ -115,9 +125,19 @@ Option constants
 #define CFGOPT_TCP_KEEP_ALIVE_COUNT                                 "tcp-keep-alive-count"
 #define CFGOPT_TCP_KEEP_ALIVE_IDLE                                  "tcp-keep-alive-idle"
 #define CFGOPT_TCP_KEEP_ALIVE_INTERVAL                              "tcp-keep-alive-interval"
+#define CFGOPT_THROTTLE_READ                                        "throttle-read"
+#define CFGOPT_THROTTLE_READ_IOPS                                   "throttle-read-iops"
+#define CFGOPT_THROTTLE_WRITE                                       "throttle-write"
+#define CFGOPT_THROTTLE_WRITE_IOPS                                  "throttle-write-iops"
+#define CFGOPT_TLS_SERVER_ADDRESS                                   "tls-server-address"
+#define CFGOPT_TLS_SERVER_AUTH                                      "tls-server-auth"
+#define CFGOPT_TLS_SERVER_CA_FILE                                   "tls-server-ca-file"
+#define CFGOPT_TLS_SERVER_CERT_FILE                                 "tls-server-cert-file"
+#define CFGOPT_TLS_SERVER_KEY_FILE                                  "tls-server-key-file"
+#define CFGOPT_TLS_SERVER_PORT                                      "tls-server-port"
 #define CFGOPT_TYPE                                                 "type"
 
-#define CFG_OPTION_TOTAL                                            131
+#define CFG_OPTION_TOTAL                                            164
 
 /***********************************************************************************************************************************
 Option value constants
@@ -158,6 +178,9 @@ Option value constants
 #define CFGOPTVAL_OUTPUT_JSON_Z                                     "json"
 #define CFGOPTVAL_OUTPUT_TEXT_Z                                     "text"
 
+#define CFGOPTVAL_PG_HOST_TYPE_SSH_Z                                "ssh"
+#define CFGOPTVAL_PG_HOST_TYPE_TLS_Z                                "tls"
+
 #define CFGOPTVAL_REMOTE_TYPE_PG_Z                                  "pg"
 #define CFGOPTVAL_REMOTE_TYPE_REPO_Z                                "repo"
 
@@ -171,6 +194,9 @@ Option value constants
 #define CFGOPTVAL_REPO_GCS_KEY_TYPE_SERVICE_Z                       "service"
 #define CFGOPTVAL_REPO_GCS_KEY_TYPE_TOKEN_Z                         "token"
 
+#define CFGOPTVAL_REPO_HOST_TYPE_SSH_Z                              "ssh"
+#define CFGOPTVAL_REPO_HOST_TYPE_TLS_Z                              "tls"
+
 #define CFGOPTVAL_REPO_RETENTION_ARCHIVE_TYPE_DIFF_Z                "diff"
 #define CFGOPTVAL_REPO_RETENTION_ARCHIVE_TYPE_FULL_Z                "full"
 #define CFGOPTVAL_REPO_RETENTION_ARCHIVE_TYPE_INCR_Z                "incr"
@@ -228,6 +254,7 @@ typedef enum
     cfgCmdRepoPut,
     cfgCmdRepoRm,
     cfgCmdRestore,
+    cfgCmdServer,
     cfgCmdStanzaCreate,
     cfgCmdStanzaDelete,
     cfgCmdStanzaUpgrade,
@@ -259,8 +286,11 @@ typedef enum
     cfgOptArchiveHeaderCheck,
     cfgOptArchiveMode,
     cfgOptArchiveModeCheck,
+    cfgOptArchivePushDict,
+    cfgOptArchivePushGrace,
     cfgOptArchivePushQueueMax,
     cfgOptArchiveTimeout,
+    cfgOptBackupCacheDrop,
     cfgOptBackupStandby,
     cfgOptBufferSize,
     cfgOptChecksumPage,
@@ -269,6 +299,7 @@ typedef enum
     cfgOptCompress,
     cfgOptCompressLevel,
     cfgOptCompressLevelNetwork,
+    cfgOptCompressThread,
     cfgOptCompressType,
     cfgOptConfig,
     cfgOptConfigIncludePath,
@@ -285,6 +316,8 @@ typedef enum
     cfgOptForce,
     cfgOptIgnoreMissing,
     cfgOptIoTimeout,
+    cfgOptIoUring,
+    cfgOptJobQueueMax,
     cfgOptJobRetry,
     cfgOptJobRetryInterval,
     cfgOptLinkAll,
@@ -303,11 +336,15 @@ typedef enum
     cfgOptPg,
     cfgOptPgDatabase,
     cfgOptPgHost,
+    cfgOptPgHostCaFile,
+    cfgOptPgHostCertFile,
     cfgOptPgHostCmd,
     cfgOptPgHostConfig,
     cfgOptPgHostConfigIncludePath,
     cfgOptPgHostConfigPath,
+    cfgOptPgHostKeyFile,
     cfgOptPgHostPort,
+    cfgOptPgHostType,
     cfgOptPgHostUser,
     cfgOptPgLocal,
     cfgOptPgPath,
@@ -316,10 +353,13 @@ typedef enum
     cfgOptPgUser,
     cfgOptProcess,
     cfgOptProcessMax,
+    cfgOptProtocolMux,
     cfgOptProtocolTimeout,
     cfgOptRaw,
     cfgOptRecoveryOption,
     cfgOptRecurse,
+    cfgOptRemoteMux,
+    cfgOptRemoteMuxPath,
     cfgOptRemoteType,
     cfgOptRepo,
     cfgOptRepoAzureAccount,
@@ -327,6 +367,10 @@ typedef enum
     cfgOptRepoAzureEndpoint,
     cfgOptRepoAzureKey,
     cfgOptRepoAzureKeyType,
+    cfgOptRepoBlock,
+    cfgOptRepoBundle,
+    cfgOptRepoBundleLimit,
+    cfgOptRepoBundleSize,
     cfgOptRepoCipherPass,
     cfgOptRepoCipherType,
     cfgOptRepoGcsBucket,
@@ -335,11 +379,15 @@ typedef enum
     cfgOptRepoGcsKeyType,
     cfgOptRepoHardlink,
     cfgOptRepoHost,
+    cfgOptRepoHostCaFile,
+    cfgOptRepoHostCertFile,
     cfgOptRepoHostCmd,
     cfgOptRepoHostConfig,
     cfgOptRepoHostConfigIncludePath,
     cfgOptRepoHostConfigPath,
+    cfgOptRepoHostKeyFile,
     cfgOptRepoHostPort,
+    cfgOptRepoHostType,
     cfgOptRepoHostUser,
     cfgOptRepoLocal,
     cfgOptRepoPath,
@@ -357,11 +405,13 @@ typedef enum
     cfgOptRepoS3Region,
     cfgOptRepoS3Role,
     cfgOptRepoS3Token,
+    cfgOptRepoS3UploadConcurrency,
     cfgOptRepoS3UriStyle,
     cfgOptRepoStorageCaFile,
     cfgOptRepoStorageCaPath,
     cfgOptRepoStorageHost,
     cfgOptRepoStoragePort,
+    cfgOptRepoStorageReadConcurrency,
     cfgOptRepoStorageVerifyTls,
     cfgOptRepoType,
     cfgOptResume,
@@ -382,6 +432,16 @@ typedef enum
     cfgOptTcpKeepAliveCount,
     cfgOptTcpKeepAliveIdle,
     cfgOptTcpKeepAliveInterval,
+    cfgOptThrottleRead,
+    cfgOptThrottleReadIops,
+    cfgOptThrottleWrite,
+    cfgOptThrottleWriteIops,
+    cfgOptTlsServerAddress,
+    cfgOptTlsServerAuth,
+    cfgOptTlsServerCaFile,
+    cfgOptTlsServerCertFile,
+    cfgOptTlsServerKeyFile,
+    cfgOptTlsServerPort,
     cfgOptType,
 } ConfigOption;
 
@@ -557,6 +557,25 @@ cfgParseOptionRequired(ConfigCommand commandId, ConfigOption optionId)
     FUNCTION_TEST_RETURN(parseRuleOption[optionId].required);
 }
 
+/**********************************************************************************************************************************/
+bool
+cfgParseOptionRangeValid(const ConfigCommand commandId, const ConfigOption optionId, const int64_t value)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ENUM, commandId);
+        FUNCTION_TEST_PARAM(ENUM, optionId);
+        FUNCTION_TEST_PARAM(INT64, value);
+    FUNCTION_TEST_END();
+
+    ASSERT(commandId < CFG_COMMAND_TOTAL);
+    ASSERT(optionId < CFG_OPTION_TOTAL);
+
+    const ParseRuleOptionData allowRange = parseRuleOptionDataFind(parseRuleOptionDataTypeAllowRange, commandId, optionId);
+
+    FUNCTION_TEST_RETURN(
+        !allowRange.found || (value >= PARSE_RULE_DATA_INT64(allowRange, 0) && value <= PARSE_RULE_DATA_INT64(allowRange, 2)));
+}
+
 /**********************************************************************************************************************************/
 bool
 cfgParseOptionSecure(ConfigOption optionId)
@@ -697,6 +716,17 @@ convertToByte(const String *value)
         THROW_FMT(FormatError, "value '%s' is not valid", strZ(value));
 }
 
+/**********************************************************************************************************************************/
+uint64_t
+cfgParseSize(const String *const value)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, value);
+    FUNCTION_TEST_END();
+
+    FUNCTION_TEST_RETURN(convertToByte(value));
+}
+
 /***********************************************************************************************************************************
 Load the configuration file(s)
 
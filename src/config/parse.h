@@ -71,7 +71,13 @@ ConfigOptionType cfgParseOptionType(ConfigOption optionId);
 // Is the option required?
 bool cfgParseOptionRequired(ConfigCommand commandId, ConfigOption optionId);
 
+// Is the value within the allowed range for the option? Options with no range allow any value.
+bool cfgParseOptionRangeValid(ConfigCommand commandId, ConfigOption optionId, int64_t value);
+
 // Is the option valid for the command?
 bool cfgParseOptionValid(ConfigCommand commandId, ConfigCommandRole commandRoleId, ConfigOption optionId);
 
+// Convert a size, e.g. 1m, 2gb, to bytes
+uint64_t cfgParseSize(const String *value);
+
 #endif
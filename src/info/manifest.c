@@ -8,12 +8,15 @@ Backup Manifest Handler
 #include <time.h>
 
 #include "common/crypto/cipherBlock.h"
+#include "common/crypto/hash.h"
 #include "common/debug.h"
 #include "common/log.h"
 #include "common/regExp.h"
+#include "common/type/convert.h"
 #include "common/type/json.h"
 #include "common/type/list.h"
 #include "common/type/mcv.h"
+#include "common/type/pack.h"
 #include "info/manifest.h"
 #include "postgres/interface.h"
 #include "postgres/version.h"
@@ -67,6 +70,12 @@ STRING_STATIC(MANIFEST_SECTION_TARGET_PATH_DEFAULT_STR,             "target:path
     STRING_STATIC(MANIFEST_KEY_BACKUP_TIMESTAMP_STOP_STR,           MANIFEST_KEY_BACKUP_TIMESTAMP_STOP);
 #define MANIFEST_KEY_BACKUP_TYPE                                    "backup-type"
     STRING_STATIC(MANIFEST_KEY_BACKUP_TYPE_STR,                     MANIFEST_KEY_BACKUP_TYPE);
+#define MANIFEST_KEY_BLOCK_INCR_SIZE                                "bi"
+    VARIANT_STRDEF_STATIC(MANIFEST_KEY_BLOCK_INCR_SIZE_VAR,         MANIFEST_KEY_BLOCK_INCR_SIZE);
+#define MANIFEST_KEY_BUNDLE_ID                                      "bni"
+    VARIANT_STRDEF_STATIC(MANIFEST_KEY_BUNDLE_ID_VAR,               MANIFEST_KEY_BUNDLE_ID);
+#define MANIFEST_KEY_BUNDLE_OFFSET                                  "bno"
+    VARIANT_STRDEF_STATIC(MANIFEST_KEY_BUNDLE_OFFSET_VAR,           MANIFEST_KEY_BUNDLE_OFFSET);
 #define MANIFEST_KEY_CHECKSUM                                       "checksum"
     VARIANT_STRDEF_STATIC(MANIFEST_KEY_CHECKSUM_VAR,                MANIFEST_KEY_CHECKSUM);
 #define MANIFEST_KEY_CHECKSUM_PAGE                                  "checksum-page"
@@ -152,8 +161,16 @@ struct Manifest
     ManifestPub pub;                                                // Publicly accessible variables
     StringList *ownerList;                                          // List of users/groups
     StringList *referenceList;                                      // List of file references
+    unsigned char *nameBlock;                                       // Block where names are currently being stored
+    size_t nameBlockRemains;                                        // Space remaining in the name block
 };
 
+/***********************************************************************************************************************************
+Size of blocks used to store file, link, and path names. Names that are larger than a quarter of the block size get their own
+allocation so there is never too much wasted space at the end of a block.
+***********************************************************************************************************************************/
+#define MANIFEST_NAME_BLOCK_SIZE                                    ((size_t)64 * 1024)
+
 /***********************************************************************************************************************************
 Internal functions to add types to their lists
 ***********************************************************************************************************************************/
@@ -174,6 +191,56 @@ manifestOwnerCache(Manifest *this, const String *owner)
     FUNCTION_TEST_RETURN(NULL);
 }
 
+// Helper to store a name. Names are stored as a constant string header followed by the string data in blocks that are shared by
+// many names. This saves two allocations per name, which adds up quickly in manifests with millions of files. Names stored this way
+// are never freed or modified individually -- they are freed with the manifest.
+static const String *
+manifestNameCache(Manifest *const this, const String *const name)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(MANIFEST, this);
+        FUNCTION_TEST_PARAM(STRING, name);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(name != NULL);
+
+    // Round up the size so the next string header is aligned
+    const size_t size = (sizeof(StringPub) + strSize(name) + 1 + sizeof(StringPub) - 1) / sizeof(StringPub) * sizeof(StringPub);
+    const String *result;
+
+    MEM_CONTEXT_BEGIN(this->pub.memContext)
+    {
+        // Large names get their own allocation
+        if (size > MANIFEST_NAME_BLOCK_SIZE / 4)
+        {
+            result = strDup(name);
+        }
+        else
+        {
+            // Allocate a new block when there is not enough space left in the current block
+            if (size > this->nameBlockRemains)
+            {
+                this->nameBlock = memNew(MANIFEST_NAME_BLOCK_SIZE);
+                this->nameBlockRemains = MANIFEST_NAME_BLOCK_SIZE;
+            }
+
+            StringPub *const nameCache = (StringPub *)this->nameBlock;
+
+            *nameCache = (StringPub){.size = (unsigned int)strSize(name), .buffer = (char *)(nameCache + 1)};
+            memcpy(nameCache->buffer, strZ(name), strSize(name) + 1);
+
+            this->nameBlock += size;
+            this->nameBlockRemains -= size;
+
+            result = (const String *)nameCache;
+        }
+    }
+    MEM_CONTEXT_END();
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 static void
 manifestDbAdd(Manifest *this, const ManifestDb *db)
 {
@@ -218,12 +285,15 @@ manifestFileAdd(Manifest *this, const ManifestFile *file)
     {
         ManifestFile fileAdd =
         {
+            .blockIncrSize = file->blockIncrSize,
+            .bundleId = file->bundleId,
+            .bundleOffset = file->bundleOffset,
             .checksumPage = file->checksumPage,
             .checksumPageError = file->checksumPageError,
             .checksumPageErrorList = varLstDup(file->checksumPageErrorList),
             .group = manifestOwnerCache(this, file->group),
             .mode = file->mode,
-            .name = strDup(file->name),
+            .name = manifestNameCache(this, file->name),
             .primary = file->primary,
             .size = file->size,
             .sizeRepo = file->sizeRepo,
@@ -280,7 +350,7 @@ manifestLinkAdd(Manifest *this, const ManifestLink *link)
         ManifestLink linkAdd =
         {
             .destination = strDup(link->destination),
-            .name = strDup(link->name),
+            .name = manifestNameCache(this, link->name),
             .group = manifestOwnerCache(this, link->group),
             .user = manifestOwnerCache(this, link->user),
         };
@@ -309,7 +379,7 @@ manifestPathAdd(Manifest *this, const ManifestPath *path)
         ManifestPath pathAdd =
         {
             .mode = path->mode,
-            .name = strDup(path->name),
+            .name = manifestNameCache(this, path->name),
             .group = manifestOwnerCache(this, path->group),
             .user = manifestOwnerCache(this, path->user),
         };
@@ -600,6 +670,7 @@ typedef struct ManifestBuildData
     ManifestLinkCheck linkCheck;                                    // List of links found during build (used for prefix check)
     StringList *excludeContent;                                     // Exclude contents of directories
     StringList *excludeSingle;                                      // Exclude a single file/link/path
+    const List *pathList;                                           // Paths that have already been listed
 
     // These change with each level of recursion
     const String *manifestParentName;                               // Manifest name of this file/link/path's parent
@@ -759,8 +830,30 @@ manifestBuildCallback(void *data, const StorageInfo *info)
             if (buildData.dbPathExp != NULL)
                 buildDataSub.dbPath = regExpMatch(buildData.dbPathExp, manifestName);
 
-            storageInfoListP(
-                buildDataSub.storagePg, buildDataSub.pgPath, manifestBuildCallback, &buildDataSub, .sortOrder = sortOrderAsc);
+            const ManifestBuildPath *const pathListed =
+                buildData.pathList != NULL ? lstFind(buildData.pathList, &buildDataSub.pgPath) : NULL;
+
+            // If the path has already been listed then use that list
+            if (pathListed != NULL)
+            {
+                MEM_CONTEXT_TEMP_RESET_BEGIN()
+                {
+                    for (unsigned int infoIdx = 0; infoIdx < lstSize(pathListed->infoList); infoIdx++)
+                    {
+                        manifestBuildCallback(&buildDataSub, lstGet(pathListed->infoList, infoIdx));
+
+                        // Reset the memory context occasionally
+                        MEM_CONTEXT_TEMP_RESET(1000);
+                    }
+                }
+                MEM_CONTEXT_TEMP_END();
+            }
+            // Else list the path
+            else
+            {
+                storageInfoListP(
+                    buildDataSub.storagePg, buildDataSub.pgPath, manifestBuildCallback, &buildDataSub, .sortOrder = sortOrderAsc);
+            }
 
             break;
         }
@@ -1047,7 +1140,7 @@ manifestBuildCallback(void *data, const StorageInfo *info)
 Manifest *
 manifestNewBuild(
     const Storage *storagePg, unsigned int pgVersion, unsigned int pgCatalogVersion, bool online, bool checksumPage,
-    const StringList *excludeList, const VariantList *tablespaceList)
+    const StringList *excludeList, const VariantList *tablespaceList, const List *pathList)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STORAGE, storagePg);
@@ -1057,6 +1150,7 @@ manifestNewBuild(
         FUNCTION_LOG_PARAM(BOOL, checksumPage);
         FUNCTION_LOG_PARAM(STRING_LIST, excludeList);
         FUNCTION_LOG_PARAM(VARIANT_LIST, tablespaceList);
+        FUNCTION_LOG_PARAM(LIST, pathList);
     FUNCTION_LOG_END();
 
     ASSERT(storagePg != NULL);
@@ -1087,6 +1181,7 @@ manifestNewBuild(
                 .online = online,
                 .checksumPage = checksumPage,
                 .tablespaceList = tablespaceList,
+                .pathList = pathList,
                 .linkCheck = manifestLinkCheckInit(),
                 .manifestParentName = MANIFEST_TARGET_PGDATA_STR,
                 .manifestWalName = strNewFmt(MANIFEST_TARGET_PGDATA "/%s", strZ(pgWalPath(pgVersion))),
@@ -1312,6 +1407,30 @@ manifestBuildValidate(Manifest *this, bool delta, time_t copyStart, CompressType
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/**********************************************************************************************************************************/
+void
+manifestBuildBlockIncr(Manifest *const this, const uint64_t blockIncrSize)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(MANIFEST, this);
+        FUNCTION_LOG_PARAM(UINT64, blockIncrSize);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(blockIncrSize > 0);
+
+    // Files that are not larger than a single block will never benefit from block incremental
+    for (unsigned int fileIdx = 0; fileIdx < manifestFileTotal(this); fileIdx++)
+    {
+        ManifestFile *const file = lstGet(this->pub.fileList, fileIdx);
+
+        if (file->size > blockIncrSize)
+            file->blockIncrSize = blockIncrSize;
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 void
 manifestBuildIncr(Manifest *this, const Manifest *manifestPrior, BackupType type, const String *archiveStart)
@@ -1406,7 +1525,7 @@ manifestBuildIncr(Manifest *this, const Manifest *manifestPrior, BackupType type
 
         for (unsigned int fileIdx = 0; fileIdx < lstSize(this->pub.fileList); fileIdx++)
         {
-            const ManifestFile *file = manifestFile(this, fileIdx);
+            ManifestFile *const file = lstGet(this->pub.fileList, fileIdx);
             const ManifestFile *filePrior = manifestFileFindDefault(manifestPrior, file->name, NULL);
 
             // Check if prior file can be used
@@ -1416,7 +1535,25 @@ manifestBuildIncr(Manifest *this, const Manifest *manifestPrior, BackupType type
                 manifestFileUpdate(
                     this, file->name, file->size, filePrior->sizeRepo, filePrior->checksumSha1,
                     VARSTR(filePrior->reference != NULL ? filePrior->reference : manifestPrior->pub.data.backupLabel),
-                    filePrior->checksumPage, filePrior->checksumPageError, filePrior->checksumPageErrorList);
+                    filePrior->checksumPage, filePrior->checksumPageError, filePrior->checksumPageErrorList, filePrior->bundleId,
+                    filePrior->bundleOffset);
+
+                // The prior file must be stored in the same format since it will be referenced. If delta is enabled and the file
+                // has changed it will be copied using the format of the prior file, which is still correct.
+                file->blockIncrSize = filePrior->blockIncrSize;
+
+                // If delta is enabled and the timestamp has changed then the file has probably changed, so copy it while the
+                // checksum is being checked rather than reading it a second time to copy it after the checksum does not match
+                file->deltaCopy = delta && file->timestamp != filePrior->timestamp;
+            }
+
+            // If the file is block incremental then the prior block map can be used to copy only changed blocks as long as the
+            // block size has not changed. This is also required when delta is enabled and the prior file is referenced above since
+            // the file will be copied if the checksum does not match.
+            if (filePrior != NULL && file->blockIncrSize != 0 && file->blockIncrSize == filePrior->blockIncrSize)
+            {
+                file->blockIncrMapPrior = strLstAddIfMissing(
+                    this->referenceList, filePrior->reference != NULL ? filePrior->reference : manifestPrior->pub.data.backupLabel);
             }
         }
     }
@@ -1631,6 +1768,13 @@ manifestLoadCallback(void *callbackData, const String *section, const String *ke
             // the repo-size is only stored in the manifest file if it is different than size.
             file.sizeRepo = varUInt64(kvGetDefault(fileKv, MANIFEST_KEY_SIZE_REPO_VAR, VARUINT64(file.size)));
 
+            // Block incremental size is only present for block incremental files
+            file.blockIncrSize = varUInt64(kvGetDefault(fileKv, MANIFEST_KEY_BLOCK_INCR_SIZE_VAR, VARUINT64(0)));
+
+            // Bundle id and offset are only present for bundled files
+            file.bundleId = varUInt64(kvGetDefault(fileKv, MANIFEST_KEY_BUNDLE_ID_VAR, VARUINT64(0)));
+            file.bundleOffset = varUInt64(kvGetDefault(fileKv, MANIFEST_KEY_BUNDLE_OFFSET_VAR, VARUINT64(0)));
+
             // If file size is zero then assign the static zero hash
             if (file.size == 0)
             {
@@ -2297,6 +2441,15 @@ manifestSaveCallback(void *callbackData, const String *sectionNext, InfoSave *in
                 const ManifestFile *file = manifestFile(manifest, fileIdx);
                 KeyValue *fileKv = kvNew();
 
+                if (file->blockIncrSize != 0)
+                    kvPut(fileKv, MANIFEST_KEY_BLOCK_INCR_SIZE_VAR, varNewUInt64(file->blockIncrSize));
+
+                if (file->bundleId != 0)
+                {
+                    kvPut(fileKv, MANIFEST_KEY_BUNDLE_ID_VAR, varNewUInt64(file->bundleId));
+                    kvPut(fileKv, MANIFEST_KEY_BUNDLE_OFFSET_VAR, varNewUInt64(file->bundleOffset));
+                }
+
                 // Save if the file size is not zero and the checksum exists.  The checksum might not exist if this is a partial
                 // save performed during a backup.
                 if (file->size != 0 && file->checksumSha1[0] != 0)
@@ -2531,6 +2684,709 @@ manifestSave(Manifest *this, IoWrite *write)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Binary manifest format
+
+The binary format stores the same data as the ini format in a pack. Owners and references are stored once in lists and files,
+links, and paths store an index into these lists (index + 1 so zero can represent NULL). Every section is stored as a nested pack
+and the last field is a SHA1 checksum of all the nested packs in order, so the binary manifest is protected from corruption just
+like the ini checksum protects the ini format. The file names are stored as a sorted list followed by an array of file packs in the
+same order.
+***********************************************************************************************************************************/
+#define MANIFEST_PACK_FORMAT                                        1U
+
+// Get the index + 1 of a string in a list, adding it if missing. NULL is stored as zero.
+static unsigned int
+manifestPackStrIdx(StringList *const list, const String *const value)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING_LIST, list);
+        FUNCTION_TEST_PARAM(STRING, value);
+    FUNCTION_TEST_END();
+
+    ASSERT(list != NULL);
+
+    if (value == NULL)
+        FUNCTION_TEST_RETURN(0);
+
+    for (unsigned int listIdx = 0; listIdx < strLstSize(list); listIdx++)
+    {
+        if (strEq(value, strLstGet(list, listIdx)))
+            FUNCTION_TEST_RETURN(listIdx + 1);
+    }
+
+    strLstAdd(list, value);
+
+    FUNCTION_TEST_RETURN(strLstSize(list));
+}
+
+// Get a string from a list using an index written by manifestPackStrIdx()
+static const String *
+manifestPackStr(const StringList *const list, const unsigned int idx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING_LIST, list);
+        FUNCTION_TEST_PARAM(UINT, idx);
+    FUNCTION_TEST_END();
+
+    ASSERT(list != NULL);
+
+    if (idx == 0)
+        FUNCTION_TEST_RETURN(NULL);
+
+    CHECK(idx <= strLstSize(list));
+
+    FUNCTION_TEST_RETURN(strLstGet(list, idx - 1));
+}
+
+// Convert a hex checksum to binary since that is half the size of the hex string
+static Buffer *
+manifestPackChecksumBin(const char *const checksum)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRINGZ, checksum);
+    FUNCTION_TEST_END();
+
+    ASSERT(strlen(checksum) == HASH_TYPE_SHA1_SIZE_HEX);
+
+    Buffer *const result = bufNew(HASH_TYPE_SHA1_SIZE);
+    char byte[3] = {0};
+
+    for (unsigned int byteIdx = 0; byteIdx < HASH_TYPE_SHA1_SIZE; byteIdx++)
+    {
+        byte[0] = checksum[byteIdx * 2];
+        byte[1] = checksum[byteIdx * 2 + 1];
+        bufPtr(result)[byteIdx] = (unsigned char)cvtZToUIntBase(byte, 16);
+    }
+
+    bufUsedSet(result, HASH_TYPE_SHA1_SIZE);
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+// Helpers to write/read variants that may be NULL
+static void
+manifestPackWriteBoolVar(PackWrite *const pack, const Variant *const value)
+{
+    if (value == NULL)
+        pckWriteNullP(pack);
+    else
+        pckWriteBoolP(pack, varBool(value), .defaultWrite = true);
+}
+
+static const Variant *
+manifestPackReadBoolVar(PackRead *const pack)
+{
+    if (pckReadNullP(pack))
+        return NULL;
+
+    return varNewBool(pckReadBoolP(pack));
+}
+
+static void
+manifestPackWriteUIntVar(PackWrite *const pack, const Variant *const value)
+{
+    if (value == NULL)
+        pckWriteNullP(pack);
+    else
+        pckWriteU32P(pack, varUIntForce(value), .defaultWrite = true);
+}
+
+static const Variant *
+manifestPackReadUIntVar(PackRead *const pack)
+{
+    if (pckReadNullP(pack))
+        return NULL;
+
+    return varNewUInt(pckReadU32P(pack));
+}
+
+// Write a file pack. The name is not included since it is stored in the file name index.
+static void
+manifestPackFileWrite(
+    PackWrite *const pack, const ManifestFile *const file, StringList *const ownerList, StringList *const referenceList)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(PACK_WRITE, pack);
+        FUNCTION_TEST_PARAM(MANIFEST_FILE, file);
+        FUNCTION_TEST_PARAM(STRING_LIST, ownerList);
+        FUNCTION_TEST_PARAM(STRING_LIST, referenceList);
+    FUNCTION_TEST_END();
+
+    pckWriteU32P(pack, manifestPackStrIdx(ownerList, file->user));
+    pckWriteU32P(pack, manifestPackStrIdx(ownerList, file->group));
+    pckWriteModeP(pack, file->mode);
+    pckWriteBoolP(pack, file->primary);
+
+    pckWriteBinP(pack, file->checksumSha1[0] == '\0' ? NULL : manifestPackChecksumBin(file->checksumSha1));
+
+    pckWriteBoolP(pack, file->checksumPage);
+    pckWriteBoolP(pack, file->checksumPageError);
+    pckWriteStrP(
+        pack, file->checksumPageErrorList != NULL ? jsonFromVar(varNewVarLst(file->checksumPageErrorList)) : NULL);
+    pckWriteU32P(pack, manifestPackStrIdx(referenceList, file->reference));
+    pckWriteU64P(pack, file->blockIncrSize);
+    pckWriteU64P(pack, file->bundleId);
+    pckWriteU64P(pack, file->bundleOffset);
+    pckWriteU64P(pack, file->size);
+    pckWriteU64P(pack, file->sizeRepo);
+    pckWriteTimeP(pack, file->timestamp);
+    pckWriteEndP(pack);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+// Read a file pack. Strings are either allocated in the current mem context or point into the owner/reference lists.
+static ManifestFile
+manifestPackFileRead(
+    PackRead *const pack, const String *const name, const StringList *const ownerList, const StringList *const referenceList)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(PACK_READ, pack);
+        FUNCTION_TEST_PARAM(STRING, name);
+        FUNCTION_TEST_PARAM(STRING_LIST, ownerList);
+        FUNCTION_TEST_PARAM(STRING_LIST, referenceList);
+    FUNCTION_TEST_END();
+
+    // Fields must be read in order so they cannot be read in the initializer
+    ManifestFile result = {.name = name};
+
+    result.user = manifestPackStr(ownerList, pckReadU32P(pack));
+    result.group = manifestPackStr(ownerList, pckReadU32P(pack));
+    result.mode = pckReadModeP(pack);
+    result.primary = pckReadBoolP(pack);
+
+    const Buffer *const checksumSha1 = pckReadBinP(pack);
+
+    if (checksumSha1 != NULL)
+    {
+        CHECK(bufUsed(checksumSha1) == HASH_TYPE_SHA1_SIZE);
+        memcpy(result.checksumSha1, strZ(bufHex(checksumSha1)), HASH_TYPE_SHA1_SIZE_HEX + 1);
+    }
+
+    result.checksumPage = pckReadBoolP(pack);
+    result.checksumPageError = pckReadBoolP(pack);
+
+    const String *const checksumPageErrorList = pckReadStrP(pack);
+
+    if (checksumPageErrorList != NULL)
+        result.checksumPageErrorList = varVarLst(jsonToVar(checksumPageErrorList));
+
+    result.reference = manifestPackStr(referenceList, pckReadU32P(pack));
+    result.blockIncrSize = pckReadU64P(pack);
+    result.bundleId = pckReadU64P(pack);
+    result.bundleOffset = pckReadU64P(pack);
+    result.size = pckReadU64P(pack);
+    result.sizeRepo = pckReadU64P(pack);
+    result.timestamp = pckReadTimeP(pack);
+    pckReadEndP(pack);
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+// Write a nested pack and add it to the checksum
+static void
+manifestPackWriteSection(PackWrite *const pack, PackWrite *const section, IoFilter *const hash)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(PACK_WRITE, pack);
+        FUNCTION_TEST_PARAM(PACK_WRITE, section);
+        FUNCTION_TEST_PARAM(IO_FILTER, hash);
+    FUNCTION_TEST_END();
+
+    ioFilterProcessIn(hash, pckWriteBuf(section));
+    pckWritePackP(pack, section);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+// Read a nested pack and add it to the checksum
+static PackRead *
+manifestPackReadSection(PackRead *const pack, IoFilter *const hash)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(PACK_READ, pack);
+        FUNCTION_TEST_PARAM(IO_FILTER, hash);
+    FUNCTION_TEST_END();
+
+    const Buffer *const section = pckReadPackBufP(pack);
+
+    if (section == NULL)
+        THROW(FormatError, "manifest section is missing");
+
+    ioFilterProcessIn(hash, section);
+
+    FUNCTION_TEST_RETURN(pckReadNewBuf(section));
+}
+
+// Check the checksum after all sections have been read
+static void
+manifestPackReadChecksum(PackRead *const pack, IoFilter *const hash)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(PACK_READ, pack);
+        FUNCTION_TEST_PARAM(IO_FILTER, hash);
+    FUNCTION_TEST_END();
+
+    const String *const checksum = pckReadStrP(pack);
+    const String *const checksumActual = varStr(ioFilterResult(hash));
+
+    if (!strEq(checksum, checksumActual))
+    {
+        THROW_FMT(
+            ChecksumError, "invalid manifest checksum, actual '%s' but expected '%s'", strZ(checksumActual), strZNull(checksum));
+    }
+
+    pckReadEndP(pack);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+void
+manifestSavePack(Manifest *const this, IoWrite *const write)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(MANIFEST, this);
+        FUNCTION_LOG_PARAM(IO_WRITE, write);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(write != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Files can be added from outside the manifest so make sure they are sorted
+        lstSort(this->pub.fileList, sortOrderAsc);
+
+        // Build owner and reference lists containing only the values that are used
+        StringList *const ownerList = strLstNew();
+        StringList *const referenceList = strLstNew();
+        StringList *const fileNameList = strLstNew();
+
+        for (unsigned int fileIdx = 0; fileIdx < manifestFileTotal(this); fileIdx++)
+        {
+            const ManifestFile *const file = manifestFile(this, fileIdx);
+
+            manifestPackStrIdx(ownerList, file->user);
+            manifestPackStrIdx(ownerList, file->group);
+            manifestPackStrIdx(referenceList, file->reference);
+            strLstAdd(fileNameList, file->name);
+        }
+
+        for (unsigned int linkIdx = 0; linkIdx < manifestLinkTotal(this); linkIdx++)
+        {
+            const ManifestLink *const link = manifestLink(this, linkIdx);
+
+            manifestPackStrIdx(ownerList, link->user);
+            manifestPackStrIdx(ownerList, link->group);
+        }
+
+        for (unsigned int pathIdx = 0; pathIdx < manifestPathTotal(this); pathIdx++)
+        {
+            const ManifestPath *const path = manifestPath(this, pathIdx);
+
+            manifestPackStrIdx(ownerList, path->user);
+            manifestPackStrIdx(ownerList, path->group);
+        }
+
+        // Write header
+        ioWriteOpen(write);
+
+        PackWrite *const pack = pckWriteNew(write);
+        IoFilter *const hash = cryptoHashNew(HASH_TYPE_SHA1_STR);
+
+        pckWriteU32P(pack, MANIFEST_PACK_FORMAT, .defaultWrite = true);
+
+        PackWrite *section = pckWriteNewBuf(bufNew(0));
+
+        pckWriteStrP(section, this->pub.data.backrestVersion);
+        pckWriteStrP(section, manifestCipherSubPass(this));
+        pckWriteStrLstP(section, ownerList);
+        pckWriteStrLstP(section, referenceList);
+        pckWriteEndP(section);
+
+        manifestPackWriteSection(pack, section, hash);
+
+        // Write data
+        section = pckWriteNewBuf(bufNew(0));
+        const ManifestData *const data = manifestData(this);
+
+        pckWriteStrP(section, data->backupLabel);
+        pckWriteStrP(section, data->backupLabelPrior);
+        pckWriteTimeP(section, data->backupTimestampCopyStart);
+        pckWriteTimeP(section, data->backupTimestampStart);
+        pckWriteTimeP(section, data->backupTimestampStop);
+        pckWriteStrIdP(section, data->backupType);
+        pckWriteStrP(section, data->archiveStart);
+        pckWriteStrP(section, data->archiveStop);
+        pckWriteStrP(section, data->lsnStart);
+        pckWriteStrP(section, data->lsnStop);
+        pckWriteU32P(section, data->pgId);
+        pckWriteU32P(section, data->pgVersion);
+        pckWriteU64P(section, data->pgSystemId);
+        pckWriteU32P(section, data->pgCatalogVersion);
+        pckWriteBoolP(section, data->backupOptionArchiveCheck);
+        pckWriteBoolP(section, data->backupOptionArchiveCopy);
+        manifestPackWriteBoolVar(section, data->backupOptionStandby);
+        manifestPackWriteUIntVar(section, data->backupOptionBufferSize);
+        manifestPackWriteBoolVar(section, data->backupOptionChecksumPage);
+        pckWriteU32P(section, data->backupOptionCompressType);
+        manifestPackWriteUIntVar(section, data->backupOptionCompressLevel);
+        manifestPackWriteUIntVar(section, data->backupOptionCompressLevelNetwork);
+        manifestPackWriteBoolVar(section, data->backupOptionDelta);
+        pckWriteBoolP(section, data->backupOptionHardLink);
+        pckWriteBoolP(section, data->backupOptionOnline);
+        manifestPackWriteUIntVar(section, data->backupOptionProcessMax);
+        pckWriteEndP(section);
+
+        manifestPackWriteSection(pack, section, hash);
+
+        // Write targets
+        section = pckWriteNewBuf(bufNew(0));
+        pckWriteArrayBeginP(section);
+
+        for (unsigned int targetIdx = 0; targetIdx < manifestTargetTotal(this); targetIdx++)
+        {
+            const ManifestTarget *const target = manifestTarget(this, targetIdx);
+
+            pckWriteObjBeginP(section);
+            pckWriteStrP(section, target->name);
+            pckWriteU32P(section, target->type);
+            pckWriteStrP(section, target->path);
+            pckWriteStrP(section, target->file);
+            pckWriteU32P(section, target->tablespaceId);
+            pckWriteStrP(section, target->tablespaceName);
+            pckWriteObjEndP(section);
+        }
+
+        pckWriteArrayEndP(section);
+        pckWriteEndP(section);
+        manifestPackWriteSection(pack, section, hash);
+
+        // Write dbs
+        section = pckWriteNewBuf(bufNew(0));
+        pckWriteArrayBeginP(section);
+
+        for (unsigned int dbIdx = 0; dbIdx < manifestDbTotal(this); dbIdx++)
+        {
+            const ManifestDb *const db = manifestDb(this, dbIdx);
+
+            pckWriteObjBeginP(section);
+            pckWriteStrP(section, db->name);
+            pckWriteU32P(section, db->id);
+            pckWriteU32P(section, db->lastSystemId);
+            pckWriteObjEndP(section);
+        }
+
+        pckWriteArrayEndP(section);
+        pckWriteEndP(section);
+        manifestPackWriteSection(pack, section, hash);
+
+        // Write paths
+        section = pckWriteNewBuf(bufNew(0));
+        pckWriteArrayBeginP(section);
+
+        for (unsigned int pathIdx = 0; pathIdx < manifestPathTotal(this); pathIdx++)
+        {
+            const ManifestPath *const path = manifestPath(this, pathIdx);
+
+            pckWriteObjBeginP(section);
+            pckWriteStrP(section, path->name);
+            pckWriteModeP(section, path->mode);
+            pckWriteU32P(section, manifestPackStrIdx(ownerList, path->user));
+            pckWriteU32P(section, manifestPackStrIdx(ownerList, path->group));
+            pckWriteObjEndP(section);
+        }
+
+        pckWriteArrayEndP(section);
+        pckWriteEndP(section);
+        manifestPackWriteSection(pack, section, hash);
+
+        // Write links
+        section = pckWriteNewBuf(bufNew(0));
+        pckWriteArrayBeginP(section);
+
+        for (unsigned int linkIdx = 0; linkIdx < manifestLinkTotal(this); linkIdx++)
+        {
+            const ManifestLink *const link = manifestLink(this, linkIdx);
+
+            pckWriteObjBeginP(section);
+            pckWriteStrP(section, link->name);
+            pckWriteStrP(section, link->destination);
+            pckWriteU32P(section, manifestPackStrIdx(ownerList, link->user));
+            pckWriteU32P(section, manifestPackStrIdx(ownerList, link->group));
+            pckWriteObjEndP(section);
+        }
+
+        pckWriteArrayEndP(section);
+        pckWriteEndP(section);
+        manifestPackWriteSection(pack, section, hash);
+
+        // Write file name index followed by the files in the same order
+        section = pckWriteNewBuf(bufNew(0));
+        pckWriteStrLstP(section, fileNameList);
+        pckWriteEndP(section);
+        manifestPackWriteSection(pack, section, hash);
+
+        pckWriteArrayBeginP(pack);
+
+        MEM_CONTEXT_TEMP_RESET_BEGIN()
+        {
+            for (unsigned int fileIdx = 0; fileIdx < manifestFileTotal(this); fileIdx++)
+            {
+                PackWrite *const filePack = pckWriteNewBuf(bufNew(0));
+
+                manifestPackFileWrite(filePack, manifestFile(this, fileIdx), ownerList, referenceList);
+                manifestPackWriteSection(pack, filePack, hash);
+
+                MEM_CONTEXT_TEMP_RESET(1000);
+            }
+        }
+        MEM_CONTEXT_TEMP_END();
+
+        pckWriteArrayEndP(pack);
+        pckWriteStrP(pack, varStr(ioFilterResult(hash)));
+        pckWriteEndP(pack);
+
+        ioWriteClose(write);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+// Open a binary manifest and read the header. The owner and reference lists are allocated in the current mem context.
+static PackRead *
+manifestPackReadHeader(
+    IoRead *const read, IoFilter *const hash, const String **const backrestVersion, const String **const cipherSubPass,
+    StringList **const ownerList, StringList **const referenceList)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(IO_READ, read);
+        FUNCTION_TEST_PARAM(IO_FILTER, hash);
+        FUNCTION_TEST_PARAM_P(VOID, backrestVersion);
+        FUNCTION_TEST_PARAM_P(VOID, cipherSubPass);
+        FUNCTION_TEST_PARAM_P(VOID, ownerList);
+        FUNCTION_TEST_PARAM_P(VOID, referenceList);
+    FUNCTION_TEST_END();
+
+    ioReadOpen(read);
+
+    PackRead *const result = pckReadNew(read);
+    const unsigned int format = pckReadU32P(result);
+
+    if (format != MANIFEST_PACK_FORMAT)
+        THROW_FMT(FormatError, "expected manifest format %u but found %u", MANIFEST_PACK_FORMAT, format);
+
+    PackRead *const header = manifestPackReadSection(result, hash);
+
+    *backrestVersion = pckReadStrP(header);
+    *cipherSubPass = pckReadStrP(header);
+    *ownerList = pckReadStrLstP(header);
+    *referenceList = pckReadStrLstP(header);
+    pckReadEndP(header);
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+Manifest *
+manifestNewLoadPack(IoRead *const read)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(IO_READ, read);
+    FUNCTION_LOG_END();
+
+    ASSERT(read != NULL);
+
+    Manifest *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("Manifest")
+    {
+        this = manifestNewInternal();
+
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            // Read header
+            const String *backrestVersion;
+            const String *cipherSubPass;
+            StringList *ownerList;
+            StringList *referenceList;
+
+            IoFilter *const hash = cryptoHashNew(HASH_TYPE_SHA1_STR);
+            PackRead *const pack = manifestPackReadHeader(
+                read, hash, &backrestVersion, &cipherSubPass, &ownerList, &referenceList);
+
+            MEM_CONTEXT_PRIOR_BEGIN()
+            {
+                this->pub.info = infoNew(cipherSubPass);
+                this->pub.data.backrestVersion = strDup(backrestVersion);
+            }
+            MEM_CONTEXT_PRIOR_END();
+
+            // Read data
+            PackRead *section = manifestPackReadSection(pack, hash);
+
+            MEM_CONTEXT_PRIOR_BEGIN()
+            {
+                ManifestData *const data = &this->pub.data;
+
+                data->backupLabel = pckReadStrP(section);
+                data->backupLabelPrior = pckReadStrP(section);
+                data->backupTimestampCopyStart = pckReadTimeP(section);
+                data->backupTimestampStart = pckReadTimeP(section);
+                data->backupTimestampStop = pckReadTimeP(section);
+                data->backupType = (BackupType)pckReadStrIdP(section);
+                data->archiveStart = pckReadStrP(section);
+                data->archiveStop = pckReadStrP(section);
+                data->lsnStart = pckReadStrP(section);
+                data->lsnStop = pckReadStrP(section);
+                data->pgId = pckReadU32P(section);
+                data->pgVersion = pckReadU32P(section);
+                data->pgSystemId = pckReadU64P(section);
+                data->pgCatalogVersion = pckReadU32P(section);
+                data->backupOptionArchiveCheck = pckReadBoolP(section);
+                data->backupOptionArchiveCopy = pckReadBoolP(section);
+                data->backupOptionStandby = manifestPackReadBoolVar(section);
+                data->backupOptionBufferSize = manifestPackReadUIntVar(section);
+                data->backupOptionChecksumPage = manifestPackReadBoolVar(section);
+                data->backupOptionCompressType = (CompressType)pckReadU32P(section);
+                data->backupOptionCompressLevel = manifestPackReadUIntVar(section);
+                data->backupOptionCompressLevelNetwork = manifestPackReadUIntVar(section);
+                data->backupOptionDelta = manifestPackReadBoolVar(section);
+                data->backupOptionHardLink = pckReadBoolP(section);
+                data->backupOptionOnline = pckReadBoolP(section);
+                data->backupOptionProcessMax = manifestPackReadUIntVar(section);
+                pckReadEndP(section);
+            }
+            MEM_CONTEXT_PRIOR_END();
+
+            // Read targets
+            section = manifestPackReadSection(pack, hash);
+            pckReadArrayBeginP(section);
+
+            while (pckReadNext(section))
+            {
+                pckReadObjBeginP(section);
+
+                ManifestTarget target = {.name = pckReadStrP(section)};
+
+                target.type = (ManifestTargetType)pckReadU32P(section);
+                target.path = pckReadStrP(section);
+                target.file = pckReadStrP(section);
+                target.tablespaceId = pckReadU32P(section);
+                target.tablespaceName = pckReadStrP(section);
+                pckReadObjEndP(section);
+
+                manifestTargetAdd(this, &target);
+            }
+
+            pckReadEndP(section);
+
+            // Read dbs
+            section = manifestPackReadSection(pack, hash);
+            pckReadArrayBeginP(section);
+
+            while (pckReadNext(section))
+            {
+                pckReadObjBeginP(section);
+
+                ManifestDb db = {.name = pckReadStrP(section)};
+
+                db.id = pckReadU32P(section);
+                db.lastSystemId = pckReadU32P(section);
+                pckReadObjEndP(section);
+
+                manifestDbAdd(this, &db);
+            }
+
+            pckReadEndP(section);
+
+            // Read paths
+            section = manifestPackReadSection(pack, hash);
+            pckReadArrayBeginP(section);
+
+            while (pckReadNext(section))
+            {
+                pckReadObjBeginP(section);
+
+                ManifestPath path = {.name = pckReadStrP(section)};
+
+                path.mode = pckReadModeP(section);
+                path.user = manifestPackStr(ownerList, pckReadU32P(section));
+                path.group = manifestPackStr(ownerList, pckReadU32P(section));
+                pckReadObjEndP(section);
+
+                manifestPathAdd(this, &path);
+            }
+
+            pckReadEndP(section);
+
+            // Read links
+            section = manifestPackReadSection(pack, hash);
+            pckReadArrayBeginP(section);
+
+            while (pckReadNext(section))
+            {
+                pckReadObjBeginP(section);
+
+                ManifestLink link = {.name = pckReadStrP(section)};
+
+                link.destination = pckReadStrP(section);
+                link.user = manifestPackStr(ownerList, pckReadU32P(section));
+                link.group = manifestPackStr(ownerList, pckReadU32P(section));
+                pckReadObjEndP(section);
+
+                manifestLinkAdd(this, &link);
+            }
+
+            pckReadEndP(section);
+
+            // Read files. Each file is decoded directly from the stream and added to the manifest so the entire file list is never
+            // held in memory twice.
+            section = manifestPackReadSection(pack, hash);
+
+            const StringList *const fileNameList = pckReadStrLstP(section);
+            pckReadEndP(section);
+
+            pckReadArrayBeginP(pack);
+
+            MEM_CONTEXT_TEMP_RESET_BEGIN()
+            {
+                for (unsigned int fileIdx = 0; fileIdx < strLstSize(fileNameList); fileIdx++)
+                {
+                    PackRead *const filePack = manifestPackReadSection(pack, hash);
+                    const ManifestFile file = manifestPackFileRead(
+                        filePack, strLstGet(fileNameList, fileIdx), ownerList, referenceList);
+
+                    manifestFileAdd(this, &file);
+
+                    MEM_CONTEXT_TEMP_RESET(1000);
+                }
+            }
+            MEM_CONTEXT_TEMP_END();
+
+            pckReadArrayEndP(pack);
+            manifestPackReadChecksum(pack, hash);
+
+            ioReadClose(read);
+        }
+        MEM_CONTEXT_TEMP_END();
+
+        // Sort the lists so finds can use a binary search. The lists were saved in sorted order so this is cheap.
+        lstSort(this->pub.dbList, sortOrderAsc);
+        lstSort(this->pub.fileList, sortOrderAsc);
+        lstSort(this->pub.linkList, sortOrderAsc);
+        lstSort(this->pub.pathList, sortOrderAsc);
+        lstSort(this->pub.targetList, sortOrderAsc);
+
+        // Make sure the base path exists
+        manifestTargetBase(this);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(MANIFEST, this);
+}
+
 /**********************************************************************************************************************************/
 void
 manifestValidate(Manifest *this, bool strict)
@@ -2641,7 +3497,7 @@ manifestFileRemove(const Manifest *this, const String *name)
 void
 manifestFileUpdate(
     Manifest *this, const String *name, uint64_t size, uint64_t sizeRepo, const char *checksumSha1, const Variant *reference,
-    bool checksumPage, bool checksumPageError, const VariantList *checksumPageErrorList)
+    bool checksumPage, bool checksumPageError, const VariantList *checksumPageErrorList, uint64_t bundleId, uint64_t bundleOffset)
 {
     FUNCTION_TEST_BEGIN();
         FUNCTION_TEST_PARAM(MANIFEST, this);
@@ -2653,10 +3509,13 @@ manifestFileUpdate(
         FUNCTION_TEST_PARAM(BOOL, checksumPage);
         FUNCTION_TEST_PARAM(BOOL, checksumPageError);
         FUNCTION_TEST_PARAM(VARIANT_LIST, checksumPageErrorList);
+        FUNCTION_TEST_PARAM(UINT64, bundleId);
+        FUNCTION_TEST_PARAM(UINT64, bundleOffset);
     FUNCTION_TEST_END();
 
     ASSERT(this != NULL);
     ASSERT(name != NULL);
+    ASSERT(bundleId != 0 || bundleOffset == 0);
     ASSERT(
         (!checksumPage && !checksumPageError && checksumPageErrorList == NULL) ||
         (checksumPage && !checksumPageError && checksumPageErrorList == NULL) || (checksumPage && checksumPageError));
@@ -2686,6 +3545,10 @@ manifestFileUpdate(
         file->checksumPage = checksumPage;
         file->checksumPageError = checksumPageError;
         file->checksumPageErrorList = varLstDup(checksumPageErrorList);
+
+        // Update bundle info
+        file->bundleId = bundleId;
+        file->bundleOffset = bundleOffset;
     }
     MEM_CONTEXT_END();
 
@@ -3004,13 +3867,94 @@ manifestLoadFile(const Storage *storage, const String *fileName, CipherType ciph
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
-        const char *fileNamePath = strZ(storagePathP(storage, fileName));
+        // Load the binary manifest when it exists since it is faster to load. It is written after the ini manifest and removed
+        // before it, so it is never newer than the ini manifest. The ini manifest is loaded when the binary manifest is missing,
+        // e.g. for backups made by versions that did not write it, or when the binary manifest cannot be loaded.
+        const String *const filePackName = strNewFmt("%s" BACKUP_MANIFEST_PACK_EXT, strZ(fileName));
+
+        if (storageExistsP(storage, filePackName))
+        {
+            TRY_BEGIN()
+            {
+                IoRead *const read = storageReadIo(storageNewReadP(storage, filePackName));
+                cipherBlockFilterGroupAdd(ioReadFilterGroup(read), cipherType, cipherModeDecrypt, cipherPass);
+
+                MEM_CONTEXT_PRIOR_BEGIN()
+                {
+                    data.manifest = manifestNewLoadPack(read);
+                }
+                MEM_CONTEXT_PRIOR_END();
+            }
+            CATCH_ANY()
+            {
+                LOG_DETAIL_FMT(
+                    "unable to load '%s', loading ini manifest instead: [%s] %s", strZ(storagePathP(storage, filePackName)),
+                    errorTypeName(errorType()), errorMessage());
+            }
+            TRY_END();
+        }
 
-        infoLoad(
-            strNewFmt("unable to load backup manifest file '%s' or '%s" INFO_COPY_EXT "'", fileNamePath, fileNamePath),
-            manifestLoadFileCallback, &data);
+        if (data.manifest == NULL)
+        {
+            const char *fileNamePath = strZ(storagePathP(storage, fileName));
+
+            infoLoad(
+                strNewFmt("unable to load backup manifest file '%s' or '%s" INFO_COPY_EXT "'", fileNamePath, fileNamePath),
+                manifestLoadFileCallback, &data);
+        }
     }
     MEM_CONTEXT_TEMP_END();
 
     FUNCTION_LOG_RETURN(MANIFEST, data.manifest);
 }
+
+/**********************************************************************************************************************************/
+String *
+manifestCipherSubPassLoadFile(
+    const Storage *const storage, const String *const fileName, const CipherType cipherType, const String *const cipherPass)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STORAGE, storage);
+        FUNCTION_LOG_PARAM(STRING, fileName);
+        FUNCTION_LOG_PARAM(STRING_ID, cipherType);
+        FUNCTION_TEST_PARAM(STRING, cipherPass);
+    FUNCTION_LOG_END();
+
+    ASSERT(storage != NULL);
+    ASSERT(fileName != NULL);
+
+    String *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *const filePackName = strNewFmt("%s" BACKUP_MANIFEST_PACK_EXT, strZ(fileName));
+        const String *cipherSubPass = NULL;
+
+        // Only the header of the binary manifest needs to be read. The checksum cannot be verified without reading the entire
+        // manifest but an invalid passphrase will fail to decrypt anyway.
+        if (storageExistsP(storage, filePackName))
+        {
+            IoRead *const read = storageReadIo(storageNewReadP(storage, filePackName));
+            cipherBlockFilterGroupAdd(ioReadFilterGroup(read), cipherType, cipherModeDecrypt, cipherPass);
+
+            const String *backrestVersion;
+            StringList *ownerList;
+            StringList *referenceList;
+
+            manifestPackReadHeader(
+                read, cryptoHashNew(HASH_TYPE_SHA1_STR), &backrestVersion, &cipherSubPass, &ownerList, &referenceList);
+        }
+        // Else load the ini manifest
+        else
+            cipherSubPass = manifestCipherSubPass(manifestLoadFile(storage, fileName, cipherType, cipherPass));
+
+        MEM_CONTEXT_PRIOR_BEGIN()
+        {
+            result = strDup(cipherSubPass);
+        }
+        MEM_CONTEXT_PRIOR_END();
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(STRING, result);
+}
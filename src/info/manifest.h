@@ -16,6 +16,9 @@ Constants
 #define BACKUP_MANIFEST_FILE                                        "backup.manifest"
     STRING_DECLARE(BACKUP_MANIFEST_FILE_STR);
 
+// Extension of the manifest saved in the binary format next to the ini manifest
+#define BACKUP_MANIFEST_PACK_EXT                                    ".pack"
+
 #define MANIFEST_TARGET_PGDATA                                      "pg_data"
     STRING_DECLARE(MANIFEST_TARGET_PGDATA_STR);
 #define MANIFEST_TARGET_PGTBLSPC                                    "pg_tblspc"
@@ -92,15 +95,20 @@ File type
 typedef struct ManifestFile
 {
     const String *name;                                             // File name (must be first member in struct)
+    char checksumSha1[HASH_TYPE_SHA1_SIZE_HEX + 1];                 // SHA1 checksum (flags and mode follow to fill padding)
     bool primary:1;                                                 // Should this file be copied from the primary?
     bool checksumPage:1;                                            // Does this file have page checksums?
     bool checksumPageError:1;                                       // Is there an error in the page checksum?
+    bool deltaCopy:1;                                               // Copy while checking delta checksum (only set during backup)
     mode_t mode;                                                    // File mode
-    char checksumSha1[HASH_TYPE_SHA1_SIZE_HEX + 1];                 // SHA1 checksum
     const VariantList *checksumPageErrorList;                       // List of page checksum errors if there are any
     const String *user;                                             // User name
     const String *group;                                            // Group name
     const String *reference;                                        // Reference to a prior backup
+    const String *blockIncrMapPrior;                                // Prior backup with block map (only set during backup)
+    uint64_t blockIncrSize;                                         // Block size for block incremental (0 if not block incr)
+    uint64_t bundleId;                                              // Bundle id (0 if not bundled)
+    uint64_t bundleOffset;                                          // Offset of the file in the bundle
     uint64_t size;                                                  // Original size
     uint64_t sizeRepo;                                              // Size in repo
     time_t timestamp;                                               // Original timestamp
@@ -147,17 +155,30 @@ typedef struct ManifestTarget
     const String *tablespaceName;                                   // Name of the tablespace
 } ManifestTarget;
 
+/***********************************************************************************************************************************
+Paths in the PostgreSQL data directory that were listed before the manifest build, e.g. in parallel by local processes. The list
+must be sorted by path.
+***********************************************************************************************************************************/
+typedef struct ManifestBuildPath
+{
+    const String *path;                                             // Absolute path (must be first member in struct)
+    List *infoList;                                                 // StorageInfo for the path contents sorted by name
+} ManifestBuildPath;
+
 /***********************************************************************************************************************************
 Constructors
 ***********************************************************************************************************************************/
-// Build a new manifest for a PostgreSQL data directory
+// Build a new manifest for a PostgreSQL data directory. Paths found in pathList are not listed again.
 Manifest *manifestNewBuild(
     const Storage *storagePg, unsigned int pgVersion, unsigned int pgCatalogVersion, bool online, bool checksumPage,
-    const StringList *excludeList, const VariantList *tablespaceList);
+    const StringList *excludeList, const VariantList *tablespaceList, const List *pathList);
 
 // Load a manifest from IO
 Manifest *manifestNewLoad(IoRead *read);
 
+// Load a manifest saved in the binary format from IO
+Manifest *manifestNewLoadPack(IoRead *read);
+
 /***********************************************************************************************************************************
 Getters/Setters
 ***********************************************************************************************************************************/
@@ -202,6 +223,9 @@ Build functions
 // Validate the timestamps in the manifest given a copy start time, i.e. all times should be <= the copy start time
 void manifestBuildValidate(Manifest *this, bool delta, time_t copyStart, CompressType compressType);
 
+// Enable block incremental for files that are larger than the block size
+void manifestBuildBlockIncr(Manifest *this, uint64_t blockIncrSize);
+
 // Create a diff/incr backup by comparing to a previous backup manifest
 void manifestBuildIncr(Manifest *this, const Manifest *prior, BackupType type, const String *archiveStart);
 
@@ -228,6 +252,10 @@ manifestMove(Manifest *const this, MemContext *const parentNew)
 // Manifest save
 void manifestSave(Manifest *this, IoWrite *write);
 
+// Manifest save in the binary format. This format is more compact and faster to load than the ini format. Backups save it next to
+// the ini manifest, which is still saved so older versions and users can read it.
+void manifestSavePack(Manifest *this, IoWrite *write);
+
 // Validate a completed manifest.  Use strict mode only when saving the manifest after a backup.
 void manifestValidate(Manifest *this, bool strict);
 
@@ -287,7 +315,7 @@ manifestFileTotal(const Manifest *const this)
 // Update a file with new data
 void manifestFileUpdate(
     Manifest *this, const String *name, uint64_t size, uint64_t sizeRepo, const char *checksumSha1, const Variant *reference,
-    bool checksumPage, bool checksumPageError, const VariantList *checksumPageErrorList);
+    bool checksumPage, bool checksumPageError, const VariantList *checksumPageErrorList, uint64_t bundleId, uint64_t bundleOffset);
 
 /***********************************************************************************************************************************
 Link functions and getters/setters
@@ -389,9 +417,13 @@ manifestFree(Manifest *const this)
 /***********************************************************************************************************************************
 Helper functions
 ***********************************************************************************************************************************/
-// Load backup manifest
+// Load backup manifest. The binary manifest is loaded when it exists, else the ini manifest.
 Manifest *manifestLoadFile(const Storage *storage, const String *fileName, CipherType cipherType, const String *cipherPass);
 
+// Load only the cipher subpass from a backup manifest. This is fast when the binary manifest exists since only the header is read.
+String *manifestCipherSubPassLoadFile(
+    const Storage *storage, const String *fileName, CipherType cipherType, const String *cipherPass);
+
 /***********************************************************************************************************************************
 Macros for function logging
 ***********************************************************************************************************************************/
@@ -25,6 +25,7 @@ Main
 #include "command/repo/put.h"
 #include "command/repo/rm.h"
 #include "command/restore/restore.h"
+#include "command/server/server.h"
 #include "command/stanza/create.h"
 #include "command/stanza/delete.h"
 #include "command/stanza/upgrade.h"
@@ -91,7 +92,10 @@ main(int argListSize, const char *argList[])
         // -------------------------------------------------------------------------------------------------------------------------
         else if (commandRole == cfgCmdRoleRemote)
         {
-            cmdRemote(STDIN_FILENO, STDOUT_FILENO);
+            if (cfgOptionValid(cfgOptRemoteMux) && cfgOptionBool(cfgOptRemoteMux))
+                cmdRemoteMux(STDIN_FILENO, STDOUT_FILENO);
+            else
+                cmdRemote(STDIN_FILENO, STDOUT_FILENO);
         }
         else
         {
@@ -203,6 +207,12 @@ main(int argListSize, const char *argList[])
                     cmdRestore();
                     break;
 
+                // Server command
+                // -----------------------------------------------------------------------------------------------------------------
+                case cfgCmdServer:
+                    cmdServer(0);
+                    break;
+
                 // Stanza create command
                 // -----------------------------------------------------------------------------------------------------------------
                 case cfgCmdStanzaCreate:
@@ -159,6 +159,10 @@ const String *pgLsnName(unsigned int pgVersion);
 // Calculate the checksum for a page. Page cannot be const because the page header is temporarily modified during processing.
 uint16_t pgPageChecksum(unsigned char *page, uint32_t blockNo);
 
+// Calculate the checksums for contiguous full pages starting at blockNo. This is faster than calling pgPageChecksum() for each page
+// since vector instructions are used when supported by the CPU.
+void pgPageChecksumMulti(unsigned char *page, unsigned int pageTotal, uint32_t blockNo, uint16_t *checksum);
+
 const String *pgWalName(unsigned int pgVersion);
 
 // Get wal path (this was changed in PostgreSQL 10 to avoid including "log" in the name)
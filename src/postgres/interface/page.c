@@ -5,6 +5,7 @@ PostgreSQL Page Interface
 
 #include <string.h>
 
+#include "postgres/interface.h"
 #include "postgres/interface/static.vendor.h"
 
 /***********************************************************************************************************************************
@@ -18,3 +19,200 @@ pgPageChecksum(unsigned char *page, uint32_t blockNo)
 {
     return pg_checksum_page((char *)page, blockNo);
 }
+
+/***********************************************************************************************************************************
+Page checksum kernels
+
+A kernel calculates the block checksum (before the block number is mixed in and the result is reduced) for one or more contiguous
+pages. The checksum field of each page must already be zeroed.
+
+The checksum algorithm hashes the N_SUMS columns of the page independently so it maps directly onto vector registers. However, the
+baseline x86-64 instruction set has no 32-bit vector multiply so the vendored code cannot be vectorized well unless the compiler is
+allowed to use a later instruction set. Kernels are compiled for SSE4.1, AVX2, and AVX-512 and the best one supported by the CPU is
+selected at runtime. The wider kernels interleave several pages because there are fewer vectors per page than are needed to hide
+the latency of the multiply.
+***********************************************************************************************************************************/
+#define PAGE_CHECKSUM_KERNEL_PAGE_MAX                               4
+
+typedef void PageChecksumKernel(const unsigned char *page, uint32_t *result);
+
+typedef struct PageChecksumKernelSet
+{
+    unsigned int pageTotal;                                         // Pages checksummed by multi (<= PAGE_CHECKSUM_KERNEL_PAGE_MAX)
+    PageChecksumKernel *multi;                                      // Kernel that checksums pageTotal pages
+    PageChecksumKernel *single;                                     // Kernel that checksums one page
+} PageChecksumKernelSet;
+
+// Scalar kernel using the vendored code
+static void
+pgPageChecksumKernelScalar(const unsigned char *const page, uint32_t *const result)
+{
+    *result = pg_checksum_block((const PGChecksummablePage *)page);
+}
+
+static const PageChecksumKernelSet pgPageChecksumKernelScalarSet =
+{
+    .pageTotal = 1,
+    .multi = pgPageChecksumKernelScalar,
+    .single = pgPageChecksumKernelScalar,
+};
+
+#if defined(__x86_64__) && (defined(__clang__) || __GNUC__ >= 6)
+
+#define PAGE_CHECKSUM_SIMD
+
+// Define a kernel that uses vectors of the specified size and interleaves the specified number of pages. This is the same
+// calculation as pg_checksum_block() with the columns of each row loaded into vectors.
+#define PAGE_CHECKSUM_KERNEL(name, isa, vectorSize, pageTotal)                                                                     \
+static __attribute__((target(isa))) void                                                                                           \
+name(const unsigned char *const page, uint32_t *const result)                                                                      \
+{                                                                                                                                  \
+    typedef uint32_t Vector __attribute__((vector_size(vectorSize)));                                                              \
+    enum {vectorTotal = N_SUMS * sizeof(uint32) / vectorSize, laneTotal = vectorSize / sizeof(uint32)};                            \
+    Vector sums[pageTotal][vectorTotal];                                                                                           \
+                                                                                                                                   \
+    for (unsigned int pageIdx = 0; pageIdx < pageTotal; pageIdx++)                                                                 \
+        memcpy(sums[pageIdx], checksumBaseOffsets, sizeof(checksumBaseOffsets));                                                   \
+                                                                                                                                   \
+    for (unsigned int rowIdx = 0; rowIdx < BLCKSZ / (sizeof(uint32) * N_SUMS); rowIdx++)                                           \
+    {                                                                                                                              \
+        for (unsigned int pageIdx = 0; pageIdx < pageTotal; pageIdx++)                                                             \
+        {                                                                                                                          \
+            const unsigned char *const row = page + pageIdx * BLCKSZ + rowIdx * sizeof(uint32) * N_SUMS;                           \
+                                                                                                                                   \
+            for (unsigned int vectorIdx = 0; vectorIdx < vectorTotal; vectorIdx++)                                                 \
+            {                                                                                                                      \
+                Vector value;                                                                                                      \
+                memcpy(&value, row + vectorIdx * vectorSize, vectorSize);                                                          \
+                                                                                                                                   \
+                const Vector tmp = sums[pageIdx][vectorIdx] ^ value;                                                               \
+                sums[pageIdx][vectorIdx] = (tmp * (uint32)FNV_PRIME) ^ (tmp >> 17);                                                \
+            }                                                                                                                      \
+        }                                                                                                                          \
+    }                                                                                                                              \
+                                                                                                                                   \
+    for (unsigned int pageIdx = 0; pageIdx < pageTotal; pageIdx++)                                                                 \
+    {                                                                                                                              \
+        Vector fold = {0};                                                                                                         \
+                                                                                                                                   \
+        for (unsigned int vectorIdx = 0; vectorIdx < vectorTotal; vectorIdx++)                                                     \
+        {                                                                                                                          \
+            Vector tmp = sums[pageIdx][vectorIdx];                                                                                 \
+                                                                                                                                   \
+            for (unsigned int roundIdx = 0; roundIdx < 2; roundIdx++)                                                              \
+                tmp = (tmp * (uint32)FNV_PRIME) ^ (tmp >> 17);                                                                     \
+                                                                                                                                   \
+            fold ^= tmp;                                                                                                           \
+        }                                                                                                                          \
+                                                                                                                                   \
+        uint32 lane[laneTotal];                                                                                                    \
+        memcpy(lane, &fold, sizeof(lane));                                                                                         \
+                                                                                                                                   \
+        result[pageIdx] = 0;                                                                                                       \
+                                                                                                                                   \
+        for (unsigned int laneIdx = 0; laneIdx < laneTotal; laneIdx++)                                                             \
+            result[pageIdx] ^= lane[laneIdx];                                                                                      \
+    }                                                                                                                              \
+}
+
+// Kernels are only run when supported by the CPU so they may not all be covered
+PAGE_CHECKSUM_KERNEL(pgPageChecksumKernelSse41, "sse4.1", 16, 1)                               // {uncovered - depends on cpu}
+PAGE_CHECKSUM_KERNEL(pgPageChecksumKernelAvx2x1, "avx2", 32, 1)                                // {uncovered - depends on cpu}
+PAGE_CHECKSUM_KERNEL(pgPageChecksumKernelAvx2x2, "avx2", 32, 2)                                // {uncovered - depends on cpu}
+PAGE_CHECKSUM_KERNEL(pgPageChecksumKernelAvx512x1, "avx512f", 64, 1)                           // {uncovered - depends on cpu}
+PAGE_CHECKSUM_KERNEL(pgPageChecksumKernelAvx512x4, "avx512f", 64, 4)                           // {uncovered - depends on cpu}
+
+static const PageChecksumKernelSet pgPageChecksumKernelSse41Set =
+{
+    .pageTotal = 1,
+    .multi = pgPageChecksumKernelSse41,
+    .single = pgPageChecksumKernelSse41,
+};
+
+static const PageChecksumKernelSet pgPageChecksumKernelAvx2Set =
+{
+    .pageTotal = 2,
+    .multi = pgPageChecksumKernelAvx2x2,
+    .single = pgPageChecksumKernelAvx2x1,
+};
+
+static const PageChecksumKernelSet pgPageChecksumKernelAvx512Set =
+{
+    .pageTotal = 4,
+    .multi = pgPageChecksumKernelAvx512x4,
+    .single = pgPageChecksumKernelAvx512x1,
+};
+
+#endif // PAGE_CHECKSUM_SIMD
+
+/***********************************************************************************************************************************
+Select the best kernel set supported by the CPU
+***********************************************************************************************************************************/
+static const PageChecksumKernelSet *
+pgPageChecksumKernelSet(void)
+{
+    static const PageChecksumKernelSet *result = NULL;
+
+    if (result == NULL)
+    {
+        result = &pgPageChecksumKernelScalarSet;
+
+#ifdef PAGE_CHECKSUM_SIMD
+        __builtin_cpu_init();
+
+        if (__builtin_cpu_supports("avx512f"))                                          // {uncovered_branch - depends on cpu}
+            result = &pgPageChecksumKernelAvx512Set;                                    // {uncovered - depends on cpu}
+        else if (__builtin_cpu_supports("avx2"))                                        // {uncovered - depends on cpu}
+            result = &pgPageChecksumKernelAvx2Set;                                      // {uncovered - depends on cpu}
+        else if (__builtin_cpu_supports("sse4.1"))                                      // {uncovered - depends on cpu}
+            result = &pgPageChecksumKernelSse41Set;                                     // {uncovered - depends on cpu}
+#endif
+    }
+
+    return result;
+}
+
+/**********************************************************************************************************************************/
+static void
+pgPageChecksumMultiKernel(
+    const PageChecksumKernelSet *const kernelSet, unsigned char *const page, const unsigned int pageTotal, const uint32_t blockNo,
+    uint16_t *const checksum)
+{
+    unsigned int pageIdx = 0;
+
+    while (pageIdx < pageTotal)
+    {
+        // Use the multi kernel when there are enough pages left
+        const unsigned int kernelPageTotal = pageTotal - pageIdx >= kernelSet->pageTotal ? kernelSet->pageTotal : 1;
+        uint16 saveChecksum[PAGE_CHECKSUM_KERNEL_PAGE_MAX];
+        uint32_t result[PAGE_CHECKSUM_KERNEL_PAGE_MAX];
+
+        // Save pd_checksum and set it to zero, so the checksum calculation is not affected by the old checksum stored on the page
+        for (unsigned int kernelPageIdx = 0; kernelPageIdx < kernelPageTotal; kernelPageIdx++)
+        {
+            PageHeaderData *const pageHeader = (PageHeaderData *)(page + (pageIdx + kernelPageIdx) * BLCKSZ);
+
+            saveChecksum[kernelPageIdx] = pageHeader->pd_checksum;
+            pageHeader->pd_checksum = 0;
+        }
+
+        (kernelPageTotal == 1 ? kernelSet->single : kernelSet->multi)(page + pageIdx * BLCKSZ, result);
+
+        // Restore pd_checksum, mix in the block number, and reduce to a uint16 the same way as pg_checksum_page()
+        for (unsigned int kernelPageIdx = 0; kernelPageIdx < kernelPageTotal; kernelPageIdx++)
+        {
+            ((PageHeaderData *)(page + (pageIdx + kernelPageIdx) * BLCKSZ))->pd_checksum = saveChecksum[kernelPageIdx];
+
+            checksum[pageIdx + kernelPageIdx] = (uint16_t)(
+                ((result[kernelPageIdx] ^ (blockNo + pageIdx + kernelPageIdx)) % 65535) + 1);
+        }
+
+        pageIdx += kernelPageTotal;
+    }
+}
+
+void
+pgPageChecksumMulti(unsigned char *const page, const unsigned int pageTotal, const uint32_t blockNo, uint16_t *const checksum)
+{
+    pgPageChecksumMultiKernel(pgPageChecksumKernelSet(), page, pageTotal, blockNo, checksum);
+}
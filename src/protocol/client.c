@@ -26,7 +26,6 @@ Object type
 struct ProtocolClient
 {
     ProtocolClientPub pub;                                          // Publicly accessible variables
-    IoWrite *write;                                                 // Write interface
     const String *name;                                             // Name displayed in logging
     const String *errorPrefix;                                      // Prefix used when throwing error
     TimeMSec keepAliveTime;                                         // Last time data was put to the server
@@ -83,8 +82,8 @@ protocolClientNew(const String *name, const String *service, IoRead *read, IoWri
             {
                 .memContext = memContextCurrent(),
                 .read = read,
+                .write = write,
             },
-            .write = write,
             .name = strDup(name),
             .errorPrefix = strNewFmt("raised from %s", strZ(name)),
             .keepAliveTime = timeMSec(),
@@ -155,14 +154,14 @@ protocolClientDataPut(ProtocolClient *const this, PackWrite *const data)
         pckWriteEndP(data);
 
     // Write the data
-    PackWrite *dataMessage = pckWriteNew(this->write);
+    PackWrite *dataMessage = pckWriteNew(this->pub.write);
     pckWriteU32P(dataMessage, protocolMessageTypeData, .defaultWrite = true);
     pckWritePackP(dataMessage, data);
     pckWriteEndP(dataMessage);
 
     // Flush when there is no more data to put
     if (data == NULL)
-        ioWriteFlush(this->write);
+        ioWriteFlush(this->pub.write);
 
     FUNCTION_LOG_RETURN_VOID();
 }
@@ -271,7 +270,7 @@ protocolClientCommandPut(ProtocolClient *const this, ProtocolCommand *const comm
     ASSERT(command != NULL);
 
     // Put command
-    protocolCommandPut(command, this->write);
+    protocolCommandPut(command, this->pub.write);
 
     // Reset the keep alive time
     this->keepAliveTime = timeMSec();
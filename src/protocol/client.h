@@ -70,6 +70,7 @@ typedef struct ProtocolClientPub
 {
     MemContext *memContext;                                         // Mem context
     IoRead *read;                                                   // Read interface
+    IoWrite *write;                                                 // Write interface
 } ProtocolClientPub;
 
 // Read file descriptor
@@ -79,6 +80,20 @@ protocolClientIoReadFd(ProtocolClient *const this)
     return ioReadFd(THIS_PUB(ProtocolClient)->read);
 }
 
+// Write file descriptor
+__attribute__((always_inline)) static inline int
+protocolClientIoWriteFd(ProtocolClient *const this)
+{
+    return ioWriteFd(THIS_PUB(ProtocolClient)->write);
+}
+
+// Is response data buffered? Buffered data can be read without waiting on the read file descriptor.
+__attribute__((always_inline)) static inline bool
+protocolClientIoReadBuffered(ProtocolClient *const this)
+{
+    return ioReadBuffered(THIS_PUB(ProtocolClient)->read);
+}
+
 /***********************************************************************************************************************************
 Functions
 ***********************************************************************************************************************************/
@@ -18,8 +18,14 @@ struct ProtocolCommand
     MemContext *memContext;
     StringId command;
     PackWrite *pack;
+    bool packEnd;                                                   // Has the param pack been ended?
 };
 
+/***********************************************************************************************************************************
+Upper bound on the bytes written around the param pack, i.e. message type, command id, pack size, and end marker
+***********************************************************************************************************************************/
+#define PROTOCOL_COMMAND_ENVELOPE_SIZE                              64
+
 /**********************************************************************************************************************************/
 ProtocolCommand *
 protocolCommandNew(const StringId command)
@@ -47,6 +53,28 @@ protocolCommandNew(const StringId command)
     FUNCTION_TEST_RETURN(this);
 }
 
+/***********************************************************************************************************************************
+End the param pack so the size is known. This may be called before the command is written so it must only be done once.
+***********************************************************************************************************************************/
+static void
+protocolCommandParamEnd(ProtocolCommand *const this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(PROTOCOL_COMMAND, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->pack != NULL);
+
+    if (!this->packEnd)
+    {
+        pckWriteEndP(this->pack);
+        this->packEnd = true;
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 void
 protocolCommandPut(ProtocolCommand *const this, IoWrite *const write)
@@ -66,7 +94,7 @@ protocolCommandPut(ProtocolCommand *const this, IoWrite *const write)
     // Only write params if there were any
     if (this->pack != NULL)
     {
-        pckWriteEndP(this->pack);
+        protocolCommandParamEnd(this);
         pckWritePackP(commandPack, this->pack);
     }
 
@@ -87,6 +115,7 @@ protocolCommandParam(ProtocolCommand *this)
     FUNCTION_TEST_END();
 
     ASSERT(this != NULL);
+    ASSERT(!this->packEnd);
 
     if (this->pack == NULL)
     {
@@ -100,6 +129,27 @@ protocolCommandParam(ProtocolCommand *this)
     FUNCTION_TEST_RETURN(this->pack);
 }
 
+/**********************************************************************************************************************************/
+size_t
+protocolCommandSize(ProtocolCommand *const this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(PROTOCOL_COMMAND, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    size_t result = PROTOCOL_COMMAND_ENVELOPE_SIZE;
+
+    if (this->pack != NULL)
+    {
+        protocolCommandParamEnd(this);
+        result += bufUsed(pckWriteBuf(this->pack));
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 /**********************************************************************************************************************************/
 String *
 protocolCommandToLog(const ProtocolCommand *this)
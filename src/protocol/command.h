@@ -34,6 +34,9 @@ PackWrite *protocolCommandParam(ProtocolCommand *this);
 // Write protocol command
 void protocolCommandPut(ProtocolCommand *this, IoWrite *write);
 
+// Upper bound on the bytes that will be written by protocolCommandPut(). No more params may be added after this is called.
+size_t protocolCommandSize(ProtocolCommand *this);
+
 /***********************************************************************************************************************************
 Destructor
 ***********************************************************************************************************************************/
@@ -3,18 +3,32 @@ Protocol Helper
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdlib.h>
 #include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 #include "common/crypto/common.h"
 #include "common/debug.h"
 #include "common/exec.h"
+#include "common/fork.h"
+#include "common/io/socket/client.h"
+#include "common/io/socket/session.h"
+#include "common/io/tls/client.h"
 #include "common/memContext.h"
+#include "common/type/json.h"
 #include "config/config.intern.h"
 #include "config/exec.h"
 #include "config/parse.h"
 #include "config/protocol.h"
 #include "postgres/version.h"
 #include "protocol/helper.h"
+#include "protocol/mux.h"
 #include "version.h"
 
 /***********************************************************************************************************************************
@@ -29,9 +43,19 @@ Local variables
 typedef struct ProtocolHelperClient
 {
     Exec *exec;                                                     // Executed client
+    IoSession *session;                                             // Session (when connected to a server/mux, not executed)
     ProtocolClient *client;                                         // Protocol client
 } ProtocolHelperClient;
 
+// Relay process that multiplexes the remotes started by locals over a single SSH connection to the host
+typedef struct ProtocolHelperMux
+{
+    ProtocolStorageType protocolStorageType;                        // Remote storage type
+    unsigned int hostIdx;                                           // Remote host index
+    pid_t processId;                                                // Relay process id
+    int fdControl;                                                  // Close to stop the relay
+} ProtocolHelperMux;
+
 static struct
 {
     MemContext *memContext;                                         // Mem context for protocol helper
@@ -41,6 +65,9 @@ static struct
 
     unsigned int clientLocalSize;                                   // Local clients
     ProtocolHelperClient *clientLocal;
+
+    String *muxPath;                                                // Path where relays listen for locals
+    List *muxList;                                                  // Relays started for locals
 } protocolHelper;
 
 /***********************************************************************************************************************************
@@ -122,6 +149,9 @@ pgIsLocalVerify(void)
     FUNCTION_TEST_RETURN_VOID();
 }
 
+// Start a relay for a remote host, defined below with the other remote functions
+static void protocolHelperMuxStart(ProtocolStorageType protocolStorageType, unsigned int hostIdx);
+
 /***********************************************************************************************************************************
 Get the command line required for local protocol execution
 ***********************************************************************************************************************************/
@@ -163,6 +193,10 @@ protocolLocalParam(ProtocolStorageType protocolStorageType, unsigned int hostIdx
         // Disable output to stdout since it is used by the protocol
         kvPut(optionReplace, VARSTRDEF(CFGOPT_LOG_LEVEL_CONSOLE), VARSTRDEF("off"));
 
+        // Tell the local where to find relays when remotes are multiplexed
+        if (protocolHelper.muxPath != NULL)
+            kvPut(optionReplace, VARSTRDEF(CFGOPT_REMOTE_MUX_PATH), VARSTR(protocolHelper.muxPath));
+
         result = strLstMove(cfgExecParam(cfgCommand(), cfgCmdRoleLocal, optionReplace, true, false), memContextPrior());
     }
     MEM_CONTEXT_TEMP_END();
@@ -235,6 +269,24 @@ protocolLocalGet(ProtocolStorageType protocolStorageType, unsigned int hostIdx,
     {
         MEM_CONTEXT_BEGIN(protocolHelper.memContext)
         {
+            // Start relays for the remote hosts the local may connect to so the remotes can share a connection to each host
+            if (cfgOptionBool(cfgOptProtocolMux))
+            {
+                if (protocolStorageType == protocolStorageTypePg)
+                {
+                    if (!pgIsLocal(hostIdx))
+                        protocolHelperMuxStart(protocolStorageTypePg, hostIdx);
+                }
+                else
+                {
+                    for (unsigned int repoIdx = 0; repoIdx < cfgOptionGroupIdxTotal(cfgOptGrpRepo); repoIdx++)
+                    {
+                        if (!repoIsLocal(repoIdx))
+                            protocolHelperMuxStart(protocolStorageTypeRepo, repoIdx);
+                    }
+                }
+            }
+
             protocolLocalExec(protocolHelperClient, protocolStorageType, hostIdx, processId);
         }
         MEM_CONTEXT_END();
@@ -267,10 +319,11 @@ protocolHelperClientFree(ProtocolHelperClient *protocolHelperClient)
         }
         TRY_END();
 
-        // Try to end the child process but only warn on error
+        // Try to end the child process or close the session but only warn on error
         TRY_BEGIN()
         {
             execFree(protocolHelperClient->exec);
+            ioSessionFree(protocolHelperClient->session);
         }
         CATCH_ANY()
         {
@@ -280,6 +333,7 @@ protocolHelperClientFree(ProtocolHelperClient *protocolHelperClient)
 
         protocolHelperClient->client = NULL;
         protocolHelperClient->exec = NULL;
+        protocolHelperClient->session = NULL;
     }
 
     FUNCTION_LOG_RETURN_VOID();
@@ -302,17 +356,66 @@ protocolLocalFree(unsigned int processId)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/**********************************************************************************************************************************/
+bool
+protocolServerOptionValid(const ConfigOption optionId)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(ENUM, optionId);
+    FUNCTION_TEST_END();
+
+    ASSERT(optionId < CFG_OPTION_TOTAL);
+
+    static const ConfigOption optionList[] =
+    {
+        cfgOptBufferSize,
+        cfgOptCompressLevelNetwork,
+        cfgOptDbTimeout,
+        cfgOptExecId,
+        cfgOptIoTimeout,
+        cfgOptLogLevelConsole,
+        cfgOptLogLevelFile,
+        cfgOptLogLevelStderr,
+        cfgOptLogSubprocess,
+        cfgOptLogTimestamp,
+        cfgOptProcess,
+        cfgOptProtocolTimeout,
+        cfgOptRemoteType,
+        cfgOptRepo,
+        cfgOptStanza,
+    };
+
+    bool result = false;
+
+    for (unsigned int optionIdx = 0; optionIdx < sizeof(optionList) / sizeof(ConfigOption); optionIdx++)
+    {
+        if (optionList[optionIdx] == optionId)
+        {
+            result = true;
+            break;
+        }
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 /***********************************************************************************************************************************
-Get the command line required for remote protocol execution
+Get the command line required for remote protocol execution. When the parameters are sent over a session (to a TLS server or a mux)
+they are not quoted since they are not passed through a shell and config options are not sent since the remote always uses the
+configuration it was started with. When the parameters are sent to a TLS server only the options allowed by the server are sent.
 ***********************************************************************************************************************************/
 static StringList *
-protocolRemoteParam(ProtocolStorageType protocolStorageType, unsigned int hostIdx)
+protocolRemoteParam(ProtocolStorageType protocolStorageType, unsigned int hostIdx, bool session, bool server)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING_ID, protocolStorageType);
         FUNCTION_LOG_PARAM(UINT, hostIdx);
+        FUNCTION_LOG_PARAM(BOOL, session);
+        FUNCTION_LOG_PARAM(BOOL, server);
     FUNCTION_LOG_END();
 
+    ASSERT(session || !server);
+
     // Is this a repo remote?
     bool isRepo = protocolStorageType == protocolStorageTypeRepo;
 
@@ -324,20 +427,22 @@ protocolRemoteParam(ProtocolStorageType protocolStorageType, unsigned int hostId
 
     kvPut(
         optionReplace, VARSTRDEF(CFGOPT_CONFIG),
-        cfgOptionIdxSource(optConfig, hostIdx) != cfgSourceDefault ? VARSTR(cfgOptionIdxStr(optConfig, hostIdx)) : NULL);
+        !session && cfgOptionIdxSource(optConfig, hostIdx) != cfgSourceDefault ?
+            VARSTR(cfgOptionIdxStr(optConfig, hostIdx)) : NULL);
 
     unsigned int optConfigIncludePath = isRepo ? cfgOptRepoHostConfigIncludePath : cfgOptPgHostConfigIncludePath;
 
     kvPut(
         optionReplace, VARSTRDEF(CFGOPT_CONFIG_INCLUDE_PATH),
-        cfgOptionIdxSource(optConfigIncludePath, hostIdx) != cfgSourceDefault ?
+        !session && cfgOptionIdxSource(optConfigIncludePath, hostIdx) != cfgSourceDefault ?
             VARSTR(cfgOptionIdxStr(optConfigIncludePath, hostIdx)) : NULL);
 
     unsigned int optConfigPath = isRepo ? cfgOptRepoHostConfigPath : cfgOptPgHostConfigPath;
 
     kvPut(
         optionReplace, VARSTRDEF(CFGOPT_CONFIG_PATH),
-        cfgOptionIdxSource(optConfigPath, hostIdx) != cfgSourceDefault ? VARSTR(cfgOptionIdxStr(optConfigPath, hostIdx)) : NULL);
+        !session && cfgOptionIdxSource(optConfigPath, hostIdx) != cfgSourceDefault ?
+            VARSTR(cfgOptionIdxStr(optConfigPath, hostIdx)) : NULL);
 
     // Update/remove repo/pg options that are sent to the remote
     for (ConfigOption optionId = 0; optionId < CFG_OPTION_TOTAL; optionId++)
@@ -419,16 +524,32 @@ protocolRemoteParam(ProtocolStorageType protocolStorageType, unsigned int hostId
     // Add the remote type
     kvPut(optionReplace, VARSTRDEF(CFGOPT_REMOTE_TYPE), VARSTR(strIdToStr(protocolStorageType)));
 
-    FUNCTION_LOG_RETURN(STRING_LIST, cfgExecParam(cfgCommand(), cfgCmdRoleRemote, optionReplace, false, true));
+    // Remove options that the server does not allow since it loads them from its own configuration
+    if (server)
+    {
+        for (ConfigOption optionId = 0; optionId < CFG_OPTION_TOTAL; optionId++)
+        {
+            if (protocolServerOptionValid(optionId))
+                continue;
+
+            const unsigned int optionIdxTotal = cfgOptionGroup(optionId) ? cfgOptionGroupIdxTotal(cfgOptionGroupId(optionId)) : 1;
+
+            for (unsigned int optionIdx = 0; optionIdx < optionIdxTotal; optionIdx++)
+                kvPut(optionReplace, VARSTRZ(cfgOptionIdxName(optionId, optionIdx)), NULL);
+        }
+    }
+
+    FUNCTION_LOG_RETURN(STRING_LIST, cfgExecParam(cfgCommand(), cfgCmdRoleRemote, optionReplace, false, !session));
 }
 
-// Helper to add SSH parameters when executing the remote via SSH
+// Helper to add SSH parameters when executing the remote via SSH. When mux is true the remote relays remotes started by locals.
 static StringList *
-protocolRemoteParamSsh(const ProtocolStorageType protocolStorageType, const unsigned int hostIdx)
+protocolRemoteParamSsh(const ProtocolStorageType protocolStorageType, const unsigned int hostIdx, const bool mux)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING_ID, protocolStorageType);
         FUNCTION_LOG_PARAM(UINT, hostIdx);
+        FUNCTION_LOG_PARAM(BOOL, mux);
     FUNCTION_LOG_END();
 
     StringList *result = NULL;
@@ -464,7 +585,10 @@ protocolRemoteParamSsh(const ProtocolStorageType protocolStorageType, const unsi
                 strZ(cfgOptionIdxStr(isRepo ? cfgOptRepoHost : cfgOptPgHost, hostIdx))));
 
         // Add remote command and parameters
-        StringList *paramList = protocolRemoteParam(protocolStorageType, hostIdx);
+        StringList *paramList = protocolRemoteParam(protocolStorageType, hostIdx, false, false);
+
+        if (mux)
+            strLstInsert(paramList, strLstSize(paramList) - 1, STRDEF("--" CFGOPT_REMOTE_MUX));
 
         strLstInsert(paramList, 0, cfgOptionIdxStr(isRepo ? cfgOptRepoHostCmd : cfgOptPgHostCmd, hostIdx));
         strLstAdd(result, strLstJoin(paramList, " "));
@@ -477,6 +601,387 @@ protocolRemoteParamSsh(const ProtocolStorageType protocolStorageType, const unsi
     FUNCTION_LOG_RETURN(STRING_LIST, result);
 }
 
+// Helper to get the socket address where the relay for a remote host listens for locals
+static struct sockaddr_un
+protocolHelperMuxAddress(const String *const path, const ProtocolStorageType protocolStorageType, const unsigned int hostIdx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STRING, path);
+        FUNCTION_TEST_PARAM(STRING_ID, protocolStorageType);
+        FUNCTION_TEST_PARAM(UINT, hostIdx);
+    FUNCTION_TEST_END();
+
+    ASSERT(path != NULL);
+
+    struct sockaddr_un result = {.sun_family = AF_UNIX};
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const String *const socketPath = strNewFmt(
+            "%s/%s%u.mux", strZ(path), strZ(strIdToStr(protocolStorageType)),
+            cfgOptionGroupIdxToKey(protocolStorageType == protocolStorageTypeRepo ? cfgOptGrpRepo : cfgOptGrpPg, hostIdx));
+
+        if (strSize(socketPath) >= sizeof(result.sun_path))
+            THROW_FMT(AssertError, "mux socket path '%s' is too long", strZ(socketPath));
+
+        strncpy(result.sun_path, strZ(socketPath), sizeof(result.sun_path) - 1);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+// Helper to relay connections from locals over a single SSH connection. This runs in a child of the process that starts the locals.
+static void
+protocolHelperMuxRelay(
+    const ProtocolStorageType protocolStorageType, const unsigned int hostIdx, const int fdListen, const int fdControl)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING_ID, protocolStorageType);
+        FUNCTION_LOG_PARAM(UINT, hostIdx);
+        FUNCTION_LOG_PARAM(INT, fdListen);
+        FUNCTION_LOG_PARAM(INT, fdControl);
+    FUNCTION_LOG_END();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const bool isRepo = protocolStorageType == protocolStorageTypeRepo;
+
+        Exec *const exec = execNew(
+            cfgOptionStr(cfgOptCmdSsh), protocolRemoteParamSsh(protocolStorageType, hostIdx, true),
+            strNewFmt(
+                PROTOCOL_SERVICE_REMOTE " mux process on '%s'",
+                strZ(cfgOptionIdxStr(isRepo ? cfgOptRepoHost : cfgOptPgHost, hostIdx))),
+            cfgOptionUInt64(cfgOptProtocolTimeout));
+        execOpen(exec);
+
+        // Relay until the process that started the relay is done with it or the remote exits
+        ProtocolMux *const mux = protocolMuxNew(
+            ioReadFd(execIoRead(exec)), ioWriteFd(execIoWrite(exec)), fdListen, fdControl);
+
+        while (protocolMuxProcess(mux) != 0);
+
+        // Close the channels and then wait for the remote to exit
+        protocolMuxFree(mux);
+        execFree(exec);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+static void
+protocolHelperMuxStart(const ProtocolStorageType protocolStorageType, const unsigned int hostIdx)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(STRING_ID, protocolStorageType);
+        FUNCTION_LOG_PARAM(UINT, hostIdx);
+    FUNCTION_LOG_END();
+
+    // Only remotes executed via SSH are multiplexed
+    const bool isRepo = protocolStorageType == protocolStorageTypeRepo;
+
+    if (cfgOptionIdxStrId(isRepo ? cfgOptRepoHostType : cfgOptPgHostType, hostIdx) ==
+            (isRepo ? CFGOPTVAL_REPO_HOST_TYPE_SSH : CFGOPTVAL_PG_HOST_TYPE_SSH))
+    {
+        // Create the relay list and a private path for the sockets the first time a relay is started
+        if (protocolHelper.muxList == NULL)
+        {
+            MEM_CONTEXT_BEGIN(protocolHelper.memContext)
+            {
+                // Create a private path for the sockets in TMPDIR, or /tmp when TMPDIR is not set
+                MEM_CONTEXT_TEMP_BEGIN()
+                {
+                    const char *const tmpPath = getenv("TMPDIR");
+                    const String *const muxPathTemplate = strNewFmt(
+                        "%s/" PROJECT_BIN "-mux-XXXXXX", tmpPath == NULL || tmpPath[0] == '\0' ? "/tmp" : tmpPath);
+                    char *const muxPath = memNew(strSize(muxPathTemplate) + 1);
+
+                    strcpy(muxPath, strZ(muxPathTemplate));
+
+                    THROW_ON_SYS_ERROR_FMT(
+                        mkdtemp(muxPath) == NULL, PathCreateError, "unable to create mux path '%s'", strZ(muxPathTemplate));
+
+                    MEM_CONTEXT_PRIOR_BEGIN()
+                    {
+                        protocolHelper.muxPath = strNewZ(muxPath);
+                    }
+                    MEM_CONTEXT_PRIOR_END();
+                }
+                MEM_CONTEXT_TEMP_END();
+
+                protocolHelper.muxList = lstNewP(sizeof(ProtocolHelperMux));
+            }
+            MEM_CONTEXT_END();
+        }
+
+        // Skip the host if a relay has already been started
+        bool found = false;
+
+        for (unsigned int muxIdx = 0; muxIdx < lstSize(protocolHelper.muxList); muxIdx++)
+        {
+            const ProtocolHelperMux *const mux = lstGet(protocolHelper.muxList, muxIdx);
+
+            if (mux->protocolStorageType == protocolStorageType && mux->hostIdx == hostIdx)
+                found = true;
+        }
+
+        if (!found)
+        {
+            // Listen before starting the relay so locals can connect as soon as they start
+            const struct sockaddr_un address = protocolHelperMuxAddress(protocolHelper.muxPath, protocolStorageType, hostIdx);
+            const int fdListen = socket(AF_UNIX, SOCK_STREAM, 0);
+
+            THROW_ON_SYS_ERROR(fdListen == -1, FileOpenError, "unable to create mux socket");
+
+            int fdControl[2] = {-1, -1};
+
+            TRY_BEGIN()
+            {
+                THROW_ON_SYS_ERROR_FMT(
+                    bind(fdListen, (const struct sockaddr *)&address, sizeof(address)) == -1, FileOpenError,
+                    "unable to bind mux socket '%s'", address.sun_path);
+                THROW_ON_SYS_ERROR_FMT(
+                    listen(fdListen, SOMAXCONN) == -1, FileOpenError, "unable to listen on mux socket '%s'", address.sun_path);
+
+                // The relay stops when the write end of the control pipe is closed. Neither end should be inherited by locals.
+                THROW_ON_SYS_ERROR(pipe(fdControl) == -1, KernelError, "unable to create mux control pipe");
+                THROW_ON_SYS_ERROR(
+                    fcntl(fdControl[0], F_SETFD, FD_CLOEXEC) == -1 || fcntl(fdControl[1], F_SETFD, FD_CLOEXEC) == -1,
+                    KernelError, "unable to set FD_CLOEXEC");
+            }
+            CATCH_ANY()
+            {
+                close(fdListen);
+                close(fdControl[0]);
+                close(fdControl[1]);
+
+                RETHROW();
+            }
+            TRY_END();
+
+            const pid_t processId = forkSafe();
+
+            if (processId == 0)
+            {
+                // Exit on signals without running the exit handlers of the parent
+                signal(SIGHUP, SIG_DFL);
+                signal(SIGINT, SIG_DFL);
+                signal(SIGTERM, SIG_DFL);
+
+                // Close the write end of the control pipe and those of other relays so eof is seen when the parent closes them
+                close(fdControl[1]);
+
+                for (unsigned int muxIdx = 0; muxIdx < lstSize(protocolHelper.muxList); muxIdx++)
+                    close(((const ProtocolHelperMux *)lstGet(protocolHelper.muxList, muxIdx))->fdControl);
+
+                int result = 0;
+
+                TRY_BEGIN()
+                {
+                    protocolHelperMuxRelay(protocolStorageType, hostIdx, fdListen, fdControl[0]);
+                }
+                CATCH_ANY()
+                {
+                    LOG_ERROR(errorCode(), errorMessage());
+                    result = errorCode();
+                }
+                TRY_END();
+
+                // Exit without freeing resources that are owned by the parent
+                _exit(result);
+            }
+
+            close(fdListen);
+            close(fdControl[0]);
+
+            lstAdd(
+                protocolHelper.muxList,
+                &(ProtocolHelperMux)
+                {
+                    .protocolStorageType = protocolStorageType,
+                    .hostIdx = hostIdx,
+                    .processId = processId,
+                    .fdControl = fdControl[1],
+                });
+        }
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+// Stop relays and remove the path where they listen
+static void
+protocolHelperMuxFree(void)
+{
+    FUNCTION_LOG_VOID(logLevelDebug);
+
+    if (protocolHelper.muxList != NULL)
+    {
+        for (unsigned int muxIdx = 0; muxIdx < lstSize(protocolHelper.muxList); muxIdx++)
+        {
+            const ProtocolHelperMux *const mux = lstGet(protocolHelper.muxList, muxIdx);
+            const struct sockaddr_un address = protocolHelperMuxAddress(
+                protocolHelper.muxPath, mux->protocolStorageType, mux->hostIdx);
+
+            close(mux->fdControl);
+            waitpid(mux->processId, NULL, 0);
+            unlink(address.sun_path);
+        }
+
+        rmdir(strZ(protocolHelper.muxPath));
+
+        lstFree(protocolHelper.muxList);
+        protocolHelper.muxList = NULL;
+        strFree(protocolHelper.muxPath);
+        protocolHelper.muxPath = NULL;
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+// Helper to send the parameters for the remote over a session and create the protocol client. The remote loads the parameters as
+// its configuration and then starts processing protocol commands. A TLS server only accepts a limited set of options.
+static void
+protocolRemoteSession(
+    ProtocolHelperClient *const helper, const ProtocolStorageType protocolStorageType, const unsigned int hostIdx,
+    const bool server, const String *const name)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM_P(VOID, helper);
+        FUNCTION_LOG_PARAM(STRING_ID, protocolStorageType);
+        FUNCTION_LOG_PARAM(UINT, hostIdx);
+        FUNCTION_LOG_PARAM(BOOL, server);
+        FUNCTION_LOG_PARAM(STRING, name);
+    FUNCTION_LOG_END();
+
+    ASSERT(helper != NULL);
+    ASSERT(helper->session != NULL);
+    ASSERT(name != NULL);
+
+    // Send the parameters that the remote will use for its configuration
+    IoWrite *const write = ioSessionIoWrite(helper->session);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        ioWriteStrLine(
+            write,
+            jsonFromVar(varNewVarLst(varLstNewStrLst(protocolRemoteParam(protocolStorageType, hostIdx, true, server)))));
+        ioWriteFlush(write);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    // Create protocol object
+    helper->client = protocolClientNew(name, PROTOCOL_SERVICE_REMOTE_STR, ioSessionIoRead(helper->session), write);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+// Helper to connect a local to the relay for a remote host. Returns false when there is no relay for the host so the remote should
+// be executed via SSH instead.
+static bool
+protocolRemoteMux(
+    ProtocolHelperClient *const helper, const ProtocolStorageType protocolStorageType, const unsigned int hostIdx,
+    const unsigned int processId)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM_P(VOID, helper);
+        FUNCTION_LOG_PARAM(STRING_ID, protocolStorageType);
+        FUNCTION_LOG_PARAM(UINT, hostIdx);
+        FUNCTION_LOG_PARAM(UINT, processId);
+    FUNCTION_LOG_END();
+
+    ASSERT(helper != NULL);
+
+    bool result = false;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const struct sockaddr_un address = protocolHelperMuxAddress(
+            cfgOptionStr(cfgOptRemoteMuxPath), protocolStorageType, hostIdx);
+        const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+        THROW_ON_SYS_ERROR(fd == -1, FileOpenError, "unable to create mux socket");
+
+        if (connect(fd, (const struct sockaddr *)&address, sizeof(address)) == -1)
+        {
+            // The relay may have exited early, e.g. if the remote could not be started, so warn that it is not being used
+            if (errno != ENOENT)
+                LOG_WARN_FMT("unable to connect to mux socket '%s': [%d] %s", address.sun_path, errno, strerror(errno));
+
+            close(fd);
+        }
+        else
+        {
+            const String *const host = cfgOptionIdxStr(
+                protocolStorageType == protocolStorageTypeRepo ? cfgOptRepoHost : cfgOptPgHost, hostIdx);
+
+            MEM_CONTEXT_PRIOR_BEGIN()
+            {
+                helper->session = sckSessionNew(
+                    ioSessionRoleClient, fd, STR(address.sun_path), 0, cfgOptionUInt64(cfgOptProtocolTimeout));
+                protocolRemoteSession(
+                    helper, protocolStorageType, hostIdx, false,
+                    strNewFmt(PROTOCOL_SERVICE_REMOTE "-%u protocol on '%s' (mux)", processId, strZ(host)));
+            }
+            MEM_CONTEXT_PRIOR_END();
+
+            result = true;
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
+
+// Helper to connect to a remote TLS server. Instead of executing the remote command the parameters are sent to the server, which
+// loads them as its configuration and then starts processing protocol commands.
+static void
+protocolRemoteTls(
+    ProtocolHelperClient *const helper, const ProtocolStorageType protocolStorageType, const unsigned int hostIdx,
+    const unsigned int processId)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM_P(VOID, helper);
+        FUNCTION_LOG_PARAM(STRING_ID, protocolStorageType);
+        FUNCTION_LOG_PARAM(UINT, hostIdx);
+        FUNCTION_LOG_PARAM(UINT, processId);
+    FUNCTION_LOG_END();
+
+    ASSERT(helper != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Is this a repo remote?
+        const bool isRepo = protocolStorageType == protocolStorageTypeRepo;
+
+        // Open the TLS session. The default port is used when no port is specified.
+        const String *const host = cfgOptionIdxStr(isRepo ? cfgOptRepoHost : cfgOptPgHost, hostIdx);
+        const ConfigOption optHostPort = isRepo ? cfgOptRepoHostPort : cfgOptPgHostPort;
+        const unsigned int port =
+            cfgOptionIdxTest(optHostPort, hostIdx) ? cfgOptionIdxUInt(optHostPort, hostIdx) : PROTOCOL_SERVER_PORT_DEFAULT;
+        const TimeMSec timeout = cfgOptionUInt64(cfgOptProtocolTimeout);
+
+        IoClient *const ioClient = tlsClientNewP(
+            sckClientNew(host, port, timeout), host, timeout, true,
+            .caFile = cfgOptionIdxStrNull(isRepo ? cfgOptRepoHostCaFile : cfgOptPgHostCaFile, hostIdx),
+            .certFile = cfgOptionIdxStr(isRepo ? cfgOptRepoHostCertFile : cfgOptPgHostCertFile, hostIdx),
+            .keyFile = cfgOptionIdxStr(isRepo ? cfgOptRepoHostKeyFile : cfgOptPgHostKeyFile, hostIdx));
+
+        MEM_CONTEXT_PRIOR_BEGIN()
+        {
+            helper->session = ioClientOpen(ioClient);
+            protocolRemoteSession(
+                helper, protocolStorageType, hostIdx, true,
+                strNewFmt(PROTOCOL_SERVICE_REMOTE "-%u protocol on '%s'", processId, strZ(ioClientName(ioClient))));
+        }
+        MEM_CONTEXT_PRIOR_END();
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 // Helper to execute the local process. This is a separate function solely so that it can be shimmed during testing.
 static void
@@ -493,21 +998,31 @@ protocolRemoteExec(
 
     ASSERT(helper != NULL);
 
-    // Execute the protocol command
-    const char *const host =
-        strZ(cfgOptionIdxStr(protocolStorageType == protocolStorageTypeRepo ? cfgOptRepoHost : cfgOptPgHost, hostIdx));
+    // Connect to the server if the remote is a TLS server
+    const bool isRepo = protocolStorageType == protocolStorageTypeRepo;
 
-    helper->exec = execNew(
-        cfgOptionStr(cfgOptCmdSsh), protocolRemoteParamSsh(protocolStorageType, hostIdx),
-        strNewFmt(PROTOCOL_SERVICE_REMOTE "-%u process on '%s'", processId, host), cfgOptionUInt64(cfgOptProtocolTimeout));
-    execOpen(helper->exec);
+    if (cfgOptionIdxStrId(isRepo ? cfgOptRepoHostType : cfgOptPgHostType, hostIdx) ==
+            (isRepo ? CFGOPTVAL_REPO_HOST_TYPE_TLS : CFGOPTVAL_PG_HOST_TYPE_TLS))
+    {
+        protocolRemoteTls(helper, protocolStorageType, hostIdx, processId);
+    }
+    // Else connect to the relay for the host when remotes are multiplexed or execute the remote command via SSH
+    else if (!cfgOptionTest(cfgOptRemoteMuxPath) || !protocolRemoteMux(helper, protocolStorageType, hostIdx, processId))
+    {
+        const char *const host = strZ(cfgOptionIdxStr(isRepo ? cfgOptRepoHost : cfgOptPgHost, hostIdx));
 
-    // Create protocol object
-    helper->client = protocolClientNew(
-        strNewFmt(PROTOCOL_SERVICE_REMOTE "-%u protocol on '%s'", processId, host), PROTOCOL_SERVICE_REMOTE_STR,
-        execIoRead(helper->exec), execIoWrite(helper->exec));
+        helper->exec = execNew(
+            cfgOptionStr(cfgOptCmdSsh), protocolRemoteParamSsh(protocolStorageType, hostIdx, false),
+            strNewFmt(PROTOCOL_SERVICE_REMOTE "-%u process on '%s'", processId, host), cfgOptionUInt64(cfgOptProtocolTimeout));
+        execOpen(helper->exec);
 
-    protocolClientMove(helper->client, execMemContext(helper->exec));
+        // Create protocol object
+        helper->client = protocolClientNew(
+            strNewFmt(PROTOCOL_SERVICE_REMOTE "-%u protocol on '%s'", processId, host), PROTOCOL_SERVICE_REMOTE_STR,
+            execIoRead(helper->exec), execIoWrite(helper->exec));
+
+        protocolClientMove(helper->client, execMemContext(helper->exec));
+    }
 
     FUNCTION_TEST_RETURN_VOID();
 }
@@ -628,6 +1143,9 @@ protocolFree(void)
         // Free locals
         for (unsigned int clientIdx = 1; clientIdx <= protocolHelper.clientLocalSize; clientIdx++)
             protocolLocalFree(clientIdx);
+
+        // Stop relays once the locals using them are gone
+        protocolHelperMuxFree();
     }
 
     FUNCTION_LOG_RETURN_VOID();
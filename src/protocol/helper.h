@@ -15,6 +15,7 @@ typedef enum
     protocolStorageTypeRepo = STRID5("repo", 0x7c0b20),
 } ProtocolStorageType;
 
+#include "config/config.h"
 #include "protocol/client.h"
 
 /***********************************************************************************************************************************
@@ -25,6 +26,9 @@ Constants
 #define PROTOCOL_SERVICE_REMOTE                                     "remote"
     STRING_DECLARE(PROTOCOL_SERVICE_REMOTE_STR);
 
+// Default port for remotes that connect to a TLS server
+#define PROTOCOL_SERVER_PORT_DEFAULT                                8432
+
 /***********************************************************************************************************************************
 Getters/Setters
 ***********************************************************************************************************************************/
@@ -59,6 +63,10 @@ ProtocolClient *protocolRemoteGet(ProtocolStorageType protocolStorageType, unsig
 // Free (shutdown) a remote
 void protocolRemoteFree(unsigned int hostId);
 
+// Is the option allowed to be sent by a client to a TLS server? All other options, e.g. paths, hosts, and storage, are loaded by the
+// server from its own configuration so a client cannot use them to access anything outside of the stanzas it is authorized for.
+bool protocolServerOptionValid(ConfigOption optionId);
+
 /***********************************************************************************************************************************
 Destructor
 ***********************************************************************************************************************************/
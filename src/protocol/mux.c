@@ -0,0 +1,727 @@
+/***********************************************************************************************************************************
+Protocol Multiplexer
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "common/debug.h"
+#include "common/io/io.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/type/buffer.h"
+#include "common/type/list.h"
+#include "protocol/mux.h"
+
+/***********************************************************************************************************************************
+Frame format. Each frame starts with a header containing the frame type (1 byte), the channel id (4 bytes), and the size of the
+data that follows (4 bytes). All integers are big-endian. Only data and credit frames have a size greater than zero. The data for a
+credit frame is the number of bytes credited (4 bytes).
+***********************************************************************************************************************************/
+typedef enum
+{
+    protocolMuxFrameOpen = 0,                                       // Channel was opened by the peer
+    protocolMuxFrameData = 1,                                       // Data for the channel
+    protocolMuxFrameClose = 2,                                      // Channel was closed by the peer
+    protocolMuxFrameCredit = 3,                                     // Peer has written data to the channel and can receive more
+} ProtocolMuxFrameType;
+
+#define PROTOCOL_MUX_FRAME_HEADER_SIZE                              9
+#define PROTOCOL_MUX_FRAME_CREDIT_SIZE                              4
+
+/***********************************************************************************************************************************
+Each side may send this much data on a channel before the peer returns credit for data it has written to the channel socket. This
+bounds the memory queued for each channel without ever stopping reads from the trunk, so a channel that is not being read only
+stalls itself. Credit is returned once half the window has been written so credit frames are infrequent. The window must be the
+same on both sides so it does not depend on buffer-size.
+***********************************************************************************************************************************/
+#define PROTOCOL_MUX_WINDOW_SIZE                                    (4 * 1024 * 1024)
+
+/***********************************************************************************************************************************
+Stop reading from channels when this many buffers are queued for output on the trunk
+***********************************************************************************************************************************/
+#define PROTOCOL_MUX_QUEUE_BUFFER_MAX                               4
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+// Data queued for output on a file descriptor
+typedef struct ProtocolMuxQueue
+{
+    Buffer *buffer;                                                 // Queued data
+    size_t offset;                                                  // Offset of data not yet written
+} ProtocolMuxQueue;
+
+typedef struct ProtocolMuxChannel
+{
+    unsigned int id;                                                // Channel id
+    int fd;                                                         // Channel socket
+    bool close;                                                     // Close after queued output is written (closed by peer)
+    ProtocolMuxQueue out;                                           // Output queued for the channel
+    size_t sendWindow;                                              // Data that can be sent to the peer before more credit
+    size_t receiveWindow;                                           // Data that the peer can send before credit is returned
+    size_t credit;                                                  // Data written to the channel but not yet credited to the peer
+} ProtocolMuxChannel;
+
+struct ProtocolMux
+{
+    MemContext *memContext;                                         // Mem context
+    int fdRead;                                                     // Trunk read file descriptor
+    int fdWrite;                                                    // Trunk write file descriptor
+    int fdListen;                                                   // Listen for new channels (client only)
+    int fdControl;                                                  // Stop when readable
+    Buffer *in;                                                     // Input read from the trunk
+    size_t inOffset;                                                // Offset of input not yet processed
+    ProtocolMuxQueue out;                                           // Output queued for the trunk
+    List *channelList;                                              // List of open channels
+    unsigned int channelIdNext;                                     // Next channel id (client only)
+    bool done;                                                      // Has the trunk or control been closed?
+};
+
+/***********************************************************************************************************************************
+Queue helpers
+***********************************************************************************************************************************/
+static size_t
+protocolMuxQueueSize(const ProtocolMuxQueue *const queue)
+{
+    return bufUsed(queue->buffer) - queue->offset;
+}
+
+static void
+protocolMuxQueuePut(ProtocolMuxQueue *const queue, const unsigned char *const data, const size_t size)
+{
+    // Move unwritten data to the beginning of the buffer rather than growing it
+    if (queue->offset > 0 && bufUsed(queue->buffer) + size > bufSize(queue->buffer))
+    {
+        memmove(bufPtr(queue->buffer), bufPtr(queue->buffer) + queue->offset, protocolMuxQueueSize(queue));
+        bufUsedSet(queue->buffer, protocolMuxQueueSize(queue));
+        queue->offset = 0;
+    }
+
+    // Grow the buffer geometrically so many small writes do not each cause a resize
+    if (bufUsed(queue->buffer) + size > bufSize(queue->buffer))
+        bufResize(queue->buffer, (bufUsed(queue->buffer) + size) * 2);
+
+    bufCatC(queue->buffer, data, 0, size);
+}
+
+// Write as much queued data as possible without blocking. Returns false if the peer has gone away.
+static bool
+protocolMuxQueueWrite(ProtocolMuxQueue *const queue, const int fd)
+{
+    const ssize_t result = write(fd, bufPtr(queue->buffer) + queue->offset, protocolMuxQueueSize(queue));
+
+    if (result == -1)
+    {
+        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+            return true;
+
+        if (errno == EPIPE || errno == ECONNRESET)
+            return false;
+
+        THROW_SYS_ERROR(FileWriteError, "unable to write to mux");
+    }
+
+    queue->offset += (size_t)result;
+
+    if (queue->offset == bufUsed(queue->buffer))
+    {
+        bufUsedZero(queue->buffer);
+        queue->offset = 0;
+    }
+
+    return true;
+}
+
+/***********************************************************************************************************************************
+Set a file descriptor non-blocking and close on exec
+***********************************************************************************************************************************/
+static void
+protocolMuxFdSet(const int fd)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(INT, fd);
+    FUNCTION_TEST_END();
+
+    int flags;
+
+    THROW_ON_SYS_ERROR((flags = fcntl(fd, F_GETFL)) == -1, ProtocolError, "unable to get flags");
+    THROW_ON_SYS_ERROR(fcntl(fd, F_SETFL, flags | O_NONBLOCK) == -1, ProtocolError, "unable to set O_NONBLOCK");
+    THROW_ON_SYS_ERROR(fcntl(fd, F_SETFD, FD_CLOEXEC) == -1, ProtocolError, "unable to set FD_CLOEXEC");
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Close channel sockets
+***********************************************************************************************************************************/
+static void
+protocolMuxFreeResource(THIS_VOID)
+{
+    THIS(ProtocolMux);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(PROTOCOL_MUX, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    for (unsigned int channelIdx = 0; channelIdx < lstSize(this->channelList); channelIdx++)
+        close(((ProtocolMuxChannel *)lstGet(this->channelList, channelIdx))->fd);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+ProtocolMux *
+protocolMuxNew(const int fdRead, const int fdWrite, const int fdListen, const int fdControl)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(INT, fdRead);
+        FUNCTION_LOG_PARAM(INT, fdWrite);
+        FUNCTION_LOG_PARAM(INT, fdListen);
+        FUNCTION_LOG_PARAM(INT, fdControl);
+    FUNCTION_LOG_END();
+
+    ASSERT(fdRead != -1);
+    ASSERT(fdWrite != -1);
+
+    ProtocolMux *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("ProtocolMux")
+    {
+        this = memNew(sizeof(ProtocolMux));
+
+        *this = (ProtocolMux)
+        {
+            .memContext = MEM_CONTEXT_NEW(),
+            .fdRead = fdRead,
+            .fdWrite = fdWrite,
+            .fdListen = fdListen,
+            .fdControl = fdControl,
+            .in = bufNew(ioBufferSize() + PROTOCOL_MUX_FRAME_HEADER_SIZE),
+            .out = {.buffer = bufNew(ioBufferSize() + PROTOCOL_MUX_FRAME_HEADER_SIZE)},
+            .channelList = lstNewP(sizeof(ProtocolMuxChannel)),
+            .channelIdNext = 1,
+        };
+
+        // The trunk must not block since it is shared by all channels
+        protocolMuxFdSet(this->fdRead);
+        protocolMuxFdSet(this->fdWrite);
+
+        if (this->fdListen != -1)
+            protocolMuxFdSet(this->fdListen);
+
+        memContextCallbackSet(this->memContext, protocolMuxFreeResource, this);
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(PROTOCOL_MUX, this);
+}
+
+/***********************************************************************************************************************************
+Queue a frame for output on the trunk
+***********************************************************************************************************************************/
+static void
+protocolMuxFramePut(
+    ProtocolMux *const this, const ProtocolMuxFrameType type, const unsigned int channelId, const unsigned char *const data,
+    const size_t size)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(PROTOCOL_MUX, this);
+        FUNCTION_TEST_PARAM(ENUM, type);
+        FUNCTION_TEST_PARAM(UINT, channelId);
+        FUNCTION_TEST_PARAM_P(UCHARDATA, data);
+        FUNCTION_TEST_PARAM(SIZE, size);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(size <= UINT32_MAX);
+
+    const unsigned char header[PROTOCOL_MUX_FRAME_HEADER_SIZE] =
+    {
+        (unsigned char)type,
+        (unsigned char)(channelId >> 24), (unsigned char)(channelId >> 16), (unsigned char)(channelId >> 8),
+        (unsigned char)channelId,
+        (unsigned char)(size >> 24), (unsigned char)(size >> 16), (unsigned char)(size >> 8), (unsigned char)size,
+    };
+
+    protocolMuxQueuePut(&this->out, header, sizeof(header));
+
+    if (size > 0)
+        protocolMuxQueuePut(&this->out, data, size);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Find a channel by id. Returns NULL when the channel does not exist, e.g. it has already been closed on this side.
+***********************************************************************************************************************************/
+static ProtocolMuxChannel *
+protocolMuxChannelFind(ProtocolMux *const this, const unsigned int channelId)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(PROTOCOL_MUX, this);
+        FUNCTION_TEST_PARAM(UINT, channelId);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    ProtocolMuxChannel *result = NULL;
+
+    for (unsigned int channelIdx = 0; channelIdx < lstSize(this->channelList); channelIdx++)
+    {
+        ProtocolMuxChannel *const channel = lstGet(this->channelList, channelIdx);
+
+        if (channel->id == channelId)
+        {
+            result = channel;
+            break;
+        }
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Close a channel socket and remove the channel. The peer is notified when the channel was not closed by the peer.
+***********************************************************************************************************************************/
+static void
+protocolMuxChannelRemove(ProtocolMux *const this, ProtocolMuxChannel *const channel)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(PROTOCOL_MUX, this);
+        FUNCTION_TEST_PARAM_P(VOID, channel);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(channel != NULL);
+
+    if (!channel->close)
+        protocolMuxFramePut(this, protocolMuxFrameClose, channel->id, NULL, 0);
+
+    close(channel->fd);
+    bufFree(channel->out.buffer);
+
+    for (unsigned int channelIdx = 0; channelIdx < lstSize(this->channelList); channelIdx++)
+    {
+        if (lstGet(this->channelList, channelIdx) == channel)
+        {
+            lstRemoveIdx(this->channelList, channelIdx);
+            break;
+        }
+    }
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+static ProtocolMuxChannel *
+protocolMuxChannelAddInternal(ProtocolMux *const this, const unsigned int channelId, const int fd)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(PROTOCOL_MUX, this);
+        FUNCTION_TEST_PARAM(UINT, channelId);
+        FUNCTION_TEST_PARAM(INT, fd);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(protocolMuxChannelFind(this, channelId) == NULL);
+
+    ProtocolMuxChannel *result = NULL;
+
+    // Add the channel first so the socket is closed on error
+    MEM_CONTEXT_BEGIN(lstMemContext(this->channelList))
+    {
+        result = lstAdd(
+            this->channelList,
+            &(ProtocolMuxChannel)
+            {
+                .id = channelId,
+                .fd = fd,
+                .out = {.buffer = bufNew(0)},
+                .sendWindow = PROTOCOL_MUX_WINDOW_SIZE,
+                .receiveWindow = PROTOCOL_MUX_WINDOW_SIZE,
+            });
+    }
+    MEM_CONTEXT_END();
+
+    protocolMuxFdSet(fd);
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+void
+protocolMuxChannelAdd(ProtocolMux *const this, const unsigned int channelId, const int fd)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(PROTOCOL_MUX, this);
+        FUNCTION_LOG_PARAM(UINT, channelId);
+        FUNCTION_LOG_PARAM(INT, fd);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(channelId != 0);
+    ASSERT(fd != -1);
+
+    protocolMuxChannelAddInternal(this, channelId, fd);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Process the next complete frame received from the trunk. Returns false when there is no complete frame. When the peer opens a
+channel the channel id is returned in channelOpenId.
+***********************************************************************************************************************************/
+static bool
+protocolMuxFrameGet(ProtocolMux *const this, unsigned int *const channelOpenId)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(PROTOCOL_MUX, this);
+        FUNCTION_TEST_PARAM_P(UINT, channelOpenId);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(channelOpenId != NULL);
+
+    bool result = false;
+    const size_t inSize = bufUsed(this->in) - this->inOffset;
+
+    if (inSize >= PROTOCOL_MUX_FRAME_HEADER_SIZE)
+    {
+        const unsigned char *const header = bufPtr(this->in) + this->inOffset;
+        const ProtocolMuxFrameType type = (ProtocolMuxFrameType)header[0];
+        const unsigned int channelId =
+            (unsigned int)header[1] << 24 | (unsigned int)header[2] << 16 | (unsigned int)header[3] << 8 | header[4];
+        const size_t size = (size_t)header[5] << 24 | (size_t)header[6] << 16 | (size_t)header[7] << 8 | header[8];
+
+        if (inSize >= PROTOCOL_MUX_FRAME_HEADER_SIZE + size)
+        {
+            ProtocolMuxChannel *const channel = protocolMuxChannelFind(this, channelId);
+
+            switch (type)
+            {
+                case protocolMuxFrameOpen:
+                {
+                    // Only a client can accept channels so this must be the server side
+                    if (this->fdListen != -1 || channelId == 0 || channel != NULL)
+                        THROW_FMT(ProtocolError, "invalid open for mux channel %u", channelId);
+
+                    *channelOpenId = channelId;
+                    break;
+                }
+
+                // Data for a channel that has already been closed on this side is discarded
+                case protocolMuxFrameData:
+                {
+                    if (channel != NULL && !channel->close)
+                    {
+                        if (size > channel->receiveWindow)
+                            THROW_FMT(ProtocolError, "mux channel %u data exceeds window", channelId);
+
+                        channel->receiveWindow -= size;
+                        protocolMuxQueuePut(&channel->out, header + PROTOCOL_MUX_FRAME_HEADER_SIZE, size);
+                    }
+
+                    break;
+                }
+
+                // Credit for a channel that has already been closed on this side is discarded
+                case protocolMuxFrameCredit:
+                {
+                    if (size != PROTOCOL_MUX_FRAME_CREDIT_SIZE)
+                        THROW_FMT(ProtocolError, "invalid credit size %zu for mux channel %u", size, channelId);
+
+                    if (channel != NULL)
+                    {
+                        const unsigned char *const data = header + PROTOCOL_MUX_FRAME_HEADER_SIZE;
+
+                        channel->sendWindow +=
+                            (size_t)data[0] << 24 | (size_t)data[1] << 16 | (size_t)data[2] << 8 | (size_t)data[3];
+                    }
+
+                    break;
+                }
+
+                case protocolMuxFrameClose:
+                {
+                    if (channel != NULL)
+                        channel->close = true;
+
+                    break;
+                }
+
+                default:
+                    THROW_FMT(ProtocolError, "invalid mux frame type %u", (unsigned int)type);
+            }
+
+            this->inOffset += PROTOCOL_MUX_FRAME_HEADER_SIZE + size;
+            result = true;
+        }
+        // Make sure the buffer is large enough to hold the frame
+        else if (bufSize(this->in) - this->inOffset < PROTOCOL_MUX_FRAME_HEADER_SIZE + size)
+            bufResize(this->in, this->inOffset + PROTOCOL_MUX_FRAME_HEADER_SIZE + size);
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Read from the trunk
+***********************************************************************************************************************************/
+static void
+protocolMuxTrunkRead(ProtocolMux *const this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(PROTOCOL_MUX, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    // Move unprocessed input to the beginning of the buffer
+    if (this->inOffset > 0)
+    {
+        memmove(bufPtr(this->in), bufPtr(this->in) + this->inOffset, bufUsed(this->in) - this->inOffset);
+        bufUsedSet(this->in, bufUsed(this->in) - this->inOffset);
+        this->inOffset = 0;
+    }
+
+    if (bufRemains(this->in) < ioBufferSize())
+        bufResize(this->in, bufUsed(this->in) + ioBufferSize());
+
+    const ssize_t result = read(this->fdRead, bufRemainsPtr(this->in), bufRemains(this->in));
+
+    if (result == 0)
+        this->done = true;
+    else if (result == -1)
+    {
+        if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+            THROW_SYS_ERROR(FileReadError, "unable to read from mux");
+    }
+    else
+        bufUsedInc(this->in, (size_t)result);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Write queued data to a channel and return credit to the peer once enough has been written. Returns false when the channel has been
+closed.
+***********************************************************************************************************************************/
+static bool
+protocolMuxChannelWrite(ProtocolMux *const this, ProtocolMuxChannel *const channel)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(PROTOCOL_MUX, this);
+        FUNCTION_TEST_PARAM_P(VOID, channel);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(channel != NULL);
+
+    const size_t queueSize = protocolMuxQueueSize(&channel->out);
+    const bool result = protocolMuxQueueWrite(&channel->out, channel->fd);
+
+    channel->credit += queueSize - protocolMuxQueueSize(&channel->out);
+
+    if (result && channel->credit >= PROTOCOL_MUX_WINDOW_SIZE / 2)
+    {
+        const unsigned char credit[PROTOCOL_MUX_FRAME_CREDIT_SIZE] =
+        {
+            (unsigned char)(channel->credit >> 24), (unsigned char)(channel->credit >> 16), (unsigned char)(channel->credit >> 8),
+            (unsigned char)channel->credit,
+        };
+
+        protocolMuxFramePut(this, protocolMuxFrameCredit, channel->id, credit, sizeof(credit));
+
+        channel->receiveWindow += channel->credit;
+        channel->credit = 0;
+    }
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/***********************************************************************************************************************************
+Read from a channel and queue the data for the trunk. No more is read than the peer has credited. Returns false when the channel
+has been closed.
+***********************************************************************************************************************************/
+static bool
+protocolMuxChannelRead(ProtocolMux *const this, ProtocolMuxChannel *const channel, Buffer *const buffer)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(PROTOCOL_MUX, this);
+        FUNCTION_TEST_PARAM_P(VOID, channel);
+        FUNCTION_TEST_PARAM(BUFFER, buffer);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(channel != NULL);
+    ASSERT(buffer != NULL);
+    ASSERT(channel->sendWindow > 0);
+
+    bool result = true;
+    const ssize_t size = read(
+        channel->fd, bufPtr(buffer), bufSize(buffer) < channel->sendWindow ? bufSize(buffer) : channel->sendWindow);
+
+    if (size > 0)
+    {
+        protocolMuxFramePut(this, protocolMuxFrameData, channel->id, bufPtr(buffer), (size_t)size);
+        channel->sendWindow -= (size_t)size;
+    }
+    else if (size == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+        result = false;
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+unsigned int
+protocolMuxProcess(ProtocolMux *const this)
+{
+    FUNCTION_LOG_BEGIN(logLevelDebug);
+        FUNCTION_LOG_PARAM(PROTOCOL_MUX, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    unsigned int result = 0;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        Buffer *const buffer = bufNew(ioBufferSize());
+        const size_t queueMax = ioBufferSize() * PROTOCOL_MUX_QUEUE_BUFFER_MAX;
+
+        while (!this->done && result == 0)
+        {
+            // Process frames that have already been received. Stop when the peer opens a channel so the caller can add it.
+            while (result == 0 && protocolMuxFrameGet(this, &result));
+
+            if (result != 0)
+                break;
+
+            // Remove channels closed by the peer once their output has been written
+            for (unsigned int channelIdx = lstSize(this->channelList); channelIdx > 0; channelIdx--)
+            {
+                ProtocolMuxChannel *const channel = lstGet(this->channelList, channelIdx - 1);
+
+                if (channel->close && protocolMuxQueueSize(&channel->out) == 0)
+                    protocolMuxChannelRemove(this, channel);
+            }
+
+            // Build the list of file descriptors to poll. The trunk and control file descriptors are always first, followed by the
+            // listen file descriptor (if any) and then the channels. The trunk is always read since the data queued for each
+            // channel is bounded by the channel window.
+            const unsigned int channelTotal = lstSize(this->channelList);
+            struct pollfd *const pollList = memNew(sizeof(struct pollfd) * (channelTotal + 4));
+            unsigned int pollTotal = 0;
+
+            pollList[pollTotal++] = (struct pollfd){.fd = this->fdRead, .events = POLLIN};
+            pollList[pollTotal++] =
+                (struct pollfd){.fd = protocolMuxQueueSize(&this->out) > 0 ? this->fdWrite : -1, .events = POLLOUT};
+            pollList[pollTotal++] = (struct pollfd){.fd = this->fdControl, .events = POLLIN};
+            pollList[pollTotal++] = (struct pollfd){.fd = this->fdListen, .events = POLLIN};
+
+            const bool trunkFull = protocolMuxQueueSize(&this->out) >= queueMax;
+
+            // Channels are not read when the trunk is full or the peer has not credited more data. A channel with nothing to do is
+            // skipped so a hangup is not reported until the channel can be read.
+            for (unsigned int channelIdx = 0; channelIdx < channelTotal; channelIdx++)
+            {
+                const ProtocolMuxChannel *const channel = lstGet(this->channelList, channelIdx);
+                const short events = (short)(
+                    (trunkFull || channel->close || channel->sendWindow == 0 ? 0 : POLLIN) |
+                    (protocolMuxQueueSize(&channel->out) > 0 ? POLLOUT : 0));
+
+                pollList[pollTotal++] = (struct pollfd){.fd = events == 0 ? -1 : channel->fd, .events = events};
+            }
+
+            // Wait for a file descriptor to be ready. There is no timeout since the processes on either end of the channels have
+            // their own timeouts.
+            if (poll(pollList, pollTotal, -1) == -1)
+            {
+                if (errno != EINTR)
+                    THROW_SYS_ERROR(ProtocolError, "unable to poll mux");
+
+                memFree(pollList);
+                continue;
+            }
+
+            // Stop when the control file descriptor is readable or closed
+            if (pollList[2].revents != 0)
+            {
+                this->done = true;
+                break;
+            }
+
+            // Read from the trunk
+            if (pollList[0].revents != 0)
+                protocolMuxTrunkRead(this);
+
+            // Write to the trunk
+            if (pollList[1].revents != 0 && !protocolMuxQueueWrite(&this->out, this->fdWrite))
+                this->done = true;
+
+            // Accept a new channel and notify the peer
+            if (pollList[3].revents != 0)
+            {
+                const int fd = accept(this->fdListen, NULL, NULL);
+
+                if (fd == -1)
+                {
+                    if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR && errno != ECONNABORTED)
+                        THROW_SYS_ERROR(ProtocolError, "unable to accept mux channel");
+                }
+                else
+                {
+                    protocolMuxChannelAddInternal(this, this->channelIdNext, fd);
+                    protocolMuxFramePut(this, protocolMuxFrameOpen, this->channelIdNext, NULL, 0);
+                    this->channelIdNext++;
+                }
+            }
+
+            // Read/write channels. Channels are found by fd since the list may have changed while accepting.
+            for (unsigned int pollIdx = 4; pollIdx < pollTotal; pollIdx++)
+            {
+                if (pollList[pollIdx].revents == 0)
+                    continue;
+
+                ProtocolMuxChannel *channel = NULL;
+
+                for (unsigned int channelIdx = 0; channelIdx < lstSize(this->channelList); channelIdx++)
+                {
+                    ProtocolMuxChannel *const channelFind = lstGet(this->channelList, channelIdx);
+
+                    if (channelFind->fd == pollList[pollIdx].fd)
+                    {
+                        channel = channelFind;
+                        break;
+                    }
+                }
+
+                ASSERT(channel != NULL);
+
+                bool open = true;
+
+                if (protocolMuxQueueSize(&channel->out) > 0 && pollList[pollIdx].revents & (POLLOUT | POLLERR | POLLHUP))
+                    open = protocolMuxChannelWrite(this, channel);
+
+                if (open && !channel->close && channel->sendWindow > 0 && pollList[pollIdx].revents & (POLLIN | POLLERR | POLLHUP))
+                    open = protocolMuxChannelRead(this, channel, buffer);
+
+                // Once the channel is closed on this side any data queued for it is discarded
+                if (!open)
+                    protocolMuxChannelRemove(this, channel);
+            }
+
+            memFree(pollList);
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(UINT, result);
+}
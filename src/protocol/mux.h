@@ -0,0 +1,55 @@
+/***********************************************************************************************************************************
+Protocol Multiplexer
+
+Relays many protocol channels over a single connection (the trunk), e.g. the stdin/stdout of one SSH session. Each channel is a
+stream socket on both ends of the trunk and data is forwarded in frames tagged with the channel id so the protocol running on the
+channel does not need to know that it is multiplexed.
+
+The client side accepts connections on a listen socket and opens a channel for each one. The server side is notified of each new
+channel by protocolMuxProcess() and must add a socket for the channel with protocolMuxChannelAdd() before processing continues.
+***********************************************************************************************************************************/
+#ifndef PROTOCOL_MUX_H
+#define PROTOCOL_MUX_H
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+typedef struct ProtocolMux ProtocolMux;
+
+#include "common/type/object.h"
+
+/***********************************************************************************************************************************
+Constructors
+***********************************************************************************************************************************/
+// The trunk read/write file descriptors are owned by the caller, as are the listen file descriptor (client only, else -1) and the
+// control file descriptor (-1 if not used). Processing stops when the control file descriptor becomes readable or is closed.
+ProtocolMux *protocolMuxNew(int fdRead, int fdWrite, int fdListen, int fdControl);
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Relay data until the peer opens a channel or the mux is done. Returns the id of the channel that the peer opened or 0 when the
+// trunk or control file descriptor has been closed.
+unsigned int protocolMuxProcess(ProtocolMux *this);
+
+// Add a socket for a channel that was opened by the peer. The file descriptor is owned by the mux from this point on.
+void protocolMuxChannelAdd(ProtocolMux *this, unsigned int channelId, int fd);
+
+/***********************************************************************************************************************************
+Destructor
+***********************************************************************************************************************************/
+__attribute__((always_inline)) static inline void
+protocolMuxFree(ProtocolMux *const this)
+{
+    objFree(this);
+}
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_PROTOCOL_MUX_TYPE                                                                                             \
+    ProtocolMux *
+#define FUNCTION_LOG_PROTOCOL_MUX_FORMAT(value, buffer, bufferSize)                                                                \
+    objToLog(value, "ProtocolMux", buffer, bufferSize)
+
+#endif
@@ -4,9 +4,24 @@ Protocol Parallel Executor
 #include "build.auto.h"
 
 #include <string.h>
-#include <sys/select.h>
+#include <unistd.h>
+
+/***********************************************************************************************************************************
+Use epoll to wait for results when available. Defining PROTOCOL_PARALLEL_SELECT forces the select() fallback so it can be built and
+tested on platforms that have epoll.
+***********************************************************************************************************************************/
+#if defined(HAVE_EPOLL) && !defined(PROTOCOL_PARALLEL_SELECT)
+    #define PROTOCOL_PARALLEL_EPOLL
+#endif
+
+#ifdef PROTOCOL_PARALLEL_EPOLL
+    #include <sys/epoll.h>
+#else
+    #include <sys/select.h>
+#endif
 
 #include "common/debug.h"
+#include "common/io/fd.h"
 #include "common/log.h"
 #include "common/macro.h"
 #include "common/memContext.h"
@@ -23,27 +38,62 @@ struct ProtocolParallel
 {
     MemContext *memContext;
     TimeMSec timeout;                                               // Max time to wait for jobs before returning
+    unsigned int queueMax;                                          // Max jobs in flight per client
     ParallelJobCallback *callbackFunction;                          // Function to get new jobs
     void *callbackData;                                             // Data to pass to callback function
 
     List *clientList;                                               // List of clients to process jobs
     List *jobList;                                                  // List of jobs to be processed
 
-    ProtocolParallelJob **clientJobList;                            // Jobs being processing by each client
+    List **clientJobList;                                           // Jobs being processed by each client (in the order sent)
+    ProtocolParallelJob **clientJobPending;                         // Job for each client waiting for room in the command pipe
+    List *clientReadyList;                                          // Clients that can accept new jobs
+    unsigned int clientRunningTotal;                                // Clients that are running jobs
+
+#ifdef PROTOCOL_PARALLEL_EPOLL
+    int epollFd;                                                    // Epoll instance used to wait for client results
+    struct epoll_event *eventList;                                  // Events returned by epoll_wait()
+#endif
 
     ProtocolParallelJobState state;                                 // Overall state of job processing
 };
 
+/***********************************************************************************************************************************
+Close epoll instance
+***********************************************************************************************************************************/
+#ifdef PROTOCOL_PARALLEL_EPOLL
+
+static void
+protocolParallelFreeResource(THIS_VOID)
+{
+    THIS(ProtocolParallel);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(PROTOCOL_PARALLEL, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    close(this->epollFd);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+#endif
+
 /**********************************************************************************************************************************/
 ProtocolParallel *
-protocolParallelNew(TimeMSec timeout, ParallelJobCallback *callbackFunction, void *callbackData)
+protocolParallelNew(
+    const TimeMSec timeout, const unsigned int queueMax, ParallelJobCallback *const callbackFunction, void *const callbackData)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(UINT64, timeout);
+        FUNCTION_LOG_PARAM(UINT, queueMax);
         FUNCTION_LOG_PARAM(FUNCTIONP, callbackFunction);
         FUNCTION_LOG_PARAM_P(VOID, callbackData);
     FUNCTION_LOG_END();
 
+    ASSERT(queueMax > 0);
     ASSERT(callbackFunction != NULL);
     ASSERT(callbackData != NULL);
 
@@ -57,6 +107,7 @@ protocolParallelNew(TimeMSec timeout, ParallelJobCallback *callbackFunction, voi
         {
             .memContext = MEM_CONTEXT_NEW(),
             .timeout = timeout,
+            .queueMax = queueMax,
             .callbackFunction = callbackFunction,
             .callbackData = callbackData,
             .clientList = lstNewP(sizeof(ProtocolClient *)),
@@ -90,6 +141,106 @@ protocolParallelClientAdd(ProtocolParallel *this, ProtocolClient *client)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Get results for a client
+
+Results are returned in the order the jobs were sent so only the oldest job can be complete. After the first result is read, any
+further results that have already been read into the client's buffer are also processed since the file descriptor may not signal
+them again.
+***********************************************************************************************************************************/
+static unsigned int
+protocolParallelClientResult(ProtocolParallel *const this, const unsigned int clientIdx)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(PROTOCOL_PARALLEL, this);
+        FUNCTION_LOG_PARAM(UINT, clientIdx);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    List *const clientJobList = this->clientJobList[clientIdx];
+    ProtocolClient *const client = *(ProtocolClient **)lstGet(this->clientList, clientIdx);
+    unsigned int result = 0;
+
+    do
+    {
+        ProtocolParallelJob *const job = *(ProtocolParallelJob **)lstGet(clientJobList, 0);
+
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            TRY_BEGIN()
+            {
+                protocolParallelJobResultSet(job, protocolClientDataGet(client));
+                protocolClientDataEndGet(client);
+            }
+            CATCH_ANY()
+            {
+                protocolParallelJobErrorSet(job, errorCode(), STR(errorMessage()));
+            }
+            TRY_END();
+
+            protocolParallelJobStateSet(job, protocolParallelJobStateDone);
+            lstRemoveIdx(clientJobList, 0);
+        }
+        MEM_CONTEXT_TEMP_END();
+
+        result++;
+    }
+    while (!lstEmpty(clientJobList) && protocolClientIoReadBuffered(client));
+
+    // The client now has room in its queue
+    lstAdd(this->clientReadyList, &clientIdx);
+
+    // The client is no longer running if the queue is empty
+    if (lstEmpty(clientJobList))
+        this->clientRunningTotal--;
+
+    FUNCTION_LOG_RETURN(UINT, result);
+}
+
+/***********************************************************************************************************************************
+Can another job be sent to a client that is already running jobs?
+
+A local that is blocked writing a result will not read commands, so writing a command to it while its results are waiting to be read
+could block both processes forever. Commands are only written when all results from the client have been read and the command pipe
+has room. Otherwise the client will be topped up after its next result is read.
+
+Room in the pipe does not mean the whole command will fit, so the size of each command is also checked against the free space in the
+pipe before it is pipelined (see protocolParallelClientFits()).
+***********************************************************************************************************************************/
+static bool
+protocolParallelClientWritable(ProtocolClient *const client)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(PROTOCOL_CLIENT, client);
+    FUNCTION_LOG_END();
+
+    ASSERT(client != NULL);
+
+    FUNCTION_LOG_RETURN(
+        BOOL,
+        !protocolClientIoReadBuffered(client) && !fdReadyRead(protocolClientIoReadFd(client), 0) &&
+            fdReadyWrite(protocolClientIoWriteFd(client), 0));
+}
+
+/***********************************************************************************************************************************
+Will the command fit in the free space of the client's command pipe? If not, the command could block part way through being written
+while the local is blocked writing a large result, e.g. a bundle job with many files.
+***********************************************************************************************************************************/
+static bool
+protocolParallelClientFits(ProtocolClient *const client, ProtocolCommand *const command)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(PROTOCOL_CLIENT, client);
+        FUNCTION_LOG_PARAM(PROTOCOL_COMMAND, command);
+    FUNCTION_LOG_END();
+
+    ASSERT(client != NULL);
+    ASSERT(command != NULL);
+
+    FUNCTION_LOG_RETURN(BOOL, protocolCommandSize(command) <= fdWriteSpace(protocolClientIoWriteFd(client)));
+}
+
 /**********************************************************************************************************************************/
 unsigned int
 protocolParallelProcess(ProtocolParallel *this)
@@ -109,37 +260,77 @@ protocolParallelProcess(ProtocolParallel *this)
         MEM_CONTEXT_BEGIN(this->memContext)
         {
             this->clientJobList = memNewPtrArray(lstSize(this->clientList));
+            this->clientJobPending = memNewPtrArray(lstSize(this->clientList));
+            this->clientReadyList = lstNewP(sizeof(unsigned int));
+
+            // All clients are ready for jobs
+            for (unsigned int clientIdx = 0; clientIdx < lstSize(this->clientList); clientIdx++)
+            {
+                this->clientJobList[clientIdx] = lstNewP(sizeof(ProtocolParallelJob *));
+                lstAdd(this->clientReadyList, &clientIdx);
+            }
+
+#ifdef PROTOCOL_PARALLEL_EPOLL
+            // Register all clients with epoll so readiness does not need to be rebuilt on each call
+            this->epollFd = epoll_create1(EPOLL_CLOEXEC);
+            THROW_ON_SYS_ERROR(this->epollFd == -1, KernelError, "unable to create epoll instance");
+
+            memContextCallbackSet(this->memContext, protocolParallelFreeResource, this);
+
+            for (unsigned int clientIdx = 0; clientIdx < lstSize(this->clientList); clientIdx++)
+            {
+                struct epoll_event event = {.events = EPOLLIN, .data.u32 = clientIdx};
+
+                THROW_ON_SYS_ERROR(
+                    epoll_ctl(
+                        this->epollFd, EPOLL_CTL_ADD,
+                        protocolClientIoReadFd(*(ProtocolClient **)lstGet(this->clientList, clientIdx)), &event) == -1,
+                    KernelError, "unable to add parallel client to epoll");
+            }
+
+            this->eventList = memNew(sizeof(struct epoll_event) * lstSize(this->clientList));
+#endif
         }
         MEM_CONTEXT_END();
 
         this->state = protocolParallelJobStateRunning;
     }
 
-    // Initialize the file descriptor set used for select
-    fd_set selectSet;
-    FD_ZERO(&selectSet);
-    int fdMax = -1;
-
-    // Find clients that are running jobs
-    unsigned int clientRunningTotal = 0;
-
-    for (unsigned int clientIdx = 0; clientIdx < lstSize(this->clientList); clientIdx++)
+    // If clients are running jobs then wait for results
+    if (this->clientRunningTotal > 0)
     {
-        if (this->clientJobList[clientIdx] != NULL)
+#ifdef PROTOCOL_PARALLEL_EPOLL
+        // Determine which clients have data to be read
+        const int completed = epoll_wait(this->epollFd, this->eventList, (int)lstSize(this->clientList), (int)this->timeout);
+        THROW_ON_SYS_ERROR(completed == -1, AssertError, "unable to wait on parallel client(s)");
+
+        // Get results from the clients that are ready
+        for (int eventIdx = 0; eventIdx < completed; eventIdx++)
         {
-            int fd = protocolClientIoReadFd(*(ProtocolClient **)lstGet(this->clientList, clientIdx));
-            FD_SET((unsigned int)fd, &selectSet);
+            const unsigned int clientIdx = this->eventList[eventIdx].data.u32;
 
-            // Find the max file descriptor needed for select()
-            MAX_ASSIGN(fdMax, fd);
+            if (!lstEmpty(this->clientJobList[clientIdx]))
+                result += protocolParallelClientResult(this, clientIdx);
+        }
+#else
+        // Initialize the file descriptor set used for select
+        fd_set selectSet;
+        FD_ZERO(&selectSet);
+        int fdMax = -1;
+
+        // Find clients that are running jobs
+        for (unsigned int clientIdx = 0; clientIdx < lstSize(this->clientList); clientIdx++)
+        {
+            if (!lstEmpty(this->clientJobList[clientIdx]))
+            {
+                int fd = protocolClientIoReadFd(*(ProtocolClient **)lstGet(this->clientList, clientIdx));
+                FD_SET((unsigned int)fd, &selectSet);
 
-            clientRunningTotal++;
+                // Find the max file descriptor needed for select()
+                MAX_ASSIGN(fdMax, fd);
+            }
         }
-    }
 
-    // If clients are running then wait for one to finish
-    if (clientRunningTotal > 0)
-    {
         // Initialize timeout struct used for select.  Recreate this structure each time since Linux (at least) will modify it.
         struct timeval timeoutSelect;
         timeoutSelect.tv_sec = (time_t)(this->timeout / MSEC_PER_SEC);
@@ -154,74 +345,89 @@ protocolParallelProcess(ProtocolParallel *this)
         {
             for (unsigned int clientIdx = 0; clientIdx < lstSize(this->clientList); clientIdx++)
             {
-                ProtocolParallelJob *job = this->clientJobList[clientIdx];
-
-                if (job != NULL &&
+                if (!lstEmpty(this->clientJobList[clientIdx]) &&
                     FD_ISSET(
                         (unsigned int)protocolClientIoReadFd(*(ProtocolClient **)lstGet(this->clientList, clientIdx)),
                         &selectSet))
                 {
-                    MEM_CONTEXT_TEMP_BEGIN()
-                    {
-                        TRY_BEGIN()
-                        {
-                            ProtocolClient *const client = *(ProtocolClient **)lstGet(this->clientList, clientIdx);
-
-                            protocolParallelJobResultSet(job, protocolClientDataGet(client));
-                            protocolClientDataEndGet(client);
-                        }
-                        CATCH_ANY()
-                        {
-                            protocolParallelJobErrorSet(job, errorCode(), STR(errorMessage()));
-                        }
-                        TRY_END();
-
-                        protocolParallelJobStateSet(job, protocolParallelJobStateDone);
-                        this->clientJobList[clientIdx] = NULL;
-                    }
-                    MEM_CONTEXT_TEMP_END();
+                    result += protocolParallelClientResult(this, clientIdx);
                 }
             }
-
-            result = (unsigned int)completed;
         }
+#endif
     }
 
-    // Find new jobs to be run
-    for (unsigned int clientIdx = 0; clientIdx < lstSize(this->clientList); clientIdx++)
+    // Find new jobs to be run. Only clients that have completed jobs (or all clients on the first call) are checked.
+    for (unsigned int readyIdx = 0; readyIdx < lstSize(this->clientReadyList); readyIdx++)
     {
-        // If nothing is running for this client
-        if (this->clientJobList[clientIdx] == NULL)
+        const unsigned int clientIdx = *(unsigned int *)lstGet(this->clientReadyList, readyIdx);
+        List *const clientJobList = this->clientJobList[clientIdx];
+        ProtocolClient *const client = *(ProtocolClient **)lstGet(this->clientList, clientIdx);
+
+        // Fill the client's queue so it always has a job to start on when the current job completes. Stop early when the client is
+        // not ready for another command, which can only happen when it is already running jobs.
+        while (lstSize(clientJobList) < this->queueMax && (lstEmpty(clientJobList) || protocolParallelClientWritable(client)))
         {
-            // Get a new job
-            ProtocolParallelJob *job = NULL;
+            // Get the job that did not fit in the command pipe on a prior call, else get a new job
+            ProtocolParallelJob *job = this->clientJobPending[clientIdx];
 
-            MEM_CONTEXT_BEGIN(lstMemContext(this->jobList))
+            if (job != NULL)
             {
-                job = this->callbackFunction(this->callbackData, clientIdx);
+                this->clientJobPending[clientIdx] = NULL;
             }
-            MEM_CONTEXT_END();
-
-            // If a new job was found
-            if (job != NULL)
+            else
             {
+                MEM_CONTEXT_BEGIN(lstMemContext(this->jobList))
+                {
+                    job = this->callbackFunction(this->callbackData, clientIdx);
+                }
+                MEM_CONTEXT_END();
+
+                // If no new job was found then stop queuing for this client. Free the client only when it has no more jobs running.
+                if (job == NULL)
+                {
+                    if (lstEmpty(clientJobList))
+                    {
+#ifdef PROTOCOL_PARALLEL_EPOLL
+                        // Remove from epoll before the client is freed in case the file descriptor is shared with another process
+                        THROW_ON_SYS_ERROR(
+                            epoll_ctl(this->epollFd, EPOLL_CTL_DEL, protocolClientIoReadFd(client), NULL) == -1, KernelError,
+                            "unable to remove parallel client from epoll");
+#endif
+                        protocolLocalFree(clientIdx + 1);
+                    }
+
+                    break;
+                }
+
                 // Add to the job list
                 lstAdd(this->jobList, &job);
+            }
 
-                // Put command
-                protocolClientCommandPut(*(ProtocolClient **)lstGet(this->clientList, clientIdx), protocolParallelJobCommand(job));
-
-                // Set client id and running state
-                protocolParallelJobProcessIdSet(job, clientIdx + 1);
-                protocolParallelJobStateSet(job, protocolParallelJobStateRunning);
-                this->clientJobList[clientIdx] = job;
+            // Only pipeline the command when it fits in the command pipe. Otherwise hold the job until the client's queue is empty,
+            // at which point the local is waiting for a command and writing it cannot block.
+            if (!lstEmpty(clientJobList) && !protocolParallelClientFits(client, protocolParallelJobCommand(job)))
+            {
+                this->clientJobPending[clientIdx] = job;
+                break;
             }
-            // Else no more jobs for this client so free it
-            else
-                protocolLocalFree(clientIdx + 1);
+
+            // Put command
+            protocolClientCommandPut(client, protocolParallelJobCommand(job));
+
+            // Set client id and running state
+            protocolParallelJobProcessIdSet(job, clientIdx + 1);
+            protocolParallelJobStateSet(job, protocolParallelJobStateRunning);
+
+            if (lstEmpty(clientJobList))
+                this->clientRunningTotal++;
+
+            lstAdd(clientJobList, &job);
         }
     }
 
+    lstClear(this->clientReadyList);
+
     FUNCTION_LOG_RETURN(UINT, result);
 }
 
@@ -25,7 +25,10 @@ typedef ProtocolParallelJob *ParallelJobCallback(void *data, unsigned int client
 /***********************************************************************************************************************************
 Constructors
 ***********************************************************************************************************************************/
-ProtocolParallel *protocolParallelNew(TimeMSec timeout, ParallelJobCallback *callbackFunction, void *callbackData);
+// The queueMax parameter sets the number of jobs that can be in flight on each client. When greater than one the next job is sent
+// before the result of the prior job is received so the client does not wait on a round trip between jobs.
+ProtocolParallel *protocolParallelNew(
+    TimeMSec timeout, unsigned int queueMax, ParallelJobCallback *callbackFunction, void *callbackData);
 
 /***********************************************************************************************************************************
 Getters/Setters
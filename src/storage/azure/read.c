@@ -9,6 +9,7 @@ Azure Storage Read
 #include "common/memContext.h"
 #include "common/type/object.h"
 #include "storage/azure/read.h"
+#include "storage/rangeRead.h"
 #include "storage/read.intern.h"
 
 /***********************************************************************************************************************************
@@ -20,7 +21,9 @@ typedef struct StorageReadAzure
     StorageReadInterface interface;                                 // Interface
     StorageAzure *storage;                                          // Storage that created this object
 
-    HttpResponse *httpResponse;                                     // HTTP response
+    uint64_t rangeSize;                                             // Size of each range (0 to read with a single request)
+    unsigned int rangeMax;                                          // Max ranges requested concurrently
+    StorageRangeRead *rangeRead;                                    // Range read
 } StorageReadAzure;
 
 /***********************************************************************************************************************************
@@ -31,6 +34,51 @@ Macros for function logging
 #define FUNCTION_LOG_STORAGE_READ_AZURE_FORMAT(value, buffer, bufferSize)                                                          \
     objToLog(value, "StorageReadAzure", buffer, bufferSize)
 
+/***********************************************************************************************************************************
+Request a range of the file and get the response
+***********************************************************************************************************************************/
+static HttpRequest *
+storageReadAzureRangeRequest(void *const driver, const uint64_t offset, const Variant *const limit, const String *const version)
+{
+    StorageReadAzure *const this = driver;
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_READ_AZURE, this);
+        FUNCTION_LOG_PARAM(UINT64, offset);
+        FUNCTION_LOG_PARAM(VARIANT, limit);
+        FUNCTION_LOG_PARAM(STRING, version);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    HttpHeader *const header = httpHeaderPutRange(httpHeaderNew(NULL), offset, limit);
+
+    if (version != NULL)
+        httpHeaderPut(header, HTTP_HEADER_IF_MATCH_STR, version);
+
+    FUNCTION_LOG_RETURN(
+        HTTP_REQUEST, storageAzureRequestAsyncP(this->storage, HTTP_VERB_GET_STR, .path = this->interface.name, .header = header));
+}
+
+static HttpResponse *
+storageReadAzureRangeResponse(
+    void *const driver, HttpRequest *const request, const bool allowMissing, const bool allowRangeInvalid)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM_P(VOID, driver);
+        FUNCTION_LOG_PARAM(HTTP_REQUEST, request);
+        FUNCTION_LOG_PARAM(BOOL, allowMissing);
+        FUNCTION_LOG_PARAM(BOOL, allowRangeInvalid);
+    FUNCTION_LOG_END();
+
+    ASSERT(driver != NULL);
+    ASSERT(request != NULL);
+
+    FUNCTION_LOG_RETURN(
+        HTTP_RESPONSE,
+        storageAzureResponseP(request, .allowMissing = allowMissing, .allowRangeInvalid = allowRangeInvalid, .contentIo = true));
+}
+
 /***********************************************************************************************************************************
 Open the file
 ***********************************************************************************************************************************/
@@ -44,19 +92,20 @@ storageReadAzureOpen(THIS_VOID)
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
-    ASSERT(this->httpResponse == NULL);
+    ASSERT(this->rangeRead == NULL);
 
     bool result = false;
 
     // Request the file
     MEM_CONTEXT_BEGIN(this->memContext)
     {
-        this->httpResponse = storageAzureRequestP(
-            this->storage, HTTP_VERB_GET_STR, .path = this->interface.name, .allowMissing = true, .contentIo = true);
+        this->rangeRead = storageRangeReadNew(
+            this, storageReadAzureRangeRequest, storageReadAzureRangeResponse, HTTP_HEADER_ETAG_STR,
+            this->interface.offset, this->interface.limit, this->rangeSize, this->rangeMax);
     }
     MEM_CONTEXT_END();
 
-    if (httpResponseCodeOk(this->httpResponse))
+    if (httpResponseCodeOk(storageRangeReadOpen(this->rangeRead)))
     {
         result = true;
     }
@@ -81,11 +130,10 @@ storageReadAzure(THIS_VOID, Buffer *buffer, bool block)
         FUNCTION_LOG_PARAM(BOOL, block);
     FUNCTION_LOG_END();
 
-    ASSERT(this != NULL && this->httpResponse != NULL);
-    ASSERT(httpResponseIoRead(this->httpResponse) != NULL);
+    ASSERT(this != NULL && this->rangeRead != NULL);
     ASSERT(buffer != NULL && !bufFull(buffer));
 
-    FUNCTION_LOG_RETURN(SIZE, ioRead(httpResponseIoRead(this->httpResponse), buffer));
+    FUNCTION_LOG_RETURN(SIZE, storageRangeRead(this->rangeRead, buffer));
 }
 
 /***********************************************************************************************************************************
@@ -100,24 +148,30 @@ storageReadAzureEof(THIS_VOID)
         FUNCTION_TEST_PARAM(STORAGE_READ_AZURE, this);
     FUNCTION_TEST_END();
 
-    ASSERT(this != NULL && this->httpResponse != NULL);
-    ASSERT(httpResponseIoRead(this->httpResponse) != NULL);
+    ASSERT(this != NULL && this->rangeRead != NULL);
 
-    FUNCTION_TEST_RETURN(ioReadEof(httpResponseIoRead(this->httpResponse)));
+    FUNCTION_TEST_RETURN(storageRangeReadEof(this->rangeRead));
 }
 
 /**********************************************************************************************************************************/
 StorageRead *
-storageReadAzureNew(StorageAzure *storage, const String *name, bool ignoreMissing)
+storageReadAzureNew(
+    StorageAzure *const storage, const String *const name, const bool ignoreMissing, const uint64_t offset,
+    const Variant *const limit, const uint64_t rangeSize, const unsigned int rangeMax)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(STORAGE_AZURE, storage);
         FUNCTION_LOG_PARAM(STRING, name);
         FUNCTION_LOG_PARAM(BOOL, ignoreMissing);
+        FUNCTION_LOG_PARAM(UINT64, offset);
+        FUNCTION_LOG_PARAM(VARIANT, limit);
+        FUNCTION_LOG_PARAM(UINT64, rangeSize);
+        FUNCTION_LOG_PARAM(UINT, rangeMax);
     FUNCTION_LOG_END();
 
     ASSERT(storage != NULL);
     ASSERT(name != NULL);
+    ASSERT(rangeMax != 0);
 
     StorageRead *this = NULL;
 
@@ -129,12 +183,16 @@ storageReadAzureNew(StorageAzure *storage, const String *name, bool ignoreMissin
         {
             .memContext = MEM_CONTEXT_NEW(),
             .storage = storage,
+            .rangeSize = rangeSize,
+            .rangeMax = rangeMax,
 
             .interface = (StorageReadInterface)
             {
                 .type = STORAGE_AZURE_TYPE,
                 .name = strDup(name),
                 .ignoreMissing = ignoreMissing,
+                .offset = offset,
+                .limit = varDup(limit),
 
                 .ioInterface = (IoReadInterface)
                 {
@@ -10,6 +10,7 @@ Azure Storage
 #include "common/debug.h"
 #include "common/io/http/client.h"
 #include "common/io/http/common.h"
+#include "common/io/http/multipart.h"
 #include "common/io/socket/client.h"
 #include "common/io/tls/client.h"
 #include "common/log.h"
@@ -17,13 +18,21 @@ Azure Storage
 #include "common/regExp.h"
 #include "common/type/object.h"
 #include "common/type/xml.h"
+#include "common/wait.h"
 #include "storage/azure/read.h"
 #include "storage/azure/storage.intern.h"
 #include "storage/azure/write.h"
+#include "storage/rangeRead.h"
+
+/***********************************************************************************************************************************
+Defaults
+***********************************************************************************************************************************/
+#define STORAGE_AZURE_DELETE_MAX                                    256
 
 /***********************************************************************************************************************************
 Azure http headers
 ***********************************************************************************************************************************/
+STRING_STATIC(AZURE_HEADER_DATE_STR,                                "x-ms-date");
 STRING_STATIC(AZURE_HEADER_VERSION_STR,                             "x-ms-version");
 STRING_STATIC(AZURE_HEADER_VERSION_VALUE_STR,                       "2019-02-02");
 
@@ -37,6 +46,7 @@ STRING_STATIC(AZURE_QUERY_PREFIX_STR,                               "prefix");
 STRING_EXTERN(AZURE_QUERY_RESTYPE_STR,                              AZURE_QUERY_RESTYPE);
 STRING_STATIC(AZURE_QUERY_SIG_STR,                                  "sig");
 
+STRING_STATIC(AZURE_QUERY_VALUE_BATCH_STR,                          "batch");
 STRING_STATIC(AZURE_QUERY_VALUE_LIST_STR,                           "list");
 STRING_EXTERN(AZURE_QUERY_VALUE_CONTAINER_STR,                      AZURE_QUERY_VALUE_CONTAINER);
 
@@ -69,6 +79,9 @@ struct StorageAzure
     const HttpQuery *sasKey;                                        // SAS key
     const String *host;                                             // Host name
     size_t blockSize;                                               // Block size for multi-block upload
+    unsigned int downloadConcurrency;                               // Max ranges downloaded concurrently
+    uint64_t downloadRangeSize;                                     // Range size for downloads (0 for a single request)
+    unsigned int deleteMax;                                         // Maximum blobs that can be deleted in one batch request
     const String *pathPrefix;                                       // Account/container prefix
 
     uint64_t fileId;                                                // Id to used to make file block identifiers unique
@@ -78,10 +91,14 @@ struct StorageAzure
 Generate authorization header and add it to the supplied header list
 
 Based on the documentation at https://docs.microsoft.com/en-us/rest/api/storageservices/authorize-with-shared-key
+
+Batch subrequests are sent in the content of the batch request so they do not need a host header and the version header is not
+allowed. The date is sent as x-ms-date, which is signed as a canonical header rather than as the date.
 ***********************************************************************************************************************************/
 static void
 storageAzureAuth(
-    StorageAzure *this, const String *verb, const String *path, HttpQuery *query, const String *dateTime, HttpHeader *httpHeader)
+    StorageAzure *this, const String *verb, const String *path, HttpQuery *query, const String *dateTime, HttpHeader *httpHeader,
+    const bool subRequest)
 {
     FUNCTION_TEST_BEGIN();
         FUNCTION_TEST_PARAM(STORAGE_AZURE, this);
@@ -90,6 +107,7 @@ storageAzureAuth(
         FUNCTION_TEST_PARAM(HTTP_QUERY, query);
         FUNCTION_TEST_PARAM(STRING, dateTime);
         FUNCTION_TEST_PARAM(KEY_VALUE, httpHeader);
+        FUNCTION_TEST_PARAM(BOOL, subRequest);
     FUNCTION_TEST_END();
 
     ASSERT(this != NULL);
@@ -102,14 +120,20 @@ storageAzureAuth(
     MEM_CONTEXT_TEMP_BEGIN()
     {
         // Host header is required for both types of authentication
-        httpHeaderPut(httpHeader, HTTP_HEADER_HOST_STR, this->host);
+        if (!subRequest)
+            httpHeaderPut(httpHeader, HTTP_HEADER_HOST_STR, this->host);
 
         // Shared key authentication
         if (this->sharedKey != NULL)
         {
             // Set required headers
-            httpHeaderPut(httpHeader, HTTP_HEADER_DATE_STR, dateTime);
-            httpHeaderPut(httpHeader, AZURE_HEADER_VERSION_STR, AZURE_HEADER_VERSION_VALUE_STR);
+            if (subRequest)
+                httpHeaderPut(httpHeader, AZURE_HEADER_DATE_STR, dateTime);
+            else
+            {
+                httpHeaderPut(httpHeader, HTTP_HEADER_DATE_STR, dateTime);
+                httpHeaderPut(httpHeader, AZURE_HEADER_VERSION_STR, AZURE_HEADER_VERSION_VALUE_STR);
+            }
 
             // Generate canonical headers
             String *headerCanonical = strNew();
@@ -162,7 +186,7 @@ storageAzureAuth(
                 "/%s%s"                                                 // Canonicalized account/path
                 "%s",                                                   // Canonicalized query
                 strZ(verb), strEq(contentLength, ZERO_STR) ? "" : strZ(contentLength), contentMd5 == NULL ? "" : strZ(contentMd5),
-                strZ(dateTime), strZ(headerCanonical), strZ(this->account), strZ(path), strZ(queryCanonical));
+                subRequest ? "" : strZ(dateTime), strZ(headerCanonical), strZ(this->account), strZ(path), strZ(queryCanonical));
 
             // Generate authorization header
             httpHeaderPut(
@@ -230,7 +254,7 @@ storageAzureRequestAsync(StorageAzure *this, const String *verb, StorageAzureReq
                 httpQueryDupP(param.query, .redactList = this->queryRedactList);
 
         // Generate authorization header
-        storageAzureAuth(this, verb, path, query, httpDateFromTime(time(NULL)), requestHeader);
+        storageAzureAuth(this, verb, path, query, httpDateFromTime(time(NULL)), requestHeader, false);
 
         // Send request
         MEM_CONTEXT_PRIOR_BEGIN()
@@ -251,6 +275,7 @@ storageAzureResponse(HttpRequest *request, StorageAzureResponseParam param)
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(HTTP_REQUEST, request);
         FUNCTION_LOG_PARAM(BOOL, param.allowMissing);
+        FUNCTION_LOG_PARAM(BOOL, param.allowRangeInvalid);
         FUNCTION_LOG_PARAM(BOOL, param.contentIo);
     FUNCTION_LOG_END();
 
@@ -264,7 +289,8 @@ storageAzureResponse(HttpRequest *request, StorageAzureResponseParam param)
         result = httpRequestResponse(request, !param.contentIo);
 
         // Error if the request was not successful
-        if (!httpResponseCodeOk(result) && (!param.allowMissing || httpResponseCode(result) != HTTP_RESPONSE_CODE_NOT_FOUND))
+        if (!httpResponseCodeOk(result) && (!param.allowMissing || httpResponseCode(result) != HTTP_RESPONSE_CODE_NOT_FOUND) &&
+            (!param.allowRangeInvalid || httpResponseCode(result) != HTTP_RESPONSE_CODE_RANGE_NOT_SATISFIABLE))
             httpRequestError(request, result);
 
         // Move response to the prior context
@@ -539,13 +565,17 @@ storageAzureNewRead(THIS_VOID, const String *file, bool ignoreMissing, StorageIn
         FUNCTION_LOG_PARAM(STORAGE_AZURE, this);
         FUNCTION_LOG_PARAM(STRING, file);
         FUNCTION_LOG_PARAM(BOOL, ignoreMissing);
-        (void)param;                                                // No parameters are used
+        FUNCTION_LOG_PARAM(UINT64, param.offset);
+        FUNCTION_LOG_PARAM(VARIANT, param.limit);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
     ASSERT(file != NULL);
 
-    FUNCTION_LOG_RETURN(STORAGE_READ, storageReadAzureNew(this, file, ignoreMissing));
+    FUNCTION_LOG_RETURN(
+        STORAGE_READ,
+        storageReadAzureNew(
+            this, file, ignoreMissing, param.offset, param.limit, this->downloadRangeSize, this->downloadConcurrency));
 }
 
 /**********************************************************************************************************************************/
@@ -570,15 +600,197 @@ storageAzureNewWrite(THIS_VOID, const String *file, StorageInterfaceNewWritePara
     FUNCTION_LOG_RETURN(STORAGE_WRITE, storageWriteAzureNew(this, file, this->fileId++, this->blockSize));
 }
 
-/**********************************************************************************************************************************/
+/***********************************************************************************************************************************
+Remove blobs in batches using the Blob Batch API. Each part of the batch is a complete, separately authorized, DELETE request and
+each part of the response has the status of the DELETE with the same Content-ID. Parts that fail with an error that can be retried
+are resubmitted as a new batch.
+***********************************************************************************************************************************/
+#define AZURE_BATCH_BOUNDARY                                        "pgbackrest_batch"
+STRING_STATIC(AZURE_BATCH_CONTENT_TYPE_STR,                         "multipart/mixed; boundary=" AZURE_BATCH_BOUNDARY);
+
 typedef struct StorageAzurePathRemoveData
 {
     StorageAzure *this;                                             // Storage object
     MemContext *memContext;                                         // Mem context to create requests in
-    HttpRequest *request;                                           // Async remove request
+    HttpRequest *request;                                           // Async batch remove request
+    StringList *requestList;                                        // Blobs removed by the async batch request
+    StringList *batchList;                                          // Blobs to remove in the next batch
     const String *path;                                             // Root path of remove
 } StorageAzurePathRemoveData;
 
+static HttpRequest *
+storageAzurePathRemoveBatch(StorageAzure *const this, const StringList *const blobList)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_AZURE, this);
+        FUNCTION_TEST_PARAM(STRING_LIST, blobList);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(blobList != NULL);
+
+    HttpRequest *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        String *const batch = strNew();
+        const String *const dateTime = httpDateFromTime(time(NULL));
+
+        for (unsigned int blobIdx = 0; blobIdx < strLstSize(blobList); blobIdx++)
+        {
+            // Authorize the subrequest
+            const String *const path = httpUriEncode(
+                strNewFmt("%s%s", strZ(this->pathPrefix), strZ(strLstGet(blobList, blobIdx))), true);
+            HttpQuery *const query = this->sasKey != NULL ? httpQueryNewP() : NULL;
+            HttpHeader *const header = httpHeaderAdd(httpHeaderNew(NULL), HTTP_HEADER_CONTENT_LENGTH_STR, ZERO_STR);
+
+            storageAzureAuth(this, HTTP_VERB_DELETE_STR, path, query, dateTime, header, true);
+
+            // Add subrequest to batch
+            strCatFmt(
+                batch,
+                "--" AZURE_BATCH_BOUNDARY "\r\n"
+                "Content-Type: application/http\r\n"
+                "Content-Transfer-Encoding: binary\r\n"
+                "Content-ID: %u\r\n"
+                "\r\n"
+                "DELETE %s%s%s HTTP/1.1\r\n",
+                blobIdx, strZ(path), query == NULL ? "" : "?", query == NULL ? "" : strZ(httpQueryRenderP(query)));
+
+            const StringList *const headerList = httpHeaderList(header);
+
+            for (unsigned int headerIdx = 0; headerIdx < strLstSize(headerList); headerIdx++)
+            {
+                const String *const headerKey = strLstGet(headerList, headerIdx);
+                strCatFmt(batch, "%s: %s\r\n", strZ(headerKey), strZ(httpHeaderGet(header, headerKey)));
+            }
+
+            strCatZ(batch, "\r\n");
+        }
+
+        strCatZ(batch, "--" AZURE_BATCH_BOUNDARY "--\r\n");
+
+        HttpQuery *const query = httpQueryNewP();
+        httpQueryAdd(query, AZURE_QUERY_RESTYPE_STR, AZURE_QUERY_VALUE_CONTAINER_STR);
+        httpQueryAdd(query, AZURE_QUERY_COMP_STR, AZURE_QUERY_VALUE_BATCH_STR);
+
+        MEM_CONTEXT_PRIOR_BEGIN()
+        {
+            result = storageAzureRequestAsyncP(
+                this, HTTP_VERB_POST_STR, .query = query,
+                .header = httpHeaderAdd(httpHeaderNew(NULL), HTTP_HEADER_CONTENT_TYPE_STR, AZURE_BATCH_CONTENT_TYPE_STR),
+                .content = BUFSTR(batch));
+        }
+        MEM_CONTEXT_PRIOR_END();
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+static void
+storageAzurePathRemoveResponse(StorageAzure *const this, HttpRequest *request, const StringList *blobList)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_AZURE, this);
+        FUNCTION_TEST_PARAM(HTTP_REQUEST, request);
+        FUNCTION_TEST_PARAM(STRING_LIST, blobList);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(request != NULL);
+    ASSERT(blobList != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        Wait *wait = NULL;
+
+        do
+        {
+            const List *const statusList = httpMultipartStatusList(
+                httpResponseContent(storageAzureResponseP(request)), strLstSize(blobList));
+            StringList *const retryList = strLstNew();
+            const HttpMultipartStatus *retryStatus = NULL;
+
+            for (unsigned int statusIdx = 0; statusIdx < lstSize(statusList); statusIdx++)
+            {
+                const HttpMultipartStatus *const status = lstGet(statusList, statusIdx);
+
+                // Error on any status other than success, missing, or an error that can be retried
+                if (status->code / 100 != 2 && status->code != HTTP_RESPONSE_CODE_NOT_FOUND)
+                {
+                    if (!httpMultipartStatusRetry(status->code))
+                    {
+                        THROW_FMT(
+                            FileRemoveError, STORAGE_ERROR_PATH_REMOVE_FILE ": [%u] %s", strZ(strLstGet(blobList, status->id)),
+                            status->code, strZ(status->reason));
+                    }
+
+                    if (retryStatus == NULL)
+                        retryStatus = status;
+
+                    strLstAdd(retryList, strLstGet(blobList, status->id));
+                }
+            }
+
+            request = NULL;
+
+            // Resubmit the parts that can be retried until the timeout expires
+            if (retryStatus != NULL)
+            {
+                if (wait == NULL)
+                    wait = waitNew(httpClientTimeout(this->httpClient));
+
+                if (!waitMore(wait))
+                {
+                    THROW_FMT(
+                        FileRemoveError, STORAGE_ERROR_PATH_REMOVE_FILE ": [%u] %s", strZ(strLstGet(blobList, retryStatus->id)),
+                        retryStatus->code, strZ(retryStatus->reason));
+                }
+
+                LOG_DEBUG_FMT(
+                    "retry remove of %u blob(s): [%u] %s", strLstSize(retryList), retryStatus->code, strZ(retryStatus->reason));
+
+                blobList = retryList;
+                request = storageAzurePathRemoveBatch(this, blobList);
+            }
+        }
+        while (request != NULL);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+static HttpRequest *
+storageAzurePathRemoveInternal(
+    StorageAzure *const this, HttpRequest *const request, const StringList *const requestList, const StringList *const batchList)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_AZURE, this);
+        FUNCTION_TEST_PARAM(HTTP_REQUEST, request);
+        FUNCTION_TEST_PARAM(STRING_LIST, requestList);
+        FUNCTION_TEST_PARAM(STRING_LIST, batchList);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    // Get response for async request
+    if (request != NULL)
+    {
+        storageAzurePathRemoveResponse(this, request, requestList);
+        httpRequestFree(request);
+    }
+
+    // Send new async request if there is more to remove
+    HttpRequest *result = NULL;
+
+    if (batchList != NULL)
+        result = storageAzurePathRemoveBatch(this, batchList);
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 static void
 storageAzurePathRemoveCallback(void *callbackData, const StorageInfo *info)
 {
@@ -590,24 +802,29 @@ storageAzurePathRemoveCallback(void *callbackData, const StorageInfo *info)
     ASSERT(callbackData != NULL);
     ASSERT(info != NULL);
 
-    StorageAzurePathRemoveData *data = callbackData;
-
-    // Get response from prior async request
-    if (data->request != NULL)
-    {
-        storageAzureResponseP(data->request, .allowMissing = true);
-
-        httpRequestFree(data->request);
-        data->request = NULL;
-    }
-
     // Only delete files since paths don't really exist
     if (info->type == storageTypeFile)
     {
+        StorageAzurePathRemoveData *data = callbackData;
+
         MEM_CONTEXT_BEGIN(data->memContext)
         {
-            data->request = storageAzureRequestAsyncP(
-                data->this, HTTP_VERB_DELETE_STR, strNewFmt("%s/%s", strZ(data->path), strZ(info->name)));
+            // If there is something to delete then create the batch
+            if (data->batchList == NULL)
+                data->batchList = strLstNew();
+
+            // Add to batch
+            strLstAdd(data->batchList, strNewFmt("%s/%s", strZ(data->path), strZ(info->name)));
+
+            // Send batch when it is full
+            if (strLstSize(data->batchList) == data->this->deleteMax)
+            {
+                data->request = storageAzurePathRemoveInternal(data->this, data->request, data->requestList, data->batchList);
+
+                strLstFree(data->requestList);
+                data->requestList = data->batchList;
+                data->batchList = NULL;
+            }
         }
         MEM_CONTEXT_END();
     }
@@ -641,9 +858,15 @@ storageAzurePathRemove(THIS_VOID, const String *path, bool recurse, StorageInter
 
         storageAzureListInternal(this, path, storageInfoLevelType, NULL, true, storageAzurePathRemoveCallback, &data);
 
+        // Send if there is more to be removed
+        if (data.batchList != NULL)
+        {
+            data.request = storageAzurePathRemoveInternal(this, data.request, data.requestList, data.batchList);
+            data.requestList = data.batchList;
+        }
+
         // Check response on last async request
-        if (data.request != NULL)
-            storageAzureResponseP(data.request, .allowMissing = true);
+        storageAzurePathRemoveInternal(this, data.request, data.requestList, NULL);
     }
     MEM_CONTEXT_TEMP_END();
 
@@ -685,8 +908,9 @@ static const StorageInterface storageInterfaceAzure =
 Storage *
 storageAzureNew(
     const String *path, bool write, StoragePathExpressionCallback pathExpressionFunction, const String *container,
-    const String *account, StorageAzureKeyType keyType, const String *key, size_t blockSize, const String *host,
-    const String *endpoint, unsigned int port, TimeMSec timeout, bool verifyPeer, const String *caFile, const String *caPath)
+    const String *account, StorageAzureKeyType keyType, const String *key, size_t blockSize, unsigned int downloadConcurrency,
+    const String *host, const String *endpoint, unsigned int port, TimeMSec timeout, bool verifyPeer, const String *caFile,
+    const String *caPath)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING, path);
@@ -697,6 +921,7 @@ storageAzureNew(
         FUNCTION_LOG_PARAM(STRING_ID, keyType);
         FUNCTION_TEST_PARAM(STRING, key);
         FUNCTION_LOG_PARAM(SIZE, blockSize);
+        FUNCTION_LOG_PARAM(UINT, downloadConcurrency);
         FUNCTION_LOG_PARAM(STRING, host);
         FUNCTION_LOG_PARAM(STRING, endpoint);
         FUNCTION_LOG_PARAM(UINT, port);
@@ -711,6 +936,7 @@ storageAzureNew(
     ASSERT(account != NULL);
     ASSERT(key != NULL);
     ASSERT(blockSize != 0);
+    ASSERT(downloadConcurrency != 0);
 
     Storage *this = NULL;
 
@@ -725,6 +951,9 @@ storageAzureNew(
             .container = strDup(container),
             .account = strDup(account),
             .blockSize = blockSize,
+            .downloadConcurrency = downloadConcurrency,
+            .downloadRangeSize = downloadConcurrency > 1 ? STORAGE_RANGE_READ_SIZE_DEFAULT : 0,
+            .deleteMax = STORAGE_AZURE_DELETE_MAX,
             .host = host == NULL ? strNewFmt("%s.%s", strZ(account), strZ(endpoint)) : host,
             .pathPrefix = host == NULL ? strNewFmt("/%s", strZ(container)) : strNewFmt("/%s/%s", strZ(account), strZ(container)),
         };
@@ -737,7 +966,9 @@ storageAzureNew(
 
         // Create the http client used to service requests
         driver->httpClient = httpClientNew(
-            tlsClientNew(sckClientNew(driver->host, port, timeout), driver->host, timeout, verifyPeer, caFile, caPath), timeout);
+            tlsClientNewP(
+                sckClientNew(driver->host, port, timeout), driver->host, timeout, verifyPeer, .caFile = caFile, .caPath = caPath),
+            timeout);
 
         // Create list of redacted headers
         driver->headerRedactList = strLstNew();
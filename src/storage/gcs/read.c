@@ -10,6 +10,7 @@ GCS Storage Read
 #include "common/memContext.h"
 #include "common/type/object.h"
 #include "storage/gcs/read.h"
+#include "storage/rangeRead.h"
 #include "storage/read.intern.h"
 
 /***********************************************************************************************************************************
@@ -26,7 +27,9 @@ typedef struct StorageReadGcs
     StorageReadInterface interface;                                 // Interface
     StorageGcs *storage;                                            // Storage that created this object
 
-    HttpResponse *httpResponse;                                     // HTTP response
+    uint64_t rangeSize;                                             // Size of each range (0 to read with a single request)
+    unsigned int rangeMax;                                          // Max ranges requested concurrently
+    StorageRangeRead *rangeRead;                                    // Range read
 } StorageReadGcs;
 
 /***********************************************************************************************************************************
@@ -37,6 +40,55 @@ Macros for function logging
 #define FUNCTION_LOG_STORAGE_READ_GCS_FORMAT(value, buffer, bufferSize)                                                            \
     objToLog(value, "StorageReadGcs", buffer, bufferSize)
 
+/***********************************************************************************************************************************
+Request a range of the file and get the response
+***********************************************************************************************************************************/
+static HttpRequest *
+storageReadGcsRangeRequest(void *const driver, const uint64_t offset, const Variant *const limit, const String *const version)
+{
+    StorageReadGcs *const this = driver;
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_READ_GCS, this);
+        FUNCTION_LOG_PARAM(UINT64, offset);
+        FUNCTION_LOG_PARAM(VARIANT, limit);
+        FUNCTION_LOG_PARAM(STRING, version);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    HttpQuery *const query = httpQueryAdd(httpQueryNewP(), GCS_QUERY_ALT_STR, GCS_QUERY_MEDIA_STR);
+
+    // GCS does not support If-Match for media downloads so require the generation instead
+    if (version != NULL)
+        httpQueryAdd(query, GCS_QUERY_IF_GENERATION_MATCH_STR, version);
+
+    FUNCTION_LOG_RETURN(
+        HTTP_REQUEST,
+        storageGcsRequestAsyncP(
+            this->storage, HTTP_VERB_GET_STR, .object = this->interface.name,
+            .header = httpHeaderPutRange(httpHeaderNew(NULL), offset, limit), .query = query));
+}
+
+static HttpResponse *
+storageReadGcsRangeResponse(
+    void *const driver, HttpRequest *const request, const bool allowMissing, const bool allowRangeInvalid)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM_P(VOID, driver);
+        FUNCTION_LOG_PARAM(HTTP_REQUEST, request);
+        FUNCTION_LOG_PARAM(BOOL, allowMissing);
+        FUNCTION_LOG_PARAM(BOOL, allowRangeInvalid);
+    FUNCTION_LOG_END();
+
+    ASSERT(driver != NULL);
+    ASSERT(request != NULL);
+
+    FUNCTION_LOG_RETURN(
+        HTTP_RESPONSE,
+        storageGcsResponseP(request, .allowMissing = allowMissing, .allowRangeInvalid = allowRangeInvalid, .contentIo = true));
+}
+
 /***********************************************************************************************************************************
 Open the file
 ***********************************************************************************************************************************/
@@ -50,20 +102,20 @@ storageReadGcsOpen(THIS_VOID)
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
-    ASSERT(this->httpResponse == NULL);
+    ASSERT(this->rangeRead == NULL);
 
     bool result = false;
 
     // Request the file
     MEM_CONTEXT_BEGIN(this->memContext)
     {
-        this->httpResponse = storageGcsRequestP(
-            this->storage, HTTP_VERB_GET_STR, .object = this->interface.name, .allowMissing = true, .contentIo = true,
-            .query = httpQueryAdd(httpQueryNewP(), GCS_QUERY_ALT_STR, GCS_QUERY_MEDIA_STR));
+        this->rangeRead = storageRangeReadNew(
+            this, storageReadGcsRangeRequest, storageReadGcsRangeResponse, GCS_HEADER_GENERATION_STR,
+            this->interface.offset, this->interface.limit, this->rangeSize, this->rangeMax);
     }
     MEM_CONTEXT_END();
 
-    if (httpResponseCodeOk(this->httpResponse))
+    if (httpResponseCodeOk(storageRangeReadOpen(this->rangeRead)))
     {
         result = true;
     }
@@ -88,11 +140,10 @@ storageReadGcs(THIS_VOID, Buffer *buffer, bool block)
         FUNCTION_LOG_PARAM(BOOL, block);
     FUNCTION_LOG_END();
 
-    ASSERT(this != NULL && this->httpResponse != NULL);
-    ASSERT(httpResponseIoRead(this->httpResponse) != NULL);
+    ASSERT(this != NULL && this->rangeRead != NULL);
     ASSERT(buffer != NULL && !bufFull(buffer));
 
-    FUNCTION_LOG_RETURN(SIZE, ioRead(httpResponseIoRead(this->httpResponse), buffer));
+    FUNCTION_LOG_RETURN(SIZE, storageRangeRead(this->rangeRead, buffer));
 }
 
 /***********************************************************************************************************************************
@@ -107,24 +158,30 @@ storageReadGcsEof(THIS_VOID)
         FUNCTION_TEST_PARAM(STORAGE_READ_GCS, this);
     FUNCTION_TEST_END();
 
-    ASSERT(this != NULL && this->httpResponse != NULL);
-    ASSERT(httpResponseIoRead(this->httpResponse) != NULL);
+    ASSERT(this != NULL && this->rangeRead != NULL);
 
-    FUNCTION_TEST_RETURN(ioReadEof(httpResponseIoRead(this->httpResponse)));
+    FUNCTION_TEST_RETURN(storageRangeReadEof(this->rangeRead));
 }
 
 /**********************************************************************************************************************************/
 StorageRead *
-storageReadGcsNew(StorageGcs *storage, const String *name, bool ignoreMissing)
+storageReadGcsNew(
+    StorageGcs *const storage, const String *const name, const bool ignoreMissing, const uint64_t offset,
+    const Variant *const limit, const uint64_t rangeSize, const unsigned int rangeMax)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(STORAGE_GCS, storage);
         FUNCTION_LOG_PARAM(STRING, name);
         FUNCTION_LOG_PARAM(BOOL, ignoreMissing);
+        FUNCTION_LOG_PARAM(UINT64, offset);
+        FUNCTION_LOG_PARAM(VARIANT, limit);
+        FUNCTION_LOG_PARAM(UINT64, rangeSize);
+        FUNCTION_LOG_PARAM(UINT, rangeMax);
     FUNCTION_LOG_END();
 
     ASSERT(storage != NULL);
     ASSERT(name != NULL);
+    ASSERT(rangeMax != 0);
 
     StorageRead *this = NULL;
 
@@ -136,12 +193,16 @@ storageReadGcsNew(StorageGcs *storage, const String *name, bool ignoreMissing)
         {
             .memContext = MEM_CONTEXT_NEW(),
             .storage = storage,
+            .rangeSize = rangeSize,
+            .rangeMax = rangeMax,
 
             .interface = (StorageReadInterface)
             {
                 .type = STORAGE_GCS_TYPE,
                 .name = strDup(name),
                 .ignoreMissing = ignoreMissing,
+                .offset = offset,
+                .limit = varDup(limit),
 
                 .ioInterface = (IoReadInterface)
                 {
@@ -14,6 +14,7 @@ GCS Storage
 #include "common/debug.h"
 #include "common/io/http/client.h"
 #include "common/io/http/common.h"
+#include "common/io/http/multipart.h"
 #include "common/io/http/url.h"
 #include "common/io/socket/client.h"
 #include "common/io/tls/client.h"
@@ -22,14 +23,22 @@ GCS Storage
 #include "common/regExp.h"
 #include "common/type/json.h"
 #include "common/type/object.h"
+#include "common/wait.h"
 #include "storage/gcs/read.h"
 #include "storage/gcs/storage.intern.h"
 #include "storage/gcs/write.h"
+#include "storage/rangeRead.h"
 #include "storage/posix/storage.h"
 
+/***********************************************************************************************************************************
+Defaults
+***********************************************************************************************************************************/
+#define STORAGE_GCS_DELETE_MAX                                      100
+
 /***********************************************************************************************************************************
 HTTP headers
 ***********************************************************************************************************************************/
+STRING_EXTERN(GCS_HEADER_GENERATION_STR,                            GCS_HEADER_GENERATION);
 STRING_EXTERN(GCS_HEADER_UPLOAD_ID_STR,                             GCS_HEADER_UPLOAD_ID);
 STRING_STATIC(GCS_HEADER_METADATA_FLAVOR_STR,                       "metadata-flavor");
 STRING_STATIC(GCS_HEADER_GOOGLE_STR,                                "Google");
@@ -39,6 +48,7 @@ Query tokens
 ***********************************************************************************************************************************/
 STRING_STATIC(GCS_QUERY_DELIMITER_STR,                              "delimiter");
 STRING_EXTERN(GCS_QUERY_FIELDS_STR,                                 GCS_QUERY_FIELDS);
+STRING_EXTERN(GCS_QUERY_IF_GENERATION_MATCH_STR,                    GCS_QUERY_IF_GENERATION_MATCH);
 STRING_EXTERN(GCS_QUERY_MEDIA_STR,                                  GCS_QUERY_MEDIA);
 STRING_EXTERN(GCS_QUERY_NAME_STR,                                   GCS_QUERY_NAME);
 STRING_STATIC(GCS_QUERY_PAGE_TOKEN_STR,                             "pageToken");
@@ -75,6 +85,12 @@ VARIANT_STRDEF_STATIC(GCS_JSON_TOKEN_URI_VAR,                       "token_uri")
 STRING_STATIC(GCS_FIELD_LIST_MIN_STR,                               GCS_FIELD_LIST ")");
 STRING_STATIC(GCS_FIELD_LIST_MAX_STR,                               GCS_FIELD_LIST "," GCS_JSON_SIZE "," GCS_JSON_UPDATED ")");
 
+/***********************************************************************************************************************************
+Batch requests
+***********************************************************************************************************************************/
+#define GCS_BATCH_BOUNDARY                                          "pgbackrest_batch"
+STRING_STATIC(GCS_BATCH_CONTENT_TYPE_STR,                           "multipart/mixed; boundary=" GCS_BATCH_BOUNDARY);
+
 /***********************************************************************************************************************************
 Object type
 ***********************************************************************************************************************************/
@@ -90,6 +106,9 @@ struct StorageGcs
     const String *bucket;                                           // Bucket to store data in
     const String *endpoint;                                         // Endpoint
     size_t chunkSize;                                               // Block size for resumable upload
+    unsigned int downloadConcurrency;                               // Max ranges downloaded concurrently
+    uint64_t downloadRangeSize;                                     // Range size for downloads (0 for a single request)
+    unsigned int deleteMax;                                         // Maximum objects that can be deleted in one batch request
 
     StorageGcsKeyType keyType;                                      // Auth key type
     const String *credential;                                       // Credential (client email)
@@ -368,6 +387,7 @@ storageGcsRequestAsync(StorageGcs *this, const String *verb, StorageGcsRequestAs
         FUNCTION_LOG_PARAM(STRING, verb);
         FUNCTION_LOG_PARAM(BOOL, param.noBucket);
         FUNCTION_LOG_PARAM(BOOL, param.upload);
+        FUNCTION_LOG_PARAM(BOOL, param.batch);
         FUNCTION_LOG_PARAM(BOOL, param.noAuth);
         FUNCTION_LOG_PARAM(STRING, param.object);
         FUNCTION_LOG_PARAM(HTTP_HEADER, param.header);
@@ -378,13 +398,15 @@ storageGcsRequestAsync(StorageGcs *this, const String *verb, StorageGcsRequestAs
     ASSERT(this != NULL);
     ASSERT(verb != NULL);
     ASSERT(!param.noBucket || param.object == NULL);
+    ASSERT(!param.batch || (param.noBucket && !param.upload));
 
     HttpRequest *result = NULL;
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
-        // Generate path
-        String *path = strNewFmt("%s/storage/v1/b", param.upload ? "/upload" : "");
+        // Generate path. Batch requests have their own endpoint and the bucket is specified in each request in the batch.
+        String *path = param.batch ?
+            strNewZ("/batch/storage/v1") : strNewFmt("%s/storage/v1/b", param.upload ? "/upload" : "");
 
         if (!param.noBucket)
             strCatFmt(path, "/%s/o", strZ(this->bucket));
@@ -430,6 +452,7 @@ storageGcsResponse(HttpRequest *request, StorageGcsResponseParam param)
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(HTTP_REQUEST, request);
         FUNCTION_LOG_PARAM(BOOL, param.allowMissing);
+        FUNCTION_LOG_PARAM(BOOL, param.allowRangeInvalid);
         FUNCTION_LOG_PARAM(BOOL, param.allowIncomplete);
         FUNCTION_LOG_PARAM(BOOL, param.contentIo);
     FUNCTION_LOG_END();
@@ -446,6 +469,7 @@ storageGcsResponse(HttpRequest *request, StorageGcsResponseParam param)
 
         // Error if the request was not successful
         if (!httpResponseCodeOk(result) && (!param.allowMissing || httpResponseCode(result) != HTTP_RESPONSE_CODE_NOT_FOUND) &&
+            (!param.allowRangeInvalid || httpResponseCode(result) != HTTP_RESPONSE_CODE_RANGE_NOT_SATISFIABLE) &&
             (!param.allowIncomplete || httpResponseCode(result) != HTTP_RESPONSE_CODE_PERMANENT_REDIRECT))
             httpRequestError(request, result);
 
@@ -763,13 +787,17 @@ storageGcsNewRead(THIS_VOID, const String *file, bool ignoreMissing, StorageInte
         FUNCTION_LOG_PARAM(STORAGE_GCS, this);
         FUNCTION_LOG_PARAM(STRING, file);
         FUNCTION_LOG_PARAM(BOOL, ignoreMissing);
-        (void)param;                                                // No parameters are used
+        FUNCTION_LOG_PARAM(UINT64, param.offset);
+        FUNCTION_LOG_PARAM(VARIANT, param.limit);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
     ASSERT(file != NULL);
 
-    FUNCTION_LOG_RETURN(STORAGE_READ, storageReadGcsNew(this, file, ignoreMissing));
+    FUNCTION_LOG_RETURN(
+        STORAGE_READ,
+        storageReadGcsNew(
+            this, file, ignoreMissing, param.offset, param.limit, this->downloadRangeSize, this->downloadConcurrency));
 }
 
 /**********************************************************************************************************************************/
@@ -794,15 +822,170 @@ storageGcsNewWrite(THIS_VOID, const String *file, StorageInterfaceNewWriteParam
     FUNCTION_LOG_RETURN(STORAGE_WRITE, storageWriteGcsNew(this, file, this->chunkSize));
 }
 
-/**********************************************************************************************************************************/
+/***********************************************************************************************************************************
+Remove objects in batches using the JSON API batch endpoint. Each part of the batch is a complete DELETE request and each part of
+the response has the status of the matching DELETE, identified by a Content-ID of the form <response-N> where N is the Content-ID
+of the part in the request. Parts that fail with an error that can be retried are resubmitted as a new batch.
+***********************************************************************************************************************************/
 typedef struct StorageGcsPathRemoveData
 {
     StorageGcs *this;                                               // Storage Object
     MemContext *memContext;                                         // Mem context to create requests in
-    HttpRequest *request;                                           // Async remove request
+    HttpRequest *request;                                           // Async batch remove request
+    StringList *requestList;                                        // Objects removed by the async batch request
+    StringList *batchList;                                          // Objects to remove in the next batch
     const String *path;                                             // Root path of remove
 } StorageGcsPathRemoveData;
 
+static HttpRequest *
+storageGcsPathRemoveBatch(StorageGcs *const this, const StringList *const objectList)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_GCS, this);
+        FUNCTION_TEST_PARAM(STRING_LIST, objectList);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(objectList != NULL);
+
+    HttpRequest *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        String *const batch = strNew();
+
+        for (unsigned int objectIdx = 0; objectIdx < strLstSize(objectList); objectIdx++)
+        {
+            strCatFmt(
+                batch,
+                "--" GCS_BATCH_BOUNDARY "\r\n"
+                "Content-Type: application/http\r\n"
+                "Content-ID: %u\r\n"
+                "\r\n"
+                "DELETE /storage/v1/b/%s/o/%s HTTP/1.1\r\n"
+                "\r\n",
+                objectIdx, strZ(this->bucket), strZ(httpUriEncode(strSub(strLstGet(objectList, objectIdx), 1), false)));
+        }
+
+        strCatZ(batch, "--" GCS_BATCH_BOUNDARY "--\r\n");
+
+        MEM_CONTEXT_PRIOR_BEGIN()
+        {
+            result = storageGcsRequestAsyncP(
+                this, HTTP_VERB_POST_STR, .noBucket = true, .batch = true,
+                .header = httpHeaderAdd(httpHeaderNew(NULL), HTTP_HEADER_CONTENT_TYPE_STR, GCS_BATCH_CONTENT_TYPE_STR),
+                .content = BUFSTR(batch));
+        }
+        MEM_CONTEXT_PRIOR_END();
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+static void
+storageGcsPathRemoveResponse(StorageGcs *const this, HttpRequest *request, const StringList *objectList)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_GCS, this);
+        FUNCTION_TEST_PARAM(HTTP_REQUEST, request);
+        FUNCTION_TEST_PARAM(STRING_LIST, objectList);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(request != NULL);
+    ASSERT(objectList != NULL);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        Wait *wait = NULL;
+
+        do
+        {
+            const List *const statusList = httpMultipartStatusList(
+                httpResponseContent(storageGcsResponseP(request)), strLstSize(objectList));
+            StringList *const retryList = strLstNew();
+            const HttpMultipartStatus *retryStatus = NULL;
+
+            for (unsigned int statusIdx = 0; statusIdx < lstSize(statusList); statusIdx++)
+            {
+                const HttpMultipartStatus *const status = lstGet(statusList, statusIdx);
+
+                // Error on any status other than success, missing, or an error that can be retried
+                if (status->code / 100 != 2 && status->code != HTTP_RESPONSE_CODE_NOT_FOUND)
+                {
+                    if (!httpMultipartStatusRetry(status->code))
+                    {
+                        THROW_FMT(
+                            FileRemoveError, STORAGE_ERROR_PATH_REMOVE_FILE ": [%u] %s", strZ(strLstGet(objectList, status->id)),
+                            status->code, strZ(status->reason));
+                    }
+
+                    if (retryStatus == NULL)
+                        retryStatus = status;
+
+                    strLstAdd(retryList, strLstGet(objectList, status->id));
+                }
+            }
+
+            request = NULL;
+
+            // Resubmit the parts that can be retried until the timeout expires
+            if (retryStatus != NULL)
+            {
+                if (wait == NULL)
+                    wait = waitNew(httpClientTimeout(this->httpClient));
+
+                if (!waitMore(wait))
+                {
+                    THROW_FMT(
+                        FileRemoveError, STORAGE_ERROR_PATH_REMOVE_FILE ": [%u] %s", strZ(strLstGet(objectList, retryStatus->id)),
+                        retryStatus->code, strZ(retryStatus->reason));
+                }
+
+                LOG_DEBUG_FMT(
+                    "retry remove of %u object(s): [%u] %s", strLstSize(retryList), retryStatus->code, strZ(retryStatus->reason));
+
+                objectList = retryList;
+                request = storageGcsPathRemoveBatch(this, objectList);
+            }
+        }
+        while (request != NULL);
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+static HttpRequest *
+storageGcsPathRemoveInternal(
+    StorageGcs *const this, HttpRequest *const request, const StringList *const requestList, const StringList *const batchList)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_GCS, this);
+        FUNCTION_TEST_PARAM(HTTP_REQUEST, request);
+        FUNCTION_TEST_PARAM(STRING_LIST, requestList);
+        FUNCTION_TEST_PARAM(STRING_LIST, batchList);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    // Get response for async request
+    if (request != NULL)
+    {
+        storageGcsPathRemoveResponse(this, request, requestList);
+        httpRequestFree(request);
+    }
+
+    // Send new async request if there is more to remove
+    HttpRequest *result = NULL;
+
+    if (batchList != NULL)
+        result = storageGcsPathRemoveBatch(this, batchList);
+
+    FUNCTION_TEST_RETURN(result);
+}
+
 static void
 storageGcsPathRemoveCallback(void *callbackData, const StorageInfo *info)
 {
@@ -814,24 +997,29 @@ storageGcsPathRemoveCallback(void *callbackData, const StorageInfo *info)
     ASSERT(callbackData != NULL);
     ASSERT(info != NULL);
 
-    StorageGcsPathRemoveData *data = callbackData;
-
-    // Get response from prior async request
-    if (data->request != NULL)
-    {
-        storageGcsResponseP(data->request, .allowMissing = true);
-
-        httpRequestFree(data->request);
-        data->request = NULL;
-    }
-
     // Only delete files since paths don't really exist
     if (info->type == storageTypeFile)
     {
+        StorageGcsPathRemoveData *data = callbackData;
+
         MEM_CONTEXT_BEGIN(data->memContext)
         {
-            data->request = storageGcsRequestAsyncP(
-                data->this, HTTP_VERB_DELETE_STR, .object = strNewFmt("%s/%s", strZ(data->path), strZ(info->name)));
+            // If there is something to delete then create the batch
+            if (data->batchList == NULL)
+                data->batchList = strLstNew();
+
+            // Add to batch
+            strLstAdd(data->batchList, strNewFmt("%s/%s", strZ(data->path), strZ(info->name)));
+
+            // Send batch when it is full
+            if (strLstSize(data->batchList) == data->this->deleteMax)
+            {
+                data->request = storageGcsPathRemoveInternal(data->this, data->request, data->requestList, data->batchList);
+
+                strLstFree(data->requestList);
+                data->requestList = data->batchList;
+                data->batchList = NULL;
+            }
         }
         MEM_CONTEXT_END();
     }
@@ -865,9 +1053,15 @@ storageGcsPathRemove(THIS_VOID, const String *path, bool recurse, StorageInterfa
 
         storageGcsListInternal(this, path, storageInfoLevelType, NULL, true, storageGcsPathRemoveCallback, &data);
 
+        // Send if there is more to be removed
+        if (data.batchList != NULL)
+        {
+            data.request = storageGcsPathRemoveInternal(this, data.request, data.requestList, data.batchList);
+            data.requestList = data.batchList;
+        }
+
         // Check response on last async request
-        if (data.request != NULL)
-            storageGcsResponseP(data.request, .allowMissing = true);
+        storageGcsPathRemoveInternal(this, data.request, data.requestList, NULL);
     }
     MEM_CONTEXT_TEMP_END();
 
@@ -909,8 +1103,8 @@ static const StorageInterface storageInterfaceGcs =
 Storage *
 storageGcsNew(
     const String *path, bool write, StoragePathExpressionCallback pathExpressionFunction, const String *bucket,
-    StorageGcsKeyType keyType, const String *key, size_t chunkSize, const String *endpoint, TimeMSec timeout, bool verifyPeer,
-    const String *caFile, const String *caPath)
+    StorageGcsKeyType keyType, const String *key, size_t chunkSize, unsigned int downloadConcurrency, const String *endpoint,
+    TimeMSec timeout, bool verifyPeer, const String *caFile, const String *caPath)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING, path);
@@ -920,6 +1114,7 @@ storageGcsNew(
         FUNCTION_LOG_PARAM(STRING_ID, keyType);
         FUNCTION_TEST_PARAM(STRING, key);
         FUNCTION_LOG_PARAM(SIZE, chunkSize);
+        FUNCTION_LOG_PARAM(UINT, downloadConcurrency);
         FUNCTION_LOG_PARAM(STRING, endpoint);
         FUNCTION_LOG_PARAM(TIME_MSEC, timeout);
         FUNCTION_LOG_PARAM(BOOL, verifyPeer);
@@ -931,6 +1126,7 @@ storageGcsNew(
     ASSERT(bucket != NULL);
     ASSERT(keyType == storageGcsKeyTypeAuto || key != NULL);
     ASSERT(chunkSize != 0);
+    ASSERT(downloadConcurrency != 0);
 
     Storage *this = NULL;
 
@@ -946,6 +1142,9 @@ storageGcsNew(
             .bucket = strDup(bucket),
             .keyType = keyType,
             .chunkSize = chunkSize,
+            .downloadConcurrency = downloadConcurrency,
+            .downloadRangeSize = downloadConcurrency > 1 ? STORAGE_RANGE_READ_SIZE_DEFAULT : 0,
+            .deleteMax = STORAGE_GCS_DELETE_MAX,
         };
 
         // Handle auth key types
@@ -972,9 +1171,9 @@ storageGcsNew(
                 driver->authUrl = httpUrlNewParseP(varStr(kvGet(kvKey, GCS_JSON_TOKEN_URI_VAR)), .type = httpProtocolTypeHttps);
 
                 driver->authClient = httpClientNew(
-                    tlsClientNew(
+                    tlsClientNewP(
                         sckClientNew(httpUrlHost(driver->authUrl), httpUrlPort(driver->authUrl), timeout),
-                        httpUrlHost(driver->authUrl), timeout, verifyPeer, caFile, caPath),
+                        httpUrlHost(driver->authUrl), timeout, verifyPeer, .caFile = caFile, .caPath = caPath),
                     timeout);
 
                 break;
@@ -992,8 +1191,9 @@ storageGcsNew(
 
         // Create the http client used to service requests
         driver->httpClient = httpClientNew(
-            tlsClientNew(
-                sckClientNew(driver->endpoint, httpUrlPort(url), timeout), driver->endpoint, timeout, verifyPeer, caFile, caPath),
+            tlsClientNewP(
+                sckClientNew(driver->endpoint, httpUrlPort(url), timeout), driver->endpoint, timeout, verifyPeer, .caFile = caFile,
+                .caPath = caPath),
             timeout);
 
         // Create list of redacted headers
@@ -31,7 +31,7 @@ Constructors
 ***********************************************************************************************************************************/
 Storage *storageGcsNew(
     const String *path, bool write, StoragePathExpressionCallback pathExpressionFunction, const String *bucket,
-    StorageGcsKeyType keyType, const String *key, size_t blockSize, const String *endpoint, TimeMSec timeout, bool verifyPeer,
-    const String *caFile, const String *caPath);
+    StorageGcsKeyType keyType, const String *key, size_t blockSize, unsigned int downloadConcurrency, const String *endpoint,
+    TimeMSec timeout, bool verifyPeer, const String *caFile, const String *caPath);
 
 #endif
@@ -15,6 +15,8 @@ typedef struct StorageGcs StorageGcs;
 /***********************************************************************************************************************************
 HTTP headers
 ***********************************************************************************************************************************/
+#define GCS_HEADER_GENERATION                                       "x-goog-generation"
+    STRING_DECLARE(GCS_HEADER_GENERATION_STR);
 #define GCS_HEADER_UPLOAD_ID                                        "x-guploader-uploadid"
     STRING_DECLARE(GCS_HEADER_UPLOAD_ID_STR);
 
@@ -23,6 +25,8 @@ Query tokens
 ***********************************************************************************************************************************/
 #define GCS_QUERY_FIELDS                                            "fields"
     STRING_DECLARE(GCS_QUERY_FIELDS_STR);
+#define GCS_QUERY_IF_GENERATION_MATCH                               "ifGenerationMatch"
+    STRING_DECLARE(GCS_QUERY_IF_GENERATION_MATCH_STR);
 #define GCS_QUERY_MEDIA                                             "media"
     STRING_DECLARE(GCS_QUERY_MEDIA_STR);
 #define GCS_QUERY_NAME                                              "name"
@@ -49,6 +53,7 @@ typedef struct StorageGcsRequestAsyncParam
     VAR_PARAM_HEADER;
     bool noBucket;                                                  // Exclude bucket from the URI?
     bool upload;                                                    // Is an object upload?
+    bool batch;                                                     // Is a batch request?
     bool noAuth;                                                    // Exclude authentication header?
     const String *object;                                           // Object to include in URI
     const HttpHeader *header;                                       // Request headers
@@ -66,6 +71,7 @@ typedef struct StorageGcsResponseParam
 {
     VAR_PARAM_HEADER;
     bool allowMissing;                                              // Allow missing files (caller can check response code)
+    bool allowRangeInvalid;                                         // Allow range not satisfiable (caller can check response code)
     bool allowIncomplete;                                           // Allow incomplete resume (used for resumable upload)
     bool contentIo;                                                 // Is IoRead interface required to read content?
 } StorageGcsResponseParam;
@@ -10,6 +10,7 @@ Storage Helper
 #include "common/memContext.h"
 #include "common/regExp.h"
 #include "config/config.h"
+#include "config/parse.h"
 #include "protocol/helper.h"
 #include "storage/azure/storage.h"
 #include "storage/cifs/storage.h"
@@ -59,6 +60,14 @@ static struct StorageHelper
     bool dryRunInit;                                                // Has dryRun been initialized?  If not disallow writes.
     bool dryRun;                                                    // Disallow writes in dry-run mode.
     RegExp *walRegExp;                                              // Regular expression for identifying wal files
+
+    bool throttleInit;                                              // Have throttles been initialized?
+    IoThrottle *throttleRead;                                       // Throttle pg/repo reads
+    IoThrottle *throttleWrite;                                      // Throttle pg/repo writes
+    String *throttleFile;                                           // File used to change limits while running
+    time_t throttleFileTime;                                        // Modified time of the file when last loaded (0 if missing)
+    IoThrottleLimit throttleFileLimitRead;                          // Read limits loaded from the file
+    IoThrottleLimit throttleFileLimitWrite;                         // Write limits loaded from the file
 } storageHelper;
 
 /***********************************************************************************************************************************
@@ -161,6 +170,199 @@ storageLocalWrite(void)
     FUNCTION_TEST_RETURN(storageHelper.storageLocalWrite);
 }
 
+/***********************************************************************************************************************************
+Should posix storage use io_uring? The option is not valid for all commands.
+***********************************************************************************************************************************/
+static bool
+storagePosixUring(void)
+{
+    FUNCTION_TEST_VOID();
+    FUNCTION_TEST_RETURN(cfgOptionValid(cfgOptIoUring) && cfgOptionBool(cfgOptIoUring));
+}
+
+/***********************************************************************************************************************************
+Get throttle limits. The limits in the throttle file are loaded when the file is modified and override the configured limits.
+***********************************************************************************************************************************/
+static void
+storageHelperThrottleLoad(void)
+{
+    FUNCTION_TEST_VOID();
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const StorageInfo info = storageInfoP(storageLocal(), storageHelper.throttleFile, .ignoreMissing = true);
+        const time_t fileTime = info.exists ? info.timeModified : 0;
+
+        if (fileTime != storageHelper.throttleFileTime)
+        {
+            // Start from the configured limits so options removed from the file revert
+            IoThrottleLimit limitRead =
+            {
+                .byteRate = cfgOptionTest(cfgOptThrottleRead) ? cfgOptionUInt64(cfgOptThrottleRead) : 0,
+                .opRate = cfgOptionTest(cfgOptThrottleReadIops) ? cfgOptionUInt64(cfgOptThrottleReadIops) : 0,
+            };
+            IoThrottleLimit limitWrite =
+            {
+                .byteRate = cfgOptionTest(cfgOptThrottleWrite) ? cfgOptionUInt64(cfgOptThrottleWrite) : 0,
+                .opRate = cfgOptionTest(cfgOptThrottleWriteIops) ? cfgOptionUInt64(cfgOptThrottleWriteIops) : 0,
+            };
+
+            const Buffer *const buffer = info.exists ?
+                storageGetP(storageNewReadP(storageLocal(), storageHelper.throttleFile, .ignoreMissing = true)) : NULL;
+
+            if (buffer != NULL)
+            {
+                const StringList *const lineList = strLstNewSplitZ(strNewBuf(buffer), "\n");
+
+                for (unsigned int lineIdx = 0; lineIdx < strLstSize(lineList); lineIdx++)
+                {
+                    const String *const line = strTrim(strLstGet(lineList, lineIdx));
+
+                    if (strEmpty(line) || strBeginsWithZ(line, "#"))
+                        continue;
+
+                    TRY_BEGIN()
+                    {
+                        const int equalIdx = strChr(line, '=');
+
+                        if (equalIdx == -1)
+                            THROW(FormatError, "missing '='");
+
+                        const String *const key = strTrim(strSubN(line, 0, (size_t)equalIdx));
+                        const String *const value = strTrim(strSub(line, (size_t)equalIdx + 1));
+
+                        ConfigOption optionId;
+                        uint64_t *limit;
+
+                        if (strEqZ(key, CFGOPT_THROTTLE_READ))
+                        {
+                            optionId = cfgOptThrottleRead;
+                            limit = &limitRead.byteRate;
+                        }
+                        else if (strEqZ(key, CFGOPT_THROTTLE_READ_IOPS))
+                        {
+                            optionId = cfgOptThrottleReadIops;
+                            limit = &limitRead.opRate;
+                        }
+                        else if (strEqZ(key, CFGOPT_THROTTLE_WRITE))
+                        {
+                            optionId = cfgOptThrottleWrite;
+                            limit = &limitWrite.byteRate;
+                        }
+                        else if (strEqZ(key, CFGOPT_THROTTLE_WRITE_IOPS))
+                        {
+                            optionId = cfgOptThrottleWriteIops;
+                            limit = &limitWrite.opRate;
+                        }
+                        else
+                            THROW(FormatError, "invalid option");
+
+                        const uint64_t limitValue =
+                            cfgParseOptionType(optionId) == cfgOptTypeSize ? cfgParseSize(value) : cvtZToUInt64(strZ(value));
+
+                        // Zero removes the limit, otherwise the value must be in the same range allowed for the option
+                        if (limitValue != 0 &&
+                            (limitValue > INT64_MAX || !cfgParseOptionRangeValid(cfgCommand(), optionId, (int64_t)limitValue)))
+                        {
+                            THROW(FormatError, "value is out of range");
+                        }
+
+                        *limit = limitValue;
+                    }
+                    CATCH_ANY()
+                    {
+                        LOG_WARN_FMT(
+                            "unable to load '%s' from '%s': %s", strZ(line), strZ(storageHelper.throttleFile), errorMessage());
+                    }
+                    TRY_END();
+                }
+            }
+
+            storageHelper.throttleFileTime = fileTime;
+            storageHelper.throttleFileLimitRead = limitRead;
+            storageHelper.throttleFileLimitWrite = limitWrite;
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+static IoThrottleLimit
+storageHelperThrottleLimitRead(void *const callbackData)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, callbackData);
+    FUNCTION_TEST_END();
+
+    (void)callbackData;
+    storageHelperThrottleLoad();
+
+    FUNCTION_TEST_RETURN(storageHelper.throttleFileLimitRead);
+}
+
+static IoThrottleLimit
+storageHelperThrottleLimitWrite(void *const callbackData)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, callbackData);
+    FUNCTION_TEST_END();
+
+    (void)callbackData;
+    storageHelperThrottleLoad();
+
+    FUNCTION_TEST_RETURN(storageHelper.throttleFileLimitWrite);
+}
+
+/***********************************************************************************************************************************
+Throttle pg and repo storage for commands that support it. The throttle state is kept in the lock path so the limits are shared by
+all processes running the command for the stanza on this host.
+***********************************************************************************************************************************/
+static void
+storageHelperThrottle(Storage *const storage)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE, storage);
+    FUNCTION_TEST_END();
+
+    ASSERT(storage != NULL);
+
+    if (!storageHelper.throttleInit)
+    {
+        if (cfgOptionValid(cfgOptThrottleRead))
+        {
+            MEM_CONTEXT_BEGIN(storageHelper.memContext)
+            {
+                const String *const lockPath = cfgOptionStr(cfgOptLockPath);
+                const String *const stanza = cfgOptionStr(cfgOptStanza);
+
+                storageHelper.throttleFile = strNewFmt("%s/%s.throttle", strZ(lockPath), strZ(stanza));
+
+                // Force the limits to load on first use even when the file is missing
+                storageHelper.throttleFileTime = -1;
+
+                // The lock path may not exist yet for commands that do not take a lock, e.g. restore
+                storagePathCreateP(storageLocalWrite(), lockPath);
+
+                storageHelper.throttleRead = ioThrottleNew(
+                    strNewFmt("%s/%s-%s-read.throttle-state", strZ(lockPath), strZ(stanza), cfgCommandName(cfgCommand())),
+                    storageHelperThrottleLimitRead, NULL);
+                storageHelper.throttleWrite = ioThrottleNew(
+                    strNewFmt("%s/%s-%s-write.throttle-state", strZ(lockPath), strZ(stanza), cfgCommandName(cfgCommand())),
+                    storageHelperThrottleLimitWrite, NULL);
+            }
+            MEM_CONTEXT_END();
+        }
+
+        storageHelper.throttleInit = true;
+    }
+
+    if (storageHelper.throttleRead != NULL)
+        storageThrottleSet(storage, storageHelper.throttleRead, storageHelper.throttleWrite);
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 Get pg storage for the specified host id
 ***********************************************************************************************************************************/
@@ -184,9 +386,11 @@ storagePgGet(unsigned int pgIdx, bool write)
     // Use Posix storage
     else
     {
-        result = storagePosixNewP(cfgOptionIdxStr(cfgOptPgPath, pgIdx), .write = write);
+        result = storagePosixNewP(cfgOptionIdxStr(cfgOptPgPath, pgIdx), .write = write, .uring = storagePosixUring());
     }
 
+    storageHelperThrottle(result);
+
     FUNCTION_TEST_RETURN(result);
 }
 
@@ -364,6 +568,7 @@ storageRepoGet(unsigned int repoIdx, bool write)
                     cfgOptionIdxStr(cfgOptRepoAzureContainer, repoIdx), cfgOptionIdxStr(cfgOptRepoAzureAccount, repoIdx),
                     (StorageAzureKeyType)cfgOptionIdxStrId(cfgOptRepoAzureKeyType, repoIdx),
                     cfgOptionIdxStr(cfgOptRepoAzureKey, repoIdx), STORAGE_AZURE_BLOCKSIZE_MIN,
+                    cfgOptionIdxUInt(cfgOptRepoStorageReadConcurrency, repoIdx),
                     cfgOptionIdxStrNull(cfgOptRepoStorageHost, repoIdx), cfgOptionIdxStr(cfgOptRepoAzureEndpoint, repoIdx),
                     cfgOptionIdxUInt(cfgOptRepoStoragePort, repoIdx), ioTimeoutMs(),
                     cfgOptionIdxBool(cfgOptRepoStorageVerifyTls, repoIdx), cfgOptionIdxStrNull(cfgOptRepoStorageCaFile, repoIdx),
@@ -384,6 +589,7 @@ storageRepoGet(unsigned int repoIdx, bool write)
                     cfgOptionIdxStr(cfgOptRepoGcsBucket, repoIdx),
                     (StorageGcsKeyType)cfgOptionIdxStrId(cfgOptRepoGcsKeyType, repoIdx),
                     cfgOptionIdxStrNull(cfgOptRepoGcsKey, repoIdx), STORAGE_GCS_CHUNKSIZE_DEFAULT,
+                    cfgOptionIdxUInt(cfgOptRepoStorageReadConcurrency, repoIdx),
                     cfgOptionIdxStr(cfgOptRepoGcsEndpoint, repoIdx), ioTimeoutMs(),
                     cfgOptionIdxBool(cfgOptRepoStorageVerifyTls, repoIdx), cfgOptionIdxStrNull(cfgOptRepoStorageCaFile, repoIdx),
                     cfgOptionIdxStrNull(cfgOptRepoStorageCaPath, repoIdx));
@@ -410,8 +616,10 @@ storageRepoGet(unsigned int repoIdx, bool write)
                     cfgOptionIdxStr(cfgOptRepoS3Region, repoIdx), (StorageS3KeyType)cfgOptionIdxStrId(cfgOptRepoS3KeyType, repoIdx),
                     cfgOptionIdxStrNull(cfgOptRepoS3Key, repoIdx), cfgOptionIdxStrNull(cfgOptRepoS3KeySecret, repoIdx),
                     cfgOptionIdxStrNull(cfgOptRepoS3Token, repoIdx), cfgOptionIdxStrNull(cfgOptRepoS3Role, repoIdx),
-                    STORAGE_S3_PARTSIZE_MIN, host, port, ioTimeoutMs(), cfgOptionIdxBool(cfgOptRepoStorageVerifyTls, repoIdx),
-                    cfgOptionIdxStrNull(cfgOptRepoStorageCaFile, repoIdx), cfgOptionIdxStrNull(cfgOptRepoStorageCaPath, repoIdx));
+                    STORAGE_S3_PARTSIZE_MIN, cfgOptionIdxUInt(cfgOptRepoS3UploadConcurrency, repoIdx),
+                    cfgOptionIdxUInt(cfgOptRepoStorageReadConcurrency, repoIdx), host, port, ioTimeoutMs(),
+                    cfgOptionIdxBool(cfgOptRepoStorageVerifyTls, repoIdx), cfgOptionIdxStrNull(cfgOptRepoStorageCaFile, repoIdx),
+                    cfgOptionIdxStrNull(cfgOptRepoStorageCaPath, repoIdx));
 
                 break;
             }
@@ -422,12 +630,15 @@ storageRepoGet(unsigned int repoIdx, bool write)
                 CHECK(type == STORAGE_POSIX_TYPE);
 
                 result = storagePosixNewP(
-                    cfgOptionIdxStr(cfgOptRepoPath, repoIdx), .write = write, .pathExpressionFunction = storageRepoPathExpression);
+                    cfgOptionIdxStr(cfgOptRepoPath, repoIdx), .write = write, .pathExpressionFunction = storageRepoPathExpression,
+                    .uring = storagePosixUring());
                 break;
             }
         }
     }
 
+    storageHelperThrottle(result);
+
     FUNCTION_TEST_RETURN(result);
 }
 
@@ -7,14 +7,22 @@ Posix Storage Read
 #include <unistd.h>
 
 #include "common/debug.h"
+#include "common/io/io.h"
 #include "common/io/read.h"
 #include "common/log.h"
 #include "common/memContext.h"
 #include "common/type/object.h"
 #include "storage/posix/read.h"
 #include "storage/posix/storage.intern.h"
+#include "storage/posix/uring.h"
 #include "storage/read.intern.h"
 
+/***********************************************************************************************************************************
+Bytes to read before asking the kernel to drop them from the page cache when noCache is set. Dropping in chunks avoids a system
+call for every buffer read.
+***********************************************************************************************************************************/
+#define STORAGE_READ_POSIX_CACHE_DROP_SIZE                          ((uint64_t)(4 * 1024 * 1024))
+
 /***********************************************************************************************************************************
 Object types
 ***********************************************************************************************************************************/
@@ -28,6 +36,17 @@ typedef struct StorageReadPosix
     uint64_t current;                                               // Current bytes read from file
     uint64_t limit;                                                 // Limit bytes to be read from file (UINT64_MAX for no limit)
     bool eof;
+    uint64_t cacheDropped;                                          // Bytes dropped from the page cache when noCache is set
+
+    StoragePosixUring *uringQueue;                                  // Queue of reads in flight (NULL when not using io_uring)
+    unsigned int uringSlotFirst;                                    // First slot acquired in the queue
+    unsigned int uringSlot;                                         // Slot being read by the caller (relative to the first slot)
+    unsigned int uringSlotTotal;                                    // Slots queued, including the slot being read
+    size_t uringSlotUsed;                                           // Bytes read into the slot buffer
+    size_t uringSlotOffset;                                         // Offset of the next byte to read from the slot buffer
+    bool uringSlotReady;                                            // Has the read for the slot being read completed?
+    uint64_t uringQueued;                                           // Bytes queued for read (including bytes already read)
+    bool uringEof;                                                  // Has a read returned less data than requested?
 } StorageReadPosix;
 
 /***********************************************************************************************************************************
@@ -52,12 +71,154 @@ storageReadPosixFreeResource(THIS_VOID)
 
     ASSERT(this != NULL);
 
+    // Release the slots first so reads in flight complete before the file is closed
+    if (this->uringQueue != NULL)
+    {
+        storagePosixUringRelease(this->uringQueue, this->uringSlotFirst, STORAGE_POSIX_URING_DEPTH);
+        this->uringQueue = NULL;
+    }
+
     if (this->fd != -1)
         THROW_ON_SYS_ERROR_FMT(close(this->fd) == -1, FileCloseError, STORAGE_ERROR_READ_CLOSE, strZ(this->interface.name));
 
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Drop bytes that have been read from the page cache. When force is false the bytes are only dropped once a full chunk has been read.
+Errors are ignored since this is only advice to the kernel and the read has already succeeded.
+***********************************************************************************************************************************/
+static void
+storageReadPosixCacheDrop(StorageReadPosix *const this, const bool force)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_READ_POSIX, this);
+        FUNCTION_LOG_PARAM(BOOL, force);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->fd != -1);
+
+    if (this->interface.noCache && this->current > this->cacheDropped &&
+        (force || this->current - this->cacheDropped >= STORAGE_READ_POSIX_CACHE_DROP_SIZE))
+    {
+#ifdef POSIX_FADV_DONTNEED
+        posix_fadvise(
+            this->fd, (off_t)(this->interface.offset + this->cacheDropped), (off_t)(this->current - this->cacheDropped),
+            POSIX_FADV_DONTNEED);
+#endif
+        this->cacheDropped = this->current;
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Queue a read into the next free slot unless the limit or EOF has been reached
+***********************************************************************************************************************************/
+static void
+storageReadPosixUringQueue(StorageReadPosix *const this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_READ_POSIX, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->uringQueue != NULL);
+    ASSERT(this->uringSlotTotal < STORAGE_POSIX_URING_DEPTH);
+
+    if (!this->uringEof && this->uringQueued < this->limit)
+    {
+        const unsigned int slotIdx = this->uringSlotFirst + (this->uringSlot + this->uringSlotTotal) % STORAGE_POSIX_URING_DEPTH;
+        size_t size = storagePosixUringBufferSize(this->uringQueue, slotIdx);
+
+        if (this->uringQueued + size > this->limit)
+            size = (size_t)(this->limit - this->uringQueued);
+
+        storagePosixUringRead(this->uringQueue, slotIdx, this->fd, size, this->interface.offset + this->uringQueued);
+
+        this->uringQueued += size;
+        this->uringSlotTotal++;
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Read from the queue of reads in flight
+***********************************************************************************************************************************/
+static size_t
+storageReadPosixUring(StorageReadPosix *const this, Buffer *const buffer)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_READ_POSIX, this);
+        FUNCTION_LOG_PARAM(BUFFER, buffer);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->uringQueue != NULL);
+    ASSERT(buffer != NULL);
+
+    size_t result = 0;
+
+    // EOF when nothing is queued, i.e. the limit was zero
+    if (this->uringSlotTotal == 0)
+    {
+        this->eof = true;
+    }
+    else
+    {
+        const unsigned int slotIdx = this->uringSlotFirst + this->uringSlot;
+
+        // Wait for the read to complete
+        if (!this->uringSlotReady)
+        {
+            const int readResult = storagePosixUringWait(this->uringQueue, slotIdx);
+
+            if (readResult < 0)
+            {
+                errno = -readResult;
+                THROW_SYS_ERROR_FMT(FileReadError, "unable to read '%s'", strZ(this->interface.name));
+            }
+
+            // If less data than requested was read then no more reads will be queued. As in blocking reads, we are not concerned
+            // with files that are growing.
+            if ((size_t)readResult < storagePosixUringSize(this->uringQueue, slotIdx))
+                this->uringEof = true;
+
+            this->uringSlotUsed = (size_t)readResult;
+            this->uringSlotOffset = 0;
+            this->uringSlotReady = true;
+        }
+
+        // Copy as much data as will fit into the buffer
+        result = this->uringSlotUsed - this->uringSlotOffset;
+
+        if (result > bufRemains(buffer))
+            result = bufRemains(buffer);
+
+        bufCatC(buffer, storagePosixUringBuffer(this->uringQueue, slotIdx), this->uringSlotOffset, result);
+        this->uringSlotOffset += result;
+        this->current += result;
+
+        // When the slot has been read queue another read into it
+        if (this->uringSlotOffset == this->uringSlotUsed)
+        {
+            this->uringSlot = (this->uringSlot + 1) % STORAGE_POSIX_URING_DEPTH;
+            this->uringSlotTotal--;
+            this->uringSlotReady = false;
+
+            storageReadPosixUringQueue(this);
+
+            // EOF when there is nothing left to read
+            if (this->uringEof || this->current == this->limit)
+                this->eof = true;
+        }
+    }
+
+    FUNCTION_LOG_RETURN(SIZE, result);
+}
+
 /***********************************************************************************************************************************
 Open the file
 ***********************************************************************************************************************************/
@@ -94,6 +255,38 @@ storageReadPosixOpen(THIS_VOID)
     if (this->fd != -1)
     {
         memContextCallbackSet(this->memContext, storageReadPosixFreeResource, this);
+
+        // Seek to offset
+        if (this->interface.offset != 0)
+        {
+            THROW_ON_SYS_ERROR_FMT(
+                lseek(this->fd, (off_t)this->interface.offset, SEEK_SET) == -1, FileOpenError, STORAGE_ERROR_READ_SEEK,
+                this->interface.offset, strZ(this->interface.name));
+        }
+
+#ifdef POSIX_FADV_SEQUENTIAL
+        // When the pages will be dropped from the cache the file is being read once from start to end, so let the kernel know it
+        // can read ahead more aggressively
+        if (this->interface.noCache)
+            posix_fadvise(this->fd, (off_t)this->interface.offset, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+        // Queue reads ahead of the caller with io_uring when available and there are free slots in the storage queue
+        StoragePosixUring *const uringQueue = storagePosixUringQueue(this->storage);
+
+        if (uringQueue != NULL)
+        {
+            this->uringSlotFirst = storagePosixUringAcquire(uringQueue, STORAGE_POSIX_URING_DEPTH);
+
+            if (this->uringSlotFirst != STORAGE_POSIX_URING_SLOT_NONE)
+            {
+                this->uringQueue = uringQueue;
+
+                for (unsigned int slotIdx = 0; slotIdx < STORAGE_POSIX_URING_DEPTH; slotIdx++)
+                    storageReadPosixUringQueue(this);
+            }
+        }
+
         result = true;
     }
 
@@ -120,7 +313,12 @@ storageReadPosix(THIS_VOID, Buffer *buffer, bool block)
     // Read if EOF has not been reached
     ssize_t actualBytes = 0;
 
-    if (!this->eof)
+    if (this->uringQueue != NULL)
+    {
+        if (!this->eof)
+            actualBytes = (ssize_t)storageReadPosixUring(this, buffer);
+    }
+    else if (!this->eof)
     {
         // Determine expected bytes to read. If remaining size in the buffer would exceed the limit then reduce the expected read.
         size_t expectedBytes = bufRemains(buffer);
@@ -145,6 +343,8 @@ storageReadPosix(THIS_VOID, Buffer *buffer, bool block)
             this->eof = true;
     }
 
+    storageReadPosixCacheDrop(this, this->eof);
+
     FUNCTION_LOG_RETURN(SIZE, (size_t)actualBytes);
 }
 
@@ -162,6 +362,9 @@ storageReadPosixClose(THIS_VOID)
 
     ASSERT(this != NULL);
 
+    // Drop any bytes read since the last drop, e.g. when the file was closed before EOF
+    storageReadPosixCacheDrop(this, true);
+
     memContextCallbackClear(this->memContext);
     storageReadPosixFreeResource(this);
     this->fd = -1;
@@ -205,11 +408,15 @@ storageReadPosixFd(const THIS_VOID)
 
 /**********************************************************************************************************************************/
 StorageRead *
-storageReadPosixNew(StoragePosix *storage, const String *name, bool ignoreMissing, const Variant *limit)
+storageReadPosixNew(
+    StoragePosix *const storage, const String *const name, const bool ignoreMissing, const bool noCache, const uint64_t offset,
+    const Variant *const limit)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(STRING, name);
         FUNCTION_LOG_PARAM(BOOL, ignoreMissing);
+        FUNCTION_LOG_PARAM(BOOL, noCache);
+        FUNCTION_LOG_PARAM(UINT64, offset);
         FUNCTION_LOG_PARAM(VARIANT, limit);
     FUNCTION_LOG_END();
 
@@ -237,6 +444,8 @@ storageReadPosixNew(StoragePosix *storage, const String *name, bool ignoreMissin
                 .type = STORAGE_POSIX_TYPE,
                 .name = strDup(name),
                 .ignoreMissing = ignoreMissing,
+                .noCache = noCache,
+                .offset = offset,
                 .limit = varDup(limit),
 
                 .ioInterface = (IoReadInterface)
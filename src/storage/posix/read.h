@@ -10,6 +10,7 @@ Posix Storage Read
 /***********************************************************************************************************************************
 Constructors
 ***********************************************************************************************************************************/
-StorageRead *storageReadPosixNew(StoragePosix *storage, const String *name, bool ignoreMissing, const Variant *limit);
+StorageRead *storageReadPosixNew(
+    StoragePosix *storage, const String *name, bool ignoreMissing, bool noCache, uint64_t offset, const Variant *limit);
 
 #endif
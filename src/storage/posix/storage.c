@@ -13,6 +13,7 @@ Posix Storage
 #include <unistd.h>
 
 #include "common/debug.h"
+#include "common/io/io.h"
 #include "common/log.h"
 #include "common/memContext.h"
 #include "common/regExp.h"
@@ -35,6 +36,9 @@ struct StoragePosix
 {
     STORAGE_COMMON_MEMBER;
     MemContext *memContext;                                         // Object memory context
+    bool uring;                                                     // Use io_uring for file reads/writes if available?
+    bool uringInit;                                                 // Has the io_uring queue been created?
+    StoragePosixUring *uringQueue;                                  // io_uring queue shared by files (NULL if not available)
 };
 
 /**********************************************************************************************************************************/
@@ -312,13 +316,16 @@ storagePosixNewRead(THIS_VOID, const String *file, bool ignoreMissing, StorageIn
         FUNCTION_LOG_PARAM(STORAGE_POSIX, this);
         FUNCTION_LOG_PARAM(STRING, file);
         FUNCTION_LOG_PARAM(BOOL, ignoreMissing);
+        FUNCTION_LOG_PARAM(BOOL, param.noCache);
+        FUNCTION_LOG_PARAM(UINT64, param.offset);
         FUNCTION_LOG_PARAM(VARIANT, param.limit);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
     ASSERT(file != NULL);
 
-    FUNCTION_LOG_RETURN(STORAGE_READ, storageReadPosixNew(this, file, ignoreMissing, param.limit));
+    FUNCTION_LOG_RETURN(
+        STORAGE_READ, storageReadPosixNew(this, file, ignoreMissing, param.noCache, param.offset, param.limit));
 }
 
 /**********************************************************************************************************************************/
@@ -348,7 +355,33 @@ storagePosixNewWrite(THIS_VOID, const String *file, StorageInterfaceNewWritePara
         STORAGE_WRITE,
         storageWritePosixNew(
             this, file, param.modeFile, param.modePath, param.user, param.group, param.timeModified, param.createPath,
-            param.syncFile, this->interface.pathSync != NULL ? param.syncPath : false, param.atomic));
+            param.syncFile, this->interface.pathSync != NULL ? param.syncPath : false, param.atomic, param.sparse,
+            param.delta, param.preallocate));
+}
+
+/**********************************************************************************************************************************/
+StoragePosixUring *
+storagePosixUringQueue(StoragePosix *const this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_POSIX, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    // Create the queue the first time it is needed. If io_uring is not available then creation is not attempted again.
+    if (this->uring && !this->uringInit)
+    {
+        MEM_CONTEXT_BEGIN(this->memContext)
+        {
+            this->uringQueue = storagePosixUringNew(STORAGE_POSIX_URING_DEPTH * STORAGE_POSIX_URING_FILE_MAX, ioBufferSize());
+        }
+        MEM_CONTEXT_END();
+
+        this->uringInit = true;
+    }
+
+    FUNCTION_TEST_RETURN(this->uringQueue);
 }
 
 /**********************************************************************************************************************************/
@@ -547,7 +580,7 @@ storagePosixRemove(THIS_VOID, const String *file, StorageInterfaceRemoveParam pa
 /**********************************************************************************************************************************/
 static const StorageInterface storageInterfacePosix =
 {
-    .feature = 1 << storageFeaturePath | 1 << storageFeatureCompress | 1 << storageFeatureLimitRead,
+    .feature = 1 << storageFeaturePath | 1 << storageFeatureCompress,
 
     .info = storagePosixInfo,
     .infoList = storagePosixInfoList,
@@ -563,7 +596,7 @@ static const StorageInterface storageInterfacePosix =
 Storage *
 storagePosixNewInternal(
     StringId type, const String *path, mode_t modeFile, mode_t modePath, bool write,
-    StoragePathExpressionCallback pathExpressionFunction, bool pathSync)
+    StoragePathExpressionCallback pathExpressionFunction, bool pathSync, bool uring)
 {
     FUNCTION_LOG_BEGIN(logLevelDebug);
         FUNCTION_LOG_PARAM(STRING_ID, type);
@@ -573,6 +606,7 @@ storagePosixNewInternal(
         FUNCTION_LOG_PARAM(BOOL, write);
         FUNCTION_LOG_PARAM(FUNCTIONP, pathExpressionFunction);
         FUNCTION_LOG_PARAM(BOOL, pathSync);
+        FUNCTION_LOG_PARAM(BOOL, uring);
     FUNCTION_LOG_END();
 
     ASSERT(type != 0);
@@ -594,6 +628,7 @@ storagePosixNewInternal(
         {
             .memContext = MEM_CONTEXT_NEW(),
             .interface = storageInterfacePosix,
+            .uring = uring,
         };
 
         // Disable path sync when not supported
@@ -622,11 +657,13 @@ storagePosixNew(const String *path, StoragePosixNewParam param)
         FUNCTION_LOG_PARAM(MODE, param.modePath);
         FUNCTION_LOG_PARAM(BOOL, param.write);
         FUNCTION_LOG_PARAM(FUNCTIONP, param.pathExpressionFunction);
+        FUNCTION_LOG_PARAM(BOOL, param.uring);
     FUNCTION_LOG_END();
 
     FUNCTION_LOG_RETURN(
         STORAGE,
         storagePosixNewInternal(
             STORAGE_POSIX_TYPE, path, param.modeFile == 0 ? STORAGE_MODE_FILE_DEFAULT : param.modeFile,
-            param.modePath == 0 ? STORAGE_MODE_PATH_DEFAULT : param.modePath, param.write, param.pathExpressionFunction, true));
+            param.modePath == 0 ? STORAGE_MODE_PATH_DEFAULT : param.modePath, param.write, param.pathExpressionFunction, true,
+            param.uring));
 }
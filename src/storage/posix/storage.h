@@ -26,6 +26,7 @@ typedef struct StoragePosixNewParam
     mode_t modeFile;
     mode_t modePath;
     StoragePathExpressionCallback *pathExpressionFunction;
+    bool uring;
 } StoragePosixNewParam;
 
 #define storagePosixNewP(path, ...)                                                                                                \
@@ -6,13 +6,14 @@ Posix Storage Internal
 
 #include "common/type/object.h"
 #include "storage/posix/storage.h"
+#include "storage/posix/uring.h"
 
 /***********************************************************************************************************************************
 Constructors
 ***********************************************************************************************************************************/
 Storage *storagePosixNewInternal(
     StringId type, const String *path, mode_t modeFile, mode_t modePath, bool write,
-    StoragePathExpressionCallback pathExpressionFunction, bool pathSync);
+    StoragePathExpressionCallback pathExpressionFunction, bool pathSync, bool uring);
 
 /***********************************************************************************************************************************
 Functions
@@ -21,6 +22,10 @@ void storagePosixPathCreate(
     THIS_VOID, const String *path, bool errorOnExists, bool noParentCreate, mode_t mode, StorageInterfacePathCreateParam param);
 void storagePosixPathSync(THIS_VOID, const String *path, StorageInterfacePathSyncParam param);
 
+// Queue shared by all files opened by the storage. It is created the first time it is requested. Returns NULL when io_uring is not
+// enabled for the storage or is not available.
+StoragePosixUring *storagePosixUringQueue(StoragePosix *this);
+
 /***********************************************************************************************************************************
 Macros for function logging
 ***********************************************************************************************************************************/
@@ -0,0 +1,654 @@
+/***********************************************************************************************************************************
+Posix Storage io_uring
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#ifdef HAVE_IO_URING
+
+#include <linux/io_uring.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#endif
+
+#include "common/debug.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "storage/posix/uring.h"
+
+#ifdef HAVE_IO_URING
+
+/***********************************************************************************************************************************
+syscall() is not declared when only POSIX features are enabled so declare it here. There are no glibc wrappers for io_uring.
+***********************************************************************************************************************************/
+long syscall(long number, ...);
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+typedef struct StoragePosixUringSlot
+{
+    unsigned char *buffer;                                          // Buffer for reads/writes (allocated on first acquire)
+    size_t bufferSize;                                              // Size of the buffer
+    struct iovec iov;                                               // Vector describing the request buffer
+    bool acquired;                                                  // Has the slot been acquired by a file?
+    bool pending;                                                   // Is a request in flight?
+    int result;                                                     // Result of the last completed request
+} StoragePosixUringSlot;
+
+struct StoragePosixUring
+{
+    MemContext *memContext;                                         // Object mem context
+    pid_t pid;                                                      // Process that created the ring
+    int fd;                                                         // Ring file descriptor
+    unsigned int depth;                                             // Number of slots
+    size_t bufferSize;                                              // Size of slot buffers
+    StoragePosixUringSlot *slotList;                                // Slots
+
+    void *sqRing;                                                   // Submission ring mapping
+    size_t sqRingSize;                                              // Submission ring mapping size
+    void *cqRing;                                                   // Completion ring mapping (may be the same as sqRing)
+    size_t cqRingSize;                                              // Completion ring mapping size
+    struct io_uring_sqe *sqeList;                                   // Submission queue entries
+    size_t sqeListSize;                                             // Submission queue entries mapping size
+
+    unsigned int *sqHead;                                           // Submission ring head
+    unsigned int *sqTail;                                           // Submission ring tail
+    unsigned int *sqMask;                                           // Submission ring mask
+    unsigned int *sqArray;                                          // Submission ring index array
+    unsigned int *cqHead;                                           // Completion ring head
+    unsigned int *cqTail;                                           // Completion ring tail
+    unsigned int *cqMask;                                           // Completion ring mask
+    struct io_uring_cqe *cqeList;                                   // Completion queue entries
+};
+
+/***********************************************************************************************************************************
+Enter the kernel to submit requests and/or wait for completions, retrying when interrupted
+***********************************************************************************************************************************/
+static void
+storagePosixUringEnter(StoragePosixUring *const this, const unsigned int submit, const unsigned int wait)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_POSIX_URING, this);
+        FUNCTION_TEST_PARAM(UINT, submit);
+        FUNCTION_TEST_PARAM(UINT, wait);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    long result;
+
+    do
+    {
+        result = syscall(__NR_io_uring_enter, this->fd, submit, wait, wait > 0 ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+    }
+    while (result == -1 && errno == EINTR);
+
+    THROW_ON_SYS_ERROR(result == -1, KernelError, "unable to enter io_uring");
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Wait for requests in flight in a group of slots. Errors are ignored since the results are no longer needed, but every slot is waited
+on even when waiting on an earlier slot fails since the kernel may still be writing to the slot buffers.
+***********************************************************************************************************************************/
+static void
+storagePosixUringDrain(StoragePosixUring *const this, const unsigned int slotIdx, const unsigned int slotTotal)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_POSIX_URING, this);
+        FUNCTION_LOG_PARAM(UINT, slotIdx);
+        FUNCTION_LOG_PARAM(UINT, slotTotal);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(slotIdx + slotTotal <= this->depth);
+
+    for (unsigned int drainIdx = slotIdx; drainIdx < slotIdx + slotTotal; drainIdx++)
+    {
+        if (this->slotList[drainIdx].pending)
+        {
+            TRY_BEGIN()
+            {
+                storagePosixUringWait(this, drainIdx);
+            }
+            CATCH_ANY()
+            {
+                LOG_DEBUG_FMT("unable to wait for io_uring slot %u: %s", drainIdx, errorMessage());
+            }
+            TRY_END();
+        }
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Wait for any requests in flight and unmap the rings. Slot buffers are not child objects so they are only freed after this callback
+has waited for the requests that use them.
+***********************************************************************************************************************************/
+static void
+storagePosixUringFreeResource(THIS_VOID)
+{
+    THIS(StoragePosixUring);
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_POSIX_URING, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    // Requests in a ring inherited from another process belong to that process so do not wait for them. Unmapping and closing only
+    // affect this process.
+    if (this->pid == getpid())
+        storagePosixUringDrain(this, 0, this->depth);
+
+    // Unmap the rings that were mapped
+    if (this->sqeList != MAP_FAILED)
+        munmap(this->sqeList, this->sqeListSize);
+
+    if (this->cqRing != MAP_FAILED && this->cqRing != this->sqRing)
+        munmap(this->cqRing, this->cqRingSize);
+
+    if (this->sqRing != MAP_FAILED)
+        munmap(this->sqRing, this->sqRingSize);
+
+    close(this->fd);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Map part of the ring into memory
+***********************************************************************************************************************************/
+static void *
+storagePosixUringMap(const int fd, const size_t size, const off_t offset)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(INT, fd);
+        FUNCTION_TEST_PARAM(SIZE, size);
+        FUNCTION_TEST_PARAM(INT64, offset);
+    FUNCTION_TEST_END();
+
+    void *const result = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, offset);
+
+    THROW_ON_SYS_ERROR(result == MAP_FAILED, KernelError, "unable to map io_uring");
+
+    FUNCTION_TEST_RETURN(result);
+}
+
+/**********************************************************************************************************************************/
+StoragePosixUring *
+storagePosixUringNew(const unsigned int depth, const size_t bufferSize)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(UINT, depth);
+        FUNCTION_LOG_PARAM(SIZE, bufferSize);
+    FUNCTION_LOG_END();
+
+    ASSERT(depth > 0);
+    ASSERT(bufferSize > 0);
+
+    StoragePosixUring *this = NULL;
+
+    // Create the ring. If this fails then io_uring is not supported by the kernel, is disabled, or is not allowed (e.g. by seccomp)
+    // so return NULL and let the caller fall back to blocking I/O.
+    struct io_uring_params param = {0};
+    const int fd = (int)syscall(__NR_io_uring_setup, depth, &param);
+
+    if (fd != -1)
+    {
+        MEM_CONTEXT_NEW_BEGIN("StoragePosixUring")
+        {
+            this = memNew(sizeof(StoragePosixUring));
+
+            *this = (StoragePosixUring)
+            {
+                .memContext = MEM_CONTEXT_NEW(),
+                .pid = getpid(),
+                .fd = fd,
+                .depth = depth,
+                .bufferSize = bufferSize,
+                .slotList = memNew(sizeof(StoragePosixUringSlot) * depth),
+                .sqRingSize = param.sq_off.array + param.sq_entries * sizeof(unsigned int),
+                .cqRingSize = param.cq_off.cqes + param.cq_entries * sizeof(struct io_uring_cqe),
+                .sqRing = MAP_FAILED,
+                .cqRing = MAP_FAILED,
+                .sqeList = MAP_FAILED,
+                .sqeListSize = param.sq_entries * sizeof(struct io_uring_sqe),
+            };
+
+            for (unsigned int slotIdx = 0; slotIdx < depth; slotIdx++)
+                this->slotList[slotIdx] = (StoragePosixUringSlot){0};
+
+            // Set free callback to wait for requests in flight and release the ring
+            memContextCallbackSet(this->memContext, storagePosixUringFreeResource, this);
+
+            // Map the rings. Newer kernels allow the submission and completion rings to share a single mapping.
+            if (param.features & IORING_FEAT_SINGLE_MMAP)
+            {
+                if (this->cqRingSize > this->sqRingSize)
+                    this->sqRingSize = this->cqRingSize;
+
+                this->cqRingSize = this->sqRingSize;
+            }
+
+            this->sqRing = storagePosixUringMap(fd, this->sqRingSize, IORING_OFF_SQ_RING);
+            this->cqRing =
+                param.features & IORING_FEAT_SINGLE_MMAP ?
+                    this->sqRing : storagePosixUringMap(fd, this->cqRingSize, IORING_OFF_CQ_RING);
+            this->sqeList = storagePosixUringMap(fd, this->sqeListSize, IORING_OFF_SQES);
+
+            // Set pointers into the rings
+            this->sqHead = (unsigned int *)((char *)this->sqRing + param.sq_off.head);
+            this->sqTail = (unsigned int *)((char *)this->sqRing + param.sq_off.tail);
+            this->sqMask = (unsigned int *)((char *)this->sqRing + param.sq_off.ring_mask);
+            this->sqArray = (unsigned int *)((char *)this->sqRing + param.sq_off.array);
+            this->cqHead = (unsigned int *)((char *)this->cqRing + param.cq_off.head);
+            this->cqTail = (unsigned int *)((char *)this->cqRing + param.cq_off.tail);
+            this->cqMask = (unsigned int *)((char *)this->cqRing + param.cq_off.ring_mask);
+            this->cqeList = (struct io_uring_cqe *)((char *)this->cqRing + param.cq_off.cqes);
+        }
+        MEM_CONTEXT_NEW_END();
+    }
+
+    FUNCTION_LOG_RETURN(STORAGE_POSIX_URING, this);
+}
+
+/**********************************************************************************************************************************/
+unsigned int
+storagePosixUringAcquire(StoragePosixUring *const this, const unsigned int slotTotal)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_POSIX_URING, this);
+        FUNCTION_LOG_PARAM(UINT, slotTotal);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(slotTotal > 0 && slotTotal <= this->depth);
+
+    unsigned int result = STORAGE_POSIX_URING_SLOT_NONE;
+
+    if (this->pid == getpid())
+    {
+        // Find a group where none of the slots are acquired
+        for (unsigned int slotIdx = 0; slotIdx + slotTotal <= this->depth; slotIdx += slotTotal)
+        {
+            unsigned int freeIdx = slotIdx;
+
+            while (freeIdx < slotIdx + slotTotal && !this->slotList[freeIdx].acquired)
+                freeIdx++;
+
+            if (freeIdx == slotIdx + slotTotal)
+            {
+                result = slotIdx;
+                break;
+            }
+        }
+
+        // Acquire the slots and allocate buffers the first time they are used
+        if (result != STORAGE_POSIX_URING_SLOT_NONE)
+        {
+            MEM_CONTEXT_BEGIN(this->memContext)
+            {
+                for (unsigned int slotIdx = result; slotIdx < result + slotTotal; slotIdx++)
+                {
+                    StoragePosixUringSlot *const slot = &this->slotList[slotIdx];
+
+                    if (slot->buffer == NULL)
+                    {
+                        slot->buffer = memNew(this->bufferSize);
+                        slot->bufferSize = this->bufferSize;
+                    }
+
+                    slot->acquired = true;
+                }
+            }
+            MEM_CONTEXT_END();
+        }
+    }
+
+    FUNCTION_LOG_RETURN(UINT, result);
+}
+
+/**********************************************************************************************************************************/
+void
+storagePosixUringRelease(StoragePosixUring *const this, const unsigned int slotIdx, const unsigned int slotTotal)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_POSIX_URING, this);
+        FUNCTION_LOG_PARAM(UINT, slotIdx);
+        FUNCTION_LOG_PARAM(UINT, slotTotal);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(slotIdx + slotTotal <= this->depth);
+
+    storagePosixUringDrain(this, slotIdx, slotTotal);
+
+    for (unsigned int releaseIdx = slotIdx; releaseIdx < slotIdx + slotTotal; releaseIdx++)
+    {
+        ASSERT(this->slotList[releaseIdx].acquired);
+
+        if (!this->slotList[releaseIdx].pending)
+            this->slotList[releaseIdx].acquired = false;
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+unsigned char *
+storagePosixUringBuffer(const StoragePosixUring *const this, const unsigned int slotIdx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_POSIX_URING, this);
+        FUNCTION_TEST_PARAM(UINT, slotIdx);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(slotIdx < this->depth);
+    ASSERT(this->slotList[slotIdx].acquired);
+
+    FUNCTION_TEST_RETURN(this->slotList[slotIdx].buffer);
+}
+
+/**********************************************************************************************************************************/
+size_t
+storagePosixUringBufferSize(const StoragePosixUring *const this, const unsigned int slotIdx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_POSIX_URING, this);
+        FUNCTION_TEST_PARAM(UINT, slotIdx);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(slotIdx < this->depth);
+    ASSERT(this->slotList[slotIdx].acquired);
+
+    FUNCTION_TEST_RETURN(this->slotList[slotIdx].bufferSize);
+}
+
+/**********************************************************************************************************************************/
+bool
+storagePosixUringPending(const StoragePosixUring *const this, const unsigned int slotIdx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_POSIX_URING, this);
+        FUNCTION_TEST_PARAM(UINT, slotIdx);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(slotIdx < this->depth);
+
+    FUNCTION_TEST_RETURN(this->slotList[slotIdx].pending);
+}
+
+/***********************************************************************************************************************************
+Submit a request for the slot
+***********************************************************************************************************************************/
+static void
+storagePosixUringSubmit(
+    StoragePosixUring *const this, const unsigned int slotIdx, const uint8_t opcode, const int fd, void *const data,
+    const size_t size, const uint64_t offset)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_POSIX_URING, this);
+        FUNCTION_LOG_PARAM(UINT, slotIdx);
+        FUNCTION_LOG_PARAM(UINT, opcode);
+        FUNCTION_LOG_PARAM(INT, fd);
+        FUNCTION_LOG_PARAM_P(VOID, data);
+        FUNCTION_LOG_PARAM(SIZE, size);
+        FUNCTION_LOG_PARAM(UINT64, offset);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(slotIdx < this->depth);
+    ASSERT(this->slotList[slotIdx].acquired);
+    ASSERT(!this->slotList[slotIdx].pending);
+
+    StoragePosixUringSlot *const slot = &this->slotList[slotIdx];
+
+    // The vector must remain valid until the request completes so it is stored in the slot. Vectored requests are used since they
+    // are supported by all kernels with io_uring.
+    slot->iov = (struct iovec){.iov_base = data, .iov_len = size};
+    slot->pending = true;
+
+    // Fill the next submission queue entry. There can never be more requests in flight than slots so there is always a free entry.
+    const unsigned int tail = *this->sqTail;
+    const unsigned int index = tail & *this->sqMask;
+    struct io_uring_sqe *const sqe = &this->sqeList[index];
+
+    memset(sqe, 0, sizeof(struct io_uring_sqe));
+    sqe->opcode = opcode;
+    sqe->fd = fd;
+    sqe->addr = (uint64_t)(uintptr_t)&slot->iov;
+    sqe->len = 1;
+    sqe->off = offset;
+    sqe->user_data = slotIdx;
+
+    this->sqArray[index] = index;
+    __atomic_store_n(this->sqTail, tail + 1, __ATOMIC_RELEASE);
+
+    // Submit the request
+    TRY_BEGIN()
+    {
+        storagePosixUringEnter(this, 1, 0);
+    }
+    CATCH_ANY()
+    {
+        // If the kernel did not consume the entry then pull it back off the queue so it is not submitted by a later enter.
+        // Otherwise the request is in flight and the slot must stay pending so it is waited on.
+        if (__atomic_load_n(this->sqHead, __ATOMIC_ACQUIRE) == tail)
+        {
+            __atomic_store_n(this->sqTail, tail, __ATOMIC_RELEASE);
+            slot->pending = false;
+        }
+
+        RETHROW();
+    }
+    TRY_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+storagePosixUringRead(
+    StoragePosixUring *const this, const unsigned int slotIdx, const int fd, const size_t size, const uint64_t offset)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_POSIX_URING, this);
+        FUNCTION_LOG_PARAM(UINT, slotIdx);
+        FUNCTION_LOG_PARAM(INT, fd);
+        FUNCTION_LOG_PARAM(SIZE, size);
+        FUNCTION_LOG_PARAM(UINT64, offset);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(slotIdx < this->depth);
+    ASSERT(size <= this->slotList[slotIdx].bufferSize);
+
+    storagePosixUringSubmit(this, slotIdx, IORING_OP_READV, fd, this->slotList[slotIdx].buffer, size, offset);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+storagePosixUringWrite(
+    StoragePosixUring *const this, const unsigned int slotIdx, const int fd, const unsigned char *const data, const size_t size,
+    const uint64_t offset)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_POSIX_URING, this);
+        FUNCTION_LOG_PARAM(UINT, slotIdx);
+        FUNCTION_LOG_PARAM(INT, fd);
+        FUNCTION_LOG_PARAM_P(UCHARDATA, data);
+        FUNCTION_LOG_PARAM(SIZE, size);
+        FUNCTION_LOG_PARAM(UINT64, offset);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(slotIdx < this->depth);
+    ASSERT(this->slotList[slotIdx].acquired);
+    ASSERT(!this->slotList[slotIdx].pending);
+    ASSERT(data != NULL);
+
+    StoragePosixUringSlot *const slot = &this->slotList[slotIdx];
+
+    // Grow the buffer if the data will not fit
+    if (size > slot->bufferSize)
+    {
+        MEM_CONTEXT_BEGIN(this->memContext)
+        {
+            slot->buffer = memResize(slot->buffer, size);
+            slot->bufferSize = size;
+        }
+        MEM_CONTEXT_END();
+    }
+
+    memcpy(slot->buffer, data, size);
+    storagePosixUringSubmit(this, slotIdx, IORING_OP_WRITEV, fd, slot->buffer, size, offset);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+int
+storagePosixUringWait(StoragePosixUring *const this, const unsigned int slotIdx)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_POSIX_URING, this);
+        FUNCTION_LOG_PARAM(UINT, slotIdx);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(slotIdx < this->depth);
+    ASSERT(this->slotList[slotIdx].pending);
+
+    // Process completions until the request for the slot completes. Completions for other slots are recorded in their slots.
+    while (this->slotList[slotIdx].pending)
+    {
+        const unsigned int head = *this->cqHead;
+
+        // Wait for a completion if none are available
+        if (head == __atomic_load_n(this->cqTail, __ATOMIC_ACQUIRE))
+        {
+            storagePosixUringEnter(this, 0, 1);
+            continue;
+        }
+
+        const struct io_uring_cqe *const cqe = &this->cqeList[head & *this->cqMask];
+        StoragePosixUringSlot *const slot = &this->slotList[cqe->user_data];
+
+        slot->result = cqe->res;
+        slot->pending = false;
+
+        __atomic_store_n(this->cqHead, head + 1, __ATOMIC_RELEASE);
+    }
+
+    FUNCTION_LOG_RETURN(INT, this->slotList[slotIdx].result);
+}
+
+/**********************************************************************************************************************************/
+size_t
+storagePosixUringSize(const StoragePosixUring *const this, const unsigned int slotIdx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_POSIX_URING, this);
+        FUNCTION_TEST_PARAM(UINT, slotIdx);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+    ASSERT(slotIdx < this->depth);
+
+    FUNCTION_TEST_RETURN(this->slotList[slotIdx].iov.iov_len);
+}
+
+#else
+
+/**********************************************************************************************************************************/
+StoragePosixUring *
+storagePosixUringNew(const unsigned int depth, const size_t bufferSize)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(UINT, depth);
+        FUNCTION_TEST_PARAM(SIZE, bufferSize);
+    FUNCTION_TEST_END();
+
+    FUNCTION_TEST_RETURN(NULL);
+}
+
+// Since the constructor always returns NULL these functions can never be called
+unsigned int
+storagePosixUringAcquire(StoragePosixUring *const this, const unsigned int slotTotal)
+{
+    (void)this; (void)slotTotal;
+    THROW(AssertError, "io_uring is not available");
+}
+
+void
+storagePosixUringRelease(StoragePosixUring *const this, const unsigned int slotIdx, const unsigned int slotTotal)
+{
+    (void)this; (void)slotIdx; (void)slotTotal;
+    THROW(AssertError, "io_uring is not available");
+}
+
+unsigned char *
+storagePosixUringBuffer(const StoragePosixUring *const this, const unsigned int slotIdx)
+{
+    (void)this; (void)slotIdx;
+    THROW(AssertError, "io_uring is not available");
+}
+
+size_t
+storagePosixUringBufferSize(const StoragePosixUring *const this, const unsigned int slotIdx)
+{
+    (void)this; (void)slotIdx;
+    THROW(AssertError, "io_uring is not available");
+}
+
+bool
+storagePosixUringPending(const StoragePosixUring *const this, const unsigned int slotIdx)
+{
+    (void)this; (void)slotIdx;
+    THROW(AssertError, "io_uring is not available");
+}
+
+void
+storagePosixUringRead(
+    StoragePosixUring *const this, const unsigned int slotIdx, const int fd, const size_t size, const uint64_t offset)
+{
+    (void)this; (void)slotIdx; (void)fd; (void)size; (void)offset;
+    THROW(AssertError, "io_uring is not available");
+}
+
+void
+storagePosixUringWrite(
+    StoragePosixUring *const this, const unsigned int slotIdx, const int fd, const unsigned char *const data, const size_t size,
+    const uint64_t offset)
+{
+    (void)this; (void)slotIdx; (void)fd; (void)data; (void)size; (void)offset;
+    THROW(AssertError, "io_uring is not available");
+}
+
+int
+storagePosixUringWait(StoragePosixUring *const this, const unsigned int slotIdx)
+{
+    (void)this; (void)slotIdx;
+    THROW(AssertError, "io_uring is not available");
+}
+
+size_t
+storagePosixUringSize(const StoragePosixUring *const this, const unsigned int slotIdx)
+{
+    (void)this; (void)slotIdx;
+    THROW(AssertError, "io_uring is not available");
+}
+
+#endif
@@ -0,0 +1,93 @@
+/***********************************************************************************************************************************
+Posix Storage io_uring
+
+Queue reads and writes to the kernel with io_uring so they complete asynchronously while the caller does other work, e.g. running
+the filter chain. Each slot in the queue owns a buffer and may have at most one request in flight. The kernel interface is used
+directly so there is no dependency on liburing.
+
+Setting up a ring requires several system calls and mappings so a single ring is created per storage object and shared by the files
+it opens. Each file acquires a group of slots for as long as it is open. When no slots are free the file falls back to blocking I/O.
+
+When io_uring is not available (not compiled in, unsupported by the kernel, or disabled) storagePosixUringNew() returns NULL and
+the caller should fall back to blocking I/O.
+***********************************************************************************************************************************/
+#ifndef STORAGE_POSIX_URING_H
+#define STORAGE_POSIX_URING_H
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+typedef struct StoragePosixUring StoragePosixUring;
+
+#include <limits.h>
+
+#include "common/type/object.h"
+
+/***********************************************************************************************************************************
+Number of slots used by each file for reads and writes and the number of files that can use the queue at the same time
+***********************************************************************************************************************************/
+#define STORAGE_POSIX_URING_DEPTH                                   4
+#define STORAGE_POSIX_URING_FILE_MAX                                8
+
+// Returned by storagePosixUringAcquire() when no slots are free
+#define STORAGE_POSIX_URING_SLOT_NONE                               UINT_MAX
+
+/***********************************************************************************************************************************
+Constructors
+***********************************************************************************************************************************/
+// Create a queue with the specified number of slots, each with a buffer of the specified size. Buffers are allocated when the slot
+// is first acquired. Returns NULL if io_uring is not available.
+StoragePosixUring *storagePosixUringNew(unsigned int depth, size_t bufferSize);
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Acquire a group of slots for a file and return the index of the first slot. Returns STORAGE_POSIX_URING_SLOT_NONE when no group
+// is free or when the queue was created by another process, e.g. before a fork, since the ring is shared with that process.
+unsigned int storagePosixUringAcquire(StoragePosixUring *this, unsigned int slotTotal);
+
+// Release a group of slots. Requests in flight are waited on first and their results discarded. A slot whose request cannot be
+// waited on is never reused since the kernel may still write to its buffer.
+void storagePosixUringRelease(StoragePosixUring *this, unsigned int slotIdx, unsigned int slotTotal);
+
+// Buffer owned by the slot. It must not be modified while a request is in flight.
+unsigned char *storagePosixUringBuffer(const StoragePosixUring *this, unsigned int slotIdx);
+
+// Size of the buffer owned by the slot
+size_t storagePosixUringBufferSize(const StoragePosixUring *this, unsigned int slotIdx);
+
+// Is a request in flight for the slot?
+bool storagePosixUringPending(const StoragePosixUring *this, unsigned int slotIdx);
+
+// Queue a read of size bytes at the offset into the slot buffer
+void storagePosixUringRead(StoragePosixUring *this, unsigned int slotIdx, int fd, size_t size, uint64_t offset);
+
+// Copy data into the slot buffer, which is grown if needed, and queue a write of size bytes at the offset
+void storagePosixUringWrite(
+    StoragePosixUring *this, unsigned int slotIdx, int fd, const unsigned char *data, size_t size, uint64_t offset);
+
+// Wait for the request in the slot to complete and return the result, i.e. bytes transferred or -errno on error
+int storagePosixUringWait(StoragePosixUring *this, unsigned int slotIdx);
+
+// Size of the last request queued for the slot
+size_t storagePosixUringSize(const StoragePosixUring *this, unsigned int slotIdx);
+
+/***********************************************************************************************************************************
+Destructor
+***********************************************************************************************************************************/
+// Requests in flight are waited on before the queue is freed so the kernel does not write to freed memory
+__attribute__((always_inline)) static inline void
+storagePosixUringFree(StoragePosixUring *const this)
+{
+    objFree(this);
+}
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_STORAGE_POSIX_URING_TYPE                                                                                      \
+    StoragePosixUring *
+#define FUNCTION_LOG_STORAGE_POSIX_URING_FORMAT(value, buffer, bufferSize)                                                         \
+    objToLog(value, "StoragePosixUring", buffer, bufferSize)
+
+#endif
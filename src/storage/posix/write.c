@@ -5,16 +5,19 @@ Posix Storage File write
 
 #include <fcntl.h>
 #include <stdio.h>
+#include <string.h>
 #include <unistd.h>
 #include <utime.h>
 
 #include "common/debug.h"
+#include "common/io/io.h"
 #include "common/io/write.h"
 #include "common/log.h"
 #include "common/memContext.h"
 #include "common/type/object.h"
 #include "common/user.h"
 #include "storage/posix/storage.intern.h"
+#include "storage/posix/uring.h"
 #include "storage/posix/write.h"
 #include "storage/write.intern.h"
 
@@ -30,6 +33,16 @@ typedef struct StorageWritePosix
     const String *nameTmp;
     const String *path;
     int fd;                                                         // File descriptor
+
+    bool sparse;                                                    // Skip writing blocks that are all zeroes?
+    bool delta;                                                     // Skip writing blocks that match the existing file?
+    uint64_t preallocate;                                           // Size to preallocate (0 for none)
+    uint64_t offset;                                                // Current offset in the file
+    bool sizeSet;                                                   // Must the file size be set on close?
+
+    StoragePosixUring *uringQueue;                                  // Queue of writes in flight (NULL when not using io_uring)
+    unsigned int uringSlotFirst;                                    // First slot acquired in the queue
+    unsigned int uringSlot;                                         // Next slot to write from (relative to the first slot)
 } StorageWritePosix;
 
 /***********************************************************************************************************************************
@@ -46,8 +59,16 @@ File open constants
 Since open is called more than once use constants to make sure these parameters are always the same
 ***********************************************************************************************************************************/
 #define FILE_OPEN_FLAGS                                             (O_CREAT | O_TRUNC | O_WRONLY)
+#define FILE_OPEN_FLAGS_DELTA                                       (O_CREAT | O_RDWR)
 #define FILE_OPEN_PURPOSE                                           "write"
 
+/***********************************************************************************************************************************
+Size of blocks checked for zeroes when writing sparse files or compared with the existing file when writing deltas. This is the
+default PostgreSQL page size, which is the main reason to write sparse files and deltas, and a multiple of the block size of common
+filesystems so skipped blocks can become holes.
+***********************************************************************************************************************************/
+#define STORAGE_WRITE_POSIX_BLOCK_SIZE                              ((size_t)8192)
+
 /***********************************************************************************************************************************
 Close file descriptor
 ***********************************************************************************************************************************/
@@ -62,6 +83,13 @@ storageWritePosixFreeResource(THIS_VOID)
 
     ASSERT(this != NULL);
 
+    // Release the slots first so writes in flight complete before the file is closed
+    if (this->uringQueue != NULL)
+    {
+        storagePosixUringRelease(this->uringQueue, this->uringSlotFirst, STORAGE_POSIX_URING_DEPTH);
+        this->uringQueue = NULL;
+    }
+
     THROW_ON_SYS_ERROR_FMT(close(this->fd) == -1, FileCloseError, STORAGE_ERROR_WRITE_CLOSE, strZ(this->nameTmp));
 
     FUNCTION_LOG_RETURN_VOID();
@@ -82,8 +110,10 @@ storageWritePosixOpen(THIS_VOID)
     ASSERT(this != NULL);
     ASSERT(this->fd == -1);
 
-    // Open the file
-    this->fd = open(strZ(this->nameTmp), FILE_OPEN_FLAGS, this->interface.modeFile);
+    // Open the file. Deltas must be able to read the existing file and must not truncate it.
+    const int flags = this->delta ? FILE_OPEN_FLAGS_DELTA : FILE_OPEN_FLAGS;
+
+    this->fd = open(strZ(this->nameTmp), flags, this->interface.modeFile);
 
     // Attempt to create the path if it is missing
     if (this->fd == -1 && errno == ENOENT && this->interface.createPath)                                            // {vm_covered}
@@ -92,7 +122,7 @@ storageWritePosixOpen(THIS_VOID)
         storageInterfacePathCreateP(this->storage, this->path, false, false, this->interface.modePath);
 
         // Open file again
-        this->fd = open(strZ(this->nameTmp), FILE_OPEN_FLAGS, this->interface.modeFile);
+        this->fd = open(strZ(this->nameTmp), flags, this->interface.modeFile);
     }
 
     // Handle errors
@@ -107,6 +137,29 @@ storageWritePosixOpen(THIS_VOID)
     // Set free callback to ensure the file descriptor is freed
     memContextCallbackSet(this->memContext, storageWritePosixFreeResource, this);
 
+    // Preallocate space for the file. Errors are ignored since preallocation is only an optimization and not all filesystems
+    // support it. The file size will be set on close in case less data is written than was preallocated.
+#ifdef HAVE_POSIX_FALLOCATE
+    if (this->preallocate != 0 && posix_fallocate(this->fd, 0, (off_t)this->preallocate) == 0)
+        this->sizeSet = true;
+#endif
+
+    // The existing file may be larger than the new file so the size must be set on close
+    if (this->delta)
+        this->sizeSet = true;
+
+    // Queue writes with io_uring when available and there are free slots in the storage queue so they complete while the caller
+    // prepares more data
+    StoragePosixUring *const uringQueue = storagePosixUringQueue(this->storage);
+
+    if (uringQueue != NULL)
+    {
+        this->uringSlotFirst = storagePosixUringAcquire(uringQueue, STORAGE_POSIX_URING_DEPTH);
+
+        if (this->uringSlotFirst != STORAGE_POSIX_URING_SLOT_NONE)
+            this->uringQueue = uringQueue;
+    }
+
     // Update user/group owner
     if (this->interface.user != NULL || this->interface.group != NULL)
     {
@@ -128,6 +181,165 @@ storageWritePosixOpen(THIS_VOID)
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/***********************************************************************************************************************************
+Is the data all zeroes?
+***********************************************************************************************************************************/
+static bool
+storageWritePosixZero(const unsigned char *const data, const size_t size)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(UCHARDATA, data);
+        FUNCTION_TEST_PARAM(SIZE, size);
+    FUNCTION_TEST_END();
+
+    FUNCTION_TEST_RETURN(size == 0 || (data[0] == 0 && memcmp(data, data + 1, size - 1) == 0));
+}
+
+/***********************************************************************************************************************************
+Can writing the block be skipped? For sparse writes the block must be all zeroes. For deltas the block must match the existing file,
+where data past the end of the existing file reads as zeroes since the file will be extended on close.
+***********************************************************************************************************************************/
+static bool
+storageWritePosixSkip(
+    StorageWritePosix *const this, const unsigned char *const block, const size_t blockSize, const uint64_t blockOffset)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE_POSIX, this);
+        FUNCTION_LOG_PARAM_P(UCHARDATA, block);
+        FUNCTION_LOG_PARAM(SIZE, blockSize);
+        FUNCTION_LOG_PARAM(UINT64, blockOffset);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(block != NULL);
+    ASSERT(blockSize <= STORAGE_WRITE_POSIX_BLOCK_SIZE);
+
+    bool result;
+
+    if (this->delta)
+    {
+        unsigned char existing[STORAGE_WRITE_POSIX_BLOCK_SIZE];
+        const ssize_t existingSize = pread(this->fd, existing, blockSize, (off_t)blockOffset);
+
+        THROW_ON_SYS_ERROR_FMT(existingSize == -1, FileReadError, "unable to read '%s'", strZ(this->nameTmp));
+
+        result =
+            memcmp(block, existing, (size_t)existingSize) == 0 &&
+            storageWritePosixZero(block + existingSize, blockSize - (size_t)existingSize);
+    }
+    else
+        result = storageWritePosixZero(block, blockSize);
+
+    FUNCTION_LOG_RETURN(BOOL, result);
+}
+
+/***********************************************************************************************************************************
+Wait for the write queued in a slot to complete and check that all the data was written
+***********************************************************************************************************************************/
+static void
+storageWritePosixUringWait(StorageWritePosix *const this, const unsigned int slotIdx)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE_POSIX, this);
+        FUNCTION_LOG_PARAM(UINT, slotIdx);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->uringQueue != NULL);
+    ASSERT(slotIdx < STORAGE_POSIX_URING_DEPTH);
+
+    const unsigned int slotIdxQueue = this->uringSlotFirst + slotIdx;
+
+    if (storagePosixUringPending(this->uringQueue, slotIdxQueue))
+    {
+        const int result = storagePosixUringWait(this->uringQueue, slotIdxQueue);
+
+        if (result < 0)
+        {
+            errno = -result;
+            THROW_SYS_ERROR_FMT(FileWriteError, "unable to write '%s'", strZ(this->nameTmp));
+        }
+
+        if ((size_t)result != storagePosixUringSize(this->uringQueue, slotIdxQueue))
+        {
+            THROW_FMT(
+                FileWriteError, "unable to write '%s': %d of %zu byte(s) written", strZ(this->nameTmp), result,
+                storagePosixUringSize(this->uringQueue, slotIdxQueue));
+        }
+    }
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Write data at the current offset. With io_uring the data is copied into the next free slot and the write completes asynchronously.
+***********************************************************************************************************************************/
+static void
+storageWritePosixData(StorageWritePosix *const this, const unsigned char *const data, const size_t size)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE_POSIX, this);
+        FUNCTION_LOG_PARAM_P(UCHARDATA, data);
+        FUNCTION_LOG_PARAM(SIZE, size);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(data != NULL);
+
+    if (this->uringQueue != NULL)
+    {
+        // Wait for the slot to be free
+        storageWritePosixUringWait(this, this->uringSlot);
+
+        // Copy data to the slot and queue the write
+        storagePosixUringWrite(this->uringQueue, this->uringSlotFirst + this->uringSlot, this->fd, data, size, this->offset);
+        this->uringSlot = (this->uringSlot + 1) % STORAGE_POSIX_URING_DEPTH;
+    }
+    else if (write(this->fd, data, size) != (ssize_t)size)
+        THROW_SYS_ERROR_FMT(FileWriteError, "unable to write '%s'", strZ(this->nameTmp));
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Write a run of data to the file, or seek over it when the run can be skipped
+***********************************************************************************************************************************/
+static void
+storageWritePosixRun(StorageWritePosix *const this, const unsigned char *const data, const size_t size, const bool skip)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_WRITE_POSIX, this);
+        FUNCTION_LOG_PARAM_P(UCHARDATA, data);
+        FUNCTION_LOG_PARAM(SIZE, size);
+        FUNCTION_LOG_PARAM(BOOL, skip);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(data != NULL);
+
+    if (skip)
+    {
+        // No need to seek when using io_uring since writes are made at an offset rather than at the current file position
+        if (this->uringQueue == NULL)
+        {
+            THROW_ON_SYS_ERROR_FMT(
+                lseek(this->fd, (off_t)size, SEEK_CUR) == -1, FileWriteError, "unable to seek in '%s'", strZ(this->nameTmp));
+        }
+
+        // The file size must be set on close since seeking past the end does not extend the file
+        this->sizeSet = true;
+    }
+    else
+    {
+        storageWritePosixData(this, data, size);
+        this->interface.deltaMatch = false;
+    }
+
+    this->offset += size;
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
 /***********************************************************************************************************************************
 Write to the file
 ***********************************************************************************************************************************/
@@ -146,8 +358,43 @@ storageWritePosix(THIS_VOID, const Buffer *buffer)
     ASSERT(this->fd != -1);
 
     // Write the data
-    if (write(this->fd, bufPtrConst(buffer), bufUsed(buffer)) != (ssize_t)bufUsed(buffer))
-        THROW_SYS_ERROR_FMT(FileWriteError, "unable to write '%s'", strZ(this->nameTmp));
+    if (!this->sparse && !this->delta)
+    {
+        storageWritePosixData(this, bufPtrConst(buffer), bufUsed(buffer));
+        this->offset += bufUsed(buffer);
+    }
+    // Else split the data into blocks aligned with the file and skip blocks that are all zeroes (sparse) or match the existing file
+    // (delta). Consecutive blocks of the same kind are combined into runs to minimize system calls. Partial blocks at the beginning
+    // and end of the buffer are checked as well since skipping is always safe, even when the block is not a full filesystem block.
+    else
+    {
+        const unsigned char *const data = bufPtrConst(buffer);
+        const uint64_t offset = this->offset;
+        size_t runBegin = 0;
+        bool runSkip = false;
+
+        for (size_t blockBegin = 0; blockBegin < bufUsed(buffer);)
+        {
+            const size_t blockRemains =
+                STORAGE_WRITE_POSIX_BLOCK_SIZE - (size_t)((offset + blockBegin) % STORAGE_WRITE_POSIX_BLOCK_SIZE);
+            const size_t blockSize =
+                bufUsed(buffer) - blockBegin < blockRemains ? bufUsed(buffer) - blockBegin : blockRemains;
+            const bool blockSkip = storageWritePosixSkip(this, data + blockBegin, blockSize, offset + blockBegin);
+
+            // Write the prior run when the kind of block changes
+            if (blockBegin != runBegin && blockSkip != runSkip)
+            {
+                storageWritePosixRun(this, data + runBegin, blockBegin - runBegin, runSkip);
+                runBegin = blockBegin;
+            }
+
+            runSkip = blockSkip;
+            blockBegin += blockSize;
+        }
+
+        // Write the last run
+        storageWritePosixRun(this, data + runBegin, bufUsed(buffer) - runBegin, runSkip);
+    }
 
     FUNCTION_LOG_RETURN_VOID();
 }
@@ -169,6 +416,24 @@ storageWritePosixClose(THIS_VOID)
     // Close if the file has not already been closed
     if (this->fd != -1)
     {
+        // Wait for queued writes to complete
+        if (this->uringQueue != NULL)
+        {
+            for (unsigned int slotIdx = 0; slotIdx < STORAGE_POSIX_URING_DEPTH; slotIdx++)
+                storageWritePosixUringWait(this, (this->uringSlot + slotIdx) % STORAGE_POSIX_URING_DEPTH);
+
+            storagePosixUringRelease(this->uringQueue, this->uringSlotFirst, STORAGE_POSIX_URING_DEPTH);
+            this->uringQueue = NULL;
+        }
+
+        // Set the file size when blocks at the end were skipped, more space was preallocated than was written, or the existing file
+        // was larger for a delta
+        if (this->sizeSet)
+        {
+            THROW_ON_SYS_ERROR_FMT(
+                ftruncate(this->fd, (off_t)this->offset) == -1, FileWriteError, "unable to truncate '%s'", strZ(this->nameTmp));
+        }
+
         // Sync the file
         if (this->interface.syncFile)
             THROW_ON_SYS_ERROR_FMT(fsync(this->fd) == -1, FileSyncError, STORAGE_ERROR_WRITE_SYNC, strZ(this->nameTmp));
@@ -224,7 +489,8 @@ storageWritePosixFd(const THIS_VOID)
 StorageWrite *
 storageWritePosixNew(
     StoragePosix *storage, const String *name, mode_t modeFile, mode_t modePath, const String *user, const String *group,
-    time_t timeModified, bool createPath, bool syncFile, bool syncPath, bool atomic)
+    time_t timeModified, bool createPath, bool syncFile, bool syncPath, bool atomic, bool sparse, bool delta,
+    uint64_t preallocate)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(STORAGE_POSIX, storage);
@@ -238,6 +504,9 @@ storageWritePosixNew(
         FUNCTION_LOG_PARAM(BOOL, syncFile);
         FUNCTION_LOG_PARAM(BOOL, syncPath);
         FUNCTION_LOG_PARAM(BOOL, atomic);
+        FUNCTION_LOG_PARAM(BOOL, sparse);
+        FUNCTION_LOG_PARAM(BOOL, delta);
+        FUNCTION_LOG_PARAM(UINT64, preallocate);
     FUNCTION_LOG_END();
 
     ASSERT(storage != NULL);
@@ -257,6 +526,9 @@ storageWritePosixNew(
             .storage = storage,
             .path = strPath(name),
             .fd = -1,
+            .sparse = sparse,
+            .delta = delta,
+            .preallocate = preallocate,
 
             .interface = (StorageWriteInterface)
             {
@@ -271,6 +543,7 @@ storageWritePosixNew(
                 .syncPath = syncPath,
                 .user = strDup(user),
                 .timeModified = timeModified,
+                .deltaMatch = delta,
 
                 .ioInterface = (IoWriteInterface)
                 {
@@ -0,0 +1,375 @@
+/***********************************************************************************************************************************
+Storage Range Read
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include "common/debug.h"
+#include "common/io/io.h"
+#include "common/log.h"
+#include "common/memContext.h"
+#include "common/type/convert.h"
+#include "common/type/list.h"
+#include "common/type/stringList.h"
+#include "storage/rangeRead.h"
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+typedef struct StorageRangeReadRequest
+{
+    HttpRequest *request;                                           // Async request
+    uint64_t offset;                                                // Offset of the range requested
+    uint64_t size;                                                  // Size of the range requested
+} StorageRangeReadRequest;
+
+struct StorageRangeRead
+{
+    MemContext *memContext;                                         // Object mem context
+    void *driver;                                                   // Driver to pass to callbacks
+    StorageRangeReadRequestCallback *requestCallback;               // Send an async range request
+    StorageRangeReadResponseCallback *responseCallback;             // Get the response for an async range request
+    const String *versionHeader;                                    // Response header with the object version
+
+    uint64_t offset;                                                // Where to start reading
+    const Variant *limit;                                           // Limit how many bytes are read (NULL for no limit)
+    uint64_t rangeSize;                                             // Size of each range (0 to read with a single request)
+    unsigned int rangeMax;                                          // Max ranges in flight, including the range being read
+
+    const String *version;                                          // Object version from the first response (NULL if none)
+    uint64_t size;                                                  // Object size from the first response
+    uint64_t rangeNext;                                             // Offset of the next range to request
+    uint64_t rangeEnd;                                              // Offset where ranges end
+    List *requestList;                                              // Range requests in flight in the order sent
+    HttpResponse *response;                                         // Response for the range being read
+};
+
+/**********************************************************************************************************************************/
+StorageRangeRead *
+storageRangeReadNew(
+    void *const driver, StorageRangeReadRequestCallback *const requestCallback,
+    StorageRangeReadResponseCallback *const responseCallback, const String *const versionHeader, const uint64_t offset,
+    const Variant *const limit, const uint64_t rangeSize, const unsigned int rangeMax)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM_P(VOID, driver);
+        FUNCTION_LOG_PARAM(FUNCTIONP, requestCallback);
+        FUNCTION_LOG_PARAM(FUNCTIONP, responseCallback);
+        FUNCTION_LOG_PARAM(STRING, versionHeader);
+        FUNCTION_LOG_PARAM(UINT64, offset);
+        FUNCTION_LOG_PARAM(VARIANT, limit);
+        FUNCTION_LOG_PARAM(UINT64, rangeSize);
+        FUNCTION_LOG_PARAM(UINT, rangeMax);
+    FUNCTION_LOG_END();
+
+    ASSERT(driver != NULL);
+    ASSERT(requestCallback != NULL);
+    ASSERT(responseCallback != NULL);
+    ASSERT(versionHeader != NULL);
+    ASSERT(limit == NULL || varType(limit) == varTypeUInt64);
+    ASSERT(rangeMax > 0);
+
+    StorageRangeRead *this = NULL;
+
+    MEM_CONTEXT_NEW_BEGIN("StorageRangeRead")
+    {
+        this = memNew(sizeof(StorageRangeRead));
+
+        *this = (StorageRangeRead)
+        {
+            .memContext = MEM_CONTEXT_NEW(),
+            .driver = driver,
+            .requestCallback = requestCallback,
+            .responseCallback = responseCallback,
+            .versionHeader = versionHeader,
+            .offset = offset,
+            .limit = varDup(limit),
+            .rangeSize = rangeSize,
+            .rangeMax = rangeMax,
+            .requestList = lstNewP(sizeof(StorageRangeReadRequest)),
+        };
+    }
+    MEM_CONTEXT_NEW_END();
+
+    FUNCTION_LOG_RETURN(STORAGE_RANGE_READ, this);
+}
+
+/***********************************************************************************************************************************
+Send a request and add it to the list of requests in flight
+***********************************************************************************************************************************/
+static void
+storageRangeReadRequestAdd(StorageRangeRead *const this, const uint64_t offset, const Variant *const limit)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_RANGE_READ, this);
+        FUNCTION_LOG_PARAM(UINT64, offset);
+        FUNCTION_LOG_PARAM(VARIANT, limit);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    MEM_CONTEXT_BEGIN(lstMemContext(this->requestList))
+    {
+        const StorageRangeReadRequest request =
+        {
+            .request = this->requestCallback(this->driver, offset, limit, this->version),
+            .offset = offset,
+            .size = limit == NULL ? 0 : varUInt64(limit),
+        };
+
+        lstAdd(this->requestList, &request);
+    }
+    MEM_CONTEXT_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Request the next range
+***********************************************************************************************************************************/
+static void
+storageRangeReadRequest(StorageRangeRead *const this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_RANGE_READ, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->rangeNext < this->rangeEnd);
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        const uint64_t size =
+            this->rangeEnd - this->rangeNext < this->rangeSize ? this->rangeEnd - this->rangeNext : this->rangeSize;
+
+        storageRangeReadRequestAdd(this, this->rangeNext, varNewUInt64(size));
+        this->rangeNext += size;
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Request ranges until the max ranges are in flight or there are no more ranges
+***********************************************************************************************************************************/
+static void
+storageRangeReadRequestFill(StorageRangeRead *const this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_RANGE_READ, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    // The range being read counts as in flight
+    while (lstSize(this->requestList) + 1 < this->rangeMax && this->rangeNext < this->rangeEnd)
+        storageRangeReadRequest(this);
+
+    FUNCTION_LOG_RETURN_VOID();
+}
+
+/***********************************************************************************************************************************
+Check that the response is for the range requested and return the total size of the object. The end of the range may be before the
+end requested only when the range ends at the end of the object.
+***********************************************************************************************************************************/
+static uint64_t
+storageRangeReadResponseRange(const HttpResponse *const response, const uint64_t offset, const uint64_t size)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(HTTP_RESPONSE, response);
+        FUNCTION_LOG_PARAM(UINT64, offset);
+        FUNCTION_LOG_PARAM(UINT64, size);
+    FUNCTION_LOG_END();
+
+    ASSERT(response != NULL);
+    ASSERT(size > 0);
+
+    uint64_t result = 0;
+
+    if (httpResponseCode(response) != HTTP_RESPONSE_CODE_PARTIAL_CONTENT)
+    {
+        THROW_FMT(
+            ProtocolError, "expected response %d for range %" PRIu64 "-%" PRIu64 " but got %u", HTTP_RESPONSE_CODE_PARTIAL_CONTENT,
+            offset, offset + size - 1, httpResponseCode(response));
+    }
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Parse content-range, e.g. bytes 0-1023/4096
+        const String *const contentRange = httpHeaderGet(httpResponseHeader(response), HTTP_HEADER_CONTENT_RANGE_STR);
+        uint64_t rangeStart = 0;
+        uint64_t rangeLast = 0;
+
+        if (contentRange == NULL || !strBeginsWithZ(contentRange, HTTP_HEADER_CONTENT_RANGE_BYTES " "))
+            THROW_FMT(FormatError, "invalid " HTTP_HEADER_CONTENT_RANGE " '%s'", strZNull(contentRange));
+
+        const StringList *const rangeTotal = strLstNewSplitZ(
+            strSub(contentRange, sizeof(HTTP_HEADER_CONTENT_RANGE_BYTES)), "/");
+        const StringList *const startLast = strLstNewSplitZ(strLstGet(rangeTotal, 0), "-");
+
+        if (strLstSize(rangeTotal) != 2 || strLstSize(startLast) != 2)
+            THROW_FMT(FormatError, "invalid " HTTP_HEADER_CONTENT_RANGE " '%s'", strZ(contentRange));
+
+        rangeStart = cvtZToUInt64(strZ(strLstGet(startLast, 0)));
+        rangeLast = cvtZToUInt64(strZ(strLstGet(startLast, 1)));
+        result = cvtZToUInt64(strZ(strLstGet(rangeTotal, 1)));
+
+        // The range must start where requested and end where requested or at the end of the object
+        if (rangeStart != offset || rangeLast < rangeStart || rangeLast > offset + size - 1 ||
+            (rangeLast != offset + size - 1 && rangeLast + 1 != result))
+        {
+            THROW_FMT(
+                FormatError, HTTP_HEADER_CONTENT_RANGE " '%s' does not match range %" PRIu64 "-%" PRIu64, strZ(contentRange),
+                offset, offset + size - 1);
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(UINT64, result);
+}
+
+/***********************************************************************************************************************************
+Get the response for the oldest request
+***********************************************************************************************************************************/
+static HttpResponse *
+storageRangeReadResponse(StorageRangeRead *const this, const bool allowMissing, const bool allowRangeInvalid)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_RANGE_READ, this);
+        FUNCTION_LOG_PARAM(BOOL, allowMissing);
+        FUNCTION_LOG_PARAM(BOOL, allowRangeInvalid);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(!lstEmpty(this->requestList));
+
+    HttpRequest *const request = ((StorageRangeReadRequest *)lstGet(this->requestList, 0))->request;
+
+    MEM_CONTEXT_BEGIN(this->memContext)
+    {
+        httpResponseFree(this->response);
+        this->response = this->responseCallback(this->driver, request, allowMissing, allowRangeInvalid);
+    }
+    MEM_CONTEXT_END();
+
+    httpRequestFree(request);
+    lstRemoveIdx(this->requestList, 0);
+
+    FUNCTION_LOG_RETURN(HTTP_RESPONSE, this->response);
+}
+
+/**********************************************************************************************************************************/
+HttpResponse *
+storageRangeReadOpen(StorageRangeRead *const this)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_RANGE_READ, this);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+    ASSERT(this->response == NULL);
+
+    HttpResponse *result = NULL;
+
+    MEM_CONTEXT_TEMP_BEGIN()
+    {
+        // Request the first range
+        if (this->rangeSize != 0)
+        {
+            const uint64_t size = this->limit != NULL && varUInt64(this->limit) < this->rangeSize ?
+                varUInt64(this->limit) : this->rangeSize;
+
+            storageRangeReadRequestAdd(this, this->offset, varNewUInt64(size));
+            result = storageRangeReadResponse(this, true, true);
+
+            // If the range is valid then set the end of the ranges from the object size and request more ranges
+            if (httpResponseCodeOk(result))
+            {
+                const uint64_t objectSize = storageRangeReadResponseRange(result, this->offset, size);
+
+                this->rangeNext = this->offset + size;
+                this->rangeEnd =
+                    this->limit != NULL && this->offset + varUInt64(this->limit) < objectSize ?
+                        this->offset + varUInt64(this->limit) : objectSize;
+
+                this->size = objectSize;
+
+                MEM_CONTEXT_BEGIN(this->memContext)
+                {
+                    this->version = strDup(httpHeaderGet(httpResponseHeader(result), this->versionHeader));
+                }
+                MEM_CONTEXT_END();
+
+                storageRangeReadRequestFill(this);
+            }
+            // Else the range is not valid so request the entire read to get the same result as a read without ranges
+            else if (httpResponseCode(result) == HTTP_RESPONSE_CODE_RANGE_NOT_SATISFIABLE)
+                result = NULL;
+        }
+
+        // Request the entire read
+        if (result == NULL)
+        {
+            storageRangeReadRequestAdd(this, this->offset, this->limit);
+            result = storageRangeReadResponse(this, true, false);
+        }
+    }
+    MEM_CONTEXT_TEMP_END();
+
+    FUNCTION_LOG_RETURN(HTTP_RESPONSE, result);
+}
+
+/**********************************************************************************************************************************/
+size_t
+storageRangeRead(StorageRangeRead *const this, Buffer *const buffer)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_RANGE_READ, this);
+        FUNCTION_LOG_PARAM(BUFFER, buffer);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL && this->response != NULL);
+    ASSERT(buffer != NULL && !bufFull(buffer));
+
+    size_t result = 0;
+
+    while (!bufFull(buffer) && !storageRangeReadEof(this))
+    {
+        // If the range being read is complete then move to the next range
+        if (ioReadEof(httpResponseIoRead(this->response)))
+        {
+            if (lstEmpty(this->requestList))
+                storageRangeReadRequest(this);
+
+            const StorageRangeReadRequest request = *(StorageRangeReadRequest *)lstGet(this->requestList, 0);
+
+            // The object size must not change between ranges. This is also enforced by the version precondition when the object
+            // has a version, but the version header may be missing, e.g. on some S3-compatible storage.
+            const uint64_t size = storageRangeReadResponseRange(
+                storageRangeReadResponse(this, false, false), request.offset, request.size);
+
+            if (size != this->size)
+                THROW_FMT(FormatError, "object size changed from %" PRIu64 " to %" PRIu64 " during range read", this->size, size);
+
+            storageRangeReadRequestFill(this);
+        }
+
+        result += ioRead(httpResponseIoRead(this->response), buffer);
+    }
+
+    FUNCTION_LOG_RETURN(SIZE, result);
+}
+
+/**********************************************************************************************************************************/
+bool
+storageRangeReadEof(const StorageRangeRead *const this)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE_RANGE_READ, this);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL && this->response != NULL);
+
+    FUNCTION_TEST_RETURN(
+        ioReadEof(httpResponseIoRead(this->response)) && lstEmpty(this->requestList) && this->rangeNext >= this->rangeEnd);
+}
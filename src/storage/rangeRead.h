@@ -0,0 +1,87 @@
+/***********************************************************************************************************************************
+Storage Range Read
+
+Read an object from HTTP-based storage as a sequence of byte ranges. Multiple ranges can be requested concurrently, each on its own
+HTTP session, but responses are read in order so the caller sees the same stream of bytes as it would from a single request.
+
+Every request, including the first, is for a single range and the response must be 206 (partial content) with a content-range
+that matches the range requested, so a server that ignores or truncates a range cannot silently corrupt the stream. The total size
+in the content-range of the first response determines how many more ranges are requested. The version of the object returned by the
+first response (e.g. the ETag) is passed to every later request so the driver can require it with a precondition, which means an
+object that is overwritten during the read errors rather than returning a mix of old and new content.
+
+If the first range is not satisfiable (e.g. a zero-length object) then the read is requested again without ranges so missing,
+zero-length, and out-of-bounds reads behave exactly as they do without range reads.
+***********************************************************************************************************************************/
+#ifndef STORAGE_RANGE_READ_H
+#define STORAGE_RANGE_READ_H
+
+/***********************************************************************************************************************************
+Object type
+***********************************************************************************************************************************/
+typedef struct StorageRangeRead StorageRangeRead;
+
+#include "common/io/http/request.h"
+#include "common/io/http/response.h"
+#include "common/type/buffer.h"
+#include "common/type/object.h"
+#include "common/type/string.h"
+#include "common/type/variant.h"
+
+/***********************************************************************************************************************************
+Default range size when ranges are read concurrently
+***********************************************************************************************************************************/
+#define STORAGE_RANGE_READ_SIZE_DEFAULT                             ((uint64_t)8 * 1024 * 1024)
+
+/***********************************************************************************************************************************
+Callbacks used to request ranges from the storage driver
+***********************************************************************************************************************************/
+// Send an async request for the range. A NULL limit means read to the end of the object. When version is not NULL the request must
+// fail unless the object version matches, e.g. with an If-Match header.
+typedef HttpRequest *StorageRangeReadRequestCallback(void *driver, uint64_t offset, const Variant *limit, const String *version);
+
+// Get the response for an async range request. When allowMissing is true a missing object should not throw an error and when
+// allowRangeInvalid is true a range that is not satisfiable should not throw an error.
+typedef HttpResponse *StorageRangeReadResponseCallback(
+    void *driver, HttpRequest *request, bool allowMissing, bool allowRangeInvalid);
+
+/***********************************************************************************************************************************
+Constructors
+***********************************************************************************************************************************/
+// A rangeSize of zero disables range reads so the object (or requested part of the object) is read with a single request. The
+// versionHeader is the response header that identifies the object version passed to the request callback.
+StorageRangeRead *storageRangeReadNew(
+    void *driver, StorageRangeReadRequestCallback *requestCallback, StorageRangeReadResponseCallback *responseCallback,
+    const String *versionHeader, uint64_t offset, const Variant *limit, uint64_t rangeSize, unsigned int rangeMax);
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Send the first request and return the response so the caller can check for a missing object. Further ranges are requested only
+// when the response is ok.
+HttpResponse *storageRangeReadOpen(StorageRangeRead *this);
+
+// Read ranges into the buffer
+size_t storageRangeRead(StorageRangeRead *this, Buffer *buffer);
+
+// Have all ranges been read?
+bool storageRangeReadEof(const StorageRangeRead *this);
+
+/***********************************************************************************************************************************
+Destructor
+***********************************************************************************************************************************/
+__attribute__((always_inline)) static inline void
+storageRangeReadFree(StorageRangeRead *const this)
+{
+    objFree(this);
+}
+
+/***********************************************************************************************************************************
+Macros for function logging
+***********************************************************************************************************************************/
+#define FUNCTION_LOG_STORAGE_RANGE_READ_TYPE                                                                                       \
+    StorageRangeRead *
+#define FUNCTION_LOG_STORAGE_RANGE_READ_FORMAT(value, buffer, bufferSize)                                                          \
+    objToLog(value, "StorageRangeRead", buffer, bufferSize)
+
+#endif
@@ -54,6 +54,13 @@ storageReadLimit(const StorageRead *const this)
     return THIS_PUB(StorageRead)->interface->limit;
 }
 
+// Where to start reading in the file
+__attribute__((always_inline)) static inline uint64_t
+storageReadOffset(const StorageRead *const this)
+{
+    return THIS_PUB(StorageRead)->interface->offset;
+}
+
 // File name
 __attribute__((always_inline)) static inline const String *
 storageReadName(const StorageRead *const this)
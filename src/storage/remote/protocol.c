@@ -3,6 +3,7 @@ Remote Storage Protocol Handler
 ***********************************************************************************************************************************/
 #include "build.auto.h"
 
+#include "command/backup/analyze.h"
 #include "command/backup/pageChecksum.h"
 #include "common/compress/helper.h"
 #include "common/crypto/cipherBlock.h"
@@ -55,6 +56,8 @@ storageRemoteFilterGroup(IoFilterGroup *filterGroup, const Variant *filterList)
 
         if (filter != NULL)
             ioFilterGroupAdd(filterGroup, filter);
+        else if (strEq(filterKey, BACKUP_ANALYZE_FILTER_TYPE_STR))
+            ioFilterGroupAdd(filterGroup, backupAnalyzeNewVar(filterParam));
         else if (strEq(filterKey, CIPHER_BLOCK_FILTER_TYPE_STR))
             ioFilterGroupAdd(filterGroup, cipherBlockNewVar(filterParam));
         else if (strEq(filterKey, CRYPTO_HASH_FILTER_TYPE_STR))
@@ -339,12 +342,15 @@ storageRemoteOpenReadProtocol(PackRead *const param, ProtocolServer *const serve
     {
         const String *file = pckReadStrP(param);
         bool ignoreMissing = pckReadBoolP(param);
+        const bool noCache = pckReadBoolP(param);
+        const uint64_t offset = pckReadU64P(param);
         const Variant *limit = jsonToVar(pckReadStrP(param));
         const Variant *filter = jsonToVar(pckReadStrP(param));
 
         // Create the read object
         IoRead *fileRead = storageReadIo(
-            storageInterfaceNewReadP(storageRemoteProtocolLocal.driver, file, ignoreMissing, .limit = limit));
+            storageInterfaceNewReadP(
+                storageRemoteProtocolLocal.driver, file, ignoreMissing, .noCache = noCache, .offset = offset, .limit = limit));
 
         // Set filter group based on passed filters
         storageRemoteFilterGroup(ioReadFilterGroup(fileRead), filter);
@@ -9,6 +9,7 @@ S3 Storage Read
 #include "common/memContext.h"
 #include "common/type/object.h"
 #include "storage/s3/read.h"
+#include "storage/rangeRead.h"
 #include "storage/read.intern.h"
 
 /***********************************************************************************************************************************
@@ -23,7 +24,9 @@ typedef struct StorageReadS3
     StorageReadInterface interface;                                 // Interface
     StorageS3 *storage;                                             // Storage that created this object
 
-    HttpResponse *httpResponse;                                     // HTTP response
+    uint64_t rangeSize;                                             // Size of each range (0 to read with a single request)
+    unsigned int rangeMax;                                          // Max ranges requested concurrently
+    StorageRangeRead *rangeRead;                                    // Range read
 } StorageReadS3;
 
 /***********************************************************************************************************************************
@@ -34,6 +37,51 @@ Macros for function logging
 #define FUNCTION_LOG_STORAGE_READ_S3_FORMAT(value, buffer, bufferSize)                                                             \
     objToLog(value, "StorageReadS3", buffer, bufferSize)
 
+/***********************************************************************************************************************************
+Request a range of the file and get the response
+***********************************************************************************************************************************/
+static HttpRequest *
+storageReadS3RangeRequest(void *const driver, const uint64_t offset, const Variant *const limit, const String *const version)
+{
+    StorageReadS3 *const this = driver;
+
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM(STORAGE_READ_S3, this);
+        FUNCTION_LOG_PARAM(UINT64, offset);
+        FUNCTION_LOG_PARAM(VARIANT, limit);
+        FUNCTION_LOG_PARAM(STRING, version);
+    FUNCTION_LOG_END();
+
+    ASSERT(this != NULL);
+
+    HttpHeader *const header = httpHeaderPutRange(httpHeaderNew(NULL), offset, limit);
+
+    if (version != NULL)
+        httpHeaderPut(header, HTTP_HEADER_IF_MATCH_STR, version);
+
+    FUNCTION_LOG_RETURN(
+        HTTP_REQUEST, storageS3RequestAsyncP(this->storage, HTTP_VERB_GET_STR, this->interface.name, .header = header));
+}
+
+static HttpResponse *
+storageReadS3RangeResponse(
+    void *const driver, HttpRequest *const request, const bool allowMissing, const bool allowRangeInvalid)
+{
+    FUNCTION_LOG_BEGIN(logLevelTrace);
+        FUNCTION_LOG_PARAM_P(VOID, driver);
+        FUNCTION_LOG_PARAM(HTTP_REQUEST, request);
+        FUNCTION_LOG_PARAM(BOOL, allowMissing);
+        FUNCTION_LOG_PARAM(BOOL, allowRangeInvalid);
+    FUNCTION_LOG_END();
+
+    ASSERT(driver != NULL);
+    ASSERT(request != NULL);
+
+    FUNCTION_LOG_RETURN(
+        HTTP_RESPONSE,
+        storageS3ResponseP(request, .allowMissing = allowMissing, .allowRangeInvalid = allowRangeInvalid, .contentIo = true));
+}
+
 /***********************************************************************************************************************************
 Open the file
 ***********************************************************************************************************************************/
@@ -47,19 +95,20 @@ storageReadS3Open(THIS_VOID)
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
-    ASSERT(this->httpResponse == NULL);
+    ASSERT(this->rangeRead == NULL);
 
     bool result = false;
 
     // Request the file
     MEM_CONTEXT_BEGIN(this->memContext)
     {
-        this->httpResponse = storageS3RequestP(
-            this->storage, HTTP_VERB_GET_STR, this->interface.name, .allowMissing = true, .contentIo = true);
+        this->rangeRead = storageRangeReadNew(
+            this, storageReadS3RangeRequest, storageReadS3RangeResponse, HTTP_HEADER_ETAG_STR,
+            this->interface.offset, this->interface.limit, this->rangeSize, this->rangeMax);
     }
     MEM_CONTEXT_END();
 
-    if (httpResponseCodeOk(this->httpResponse))
+    if (httpResponseCodeOk(storageRangeReadOpen(this->rangeRead)))
     {
         result = true;
     }
@@ -84,11 +133,10 @@ storageReadS3(THIS_VOID, Buffer *buffer, bool block)
         FUNCTION_LOG_PARAM(BOOL, block);
     FUNCTION_LOG_END();
 
-    ASSERT(this != NULL && this->httpResponse != NULL);
-    ASSERT(httpResponseIoRead(this->httpResponse) != NULL);
+    ASSERT(this != NULL && this->rangeRead != NULL);
     ASSERT(buffer != NULL && !bufFull(buffer));
 
-    FUNCTION_LOG_RETURN(SIZE, ioRead(httpResponseIoRead(this->httpResponse), buffer));
+    FUNCTION_LOG_RETURN(SIZE, storageRangeRead(this->rangeRead, buffer));
 }
 
 /***********************************************************************************************************************************
@@ -103,24 +151,30 @@ storageReadS3Eof(THIS_VOID)
         FUNCTION_TEST_PARAM(STORAGE_READ_S3, this);
     FUNCTION_TEST_END();
 
-    ASSERT(this != NULL && this->httpResponse != NULL);
-    ASSERT(httpResponseIoRead(this->httpResponse) != NULL);
+    ASSERT(this != NULL && this->rangeRead != NULL);
 
-    FUNCTION_TEST_RETURN(ioReadEof(httpResponseIoRead(this->httpResponse)));
+    FUNCTION_TEST_RETURN(storageRangeReadEof(this->rangeRead));
 }
 
 /**********************************************************************************************************************************/
 StorageRead *
-storageReadS3New(StorageS3 *storage, const String *name, bool ignoreMissing)
+storageReadS3New(
+    StorageS3 *const storage, const String *const name, const bool ignoreMissing, const uint64_t offset, const Variant *const limit,
+    const uint64_t rangeSize, const unsigned int rangeMax)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(STORAGE_S3, storage);
         FUNCTION_LOG_PARAM(STRING, name);
         FUNCTION_LOG_PARAM(BOOL, ignoreMissing);
+        FUNCTION_LOG_PARAM(UINT64, offset);
+        FUNCTION_LOG_PARAM(VARIANT, limit);
+        FUNCTION_LOG_PARAM(UINT64, rangeSize);
+        FUNCTION_LOG_PARAM(UINT, rangeMax);
     FUNCTION_LOG_END();
 
     ASSERT(storage != NULL);
     ASSERT(name != NULL);
+    ASSERT(rangeMax != 0);
 
     StorageRead *this = NULL;
 
@@ -132,12 +186,16 @@ storageReadS3New(StorageS3 *storage, const String *name, bool ignoreMissing)
         {
             .memContext = MEM_CONTEXT_NEW(),
             .storage = storage,
+            .rangeSize = rangeSize,
+            .rangeMax = rangeMax,
 
             .interface = (StorageReadInterface)
             {
                 .type = STORAGE_S3_TYPE,
                 .name = strDup(name),
                 .ignoreMissing = ignoreMissing,
+                .offset = offset,
+                .limit = varDup(limit),
 
                 .ioInterface = (IoReadInterface)
                 {
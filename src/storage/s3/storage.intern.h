@@ -19,6 +19,7 @@ Functions
 typedef struct StorageS3RequestAsyncParam
 {
     VAR_PARAM_HEADER;
+    const HttpHeader *header;                                       // Request headers
     const HttpQuery *query;                                         // Query parameters
     const Buffer *content;                                          // Request content
 } StorageS3RequestAsyncParam;
@@ -33,6 +34,7 @@ typedef struct StorageS3ResponseParam
 {
     VAR_PARAM_HEADER;
     bool allowMissing;                                              // Allow missing files (caller can check response code)
+    bool allowRangeInvalid;                                         // Allow range not satisfiable (caller can check response code)
     bool contentIo;                                                 // Is IoRead interface required to read content?
 } StorageS3ResponseParam;
 
@@ -45,6 +47,7 @@ HttpResponse *storageS3Response(HttpRequest *request, StorageS3ResponseParam par
 typedef struct StorageS3RequestParam
 {
     VAR_PARAM_HEADER;
+    const HttpHeader *header;                                       // Request headers
     const HttpQuery *query;                                         // Query parameters
     const Buffer *content;                                          // Request content
     bool allowMissing;                                              // Allow missing files (caller can check response code)
@@ -36,8 +36,9 @@ typedef struct StorageWriteS3
     StorageWriteInterface interface;                                // Interface
     StorageS3 *storage;                                             // Storage that created this object
 
-    HttpRequest *request;                                           // Async request
+    List *requestList;                                              // Async part requests in the order sent
     size_t partSize;
+    unsigned int partConcurrency;                                   // Max part requests in flight
     Buffer *partBuffer;
     const String *uploadId;
     StringList *uploadPartList;
@@ -87,17 +88,17 @@ storageWriteS3Part(StorageWriteS3 *this)
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
+    ASSERT(!lstEmpty(this->requestList));
 
-    // If there is an outstanding async request then wait for the response and store the part id
-    if (this->request != NULL)
-    {
-        strLstAdd(
-            this->uploadPartList, httpHeaderGet(httpResponseHeader(storageS3ResponseP(this->request)), HTTP_HEADER_ETAG_STR));
-        ASSERT(strLstGet(this->uploadPartList, strLstSize(this->uploadPartList) - 1) != NULL);
+    // Wait for the response to the oldest async request and store the part id. Parts are completed in the order they were sent so
+    // the part id list stays in part number order.
+    HttpRequest *const request = *(HttpRequest **)lstGet(this->requestList, 0);
 
-        httpRequestFree(this->request);
-        this->request = NULL;
-    }
+    strLstAdd(this->uploadPartList, httpHeaderGet(httpResponseHeader(storageS3ResponseP(request)), HTTP_HEADER_ETAG_STR));
+    ASSERT(strLstGet(this->uploadPartList, strLstSize(this->uploadPartList) - 1) != NULL);
+
+    httpRequestFree(request);
+    lstRemoveIdx(this->requestList, 0);
 
     FUNCTION_LOG_RETURN_VOID();
 }
@@ -115,8 +116,9 @@ storageWriteS3PartAsync(StorageWriteS3 *this)
 
     MEM_CONTEXT_TEMP_BEGIN()
     {
-        // Complete prior async request, if any
-        storageWriteS3Part(this);
+        // Complete the oldest async request if the max requests are already in flight
+        if (this->requestList != NULL && lstSize(this->requestList) == this->partConcurrency)
+            storageWriteS3Part(this);
 
         // Get the upload id if we have not already
         if (this->uploadId == NULL)
@@ -134,19 +136,24 @@ storageWriteS3PartAsync(StorageWriteS3 *this)
             {
                 this->uploadId = xmlNodeContent(xmlNodeChild(xmlRoot, S3_XML_TAG_UPLOAD_ID_STR, true));
                 this->uploadPartList = strLstNew();
+                this->requestList = lstNewP(sizeof(HttpRequest *));
             }
             MEM_CONTEXT_END();
         }
 
-        // Upload the part async
+        // Upload the part async. The request keeps a copy of the part for retries, so memory used by a write is bounded by
+        // (partConcurrency + 1) * partSize. The part is sent before returning, so only waiting on the response is overlapped.
         HttpQuery *query = httpQueryNewP();
         httpQueryAdd(query, S3_QUERY_UPLOAD_ID_STR, this->uploadId);
-        httpQueryAdd(query, S3_QUERY_PART_NUMBER_STR, strNewFmt("%u", strLstSize(this->uploadPartList) + 1));
+        httpQueryAdd(
+            query, S3_QUERY_PART_NUMBER_STR, strNewFmt("%u", strLstSize(this->uploadPartList) + lstSize(this->requestList) + 1));
 
-        MEM_CONTEXT_BEGIN(this->memContext)
+        MEM_CONTEXT_BEGIN(lstMemContext(this->requestList))
         {
-            this->request = storageS3RequestAsyncP(
+            HttpRequest *const request = storageS3RequestAsyncP(
                 this->storage, HTTP_VERB_PUT_STR, this->interface.name, .query = query, .content = this->partBuffer);
+
+            lstAdd(this->requestList, &request);
         }
         MEM_CONTEXT_END();
     }
@@ -221,8 +228,9 @@ storageWriteS3Close(THIS_VOID)
                 if (!bufEmpty(this->partBuffer))
                     storageWriteS3PartAsync(this);
 
-                // Complete prior async request, if any
-                storageWriteS3Part(this);
+                // Complete all async requests
+                while (!lstEmpty(this->requestList))
+                    storageWriteS3Part(this);
 
                 // Generate the xml part list
                 XmlDocument *partList = xmlDocumentNew(S3_XML_TAG_COMPLETE_MULTIPART_UPLOAD_STR);
@@ -263,15 +271,18 @@ storageWriteS3Close(THIS_VOID)
 
 /**********************************************************************************************************************************/
 StorageWrite *
-storageWriteS3New(StorageS3 *storage, const String *name, size_t partSize)
+storageWriteS3New(StorageS3 *storage, const String *name, size_t partSize, unsigned int partConcurrency)
 {
     FUNCTION_LOG_BEGIN(logLevelTrace);
         FUNCTION_LOG_PARAM(STORAGE_S3, storage);
         FUNCTION_LOG_PARAM(STRING, name);
+        FUNCTION_LOG_PARAM(SIZE, partSize);
+        FUNCTION_LOG_PARAM(UINT, partConcurrency);
     FUNCTION_LOG_END();
 
     ASSERT(storage != NULL);
     ASSERT(name != NULL);
+    ASSERT(partConcurrency != 0);
 
     StorageWrite *this = NULL;
 
@@ -284,6 +295,7 @@ storageWriteS3New(StorageS3 *storage, const String *name, size_t partSize)
             .memContext = MEM_CONTEXT_NEW(),
             .storage = storage,
             .partSize = partSize,
+            .partConcurrency = partConcurrency,
 
             .interface = (StorageWriteInterface)
             {
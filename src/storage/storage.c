@@ -27,6 +27,8 @@ struct Storage
     mode_t modePath;
     bool write;
     StoragePathExpressionCallback *pathExpressionFunction;
+    IoThrottle *throttleRead;                                       // Throttle file reads
+    IoThrottle *throttleWrite;                                      // Throttle file writes
 };
 
 /**********************************************************************************************************************************/
@@ -610,11 +612,12 @@ storageNewRead(const Storage *this, const String *fileExp, StorageNewReadParam p
         FUNCTION_LOG_PARAM(STRING, fileExp);
         FUNCTION_LOG_PARAM(BOOL, param.ignoreMissing);
         FUNCTION_LOG_PARAM(BOOL, param.compressible);
+        FUNCTION_LOG_PARAM(BOOL, param.noCache);
+        FUNCTION_LOG_PARAM(UINT64, param.offset);
         FUNCTION_LOG_PARAM(VARIANT, param.limit);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
-    ASSERT(storageFeature(this, storageFeatureLimitRead) || param.limit == NULL);
     ASSERT(param.limit == NULL || varType(param.limit) == varTypeUInt64);
 
     StorageRead *result = NULL;
@@ -624,11 +627,14 @@ storageNewRead(const Storage *this, const String *fileExp, StorageNewReadParam p
         result = storageReadMove(
             storageInterfaceNewReadP(
                 storageDriver(this), storagePathP(this, fileExp), param.ignoreMissing, .compressible = param.compressible,
-                .limit = param.limit),
+                .noCache = param.noCache, .offset = param.offset, .limit = param.limit),
             memContextPrior());
     }
     MEM_CONTEXT_TEMP_END();
 
+    if (this->throttleRead != NULL)
+        ioReadThrottleSet(storageReadIo(result), this->throttleRead);
+
     FUNCTION_LOG_RETURN(STORAGE_READ, result);
 }
 
@@ -649,10 +655,14 @@ storageNewWrite(const Storage *this, const String *fileExp, StorageNewWriteParam
         FUNCTION_LOG_PARAM(BOOL, param.noSyncPath);
         FUNCTION_LOG_PARAM(BOOL, param.noAtomic);
         FUNCTION_LOG_PARAM(BOOL, param.compressible);
+        FUNCTION_LOG_PARAM(BOOL, param.sparse);
+        FUNCTION_LOG_PARAM(BOOL, param.delta);
+        FUNCTION_LOG_PARAM(UINT64, param.preallocate);
     FUNCTION_LOG_END();
 
     ASSERT(this != NULL);
     ASSERT(this->write);
+    ASSERT(!param.delta || param.noAtomic);
 
     StorageWrite *result = NULL;
 
@@ -663,11 +673,15 @@ storageNewWrite(const Storage *this, const String *fileExp, StorageNewWriteParam
                 storageDriver(this), storagePathP(this, fileExp), .modeFile = param.modeFile != 0 ? param.modeFile : this->modeFile,
                 .modePath = param.modePath != 0 ? param.modePath : this->modePath, .user = param.user, .group = param.group,
                 .timeModified = param.timeModified, .createPath = !param.noCreatePath, .syncFile = !param.noSyncFile,
-                .syncPath = !param.noSyncPath, .atomic = !param.noAtomic, .compressible = param.compressible),
+                .syncPath = !param.noSyncPath, .atomic = !param.noAtomic, .compressible = param.compressible,
+                .sparse = param.sparse, .delta = param.delta, .preallocate = param.preallocate),
             memContextPrior());
     }
     MEM_CONTEXT_TEMP_END();
 
+    if (this->throttleWrite != NULL)
+        ioWriteThrottleSet(storageWriteIo(result), this->throttleWrite);
+
     FUNCTION_LOG_RETURN(STORAGE_WRITE, result);
 }
 
@@ -921,6 +935,24 @@ storageRemove(const Storage *this, const String *fileExp, StorageRemoveParam par
     FUNCTION_LOG_RETURN_VOID();
 }
 
+/**********************************************************************************************************************************/
+void
+storageThrottleSet(Storage *const this, IoThrottle *const throttleRead, IoThrottle *const throttleWrite)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM(STORAGE, this);
+        FUNCTION_TEST_PARAM(IO_THROTTLE, throttleRead);
+        FUNCTION_TEST_PARAM(IO_THROTTLE, throttleWrite);
+    FUNCTION_TEST_END();
+
+    ASSERT(this != NULL);
+
+    this->throttleRead = throttleRead;
+    this->throttleWrite = throttleWrite;
+
+    FUNCTION_TEST_RETURN_VOID();
+}
+
 /**********************************************************************************************************************************/
 String *
 storageToLog(const Storage *this)
@@ -14,6 +14,7 @@ typedef struct Storage Storage;
 #include "common/type/buffer.h"
 #include "common/type/stringList.h"
 #include "common/io/filter/group.h"
+#include "common/io/throttle.h"
 #include "common/time.h"
 #include "common/type/param.h"
 #include "storage/info.h"
@@ -43,9 +44,6 @@ typedef enum
     // Does the storage support hardlinks?  Hardlinks allow the same file to be linked into multiple paths to save space.
     storageFeatureHardLink,
 
-    // Can the storage limit the amount of data read from a file?
-    storageFeatureLimitRead,
-
     // Does the storage support symlinks?  Symlinks allow paths/files/links to be accessed from another path.
     storageFeatureSymLink,
 
@@ -147,6 +145,13 @@ typedef struct StorageNewReadParam
     bool ignoreMissing;
     bool compressible;
 
+    // Drop pages from the OS page cache once they have been read. This is useful when reading a large amount of data that will not
+    // be read again soon, e.g. during a backup, so it does not evict data that other processes are using from the cache.
+    bool noCache;
+
+    // Where to start reading in the file
+    uint64_t offset;
+
     // Limit bytes to read from the file (must be varTypeUInt64). NULL for no limit.
     const Variant *limit;
 } StorageNewReadParam;
@@ -165,9 +170,12 @@ typedef struct StorageNewWriteParam
     bool noSyncPath;
     bool noAtomic;
     bool compressible;
+    bool sparse;
+    bool delta;
     mode_t modeFile;
     mode_t modePath;
     time_t timeModified;
+    uint64_t preallocate;
     const String *user;
     const String *group;
 } StorageNewWriteParam;
@@ -263,6 +271,10 @@ storageType(const Storage *const this)
     return THIS_PUB(Storage)->type;
 }
 
+// Throttle reads and/or writes for all files opened from this point on (NULL for no throttle). Throttles are owned by the caller and
+// must not be freed before the storage or any files opened from it.
+void storageThrottleSet(Storage *this, IoThrottle *throttleRead, IoThrottle *throttleWrite);
+
 /***********************************************************************************************************************************
 Macros for function logging
 ***********************************************************************************************************************************/
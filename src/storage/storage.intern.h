@@ -30,6 +30,7 @@ Error messages
 #define STORAGE_ERROR_READ_CLOSE                                    "unable to close file '%s' after read"
 #define STORAGE_ERROR_READ_OPEN                                     "unable to open file '%s' for read"
 #define STORAGE_ERROR_READ_MISSING                                  "unable to open missing file '%s' for read"
+#define STORAGE_ERROR_READ_SEEK                                     "unable to seek to %" PRIu64 " in file '%s'"
 
 #define STORAGE_ERROR_INFO                                          "unable to get info for path/file '%s'"
 #define STORAGE_ERROR_INFO_MISSING                                  "unable to get info for missing path/file '%s'"
@@ -89,6 +90,12 @@ typedef struct StorageInterfaceNewReadParam
     // Is the file compressible? This is used when the file must be moved across a network and temporary compression is helpful.
     bool compressible;
 
+    // Drop pages from the OS page cache once they have been read. Drivers that do not use the OS page cache may ignore this.
+    bool noCache;
+
+    // Where to start reading in the file
+    uint64_t offset;
+
     // Limit bytes read from the file. NULL for no limit.
     const Variant *limit;
 } StorageInterfaceNewReadParam;
@@ -131,6 +138,17 @@ typedef struct StorageInterfaceNewWriteParam
 
     // Is the file compressible?  This is used when the file must be moved across a network and temporary compression is helpful.
     bool compressible;
+
+    // Skip writing blocks that are all zeroes for storage that supports sparse files. Skipped blocks read back as zeroes.
+    bool sparse;
+
+    // Update an existing file by writing only the blocks that differ from the new content rather than truncating the file first.
+    // Blocks that match are skipped so I/O scales with the differences between the files. The write must not be atomic.
+    bool delta;
+
+    // Preallocate space for the expected size of the file (0 for no preallocation) for storage that supports it. This reduces
+    // fragmentation and ensures that space is reserved for blocks that are skipped when sparse is set.
+    uint64_t preallocate;
 } StorageInterfaceNewWriteParam;
 
 typedef StorageWrite *StorageInterfaceNewWrite(void *thisVoid, const String *file, StorageInterfaceNewWriteParam param);
@@ -51,6 +51,13 @@ storageWriteCreatePath(const StorageWrite *const this)
     return THIS_PUB(StorageWrite)->interface->createPath;
 }
 
+// For a delta write, has all data written so far matched the existing file so no blocks were written?
+__attribute__((always_inline)) static inline bool
+storageWriteDeltaMatch(const StorageWrite *const this)
+{
+    return THIS_PUB(StorageWrite)->interface->deltaMatch;
+}
+
 // Write interface
 __attribute__((always_inline)) static inline IoWrite *
 storageWriteIo(const StorageWrite *const this)
@@ -31,6 +31,7 @@ typedef struct StorageWriteInterface
     bool syncPath;
     time_t timeModified;                                            // Time file was last modified
     const String *user;                                             // User that owns the file
+    bool deltaMatch;                                                // Has all data written so far matched the existing file?
 
     IoWriteInterface ioInterface;
 } StorageWriteInterface;
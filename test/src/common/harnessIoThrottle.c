@@ -0,0 +1,111 @@
+/***********************************************************************************************************************************
+Harness for IO Throttle Testing
+***********************************************************************************************************************************/
+#include "build.auto.h"
+
+#include "common/harnessDebug.h"
+#include "common/harnessIoThrottle.h"
+
+/***********************************************************************************************************************************
+Include shimmed C modules
+***********************************************************************************************************************************/
+{[SHIM_MODULE]}
+
+/***********************************************************************************************************************************
+Shim install state
+***********************************************************************************************************************************/
+static struct
+{
+    bool clockShim;                                                 // Is the virtual clock installed?
+    uint64_t clock;                                                 // Virtual clock in usec
+} hrnIoThrottleStatic;
+
+/***********************************************************************************************************************************
+Shim ioThrottleTime() to return the virtual clock
+***********************************************************************************************************************************/
+static uint64_t
+ioThrottleTime(void)
+{
+    // Return the virtual clock when installed
+    if (hrnIoThrottleStatic.clockShim)
+    {
+        FUNCTION_HARNESS_VOID();
+        FUNCTION_HARNESS_RETURN(UINT64, hrnIoThrottleStatic.clock);
+    }
+
+    // Else call the base function
+    return ioThrottleTime_SHIMMED();
+}
+
+/***********************************************************************************************************************************
+Shim ioThrottleSleep() to advance the virtual clock instead of sleeping
+***********************************************************************************************************************************/
+static void
+ioThrottleSleep(const uint64_t sleepTime)
+{
+    // Advance the virtual clock when installed
+    if (hrnIoThrottleStatic.clockShim)
+    {
+        FUNCTION_HARNESS_BEGIN();
+            FUNCTION_HARNESS_PARAM(UINT64, sleepTime);
+        FUNCTION_HARNESS_END();
+
+        hrnIoThrottleStatic.clock += sleepTime;
+
+        FUNCTION_HARNESS_RETURN_VOID();
+    }
+    // Else call the base function
+    else
+        ioThrottleSleep_SHIMMED(sleepTime);
+}
+
+/**********************************************************************************************************************************/
+void
+hrnIoThrottleClockInstall(const TimeMSec time)
+{
+    FUNCTION_HARNESS_BEGIN();
+        FUNCTION_HARNESS_PARAM(UINT64, time);
+    FUNCTION_HARNESS_END();
+
+    hrnIoThrottleStatic.clockShim = true;
+    hrnIoThrottleStatic.clock = time * IO_THROTTLE_USEC_PER_MSEC;
+
+    FUNCTION_HARNESS_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+void
+hrnIoThrottleClockUninstall(void)
+{
+    FUNCTION_HARNESS_VOID();
+
+    hrnIoThrottleStatic.clockShim = false;
+
+    FUNCTION_HARNESS_RETURN_VOID();
+}
+
+/**********************************************************************************************************************************/
+TimeMSec
+hrnIoThrottleClock(void)
+{
+    FUNCTION_HARNESS_VOID();
+
+    ASSERT(hrnIoThrottleStatic.clockShim);
+
+    FUNCTION_HARNESS_RETURN(UINT64, hrnIoThrottleStatic.clock / IO_THROTTLE_USEC_PER_MSEC);
+}
+
+/**********************************************************************************************************************************/
+void
+hrnIoThrottleClockAdd(const TimeMSec time)
+{
+    FUNCTION_HARNESS_BEGIN();
+        FUNCTION_HARNESS_PARAM(UINT64, time);
+    FUNCTION_HARNESS_END();
+
+    ASSERT(hrnIoThrottleStatic.clockShim);
+
+    hrnIoThrottleStatic.clock += time * IO_THROTTLE_USEC_PER_MSEC;
+
+    FUNCTION_HARNESS_RETURN_VOID();
+}
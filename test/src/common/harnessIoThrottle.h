@@ -0,0 +1,18 @@
+/***********************************************************************************************************************************
+Harness for IO Throttle Testing
+***********************************************************************************************************************************/
+#include "common/time.h"
+
+/***********************************************************************************************************************************
+Functions
+***********************************************************************************************************************************/
+// Install/uninstall a virtual clock for IoThrottle starting at the specified time. While installed, sleeping advances the virtual
+// clock rather than waiting so tests can check exactly how long the throttle slept.
+void hrnIoThrottleClockInstall(TimeMSec time);
+void hrnIoThrottleClockUninstall(void);
+
+// Current virtual time
+TimeMSec hrnIoThrottleClock(void);
+
+// Advance the virtual clock, e.g. to pass the limit refresh interval
+void hrnIoThrottleClockAdd(TimeMSec time);
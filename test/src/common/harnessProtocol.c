@@ -155,7 +155,7 @@ protocolRemoteExec(
         if (forkSafe() == 0)
         {
             // Load configuration
-            StringList *const paramList = protocolRemoteParam(protocolStorageType, hostIdx);
+            StringList *const paramList = protocolRemoteParam(protocolStorageType, hostIdx, false, false);
             hrnCfgLoadP(cfgCmdNone, paramList, .noStd = true);
 
             // Change log process id to aid in debugging
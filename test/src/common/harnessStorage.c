@@ -103,7 +103,7 @@ hrnStorageInfoListCallback(void *callbackData, const StorageInfo *info)
                         StorageRead *read = storageNewReadP(
                             data->storage,
                             data->path != NULL ? strNewFmt("%s/%s", strZ(data->path), strZ(info->name)) : info->name);
-                        ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(read)), decompressFilter(compressTypeGz));
+                        ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(read)), decompressFilterP(compressTypeGz));
                         size = bufUsed(storageGetP(read));
                     }
 
@@ -209,7 +209,7 @@ testStorageGet(const Storage *const storage, const char *const file, const char
     if (param.compressType != compressTypeNone)
     {
         ASSERT(param.compressType == compressTypeGz || param.compressType == compressTypeBz2);
-        ioFilterGroupAdd(filterGroup, decompressFilter(param.compressType));
+        ioFilterGroupAdd(filterGroup, decompressFilterP(param.compressType));
     }
 
     printf("test content of %s'%s'", strEmpty(filter) ? "" : strZ(filter), strZ(fileFull));
@@ -450,7 +450,7 @@ hrnStoragePut(
     if (param.compressType != compressTypeNone)
     {
         ASSERT(param.compressType == compressTypeGz || param.compressType == compressTypeBz2);
-        ioFilterGroupAdd(filterGroup, compressFilter(param.compressType, 1));
+        ioFilterGroupAdd(filterGroup, compressFilterP(param.compressType, 1));
 
         strCatFmt(filter, "%scmp[%s]", strEmpty(filter) ? "" : "/", strZ(compressTypeStr(param.compressType)));
     }
@@ -20,7 +20,7 @@ testRun(void)
     FUNCTION_HARNESS_VOID();
 
     // *****************************************************************************************************************************
-    if (testBegin("queueNeed()"))
+    if (testBegin("queueNeed() and queueTotal()"))
     {
         StringList *argList = strLstNew();
         hrnCfgArgRawZ(argList, cfgOptStanza, "test1");
@@ -101,6 +101,76 @@ testRun(void)
         TEST_STORAGE_LIST(
             storageSpool(), STORAGE_SPOOL_ARCHIVE_IN,
             "000000010000000A00000FFE\n000000010000000A00000FFF\n000000010000000A00000FFF.ok\n");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("queue stats");
+
+        TEST_RESULT_UINT(queueStatRead().total, 0, "no stats");
+
+        TEST_RESULT_VOID(
+            queueStatWrite(
+                &(QueueStat){.time = 1000, .total = 4, .last = STRDEF("000000010000000100000004"), .fetchTime = 2000}),
+            "write stats");
+        TEST_STORAGE_GET(
+            storageSpool(), STORAGE_SPOOL_ARCHIVE "/in.stat",
+            "{\"fetch-time\":2000,\"last\":\"000000010000000100000004\",\"time\":1000,\"total\":4}");
+
+        QueueStat stat = {0};
+        TEST_ASSIGN(stat, queueStatRead(), "read stats");
+        TEST_RESULT_UINT(stat.time, 1000, "check time");
+        TEST_RESULT_UINT(stat.total, 4, "check total");
+        TEST_RESULT_STR_Z(stat.last, "000000010000000100000004", "check last");
+        TEST_RESULT_UINT(stat.fetchTime, 2000, "check fetch time");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("invalid queue stats are ignored");
+
+        harnessLogLevelSet(logLevelDetail);
+
+        HRN_STORAGE_PUT_Z(storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE "/in.stat", "{\"fetch-time\":");
+
+        TEST_RESULT_UINT(queueStatRead().total, 0, "invalid json");
+        TEST_RESULT_LOG(
+            "P00 DETAIL: unable to read queue statistics from '<SPOOL:ARCHIVE>/in.stat', ignoring: [JsonFormatError] expected"
+            " data");
+
+        HRN_STORAGE_PUT_Z(storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE "/in.stat", "{\"last\":1,\"time\":1000,\"total\":4}");
+
+        TEST_RESULT_UINT(queueStatRead().total, 0, "missing key");
+        TEST_RESULT_LOG(
+            "P00 DETAIL: unable to read queue statistics from '<SPOOL:ARCHIVE>/in.stat', ignoring: [FormatError] missing or"
+            " invalid key");
+
+        HRN_STORAGE_PUT_Z(
+            storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE "/in.stat",
+            "{\"fetch-time\":2000,\"last\":\"000000010000000100000004\",\"time\":\"bogus\",\"total\":4}");
+
+        TEST_RESULT_UINT(queueStatRead().total, 0, "invalid value");
+        TEST_RESULT_LOG(
+            "P00 DETAIL: unable to read queue statistics from '<SPOOL:ARCHIVE>/in.stat', ignoring: [FormatError] unable to convert"
+            " base 10 string 'bogus' to uint64");
+
+        HRN_STORAGE_REMOVE(storageSpoolWrite(), STORAGE_SPOOL_ARCHIVE "/in.stat", .errorOnMissing = true);
+        harnessLogLevelReset();
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("queue total");
+
+        TEST_RESULT_UINT(queueTotal(&(QueueStat){0}, STRDEF("000000010000000100000001"), 0, 1000, 8), 8, "no stats");
+        TEST_RESULT_UINT(queueTotal(&(QueueStat){0}, STRDEF("000000010000000100000001"), 0, 1000, 1), 2, "max less than 2");
+
+        stat.fetchTime = 0;
+        TEST_RESULT_UINT(queueTotal(&stat, STRDEF("000000010000000100000004"), 0, 5000, 8), 8, "no fetch time");
+
+        stat.fetchTime = 2000;
+        TEST_RESULT_UINT(queueTotal(&stat, STRDEF("000000010000000100000004"), 0, 1000, 8), 8, "no elapsed time");
+        TEST_RESULT_UINT(queueTotal(&stat, STRDEF("000000010000000100000004"), 0, 5000, 8), 4, "keep pace with consumption");
+        TEST_RESULT_UINT(queueTotal(&stat, STRDEF("000000010000000100000004"), 0, 3000, 8), 8, "consumption increasing");
+        TEST_RESULT_UINT(queueTotal(&stat, STRDEF("000000010000000100000004"), 0, 3000, 6), 6, "limit to max");
+        TEST_RESULT_UINT(queueTotal(&stat, STRDEF("000000010000000100000004"), 3, 601000, 8), 2, "idle");
+        TEST_RESULT_UINT(queueTotal(&stat, STRDEF("000000010000000100000004"), 6, 5000, 8), 2, "queue larger than total");
+        TEST_RESULT_UINT(queueTotal(&stat, STRDEF("000000010000000100000005"), 0, 5000, 8), 8, "past end of queue");
+        TEST_RESULT_UINT(queueTotal(&stat, STRDEF("000000010000000100000005"), 0, 5000, 6), 6, "past end of queue limit to max");
     }
 
     // *****************************************************************************************************************************
@@ -958,6 +1028,86 @@ testRun(void)
         TEST_RESULT_UINT(storageInfoP(storagePg(), STRDEF("pg_wal/RECOVERYHISTORY")).size, 7, "check size");
         TEST_STORAGE_LIST(storagePgWrite(), "pg_wal", "RECOVERYHISTORY\n", .remove = true);
 
+#ifdef HAVE_LIBZST
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("get WAL segment compressed with a dictionary");
+
+        String *const walData = strNew();
+
+        for (unsigned int recordIdx = 0; strSize(walData) < 16 * 1024 * 1024; recordIdx++)
+            strCatFmt(walData, "record %u of WAL compressed with a dictionary\n", recordIdx);
+
+        Buffer *const walDict = bufNewC(strZ(walData), 16 * 1024 * 1024);
+
+        // Store the dictionary in the archive id path
+        const Buffer *const dict = compressDictTrain(compressTypeZst, bufNewC(bufPtr(walDict), 1024 * 1024), 8192, 16384);
+        const unsigned int dictId = compressDictId(compressTypeZst, dict);
+        const char *const dictFile = strZ(
+            strNewFmt(STORAGE_REPO_ARCHIVE "/10-1/" ARCHIVE_DICT_PATH "/%08x" ARCHIVE_DICT_EXT, dictId));
+
+        HRN_STORAGE_PUT(storageRepoWrite(), dictFile, dict);
+
+        // Compress the WAL segment with the dictionary
+        Buffer *const walCompressed = bufNew(0);
+        IoWrite *const write = ioBufferWriteNew(walCompressed);
+        ioFilterGroupAdd(ioWriteFilterGroup(write), compressFilterP(compressTypeZst, 3, .dict = dict));
+        ioWriteOpen(write);
+        ioWrite(write, walDict);
+        ioWriteClose(write);
+
+        HRN_STORAGE_PUT(
+            storageRepoWrite(), STORAGE_REPO_ARCHIVE "/10-1/000000010000000100000002-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa.zst",
+            walCompressed);
+
+        argList = strLstDup(argBaseList);
+        strLstAddZ(argList, "000000010000000100000002");
+        strLstAddZ(argList, TEST_PATH "/pg/pg_wal/RECOVERYXLOG");
+        HRN_CFG_LOAD(cfgCmdArchiveGet, argList);
+
+        TEST_RESULT_INT(cmdArchiveGet(), 0, "get");
+
+        TEST_RESULT_LOG("P00   INFO: found 000000010000000100000002 in the repo1: 10-1 archive");
+
+        TEST_RESULT_BOOL(
+            bufEq(storageGetP(storageNewReadP(storagePg(), STRDEF("pg_wal/RECOVERYXLOG"))), walDict), true, "check WAL");
+        TEST_RESULT_UINT(lstSize(archiveDictLocal.cacheList), 1, "dictionary cached");
+        TEST_STORAGE_LIST(storagePgWrite(), "pg_wal", "RECOVERYXLOG\n", .remove = true);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("get WAL segment with the cached dictionary");
+
+        HRN_STORAGE_REMOVE(storageRepoWrite(), dictFile, .errorOnMissing = true);
+
+        TEST_RESULT_INT(cmdArchiveGet(), 0, "get");
+
+        TEST_RESULT_LOG("P00   INFO: found 000000010000000100000002 in the repo1: 10-1 archive");
+
+        TEST_RESULT_BOOL(
+            bufEq(storageGetP(storageNewReadP(storagePg(), STRDEF("pg_wal/RECOVERYXLOG"))), walDict), true, "check WAL");
+        TEST_RESULT_UINT(lstSize(archiveDictLocal.cacheList), 1, "dictionary loaded once");
+        TEST_STORAGE_LIST(storagePgWrite(), "pg_wal", "RECOVERYXLOG\n", .remove = true);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("dictionary is missing");
+
+        memContextFree(archiveDictLocal.memContext);
+        archiveDictLocal.memContext = NULL;
+        archiveDictLocal.cacheList = NULL;
+
+        TEST_ERROR_FMT(
+            cmdArchiveGet(), FileReadError,
+            "unable to get 000000010000000100000002:\n"
+            "repo1: 10-1/0000000100000001/000000010000000100000002-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa.zst [FileMissingError]"
+                " unable to open missing file '" TEST_PATH "/repo/archive/test1/10-1/" ARCHIVE_DICT_PATH "/%08x"
+                ARCHIVE_DICT_EXT "' for read",
+            dictId);
+
+        TEST_STORAGE_LIST(storagePg(), "pg_wal", NULL);
+        HRN_STORAGE_REMOVE(
+            storageRepoWrite(), STORAGE_REPO_ARCHIVE "/10-1/000000010000000100000002-aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa.zst",
+            .errorOnMissing = true);
+#endif // HAVE_LIBZST
+
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("get compressed and encrypted WAL segment with invalid repo");
 
@@ -13,6 +13,25 @@ Test Archive Push Command
 #include "common/harnessPostgres.h"
 #include "common/harnessProtocol.h"
 
+/***********************************************************************************************************************************
+Archive push handler that fails the whole job rather than the individual WAL files in the batch
+***********************************************************************************************************************************/
+__attribute__((__noreturn__)) static void
+testArchivePushFileProtocolError(PackRead *const param, ProtocolServer *const server)
+{
+    FUNCTION_HARNESS_BEGIN();
+        FUNCTION_HARNESS_PARAM(PACK_READ, param);
+        FUNCTION_HARNESS_PARAM(PROTOCOL_SERVER, server);
+    FUNCTION_HARNESS_END();
+
+    ASSERT(param != NULL);
+    ASSERT(server != NULL);
+
+    THROW(ProtocolError, "bogus job error");
+
+    // No FUNCTION_HARNESS_RETURN_VOID() because the function does not return
+}
+
 /***********************************************************************************************************************************
 Test Run
 ***********************************************************************************************************************************/
@@ -55,11 +74,12 @@ testRun(void)
         TEST_TITLE("ready list");
 
         TEST_RESULT_STRLST_Z(
-            archivePushProcessList(STRDEF(TEST_PATH "/db/pg_wal")),
+            archivePushProcessList(STRDEF(TEST_PATH "/db/pg_wal"), strLstNewSplitZ(STRDEF("000000010000000100000006"), ",")),
             "000000010000000100000002\n000000010000000100000005\n000000010000000100000006\n", "ready list");
 
         TEST_STORAGE_LIST(
-            storageSpool(), STORAGE_SPOOL_ARCHIVE_OUT, "000000010000000100000003.ok\n", .comment = "remaining status list");
+            storageSpool(), STORAGE_SPOOL_ARCHIVE_OUT, "000000010000000100000003.ok\n000000010000000100000006.error\n",
+            .comment = "remaining status list keeps error waiting for retry");
 
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("WAL drop");
@@ -81,7 +101,8 @@ testRun(void)
 
         // Queue max is high enough that no WAL will be dropped
         TEST_RESULT_BOOL(
-            archivePushDrop(STRDEF("pg_wal"), archivePushProcessList(STRDEF(TEST_PATH "/db/pg_wal"))), false, "wal is not dropped");
+            archivePushDrop(STRDEF("pg_wal"), archivePushProcessList(STRDEF(TEST_PATH "/db/pg_wal"), NULL)), false,
+            "wal is not dropped");
 
         // Now set queue max low enough that WAL will be dropped
         argListDrop = strLstDup(argList);
@@ -89,7 +110,8 @@ testRun(void)
         HRN_CFG_LOAD(cfgCmdArchivePush, argListDrop, .role = cfgCmdRoleAsync);
 
         TEST_RESULT_BOOL(
-            archivePushDrop(STRDEF("pg_wal"), archivePushProcessList(STRDEF(TEST_PATH "/db/pg_wal"))), true, "wal is dropped");
+            archivePushDrop(STRDEF("pg_wal"), archivePushProcessList(STRDEF(TEST_PATH "/db/pg_wal"), NULL)), true,
+            "wal is dropped");
     }
 
     // *****************************************************************************************************************************
@@ -603,6 +625,98 @@ testRun(void)
             .remove = true);
 
         HRN_STORAGE_MODE(storageTest, "repo2/archive/test/11-1");
+
+#ifdef HAVE_LIBZST
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("push with a compression dictionary to both repos");
+
+        argListTemp = strLstNew();
+        hrnCfgArgRawZ(argListTemp, cfgOptStanza, "test");
+        hrnCfgArgKeyRawZ(argListTemp, cfgOptPgPath, 1, TEST_PATH "/pg");
+        hrnCfgArgKeyRawZ(argListTemp, cfgOptRepoPath, 2, TEST_PATH "/repo2");
+        hrnCfgArgKeyRawStrId(argListTemp, cfgOptRepoCipherType, 2, cipherTypeAes256Cbc);
+        hrnCfgEnvKeyRawZ(cfgOptRepoCipherPass, 2, "badpassphrase");
+        hrnCfgArgKeyRawZ(argListTemp, cfgOptRepoPath, 3, TEST_PATH "/repo3");
+        hrnCfgArgRawZ(argListTemp, cfgOptCompressType, "zst");
+        hrnCfgArgRawBool(argListTemp, cfgOptArchivePushDict, true);
+        strLstAddZ(argListTemp, "pg_wal/000000010000000100000003");
+        HRN_CFG_LOAD(cfgCmdArchivePush, argListTemp);
+        hrnCfgEnvKeyRemoveRaw(cfgOptRepoCipherPass, 2);
+
+        // Generate WAL with repeated records so a dictionary can be trained from it
+        String *const walData = strNew();
+
+        for (unsigned int recordIdx = 0; strSize(walData) < 16 * 1024 * 1024; recordIdx++)
+            strCatFmt(walData, "record %u of WAL compressed with a dictionary\n", recordIdx);
+
+        Buffer *walBuffer3 = bufNewC(strZ(walData), 16 * 1024 * 1024);
+        hrnPgWalToBuffer((PgWal){.version = PG_VERSION_11, .systemId = 0xFACEFACEFACEFACE}, walBuffer3);
+        const char *walBuffer3Sha1 = strZ(bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, walBuffer3)));
+
+        HRN_STORAGE_PUT(storagePgWrite(), "pg_wal/000000010000000100000003", walBuffer3);
+
+        TEST_RESULT_VOID(cmdArchivePush(), "push the WAL segment");
+        TEST_RESULT_LOG("P00   INFO: pushed WAL file '000000010000000100000003' to the archive");
+
+        TEST_RESULT_UINT(lstSize(archivePushDictLocal.cacheList), 2, "dictionary cached for both repos");
+
+        const unsigned int dictId = ((const ArchivePushDictCache *)lstGet(archivePushDictLocal.cacheList, 0))->dictId;
+        const char *const dictList = strZ(strNewFmt("%08x" ARCHIVE_DICT_EXT "\n", dictId));
+
+        TEST_STORAGE_LIST(
+            storageTest, "repo2/archive/test/11-1/" ARCHIVE_DICT_PATH, dictList, .comment = "check repo2 dictionary");
+        TEST_STORAGE_LIST(
+            storageTest, "repo3/archive/test/11-1/" ARCHIVE_DICT_PATH, dictList, .comment = "check repo3 dictionary");
+
+        const String *const walFile3 = strNewFmt(
+            STORAGE_REPO_ARCHIVE "/11-1/0000000100000001/000000010000000100000003-%s.zst", walBuffer3Sha1);
+        StorageRead *read = storageNewReadP(storageRepoIdx(1), walFile3);
+        ioFilterGroupAdd(
+            ioReadFilterGroup(storageReadIo(read)),
+            decompressFilterP(
+                compressTypeZst, .dictLoad = archiveDictLoad,
+                .dictLoadData = &(ArchiveDictLoadData){
+                    .storage = storageRepoIdx(1), .archivePath = STRDEF(STORAGE_REPO_ARCHIVE "/11-1"),
+                    .cipherType = cipherTypeNone}));
+
+        TEST_RESULT_BOOL(bufEq(storageGetP(read), walBuffer3), true, "decompress repo3 WAL with dictionary");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("cached dictionary is not checked in the repos again");
+
+        HRN_STORAGE_REMOVE(
+            storageTest, strZ(strNewFmt("repo3/archive/test/11-1/" ARCHIVE_DICT_PATH "/%08x" ARCHIVE_DICT_EXT, dictId)),
+            .errorOnMissing = true);
+        HRN_STORAGE_REMOVE(storageRepoIdxWrite(0), strZ(walFile3), .errorOnMissing = true);
+        HRN_STORAGE_REMOVE(storageRepoIdxWrite(1), strZ(walFile3), .errorOnMissing = true);
+
+        TEST_RESULT_VOID(cmdArchivePush(), "push the WAL segment");
+        TEST_RESULT_LOG("P00   INFO: pushed WAL file '000000010000000100000003' to the archive");
+
+        TEST_STORAGE_LIST_EMPTY(
+            storageTest, "repo3/archive/test/11-1/" ARCHIVE_DICT_PATH, .comment = "dictionary not stored again");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("dictionary is loaded from the repo when not cached");
+
+        memContextFree(archivePushDictLocal.memContext);
+        archivePushDictLocal.memContext = NULL;
+        archivePushDictLocal.cacheList = NULL;
+
+        HRN_STORAGE_REMOVE(storageRepoIdxWrite(0), strZ(walFile3), .errorOnMissing = true);
+        HRN_STORAGE_REMOVE(storageRepoIdxWrite(1), strZ(walFile3), .errorOnMissing = true);
+
+        TEST_RESULT_VOID(cmdArchivePush(), "push the WAL segment");
+        TEST_RESULT_LOG("P00   INFO: pushed WAL file '000000010000000100000003' to the archive");
+
+        TEST_RESULT_UINT(lstSize(archivePushDictLocal.cacheList), 2, "dictionary cached for both repos");
+        TEST_RESULT_UINT(
+            ((const ArchivePushDictCache *)lstGet(archivePushDictLocal.cacheList, 1))->dictId, dictId, "same dictionary");
+        TEST_STORAGE_LIST(
+            storageTest, "repo2/archive/test/11-1/" ARCHIVE_DICT_PATH, dictList, .comment = "check repo2 dictionary");
+        TEST_STORAGE_LIST(
+            storageTest, "repo3/archive/test/11-1/" ARCHIVE_DICT_PATH, dictList, .comment = "repo3 dictionary stored again");
+#endif // HAVE_LIBZST
     }
 
     // *****************************************************************************************************************************
@@ -835,7 +949,7 @@ testRun(void)
             "            HINT: this is valid in some recovery scenarios but may also indicate a problem.\n"
             "P01 DETAIL: pushed WAL file '000000010000000100000001' to the archive\n"
             "P01   WARN: could not push WAL file '000000010000000100000002' to the archive (will be retried): "
-                "[55] raised from local-1 shim protocol: " STORAGE_ERROR_READ_MISSING,
+                "[55] " STORAGE_ERROR_READ_MISSING,
             TEST_PATH "/pg/pg_xlog/000000010000000100000002");
 
         TEST_STORAGE_EXISTS(
@@ -931,6 +1045,184 @@ testRun(void)
         // Remove the ready file to prevent WAL 3 from being considered for the next test
         HRN_STORAGE_REMOVE(storagePgWrite(), "pg_xlog/archive_status/000000010000000100000003.ready", .errorOnMissing = true);
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("push a batch with a missing WAL in the middle");
+
+        // WAL 6 and 8 exist but WAL 7 does not so the error for WAL 7 must not prevent WAL 8 in the same batch from being pushed
+        HRN_STORAGE_PUT(storagePgWrite(), "pg_xlog/000000010000000100000006", walBuffer3);
+        HRN_STORAGE_PUT(storagePgWrite(), "pg_xlog/000000010000000100000008", walBuffer3);
+        HRN_STORAGE_PUT_EMPTY(storagePgWrite(), "pg_xlog/archive_status/000000010000000100000006.ready");
+        HRN_STORAGE_PUT_EMPTY(storagePgWrite(), "pg_xlog/archive_status/000000010000000100000007.ready");
+        HRN_STORAGE_PUT_EMPTY(storagePgWrite(), "pg_xlog/archive_status/000000010000000100000008.ready");
+
+        TEST_RESULT_VOID(cmdArchivePushAsync(), "push WAL segments");
+        TEST_RESULT_LOG_FMT(
+            "P00   INFO: push 3 WAL file(s) to archive: 000000010000000100000006...000000010000000100000008\n"
+            "P01 DETAIL: pushed WAL file '000000010000000100000006' to the archive\n"
+            "P01   WARN: could not push WAL file '000000010000000100000007' to the archive (will be retried): "
+                "[55] " STORAGE_ERROR_READ_MISSING "\n"
+            "P01 DETAIL: pushed WAL file '000000010000000100000008' to the archive",
+            TEST_PATH "/pg/pg_xlog/000000010000000100000007");
+
+        TEST_STORAGE_EXISTS(
+            storageTest, strZ(strNewFmt("repo/archive/test/9.4-1/0000000100000001/000000010000000100000008-%s", walBuffer3Sha1)),
+            .comment = "check repo1 for WAL 8 file");
+
+        TEST_STORAGE_EXISTS(storageSpool(), STORAGE_SPOOL_ARCHIVE_OUT "/000000010000000100000006.ok");
+        TEST_STORAGE_GET(
+            storageSpool(), STORAGE_SPOOL_ARCHIVE_OUT "/000000010000000100000007.error",
+            strZ(strNewFmt("55\n" STORAGE_ERROR_READ_MISSING, TEST_PATH "/pg/pg_xlog/000000010000000100000007")),
+            .comment = "check WAL 7 error");
+        TEST_STORAGE_EXISTS(storageSpool(), STORAGE_SPOOL_ARCHIVE_OUT "/000000010000000100000008.ok");
+
+        HRN_STORAGE_REMOVE(storagePgWrite(), "pg_xlog/archive_status/000000010000000100000006.ready", .errorOnMissing = true);
+        HRN_STORAGE_REMOVE(storagePgWrite(), "pg_xlog/archive_status/000000010000000100000007.ready", .errorOnMissing = true);
+        HRN_STORAGE_REMOVE(storagePgWrite(), "pg_xlog/archive_status/000000010000000100000008.ready", .errorOnMissing = true);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("push WAL in multiple batches split between processes");
+
+        // Only log info since the order in which the processes complete their batches is not deterministic
+        harnessLogLevelSet(logLevelInfo);
+
+        for (unsigned int walIdx = 0xA; walIdx <= 0xD; walIdx++)
+        {
+            HRN_STORAGE_PUT(storagePgWrite(), strZ(strNewFmt("pg_xlog/0000000100000001%08X", walIdx)), walBuffer3);
+            HRN_STORAGE_PUT_EMPTY(storagePgWrite(), strZ(strNewFmt("pg_xlog/archive_status/0000000100000001%08X.ready", walIdx)));
+        }
+
+        argListTemp = strLstDup(argList);
+        hrnCfgArgRawZ(argListTemp, cfgOptProcessMax, "2");
+        HRN_CFG_LOAD(cfgCmdArchivePush, argListTemp, .role = cfgCmdRoleAsync);
+
+        TEST_RESULT_VOID(cmdArchivePushAsync(), "push WAL segments");
+        TEST_RESULT_LOG("P00   INFO: push 4 WAL file(s) to archive: 00000001000000010000000A...00000001000000010000000D");
+
+        for (unsigned int walIdx = 0xA; walIdx <= 0xD; walIdx++)
+        {
+            TEST_STORAGE_EXISTS(
+                storageTest,
+                strZ(strNewFmt("repo3/archive/test/9.4-1/0000000100000001/0000000100000001%08X-%s", walIdx, walBuffer3Sha1)),
+                .comment = "check repo3 for WAL file");
+            TEST_STORAGE_EXISTS(storageSpool(), strZ(strNewFmt(STORAGE_SPOOL_ARCHIVE_OUT "/0000000100000001%08X.ok", walIdx)));
+            HRN_STORAGE_REMOVE(
+                storagePgWrite(), strZ(strNewFmt("pg_xlog/archive_status/0000000100000001%08X.ready", walIdx)),
+                .errorOnMissing = true);
+        }
+
+        harnessLogLevelSet(logLevelDetail);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("job error writes an error for every WAL in the batch");
+
+        // Free the locals so they are restarted with a handler that fails the whole job
+        protocolFree();
+
+        static const ProtocolServerHandler testLocalErrorHandlerList[] =
+        {
+            {.command = PROTOCOL_COMMAND_ARCHIVE_PUSH_FILE, .handler = testArchivePushFileProtocolError},
+        };
+
+        hrnProtocolLocalShimInstall(testLocalErrorHandlerList, PROTOCOL_SERVER_HANDLER_LIST_SIZE(testLocalErrorHandlerList));
+
+        HRN_STORAGE_PUT_EMPTY(storagePgWrite(), "pg_xlog/archive_status/00000001000000010000000E.ready");
+        HRN_STORAGE_PUT_EMPTY(storagePgWrite(), "pg_xlog/archive_status/00000001000000010000000F.ready");
+
+        HRN_CFG_LOAD(cfgCmdArchivePush, argList, .role = cfgCmdRoleAsync);
+
+        TEST_RESULT_VOID(cmdArchivePushAsync(), "push WAL segments");
+        TEST_RESULT_LOG_FMT(
+            "P00   INFO: push 2 WAL file(s) to archive: 00000001000000010000000E...00000001000000010000000F\n"
+            "P01   WARN: could not push WAL file '00000001000000010000000E' to the archive (will be retried): "
+                "[%d] raised from local-1 shim protocol: bogus job error\n"
+            "P01   WARN: could not push WAL file '00000001000000010000000F' to the archive (will be retried): "
+                "[%d] raised from local-1 shim protocol: bogus job error",
+            errorTypeCode(&ProtocolError), errorTypeCode(&ProtocolError));
+
+        TEST_STORAGE_GET(
+            storageSpool(), STORAGE_SPOOL_ARCHIVE_OUT "/00000001000000010000000E.error",
+            strZ(strNewFmt("%d\nraised from local-1 shim protocol: bogus job error", errorTypeCode(&ProtocolError))),
+            .comment = "check WAL E error");
+        TEST_STORAGE_GET(
+            storageSpool(), STORAGE_SPOOL_ARCHIVE_OUT "/00000001000000010000000F.error",
+            strZ(strNewFmt("%d\nraised from local-1 shim protocol: bogus job error", errorTypeCode(&ProtocolError))),
+            .comment = "check WAL F error");
+
+        HRN_STORAGE_REMOVE(storagePgWrite(), "pg_xlog/archive_status/00000001000000010000000E.ready", .errorOnMissing = true);
+        HRN_STORAGE_REMOVE(storagePgWrite(), "pg_xlog/archive_status/00000001000000010000000F.ready", .errorOnMissing = true);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("exit after the grace period when WAL keeps failing");
+
+        HRN_STORAGE_PUT_EMPTY(storagePgWrite(), "pg_xlog/archive_status/000000010000000100000010.ready");
+
+        argListTemp = strLstDup(argList);
+        hrnCfgArgRawZ(argListTemp, cfgOptArchivePushGrace, "1");
+        HRN_CFG_LOAD(cfgCmdArchivePush, argListTemp, .role = cfgCmdRoleAsync);
+
+        const TimeMSec timeBegin = timeMSec();
+
+        TEST_RESULT_VOID(cmdArchivePushAsync(), "push WAL segments");
+        TEST_RESULT_BOOL(timeMSec() - timeBegin < ARCHIVE_PUSH_RETRY_WAIT_MIN, true, "exit without waiting for retry");
+        TEST_RESULT_LOG_FMT(
+            "P00   INFO: push 1 WAL file(s) to archive: 000000010000000100000010\n"
+            "P01   WARN: could not push WAL file '000000010000000100000010' to the archive (will be retried): "
+                "[%d] raised from local-1 shim protocol: bogus job error",
+            errorTypeCode(&ProtocolError));
+
+        TEST_STORAGE_GET(
+            storageSpool(), STORAGE_SPOOL_ARCHIVE_OUT "/000000010000000100000010.error",
+            strZ(strNewFmt("%d\nraised from local-1 shim protocol: bogus job error", errorTypeCode(&ProtocolError))),
+            .comment = "error is kept while waiting for retry");
+
+        HRN_STORAGE_REMOVE(storagePgWrite(), "pg_xlog/archive_status/000000010000000100000010.ready", .errorOnMissing = true);
+
+        // Restore the locals with the standard handler
+        protocolFree();
+        hrnProtocolLocalShimInstall(testLocalHandlerList, PROTOCOL_SERVER_HANDLER_LIST_SIZE(testLocalHandlerList));
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("stay resident for the grace period and push WAL marked ready in the meantime");
+
+        HRN_STORAGE_PUT(storagePgWrite(), "pg_xlog/000000010000000100000004", walBuffer3);
+        HRN_STORAGE_PUT_EMPTY(storagePgWrite(), "pg_xlog/archive_status/000000010000000100000004.ready");
+
+        argListTemp = strLstDup(argList);
+        hrnCfgArgRawZ(argListTemp, cfgOptArchivePushGrace, "1");
+        HRN_CFG_LOAD(cfgCmdArchivePush, argListTemp, .role = cfgCmdRoleAsync);
+
+        // Mark WAL 5 ready after the async process has started pushing WAL 4
+        HRN_FORK_BEGIN()
+        {
+            HRN_FORK_CHILD_BEGIN()
+            {
+                sleepMSec(250);
+
+                HRN_STORAGE_PUT(storagePgWrite(), "pg_xlog/000000010000000100000005", walBuffer3);
+                HRN_STORAGE_PUT_EMPTY(storagePgWrite(), "pg_xlog/archive_status/000000010000000100000005.ready");
+            }
+            HRN_FORK_CHILD_END();
+
+            HRN_FORK_PARENT_BEGIN()
+            {
+                TEST_RESULT_VOID(cmdArchivePushAsync(), "push WAL segments");
+                TEST_RESULT_LOG(
+                    "P00   INFO: push 1 WAL file(s) to archive: 000000010000000100000004\n"
+                    "P01 DETAIL: pushed WAL file '000000010000000100000004' to the archive\n"
+                    "P00   INFO: push 1 WAL file(s) to archive: 000000010000000100000005\n"
+                    "P01 DETAIL: pushed WAL file '000000010000000100000005' to the archive");
+            }
+            HRN_FORK_PARENT_END();
+        }
+        HRN_FORK_END();
+
+        TEST_STORAGE_EXISTS(storageSpool(), STORAGE_SPOOL_ARCHIVE_OUT "/000000010000000100000004.ok");
+        TEST_STORAGE_EXISTS(storageSpool(), STORAGE_SPOOL_ARCHIVE_OUT "/000000010000000100000005.ok");
+
+        // Remove the ready files to prevent WAL 4 and 5 from being considered for the next test
+        HRN_STORAGE_REMOVE(storagePgWrite(), "pg_xlog/archive_status/000000010000000100000004.ready", .errorOnMissing = true);
+        HRN_STORAGE_REMOVE(storagePgWrite(), "pg_xlog/archive_status/000000010000000100000005.ready", .errorOnMissing = true);
+
         // Check that drop functionality works
         // -------------------------------------------------------------------------------------------------------------------------
         // Remove status files
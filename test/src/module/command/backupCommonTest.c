@@ -1,6 +1,9 @@
 /***********************************************************************************************************************************
 Test Common Functions and Definitions for Backup and Expire Commands
 ***********************************************************************************************************************************/
+#include "common/crypto/cipherBlock.h"
+#include "common/crypto/hash.h"
+#include "common/io/bufferRead.h"
 #include "common/io/bufferWrite.h"
 #include "common/regExp.h"
 #include "common/type/json.h"
@@ -311,5 +314,135 @@ testRun(void)
         TEST_ERROR(ioWrite(write, buffer), AssertError, "should not be possible to see two misaligned pages in a row");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("BackupAnalyze"))
+    {
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("checksum and size only");
+
+        Buffer *buffer = bufNew(PG_PAGE_SIZE_DEFAULT * 9 + 1024);
+        bufUsedSet(buffer, bufSize(buffer));
+
+        for (unsigned int byteIdx = 0; byteIdx < bufSize(buffer); byteIdx++)
+            bufPtr(buffer)[byteIdx] = (unsigned char)byteIdx;
+
+        IoWrite *write = ioBufferWriteNew(bufNew(0));
+        ioFilterGroupAdd(ioWriteFilterGroup(write), backupAnalyzeNewVar(NULL));
+        ioWriteOpen(write);
+        ioWrite(write, buffer);
+        ioWriteClose(write);
+
+        TEST_RESULT_STR(
+            jsonFromVar(ioFilterGroupResult(ioWriteFilterGroup(write), BACKUP_ANALYZE_FILTER_TYPE_STR)),
+            strNewFmt(
+                "{\"hash\":\"%s\",\"size\":%zu}", strZ(bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, buffer))), bufUsed(buffer)),
+            "check result");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("checksum, size, and page checksums");
+
+        memset(bufPtr(buffer), 0, bufSize(buffer));
+
+        // Page 5 has bogus checksum
+        *(PageHeaderData *)(bufPtr(buffer) + (PG_PAGE_SIZE_DEFAULT * 0x05)) = (PageHeaderData)
+        {
+            .pd_upper = 0x01,
+            .pd_lsn = (PageXLogRecPtr)
+            {
+                .xrecoff = 0x5,
+            },
+        };
+
+        write = ioBufferWriteNew(bufNew(0));
+        ioFilterGroupAdd(
+            ioWriteFilterGroup(write),
+            backupAnalyzeNewVar(varVarLst(jsonToVar(
+                strNewFmt("[0,%u,%" PRIu64 "]", PG_SEGMENT_PAGE_DEFAULT, (uint64_t)0xFACEFACE00000000)))));
+        ioWriteOpen(write);
+        ioWrite(write, buffer);
+        ioWriteClose(write);
+
+        TEST_RESULT_STR(
+            jsonFromVar(ioFilterGroupResult(ioWriteFilterGroup(write), BACKUP_ANALYZE_FILTER_TYPE_STR)),
+            strNewFmt(
+                "{\"hash\":\"%s\",\"pageChecksum\":{\"align\":false,\"error\":[5],\"valid\":false},\"size\":%zu}",
+                strZ(bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, buffer))), bufUsed(buffer)),
+            "check result");
+    }
+
+    // *****************************************************************************************************************************
+    if (testBegin("BlockMap"))
+    {
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("build map");
+
+        BlockMap *blockMap = NULL;
+        TEST_ASSIGN(blockMap, blockMapNew(), "new map");
+
+        TEST_RESULT_UINT(blockMapReferenceIdx(blockMap, STRDEF("20191002-070640F")), 0, "add reference");
+        TEST_RESULT_UINT(blockMapReferenceIdx(blockMap, STRDEF("20191002-070640F_20191003-070640I")), 1, "add reference");
+        TEST_RESULT_UINT(blockMapReferenceIdx(blockMap, STRDEF("20191002-070640F")), 0, "find reference");
+
+        BlockMapItem item = {.reference = 1, .slot = 3};
+        memset(item.checksum, 0xAA, HASH_TYPE_SHA1_SIZE);
+        TEST_RESULT_VOID(blockMapAdd(blockMap, &item), "add block");
+
+        item = (BlockMapItem){.reference = 0, .slot = 0};
+        memset(item.checksum, 0xBB, HASH_TYPE_SHA1_SIZE);
+        TEST_RESULT_VOID(blockMapAdd(blockMap, &item), "add block");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("write/read map");
+
+        Buffer *buffer = bufNew(0);
+        IoWrite *write = ioBufferWriteNew(buffer);
+        ioWriteOpen(write);
+        TEST_RESULT_VOID(blockMapWrite(blockMap, write), "write map");
+        ioWriteClose(write);
+
+        IoRead *read = ioBufferReadNew(buffer);
+        ioReadOpen(read);
+
+        BlockMap *blockMapRead = NULL;
+        TEST_ASSIGN(blockMapRead, blockMapNewRead(read), "read map");
+        TEST_RESULT_UINT(blockMapSize(blockMapRead), 2, "check size");
+        TEST_RESULT_UINT(blockMapReferenceTotal(blockMapRead), 2, "check reference total");
+        TEST_RESULT_STR_Z(blockMapReference(blockMapRead, 1), "20191002-070640F_20191003-070640I", "check reference");
+        TEST_RESULT_UINT(blockMapGet(blockMapRead, 0)->reference, 1, "check block reference");
+        TEST_RESULT_UINT(blockMapGet(blockMapRead, 0)->slot, 3, "check block slot");
+        TEST_RESULT_UINT(blockMapGet(blockMapRead, 0)->checksum[19], 0xAA, "check block checksum");
+        TEST_RESULT_UINT(blockMapGet(blockMapRead, 1)->reference, 0, "check block reference");
+        TEST_RESULT_UINT(blockMapGet(blockMapRead, 1)->checksum[0], 0xBB, "check block checksum");
+
+        TEST_RESULT_VOID(blockMapFree(blockMapRead), "free map");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("map path");
+
+        TEST_RESULT_STR_Z(
+            blockMapPath(STRDEF("20191002-070640F"), STRDEF("pg_data/base/1/2"), compressTypeGz),
+            STORAGE_REPO_BACKUP "/20191002-070640F/pg_data/base/1/2.blockmap.gz", "map path");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("load compressed and encrypted map");
+
+        const Storage *const storageTest = storagePosixNewP(STRDEF(TEST_PATH), .write = true);
+
+        StorageWrite *const mapWrite = storageNewWriteP(storageTest, STRDEF("map.blockmap.gz"));
+        ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(mapWrite)), compressFilterP(compressTypeGz, 1));
+        ioFilterGroupAdd(
+            ioWriteFilterGroup(storageWriteIo(mapWrite)),
+            cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Cbc, BUFSTRDEF("pass"), NULL));
+        ioWriteOpen(storageWriteIo(mapWrite));
+        blockMapWrite(blockMap, storageWriteIo(mapWrite));
+        ioWriteClose(storageWriteIo(mapWrite));
+
+        TEST_ASSIGN(
+            blockMapRead, blockMapLoad(storageTest, STRDEF("map.blockmap.gz"), compressTypeGz, STRDEF("pass")), "load map");
+        TEST_RESULT_UINT(blockMapSize(blockMapRead), 2, "check size");
+        TEST_RESULT_STR_Z(blockMapReference(blockMapRead, 0), "20191002-070640F", "check reference");
+        TEST_RESULT_UINT(blockMapGet(blockMapRead, 0)->slot, 3, "check block slot");
+    }
+
     FUNCTION_HARNESS_RETURN_VOID();
 }
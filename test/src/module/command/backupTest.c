@@ -27,6 +27,58 @@ typedef struct TestBackupValidateCallbackData
     String *content;                                                // String where content should be added
 } TestBackupValidateCallbackData;
 
+/***********************************************************************************************************************************
+Check a repo file against the manifest and add the size to the content
+***********************************************************************************************************************************/
+static void
+testBackupValidateFile(
+    TestBackupValidateCallbackData *const data, const String *const fileName, const String *const manifestName,
+    const uint64_t offset, const Variant *const limit)
+{
+    // Calculate checksum/size and decompress if needed
+    // -----------------------------------------------------------------------------------------------------------------------------
+    StorageRead *read = storageNewReadP(
+        data->storage, data->path != NULL ? strNewFmt("%s/%s", strZ(data->path), strZ(fileName)) : fileName, .offset = offset,
+        .limit = limit);
+
+    if (data->manifestData->backupOptionCompressType != compressTypeNone)
+    {
+        ioFilterGroupAdd(
+            ioReadFilterGroup(storageReadIo(read)), decompressFilterP(data->manifestData->backupOptionCompressType));
+    }
+
+    ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(read)), cryptoHashNew(HASH_TYPE_SHA1_STR));
+
+    uint64_t size = bufUsed(storageGetP(read));
+    const String *checksum = varStr(ioFilterGroupResult(ioReadFilterGroup(storageReadIo(read)), CRYPTO_HASH_FILTER_TYPE_STR));
+
+    strCatFmt(data->content, ", s=%" PRIu64, size);
+
+    // Check against the manifest
+    // -----------------------------------------------------------------------------------------------------------------------------
+    const ManifestFile *file = manifestFileFind(data->manifest, manifestName);
+
+    // Test size. If compressed then set the repo-size to size so it will not be in test output. Even the same compression algorithm
+    // can give slightly different results based on the version so repo-size is not deterministic for compression.
+    if (size != file->size)
+        THROW_FMT(AssertError, "'%s' size does match manifest", strZ(manifestName));
+
+    if (data->manifestData->backupOptionCompressType != compressTypeNone)
+        ((ManifestFile *)file)->sizeRepo = file->size;
+
+    // Test the checksum. pg_control and WAL headers have different checksums depending on cpu architecture so remove the checksum
+    // from the test output.
+    if (!strEqZ(checksum, file->checksumSha1))
+        THROW_FMT(AssertError, "'%s' checksum does match manifest", strZ(manifestName));
+
+    if (strEqZ(manifestName, MANIFEST_TARGET_PGDATA "/" PG_PATH_GLOBAL "/" PG_FILE_PGCONTROL) ||
+        strBeginsWith(
+            manifestName, strNewFmt(MANIFEST_TARGET_PGDATA "/%s/", strZ(pgWalPath(data->manifestData->pgVersion)))))
+    {
+        ((ManifestFile *)file)->checksumSha1[0] = '\0';
+    }
+}
+
 void
 testBackupValidateCallback(void *callbackData, const StorageInfo *info)
 {
@@ -36,71 +88,61 @@ testBackupValidateCallback(void *callbackData, const StorageInfo *info)
     if (info->type == storageTypePath && strEq(info->name, DOT_STR))
         return;
 
-    // Don't include backup.manifest or copy.  We'll test that they are present elsewhere
+    // Don't include backup.manifest, copy, or binary manifest.  We'll test that they are present elsewhere
     if (info->type == storageTypeFile &&
-        (strEqZ(info->name, BACKUP_MANIFEST_FILE) || strEqZ(info->name, BACKUP_MANIFEST_FILE INFO_COPY_EXT)))
+        (strEqZ(info->name, BACKUP_MANIFEST_FILE) || strEqZ(info->name, BACKUP_MANIFEST_FILE INFO_COPY_EXT) ||
+         strEqZ(info->name, BACKUP_MANIFEST_FILE BACKUP_MANIFEST_PACK_EXT)))
+    {
         return;
-
-    // Get manifest name
-    const String *manifestName = info->name;
-
-    strCatFmt(data->content, "%s {", strZ(info->name));
+    }
 
     switch (info->type)
     {
         case storageTypeFile:
         {
-            strCatZ(data->content, "file");
-
-            // Calculate checksum/size and decompress if needed
-            // ---------------------------------------------------------------------------------------------------------------------
-            StorageRead *read = storageNewReadP(
-                data->storage, data->path != NULL ? strNewFmt("%s/%s", strZ(data->path), strZ(info->name)) : info->name);
-
-            if (data->manifestData->backupOptionCompressType != compressTypeNone)
+            // Bundles contain multiple files so check each file in the bundle that belongs to this backup
+            if (strBeginsWithZ(info->name, BACKUP_PATH_BUNDLE "/"))
             {
-                ioFilterGroupAdd(
-                    ioReadFilterGroup(storageReadIo(read)), decompressFilter(data->manifestData->backupOptionCompressType));
-                manifestName = strSubN(
-                    info->name, 0, strSize(info->name) - strSize(compressExtStr(data->manifestData->backupOptionCompressType)));
-            }
-
-            ioFilterGroupAdd(ioReadFilterGroup(storageReadIo(read)), cryptoHashNew(HASH_TYPE_SHA1_STR));
+                const uint64_t bundleId = cvtZToUInt64(strZ(strSub(info->name, sizeof(BACKUP_PATH_BUNDLE))));
+                uint64_t bundleSize = 0;
 
-            uint64_t size = bufUsed(storageGetP(read));
-            const String *checksum = varStr(
-                ioFilterGroupResult(ioReadFilterGroup(storageReadIo(read)), CRYPTO_HASH_FILTER_TYPE_STR));
+                for (unsigned int fileIdx = 0; fileIdx < manifestFileTotal(data->manifest); fileIdx++)
+                {
+                    const ManifestFile *const file = manifestFile(data->manifest, fileIdx);
 
-            strCatFmt(data->content, ", s=%" PRIu64, size);
+                    if (file->bundleId == bundleId && file->reference == NULL)
+                    {
+                        bundleSize += file->sizeRepo;
 
-            // Check against the manifest
-            // ---------------------------------------------------------------------------------------------------------------------
-            const ManifestFile *file = manifestFileFind(data->manifest, manifestName);
+                        strCatFmt(data->content, "%s/%s {file", strZ(info->name), strZ(file->name));
+                        testBackupValidateFile(data, info->name, file->name, file->bundleOffset, VARUINT64(file->sizeRepo));
+                        strCatZ(data->content, "}\n");
+                    }
+                }
 
-            // Test size and repo-size. If compressed then set the repo-size to size so it will not be in test output. Even the same
-            // compression algorithm can give slightly different results based on the version so repo-size is not deterministic for
-            // compression.
-            if (size != file->size)
-                THROW_FMT(AssertError, "'%s' size does match manifest", strZ(manifestName));
+                if (info->size != bundleSize)
+                    THROW_FMT(AssertError, "'%s' size does not match manifest", strZ(info->name));
 
-            if (info->size != file->sizeRepo)
-                THROW_FMT(AssertError, "'%s' repo size does match manifest", strZ(manifestName));
+                return;
+            }
 
-            if (data->manifestData->backupOptionCompressType != compressTypeNone)
-                ((ManifestFile *)file)->sizeRepo = file->size;
+            strCatFmt(data->content, "%s {file", strZ(info->name));
 
-            // Test the checksum. pg_control and WAL headers have different checksums depending on cpu architecture so remove
-            // the checksum from the test output.
-            if (!strEqZ(checksum, file->checksumSha1))
-                THROW_FMT(AssertError, "'%s' checksum does match manifest", strZ(manifestName));
+            // Get manifest name
+            const String *manifestName = info->name;
 
-            if (strEqZ(manifestName, MANIFEST_TARGET_PGDATA "/" PG_PATH_GLOBAL "/" PG_FILE_PGCONTROL) ||
-                strBeginsWith(
-                    manifestName, strNewFmt(MANIFEST_TARGET_PGDATA "/%s/", strZ(pgWalPath(data->manifestData->pgVersion)))))
+            if (data->manifestData->backupOptionCompressType != compressTypeNone)
             {
-                ((ManifestFile *)file)->checksumSha1[0] = '\0';
+                manifestName = strSubN(
+                    info->name, 0, strSize(info->name) - strSize(compressExtStr(data->manifestData->backupOptionCompressType)));
             }
 
+            // Test repo-size before it is modified by the file check
+            if (info->size != manifestFileFind(data->manifest, manifestName)->sizeRepo)
+                THROW_FMT(AssertError, "'%s' repo size does match manifest", strZ(manifestName));
+
+            testBackupValidateFile(data, info->name, manifestName, 0, NULL);
+
             // Test mode, user, group. These values are not in the manifest but we know what they should be based on the default
             // mode and current user/group.
             if (info->mode != 0640)
@@ -116,16 +158,17 @@ testBackupValidateCallback(void *callbackData, const StorageInfo *info)
         }
 
         case storageTypeLink:
-            strCatFmt(data->content, "link, d=%s", strZ(info->linkDestination));
+            strCatFmt(data->content, "%s {link, d=%s", strZ(info->name), strZ(info->linkDestination));
             break;
 
         case storageTypePath:
         {
-            strCatZ(data->content, "path");
+            strCatFmt(data->content, "%s {path", strZ(info->name));
 
-            // Check against the manifest
+            // Check against the manifest (the bundle path is not in the manifest)
             // ---------------------------------------------------------------------------------------------------------------------
-            manifestPathFind(data->manifest, info->name);
+            if (!strEqZ(info->name, BACKUP_PATH_BUNDLE))
+                manifestPathFind(data->manifest, info->name);
 
             // Test mode, user, group. These values are not in the manifest but we know what they should be based on the default
             // mode and current user/group.
@@ -175,13 +218,23 @@ testBackupValidate(const Storage *storage, const String *path)
 
         storageInfoListP(storage, path, testBackupValidateCallback, &callbackData, .recurse = true, .sortOrder = sortOrderAsc);
 
-        // Make sure both backup.manifest files exist since we skipped them in the callback above
+        // Make sure all backup.manifest files exist since we skipped them in the callback above
         if (!storageExistsP(storage, strNewFmt("%s/" BACKUP_MANIFEST_FILE, strZ(path))))
             THROW(AssertError, BACKUP_MANIFEST_FILE " is missing");
 
         if (!storageExistsP(storage, strNewFmt("%s/" BACKUP_MANIFEST_FILE INFO_COPY_EXT, strZ(path))))
             THROW(AssertError, BACKUP_MANIFEST_FILE INFO_COPY_EXT " is missing");
 
+        if (!storageExistsP(storage, strNewFmt("%s/" BACKUP_MANIFEST_FILE BACKUP_MANIFEST_PACK_EXT, strZ(path))))
+            THROW(AssertError, BACKUP_MANIFEST_FILE BACKUP_MANIFEST_PACK_EXT " is missing");
+
+        // The manifest was loaded from the binary manifest so make sure it matches the ini manifest
+        Buffer *const manifestPackBuffer = bufNew(0);
+        manifestSave(manifest, ioBufferWriteNew(manifestPackBuffer));
+
+        if (!bufEq(manifestPackBuffer, storageGetP(storageNewReadP(storage, strNewFmt("%s/" BACKUP_MANIFEST_FILE, strZ(path))))))
+            THROW(AssertError, BACKUP_MANIFEST_FILE BACKUP_MANIFEST_PACK_EXT " does not match " BACKUP_MANIFEST_FILE);
+
         // Output the manifest to a string and exclude sections that don't need validation. Note that each of these sections should
         // be considered from automatic validation but adding them to the output will make the tests too noisy. One good technique
         // would be to remove it from the output only after validation so new values will cause changes in the output.
@@ -293,7 +346,7 @@ testBackupPqScript(unsigned int pgVersion, time_t backupTimeStart, TestBackupPqS
                     strZ(walChecksum), strZ(compressExtStr(param.walCompressType))));
 
             if (param.walCompressType != compressTypeNone)
-                ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(write)), compressFilter(param.walCompressType, 1));
+                ioFilterGroupAdd(ioWriteFilterGroup(storageWriteIo(write)), compressFilterP(param.walCompressType, 1));
 
             storagePutP(write, walBuffer);
         }
@@ -434,6 +487,42 @@ testBackupPqScript(unsigned int pgVersion, time_t backupTimeStart, TestBackupPqS
         THROW_FMT(AssertError, "unsupported test version %u", pgVersion);           // {uncoverable - no invalid versions in tests}
 };
 
+/***********************************************************************************************************************************
+Backup a single file with backupFile() and return the result
+***********************************************************************************************************************************/
+static BackupFileResult
+testBackupFile(
+    const String *const pgFile, const bool pgFileIgnoreMissing, const uint64_t pgFileSize, const bool pgFileCopyExactSize,
+    const String *const pgFileChecksum, const bool pgFileChecksumPage, const uint64_t pgFileChecksumPageLsnLimit,
+    const String *const manifestFile, const bool manifestFileHasReference, const uint64_t blockIncrSize,
+    const String *const blockIncrMapPrior, const CompressType repoFileCompressType, const int repoFileCompressLevel,
+    const String *const backupLabel, const bool delta, const CipherType cipherType, const String *const cipherPass)
+{
+    List *const fileList = lstNewP(sizeof(BackupFile));
+
+    const BackupFile file =
+    {
+        .pgFile = pgFile,
+        .pgFileIgnoreMissing = pgFileIgnoreMissing,
+        .pgFileSize = pgFileSize,
+        .pgFileCopyExactSize = pgFileCopyExactSize,
+        .pgFileChecksum = pgFileChecksum,
+        .pgFileChecksumPage = pgFileChecksumPage,
+        .pgFileChecksumPageLsnLimit = pgFileChecksumPageLsnLimit,
+        .manifestFile = manifestFile,
+        .manifestFileHasReference = manifestFileHasReference,
+        .blockIncrSize = blockIncrSize,
+        .blockIncrMapPrior = blockIncrMapPrior,
+    };
+
+    lstAdd(fileList, &file);
+
+    const List *const result = backupFile(
+        backupLabel, 0, repoFileCompressType, repoFileCompressLevel, 1, delta, false, cipherType, cipherPass, fileList);
+
+    return *(BackupFileResult *)lstGet(result, 0);
+}
+
 /***********************************************************************************************************************************
 Test Run
 ***********************************************************************************************************************************/
@@ -483,8 +572,8 @@ testRun(void)
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_ASSIGN(
             result,
-            backupFile(
-                missingFile, true, 0, true, NULL, false, 0, missingFile, false, compressTypeNone, 1, backupLabel, false,
+            testBackupFile(
+                missingFile, true, 0, true, NULL, false, 0, missingFile, false, 0, NULL, compressTypeNone, 1, backupLabel, false,
                 cipherTypeNone, NULL),
             "pg file missing, ignoreMissing=true, no delta");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 0, "    copy/repo size 0");
@@ -493,8 +582,8 @@ testRun(void)
         // Pg file missing - ignoreMissing=false
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_ERROR(
-            backupFile(
-                missingFile, false, 0, true, NULL, false, 0, missingFile, false, compressTypeNone, 1, backupLabel, false,
+            testBackupFile(
+                missingFile, false, 0, true, NULL, false, 0, missingFile, false, 0, NULL, compressTypeNone, 1, backupLabel, false,
                 cipherTypeNone, NULL),
             FileMissingError, "unable to open missing file '" TEST_PATH "/pg/missing' for read");
 
@@ -510,8 +599,8 @@ testRun(void)
 
         TEST_ASSIGN(
             result,
-            backupFile(
-                pgFile, false, 9999999, true, NULL, false, 0, pgFile, false, compressTypeNone, 1, backupLabel, false,
+            testBackupFile(
+                pgFile, false, 9999999, true, NULL, false, 0, pgFile, false, 0, NULL, compressTypeNone, 1, backupLabel, false,
                 cipherTypeNone, NULL),
             "pg file exists and shrunk, no repo file, no ignoreMissing, no pageChecksum, no delta, no hasReference");
 
@@ -535,9 +624,9 @@ testRun(void)
 
         TEST_ASSIGN(
             result,
-            backupFile(
-                pgFile, false, 9, true, NULL, true, 0xFFFFFFFFFFFFFFFF, pgFile, false, compressTypeNone, 1, backupLabel, false,
-                cipherTypeNone, NULL),
+            testBackupFile(
+                pgFile, false, 9, true, NULL, true, 0xFFFFFFFFFFFFFFFF, pgFile, false, 0, NULL, compressTypeNone, 1, backupLabel,
+                false, cipherTypeNone, NULL),
             "file checksummed with pageChecksum enabled");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 18, "    copy=repo=pgFile size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
@@ -563,6 +652,8 @@ testRun(void)
         varLstAdd(paramList, varNewUInt64(0xFFFFFFFFFFFFFFFF)); // pgFileChecksumPageLsnLimit
         varLstAdd(paramList, varNewStr(pgFile));            // repoFile
         varLstAdd(paramList, varNewBool(false));            // repoFileHasReference
+        varLstAdd(paramList, varNewUInt64(0));              // blockIncrSize
+        varLstAdd(paramList, NULL);                         // blockIncrMapPrior
         varLstAdd(paramList, varNewUInt(compressTypeNone)); // repoFileCompress
         varLstAdd(paramList, varNewInt(1));                 // repoFileCompressLevel
         varLstAdd(paramList, varNewStr(backupLabel));       // backupLabel
@@ -572,9 +663,9 @@ testRun(void)
 
         TEST_ASSIGN(
             result,
-            backupFile(
-                pgFile, false, 8, false, NULL, true, 0xFFFFFFFFFFFFFFFF, pgFile, false, compressTypeNone, 1, backupLabel, false,
-                cipherTypeNone, NULL),
+            testBackupFile(
+                pgFile, false, 8, false, NULL, true, 0xFFFFFFFFFFFFFFFF, pgFile, false, 0, NULL, compressTypeNone, 1, backupLabel,
+                false, cipherTypeNone, NULL),
             "backup file");
 
         TEST_RESULT_UINT(result.copySize, 12, "copy size");
@@ -588,8 +679,8 @@ testRun(void)
         // File exists in repo and db, checksum match, delta set, ignoreMissing false, hasReference - NOOP
         TEST_ASSIGN(
             result,
-            backupFile(
-                pgFile, false, 9, true, STRDEF("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, true,
+            testBackupFile(
+                pgFile, false, 9, true, STRDEF("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, true, 0, NULL,
                 compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL),
             "file in db and repo, checksum equal, no ignoreMissing, no pageChecksum, delta, hasReference");
         TEST_RESULT_UINT(result.copySize, 9, "    copy size set");
@@ -604,8 +695,8 @@ testRun(void)
         // File exists in repo and db, pg checksum mismatch, delta set, ignoreMissing false, hasReference - COPY
         TEST_ASSIGN(
             result,
-            backupFile(
-                pgFile, false, 9, true, STRDEF("1234567890123456789012345678901234567890"), false, 0, pgFile, true,
+            testBackupFile(
+                pgFile, false, 9, true, STRDEF("1234567890123456789012345678901234567890"), false, 0, pgFile, true, 0, NULL,
                 compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL),
             "file in db and repo, pg checksum not equal, no ignoreMissing, no pageChecksum, delta, hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 18, "    copy=repo=pgFile size");
@@ -619,8 +710,8 @@ testRun(void)
         // File exists in repo and db, pg checksum same, pg size different, delta set, ignoreMissing false, hasReference - COPY
         TEST_ASSIGN(
             result,
-            backupFile(
-                pgFile, false, 9999999, true, STRDEF("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, true,
+            testBackupFile(
+                pgFile, false, 9999999, true, STRDEF("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, true, 0, NULL,
                 compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL),
             "db & repo file, pg checksum same, pg size different, no ignoreMissing, no pageChecksum, delta, hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 24, "    copy=repo=pgFile size");
@@ -631,14 +722,61 @@ testRun(void)
                 storageExistsP(storageRepo(), backupPathFile) && result.pageChecksumResult == NULL),
             true, "    copy");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("delta copy when pg file has changed");
+
+        List *fileList = lstNewP(sizeof(BackupFile));
+
+        BackupFile file =
+        {
+            .pgFile = pgFile,
+            .pgFileSize = 9,
+            .pgFileCopyExactSize = true,
+            .pgFileChecksum = STRDEF("1234567890123456789012345678901234567890"),
+            .pgFileDeltaCopy = true,
+            .manifestFile = pgFile,
+            .manifestFileHasReference = true,
+        };
+
+        lstAdd(fileList, &file);
+
+        TEST_ASSIGN(
+            result,
+            *(BackupFileResult *)lstGet(
+                backupFile(backupLabel, 0, compressTypeNone, 1, 1, true, false, cipherTypeNone, NULL, fileList), 0),
+            "backup file");
+        TEST_RESULT_UINT(result.copySize, 9, "copy size");
+        TEST_RESULT_UINT(result.repoSize, 9, "repo size");
+        TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "copy file");
+        TEST_RESULT_STR_Z(result.copyChecksum, "9bc8ab2dda60ef4beed07d1e19ce0676d5edde67", "copy checksum");
+        TEST_STORAGE_EXISTS(storageRepo(), strZ(backupPathFile));
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("delta copy when pg file has not changed, remove copy");
+
+        ((BackupFile *)lstGet(fileList, 0))->pgFileChecksum = STRDEF("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67");
+
+        TEST_ASSIGN(
+            result,
+            *(BackupFileResult *)lstGet(
+                backupFile(backupLabel, 0, compressTypeNone, 1, 1, true, false, cipherTypeNone, NULL, fileList), 0),
+            "backup file");
+        TEST_RESULT_UINT(result.copySize, 9, "copy size");
+        TEST_RESULT_UINT(result.repoSize, 0, "repo size");
+        TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultNoOp, "noop file");
+        TEST_RESULT_STR_Z(result.copyChecksum, "9bc8ab2dda60ef4beed07d1e19ce0676d5edde67", "copy checksum");
+        TEST_RESULT_BOOL(storageExistsP(storageRepo(), backupPathFile), false, "copy removed");
+
+        HRN_STORAGE_PUT(storageRepoWrite(), strZ(backupPathFile), storageGetP(storageNewReadP(storagePg(), pgFile)));
+
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("resumed file is missing in repo but present in resumed manfest, recopy");
 
         TEST_ASSIGN(
             result,
-            backupFile(
+            testBackupFile(
                 pgFile, false, 9, true, STRDEF("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, STRDEF(BOGUS_STR), false,
-                compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL),
+                0, NULL, compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL),
             "backup file");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 18, "    copy=repo=pgFile size");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultReCopy, "    check copy result");
@@ -654,8 +792,8 @@ testRun(void)
             "create different file (size and checksum) with same name in repo");
         TEST_ASSIGN(
             result,
-            backupFile(
-                pgFile, false, 9, true, STRDEF("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false,
+            testBackupFile(
+                pgFile, false, 9, true, STRDEF("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false, 0, NULL,
                 compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL),
             "    db & repo file, pgFileMatch, repo checksum no match, no ignoreMissing, no pageChecksum, delta, no hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 18, "    copy=repo=pgFile size");
@@ -672,8 +810,8 @@ testRun(void)
             "create different file with same name in repo");
         TEST_ASSIGN(
             result,
-            backupFile(
-                missingFile, true, 9, true, STRDEF("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false,
+            testBackupFile(
+                missingFile, true, 9, true, STRDEF("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false, 0, NULL,
                 compressTypeNone, 1, backupLabel, true, cipherTypeNone, NULL),
             "    file in repo only, checksum in repo equal, ignoreMissing=true, no pageChecksum, delta, no hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 0, "    copy=repo=0 size");
@@ -686,8 +824,9 @@ testRun(void)
         // No prior checksum, compression, no page checksum, no pageChecksum, no delta, no hasReference
         TEST_ASSIGN(
             result,
-            backupFile(
-                pgFile, false, 9, true, NULL, false, 0, pgFile, false, compressTypeGz, 3, backupLabel, false, cipherTypeNone, NULL),
+            testBackupFile(
+                pgFile, false, 9, true, NULL, false, 0, pgFile, false, 0, NULL, compressTypeGz, 3, backupLabel, false,
+                cipherTypeNone, NULL),
             "pg file exists, no checksum, no ignoreMissing, compression, no pageChecksum, no delta, no hasReference");
 
         TEST_RESULT_UINT(result.copySize, 9, "    copy=pgFile size");
@@ -703,9 +842,9 @@ testRun(void)
         // Pg and repo file exist & match, prior checksum, compression, no page checksum, no pageChecksum, no delta, no hasReference
         TEST_ASSIGN(
             result,
-            backupFile(
-                pgFile, false, 9, true, STRDEF("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false, compressTypeGz,
-                3, backupLabel, false, cipherTypeNone, NULL),
+            testBackupFile(
+                pgFile, false, 9, true, STRDEF("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false, 0, NULL,
+                compressTypeGz, 3, backupLabel, false, cipherTypeNone, NULL),
             "pg file & repo exists, match, checksum, no ignoreMissing, compression, no pageChecksum, no delta, no hasReference");
 
         TEST_RESULT_UINT(result.copySize, 9, "    copy=pgFile size");
@@ -724,9 +863,9 @@ testRun(void)
         // No prior checksum, no compression, no pageChecksum, no delta, no hasReference
         TEST_ASSIGN(
             result,
-            backupFile(
-                STRDEF("zerofile"), false, 0, true, NULL, false, 0, STRDEF("zerofile"), false, compressTypeNone, 1, backupLabel,
-                false, cipherTypeNone, NULL),
+            testBackupFile(
+                STRDEF("zerofile"), false, 0, true, NULL, false, 0, STRDEF("zerofile"), false, 0, NULL, compressTypeNone, 1,
+                backupLabel, false, cipherTypeNone, NULL),
             "zero-sized pg file exists, no repo file, no ignoreMissing, no pageChecksum, no delta, no hasReference");
         TEST_RESULT_UINT(result.copySize + result.repoSize, 0, "    copy=repo=pgFile size 0");
         TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
@@ -735,6 +874,71 @@ testRun(void)
             (storageExistsP(storageRepo(), strNewFmt(STORAGE_REPO_BACKUP "/%s/zerofile", strZ(backupLabel))) &&
                 result.pageChecksumResult == NULL),
             true, "    copy zero file to repo success");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("block incremental full");
+
+        Buffer *blockFile = bufNew((size_t)(BLOCK_INCR_SIZE * 2 + 10));
+        memset(bufPtr(blockFile), 'A', (size_t)BLOCK_INCR_SIZE);
+        memset(bufPtr(blockFile) + BLOCK_INCR_SIZE, 'B', (size_t)BLOCK_INCR_SIZE);
+        memset(bufPtr(blockFile) + BLOCK_INCR_SIZE * 2, 'C', 10);
+        bufUsedSet(blockFile, bufSize(blockFile));
+
+        HRN_STORAGE_PUT(storagePgWrite(), "blockfile", blockFile);
+
+        TEST_ASSIGN(
+            result,
+            testBackupFile(
+                STRDEF("blockfile"), false, bufUsed(blockFile), true, NULL, false, 0, STRDEF("blockfile"), false, BLOCK_INCR_SIZE,
+                NULL, compressTypeNone, 1, backupLabel, false, cipherTypeNone, NULL),
+            "block incremental file");
+        TEST_RESULT_UINT(result.copySize, BLOCK_INCR_SIZE * 2 + 10, "    copy size");
+        TEST_RESULT_UINT(result.repoSize, BLOCK_INCR_SIZE * 2 + 10, "    repo size");
+        TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
+        TEST_RESULT_STR(result.copyChecksum, bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, blockFile)), "    copy checksum");
+
+        BlockMap *blockMap = NULL;
+        TEST_ASSIGN(
+            blockMap,
+            blockMapLoad(storageRepo(), blockMapPath(backupLabel, STRDEF("blockfile"), compressTypeNone), compressTypeNone, NULL),
+            "    load map");
+        TEST_RESULT_UINT(blockMapSize(blockMap), 3, "    map size");
+        TEST_RESULT_UINT(blockMapReferenceTotal(blockMap), 1, "    map reference total");
+        TEST_RESULT_UINT(blockMapGet(blockMap, 2)->reference, 0, "    block reference");
+        TEST_RESULT_UINT(blockMapGet(blockMap, 2)->slot, 2, "    block slot");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("block incremental with changed block");
+
+        memset(bufPtr(blockFile) + BLOCK_INCR_SIZE, 'D', 1);
+        HRN_STORAGE_PUT(storagePgWrite(), "blockfile", blockFile);
+
+        const String *const backupLabelIncr = STRDEF("20190718-155825F_20190719-155825I");
+
+        TEST_ASSIGN(
+            result,
+            testBackupFile(
+                STRDEF("blockfile"), false, bufUsed(blockFile), true, NULL, false, 0, STRDEF("blockfile"), false, BLOCK_INCR_SIZE,
+                backupLabel, compressTypeNone, 1, backupLabelIncr, false, cipherTypeNone, NULL),
+            "block incremental file");
+        TEST_RESULT_UINT(result.copySize, BLOCK_INCR_SIZE * 2 + 10, "    copy size");
+        TEST_RESULT_UINT(result.repoSize, BLOCK_INCR_SIZE, "    repo size");
+        TEST_RESULT_UINT(result.backupCopyResult, backupCopyResultCopy, "    copy file");
+
+        TEST_ASSIGN(
+            blockMap,
+            blockMapLoad(
+                storageRepo(), blockMapPath(backupLabelIncr, STRDEF("blockfile"), compressTypeNone), compressTypeNone, NULL),
+            "    load map");
+        TEST_RESULT_UINT(blockMapSize(blockMap), 3, "    map size");
+        TEST_RESULT_STR(blockMapReference(blockMap, 0), backupLabelIncr, "    map reference");
+        TEST_RESULT_STR(blockMapReference(blockMap, 1), backupLabel, "    map reference");
+        TEST_RESULT_UINT(blockMapGet(blockMap, 0)->reference, 1, "    block 0 reference");
+        TEST_RESULT_UINT(blockMapGet(blockMap, 0)->slot, 0, "    block 0 slot");
+        TEST_RESULT_UINT(blockMapGet(blockMap, 1)->reference, 0, "    block 1 reference");
+        TEST_RESULT_UINT(blockMapGet(blockMap, 1)->slot, 0, "    block 1 slot");
+        TEST_RESULT_UINT(blockMapGet(blockMap, 2)->reference, 1, "    block 2 reference");
+        TEST_RESULT_UINT(blockMapGet(blockMap, 2)->slot, 2, "    block 2 slot");
     }
 
     // *****************************************************************************************************************************
@@ -761,9 +965,9 @@ testRun(void)
         // No prior checksum, no compression, no pageChecksum, no delta, no hasReference
         TEST_ASSIGN(
             result,
-            backupFile(
-                pgFile, false, 9, true, NULL, false, 0, pgFile, false, compressTypeNone, 1, backupLabel, false, cipherTypeAes256Cbc,
-                STRDEF("12345678")),
+            testBackupFile(
+                pgFile, false, 9, true, NULL, false, 0, pgFile, false, 0, NULL, compressTypeNone, 1, backupLabel, false,
+                cipherTypeAes256Cbc, STRDEF("12345678")),
             "pg file exists, no repo file, no ignoreMissing, no pageChecksum, no delta, no hasReference");
 
         TEST_RESULT_UINT(result.copySize, 9, "    copy size set");
@@ -778,8 +982,8 @@ testRun(void)
         // Delta but pgMatch false (pg File size different), prior checksum, no compression, no pageChecksum, delta, no hasReference
         TEST_ASSIGN(
             result,
-            backupFile(
-                pgFile, false, 8, true, STRDEF("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false,
+            testBackupFile(
+                pgFile, false, 8, true, STRDEF("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, pgFile, false, 0, NULL,
                 compressTypeNone, 1, backupLabel, true, cipherTypeAes256Cbc, STRDEF("12345678")),
             "pg and repo file exists, pgFileMatch false, no ignoreMissing, no pageChecksum, delta, no hasReference");
         TEST_RESULT_UINT(result.copySize, 8, "    copy size set");
@@ -795,8 +999,8 @@ testRun(void)
         // pg/repo file size same but checksum different, prior checksum, no compression, no pageChecksum, no delta, no hasReference
         TEST_ASSIGN(
             result,
-            backupFile(
-                pgFile, false, 9, true, STRDEF("1234567890123456789012345678901234567890"), false, 0, pgFile, false,
+            testBackupFile(
+                pgFile, false, 9, true, STRDEF("1234567890123456789012345678901234567890"), false, 0, pgFile, false, 0, NULL,
                 compressTypeNone, 0, backupLabel, false, cipherTypeAes256Cbc, STRDEF("12345678")),
             "pg and repo file exists, repo checksum no match, no ignoreMissing, no pageChecksum, no delta, no hasReference");
         TEST_RESULT_UINT(result.copySize, 9, "    copy size set");
@@ -812,8 +1016,8 @@ testRun(void)
 
         TEST_ASSIGN(
             result,
-            backupFile(
-                pgFile, false, 9, true, STRDEF("1234567890123456789012345678901234567890"), false, 0, pgFile, false,
+            testBackupFile(
+                pgFile, false, 9, true, STRDEF("1234567890123456789012345678901234567890"), false, 0, pgFile, false, 0, NULL,
                 compressTypeNone, 0, backupLabel, false, cipherTypeAes256Cbc, STRDEF("12345678")),
             "backup file");
 
@@ -1153,6 +1357,85 @@ testRun(void)
         dbFree(backupData->dbPrimary);
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("backupScan()"))
+    {
+        const String *pg1Path = STRDEF(TEST_PATH "/pg1");
+        const String *repoPath = STRDEF(TEST_PATH "/repo");
+
+        StringList *argList = strLstNew();
+        strLstAddZ(argList, "--" CFGOPT_STANZA "=test1");
+        hrnCfgArgRaw(argList, cfgOptRepoPath, repoPath);
+        hrnCfgArgRaw(argList, cfgOptPgPath, pg1Path);
+        hrnCfgArgRawZ(argList, cfgOptRepoRetentionFull, "1");
+        hrnCfgArgRawZ(argList, cfgOptProcessMax, "2");
+        hrnCfgArgRawZ(argList, cfgOptExclude, "pg_log/");
+        HRN_CFG_LOAD(cfgCmdBackup, argList);
+
+        // Create a cluster with two databases and a tablespace
+        HRN_STORAGE_PUT_Z(storagePgWrite(), PG_FILE_PGVERSION, PG_VERSION_94_STR);
+        HRN_STORAGE_PUT_EMPTY(storagePgWrite(), PG_PATH_GLOBAL "/" PG_FILE_PGCONTROL);
+        HRN_STORAGE_PUT_EMPTY(storagePgWrite(), PG_PATH_BASE "/1/1000");
+        HRN_STORAGE_PUT_EMPTY(storagePgWrite(), PG_PATH_BASE "/2/2000");
+        HRN_STORAGE_PUT_EMPTY(storagePgWrite(), PG_PATH_BASE "/pgsql_tmp");
+        HRN_STORAGE_PUT_EMPTY(storagePgWrite(), "pg_log/postgresql.log");
+        HRN_STORAGE_PATH_CREATE(storagePgWrite(), "pg_xlog/archive_status");
+        HRN_STORAGE_PATH_CREATE(storagePgWrite(), PG_PATH_PGTBLSPC);
+        HRN_STORAGE_PUT_EMPTY(storageTest, "ts1/PG_9.4_201409291/3/3000");
+        HRN_SYSTEM_FMT("ln -s " TEST_PATH "/ts1 %s/" PG_PATH_PGTBLSPC "/16384", strZ(pg1Path));
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("scan databases, tablespaces, and top-level paths");
+
+        const StringList *const excludeList = strLstNewVarLst(cfgOptionLst(cfgOptExclude));
+        BackupData backupData = {.storagePrimary = storagePg(), .pgIdxPrimary = 0};
+        List *pathList = NULL;
+
+        TEST_ASSIGN(pathList, backupScan(&backupData, excludeList), "scan");
+
+        String *const pathListStr = strNew();
+
+        for (unsigned int pathIdx = 0; pathIdx < lstSize(pathList); pathIdx++)
+        {
+            const ManifestBuildPath *const path = lstGet(pathList, pathIdx);
+
+            strCatFmt(pathListStr, "%s:", strZ(strSub(path->path, strSize(pg1Path) + 1)));
+
+            for (unsigned int infoIdx = 0; infoIdx < lstSize(path->infoList); infoIdx++)
+                strCatFmt(pathListStr, " %s", strZ(((StorageInfo *)lstGet(path->infoList, infoIdx))->name));
+
+            strCatChr(pathListStr, '\n');
+        }
+
+        TEST_RESULT_STR_Z(
+            pathListStr,
+            "base/1: 1000\n"
+            "base/2: 2000\n"
+            "global: pg_control\n"
+            "pg_tblspc/16384: PG_9.4_201409291\n"
+            "pg_tblspc/16384/PG_9.4_201409291: 3\n"
+            "pg_tblspc/16384/PG_9.4_201409291/3: 3000\n"
+            "pg_xlog: archive_status\n"
+            "pg_xlog/archive_status:\n",
+            "check paths");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("manifest built from the scan matches manifest built without it");
+
+        Buffer *const manifestScan = bufNew(0);
+        Buffer *const manifestNoScan = bufNew(0);
+
+        manifestSave(
+            manifestNewBuild(
+                storagePg(), PG_VERSION_94, hrnPgCatalogVersion(PG_VERSION_94), false, false, excludeList, NULL, pathList),
+            ioBufferWriteNew(manifestScan));
+        manifestSave(
+            manifestNewBuild(storagePg(), PG_VERSION_94, hrnPgCatalogVersion(PG_VERSION_94), false, false, excludeList, NULL, NULL),
+            ioBufferWriteNew(manifestNoScan));
+
+        TEST_RESULT_STR(strNewBuf(manifestScan), strNewBuf(manifestNoScan), "compare manifests");
+    }
+
     // *****************************************************************************************************************************
     if (testBegin("backupResumeFind()"))
     {
@@ -1314,7 +1597,7 @@ testRun(void)
         ProtocolParallelJob *job = protocolParallelJobNew(VARSTRDEF("key"), protocolCommandNew(strIdFromZ(stringIdBit5, "x")));
         protocolParallelJobErrorSet(job, errorTypeCode(&AssertError), STRDEF("error message"));
 
-        TEST_ERROR(backupJobResult((Manifest *)1, NULL, STRDEF("log"), strLstNew(), job, 0, 0), AssertError, "error message");
+        TEST_ERROR(backupJobResult((Manifest *)1, NULL, storageTest, strLstNew(), job, 0, 0), AssertError, "error message");
 
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("report host/100% progress on noop result");
@@ -1323,9 +1606,11 @@ testRun(void)
         job = protocolParallelJobNew(VARSTRDEF("pg_data/test"), protocolCommandNew(strIdFromZ(stringIdBit5, "x")));
 
         PackWrite *const resultPack = protocolPackNew();
+        pckWriteStrP(resultPack, STRDEF("pg_data/test"));
         pckWriteU32P(resultPack, backupCopyResultNoOp);
         pckWriteU64P(resultPack, 0);
         pckWriteU64P(resultPack, 0);
+        pckWriteU64P(resultPack, 0);
         pckWriteStrP(resultPack, NULL);
         pckWriteStrP(resultPack, NULL);
         pckWriteEndP(resultPack);
@@ -1337,9 +1622,57 @@ testRun(void)
         manifestFileAdd(manifest, &(ManifestFile){.name = STRDEF("pg_data/test")});
 
         TEST_RESULT_UINT(
-            backupJobResult(manifest, STRDEF("host"), STRDEF("log-test"), strLstNew(), job, 0, 0), 0, "log noop result");
+            backupJobResult(manifest, STRDEF("host"), storageTest, strLstNew(), job, 0, 0), 0, "log noop result");
 
-        TEST_RESULT_LOG("P00 DETAIL: match file from prior backup host:log-test (0B, 100%)");
+        TEST_RESULT_LOG("P00 DETAIL: match file from prior backup host:" TEST_PATH "/test (0B, 100%)");
+    }
+
+    // *****************************************************************************************************************************
+    if (testBegin("backupJobCallback()"))
+    {
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("small files count as the minimum size toward the bundle size");
+
+        const ManifestFile fileList[] =
+        {
+            {.name = STRDEF("pg_data/empty1")},
+            {.name = STRDEF("pg_data/empty2")},
+            {.name = STRDEF("pg_data/small"), .size = 1},
+            {.name = STRDEF("pg_data/empty3")},
+            {.name = STRDEF("pg_data/page"), .size = 8192},
+        };
+
+        List *const queue = lstNewP(sizeof(ManifestFile *));
+
+        for (unsigned int fileIdx = 0; fileIdx < sizeof(fileList) / sizeof(fileList[0]); fileIdx++)
+        {
+            const ManifestFile *const file = &fileList[fileIdx];
+            lstAdd(queue, &file);
+        }
+
+        BackupJobData jobData =
+        {
+            .backupLabel = STRDEF("20191003-105320F"),
+            .compressType = compressTypeNone,
+            .bundle = true,
+            .bundleSize = BACKUP_BUNDLE_FILE_SIZE_MIN * 3,
+            .bundleLimit = 8192,
+            .queueList = lstNewP(sizeof(List *)),
+        };
+
+        lstAdd(jobData.queueList, &queue);
+
+        ProtocolParallelJob *job = NULL;
+
+        TEST_ASSIGN(job, backupJobCallback(&jobData, 0), "first bundle");
+        TEST_RESULT_UINT(varUInt64(protocolParallelJobKey(job)), 1, "bundle id");
+        TEST_RESULT_UINT(lstSize(queue), 2, "three files bundled");
+
+        TEST_ASSIGN(job, backupJobCallback(&jobData, 0), "second bundle");
+        TEST_RESULT_UINT(varUInt64(protocolParallelJobKey(job)), 2, "bundle id");
+        TEST_RESULT_UINT(lstSize(queue), 0, "two files bundled");
+
+        TEST_RESULT_PTR(backupJobCallback(&jobData, 0), NULL, "no more jobs");
     }
 
     // Offline tests should only be used to test offline functionality and errors easily tested in offline mode
@@ -1650,7 +1983,7 @@ testRun(void)
 
             // Create a backup manifest that looks like a halted backup manifest
             Manifest *manifestResume = manifestNewBuild(
-                storagePg(), PG_VERSION_95, hrnPgCatalogVersion(PG_VERSION_95), true, false, NULL, NULL);
+                storagePg(), PG_VERSION_95, hrnPgCatalogVersion(PG_VERSION_95), true, false, NULL, NULL, NULL);
             ManifestData *manifestResumeData = (ManifestData *)manifestData(manifestResume);
 
             manifestResumeData->backupType = backupTypeFull;
@@ -1738,7 +2071,7 @@ testRun(void)
 
             // Create a backup manifest that looks like a halted backup manifest
             Manifest *manifestResume = manifestNewBuild(
-                storagePg(), PG_VERSION_95, hrnPgCatalogVersion(PG_VERSION_95), true, false, NULL, NULL);
+                storagePg(), PG_VERSION_95, hrnPgCatalogVersion(PG_VERSION_95), true, false, NULL, NULL, NULL);
             ManifestData *manifestResumeData = (ManifestData *)manifestData(manifestResume);
 
             manifestResumeData->backupType = backupTypeFull;
@@ -1932,10 +2265,14 @@ testRun(void)
             Manifest *manifestPrior = manifestNewLoad(storageReadIo(storageNewReadP(storageRepo(), manifestPriorFile)));
             ((ManifestData *)manifestData(manifestPrior))->backupOptionChecksumPage = NULL;
             manifestSave(manifestPrior, storageWriteIo(storageNewWriteP(storageRepoWrite(), manifestPriorFile)));
+            manifestSavePack(
+                manifestPrior,
+                storageWriteIo(
+                    storageNewWriteP(storageRepoWrite(), strNewFmt("%s" BACKUP_MANIFEST_PACK_EXT, strZ(manifestPriorFile)))));
 
             // Create a backup manifest that looks like a halted backup manifest
             Manifest *manifestResume = manifestNewBuild(
-                storagePg(), PG_VERSION_95, hrnPgCatalogVersion(PG_VERSION_95), true, false, NULL, NULL);
+                storagePg(), PG_VERSION_95, hrnPgCatalogVersion(PG_VERSION_95), true, false, NULL, NULL, NULL);
             ManifestData *manifestResumeData = (ManifestData *)manifestData(manifestResume);
 
             manifestResumeData->backupType = backupTypeDiff;
@@ -2569,6 +2906,110 @@ testRun(void)
                 "pg_tblspc/32768/PG_11_201809051/1={}\n",
                 "compare file list");
         }
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("online 11 full backup with bundling");
+
+        backupTimeStart = BACKUP_EPOCH + 2600000;
+
+        {
+            // Load options
+            StringList *argList = strLstNew();
+            hrnCfgArgRawZ(argList, cfgOptStanza, "test1");
+            hrnCfgArgRaw(argList, cfgOptRepoPath, repoPath);
+            hrnCfgArgRaw(argList, cfgOptPgPath, pg1Path);
+            hrnCfgArgRawZ(argList, cfgOptRepoRetentionFull, "1");
+            hrnCfgArgRawStrId(argList, cfgOptType, backupTypeFull);
+            hrnCfgArgRawBool(argList, cfgOptRepoBundle, true);
+            hrnCfgArgRawZ(argList, cfgOptRepoBundleLimit, "8KB");
+            HRN_CFG_LOAD(cfgCmdBackup, argList);
+
+            // Create a file larger than the bundle limit so it is stored separately
+            Buffer *relation = bufNew(PG_PAGE_SIZE_DEFAULT * 2);
+            memset(bufPtr(relation), 0, bufSize(relation));
+            bufUsedSet(relation, bufSize(relation));
+
+            HRN_STORAGE_PUT(storagePgWrite(), PG_PATH_BASE "/1/2", relation, .timeModified = backupTimeStart);
+
+            // Run backup
+            testBackupPqScriptP(PG_VERSION_11, backupTimeStart);
+            TEST_RESULT_VOID(cmdBackup(), "backup");
+
+            TEST_RESULT_LOG(
+                "P00   INFO: execute non-exclusive pg_start_backup(): backup begins after the next regular checkpoint completes\n"
+                "P00   INFO: backup start archive = 0000000105DBBF8000000000, lsn = 5dbbf80/0\n"
+                "P01 DETAIL: backup file " TEST_PATH "/pg1/base/1/2 (16KB, [PCT]) checksum [SHA1]\n"
+                "P01 DETAIL: backup file " TEST_PATH "/pg1/global/pg_control (8KB, [PCT]) checksum [SHA1]\n"
+                "P01 DETAIL: backup file " TEST_PATH "/pg1/base/1/1 (8KB, [PCT]) checksum [SHA1]\n"
+                "P01 DETAIL: backup file " TEST_PATH "/pg1/postgresql.conf (11B, [PCT]) checksum [SHA1]\n"
+                "P01 DETAIL: backup file " TEST_PATH "/pg1/PG_VERSION (2B, [PCT]) checksum [SHA1]\n"
+                "P01 DETAIL: backup file " TEST_PATH "/pg1/pg_tblspc/32768/PG_11_201809051/1/5 (0B, [PCT])\n"
+                "P00   INFO: full backup size = [SIZE]\n"
+                "P00   INFO: execute non-exclusive pg_stop_backup() and wait for all WAL segments to archive\n"
+                "P00   INFO: backup stop archive = 0000000105DBBF8000000000, lsn = 5dbbf80/80000\n"
+                "P00 DETAIL: wrote 'backup_label' file returned from pg_stop_backup()\n"
+                "P00   INFO: check archive for segment(s) 0000000105DBBF8000000000:0000000105DBBF8000000000\n"
+                "P00   INFO: new backup label = 20191101-092000F");
+
+            TEST_RESULT_STR_Z_KEYRPL(
+                testBackupValidate(storageRepo(), STRDEF(STORAGE_REPO_BACKUP "/latest")),
+                ". {link, d=20191101-092000F}\n"
+                "bundle {path}\n"
+                "bundle/1/pg_data/PG_VERSION {file, s=2}\n"
+                "bundle/1/pg_data/base/1/1 {file, s=8192}\n"
+                "bundle/1/pg_data/global/pg_control {file, s=8192}\n"
+                "bundle/1/pg_data/postgresql.conf {file, s=11}\n"
+                "bundle/2/pg_tblspc/32768/PG_11_201809051/1/5 {file, s=0}\n"
+                "pg_data {path}\n"
+                "pg_data/backup_label.gz {file, s=17}\n"
+                "pg_data/base {path}\n"
+                "pg_data/base/1 {path}\n"
+                "pg_data/base/1/2.gz {file, s=16384}\n"
+                "pg_data/global {path}\n"
+                "pg_data/pg_tblspc {path}\n"
+                "pg_data/pg_tblspc/32768 {link, d=../../pg_tblspc/32768}\n"
+                "pg_data/pg_wal {path}\n"
+                "pg_tblspc {path}\n"
+                "pg_tblspc/32768 {path}\n"
+                "pg_tblspc/32768/PG_11_201809051 {path}\n"
+                "pg_tblspc/32768/PG_11_201809051/1 {path}\n"
+                "--------\n"
+                "[backup:target]\n"
+                "pg_data={\"path\":\"" TEST_PATH "/pg1\",\"type\":\"path\"}\n"
+                "pg_tblspc/32768={\"path\":\"../../pg1-tblspc/32768\",\"tablespace-id\":\"32768\""
+                    ",\"tablespace-name\":\"tblspc32768\",\"type\":\"link\"}\n"
+                "\n"
+                "[target:file]\n"
+                "pg_data/PG_VERSION={\"bni\":1,\"bno\":159,\"checksum\":\"17ba0791499db908433b80f37c5fbc89b870084b\",\"size\":2"
+                    ",\"timestamp\":1572200000}\n"
+                "pg_data/backup_label={\"checksum\":\"8e6f41ac87a7514be96260d65bacbffb11be77dc\",\"size\":17"
+                    ",\"timestamp\":1572600002}\n"
+                "pg_data/base/1/1={\"bni\":1,\"bno\":85,\"checksum\":\"0631457264ff7f8d5fb1edc2c0211992a67c73e6\""
+                    ",\"checksum-page\":true,\"master\":false,\"size\":8192,\"timestamp\":1572200000}\n"
+                "pg_data/base/1/2={\"checksum\":\"897256b6709e1a4da9daba92b6bde39ccfccd8c1\",\"checksum-page\":true"
+                    ",\"master\":false,\"size\":16384,\"timestamp\":1572600000}\n"
+                "pg_data/global/pg_control={\"bni\":1,\"bno\":0,\"size\":8192,\"timestamp\":1572400000}\n"
+                "pg_data/postgresql.conf={\"bni\":1,\"bno\":128,\"checksum\":\"e3db315c260e79211b7b52587123b7aa060f30ab\""
+                    ",\"size\":11,\"timestamp\":1570000000}\n"
+                "pg_tblspc/32768/PG_11_201809051/1/5={\"bni\":2,\"bno\":0,\"checksum-page\":true,\"master\":false,\"size\":0"
+                    ",\"timestamp\":1572200000}\n"
+                "\n"
+                "[target:link]\n"
+                "pg_data/pg_tblspc/32768={\"destination\":\"../../pg1-tblspc/32768\"}\n"
+                "\n"
+                "[target:path]\n"
+                "pg_data={}\n"
+                "pg_data/base={}\n"
+                "pg_data/base/1={}\n"
+                "pg_data/global={}\n"
+                "pg_data/pg_tblspc={}\n"
+                "pg_data/pg_wal={}\n"
+                "pg_tblspc={}\n"
+                "pg_tblspc/32768={}\n"
+                "pg_tblspc/32768/PG_11_201809051={}\n"
+                "pg_tblspc/32768/PG_11_201809051/1={}\n",
+                "compare file list");
+        }
     }
 
     FUNCTION_HARNESS_RETURN_VOID();
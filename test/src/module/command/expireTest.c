@@ -9,6 +9,7 @@ Test Expire Command
 
 #include "common/harnessConfig.h"
 #include "common/harnessInfo.h"
+#include "common/harnessProtocol.h"
 #include "common/harnessStorage.h"
 
 /***********************************************************************************************************************************
@@ -70,6 +71,10 @@ testRun(void)
 {
     FUNCTION_HARNESS_VOID();
 
+    // Install local command handler shim
+    static const ProtocolServerHandler testLocalHandlerList[] = {PROTOCOL_SERVER_HANDLER_EXPIRE_LIST};
+    hrnProtocolLocalShimInstall(testLocalHandlerList, PROTOCOL_SERVER_HANDLER_LIST_SIZE(testLocalHandlerList));
+
     StringList *argListBase = strLstNew();
     hrnCfgArgRawZ(argListBase, cfgOptStanza, "db");
     hrnCfgArgRawZ(argListBase, cfgOptRepoPath, TEST_PATH "/repo");
@@ -364,6 +369,7 @@ testRun(void)
         // Load Parameters
         StringList *argList = strLstDup(argListBase);
         hrnCfgArgRawZ(argList, cfgOptRepoRetentionFull, "1");
+        hrnCfgArgRawZ(argList, cfgOptProcessMax, "2");
         HRN_CFG_LOAD(cfgCmdExpire, argList);
 
         // Create backup.info
@@ -419,6 +425,29 @@ testRun(void)
             BOGUS_STR "/\n"
             "backup.info\n");
 
+        //--------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("error removing in parallel");
+
+        HRN_STORAGE_PUT_Z(
+            storageRepoWrite(), STORAGE_REPO_BACKUP "/20181119-152100F", BOGUS_STR,
+            .comment = "file with a backup name cannot be removed as a path");
+
+        List *removeList = lstNewP(sizeof(ExpireRemove));
+        expireRemoveAdd(removeList, STRDEF(STORAGE_REPO_BACKUP "/20181119-152100F"), true);
+        expireRemoveAdd(removeList, STRDEF(STORAGE_REPO_BACKUP "/20181119-152100F_20181119-152152D"), true);
+
+        TEST_ERROR(
+            expireRemove(removeList, 0), PathOpenError,
+            "raised from local-1 shim protocol: unable to list file info for path '" TEST_PATH "/repo/backup/db/20181119-152100F'"
+            ": [20] Not a directory");
+
+        HRN_STORAGE_REMOVE(storageRepoWrite(), STORAGE_REPO_BACKUP "/20181119-152100F");
+
+        removeList = lstNewP(sizeof(ExpireRemove));
+        expireRemoveAdd(removeList, STRDEF(STORAGE_REPO_BACKUP "/20181119-152100F"), true);
+
+        TEST_RESULT_VOID(expireRemove(removeList, 0), "single removal is not run in parallel");
+
         //--------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("remove expired backup from disk - no current backups");
 
@@ -57,6 +57,7 @@ testRun(void)
         "    repo-get        Get a file from a repository.\n"
         "    repo-ls         List files in a repository.\n"
         "    restore         Restore a database cluster.\n"
+        "    server          pgBackRest server.\n"
         "    stanza-create   Create the required stanza data.\n"
         "    stanza-delete   Delete a stanza.\n"
         "    stanza-upgrade  Upgrade a stanza.\n"
@@ -220,6 +221,8 @@ testRun(void)
             "                                   [default=/etc/pgbackrest]\n"
             "  --delta                          restore or backup using checksums [default=n]\n"
             "  --io-timeout                     i/O timeout [default=60]\n"
+            "  --io-uring                       use io_uring for file I/O [default=n]\n"
+            "  --job-queue-max                  max jobs in flight per process [default=1]\n"
             "  --lock-path                      path where lock files are stored\n"
             "                                   [default=/tmp/pgbackrest]\n"
             "  --neutral-umask                  use a neutral umask [default=y]\n"
@@ -262,6 +265,8 @@ testRun(void)
             "  --repo-gcs-key-type              GCS repository key type [default=service]\n"
             "  --repo-host                      repository host when operating remotely via\n"
             "                                   SSH [current=backup.example.net]\n"
+            "  --repo-host-ca-file              repository host certificate authority file\n"
+            "  --repo-host-cert-file            repository host certificate file\n"
             "  --repo-host-cmd                  pgBackRest exe path on the repository host\n"
             "                                   [default=/path/to/pgbackrest]\n"
             "  --repo-host-config               pgBackRest repository host configuration\n"
@@ -271,7 +276,9 @@ testRun(void)
             "                                   include path [default=/etc/pgbackrest/conf.d]\n"
             "  --repo-host-config-path          pgBackRest repository host configuration\n"
             "                                   path [default=/etc/pgbackrest]\n"
+            "  --repo-host-key-file             repository host key file\n"
             "  --repo-host-port                 repository host port when repo-host is set\n"
+            "  --repo-host-type                 repository host protocol type [default=ssh]\n"
             "  --repo-host-user                 repository host user when repo-host is set\n"
             "                                   [default=pgbackrest]\n"
             "  --repo-path                      path where backups and archive are stored\n"
@@ -284,11 +291,15 @@ testRun(void)
             "  --repo-s3-region                 S3 repository region\n"
             "  --repo-s3-role                   S3 repository role\n"
             "  --repo-s3-token                  S3 repository security token\n"
+            "  --repo-s3-upload-concurrency     max concurrent part uploads per file\n"
+            "                                   [default=1]\n"
             "  --repo-s3-uri-style              S3 URI Style [default=host]\n"
             "  --repo-storage-ca-file           repository storage CA file\n"
             "  --repo-storage-ca-path           repository storage CA path\n"
             "  --repo-storage-host              repository storage host\n"
             "  --repo-storage-port              repository storage port [default=443]\n"
+            "  --repo-storage-read-concurrency  max concurrent range reads per file\n"
+            "                                   [default=1]\n"
             "  --repo-storage-verify-tls        repository storage certificate verify\n"
             "                                   [default=y]\n"
             "  --repo-type                      type of storage used for the repository\n"
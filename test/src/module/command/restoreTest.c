@@ -3,6 +3,7 @@ Test Restore Command
 ***********************************************************************************************************************************/
 #include "common/compress/helper.h"
 #include "common/crypto/cipherBlock.h"
+#include "common/crypto/hash.h"
 #include "postgres/version.h"
 #include "storage/posix/storage.h"
 #include "storage/helper.h"
@@ -172,7 +173,7 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, STRDEF("sparse-zero"),
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, 0, 0, STRDEF("sparse-zero"),
                 STRDEF("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), true, 0x10000000000UL, 1557432154, 0600, TEST_USER_STR,
                 TEST_GROUP_STR, 0, true, false, NULL),
             false, "zero sparse 1TB file");
@@ -180,25 +181,89 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, STRDEF("normal-zero"),
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, 0, 0, STRDEF("normal-zero"),
                 STRDEF("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, 1557432154, 0600, TEST_USER_STR, TEST_GROUP_STR, 0,
                 false, false, NULL),
             true, "zero-length file");
         TEST_RESULT_UINT(storageInfoP(storagePg(), STRDEF("normal-zero")).size, 0, "    check size");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("block incremental file reassembled from full and incr");
+
+        const String *const repoFileReferenceIncr = STRDEF("20190509F_20190510I");
+
+        // Full backup stores all blocks
+        HRN_STORAGE_PUT_Z(
+            storageRepoWrite(), strZ(strNewFmt(STORAGE_REPO_BACKUP "/%s/%s", strZ(repoFileReferenceFull), strZ(repoFile1))),
+            "AAAABBBBCC");
+
+        // Incr backup stores only the changed second block
+        HRN_STORAGE_PUT_Z(
+            storageRepoWrite(), strZ(strNewFmt(STORAGE_REPO_BACKUP "/%s/%s", strZ(repoFileReferenceIncr), strZ(repoFile1))),
+            "DDDD");
+
+        BlockMap *blockMap = blockMapNew();
+        blockMapReferenceIdx(blockMap, repoFileReferenceIncr);
+        blockMapReferenceIdx(blockMap, repoFileReferenceFull);
+        blockMapAdd(blockMap, &(BlockMapItem){.reference = 1, .slot = 0});
+        blockMapAdd(blockMap, &(BlockMapItem){.reference = 0, .slot = 0});
+        blockMapAdd(blockMap, &(BlockMapItem){.reference = 1, .slot = 2});
+
+        StorageWrite *mapWrite = storageNewWriteP(
+            storageRepoWrite(), blockMapPath(repoFileReferenceIncr, repoFile1, compressTypeNone));
+        ioWriteOpen(storageWriteIo(mapWrite));
+        blockMapWrite(blockMap, storageWriteIo(mapWrite));
+        ioWriteClose(storageWriteIo(mapWrite));
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFile1, repoIdx, repoFileReferenceIncr, compressTypeNone, 0, 0, 0, 4, STRDEF("block"),
+                bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, BUFSTRDEF("AAAADDDDCC"))), false, 10, 1557432154, 0600, TEST_USER_STR,
+                TEST_GROUP_STR, 0, false, false, NULL),
+            true, "restore block incremental file");
+        TEST_STORAGE_GET(storagePgWrite(), "block", "AAAADDDDCC", .remove = true);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("block incremental map does not match file size");
+
+        TEST_ERROR(
+            restoreFile(
+                repoFile1, repoIdx, repoFileReferenceIncr, compressTypeNone, 0, 0, 0, 4, STRDEF("block"),
+                bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, BUFSTRDEF("AAAADDDDCC"))), false, 14, 1557432154, 0600, TEST_USER_STR,
+                TEST_GROUP_STR, 0, false, false, NULL),
+            FormatError, "block map for 'pg_data/testfile' has 3 block(s) but 4 expected");
+
+        storageRemoveP(
+            storageRepoWrite(), strNewFmt(STORAGE_REPO_BACKUP "/%s/%s", strZ(repoFileReferenceFull), strZ(repoFile1)),
+            .errorOnMissing = true);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("bundled file");
+
+        HRN_STORAGE_PUT_Z(
+            storageRepoWrite(), strZ(strNewFmt(STORAGE_REPO_BACKUP "/%s/bundle/1", strZ(repoFileReferenceFull))), "XXXbundledYY");
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 1, 3, 7, 0, STRDEF("bundled"),
+                bufHex(cryptoHashOne(HASH_TYPE_SHA1_STR, BUFSTRDEF("bundled"))), false, 7, 1557432154, 0600, TEST_USER_STR,
+                TEST_GROUP_STR, 0, false, false, NULL),
+            true, "restore bundled file");
+        TEST_STORAGE_GET(storagePgWrite(), "bundled", "bundled", .remove = true);
+
         // -------------------------------------------------------------------------------------------------------------------------
         // Create a compressed encrypted repo file
         StorageWrite *ceRepoFile = storageNewWriteP(
             storageRepoWrite(), strNewFmt(STORAGE_REPO_BACKUP "/%s/%s.gz", strZ(repoFileReferenceFull), strZ(repoFile1)));
         IoFilterGroup *filterGroup = ioWriteFilterGroup(storageWriteIo(ceRepoFile));
-        ioFilterGroupAdd(filterGroup, compressFilter(compressTypeGz, 3));
+        ioFilterGroupAdd(filterGroup, compressFilterP(compressTypeGz, 3));
         ioFilterGroupAdd(filterGroup, cipherBlockNew(cipherModeEncrypt, cipherTypeAes256Cbc, BUFSTRDEF("badpass"), NULL));
 
         storagePutP(ceRepoFile, BUFSTRDEF("acefile"));
 
         TEST_ERROR(
             restoreFile(
-                repoFile1, repoIdx, repoFileReferenceFull, compressTypeGz, STRDEF("normal"),
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeGz, 0, 0, 0, 0, STRDEF("normal"),
                 STRDEF("ffffffffffffffffffffffffffffffffffffffff"), false, 7, 1557432154, 0600, TEST_USER_STR, TEST_GROUP_STR, 0,
                 false, false, STRDEF("badpass")),
             ChecksumError,
@@ -213,7 +278,7 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoIdx, repoFileReferenceFull, compressTypeGz, STRDEF("normal"),
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeGz, 0, 0, 0, 0, STRDEF("normal"),
                 STRDEF("d1cd8a7d11daa26814b93eb604e1d49ab4b43770"), false, 7, 1557432154, 0600, TEST_USER_STR, TEST_GROUP_STR, 0,
                 false, false, STRDEF("badpass")),
             true, "copy file");
@@ -236,7 +301,7 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, STRDEF("delta"),
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, 0, 0, STRDEF("delta"),
                 STRDEF("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, TEST_USER_STR, TEST_GROUP_STR, 0,
                 true, false, NULL),
             true, "sha1 delta missing");
@@ -248,16 +313,27 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, STRDEF("delta"),
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, 0, 0, STRDEF("delta"),
                 STRDEF("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, TEST_USER_STR, TEST_GROUP_STR, 0,
                 true, false, NULL),
             false, "sha1 delta existing");
 
         ioBufferSizeSet(oldBufferSize);
 
+        // No pages are written when the content matches but the time is set back to backup time
+        HRN_STORAGE_TIME(storagePgWrite(), "delta", 1557432100);
+
+        TEST_RESULT_BOOL(
+            restoreFile(
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, 0, 0, STRDEF("delta"),
+                STRDEF("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, TEST_USER_STR, TEST_GROUP_STR, 0,
+                true, false, NULL),
+            false, "sha1 delta existing, time differs");
+        TEST_RESULT_INT(storageInfoP(storagePg(), STRDEF("delta")).timeModified, 1557432154, "    check time");
+
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, STRDEF("delta"),
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, 0, 0, STRDEF("delta"),
                 STRDEF("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, TEST_USER_STR, TEST_GROUP_STR,
                 1557432155, true, true, NULL),
             false, "sha1 delta force existing");
@@ -267,7 +343,7 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, STRDEF("delta"),
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, 0, 0, STRDEF("delta"),
                 STRDEF("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, TEST_USER_STR, TEST_GROUP_STR, 0,
                 true, false, NULL),
             true, "sha1 delta existing, size differs");
@@ -278,7 +354,7 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, STRDEF("delta"),
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, 0, 0, STRDEF("delta"),
                 STRDEF("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, TEST_USER_STR, TEST_GROUP_STR,
                 1557432155, true, true, NULL),
             true, "delta force existing, size differs");
@@ -290,7 +366,7 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, STRDEF("delta"),
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, 0, 0, STRDEF("delta"),
                 STRDEF("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, TEST_USER_STR, TEST_GROUP_STR, 0,
                 true, false, NULL),
             true, "sha1 delta existing, content differs");
@@ -301,14 +377,14 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, STRDEF("delta"),
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, 0, 0, STRDEF("delta"),
                 STRDEF("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, TEST_USER_STR, TEST_GROUP_STR,
                 1557432155, true, true, NULL),
             true, "delta force existing, timestamp differs");
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, STRDEF("delta"),
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, 0, 0, STRDEF("delta"),
                 STRDEF("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 9, 1557432154, 0600, TEST_USER_STR, TEST_GROUP_STR,
                 1557432153, true, true, NULL),
             true, "delta force existing, timestamp after copy time");
@@ -318,7 +394,7 @@ testRun(void)
 
         TEST_RESULT_BOOL(
             restoreFile(
-                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, STRDEF("delta"),
+                repoFile1, repoIdx, repoFileReferenceFull, compressTypeNone, 0, 0, 0, 0, STRDEF("delta"),
                 STRDEF("9bc8ab2dda60ef4beed07d1e19ce0676d5edde67"), false, 0, 1557432154, 0600, TEST_USER_STR, TEST_GROUP_STR, 0,
                 true, false, NULL),
             false, "sha1 delta existing, content differs");
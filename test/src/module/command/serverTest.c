@@ -0,0 +1,130 @@
+/***********************************************************************************************************************************
+Test Server Command
+***********************************************************************************************************************************/
+#include "common/io/socket/client.h"
+#include "common/io/tls/client.h"
+#include "common/type/json.h"
+#include "config/protocol.h"
+#include "protocol/client.h"
+#include "protocol/helper.h"
+#include "storage/posix/storage.h"
+
+#include "common/harnessConfig.h"
+#include "common/harnessFork.h"
+#include "common/harnessServer.h"
+#include "common/harnessStorage.h"
+
+/***********************************************************************************************************************************
+Open a TLS session to the server, send the client options, and create the protocol client
+***********************************************************************************************************************************/
+static ProtocolClient *
+testServerClient(const char *const optionList)
+{
+    FUNCTION_HARNESS_BEGIN();
+        FUNCTION_HARNESS_PARAM(STRINGZ, optionList);
+    FUNCTION_HARNESS_END();
+
+    IoSession *const session = ioClientOpen(
+        tlsClientNewP(
+            sckClientNew(STRDEF("localhost"), hrnServerPort(0), 5000), STRDEF("test.pgbackrest.org"), 5000, true,
+            .caFile = STRDEF(HRN_PATH_REPO "/" HRN_SERVER_CERT_PREFIX "-ca.crt"),
+            .certFile = STRDEF(HRN_PATH_REPO "/" HRN_SERVER_CERT_PREFIX ".crt"),
+            .keyFile = STRDEF(HRN_PATH_REPO "/" HRN_SERVER_CERT_PREFIX ".key")));
+
+    ioWriteStrLine(
+        ioSessionIoWrite(session), jsonFromVar(varNewVarLst(varLstNewStrLst(strLstNewSplitZ(STR(optionList), " ")))));
+    ioWriteFlush(ioSessionIoWrite(session));
+
+    FUNCTION_HARNESS_RETURN(
+        PROTOCOL_CLIENT,
+        protocolClientNew(STRDEF("test"), PROTOCOL_SERVICE_REMOTE_STR, ioSessionIoRead(session), ioSessionIoWrite(session)));
+}
+
+/***********************************************************************************************************************************
+Test Run
+***********************************************************************************************************************************/
+void
+testRun(void)
+{
+    FUNCTION_HARNESS_VOID();
+
+    Storage *storageTest = storagePosixNewP(TEST_PATH_STR, .write = true);
+
+    // *****************************************************************************************************************************
+    if (testBegin("cmdServer()"))
+    {
+        // The server loads paths from its own configuration
+        HRN_STORAGE_PUT_Z(
+            storageTest, "pgbackrest.conf",
+            "[global]\n"
+            "lock-path=" TEST_PATH "/lock\n"
+            "log-path=" TEST_PATH "\n"
+            "repo1-path=" TEST_PATH "/repo\n"
+            "\n"
+            "[test]\n"
+            "pg1-path=" TEST_PATH "/pg\n");
+
+        HRN_FORK_BEGIN()
+        {
+            HRN_FORK_CHILD_BEGIN(.prefix = "test server", .timeout = 5000)
+            {
+                StringList *argList = strLstNew();
+                strLstAddZ(argList, "--config=" TEST_PATH "/pgbackrest.conf");
+                hrnCfgArgRawZ(argList, cfgOptTlsServerCaFile, HRN_PATH_REPO "/" HRN_SERVER_CERT_PREFIX "-ca.crt");
+                hrnCfgArgRawZ(argList, cfgOptTlsServerCertFile, HRN_PATH_REPO "/" HRN_SERVER_CERT_PREFIX "-alt-name.crt");
+                hrnCfgArgRawZ(argList, cfgOptTlsServerKeyFile, HRN_PATH_REPO "/" HRN_SERVER_CERT_PREFIX ".key");
+                hrnCfgArgRawFmt(argList, cfgOptTlsServerPort, "%u", hrnServerPort(0));
+                hrnCfgArgRawZ(argList, cfgOptTlsServerAuth, "*.test.pgbackrest.org=test");
+                HRN_CFG_LOAD(cfgCmdServer, argList, .noStd = true);
+
+                // The listening message is not checked since the server returns in each child it forks
+                harnessLogLevelSet(logLevelWarn);
+
+                // Accept one connection for each test
+                cmdServer(3);
+            }
+            HRN_FORK_CHILD_END();
+
+            HRN_FORK_PARENT_BEGIN(.prefix = "test client", .timeout = 5000)
+            {
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("authorized client gets a remote with the server configuration");
+
+                ProtocolClient *client = NULL;
+
+                TEST_ASSIGN(
+                    client,
+                    testServerClient(
+                        "--log-level-console=off --log-level-file=off --log-level-stderr=error --process=0 --remote-type=repo"
+                        " --repo=1 --stanza=test info:remote"),
+                    "new client");
+
+                VariantList *optionList = varLstNew();
+                varLstAdd(optionList, varNewStrZ("repo1-path"));
+
+                TEST_RESULT_STR_Z(
+                    varStr(varLstGet(configOptionRemote(client, optionList), 0)), TEST_PATH "/repo",
+                    "repo path is from server configuration");
+                TEST_RESULT_VOID(protocolClientFree(client), "free client");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("client is not authorized for the stanza");
+
+                TEST_ERROR(
+                    testServerClient("--process=0 --remote-type=repo --stanza=bogus info:remote"), ProtocolError,
+                    "raised from test: access denied to stanza 'bogus' for client '*.test.pgbackrest.org'");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("client sends an option that the server does not allow");
+
+                TEST_ERROR(
+                    testServerClient("--process=0 --remote-type=repo --repo1-path=/etc --stanza=test info:remote"), ProtocolError,
+                    "raised from test: server does not allow client option '--repo1-path=/etc'");
+            }
+            HRN_FORK_PARENT_END();
+        }
+        HRN_FORK_END();
+    }
+
+    FUNCTION_HARNESS_RETURN_VOID();
+}
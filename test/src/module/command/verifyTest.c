@@ -2,6 +2,7 @@
 Test Stanza Commands
 ***********************************************************************************************************************************/
 #include "common/io/bufferRead.h"
+#include "common/io/bufferWrite.h"
 #include "postgres/interface.h"
 #include "postgres/version.h"
 #include "storage/posix/storage.h"
@@ -381,6 +382,63 @@ testRun(void)
         TEST_RESULT_PTR_NE(manifest, NULL, "manifest set");
         TEST_RESULT_UINT(backupResult.status, backupValid, "manifest usable");
         TEST_RESULT_LOG("P00   WARN: backup '20181119-152138F' manifest.copy does not match manifest");
+
+        //--------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("binary manifest matches");
+
+        #define TEST_BACKUP_MANIFEST_PACK                                                                                          \
+            STORAGE_REPO_BACKUP "/" TEST_BACKUP_LABEL_FULL "/" BACKUP_MANIFEST_FILE BACKUP_MANIFEST_PACK_EXT
+
+        Buffer *manifestPack = bufNew(0);
+        manifestSavePack(manifest, ioBufferWriteNew(manifestPack));
+        HRN_STORAGE_PUT(storageRepoWrite(), TEST_BACKUP_MANIFEST_PACK, manifestPack, .comment = "valid binary manifest");
+
+        backupResult.status = backupValid;
+        TEST_ASSIGN(manifest, verifyManifestFile(&backupResult, NULL, true, infoPg, &jobErrorTotal), "verify manifest");
+        TEST_RESULT_PTR_NE(manifest, NULL, "manifest set");
+        TEST_RESULT_UINT(backupResult.status, backupValid, "manifest usable");
+        TEST_RESULT_LOG("P00   WARN: backup '20181119-152138F' manifest.copy does not match manifest");
+
+        //--------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("binary manifest cannot be loaded");
+
+        PackWrite *const packInvalid = pckWriteNewBuf(bufNew(0));
+        pckWriteU32P(packInvalid, 99);
+        pckWriteEndP(packInvalid);
+
+        HRN_STORAGE_PUT(
+            storageRepoWrite(), TEST_BACKUP_MANIFEST_PACK, pckWriteBuf(packInvalid), .comment = "invalid binary manifest");
+
+        backupResult.status = backupValid;
+        TEST_ASSIGN(manifest, verifyManifestFile(&backupResult, NULL, true, infoPg, &jobErrorTotal), "verify manifest");
+        TEST_RESULT_PTR_NE(manifest, NULL, "manifest set");
+        TEST_RESULT_UINT(backupResult.status, backupValid, "manifest usable");
+        TEST_RESULT_LOG(
+            "P00   WARN: backup '20181119-152138F' manifest.copy does not match manifest\n"
+            "P00   WARN: expected manifest format 1 but found 99");
+
+        //--------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("binary manifest does not match");
+
+        manifestFileUpdate(
+            manifest, STRDEF("pg_data/PG_VERSION"), 4, 4, "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", NULL, false, false, NULL, 0,
+            0);
+
+        manifestPack = bufNew(0);
+        manifestSavePack(manifest, ioBufferWriteNew(manifestPack));
+        HRN_STORAGE_PUT(storageRepoWrite(), TEST_BACKUP_MANIFEST_PACK, manifestPack, .comment = "binary manifest checksum differs");
+
+        backupResult.status = backupValid;
+        jobErrorTotal = 0;
+        TEST_ASSIGN(manifest, verifyManifestFile(&backupResult, NULL, true, infoPg, &jobErrorTotal), "verify manifest");
+        TEST_RESULT_PTR(manifest, NULL, "manifest not set");
+        TEST_RESULT_UINT(backupResult.status, backupInvalid, "manifest unusable - backup invalid");
+        TEST_RESULT_UINT(jobErrorTotal, 1, "job error");
+        TEST_RESULT_LOG(
+            "P00   WARN: backup '20181119-152138F' manifest.copy does not match manifest\n"
+            "P00  ERROR: [028]: backup '20181119-152138F' manifest.pack does not match manifest, skipping");
+
+        HRN_STORAGE_REMOVE(storageRepoWrite(), TEST_BACKUP_MANIFEST_PACK);
     }
 
     // *****************************************************************************************************************************
@@ -858,19 +916,22 @@ testRun(void)
 
         String *filePathName = strNewZ(STORAGE_REPO_ARCHIVE "/testfile");
         HRN_STORAGE_PUT_EMPTY(storageRepoWrite(), strZ(filePathName));
-        TEST_RESULT_UINT(verifyFile(filePathName, STRDEF(HASH_TYPE_SHA1_ZERO), 0, NULL), verifyOk, "file ok");
+        TEST_RESULT_UINT(
+            verifyFile(filePathName, 0, NULL, compressTypeNone, STRDEF(HASH_TYPE_SHA1_ZERO), 0, 0, NULL), verifyOk, "file ok");
 
         //--------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("file size invalid in archive");
 
         HRN_STORAGE_PUT_Z(storageRepoWrite(), strZ(filePathName), fileContents);
-        TEST_RESULT_UINT(verifyFile(filePathName, fileChecksum, 0, NULL), verifySizeInvalid, "file size invalid");
+        TEST_RESULT_UINT(
+            verifyFile(filePathName, 0, NULL, compressTypeNone, fileChecksum, 0, 0, NULL), verifySizeInvalid, "file size invalid");
 
         //--------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("file missing in archive");
         TEST_RESULT_UINT(
             verifyFile(
-                strNewFmt(STORAGE_REPO_ARCHIVE "/missingFile"), fileChecksum, 0, NULL), verifyFileMissing, "file missing");
+                strNewFmt(STORAGE_REPO_ARCHIVE "/missingFile"), 0, NULL, compressTypeNone, fileChecksum, 0, 0, NULL),
+            verifyFileMissing, "file missing");
 
         //--------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("encrypted/compressed file in backup");
@@ -883,11 +944,73 @@ testRun(void)
 
         strCatZ(filePathName, ".gz");
         TEST_RESULT_UINT(
-            verifyFile(filePathName, fileChecksum, fileSize, STRDEF("pass")), verifyOk, "file encrypted compressed ok");
+            verifyFile(filePathName, 0, NULL, compressTypeGz, fileChecksum, fileSize, 0, STRDEF("pass")), verifyOk,
+            "file encrypted compressed ok");
         TEST_RESULT_UINT(
             verifyFile(
-                filePathName, STRDEF("badchecksum"), fileSize, STRDEF("pass")), verifyChecksumMismatch,
+                filePathName, 0, NULL, compressTypeGz, STRDEF("badchecksum"), fileSize, 0, STRDEF("pass")), verifyChecksumMismatch,
                 "file encrypted compressed checksum mismatch");
+
+        //--------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("bundled file in backup");
+
+        filePathName = strNewZ(STORAGE_REPO_BACKUP "/20181119-152138F/bundle/1");
+        HRN_STORAGE_PUT_Z(storageRepoWrite(), strZ(filePathName), "XX" "acefile contents" "YY");
+
+        TEST_RESULT_UINT(
+            verifyFile(filePathName, 2, VARUINT64(fileSize), compressTypeNone, fileChecksum, fileSize, 0, NULL), verifyOk,
+            "bundled file ok");
+        TEST_RESULT_UINT(
+            verifyFile(filePathName, 3, VARUINT64(fileSize), compressTypeNone, fileChecksum, fileSize, 0, NULL),
+            verifyChecksumMismatch, "bundled file checksum mismatch");
+
+        //--------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("block incremental file in backup");
+
+        filePathName = strNewZ(STORAGE_REPO_BACKUP "/20181119-152138F_20181119-152155I/blockfile");
+        HRN_STORAGE_PUT_Z(storageRepoWrite(), strZ(filePathName), "DDDD");
+
+        TEST_RESULT_UINT(
+            verifyFile(filePathName, 0, NULL, compressTypeNone, fileChecksum, 10, 4, NULL), verifyFileMissing, "block map missing");
+
+        BlockMap *blockMap = blockMapNew();
+        blockMapReferenceIdx(blockMap, STRDEF("20181119-152138F_20181119-152155I"));
+        blockMapReferenceIdx(blockMap, STRDEF("20181119-152138F"));
+
+        BlockMapItem blockMapItem = {.reference = 1, .slot = 0};
+        memcpy(blockMapItem.checksum, bufPtrConst(cryptoHashOne(HASH_TYPE_SHA1_STR, BUFSTRDEF("AAAA"))), HASH_TYPE_SHA1_SIZE);
+        blockMapAdd(blockMap, &blockMapItem);
+
+        blockMapItem = (BlockMapItem){.reference = 0, .slot = 0};
+        memcpy(blockMapItem.checksum, bufPtrConst(cryptoHashOne(HASH_TYPE_SHA1_STR, BUFSTRDEF("DDDD"))), HASH_TYPE_SHA1_SIZE);
+        blockMapAdd(blockMap, &blockMapItem);
+
+        blockMapItem = (BlockMapItem){.reference = 1, .slot = 2};
+        memcpy(blockMapItem.checksum, bufPtrConst(cryptoHashOne(HASH_TYPE_SHA1_STR, BUFSTRDEF("CC"))), HASH_TYPE_SHA1_SIZE);
+        blockMapAdd(blockMap, &blockMapItem);
+
+        StorageWrite *mapWrite = storageNewWriteP(storageRepoWrite(), strNewFmt("%s" BLOCK_MAP_EXT, strZ(filePathName)));
+        ioWriteOpen(storageWriteIo(mapWrite));
+        blockMapWrite(blockMap, storageWriteIo(mapWrite));
+        ioWriteClose(storageWriteIo(mapWrite));
+
+        TEST_RESULT_UINT(
+            verifyFile(filePathName, 0, NULL, compressTypeNone, fileChecksum, 10, 4, NULL), verifyOk, "block incremental file ok");
+
+        HRN_STORAGE_PUT_Z(storageRepoWrite(), strZ(filePathName), "DDDE");
+        TEST_RESULT_UINT(
+            verifyFile(filePathName, 0, NULL, compressTypeNone, fileChecksum, 10, 4, NULL), verifyChecksumMismatch,
+            "block checksum mismatch");
+
+        HRN_STORAGE_PUT_Z(storageRepoWrite(), strZ(filePathName), "DDDDD");
+        TEST_RESULT_UINT(
+            verifyFile(filePathName, 0, NULL, compressTypeNone, fileChecksum, 10, 4, NULL), verifySizeInvalid,
+            "extra data in file");
+
+        HRN_STORAGE_PUT_Z(storageRepoWrite(), strZ(filePathName), "DD");
+        TEST_RESULT_UINT(
+            verifyFile(filePathName, 0, NULL, compressTypeNone, fileChecksum, 10, 4, NULL), verifySizeInvalid,
+            "block missing from file");
     }
 
     // *****************************************************************************************************************************
@@ -1395,13 +1518,16 @@ testRun(void)
                 TEST_MANIFEST_DB
                 "\n"
                 "[target:file]\n"
+                "pg_data/bundledempty={\"bni\":1,\"bno\":9,\"master\":true,\"size\":0,\"timestamp\":1565282114}\n"
+                "pg_data/bundledfile={\"bni\":1,\"bno\":2,\"checksum\":\"%s\",\"master\":true,\"size\":%u"
+                    ",\"timestamp\":1565282114}\n"
                 "pg_data/validfile={\"checksum\":\"%s\",\"master\":true,\"size\":%u,\"timestamp\":1565282114}\n"
                 TEST_MANIFEST_FILE_DEFAULT
                 TEST_MANIFEST_LINK
                 TEST_MANIFEST_LINK_DEFAULT
                 TEST_MANIFEST_PATH
                 TEST_MANIFEST_PATH_DEFAULT,
-                strZ(fileChecksum), (unsigned int)fileSize);
+                strZ(fileChecksum), (unsigned int)fileSize, strZ(fileChecksum), (unsigned int)fileSize);
 
         HRN_INFO_PUT(
             storageRepoWrite(), STORAGE_REPO_BACKUP "/20201119-163000F/" BACKUP_MANIFEST_FILE, strZ(manifestContent),
@@ -1412,6 +1538,9 @@ testRun(void)
 
         HRN_STORAGE_PUT_Z(
             storageRepoWrite(), STORAGE_REPO_BACKUP  "/20201119-163000F/pg_data/validfile", fileContents, .comment = "valid file");
+        HRN_STORAGE_PUT_Z(
+            storageRepoWrite(), STORAGE_REPO_BACKUP "/20201119-163000F/bundle/1", strZ(strNewFmt("XX%s", fileContents)),
+            .comment = "valid bundle");
 
         // Create WAL file with just header info and small WAL size
         Buffer *walBuffer = bufNew((size_t)(1024 * 1024));
@@ -1439,7 +1568,7 @@ testRun(void)
             "                missing: 1, checksum invalid: 1, size invalid: 1, other: 0\n"
             "              backup: 20181119-152900F_20181119-152909D, status: invalid, total files checked: 1, total valid files: 0\n"
             "                missing: 0, checksum invalid: 1, size invalid: 0, other: 0\n"
-            "              backup: 20201119-163000F, status: valid, total files checked: 1, total valid files: 1\n"
+            "              backup: 20201119-163000F, status: valid, total files checked: 3, total valid files: 3\n"
             "                missing: 0, checksum invalid: 0, size invalid: 0, other: 0");
     }
 
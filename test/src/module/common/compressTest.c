@@ -69,6 +69,17 @@ testDecompress(IoFilter *decompress, Buffer *compressed, size_t inputSize, size_
     return decompressed;
 }
 
+/***********************************************************************************************************************************
+Load a dictionary for decompression -- the dictionary is passed as the callback data
+***********************************************************************************************************************************/
+static const Buffer *
+testDictLoad(void *data, unsigned int dictId)
+{
+    ASSERT(dictId == compressDictId(compressTypeZst, data));
+
+    return data;
+}
+
 /***********************************************************************************************************************************
 Standard test suite to be applied to all compression types
 ***********************************************************************************************************************************/
@@ -102,15 +113,15 @@ testSuite(CompressType type, const char *decompressCmd)
     TEST_RESULT_BOOL(bufEq(decompressed, storageGetP(storageNewReadP(storageTest, STRDEF("test.out")))), true, "check output");
 
     TEST_RESULT_BOOL(
-        bufEq(compressed, testCompress(compressFilter(type, 1), decompressed, 1024, 1)), true,
+        bufEq(compressed, testCompress(compressFilterP(type, 1), decompressed, 1024, 1)), true,
         "simple data - compress large in/small out buffer");
 
     TEST_RESULT_BOOL(
-        bufEq(compressed, testCompress(compressFilter(type, 1), decompressed, 1, 1024)), true,
+        bufEq(compressed, testCompress(compressFilterP(type, 1), decompressed, 1, 1024)), true,
         "simple data - compress small in/large out buffer");
 
     TEST_RESULT_BOOL(
-        bufEq(compressed, testCompress(compressFilter(type, 1), decompressed, 1, 1)), true,
+        bufEq(compressed, testCompress(compressFilterP(type, 1), decompressed, 1, 1)), true,
         "simple data - compress small in/small out buffer");
 
     TEST_RESULT_BOOL(
@@ -121,21 +132,21 @@ testSuite(CompressType type, const char *decompressCmd)
         true, "simple data - decompress large in/large out buffer");
 
     TEST_RESULT_BOOL(
-        bufEq(decompressed, testDecompress(decompressFilter(type), compressed, 1024, 1)), true,
+        bufEq(decompressed, testDecompress(decompressFilterP(type), compressed, 1024, 1)), true,
         "simple data - decompress large in/small out buffer");
 
     TEST_RESULT_BOOL(
-        bufEq(decompressed, testDecompress(decompressFilter(type), compressed, 1, 1024)), true,
+        bufEq(decompressed, testDecompress(decompressFilterP(type), compressed, 1, 1024)), true,
         "simple data - decompress small in/large out buffer");
 
     TEST_RESULT_BOOL(
-        bufEq(decompressed, testDecompress(decompressFilter(type), compressed, 1, 1)), true,
+        bufEq(decompressed, testDecompress(decompressFilterP(type), compressed, 1, 1)), true,
         "simple data - decompress small in/small out buffer");
 
     // -------------------------------------------------------------------------------------------------------------------------
     TEST_TITLE("error on no compression data");
 
-    TEST_ERROR(testDecompress(decompressFilter(type), bufNew(0), 1, 1), FormatError, "unexpected eof in compressed data");
+    TEST_ERROR(testDecompress(decompressFilterP(type), bufNew(0), 1, 1), FormatError, "unexpected eof in compressed data");
 
     // -------------------------------------------------------------------------------------------------------------------------
     TEST_TITLE("error on truncated compression data");
@@ -144,7 +155,7 @@ testSuite(CompressType type, const char *decompressCmd)
     bufCatSub(truncated, compressed, 0, bufUsed(compressed) - 1);
 
     TEST_RESULT_UINT(bufUsed(truncated), bufUsed(compressed) - 1, "check truncated buffer size");
-    TEST_ERROR(testDecompress(decompressFilter(type), truncated, 512, 512), FormatError, "unexpected eof in compressed data");
+    TEST_ERROR(testDecompress(decompressFilterP(type), truncated, 512, 512), FormatError, "unexpected eof in compressed data");
 
     // -------------------------------------------------------------------------------------------------------------------------
     TEST_TITLE("compress a large non-zero input buffer into small output buffer");
@@ -160,11 +171,11 @@ testSuite(CompressType type, const char *decompressCmd)
     bufUsedSet(decompressed, bufSize(decompressed));
 
     TEST_ASSIGN(
-        compressed, testCompress(compressFilter(type, 3), decompressed, bufSize(decompressed), 32),
+        compressed, testCompress(compressFilterP(type, 3), decompressed, bufSize(decompressed), 32),
         "non-zero data - compress large in/small out buffer");
 
     TEST_RESULT_BOOL(
-        bufEq(decompressed, testDecompress(decompressFilter(type), compressed, bufSize(compressed), 1024 * 256)), true,
+        bufEq(decompressed, testDecompress(decompressFilterP(type), compressed, bufSize(compressed), 1024 * 256)), true,
         "non-zero data - decompress large in/small out buffer");
 }
 
@@ -303,17 +314,81 @@ testRun(void)
         TEST_RESULT_UINT(zstError(0), 0, "check success");
         TEST_ERROR(zstError((size_t)-12), FormatError, "zst error: [-12] Version not supported");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("compress with worker threads");
+
+        String *const data = strNew();
+
+        for (unsigned int lineIdx = 0; strSize(data) < 4 * 1024 * 1024; lineIdx++)
+            strCatFmt(data, "line %u of data compressed with worker threads\n", lineIdx);
+
+        Buffer *const decompressed = bufNewC(strZ(data), strSize(data));
+
+        VariantList *const compressParamList = varLstNew();
+        varLstAdd(compressParamList, varNewInt(3));
+        varLstAdd(compressParamList, varNewUInt(2));
+
+        Buffer *compressed = testCompress(
+            compressFilterVar(STRDEF(ZST_COMPRESS_FILTER_TYPE), compressParamList), decompressed, 65536, 65536);
+
+        TEST_RESULT_BOOL(
+            bufEq(decompressed, testDecompress(decompressFilterP(compressTypeZst), compressed, 65536, 65536)), true,
+            "compressed with threads from filter params can be decompressed");
+
+        compressed = testCompress(compressFilterP(compressTypeZst, 3, .threadTotal = 2), decompressed, 65536, 1024);
+
+        TEST_RESULT_BOOL(
+            bufEq(decompressed, testDecompress(decompressFilterP(compressTypeZst), compressed, 65536, 65536)), true,
+            "compressed with threads and small output buffer can be decompressed");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("compress with dictionary");
+
+        TEST_RESULT_BOOL(compressDictSupported(compressTypeZst), true, "zst supports dictionaries");
+        TEST_RESULT_BOOL(compressDictSupported(compressTypeGz), false, "gz does not support dictionaries");
+
+        Buffer *dict = NULL;
+        TEST_ASSIGN(dict, compressDictTrain(compressTypeZst, decompressed, 8192, 16384), "train dictionary");
+        TEST_RESULT_BOOL(dict != NULL, true, "dictionary trained");
+        TEST_RESULT_BOOL(compressDictId(compressTypeZst, dict) != 0, true, "dictionary has id");
+        TEST_RESULT_PTR(compressDictTrain(compressTypeZst, bufNew(0), 8192, 16384), NULL, "no samples to train");
+
+        compressed = testCompress(compressFilterP(compressTypeZst, 3, .dict = dict), decompressed, 65536, 65536);
+
+        TEST_RESULT_BOOL(
+            bufEq(
+                decompressed,
+                testDecompress(
+                    decompressFilterP(compressTypeZst, .dictLoad = testDictLoad, .dictLoadData = dict), compressed, 65536,
+                    65536)),
+            true, "compressed with dictionary can be decompressed");
+        TEST_RESULT_BOOL(
+            bufEq(
+                decompressed,
+                testDecompress(
+                    decompressFilterP(compressTypeZst, .dictLoad = testDictLoad, .dictLoadData = dict), compressed, 1, 65536)),
+            true, "frame header split between inputs");
+        TEST_ERROR(
+            testDecompress(
+                decompressFilterP(compressTypeZst, .dictLoad = testDictLoad, .dictLoadData = dict), bufNewC(bufPtr(compressed), 6),
+                1, 65536),
+            FormatError, "unexpected eof in compressed data");
+        TEST_ERROR_FMT(
+            testDecompress(decompressFilterP(compressTypeZst), compressed, 65536, 65536), FormatError,
+            "zst dictionary %u is required but cannot be loaded", compressDictId(compressTypeZst, dict));
+
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("zstDecompressToLog() and zstCompressToLog()");
 
-        ZstCompress *compress = (ZstCompress *)ioFilterDriver(zstCompressNew(14));
+        ZstCompress *compress = (ZstCompress *)ioFilterDriver(zstCompressNew(14, 0));
 
         compress->inputSame = true;
         compress->inputOffset = 49;
         compress->flushing = true;
 
         TEST_RESULT_STR_Z(
-            zstCompressToLog(compress), "{level: 14, inputSame: true, inputOffset: 49, flushing: true}", "format object");
+            zstCompressToLog(compress), "{level: 14, threadTotal: 0, inputSame: true, inputOffset: 49, flushing: true}",
+            "format object");
 
         ZstDecompress *decompress = (ZstDecompress *)ioFilterDriver(zstDecompressNew());
 
@@ -5,6 +5,7 @@ Test HTTP
 
 #include "common/io/fdRead.h"
 #include "common/io/fdWrite.h"
+#include "common/io/http/multipart.h"
 #include "common/io/tls/client.h"
 #include "common/io/socket/client.h"
 
@@ -104,6 +105,17 @@ testRun(void)
             httpHeaderToLog(httpHeaderDup(header, redact)), "{public: <redacted>, secret: 'secret-value'}",
             "dup and change redactions");
         TEST_RESULT_PTR(httpHeaderDup(NULL, NULL), NULL, "dup null header");
+
+        // Range
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_RESULT_STR_Z(httpHeaderToLog(httpHeaderPutRange(httpHeaderNew(NULL), 0, NULL)), "{}", "no range");
+        TEST_RESULT_STR_Z(
+            httpHeaderToLog(httpHeaderPutRange(httpHeaderNew(NULL), 0, VARUINT64(44))), "{range: 'bytes=0-43'}", "range limit");
+        TEST_RESULT_STR_Z(
+            httpHeaderToLog(httpHeaderPutRange(httpHeaderNew(NULL), 512, NULL)), "{range: 'bytes=512-'}", "range offset");
+        TEST_RESULT_STR_Z(
+            httpHeaderToLog(httpHeaderPutRange(httpHeaderNew(NULL), 512, VARUINT64(1))), "{range: 'bytes=512-512'}",
+            "range offset and limit");
     }
 
     // *****************************************************************************************************************************
@@ -268,6 +280,81 @@ testRun(void)
         TEST_RESULT_VOID(httpUrlFree(url), "free");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("httpMultipartStatusList() and httpMultipartStatusRetry()"))
+    {
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("status of each part");
+
+        List *statusList = NULL;
+
+        TEST_ASSIGN(
+            statusList,
+            httpMultipartStatusList(
+                BUFSTRDEF(
+                    "--batch\r\n"
+                    "Content-Type: application/http\r\n"
+                    "Content-ID: <response-1>\r\n"
+                    "\r\n"
+                    "HTTP/1.1 204 No Content\r\n"
+                    "\r\n"
+                    "--batch\r\n"
+                    "content-id: 0\r\n"
+                    "\r\n"
+                    "HTTP/1.1 503 Service Unavailable \r\n"
+                    "Content-Length: 0\r\n"
+                    "\r\n"
+                    "--batch--\r\n"),
+                2),
+            "status list");
+        TEST_RESULT_UINT(lstSize(statusList), 2, "status total");
+        TEST_RESULT_UINT(((HttpMultipartStatus *)lstGet(statusList, 0))->id, 1, "id");
+        TEST_RESULT_UINT(((HttpMultipartStatus *)lstGet(statusList, 0))->code, 204, "code");
+        TEST_RESULT_STR_Z(((HttpMultipartStatus *)lstGet(statusList, 0))->reason, "No Content", "reason");
+        TEST_RESULT_UINT(((HttpMultipartStatus *)lstGet(statusList, 1))->id, 0, "id");
+        TEST_RESULT_UINT(((HttpMultipartStatus *)lstGet(statusList, 1))->code, 503, "code");
+        TEST_RESULT_STR_Z(((HttpMultipartStatus *)lstGet(statusList, 1))->reason, "Service Unavailable", "reason");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("part with no Content-ID");
+
+        TEST_ERROR(
+            httpMultipartStatusList(BUFSTRDEF("--batch\r\n\r\nHTTP/1.1 204 No Content\r\n\r\n--batch--\r\n"), 1), FormatError,
+            "multipart response status 'HTTP/1.1 204 No Content' has no Content-ID");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("part with invalid Content-ID");
+
+        TEST_ERROR(
+            httpMultipartStatusList(BUFSTRDEF("--batch\r\nContent-ID: 1\r\n\r\nHTTP/1.1 204 No Content\r\n--batch--\r\n"), 1),
+            FormatError, "multipart response has invalid Content-ID 1");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("part with duplicate Content-ID");
+
+        TEST_ERROR(
+            httpMultipartStatusList(
+                BUFSTRDEF(
+                    "--batch\r\nContent-ID: 0\r\n\r\nHTTP/1.1 204 No Content\r\n"
+                    "--batch\r\nContent-ID: 0\r\n\r\nHTTP/1.1 204 No Content\r\n--batch--\r\n"),
+                2),
+            FormatError, "multipart response has duplicate Content-ID 0");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("truncated response is missing a part");
+
+        TEST_ERROR(
+            httpMultipartStatusList(BUFSTRDEF("--batch\r\nContent-ID: <response-1>\r\n\r\nHTTP/1.1 204 No Content\r\n"), 2),
+            FormatError, "multipart response is missing status for Content-ID 0");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("retry");
+
+        TEST_RESULT_BOOL(httpMultipartStatusRetry(429), true, "too many requests");
+        TEST_RESULT_BOOL(httpMultipartStatusRetry(500), true, "server error");
+        TEST_RESULT_BOOL(httpMultipartStatusRetry(403), false, "forbidden");
+    }
+
     // *****************************************************************************************************************************
     if (testBegin("HttpClient"))
     {
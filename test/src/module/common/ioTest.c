@@ -3,10 +3,12 @@ Test IO
 ***********************************************************************************************************************************/
 #include <fcntl.h>
 #include <netdb.h>
+#include <unistd.h>
 
 #include "common/type/json.h"
 
 #include "common/harnessFork.h"
+#include "common/harnessIoThrottle.h"
 
 /***********************************************************************************************************************************
 Test functions for IoRead that are not covered by testing the IoBufferRead object
@@ -241,6 +243,19 @@ ioTestFilterMultiplyNew(const char *type, unsigned int multiplier, unsigned int
     return this;
 }
 
+/***********************************************************************************************************************************
+Throttle limits for testing
+***********************************************************************************************************************************/
+static unsigned int testIoThrottleLimitTotal = 0;
+
+static IoThrottleLimit
+testIoThrottleLimit(void *const callbackData)
+{
+    testIoThrottleLimitTotal++;
+
+    return *(IoThrottleLimit *)callbackData;
+}
+
 /***********************************************************************************************************************************
 Test Run
 ***********************************************************************************************************************************/
@@ -627,6 +642,26 @@ testRun(void)
         TEST_RESULT_BOOL(fdReadyRetry(-1, EINTR, false, &timeout, timeMSec()), false, "no retry after timeout");
         TEST_ERROR(fdReadyRetry(-1, EINVAL, true, &timeout, 0), KernelError, "unable to poll socket: [22] Invalid argument");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("fdWriteSpace()");
+
+        int pipeFd[2];
+        THROW_ON_SYS_ERROR(pipe(pipeFd) == -1, KernelError, "unable to create pipe");
+
+        size_t pipeSpace = 0;
+        TEST_ASSIGN(pipeSpace, fdWriteSpace(pipeFd[1]), "empty pipe space");
+        TEST_RESULT_BOOL(pipeSpace > 0, true, "empty pipe has space");
+
+        THROW_ON_SYS_ERROR(write(pipeFd[1], "1234", 4) != 4, FileWriteError, "unable to write pipe");
+        TEST_RESULT_UINT(fdWriteSpace(pipeFd[1]), pipeSpace - 4, "space less written bytes");
+
+        close(pipeFd[0]);
+        close(pipeFd[1]);
+
+        TEST_RESULT_UINT(fdWriteSpace(fd), 0, "no space reported for file");
+
+        close(fd);
+
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("write is not ready on bad socket connection");
 
@@ -676,5 +711,110 @@ testRun(void)
         TRY_END();
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("IoThrottle"))
+    {
+        // Use a virtual clock so sleeps can be checked exactly and the test does not wait
+        hrnIoThrottleClockInstall(1000000);
+
+        IoThrottleLimit limit = {.byteRate = 10000};
+        IoThrottle *throttle = NULL;
+
+        TEST_ASSIGN(throttle, ioThrottleNew(NULL, testIoThrottleLimit, &limit), "new throttle");
+        TEST_RESULT_UINT(testIoThrottleLimitTotal, 1, "limits loaded");
+
+        TEST_TITLE("burst does not sleep but the next consume does");
+
+        TEST_RESULT_VOID(ioThrottleConsume(throttle, 1000), "consume burst");
+        TEST_RESULT_UINT(hrnIoThrottleClock(), 1000000, "no sleep");
+        TEST_RESULT_VOID(ioThrottleConsume(throttle, 1000), "consume");
+        TEST_RESULT_UINT(hrnIoThrottleClock(), 1000100, "sleep");
+
+        TEST_TITLE("limits are not refreshed before the interval");
+
+        limit = (IoThrottleLimit){0};
+
+        TEST_RESULT_VOID(ioThrottleConsume(throttle, 1000), "consume");
+        TEST_RESULT_UINT(hrnIoThrottleClock(), 1000200, "sleep");
+        TEST_RESULT_UINT(testIoThrottleLimitTotal, 1, "limits not reloaded");
+
+        TEST_TITLE("limits are refreshed and no limit does not sleep");
+
+        hrnIoThrottleClockAdd(IO_THROTTLE_REFRESH);
+
+        TEST_RESULT_VOID(ioThrottleConsume(throttle, 1000000), "consume");
+        TEST_RESULT_VOID(ioThrottleConsume(throttle, 1000000), "consume");
+        TEST_RESULT_UINT(hrnIoThrottleClock(), 1001200, "no sleep");
+        TEST_RESULT_UINT(testIoThrottleLimitTotal, 2, "limits reloaded");
+
+        TEST_RESULT_VOID(ioThrottleFree(throttle), "free throttle");
+
+        TEST_TITLE("operations are limited and shared between throttles");
+
+        limit = (IoThrottleLimit){.opRate = 100};
+
+        IoThrottle *throttle1 = NULL;
+        IoThrottle *throttle2 = NULL;
+
+        TEST_ASSIGN(throttle1, ioThrottleNew(STRDEF(TEST_PATH "/throttle"), testIoThrottleLimit, &limit), "new throttle");
+        TEST_ASSIGN(throttle2, ioThrottleNew(STRDEF(TEST_PATH "/throttle"), testIoThrottleLimit, &limit), "new throttle");
+
+        for (unsigned int opIdx = 0; opIdx < 10; opIdx++)
+            ioThrottleConsume(opIdx % 2 == 0 ? throttle1 : throttle2, 1);
+
+        TEST_RESULT_UINT(hrnIoThrottleClock(), 1001200, "no sleep during burst");
+
+        // Each throttle has only done half the operations so they would not sleep yet if the state were not shared
+        TEST_RESULT_VOID(ioThrottleConsume(throttle1, 1), "consume");
+        TEST_RESULT_UINT(hrnIoThrottleClock(), 1001210, "sleep after burst");
+        TEST_RESULT_VOID(ioThrottleConsume(throttle2, 1), "consume");
+        TEST_RESULT_UINT(hrnIoThrottleClock(), 1001220, "sleep after burst");
+        TEST_RESULT_INT(unlink(TEST_PATH "/throttle"), 0, "remove state file");
+
+        TEST_RESULT_VOID(ioThrottleFree(throttle1), "free throttle");
+        TEST_RESULT_VOID(ioThrottleFree(throttle2), "free throttle");
+
+        TEST_TITLE("error on missing path");
+
+        TEST_ASSIGN(throttle, ioThrottleNew(STRDEF(TEST_PATH "/missing/throttle"), testIoThrottleLimit, &limit), "new throttle");
+        TEST_ERROR(
+            ioThrottleConsume(throttle, 1), FileOpenError,
+            "unable to open throttle state file '" TEST_PATH "/missing/throttle': [2] No such file or directory");
+
+        TEST_TITLE("throttle read and write");
+
+        limit = (IoThrottleLimit){.byteRate = 1000};
+        ioBufferSizeSet(1000);
+
+        TEST_ASSIGN(throttle, ioThrottleNew(NULL, testIoThrottleLimit, &limit), "new throttle");
+
+        Buffer *data = bufNew(1000);
+        memset(bufPtr(data), 'X', bufSize(data));
+        bufUsedSet(data, bufSize(data));
+
+        Buffer *buffer = bufNew(0);
+        IoWrite *write = ioBufferWriteNew(buffer);
+
+        TEST_RESULT_VOID(ioWriteThrottleSet(write, throttle), "set write throttle");
+
+        ioWriteOpen(write);
+        ioWrite(write, data);
+        ioWriteClose(write);
+
+        // The first 100ms is burst
+        TEST_RESULT_UINT(bufUsed(buffer), 1000, "check write");
+        TEST_RESULT_UINT(hrnIoThrottleClock(), 1002120, "write throttled");
+
+        IoRead *read = ioBufferReadNew(buffer);
+
+        TEST_RESULT_VOID(ioReadThrottleSet(read, throttle), "set read throttle");
+
+        ioReadOpen(read);
+        TEST_RESULT_UINT(bufUsed(ioReadBuf(read)), 1000, "check read");
+        TEST_RESULT_UINT(hrnIoThrottleClock(), 1003120, "read throttled");
+
+        hrnIoThrottleClockUninstall();
+    }
+
     FUNCTION_HARNESS_RETURN_VOID();
 }
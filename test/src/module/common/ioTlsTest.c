@@ -1,11 +1,13 @@
 /***********************************************************************************************************************************
-Test Tls Client
+Test Tls Client/Server
 ***********************************************************************************************************************************/
 #include <fcntl.h>
 #include <unistd.h>
 
 #include "common/io/fdRead.h"
 #include "common/io/fdWrite.h"
+#include "common/io/socket/server.h"
+#include "common/io/tls/server.h"
 
 #include "common/harnessFork.h"
 #include "common/harnessServer.h"
@@ -191,9 +193,9 @@ testRun(void)
 
     // Additional coverage not provided by testing with actual certificates
     // *****************************************************************************************************************************
-    if (testBegin("asn1ToStr(), tlsClientHostVerify(), and tlsClientHostVerifyName()"))
+    if (testBegin("tlsAsn1ToStr(), tlsClientHostVerify(), and tlsClientHostVerifyName()"))
     {
-        TEST_ERROR(asn1ToStr(NULL), CryptoError, "TLS certificate name entry is missing");
+        TEST_ERROR(tlsAsn1ToStr(NULL), CryptoError, "TLS certificate name entry is missing");
 
         TEST_ERROR(
             tlsClientHostVerifyName(
@@ -214,14 +216,14 @@ testRun(void)
         // Connection errors
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_ASSIGN(
-            client, tlsClientNew(sckClientNew(STRDEF("99.99.99.99.99"), 7777, 0), STRDEF("X"), 0, true, NULL, NULL),
+            client, tlsClientNewP(sckClientNew(STRDEF("99.99.99.99.99"), 7777, 0), STRDEF("X"), 0, true),
             "new client");
         TEST_RESULT_STR_Z(ioClientName(client), "99.99.99.99.99:7777", " check name");
         TEST_ERROR(
             ioClientOpen(client), HostConnectError, "unable to get address for '99.99.99.99.99': [-2] Name or service not known");
 
         TEST_ASSIGN(
-            client, tlsClientNew(sckClientNew(STRDEF("localhost"), hrnServerPort(0), 100), STRDEF("X"), 100, true, NULL, NULL),
+            client, tlsClientNewP(sckClientNew(STRDEF("localhost"), hrnServerPort(0), 100), STRDEF("X"), 100, true),
             "new client");
         TEST_ERROR_FMT(
             ioClientOpen(client), HostConnectError, "unable to connect to 'localhost:%u': [111] Connection refused",
@@ -232,9 +234,9 @@ testRun(void)
 
         TEST_ERROR(
             ioClientOpen(
-                tlsClientNew(
-                    sckClientNew(
-                        STRDEF("localhost"), hrnServerPort(0), 5000), STRDEF("X"), 0, true, STRDEF("bogus.crt"), STRDEF("/bogus"))),
+                tlsClientNewP(
+                    sckClientNew(STRDEF("localhost"), hrnServerPort(0), 5000), STRDEF("X"), 0, true, .caFile = STRDEF("bogus.crt"),
+                    .caPath = STRDEF("/bogus"))),
             CryptoError, "unable to set user-defined CA certificate location: [33558530] No such file or directory");
 
         // Certificate location and validation errors
@@ -271,9 +273,9 @@ testRun(void)
 
                 TEST_ERROR_FMT(
                     ioClientOpen(
-                        tlsClientNew(
-                            sckClientNew(STRDEF("localhost"), hrnServerPort(0), 5000), STRDEF("X"), 0, true, NULL,
-                            STRDEF("/bogus"))),
+                        tlsClientNewP(
+                            sckClientNew(STRDEF("localhost"), hrnServerPort(0), 5000), STRDEF("X"), 0, true,
+                            .caPath = STRDEF("/bogus"))),
                     CryptoError,
                     "unable to verify certificate presented by 'localhost:%u': [20] unable to get local issuer certificate",
                     hrnServerPort(0));
@@ -286,9 +288,9 @@ testRun(void)
 
                 TEST_RESULT_VOID(
                     ioClientOpen(
-                        tlsClientNew(
+                        tlsClientNewP(
                             sckClientNew(STRDEF("test.pgbackrest.org"), hrnServerPort(0), 5000), STRDEF("test.pgbackrest.org"),
-                            0, true, STRDEF(HRN_PATH_REPO "/" HRN_SERVER_CERT_PREFIX "-ca.crt"), NULL)),
+                            0, true, .caFile = STRDEF(HRN_PATH_REPO "/" HRN_SERVER_CERT_PREFIX "-ca.crt"))),
                     "open connection");
 
                 // -----------------------------------------------------------------------------------------------------------------
@@ -299,10 +301,10 @@ testRun(void)
 
                 TEST_RESULT_VOID(
                     ioClientOpen(
-                        tlsClientNew(
+                        tlsClientNewP(
                             sckClientNew(STRDEF("host.test2.pgbackrest.org"), hrnServerPort(0), 5000),
                             STRDEF("host.test2.pgbackrest.org"), 0, true,
-                            STRDEF(HRN_PATH_REPO "/" HRN_SERVER_CERT_PREFIX "-ca.crt"), NULL)),
+                            .caFile = STRDEF(HRN_PATH_REPO "/" HRN_SERVER_CERT_PREFIX "-ca.crt"))),
                     "open connection");
 
                 // -----------------------------------------------------------------------------------------------------------------
@@ -313,9 +315,9 @@ testRun(void)
 
                 TEST_ERROR(
                     ioClientOpen(
-                        tlsClientNew(
+                        tlsClientNewP(
                             sckClientNew(STRDEF("test3.pgbackrest.org"), hrnServerPort(0), 5000), STRDEF("test3.pgbackrest.org"),
-                            0, true, STRDEF(HRN_PATH_REPO "/" HRN_SERVER_CERT_PREFIX "-ca.crt"), NULL)),
+                            0, true, .caFile = STRDEF(HRN_PATH_REPO "/" HRN_SERVER_CERT_PREFIX "-ca.crt"))),
                     CryptoError,
                     "unable to find hostname 'test3.pgbackrest.org' in certificate common name or subject alternative names");
 
@@ -327,10 +329,9 @@ testRun(void)
 
                 TEST_ERROR_FMT(
                     ioClientOpen(
-                        tlsClientNew(
+                        tlsClientNewP(
                             sckClientNew(STRDEF("localhost"), hrnServerPort(0), 5000), STRDEF("X"), 0, true,
-                            STRDEF(HRN_PATH_REPO "/" HRN_SERVER_CERT_PREFIX ".crt"),
-                        NULL)),
+                            .caFile = STRDEF(HRN_PATH_REPO "/" HRN_SERVER_CERT_PREFIX ".crt"))),
                     CryptoError,
                     "unable to verify certificate presented by 'localhost:%u': [20] unable to get local issuer certificate",
                     hrnServerPort(0));
@@ -343,8 +344,8 @@ testRun(void)
 
                 TEST_RESULT_VOID(
                     ioClientOpen(
-                        tlsClientNew(
-                            sckClientNew(STRDEF("localhost"), hrnServerPort(0), 5000), STRDEF("X"), 0, false, NULL, NULL)),
+                        tlsClientNewP(
+                            sckClientNew(STRDEF("localhost"), hrnServerPort(0), 5000), STRDEF("X"), 0, false)),
                         "open connection");
 
                 // -----------------------------------------------------------------------------------------------------------------
@@ -377,9 +378,8 @@ testRun(void)
 
                 TEST_ASSIGN(
                     client,
-                    tlsClientNew(
-                        sckClientNew(hrnServerHost(), hrnServerPort(0), 5000), hrnServerHost(), 0, TEST_IN_CONTAINER, NULL,
-                        NULL),
+                    tlsClientNewP(
+                        sckClientNew(hrnServerHost(), hrnServerPort(0), 5000), hrnServerHost(), 0, TEST_IN_CONTAINER),
                     "new client");
 
                 hrnServerScriptAccept(tls);
@@ -498,5 +498,91 @@ testRun(void)
         TEST_RESULT_BOOL(varLstEmpty(kvKeyList(statToKv())), false, "check");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("TlsServer"))
+    {
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("server errors");
+
+        TEST_ERROR(
+            tlsServerNew(STRDEF("localhost"), STRDEF("bogus.crt"), STRDEF("bogus.key"), STRDEF("bogus.crt"), 5000), CryptoError,
+            "unable to load cert file 'bogus.crt': [33558530] No such file or directory");
+
+        TEST_ERROR(
+            ioServerAccept(sckServerNew(STRDEF("99.99.99.99.99"), hrnServerPort(0), 5000), NULL), HostConnectError,
+            "unable to get address for '99.99.99.99.99': [-2] Name or service not known");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        HRN_FORK_BEGIN()
+        {
+            HRN_FORK_CHILD_BEGIN(.prefix = "test server", .timeout = 5000)
+            {
+                IoServer *tlsServer = NULL;
+                IoServer *socketServer = NULL;
+
+                TEST_ASSIGN(
+                    tlsServer,
+                    tlsServerNew(
+                        STRDEF("localhost"), STRDEF(HRN_PATH_REPO "/" HRN_SERVER_CERT_PREFIX "-ca.crt"),
+                        STRDEF(HRN_PATH_REPO "/" HRN_SERVER_CERT_PREFIX ".key"),
+                        STRDEF(HRN_PATH_REPO "/" HRN_SERVER_CERT_PREFIX "-alt-name.crt"), 5000),
+                    "new tls server");
+                TEST_RESULT_STR_Z(ioServerName(tlsServer), "localhost", "tls server name");
+                TEST_ASSIGN(socketServer, sckServerNew(STRDEF("localhost"), hrnServerPort(0), 5000), "new socket server");
+                TEST_RESULT_STR(
+                    ioServerName(socketServer), strNewFmt("localhost:%u", hrnServerPort(0)), "socket server name");
+
+                // Notify the client that the server is listening
+                HRN_FORK_CHILD_NOTIFY_PUT();
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("client with a certificate is authenticated");
+
+                IoSession *session = NULL;
+
+                TEST_ASSIGN(session, ioServerAccept(tlsServer, ioServerAccept(socketServer, NULL)), "accept session");
+                TEST_RESULT_BOOL(ioSessionAuthenticated(session), true, "session authenticated");
+                TEST_RESULT_STR_Z(ioSessionPeerName(session), "*.test.pgbackrest.org", "peer name is certificate common name");
+
+                TEST_RESULT_STR_Z(ioReadLine(ioSessionIoRead(session)), "request", "read request");
+                TEST_RESULT_VOID(ioWriteStrLine(ioSessionIoWrite(session), STRDEF("reply")), "write reply");
+                TEST_RESULT_VOID(ioWriteFlush(ioSessionIoWrite(session)), "flush reply");
+
+                TEST_RESULT_VOID(ioSessionClose(session), "close session");
+                TEST_RESULT_VOID(ioServerFree(socketServer), "free socket server");
+                TEST_RESULT_VOID(ioServerFree(tlsServer), "free tls server");
+            }
+            HRN_FORK_CHILD_END();
+
+            HRN_FORK_PARENT_BEGIN(.prefix = "test client", .timeout = 5000)
+            {
+                HRN_FORK_PARENT_NOTIFY_GET(0);
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("client with a certificate is authenticated");
+
+                IoSession *session = NULL;
+
+                TEST_ASSIGN(
+                    session,
+                    ioClientOpen(
+                        tlsClientNewP(
+                            sckClientNew(STRDEF("localhost"), hrnServerPort(0), 5000), STRDEF("test.pgbackrest.org"), 5000, true,
+                            .caFile = STRDEF(HRN_PATH_REPO "/" HRN_SERVER_CERT_PREFIX "-ca.crt"),
+                            .certFile = STRDEF(HRN_PATH_REPO "/" HRN_SERVER_CERT_PREFIX ".crt"),
+                            .keyFile = STRDEF(HRN_PATH_REPO "/" HRN_SERVER_CERT_PREFIX ".key"))),
+                    "open session");
+
+                TEST_RESULT_VOID(ioWriteStrLine(ioSessionIoWrite(session), STRDEF("request")), "write request");
+                TEST_RESULT_VOID(ioWriteFlush(ioSessionIoWrite(session)), "flush request");
+                TEST_RESULT_STR_Z(ioReadLine(ioSessionIoRead(session)), "reply", "read reply");
+
+                TEST_RESULT_VOID(ioSessionClose(session), "close session");
+            }
+            HRN_FORK_PARENT_END();
+        }
+        HRN_FORK_END();
+    }
+
     FUNCTION_HARNESS_RETURN_VOID();
 }
@@ -146,7 +146,7 @@ testRun(void)
             "context child list initial size");
 
         // This test will change if the contexts above change
-        TEST_RESULT_UINT(memContextSize(memContextTop()), TEST_64BIT() ? 960 : 544, "check size");
+        TEST_RESULT_UINT(memContextSize(memContextTop()), TEST_64BIT() ? 1024 : 576, "check size");
 
         TEST_ERROR(
             memContextFree(memContextTop()->contextChildList[MEM_CONTEXT_INITIAL_SIZE]),
@@ -223,7 +223,7 @@ testRun(void)
         TEST_RESULT_UINT(memContextCurrent()->allocFreeIdx, MEM_CONTEXT_ALLOC_INITIAL_SIZE + 3, "check alloc free idx");
 
         // This test will change if the allocations above change
-        TEST_RESULT_UINT(memContextSize(memContextCurrent()), TEST_64BIT() ? 249 : 165, "check size");
+        TEST_RESULT_UINT(memContextSize(memContextCurrent()), TEST_64BIT() ? 257 : 169, "check size");
 
         TEST_ERROR(
             memFree(NULL), AssertError,
@@ -237,6 +237,65 @@ testRun(void)
 
         memContextSwitch(memContextTop());
         memContextFree(memContext);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("arena allocations");
+
+        memContext = memContextNewArena("test-arena");
+        memContextKeep();
+        memContextSwitch(memContext);
+
+        TEST_RESULT_BOOL(memContext->arena, true, "context is arena");
+        TEST_RESULT_PTR(memContext->arenaChunk, NULL, "no chunk before first allocation");
+
+        unsigned char *arena1 = memNew(3);
+        unsigned char *arena2 = memNew(8);
+
+        TEST_RESULT_UINT(MEM_CONTEXT_ALLOC_HEADER(arena1)->allocIdx, MEM_CONTEXT_ALLOC_IDX_ARENA, "allocation is in arena");
+        TEST_RESULT_UINT(memContext->allocFreeIdx, 0, "allocation list not used");
+        TEST_RESULT_UINT(memContext->arenaChunk->size, MEM_CONTEXT_ARENA_CHUNK_SIZE_MIN, "first chunk size");
+        TEST_RESULT_UINT(memContext->arenaChunk->used, sizeof(MemContextAlloc) * 2 + sizeof(MemContextAlloc) * 2, "chunk used");
+        TEST_RESULT_PTR(arena2, arena1 + sizeof(MemContextAlloc) * 2, "allocations are contiguous and aligned");
+
+        TEST_RESULT_VOID(memFree(arena2), "free is a noop");
+        TEST_RESULT_UINT(memContext->arenaChunk->used, sizeof(MemContextAlloc) * 4, "chunk used is unchanged");
+
+        memset(arena1, 0xFE, 3);
+        unsigned char *arenaResize = memResize(arena1, 64);
+
+        TEST_RESULT_BOOL(arenaResize != arena1, true, "resize makes a new allocation");
+        TEST_RESULT_BOOL(arenaResize[0] == 0xFE && arenaResize[1] == 0xFE && arenaResize[2] == 0xFE, true, "contents copied");
+
+        arenaResize = memResize(arenaResize, 2);
+        TEST_RESULT_BOOL(arenaResize[0] == 0xFE && arenaResize[1] == 0xFE, true, "contents copied when shrinking");
+
+        unsigned char *arenaLarge = memNew(MEM_CONTEXT_ARENA_ALLOC_SIZE_MAX + 1);
+        TEST_RESULT_UINT(MEM_CONTEXT_ALLOC_HEADER(arenaLarge)->allocIdx, 0, "large allocation is in allocation list");
+        TEST_RESULT_VOID(memFree(arenaLarge), "free large allocation");
+        TEST_RESULT_UINT(memContext->allocFreeIdx, 0, "large allocation freed");
+
+        TEST_RESULT_PTR(memContext->arenaChunk->prior, NULL, "single chunk");
+
+        for (unsigned int allocIdx = 0; allocIdx < 256; allocIdx++)
+            memNew(MEM_CONTEXT_ARENA_ALLOC_SIZE_MAX);
+
+        TEST_RESULT_UINT(memContext->arenaChunk->size, MEM_CONTEXT_ARENA_CHUNK_SIZE_MAX, "chunk size is capped");
+        TEST_RESULT_UINT(
+            memContext->arenaChunk->prior->size, MEM_CONTEXT_ARENA_CHUNK_SIZE_MAX, "prior chunk size is capped");
+        TEST_RESULT_UINT(memContext->arenaChunk->prior->prior->size, 32 * 1024, "chunk size doubles");
+
+        size_t arenaChunkSize = 0;
+
+        for (const MemContextArenaChunk *chunk = memContext->arenaChunk; chunk != NULL; chunk = chunk->prior)
+            arenaChunkSize += sizeof(MemContextArenaChunk) + chunk->size;
+
+        TEST_RESULT_UINT(
+            memContextSize(memContext),
+            sizeof(MemContext) + sizeof(MemContextAlloc *) * MEM_CONTEXT_ALLOC_INITIAL_SIZE + arenaChunkSize, "check size");
+
+        memContextSwitch(memContextTop());
+        TEST_RESULT_VOID(memContextFree(memContext), "free arena context");
+        TEST_RESULT_PTR(memContext->arenaChunk, NULL, "chunks freed");
     }
 
     // *****************************************************************************************************************************
@@ -301,12 +360,12 @@ testRun(void)
         // -------------------------------------------------------------------------------------------------------------------------
         MEM_CONTEXT_TEMP_RESET_BEGIN()
         {
-            TEST_RESULT_PTR(MEM_CONTEXT_TEMP()->allocList[0], NULL, "nothing allocated");
+            TEST_RESULT_PTR(MEM_CONTEXT_TEMP()->arenaChunk, NULL, "nothing allocated");
             memNew(99);
-            TEST_RESULT_PTR_NE(MEM_CONTEXT_TEMP()->allocList[0], NULL, "1 allocation");
+            TEST_RESULT_PTR_NE(MEM_CONTEXT_TEMP()->arenaChunk, NULL, "1 allocation");
 
             MEM_CONTEXT_TEMP_RESET(1);
-            TEST_RESULT_PTR(MEM_CONTEXT_TEMP()->allocList[0], NULL, "nothing allocated");
+            TEST_RESULT_PTR(MEM_CONTEXT_TEMP()->arenaChunk, NULL, "nothing allocated");
         }
         MEM_CONTEXT_TEMP_END();
     }
@@ -46,6 +46,13 @@ testRun(void)
 
         TEST_RESULT_VOID(lstClear(list), "clear list");
         TEST_RESULT_STR_Z(lstToLog(list), "{size: 0}", "check log after clear");
+        TEST_RESULT_VOID(lstClear(list), "clear empty list");
+
+        TEST_RESULT_VOID(lstAdd(list, &ptr), "add item");
+        TEST_RESULT_VOID(lstAdd(list, &ptr), "add item");
+        TEST_RESULT_VOID(lstRemoveIdx(list, 0), "remove first item");
+        TEST_RESULT_VOID(lstClear(list), "clear list after first item removed");
+        TEST_RESULT_STR_Z(lstToLog(list), "{size: 0}", "check log after clear");
 
         TEST_RESULT_VOID(lstFree(list), "free list");
         TEST_RESULT_VOID(lstFree(lstNewP(1)), "free empty list");
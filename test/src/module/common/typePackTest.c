@@ -348,6 +348,22 @@ testRun(void)
         TEST_RESULT_Z(pckReadPtrP(packRead), NULL, "read default pointer");
         TEST_RESULT_Z(pckReadPtrP(packRead, .id = 2), "sample", "read pointer");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("skip pack");
+
+        PackWrite *packSkip = pckWriteNewBuf(bufNew(0));
+        pckWriteStrP(packSkip, STRDEF("skipped"));
+        pckWriteEndP(packSkip);
+
+        TEST_ASSIGN(packWrite, pckWriteNewBuf(bufNew(0)), "new write");
+        TEST_RESULT_VOID(pckWritePackP(packWrite, packSkip), "write pack");
+        TEST_RESULT_VOID(pckWriteU32P(packWrite, 77), "write u32");
+        TEST_RESULT_VOID(pckWriteEndP(packWrite), "write end");
+
+        TEST_ASSIGN(packRead, pckReadNewBuf(pckWriteBuf(packWrite)), "new read");
+        TEST_RESULT_UINT(pckReadU32P(packRead, .id = 2), 77, "read u32 after skipped pack");
+        TEST_RESULT_VOID(pckReadEndP(packRead), "end");
+
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("pack/unpack write internal buffer empty");
 
@@ -1,6 +1,8 @@
 /***********************************************************************************************************************************
 Test Wait Handler
 ***********************************************************************************************************************************/
+#include <fcntl.h>
+#include <unistd.h>
 
 /***********************************************************************************************************************************
 Test Run
@@ -65,5 +67,64 @@ testRun(void)
         TEST_RESULT_VOID(waitFree(wait), "    free wait");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("watchNew(), watchPathAdd(), watchWait(), and waitWatchSet()"))
+    {
+        Watch *watch = NULL;
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("wait without a path sleeps");
+
+        TEST_ASSIGN(watch, watchNew(), "new watch");
+        TEST_RESULT_BOOL(watchWait(watch, 10), false, "no change");
+        TEST_RESULT_BOOL(watchPathAdd(watch, STRDEF(TEST_PATH "/watch")), false, "missing path is not watched");
+
+        HRN_SYSTEM("touch " TEST_PATH "/file");
+
+        TEST_ERROR(
+            watchPathAdd(watch, STRDEF(TEST_PATH "/file")), PathOpenError,
+            "unable to watch path '" TEST_PATH "/file': [20] Not a directory");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("file written and moved into path");
+
+        HRN_SYSTEM("mkdir " TEST_PATH "/watch");
+
+        TEST_RESULT_BOOL(watchPathAdd(watch, STRDEF(TEST_PATH "/watch")), true, "add path");
+        TEST_RESULT_BOOL(watchWait(watch, 10), false, "no change");
+
+        int fd = open(TEST_PATH "/watch/written", O_CREAT | O_TRUNC | O_WRONLY, 0640);
+        TEST_RESULT_INT(write(fd, "X", 1), 1, "write file");
+        close(fd);
+
+        TimeMSec begin = timeMSec();
+
+        TEST_RESULT_BOOL(watchWait(watch, 5000), true, "file written");
+        TEST_RESULT_BOOL(timeMSec() - begin < 5000, true, "    did not wait for timeout");
+        TEST_RESULT_BOOL(watchWait(watch, 10), false, "all changes were reported");
+
+        HRN_SYSTEM("mv " TEST_PATH "/file " TEST_PATH "/watch/moved");
+
+        TEST_RESULT_BOOL(watchWait(watch, 5000), true, "file moved");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("wait wakes on change");
+
+        Wait *wait = NULL;
+
+        TEST_ASSIGN(wait, waitNew(5000), "new wait");
+        TEST_RESULT_VOID(waitWatchSet(wait, watch), "set watch");
+
+        HRN_SYSTEM("touch " TEST_PATH "/watch/touched");
+
+        begin = timeMSec();
+
+        TEST_RESULT_BOOL(waitMore(wait), true, "wait more");
+        TEST_RESULT_BOOL(timeMSec() - begin < 100, true, "    did not sleep");
+
+        TEST_RESULT_VOID(waitFree(wait), "free wait");
+        TEST_RESULT_VOID(watchFree(watch), "free watch");
+    }
+
     FUNCTION_HARNESS_RETURN_VOID();
 }
@@ -555,6 +555,12 @@ testRun(void)
         TEST_RESULT_UINT(convertToByte(STRDEF("11")), 11, "11 - no qualifier, default bytes");
         TEST_RESULT_UINT(convertToByte(STRDEF("4pB")), 4503599627370496, "4pB");
         TEST_RESULT_UINT(convertToByte(STRDEF("15MB")), (uint64_t)15 * 1024 * 1024, "15MB");
+        TEST_RESULT_UINT(cfgParseSize(STRDEF("2mb")), (uint64_t)2 * 1024 * 1024, "cfgParseSize()");
+
+        TEST_RESULT_BOOL(cfgParseOptionRangeValid(cfgCmdBackup, cfgOptThrottleWrite, 1023), false, "below range");
+        TEST_RESULT_BOOL(cfgParseOptionRangeValid(cfgCmdBackup, cfgOptThrottleWrite, 1024), true, "in range");
+        TEST_RESULT_BOOL(cfgParseOptionRangeValid(cfgCmdBackup, cfgOptThrottleWriteIops, 1000001), false, "above range");
+        TEST_RESULT_BOOL(cfgParseOptionRangeValid(cfgCmdBackup, cfgOptStanza, -1), true, "no range");
     }
 
     // *****************************************************************************************************************************
@@ -5,6 +5,8 @@ Test Backup Manifest Handler
 
 #include "common/io/bufferRead.h"
 #include "common/io/bufferWrite.h"
+#include "common/type/json.h"
+#include "common/type/pack.h"
 #include "info/infoBackup.h"
 #include "storage/posix/storage.h"
 
@@ -31,7 +33,7 @@ testRun(void)
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_RESULT_UINT(sizeof(ManifestLoadFound), TEST_64BIT() ? 1 : 1, "check size of ManifestLoadFound");
         TEST_RESULT_UINT(sizeof(ManifestPath), TEST_64BIT() ? 32 : 16, "check size of ManifestPath");
-        TEST_RESULT_UINT(sizeof(ManifestFile), TEST_64BIT() ? 120 : 92, "check size of ManifestFile");
+        TEST_RESULT_UINT(sizeof(ManifestFile), TEST_64BIT() ? 144 : 116, "check size of ManifestFile");
     }
 
     // *****************************************************************************************************************************
@@ -248,7 +250,7 @@ testRun(void)
         Manifest *manifest = NULL;
         TEST_ASSIGN(
             manifest,
-            manifestNewBuild(storagePg, PG_VERSION_83, hrnPgCatalogVersion(PG_VERSION_83), false, false, exclusionList, NULL),
+            manifestNewBuild(storagePg, PG_VERSION_83, hrnPgCatalogVersion(PG_VERSION_83), false, false, exclusionList, NULL, NULL),
             "build manifest");
 
         Buffer *contentSave = bufNew(0);
@@ -356,7 +358,7 @@ testRun(void)
 
         // Test manifest - mode stored for shared cluster tablespace dir, pg_xlog contents ignored because online
         TEST_ASSIGN(
-            manifest, manifestNewBuild(storagePg, PG_VERSION_84, hrnPgCatalogVersion(PG_VERSION_84), true, false, NULL, NULL),
+            manifest, manifestNewBuild(storagePg, PG_VERSION_84, hrnPgCatalogVersion(PG_VERSION_84), true, false, NULL, NULL, NULL),
             "build manifest");
 
         contentSave = bufNew(0);
@@ -464,7 +466,8 @@ testRun(void)
 
         // Test tablespace error
         TEST_ERROR(
-            manifestNewBuild(storagePg, PG_VERSION_90, hrnPgCatalogVersion(PG_VERSION_90), false, false, NULL, tablespaceList),
+            manifestNewBuild(
+                storagePg, PG_VERSION_90, hrnPgCatalogVersion(PG_VERSION_90), false, false, NULL, tablespaceList, NULL),
             AssertError,
             "tablespace with oid 1 not found in tablespace map\n"
             "HINT: was a tablespace created or dropped during the backup?");
@@ -478,7 +481,8 @@ testRun(void)
         // Test manifest - temp tables and pg_notify files ignored
         TEST_ASSIGN(
             manifest,
-            manifestNewBuild(storagePg, PG_VERSION_90, hrnPgCatalogVersion(PG_VERSION_90), false, false, NULL, tablespaceList),
+            manifestNewBuild(
+                storagePg, PG_VERSION_90, hrnPgCatalogVersion(PG_VERSION_90), false, false, NULL, tablespaceList, NULL),
             "build manifest");
 
         contentSave = bufNew(0);
@@ -566,7 +570,7 @@ testRun(void)
 
         // Test manifest - temp tables, unlogged tables, pg_serial and pg_xlog files ignored
         TEST_ASSIGN(
-            manifest, manifestNewBuild(storagePg, PG_VERSION_91, hrnPgCatalogVersion(PG_VERSION_91), true, false, NULL, NULL),
+            manifest, manifestNewBuild(storagePg, PG_VERSION_91, hrnPgCatalogVersion(PG_VERSION_91), true, false, NULL, NULL, NULL),
             "build manifest");
 
         contentSave = bufNew(0);
@@ -645,7 +649,8 @@ testRun(void)
 
         // Test manifest - pg_snapshots files ignored
         TEST_ASSIGN(
-            manifest, manifestNewBuild(storagePg, PG_VERSION_92, hrnPgCatalogVersion(PG_VERSION_92), false, false, NULL, NULL),
+            manifest,
+            manifestNewBuild(storagePg, PG_VERSION_92, hrnPgCatalogVersion(PG_VERSION_92), false, false, NULL, NULL, NULL),
             "build manifest");
 
         contentSave = bufNew(0);
@@ -707,7 +712,7 @@ testRun(void)
         THROW_ON_SYS_ERROR(symlink(TEST_PATH "/wal", TEST_PATH "/wal/wal") == -1, FileOpenError, "unable to create symlink");
 
         TEST_ERROR(
-            manifestNewBuild(storagePg, PG_VERSION_92, hrnPgCatalogVersion(PG_VERSION_92), false, false, NULL, NULL),
+            manifestNewBuild(storagePg, PG_VERSION_92, hrnPgCatalogVersion(PG_VERSION_92), false, false, NULL, NULL, NULL),
             LinkDestinationError,
             "link 'pg_xlog/wal' (" TEST_PATH "/wal) destination is the same directory as link 'pg_xlog' (" TEST_PATH "/wal)");
 
@@ -761,7 +766,7 @@ testRun(void)
 
         // Test manifest - pg_dynshmem, pg_replslot and postgresql.auto.conf.tmp files ignored
         TEST_ASSIGN(
-            manifest, manifestNewBuild(storagePg, PG_VERSION_94, hrnPgCatalogVersion(PG_VERSION_94), false, true, NULL, NULL),
+            manifest, manifestNewBuild(storagePg, PG_VERSION_94, hrnPgCatalogVersion(PG_VERSION_94), false, true, NULL, NULL, NULL),
             "build manifest");
 
         contentSave = bufNew(0);
@@ -854,7 +859,7 @@ testRun(void)
 
         // Tablespace link errors when correct verion not found
         TEST_ERROR(
-            manifestNewBuild(storagePg, PG_VERSION_12, hrnPgCatalogVersion(PG_VERSION_12), false, false, NULL, NULL),
+            manifestNewBuild(storagePg, PG_VERSION_12, hrnPgCatalogVersion(PG_VERSION_12), false, false, NULL, NULL, NULL),
             FileOpenError,
             "unable to get info for missing path/file '" TEST_PATH "/pg/pg_tblspc/1/PG_12_201909212': [2] No such file or"
                 " directory");
@@ -873,7 +878,7 @@ testRun(void)
         // and backup_label ignored. Old recovery files and pg_xlog are now just another file/directory and will not be ignored.
         // pg_wal contents will be ignored online. pg_clog pgVersion > 10 master:true, pg_xact pgVersion > 10 master:false
         TEST_ASSIGN(
-            manifest, manifestNewBuild(storagePg, PG_VERSION_12, hrnPgCatalogVersion(PG_VERSION_12), true, false, NULL, NULL),
+            manifest, manifestNewBuild(storagePg, PG_VERSION_12, hrnPgCatalogVersion(PG_VERSION_12), true, false, NULL, NULL, NULL),
             "build manifest");
 
         contentSave = bufNew(0);
@@ -945,7 +950,8 @@ testRun(void)
 
         // pg_wal not ignored
         TEST_ASSIGN(
-            manifest, manifestNewBuild(storagePg, PG_VERSION_13, hrnPgCatalogVersion(PG_VERSION_13), false, false, NULL, NULL),
+            manifest,
+            manifestNewBuild(storagePg, PG_VERSION_13, hrnPgCatalogVersion(PG_VERSION_13), false, false, NULL, NULL, NULL),
             "build manifest");
 
         contentSave = bufNew(0);
@@ -1015,7 +1021,7 @@ testRun(void)
         THROW_ON_SYS_ERROR(symlink(TEST_PATH "/pg/base", TEST_PATH "/pg/link") == -1, FileOpenError, "unable to create symlink");
 
         TEST_ERROR(
-            manifestNewBuild(storagePg, PG_VERSION_94, hrnPgCatalogVersion(PG_VERSION_94), false, false, NULL, NULL),
+            manifestNewBuild(storagePg, PG_VERSION_94, hrnPgCatalogVersion(PG_VERSION_94), false, false, NULL, NULL, NULL),
             LinkDestinationError, "link 'link' destination '" TEST_PATH "/pg/base' is in PGDATA");
 
         THROW_ON_SYS_ERROR(unlink(TEST_PATH "/pg/link") == -1, FileRemoveError, "unable to remove symlink");
@@ -1026,7 +1032,7 @@ testRun(void)
         HRN_STORAGE_PATH_CREATE(storagePgWrite, MANIFEST_TARGET_PGTBLSPC "/somedir", .mode = 0700);
 
         TEST_ERROR(
-            manifestNewBuild(storagePg, PG_VERSION_94, hrnPgCatalogVersion(PG_VERSION_94), false, false, NULL, NULL),
+            manifestNewBuild(storagePg, PG_VERSION_94, hrnPgCatalogVersion(PG_VERSION_94), false, false, NULL, NULL, NULL),
             LinkExpectedError, "'pg_data/pg_tblspc/somedir' is not a symlink - pg_tblspc should contain only symlinks");
 
         HRN_STORAGE_PATH_REMOVE(storagePgWrite, MANIFEST_TARGET_PGTBLSPC "/somedir");
@@ -1037,7 +1043,7 @@ testRun(void)
         HRN_STORAGE_PUT_EMPTY(storagePgWrite, MANIFEST_TARGET_PGTBLSPC "/somefile");
 
         TEST_ERROR(
-            manifestNewBuild(storagePg, PG_VERSION_94, hrnPgCatalogVersion(PG_VERSION_94), false, false, NULL, NULL),
+            manifestNewBuild(storagePg, PG_VERSION_94, hrnPgCatalogVersion(PG_VERSION_94), false, false, NULL, NULL, NULL),
             LinkExpectedError, "'pg_data/pg_tblspc/somefile' is not a symlink - pg_tblspc should contain only symlinks");
 
         TEST_STORAGE_EXISTS(storagePgWrite, MANIFEST_TARGET_PGTBLSPC "/somefile", .remove = true);
@@ -1048,7 +1054,8 @@ testRun(void)
         THROW_ON_SYS_ERROR(symlink("../bogus-link", TEST_PATH "/pg/link-to-link") == -1, FileOpenError, "unable to create symlink");
 
         TEST_ERROR(
-            manifestNewBuild(storagePg, PG_VERSION_94, hrnPgCatalogVersion(PG_VERSION_94), false, true, NULL, NULL), FileOpenError,
+            manifestNewBuild(storagePg, PG_VERSION_94, hrnPgCatalogVersion(PG_VERSION_94), false, true, NULL, NULL, NULL),
+            FileOpenError,
             "unable to get info for missing path/file '" TEST_PATH "/pg/link-to-link': [2] No such file or directory");
 
         THROW_ON_SYS_ERROR(unlink(TEST_PATH "/pg/link-to-link") == -1, FileRemoveError, "unable to remove symlink");
@@ -1063,7 +1070,7 @@ testRun(void)
             symlink(TEST_PATH "/linktest", TEST_PATH "/pg/linktolink") == -1, FileOpenError, "unable to create symlink");
 
         TEST_ERROR(
-            manifestNewBuild(storagePg, PG_VERSION_94, hrnPgCatalogVersion(PG_VERSION_94), false, false, NULL, NULL),
+            manifestNewBuild(storagePg, PG_VERSION_94, hrnPgCatalogVersion(PG_VERSION_94), false, false, NULL, NULL, NULL),
             LinkDestinationError, "link '" TEST_PATH "/pg/linktolink' cannot reference another link '" TEST_PATH "/linktest'");
 
         #undef TEST_MANIFEST_HEADER
@@ -1218,7 +1225,7 @@ testRun(void)
             manifestPrior,
             &(ManifestFile){
                .name = STRDEF(MANIFEST_TARGET_PGDATA "/" PG_FILE_PGVERSION), .size = 4, .sizeRepo = 4, .timestamp = 1482182860,
-               .checksumSha1 = "aaaaaaaaaabbbbbbbbbbccccccccccdddddddddd"});
+               .checksumSha1 = "aaaaaaaaaabbbbbbbbbbccccccccccdddddddddd", .bundleId = 1, .bundleOffset = 5});
 
         TEST_RESULT_VOID(manifestBuildIncr(manifest, manifestPrior, backupTypeIncr, NULL), "incremental manifest");
 
@@ -1238,8 +1245,8 @@ testRun(void)
                 "pg_data/BOGUS={\"size\":6,\"timestamp\":1482182860}\n"
                 "pg_data/FILE3={\"reference\":\"20190101-010101F\",\"size\":0,\"timestamp\":1482182860}\n"
                 "pg_data/FILE4={\"size\":55,\"timestamp\":1482182861}\n"
-                "pg_data/PG_VERSION={\"checksum\":\"aaaaaaaaaabbbbbbbbbbccccccccccdddddddddd\",\"reference\":\"20190101-010101F\","
-                    "\"size\":4,\"timestamp\":1482182860}\n"
+                "pg_data/PG_VERSION={\"bni\":1,\"bno\":5,\"checksum\":\"aaaaaaaaaabbbbbbbbbbccccccccccdddddddddd\","
+                    "\"reference\":\"20190101-010101F\",\"size\":4,\"timestamp\":1482182860}\n"
                 TEST_MANIFEST_FILE_DEFAULT
                 "\n"
                 "[target:path]\n"
@@ -1287,8 +1294,8 @@ testRun(void)
                 "[target:file]\n"
                 "pg_data/FILE1={\"checksum\":\"aaaaaaaaaabbbbbbbbbbccccccccccdddddddddd\","
                     "\"reference\":\"20190101-010101F_20190202-010101D\",\"size\":4,\"timestamp\":1482182860}\n"
-                "pg_data/PG_VERSION={\"checksum\":\"aaaaaaaaaabbbbbbbbbbccccccccccdddddddddd\",\"reference\":\"20190101-010101F\","
-                    "\"size\":4,\"timestamp\":1482182860}\n"
+                "pg_data/PG_VERSION={\"bni\":1,\"bno\":5,\"checksum\":\"aaaaaaaaaabbbbbbbbbbccccccccccdddddddddd\","
+                    "\"reference\":\"20190101-010101F\",\"size\":4,\"timestamp\":1482182860}\n"
                 TEST_MANIFEST_FILE_DEFAULT
                 "\n"
                 "[target:path]\n"
@@ -1462,6 +1469,85 @@ testRun(void)
                 TEST_MANIFEST_PATH_DEFAULT)),
             "check manifest");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("block incremental");
+
+        lstClear(manifest->pub.fileList);
+        manifestFileAdd(
+            manifest,
+            &(ManifestFile){
+               .name = STRDEF(MANIFEST_TARGET_PGDATA "/FILE1"), .size = 10, .sizeRepo = 10, .timestamp = 1482182860,
+               .mode = 0600, .group = STRDEF("test"), .user = STRDEF("test")});
+        manifestFileAdd(
+            manifest,
+            &(ManifestFile){
+               .name = STRDEF(MANIFEST_TARGET_PGDATA "/FILE2"), .size = 12, .sizeRepo = 12, .timestamp = 1482182861,
+               .mode = 0600, .group = STRDEF("test"), .user = STRDEF("test")});
+        manifestFileAdd(
+            manifest,
+            &(ManifestFile){
+               .name = STRDEF(MANIFEST_TARGET_PGDATA "/FILE3"), .size = 3, .sizeRepo = 3, .timestamp = 1482182861,
+               .mode = 0600, .group = STRDEF("test"), .user = STRDEF("test")});
+
+        lstClear(manifestPrior->pub.fileList);
+        manifestFileAdd(
+            manifestPrior,
+            &(ManifestFile){
+               .name = STRDEF(MANIFEST_TARGET_PGDATA "/FILE1"), .size = 10, .sizeRepo = 4, .timestamp = 1482182860,
+               .reference = STRDEF("20190101-010101F_20190202-010101D"), .blockIncrSize = 4,
+               .checksumSha1 = "aaaaaaaaaabbbbbbbbbbccccccccccdddddddddd"});
+        manifestFileAdd(
+            manifestPrior,
+            &(ManifestFile){
+               .name = STRDEF(MANIFEST_TARGET_PGDATA "/FILE2"), .size = 10, .sizeRepo = 10, .timestamp = 1482182860,
+               .blockIncrSize = 4, .checksumSha1 = "ddddddddddbbbbbbbbbbccccccccccaaaaaaaaaa"});
+
+        TEST_RESULT_VOID(manifestBuildBlockIncr(manifest, 4), "block incremental manifest");
+        TEST_RESULT_VOID(manifestBuildIncr(manifest, manifestPrior, backupTypeIncr, NULL), "incremental manifest");
+
+        TEST_RESULT_LOG("P00   WARN: the online option has changed since the 20190101-010101F backup, enabling delta checksum");
+
+        TEST_RESULT_STR_Z(
+            manifestFileFind(manifest, STRDEF(MANIFEST_TARGET_PGDATA "/FILE1"))->blockIncrMapPrior,
+            "20190101-010101F_20190202-010101D", "check map prior");
+        TEST_RESULT_STR_Z(
+            manifestFileFind(manifest, STRDEF(MANIFEST_TARGET_PGDATA "/FILE2"))->blockIncrMapPrior, "20190101-010101F",
+            "check map prior");
+        TEST_RESULT_PTR(
+            manifestFileFind(manifest, STRDEF(MANIFEST_TARGET_PGDATA "/FILE3"))->blockIncrMapPrior, NULL, "check no map prior");
+
+        contentSave = bufNew(0);
+        TEST_RESULT_VOID(manifestSave(manifest, ioBufferWriteNew(contentSave)), "save manifest");
+        TEST_RESULT_STR(
+            strNewBuf(contentSave),
+            strNewBuf(harnessInfoChecksumZ(
+                TEST_MANIFEST_HEADER_PRE
+                "option-delta=true\n"
+                "option-hardlink=false\n"
+                "option-online=true\n"
+                "\n"
+                "[backup:target]\n"
+                "pg_data={\"path\":\"/pg\",\"type\":\"path\"}\n"
+                "\n"
+                "[target:file]\n"
+                "pg_data/FILE1={\"bi\":4,\"checksum\":\"aaaaaaaaaabbbbbbbbbbccccccccccdddddddddd\","
+                    "\"reference\":\"20190101-010101F_20190202-010101D\",\"repo-size\":4,\"size\":10,\"timestamp\":1482182860}\n"
+                "pg_data/FILE2={\"bi\":4,\"size\":12,\"timestamp\":1482182861}\n"
+                "pg_data/FILE3={\"size\":3,\"timestamp\":1482182861}\n"
+                TEST_MANIFEST_FILE_DEFAULT
+                "\n"
+                "[target:path]\n"
+                "pg_data={}\n"
+                TEST_MANIFEST_PATH_DEFAULT)),
+            "check manifest");
+
+        Manifest *manifestLoad = NULL;
+        TEST_ASSIGN(manifestLoad, manifestNewLoad(ioBufferReadNew(contentSave)), "load manifest");
+        TEST_RESULT_UINT(
+            manifestFileFind(manifestLoad, STRDEF(MANIFEST_TARGET_PGDATA "/FILE1"))->blockIncrSize, 4, "check block incr size");
+        TEST_RESULT_UINT(
+            manifestFileFind(manifestLoad, STRDEF(MANIFEST_TARGET_PGDATA "/FILE3"))->blockIncrSize, 0, "check block incr size");
+
         #undef TEST_MANIFEST_HEADER_PRE
         #undef TEST_MANIFEST_HEADER_POST
         #undef TEST_MANIFEST_FILE_DEFAULT
@@ -1532,6 +1618,30 @@ testRun(void)
         }
         MEM_CONTEXT_TEMP_END();
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("manifest name cache");
+
+        MEM_CONTEXT_TEMP_BEGIN()
+        {
+            Manifest *manifestName = manifestNewInternal();
+
+            TEST_RESULT_STR_Z(manifestNameCache(manifestName, STRDEF("pg_data/1")), "pg_data/1", "cache name");
+            TEST_RESULT_UINT(
+                manifestName->nameBlockRemains, MANIFEST_NAME_BLOCK_SIZE - sizeof(StringPub) * 2, "check block remains");
+
+            TEST_RESULT_UINT(
+                strSize(manifestNameCache(manifestName, strNewFmt("%20000s", "x"))), 20000, "large name in own allocation");
+            TEST_RESULT_UINT(
+                manifestName->nameBlockRemains, MANIFEST_NAME_BLOCK_SIZE - sizeof(StringPub) * 2, "check block remains");
+
+            manifestName->nameBlockRemains = sizeof(StringPub);
+
+            TEST_RESULT_STR_Z(manifestNameCache(manifestName, STRDEF("pg_data/2")), "pg_data/2", "cache name in new block");
+            TEST_RESULT_UINT(
+                manifestName->nameBlockRemains, MANIFEST_NAME_BLOCK_SIZE - sizeof(StringPub) * 2, "check block remains");
+        }
+        MEM_CONTEXT_TEMP_END();
+
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("manifest - minimal features");
 
@@ -1620,8 +1730,8 @@ testRun(void)
                 ",\"reference\":\"20190818-084502F_20190819-084506D\",\"size\":4,\"timestamp\":1565282114}\n"                      \
             "pg_data/base/16384/17000={\"checksum\":\"e0101dd8ffb910c9c202ca35b5f828bcb9697bed\",\"checksum-page\":false"          \
                 ",\"checksum-page-error\":[1],\"repo-size\":4096,\"size\":8192,\"timestamp\":1565282114}\n"                        \
-            "pg_data/base/16384/PG_VERSION={\"checksum\":\"184473f470864e067ee3a22e64b47b0a1c356f29\",\"group\":false,\"size\":4"  \
-                ",\"timestamp\":1565282115}\n"                                                                                     \
+            "pg_data/base/16384/PG_VERSION={\"bni\":1,\"bno\":1,\"checksum\":\"184473f470864e067ee3a22e64b47b0a1c356f29\""         \
+                ",\"group\":false,\"size\":4,\"timestamp\":1565282115}\n"                                                          \
             "pg_data/base/32768/33000={\"checksum\":\"7a16d165e4775f7c92e8cdf60c0af57313f0bf90\",\"checksum-page\":true"           \
                 ",\"reference\":\"20190818-084502F\",\"size\":1073741824,\"timestamp\":1565282116}\n"                              \
             "pg_data/base/32768/33000.32767={\"checksum\":\"6e99b589e550e68e934fd235ccba59fe5b592a9e\",\"checksum-page\":true"     \
@@ -1723,8 +1833,8 @@ testRun(void)
         TEST_TITLE("manifest validation");
 
         // Munge files to produce errors
-        manifestFileUpdate(manifest, STRDEF("pg_data/postgresql.conf"), 4457, 0, NULL, NULL, false, false, NULL);
-        manifestFileUpdate(manifest, STRDEF("pg_data/base/32768/33000.32767"), 0, 0, NULL, NULL, true, false, NULL);
+        manifestFileUpdate(manifest, STRDEF("pg_data/postgresql.conf"), 4457, 0, NULL, NULL, false, false, NULL, 0, 0);
+        manifestFileUpdate(manifest, STRDEF("pg_data/base/32768/33000.32767"), 0, 0, NULL, NULL, true, false, NULL, 0, 0);
 
         TEST_ERROR(
             manifestValidate(manifest, false), FormatError,
@@ -1739,10 +1849,10 @@ testRun(void)
             "repo size must be > 0 for file 'pg_data/postgresql.conf'");
 
         // Undo changes made to files
-        manifestFileUpdate(manifest, STRDEF("pg_data/base/32768/33000.32767"), 32768, 32768, NULL, NULL, true, false, NULL);
+        manifestFileUpdate(manifest, STRDEF("pg_data/base/32768/33000.32767"), 32768, 32768, NULL, NULL, true, false, NULL, 0, 0);
         manifestFileUpdate(
             manifest, STRDEF("pg_data/postgresql.conf"), 4457, 4457, "184473f470864e067ee3a22e64b47b0a1c356f29", NULL, false,
-            false, NULL);
+            false, NULL, 0, 0);
 
         TEST_RESULT_VOID(manifestValidate(manifest, true), "successful validate");
 
@@ -1891,10 +2001,11 @@ testRun(void)
         TEST_RESULT_PTR(file, NULL, "return default NULL");
 
         TEST_RESULT_VOID(
-            manifestFileUpdate(manifest, STRDEF("pg_data/postgresql.conf"), 4457, 4457, "", NULL, false, false, NULL),
+            manifestFileUpdate(manifest, STRDEF("pg_data/postgresql.conf"), 4457, 4457, "", NULL, false, false, NULL, 0, 0),
             "update file");
         TEST_RESULT_VOID(
-            manifestFileUpdate(manifest, STRDEF("pg_data/postgresql.conf"), 4457, 4457, NULL, varNewStr(NULL), false, false, NULL),
+            manifestFileUpdate(
+                manifest, STRDEF("pg_data/postgresql.conf"), 4457, 4457, NULL, varNewStr(NULL), false, false, NULL, 0, 0),
             "update file");
 
         // ManifestDb getters
@@ -1971,6 +2082,74 @@ testRun(void)
 
         TEST_RESULT_STR(strNewBuf(contentSave), strNewBuf(contentCompare), "check save");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("manifest binary format");
+
+        Buffer *contentPack = bufNew(0);
+        TEST_RESULT_VOID(manifestSavePack(manifest, ioBufferWriteNew(contentPack)), "save binary manifest");
+        TEST_RESULT_BOOL(bufUsed(contentPack) < bufUsed(contentSave), true, "binary is smaller than ini");
+
+        Manifest *manifestPack = NULL;
+        TEST_ASSIGN(manifestPack, manifestNewLoadPack(ioBufferReadNew(contentPack)), "load binary manifest");
+        TEST_RESULT_STR_Z(manifestData(manifestPack)->backrestVersion, PROJECT_VERSION, "check backrest version");
+
+        contentSave = bufNew(0);
+        TEST_RESULT_VOID(manifestSave(manifestPack, ioBufferWriteNew(contentSave)), "save manifest loaded from binary");
+        TEST_RESULT_STR(strNewBuf(contentSave), strNewBuf(contentCompare), "check save");
+
+        const ManifestFile *filePack = NULL;
+        TEST_ASSIGN(filePack, manifestFileFind(manifestPack, STRDEF("pg_data/base/16384/17000")), "find file");
+        TEST_RESULT_Z(filePack->checksumSha1, "e0101dd8ffb910c9c202ca35b5f828bcb9697bed", "check checksum");
+        TEST_RESULT_BOOL(filePack->checksumPage, true, "check checksum page");
+        TEST_RESULT_BOOL(filePack->checksumPageError, true, "check checksum page error");
+        TEST_RESULT_STR_Z(
+            jsonFromVar(varNewVarLst(filePack->checksumPageErrorList)), "[1]", "check checksum page error list");
+        TEST_RESULT_STR_Z(filePack->user, "user1", "check user");
+        TEST_RESULT_STR_Z(filePack->group, "group1", "check group");
+        TEST_RESULT_UINT(filePack->size, 8192, "check size");
+        TEST_RESULT_UINT(filePack->sizeRepo, 4096, "check repo size");
+        TEST_RESULT_INT(filePack->timestamp, 1565282114, "check timestamp");
+
+        TEST_ASSIGN(filePack, manifestFileFind(manifestPack, STRDEF("pg_data/base/16384/PG_VERSION")), "find bundled file");
+        TEST_RESULT_STR_Z(filePack->group, NULL, "check group");
+        TEST_RESULT_UINT(filePack->bundleId, 1, "check bundle id");
+        TEST_RESULT_UINT(filePack->bundleOffset, 1, "check bundle offset");
+
+        TEST_ASSIGN(filePack, manifestFileFind(manifestPack, STRDEF("pg_data/PG_VERSION")), "find first file");
+        TEST_RESULT_STR_Z(filePack->reference, "20190818-084502F_20190819-084506D", "check reference");
+
+        TEST_ASSIGN(filePack, manifestFileFind(manifestPack, STRDEF("pg_data/special-@#!$^&*()_+~`{}[]\\:;")), "find last file");
+        TEST_RESULT_STR_Z(filePack->user, NULL, "check user");
+        TEST_RESULT_Z(filePack->checksumSha1, HASH_TYPE_SHA1_ZERO, "check checksum");
+
+        PackWrite *packInvalid = pckWriteNewBuf(bufNew(0));
+        pckWriteU32P(packInvalid, 99);
+        pckWriteEndP(packInvalid);
+
+        TEST_ERROR(
+            manifestNewLoadPack(ioBufferReadNew(pckWriteBuf(packInvalid))), FormatError,
+            "expected manifest format 1 but found 99");
+
+        packInvalid = pckWriteNewBuf(bufNew(0));
+        pckWriteU32P(packInvalid, 1);
+        pckWriteEndP(packInvalid);
+
+        TEST_ERROR(
+            manifestNewLoadPack(ioBufferReadNew(pckWriteBuf(packInvalid))), FormatError, "manifest section is missing");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("manifest binary format checksum mismatch");
+
+        // The checksum is the last field so change the last character of the checksum, which is followed by the end of the pack
+        Buffer *contentPackInvalid = bufDup(contentPack);
+        const size_t checksumPackOffset = bufUsed(contentPackInvalid) - 41;
+        const String *const checksumPack = strNewN((const char *)bufPtr(contentPackInvalid) + checksumPackOffset, 40);
+        bufPtr(contentPackInvalid)[checksumPackOffset + 39] = 'X';
+
+        TEST_ERROR_FMT(
+            manifestNewLoadPack(ioBufferReadNew(contentPackInvalid)), ChecksumError,
+            "invalid manifest checksum, actual '%s' but expected '%sX'", strZ(checksumPack), strZ(strSubN(checksumPack, 0, 39)));
+
         TEST_RESULT_VOID(manifestFileRemove(manifest, STRDEF("pg_data/PG_VERSION")), "remove file");
         TEST_ERROR(
             manifestFileRemove(manifest, STRDEF("pg_data/PG_VERSION")), AssertError,
@@ -2073,6 +2252,41 @@ testRun(void)
         HRN_INFO_PUT(storageTest, BACKUP_MANIFEST_FILE, TEST_MANIFEST_CONTENT, .comment = "write main manifest");
         TEST_ASSIGN(manifest, manifestLoadFile(storageTest, STRDEF(BACKUP_MANIFEST_FILE), cipherTypeNone, NULL), "load main");
         TEST_RESULT_UINT(manifestData(manifest)->pgSystemId, 1000000000000000094, "check file loaded");
+        TEST_RESULT_STR(
+            manifestCipherSubPassLoadFile(storageTest, STRDEF(BACKUP_MANIFEST_FILE), cipherTypeNone, NULL), NULL,
+            "cipher subpass from ini");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("load binary manifest");
+
+        manifest->pub.data.pgSystemId = 1000000000000000095;
+        manifestCipherSubPassSet(manifest, STRDEF("subpass"));
+
+        StorageWrite *write = storageNewWriteP(storageTest, STRDEF(BACKUP_MANIFEST_FILE BACKUP_MANIFEST_PACK_EXT));
+        TEST_RESULT_VOID(manifestSavePack(manifest, storageWriteIo(write)), "write binary manifest");
+
+        TEST_ASSIGN(manifest, manifestLoadFile(storageTest, STRDEF(BACKUP_MANIFEST_FILE), cipherTypeNone, NULL), "load binary");
+        TEST_RESULT_UINT(manifestData(manifest)->pgSystemId, 1000000000000000095, "check binary loaded");
+        TEST_RESULT_STR_Z(
+            manifestCipherSubPassLoadFile(storageTest, STRDEF(BACKUP_MANIFEST_FILE), cipherTypeNone, NULL), "subpass",
+            "cipher subpass from binary");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("fall back to ini manifest when binary manifest is invalid");
+
+        HRN_STORAGE_PUT_Z(storageTest, BACKUP_MANIFEST_FILE BACKUP_MANIFEST_PACK_EXT, "BOGUS");
+
+        harnessLogLevelSet(logLevelDetail);
+
+        TEST_ASSIGN(manifest, manifestLoadFile(storageTest, STRDEF(BACKUP_MANIFEST_FILE), cipherTypeNone, NULL), "load main");
+        TEST_RESULT_UINT(manifestData(manifest)->pgSystemId, 1000000000000000094, "check ini loaded");
+        TEST_RESULT_LOG(
+            "P00 DETAIL: unable to load '" TEST_PATH "/backup.manifest.pack', loading ini manifest instead: [FormatError] expected"
+            " manifest format 1 but found 0");
+
+        harnessLogLevelReset();
+
+        HRN_STORAGE_REMOVE(storageTest, BACKUP_MANIFEST_FILE BACKUP_MANIFEST_PACK_EXT, .errorOnMissing = true);
 
         TEST_RESULT_VOID(manifestFree(manifest), "free manifest");
         TEST_RESULT_VOID(manifestFree(NULL), "free null manifest");
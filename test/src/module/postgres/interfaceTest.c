@@ -173,13 +173,65 @@ testRun(void)
     }
 
     // *****************************************************************************************************************************
-    if (testBegin("pgPageChecksum()"))
+    if (testBegin("pgPageChecksum() and pgPageChecksumMulti()"))
     {
         unsigned char page[PG_PAGE_SIZE_DEFAULT];
         memset(page, 0xFF, PG_PAGE_SIZE_DEFAULT);
 
         TEST_RESULT_UINT(pgPageChecksum(page, 0), TEST_BIG_ENDIAN() ? 0xF55E : 0x0E1C, "check 0xFF filled page, block 0");
         TEST_RESULT_UINT(pgPageChecksum(page, 999), TEST_BIG_ENDIAN() ? 0xF1B9 : 0x0EC3, "check 0xFF filled page, block 999");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("multiple pages");
+
+        #define TEST_PAGE_TOTAL                                     11
+
+        Buffer *pageList = bufNew(PG_PAGE_SIZE_DEFAULT * TEST_PAGE_TOTAL);
+        bufUsedSet(pageList, bufSize(pageList));
+
+        for (unsigned int byteIdx = 0; byteIdx < bufSize(pageList); byteIdx++)
+            bufPtr(pageList)[byteIdx] = (unsigned char)((byteIdx * 2654435761U) >> 13);
+
+        const Buffer *const pageListCopy = bufDup(pageList);
+        uint16_t expected[TEST_PAGE_TOTAL];
+        uint16_t checksum[TEST_PAGE_TOTAL];
+
+        for (unsigned int pageIdx = 0; pageIdx < TEST_PAGE_TOTAL; pageIdx++)
+            expected[pageIdx] = pgPageChecksum(bufPtr(pageList) + pageIdx * PG_PAGE_SIZE_DEFAULT, 77 + pageIdx);
+
+        TEST_RESULT_VOID(pgPageChecksumMulti(bufPtr(pageList), TEST_PAGE_TOTAL, 77, checksum), "checksum pages");
+        TEST_RESULT_BOOL(memcmp(checksum, expected, sizeof(expected)) == 0, true, "check checksums");
+        TEST_RESULT_BOOL(bufEq(pageList, pageListCopy), true, "check pages are unmodified");
+
+        memset(checksum, 0, sizeof(checksum));
+        TEST_RESULT_VOID(pgPageChecksumMulti(bufPtr(pageList), 1, 77, checksum), "checksum one page");
+        TEST_RESULT_UINT(checksum[0], expected[0], "check checksum");
+        TEST_RESULT_UINT(checksum[1], 0, "check next checksum not set");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("each kernel supported by the cpu");
+
+        const PageChecksumKernelSet *kernelSetList[] =
+        {
+            &pgPageChecksumKernelScalarSet,
+#ifdef PAGE_CHECKSUM_SIMD
+            __builtin_cpu_supports("sse4.1") ? &pgPageChecksumKernelSse41Set : NULL,
+            __builtin_cpu_supports("avx2") ? &pgPageChecksumKernelAvx2Set : NULL,
+            __builtin_cpu_supports("avx512f") ? &pgPageChecksumKernelAvx512Set : NULL,
+#endif
+        };
+
+        for (unsigned int kernelSetIdx = 0; kernelSetIdx < sizeof(kernelSetList) / sizeof(kernelSetList[0]); kernelSetIdx++)
+        {
+            if (kernelSetList[kernelSetIdx] == NULL)
+                continue;
+
+            memset(checksum, 0, sizeof(checksum));
+            pgPageChecksumMultiKernel(kernelSetList[kernelSetIdx], bufPtr(pageList), TEST_PAGE_TOTAL, 77, checksum);
+
+            TEST_RESULT_BOOL(memcmp(checksum, expected, sizeof(expected)) == 0, true, "check checksums");
+            TEST_RESULT_BOOL(bufEq(pageList, pageListCopy), true, "check pages are unmodified");
+        }
     }
 
     // *****************************************************************************************************************************
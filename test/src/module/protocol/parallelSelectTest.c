@@ -0,0 +1,176 @@
+/***********************************************************************************************************************************
+Test Protocol Parallel Executor with select()
+
+The executor uses epoll when available so the select() fallback is tested separately by building with PROTOCOL_PARALLEL_SELECT.
+***********************************************************************************************************************************/
+#include <string.h>
+
+#include "protocol/client.h"
+#include "protocol/server.h"
+
+#include "common/harnessFork.h"
+
+/***********************************************************************************************************************************
+Test ParallelJobCallback
+***********************************************************************************************************************************/
+typedef struct TestParallelJobCallback
+{
+    List *jobList;                                                  // List of jobs to process
+    unsigned int jobIdx;                                            // Current index in the list to be processed
+} TestParallelJobCallback;
+
+static ProtocolParallelJob *testParallelJobCallback(void *data, unsigned int clientIdx)
+{
+    FUNCTION_TEST_BEGIN();
+        FUNCTION_TEST_PARAM_P(VOID, data);
+        FUNCTION_TEST_PARAM(UINT, clientIdx);
+    FUNCTION_TEST_END();
+
+    (void)clientIdx;
+    TestParallelJobCallback *listData = data;
+
+    // Get a new job if there are any left
+    if (listData->jobIdx < lstSize(listData->jobList))
+    {
+        ProtocolParallelJob *job = *(ProtocolParallelJob **)lstGet(listData->jobList, listData->jobIdx);
+        listData->jobIdx++;
+
+        FUNCTION_TEST_RETURN(protocolParallelJobMove(job, memContextCurrent()));
+    }
+
+    FUNCTION_TEST_RETURN(NULL);
+}
+
+/***********************************************************************************************************************************
+Test Run
+***********************************************************************************************************************************/
+void
+testRun(void)
+{
+    FUNCTION_HARNESS_VOID();
+
+    // *****************************************************************************************************************************
+    if (testBegin("ProtocolParallel"))
+    {
+        // Larger than the default pipe size on all supported platforms so the command cannot be pipelined
+        const size_t oversizeSize = 256 * 1024;
+        Buffer *const oversize = bufNew(oversizeSize);
+        memset(bufPtr(oversize), 'X', bufSize(oversize));
+        bufUsedSet(oversize, bufSize(oversize));
+
+        HRN_FORK_BEGIN(.timeout = 5000)
+        {
+            HRN_FORK_CHILD_BEGIN(.prefix = "local server")
+            {
+                ProtocolServer *server = NULL;
+                TEST_ASSIGN(
+                    server,
+                    protocolServerNew(STRDEF("local server"), STRDEF("test"), HRN_FORK_CHILD_READ(), HRN_FORK_CHILD_WRITE()),
+                    "local server");
+
+                TEST_RESULT_UINT(protocolServerCommandGet(server).id, PROTOCOL_COMMAND_NOOP, "noop command get");
+                TEST_RESULT_VOID(protocolServerDataEndPut(server), "data end put");
+
+                // Wait for notify from parent before sending any results
+                TEST_RESULT_UINT(protocolServerCommandGet(server).id, strIdFromZ(stringIdBit5, "c-one"), "c-one command get");
+                HRN_FORK_CHILD_NOTIFY_GET();
+
+                TEST_RESULT_VOID(protocolServerDataPut(server, pckWriteU32P(protocolPackNew(), 1)), "data put");
+                TEST_RESULT_VOID(protocolServerDataEndPut(server), "data end put");
+
+                TEST_RESULT_UINT(protocolServerCommandGet(server).id, strIdFromZ(stringIdBit5, "c-two"), "c-two command get");
+                HRN_FORK_CHILD_NOTIFY_GET();
+
+                TEST_RESULT_VOID(protocolServerDataPut(server, pckWriteU32P(protocolPackNew(), 2)), "data put");
+                TEST_RESULT_VOID(protocolServerDataEndPut(server), "data end put");
+
+                const ProtocolServerCommandGetResult command = protocolServerCommandGet(server);
+                TEST_RESULT_UINT(command.id, strIdFromZ(stringIdBit5, "c-three"), "c-three command get");
+                TEST_RESULT_UINT(bufUsed(pckReadBinP(pckReadNewBuf(command.param))), oversizeSize, "c-three param");
+
+                TEST_RESULT_VOID(protocolServerDataPut(server, pckWriteU32P(protocolPackNew(), 3)), "data put");
+                TEST_RESULT_VOID(protocolServerDataEndPut(server), "data end put");
+
+                // Wait for exit
+                TEST_RESULT_UINT(protocolServerCommandGet(server).id, PROTOCOL_COMMAND_EXIT, "exit command get");
+            }
+            HRN_FORK_CHILD_END();
+
+            HRN_FORK_PARENT_BEGIN(.prefix = "local client")
+            {
+                ProtocolClient *client = NULL;
+                TEST_ASSIGN(
+                    client,
+                    protocolClientNew(
+                        STRDEF("local client"), STRDEF("test"), HRN_FORK_PARENT_READ(0), HRN_FORK_PARENT_WRITE(0)),
+                    "local client new");
+
+                TestParallelJobCallback data = {.jobList = lstNewP(sizeof(ProtocolParallelJob *))};
+                ProtocolParallel *parallel = NULL;
+                TEST_ASSIGN(parallel, protocolParallelNew(100, 2, testParallelJobCallback, &data), "create parallel");
+                TEST_RESULT_VOID(protocolParallelClientAdd(parallel, client), "add client");
+
+                const char *const commandList[] = {"c-one", "c-two", "c-three"};
+
+                for (unsigned int jobIdx = 0; jobIdx < 3; jobIdx++)
+                {
+                    ProtocolCommand *const command = protocolCommandNew(strIdFromZ(stringIdBit5, commandList[jobIdx]));
+
+                    // The last command is too large to pipeline
+                    if (jobIdx == 2)
+                        pckWriteBinP(protocolCommandParam(command), oversize);
+
+                    ProtocolParallelJob *job = protocolParallelJobNew(varNewUInt(jobIdx + 1), command);
+                    TEST_RESULT_VOID(lstAdd(data.jobList, &job), "add job");
+                }
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("select times out while the local is waiting");
+
+                TEST_RESULT_UINT(protocolParallelProcess(parallel), 0, "send first two jobs");
+                TEST_RESULT_STR_Z(protocolParallelToLog(parallel), "{state: running, clientTotal: 1, jobTotal: 2}", "check log");
+                TEST_RESULT_PTR(protocolParallelResult(parallel), NULL, "no result");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("results are returned in order");
+
+                HRN_FORK_PARENT_NOTIFY_PUT(0);
+
+                unsigned int resultTotal = 0;
+
+                do
+                {
+                    resultTotal += protocolParallelProcess(parallel);
+                }
+                while (resultTotal < 1);
+
+                TEST_RESULT_BOOL(parallel->clientJobPending[0] != NULL, true, "large job held until the queue is empty");
+
+                HRN_FORK_PARENT_NOTIFY_PUT(0);
+
+                do
+                {
+                    resultTotal += protocolParallelProcess(parallel);
+                }
+                while (resultTotal < 3);
+
+                for (unsigned int jobIdx = 0; jobIdx < 3; jobIdx++)
+                {
+                    ProtocolParallelJob *job = NULL;
+                    TEST_ASSIGN(job, protocolParallelResult(parallel), "get result");
+                    TEST_RESULT_UINT(varUInt(protocolParallelJobKey(job)), jobIdx + 1, "check key");
+                    TEST_RESULT_UINT(pckReadU32P(protocolParallelJobResult(job)), jobIdx + 1, "check result");
+                }
+
+                TEST_RESULT_BOOL(protocolParallelDone(parallel), true, "check done");
+
+                TEST_RESULT_VOID(protocolParallelFree(parallel), "free parallel");
+                TEST_RESULT_VOID(protocolClientFree(client), "free client");
+            }
+            HRN_FORK_PARENT_END();
+        }
+        HRN_FORK_END();
+    }
+
+    FUNCTION_HARNESS_RETURN_VOID();
+}
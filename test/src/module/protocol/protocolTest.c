@@ -1,6 +1,12 @@
 /***********************************************************************************************************************************
 Test Protocol
 ***********************************************************************************************************************************/
+#include <fcntl.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
 #include "common/io/fdRead.h"
 #include "common/io/fdWrite.h"
 #include "common/io/bufferRead.h"
@@ -328,7 +334,7 @@ testRun(void)
         HRN_CFG_LOAD(cfgCmdArchiveGet, argList, .noStd = true);
 
         TEST_RESULT_STRLST_Z(
-            protocolRemoteParamSsh(protocolStorageTypeRepo, 0),
+            protocolRemoteParamSsh(protocolStorageTypeRepo, 0, false),
             "-o\nLogLevel=error\n-o\nCompression=no\n-o\nPasswordAuthentication=no\nrepo-host-user@repo-host\n"
                 TEST_PROJECT_EXE " --exec-id=1-test --log-level-console=off --log-level-file=off --log-level-stderr=error"
                 " --pg1-path=/path/to/pg --process=0 --remote-type=repo --repo=1 --stanza=test1 archive-get:remote\n",
@@ -349,13 +355,26 @@ testRun(void)
         HRN_CFG_LOAD(cfgCmdCheck, argList, .noStd = true);
 
         TEST_RESULT_STRLST_Z(
-            protocolRemoteParamSsh(protocolStorageTypeRepo, 0),
+            protocolRemoteParamSsh(protocolStorageTypeRepo, 0, false),
             "-o\nLogLevel=error\n-o\nCompression=no\n-o\nPasswordAuthentication=no\n-p\n444\nrepo-host-user@repo-host\n"
                 TEST_PROJECT_EXE " --config=/path/pgbackrest.conf --config-include-path=/path/include --config-path=/path/config"
                 " --exec-id=1-test --log-level-console=off --log-level-file=info --log-level-stderr=error --log-subprocess"
                 " --pg1-path=/unused --process=0 --remote-type=repo --repo=1 --stanza=test1 check:remote\n",
             "remote protocol params with replacements");
 
+        TEST_RESULT_STRLST_Z(
+            protocolRemoteParam(protocolStorageTypeRepo, 0, true, false),
+            "--exec-id=1-test\n--log-level-console=off\n--log-level-file=info\n--log-level-stderr=error\n--log-subprocess\n"
+                "--pg1-path=/unused\n--process=0\n--remote-type=repo\n--repo=1\n--stanza=test1\ncheck:remote\n",
+            "mux remote protocol params do not include config options since the remote uses its own");
+        TEST_RESULT_STRLST_Z(
+            protocolRemoteParam(protocolStorageTypeRepo, 0, true, true),
+            "--exec-id=1-test\n--log-level-console=off\n--log-level-file=info\n--log-level-stderr=error\n--log-subprocess\n"
+                "--process=0\n--remote-type=repo\n--repo=1\n--stanza=test1\ncheck:remote\n",
+            "tls remote protocol params only include options allowed by the server");
+        TEST_RESULT_BOOL(protocolServerOptionValid(cfgOptStanza), true, "stanza is allowed by the server");
+        TEST_RESULT_BOOL(protocolServerOptionValid(cfgOptRepoPath), false, "repo path is not allowed by the server");
+
         // -------------------------------------------------------------------------------------------------------------------------
         argList = strLstNew();
         strLstAddZ(argList, "--stanza=test1");
@@ -367,7 +386,7 @@ testRun(void)
         HRN_CFG_LOAD(cfgCmdArchiveGet, argList, .role = cfgCmdRoleLocal, .noStd = true);
 
         TEST_RESULT_STRLST_Z(
-            protocolRemoteParamSsh(protocolStorageTypeRepo, 0),
+            protocolRemoteParamSsh(protocolStorageTypeRepo, 0, false),
             "-o\nLogLevel=error\n-o\nCompression=no\n-o\nPasswordAuthentication=no\npgbackrest@repo-host\n"
                 TEST_PROJECT_EXE " --exec-id=1-test --log-level-console=off --log-level-file=off --log-level-stderr=error"
                 " --pg1-path=/path/to/pg --process=3 --remote-type=repo --repo=1 --stanza=test1 archive-get:remote\n",
@@ -382,12 +401,19 @@ testRun(void)
         HRN_CFG_LOAD(cfgCmdBackup, argList, .noStd = true);
 
         TEST_RESULT_STRLST_Z(
-            protocolRemoteParamSsh(protocolStorageTypePg, 0),
+            protocolRemoteParamSsh(protocolStorageTypePg, 0, false),
             "-o\nLogLevel=error\n-o\nCompression=no\n-o\nPasswordAuthentication=no\npostgres@pg1-host\n"
                 TEST_PROJECT_EXE " --exec-id=1-test --log-level-console=off --log-level-file=off --log-level-stderr=error"
                 " --pg1-path=/path/to/1 --process=0 --remote-type=pg --stanza=test1 backup:remote\n",
             "remote protocol params for db backup");
 
+        TEST_RESULT_STRLST_Z(
+            protocolRemoteParamSsh(protocolStorageTypePg, 0, true),
+            "-o\nLogLevel=error\n-o\nCompression=no\n-o\nPasswordAuthentication=no\npostgres@pg1-host\n"
+                TEST_PROJECT_EXE " --exec-id=1-test --log-level-console=off --log-level-file=off --log-level-stderr=error"
+                " --pg1-path=/path/to/1 --process=0 --remote-type=pg --stanza=test1 --remote-mux backup:remote\n",
+            "remote protocol params for db backup mux");
+
         // -------------------------------------------------------------------------------------------------------------------------
         argList = strLstNew();
         strLstAddZ(argList, "--stanza=test1");
@@ -402,7 +428,7 @@ testRun(void)
         HRN_CFG_LOAD(cfgCmdBackup, argList, .role = cfgCmdRoleLocal, .noStd = true);
 
         TEST_RESULT_STRLST_Z(
-            protocolRemoteParamSsh(protocolStorageTypePg, 1),
+            protocolRemoteParamSsh(protocolStorageTypePg, 1, false),
             "-o\nLogLevel=error\n-o\nCompression=no\n-o\nPasswordAuthentication=no\npostgres@pg2-host\n"
                 TEST_PROJECT_EXE " --exec-id=1-test --log-level-console=off --log-level-file=off --log-level-stderr=error"
                 " --pg1-path=/path/to/2 --process=4 --remote-type=pg --stanza=test1 backup:remote\n",
@@ -422,7 +448,7 @@ testRun(void)
         HRN_CFG_LOAD(cfgCmdBackup, argList, .role = cfgCmdRoleLocal, .noStd = true);
 
         TEST_RESULT_STRLST_Z(
-            protocolRemoteParamSsh(protocolStorageTypePg, 1),
+            protocolRemoteParamSsh(protocolStorageTypePg, 1, false),
             "-o\nLogLevel=error\n-o\nCompression=no\n-o\nPasswordAuthentication=no\npostgres@pg3-host\n"
                 TEST_PROJECT_EXE " --exec-id=1-test --log-level-console=off --log-level-file=off --log-level-stderr=error"
                 " --pg1-path=/path/to/3 --pg1-port=3333 --pg1-socket-path=/socket3 --process=4 --remote-type=pg --stanza=test1"
@@ -430,6 +456,158 @@ testRun(void)
             "remote protocol params for db local");
     }
 
+    // *****************************************************************************************************************************
+    if (testBegin("ProtocolMux"))
+    {
+        // Trunk shared by the client and server mux and socket that the client mux listens on for new channels
+        int trunk[2];
+        THROW_ON_SYS_ERROR(socketpair(AF_UNIX, SOCK_STREAM, 0, trunk) == -1, KernelError, "unable to create trunk");
+
+        struct sockaddr_un address = {.sun_family = AF_UNIX};
+        strncpy(address.sun_path, TEST_PATH "/mux.sock", sizeof(address.sun_path) - 1);
+
+        const int fdListen = socket(AF_UNIX, SOCK_STREAM, 0);
+        THROW_ON_SYS_ERROR(bind(fdListen, (struct sockaddr *)&address, sizeof(address)) == -1, FileOpenError, "unable to bind");
+        THROW_ON_SYS_ERROR(listen(fdListen, 8) == -1, FileOpenError, "unable to listen");
+
+        HRN_FORK_BEGIN()
+        {
+            // Server mux that echoes data sent on each channel
+            HRN_FORK_CHILD_BEGIN()
+            {
+                close(trunk[0]);
+                close(fdListen);
+
+                ProtocolMux *mux = NULL;
+                TEST_ASSIGN(mux, protocolMuxNew(trunk[1], trunk[1], -1, -1), "new server mux");
+
+                unsigned int channelId;
+
+                while ((channelId = protocolMuxProcess(mux)) != 0)
+                {
+                    int socketPair[2];
+                    THROW_ON_SYS_ERROR(socketpair(AF_UNIX, SOCK_STREAM, 0, socketPair) == -1, KernelError, "unable to create pair");
+
+                    if (fork() == 0)
+                    {
+                        close(socketPair[0]);
+                        protocolMuxFree(mux);
+
+                        unsigned char buffer[4096];
+                        ssize_t size;
+
+                        while ((size = read(socketPair[1], buffer, sizeof(buffer))) > 0)
+                        {
+                            if (write(socketPair[1], buffer, (size_t)size) != size)
+                                break;
+                        }
+
+                        _exit(0);
+                    }
+
+                    close(socketPair[1]);
+                    TEST_RESULT_VOID(protocolMuxChannelAdd(mux, channelId, socketPair[0]), "add channel");
+                }
+
+                TEST_RESULT_VOID(protocolMuxFree(mux), "free server mux");
+            }
+            HRN_FORK_CHILD_END();
+
+            // Client mux that stops when the parent closes the control pipe
+            HRN_FORK_CHILD_BEGIN()
+            {
+                close(trunk[1]);
+
+                ProtocolMux *mux = NULL;
+                TEST_ASSIGN(mux, protocolMuxNew(trunk[0], trunk[0], fdListen, HRN_FORK_CHILD_READ_FD()), "new client mux");
+                TEST_RESULT_UINT(protocolMuxProcess(mux), 0, "relay until done");
+                TEST_RESULT_VOID(protocolMuxFree(mux), "free client mux");
+            }
+            HRN_FORK_CHILD_END();
+
+            HRN_FORK_PARENT_BEGIN()
+            {
+                close(trunk[0]);
+                close(trunk[1]);
+                close(fdListen);
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("data is relayed on separate channels");
+
+                IoSession *session[2];
+
+                for (unsigned int sessionIdx = 0; sessionIdx < 2; sessionIdx++)
+                {
+                    const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+                    THROW_ON_SYS_ERROR(
+                        connect(fd, (struct sockaddr *)&address, sizeof(address)) == -1, FileOpenError, "unable to connect");
+
+                    session[sessionIdx] = sckSessionNew(ioSessionRoleClient, fd, STRDEF("mux"), 0, 2000);
+                }
+
+                ioWriteStrLine(ioSessionIoWrite(session[1]), STRDEF("channel 2"));
+                ioWriteFlush(ioSessionIoWrite(session[1]));
+                ioWriteStrLine(ioSessionIoWrite(session[0]), STRDEF("channel 1"));
+                ioWriteFlush(ioSessionIoWrite(session[0]));
+
+                TEST_RESULT_STR_Z(ioReadLine(ioSessionIoRead(session[0])), "channel 1", "echo on channel 1");
+                TEST_RESULT_STR_Z(ioReadLine(ioSessionIoRead(session[1])), "channel 2", "echo on channel 2");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("data larger than a buffer is relayed");
+
+                Buffer *const data = bufNew(ioBufferSize() * 2 + 7);
+
+                for (size_t dataIdx = 0; dataIdx < bufSize(data); dataIdx++)
+                    bufPtr(data)[dataIdx] = (unsigned char)(dataIdx % 251);
+
+                bufUsedSet(data, bufSize(data));
+
+                ioWrite(ioSessionIoWrite(session[0]), data);
+                ioWriteFlush(ioSessionIoWrite(session[0]));
+
+                Buffer *const echo = bufNew(bufSize(data));
+                TEST_RESULT_UINT(ioRead(ioSessionIoRead(session[0]), echo), bufSize(data), "read echo");
+                TEST_RESULT_BOOL(bufEq(echo, data), true, "echo matches");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("channel that is not being read does not stall other channels");
+
+                Buffer *const stall = bufNew(2 * 1024 * 1024);
+
+                for (size_t stallIdx = 0; stallIdx < bufSize(stall); stallIdx++)
+                    bufPtr(stall)[stallIdx] = (unsigned char)(stallIdx % 241);
+
+                bufUsedSet(stall, bufSize(stall));
+
+                ioWrite(ioSessionIoWrite(session[1]), stall);
+                ioWriteFlush(ioSessionIoWrite(session[1]));
+
+                ioWriteStrLine(ioSessionIoWrite(session[0]), STRDEF("not stalled"));
+                ioWriteFlush(ioSessionIoWrite(session[0]));
+
+                TEST_RESULT_STR_Z(ioReadLine(ioSessionIoRead(session[0])), "not stalled", "echo on channel 1");
+
+                Buffer *const stallEcho = bufNew(bufSize(stall));
+                TEST_RESULT_UINT(ioRead(ioSessionIoRead(session[1]), stallEcho), bufSize(stall), "read echo on channel 2");
+                TEST_RESULT_BOOL(bufEq(stallEcho, stall), true, "echo matches");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("closed channel does not affect other channels");
+
+                TEST_RESULT_VOID(ioSessionFree(session[0]), "close channel 1");
+
+                ioWriteStrLine(ioSessionIoWrite(session[1]), STRDEF("still open"));
+                ioWriteFlush(ioSessionIoWrite(session[1]));
+
+                TEST_RESULT_STR_Z(ioReadLine(ioSessionIoRead(session[1])), "still open", "echo on channel 2");
+                TEST_RESULT_VOID(ioSessionFree(session[1]), "close channel 2");
+            }
+            HRN_FORK_PARENT_END();
+        }
+        HRN_FORK_END();
+    }
+
     // *****************************************************************************************************************************
     if (testBegin("ProtocolClient, ProtocolCommand, and ProtocolServer"))
     {
@@ -660,6 +838,67 @@ testRun(void)
         // Free job
         TEST_RESULT_VOID(protocolParallelJobFree(job), "free job");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("client is only written when results have been read and the command pipe has room");
+
+        int resultPipe[2];
+        int commandPipe[2];
+        THROW_ON_SYS_ERROR(pipe(resultPipe) == -1, KernelError, "unable to create result pipe");
+        THROW_ON_SYS_ERROR(pipe(commandPipe) == -1, KernelError, "unable to create command pipe");
+
+        ProtocolClient clientPipe =
+        {
+            .pub =
+            {
+                .read = ioFdReadNewOpen(STRDEF("result"), resultPipe[0], 1000),
+                .write = ioFdWriteNewOpen(STRDEF("command"), commandPipe[1], 1000),
+            },
+            .name = STRDEF("test"),
+        };
+
+        TEST_RESULT_BOOL(protocolParallelClientWritable(&clientPipe), true, "writable");
+
+        THROW_ON_SYS_ERROR(write(resultPipe[1], "1\n2\n", 4) != 4, FileWriteError, "unable to write result pipe");
+        TEST_RESULT_BOOL(protocolParallelClientWritable(&clientPipe), false, "not writable with result in pipe");
+
+        TEST_RESULT_STR_Z(ioReadLine(clientPipe.pub.read), "1", "read first result");
+        TEST_RESULT_BOOL(protocolParallelClientWritable(&clientPipe), false, "not writable with result buffered");
+
+        TEST_RESULT_STR_Z(ioReadLine(clientPipe.pub.read), "2", "read second result");
+        TEST_RESULT_BOOL(protocolParallelClientWritable(&clientPipe), true, "writable");
+
+        // Larger than the default pipe size on all supported platforms
+        const size_t oversizeSize = 256 * 1024;
+        Buffer *const oversize = bufNew(oversizeSize);
+        memset(bufPtr(oversize), 'X', bufSize(oversize));
+        bufUsedSet(oversize, bufSize(oversize));
+
+        ProtocolCommand *commandSmall = protocolCommandNew(strIdFromZ(stringIdBit5, "c"));
+        ProtocolCommand *commandLarge = protocolCommandNew(strIdFromZ(stringIdBit5, "c"));
+        pckWriteBinP(protocolCommandParam(commandLarge), oversize);
+
+        TEST_RESULT_UINT(protocolCommandSize(commandSmall), PROTOCOL_COMMAND_ENVELOPE_SIZE, "small command size");
+        TEST_RESULT_BOOL(protocolCommandSize(commandLarge) > oversizeSize, true, "large command size");
+        TEST_RESULT_UINT(
+            protocolCommandSize(commandLarge), protocolCommandSize(commandLarge), "large command size does not change");
+
+        TEST_RESULT_BOOL(protocolParallelClientFits(&clientPipe, commandSmall), true, "small command fits");
+        TEST_RESULT_BOOL(protocolParallelClientFits(&clientPipe, commandLarge), false, "large command does not fit");
+
+        THROW_ON_SYS_ERROR(
+            fcntl(commandPipe[1], F_SETFL, fcntl(commandPipe[1], F_GETFL) | O_NONBLOCK) == -1, KernelError,
+            "unable to set command pipe non-blocking");
+
+        while (write(commandPipe[1], "X", 1) == 1);
+
+        TEST_RESULT_BOOL(protocolParallelClientWritable(&clientPipe), false, "not writable with command pipe full");
+        TEST_RESULT_BOOL(protocolParallelClientFits(&clientPipe, commandSmall), false, "small command does not fit in full pipe");
+
+        close(resultPipe[0]);
+        close(resultPipe[1]);
+        close(commandPipe[0]);
+        close(commandPipe[1]);
+
         // -------------------------------------------------------------------------------------------------------------------------
         HRN_FORK_BEGIN(.timeout = 5000)
         {
@@ -684,6 +923,32 @@ testRun(void)
                 TEST_RESULT_VOID(protocolServerDataPut(server, pckWriteU32P(protocolPackNew(), 1)), "data end put");
                 TEST_RESULT_VOID(protocolServerDataEndPut(server), "data end put");
 
+                // Both pipelined commands are received before either result is sent
+                TEST_RESULT_UINT(protocolServerCommandGet(server).id, strIdFromZ(stringIdBit5, "c-four"), "c-four command get");
+                TEST_RESULT_UINT(protocolServerCommandGet(server).id, strIdFromZ(stringIdBit5, "c-five"), "c-five command get");
+
+                TEST_RESULT_VOID(protocolServerDataPut(server, pckWriteU32P(protocolPackNew(), 4)), "data put");
+                TEST_RESULT_VOID(protocolServerDataEndPut(server), "data end put");
+                TEST_RESULT_VOID(protocolServerDataPut(server, pckWriteU32P(protocolPackNew(), 5)), "data put");
+                TEST_RESULT_VOID(protocolServerDataEndPut(server), "data end put");
+
+                // Commands and results larger than the pipe. The second command must not be written while the first result is.
+                for (unsigned int commandIdx = 0; commandIdx < 2; commandIdx++)
+                {
+                    const ProtocolServerCommandGetResult command = protocolServerCommandGet(server);
+
+                    TEST_RESULT_UINT(
+                        command.id, strIdFromZ(stringIdBit5, commandIdx == 0 ? "c-six" : "c-seven"), "oversize command get");
+                    TEST_RESULT_UINT(bufUsed(pckReadBinP(pckReadNewBuf(command.param))), oversizeSize, "oversize param");
+
+                    // Wait for notify from parent so the second command is not blocked by a result waiting to be read
+                    if (commandIdx == 0)
+                        HRN_FORK_CHILD_NOTIFY_GET();
+
+                    TEST_RESULT_VOID(protocolServerDataPut(server, pckWriteBinP(protocolPackNew(), oversize)), "data put");
+                    TEST_RESULT_VOID(protocolServerDataEndPut(server), "data end put");
+                }
+
                 // Wait for exit
                 TEST_RESULT_UINT(protocolServerCommandGet(server).id, PROTOCOL_COMMAND_EXIT, "noop command get");
             }
@@ -723,7 +988,7 @@ testRun(void)
             {
                 TestParallelJobCallback data = {.jobList = lstNewP(sizeof(ProtocolParallelJob *))};
                 ProtocolParallel *parallel = NULL;
-                TEST_ASSIGN(parallel, protocolParallelNew(2000, testParallelJobCallback, &data), "create parallel");
+                TEST_ASSIGN(parallel, protocolParallelNew(2000, 1, testParallelJobCallback, &data), "create parallel");
                 TEST_RESULT_STR_Z(protocolParallelToLog(parallel), "{state: pending, clientTotal: 0, jobTotal: 0}", "check log");
 
                 // Add client
@@ -837,7 +1102,7 @@ testRun(void)
                 TEST_TITLE("process zero jobs");
 
                 data = (TestParallelJobCallback){.jobList = lstNewP(sizeof(ProtocolParallelJob *))};
-                TEST_ASSIGN(parallel, protocolParallelNew(2000, testParallelJobCallback, &data), "create parallel");
+                TEST_ASSIGN(parallel, protocolParallelNew(2000, 1, testParallelJobCallback, &data), "create parallel");
                 TEST_RESULT_VOID(protocolParallelClientAdd(parallel, client[0]), "add client");
 
                 TEST_RESULT_INT(protocolParallelProcess(parallel), 0, "process zero jobs");
@@ -845,6 +1110,76 @@ testRun(void)
 
                 TEST_RESULT_VOID(protocolParallelFree(parallel), "free parallel");
 
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("pipeline jobs");
+
+                data = (TestParallelJobCallback){.jobList = lstNewP(sizeof(ProtocolParallelJob *))};
+                TEST_ASSIGN(parallel, protocolParallelNew(2000, 2, testParallelJobCallback, &data), "create parallel");
+                TEST_RESULT_VOID(protocolParallelClientAdd(parallel, client[0]), "add client");
+
+                job = protocolParallelJobNew(varNewStr(STRDEF("job4")), protocolCommandNew(strIdFromZ(stringIdBit5, "c-four")));
+                TEST_RESULT_VOID(lstAdd(data.jobList, &job), "add job");
+                job = protocolParallelJobNew(varNewStr(STRDEF("job5")), protocolCommandNew(strIdFromZ(stringIdBit5, "c-five")));
+                TEST_RESULT_VOID(lstAdd(data.jobList, &job), "add job");
+
+                TEST_RESULT_INT(protocolParallelProcess(parallel), 0, "send both jobs");
+                TEST_RESULT_STR_Z(protocolParallelToLog(parallel), "{state: running, clientTotal: 1, jobTotal: 2}", "check log");
+
+                // Give the local time to send both results so the second result is buffered when the first is read
+                sleepMSec(250);
+
+                TEST_RESULT_INT(protocolParallelProcess(parallel), 2, "process job and buffered job");
+                TEST_ASSIGN(job, protocolParallelResult(parallel), "get result");
+                TEST_RESULT_STR_Z(varStr(protocolParallelJobKey(job)), "job4", "check key is job4");
+                TEST_RESULT_UINT(pckReadU32P(protocolParallelJobResult(job)), 4, "check result is 4");
+
+                TEST_ASSIGN(job, protocolParallelResult(parallel), "get result");
+                TEST_RESULT_STR_Z(varStr(protocolParallelJobKey(job)), "job5", "check key is job5");
+                TEST_RESULT_UINT(pckReadU32P(protocolParallelJobResult(job)), 5, "check result is 5");
+
+                TEST_RESULT_BOOL(protocolParallelDone(parallel), true, "check done");
+                TEST_RESULT_VOID(protocolParallelFree(parallel), "free parallel");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("commands larger than the pipe are not pipelined");
+
+                data = (TestParallelJobCallback){.jobList = lstNewP(sizeof(ProtocolParallelJob *))};
+                TEST_ASSIGN(parallel, protocolParallelNew(2000, 2, testParallelJobCallback, &data), "create parallel");
+                TEST_RESULT_VOID(protocolParallelClientAdd(parallel, client[0]), "add client");
+
+                command = protocolCommandNew(strIdFromZ(stringIdBit5, "c-six"));
+                pckWriteBinP(protocolCommandParam(command), oversize);
+                job = protocolParallelJobNew(varNewStr(STRDEF("job6")), command);
+                TEST_RESULT_VOID(lstAdd(data.jobList, &job), "add job");
+
+                command = protocolCommandNew(strIdFromZ(stringIdBit5, "c-seven"));
+                pckWriteBinP(protocolCommandParam(command), oversize);
+                job = protocolParallelJobNew(varNewStr(STRDEF("job7")), command);
+                TEST_RESULT_VOID(lstAdd(data.jobList, &job), "add job");
+
+                TEST_RESULT_INT(protocolParallelProcess(parallel), 0, "send first job");
+                TEST_RESULT_UINT(lstSize(parallel->clientJobList[0]), 1, "one job running");
+                TEST_RESULT_BOOL(parallel->clientJobPending[0] != NULL, true, "second job held");
+
+                // Notify child to complete command
+                HRN_FORK_PARENT_NOTIFY_PUT(0);
+
+                TEST_RESULT_INT(protocolParallelProcess(parallel), 1, "process first job and send second job");
+                TEST_RESULT_PTR(parallel->clientJobPending[0], NULL, "second job sent");
+
+                TEST_ASSIGN(job, protocolParallelResult(parallel), "get result");
+                TEST_RESULT_STR_Z(varStr(protocolParallelJobKey(job)), "job6", "check key is job6");
+                TEST_RESULT_UINT(bufUsed(pckReadBinP(protocolParallelJobResult(job))), oversizeSize, "check result size");
+
+                TEST_RESULT_INT(protocolParallelProcess(parallel), 1, "process second job");
+
+                TEST_ASSIGN(job, protocolParallelResult(parallel), "get result");
+                TEST_RESULT_STR_Z(varStr(protocolParallelJobKey(job)), "job7", "check key is job7");
+                TEST_RESULT_UINT(bufUsed(pckReadBinP(protocolParallelJobResult(job))), oversizeSize, "check result size");
+
+                TEST_RESULT_BOOL(protocolParallelDone(parallel), true, "check done");
+                TEST_RESULT_VOID(protocolParallelFree(parallel), "free parallel");
+
                 // -----------------------------------------------------------------------------------------------------------------
                 TEST_TITLE("free clients");
 
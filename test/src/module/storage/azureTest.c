@@ -30,6 +30,7 @@ typedef struct TestRequestParam
 {
     VAR_PARAM_HEADER;
     const char *content;
+    const char *contentType;
     const char *blobType;
 } TestRequestParam;
 
@@ -78,6 +79,10 @@ testRequest(IoWrite *write, const char *verb, const char *path, TestRequestParam
             strZ(strNewEncode(encodeBase64, cryptoHashOne(HASH_TYPE_MD5_STR, BUFSTRZ(param.content)))));
     }
 
+    // Add content-type
+    if (param.contentType != NULL)
+        strCatFmt(request, "content-type:%s\r\n", param.contentType);
+
     // Add date
     if (driver->sharedKey != NULL)
         strCatZ(request, "date:???, ?? ??? ???? ??:??:?? GMT\r\n");
@@ -133,6 +138,10 @@ testResponse(IoWrite *write, TestResponseParam param)
             strCatZ(response, "OK");
             break;
 
+        case 202:
+            strCatZ(response, "Accepted");
+            break;
+
         case 403:
             strCatZ(response, "Forbidden");
             break;
@@ -211,7 +220,7 @@ testRun(void)
             (StorageAzure *)storageDriver(
                 storageAzureNew(
                     STRDEF("/repo"), false, NULL, TEST_CONTAINER_STR, TEST_ACCOUNT_STR, storageAzureKeyTypeShared,
-                    TEST_KEY_SHARED_STR, 16, NULL, STRDEF("blob.core.windows.net"), 443, 1000, true, NULL, NULL)),
+                    TEST_KEY_SHARED_STR, 16, 1, NULL, STRDEF("blob.core.windows.net"), 443, 1000, true, NULL, NULL)),
             "new azure storage - shared key");
 
         // -------------------------------------------------------------------------------------------------------------------------
@@ -219,7 +228,7 @@ testRun(void)
 
         header = httpHeaderAdd(httpHeaderNew(NULL), HTTP_HEADER_CONTENT_LENGTH_STR, ZERO_STR);
 
-        TEST_RESULT_VOID(storageAzureAuth(storage, HTTP_VERB_GET_STR, STRDEF("/path"), NULL, dateTime, header), "auth");
+        TEST_RESULT_VOID(storageAzureAuth(storage, HTTP_VERB_GET_STR, STRDEF("/path"), NULL, dateTime, header, false), "auth");
         TEST_RESULT_STR_Z(
             httpHeaderToLog(header),
             "{authorization: 'SharedKey account:edqgT7EhsiIN3q6Al2HCZlpXr2D5cJFavr2ZCkhG9R8=', content-length: '0'"
@@ -234,7 +243,8 @@ testRun(void)
 
         HttpQuery *query = httpQueryAdd(httpQueryNewP(), STRDEF("a"), STRDEF("b"));
 
-        TEST_RESULT_VOID(storageAzureAuth(storage, HTTP_VERB_GET_STR, STRDEF("/path/file"), query, dateTime, header), "auth");
+        TEST_RESULT_VOID(
+            storageAzureAuth(storage, HTTP_VERB_GET_STR, STRDEF("/path/file"), query, dateTime, header, false), "auth");
         TEST_RESULT_STR_Z(
             httpHeaderToLog(header),
             "{authorization: 'SharedKey account:5qAnroLtbY8IWqObx8+UVwIUysXujsfWZZav7PrBON0=', content-length: '44'"
@@ -242,6 +252,19 @@ testRun(void)
                 ", host: 'account.blob.core.windows.net', x-ms-version: '2019-02-02'}",
             "check headers");
 
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("batch subrequest auth");
+
+        header = httpHeaderAdd(httpHeaderNew(NULL), HTTP_HEADER_CONTENT_LENGTH_STR, ZERO_STR);
+
+        TEST_RESULT_VOID(
+            storageAzureAuth(storage, HTTP_VERB_DELETE_STR, STRDEF("/container/path/file"), NULL, dateTime, header, true), "auth");
+        TEST_RESULT_STR_Z(
+            httpHeaderToLog(header),
+            "{authorization: 'SharedKey account:eUCg9vLMNmtxYTlvFIC0289cdXIbUwgK2Gr3XAYQOvA=', content-length: '0'"
+                ", x-ms-date: 'Sun, 21 Jun 2020 12:46:19 GMT'}",
+            "check headers");
+
         // -------------------------------------------------------------------------------------------------------------------------
         TEST_TITLE("SAS auth");
 
@@ -250,13 +273,14 @@ testRun(void)
             (StorageAzure *)storageDriver(
                 storageAzureNew(
                     STRDEF("/repo"), false, NULL, TEST_CONTAINER_STR, TEST_ACCOUNT_STR, storageAzureKeyTypeSas, TEST_KEY_SAS_STR,
-                    16, NULL, STRDEF("blob.core.usgovcloudapi.net"), 443, 1000, true, NULL, NULL)),
+                    16, 1, NULL, STRDEF("blob.core.usgovcloudapi.net"), 443, 1000, true, NULL, NULL)),
             "new azure storage - sas key");
 
         query = httpQueryAdd(httpQueryNewP(), STRDEF("a"), STRDEF("b"));
         header = httpHeaderAdd(httpHeaderNew(NULL), HTTP_HEADER_CONTENT_LENGTH_STR, STRDEF("66"));
 
-        TEST_RESULT_VOID(storageAzureAuth(storage, HTTP_VERB_GET_STR, STRDEF("/path/file"), query, dateTime, header), "auth");
+        TEST_RESULT_VOID(
+            storageAzureAuth(storage, HTTP_VERB_GET_STR, STRDEF("/path/file"), query, dateTime, header, false), "auth");
         TEST_RESULT_STR_Z(
             httpHeaderToLog(header), "{content-length: '66', host: 'account.blob.core.usgovcloudapi.net'}", "check headers");
         TEST_RESULT_STR_Z(httpQueryRenderP(query), "a=b&sig=key", "check query");
@@ -794,17 +818,53 @@ testRun(void)
                         "    <NextMarker/>"
                         "</EnumerationResults>");
 
-                testRequestP(service, HTTP_VERB_DELETE, "/test1.txt");
-                testResponseP(service);
-
-                testRequestP(service, HTTP_VERB_DELETE, "/path1/xxx.zzz");
-                testResponseP(service);
+                testRequestP(
+                    service, HTTP_VERB_POST, "?comp=batch&restype=container",
+                    .contentType = "multipart/mixed; boundary=pgbackrest_batch",
+                    .content =
+                        "--pgbackrest_batch\r\n"
+                        "Content-Type: application/http\r\n"
+                        "Content-Transfer-Encoding: binary\r\n"
+                        "Content-ID: 0\r\n"
+                        "\r\n"
+                        "DELETE /account/container/test1.txt?sig=key HTTP/1.1\r\n"
+                        "content-length: 0\r\n"
+                        "\r\n"
+                        "--pgbackrest_batch\r\n"
+                        "Content-Type: application/http\r\n"
+                        "Content-Transfer-Encoding: binary\r\n"
+                        "Content-ID: 1\r\n"
+                        "\r\n"
+                        "DELETE /account/container/path1/xxx.zzz?sig=key HTTP/1.1\r\n"
+                        "content-length: 0\r\n"
+                        "\r\n"
+                        "--pgbackrest_batch--\r\n");
+                testResponseP(
+                    service, .code = 202,
+                    .content =
+                        "--batch_x\r\n"
+                        "Content-Type: application/http\r\n"
+                        "Content-ID: 0\r\n"
+                        "\r\n"
+                        "HTTP/1.1 202 Accepted\r\n"
+                        "x-ms-delete-type-permanent: true\r\n"
+                        "\r\n"
+                        "--batch_x\r\n"
+                        "Content-Type: application/http\r\n"
+                        "Content-ID: 1\r\n"
+                        "\r\n"
+                        "HTTP/1.1 404 The specified blob does not exist.\r\n"
+                        "\r\n"
+                        "--batch_x--\r\n");
 
                 TEST_RESULT_VOID(storagePathRemoveP(storage, STRDEF("/"), .recurse = true), "remove");
 
                 // -----------------------------------------------------------------------------------------------------------------
                 TEST_TITLE("remove files from path");
 
+                // Set deleteMax to a small value so more than one batch is sent
+                driver->deleteMax = 1;
+
                 testRequestP(service, HTTP_VERB_GET, "?comp=list&prefix=path%2F&restype=container");
                 testResponseP(
                     service,
@@ -827,14 +887,250 @@ testRun(void)
                         "    <NextMarker/>"
                         "</EnumerationResults>");
 
-                testRequestP(service, HTTP_VERB_DELETE, "/path/test1.txt");
-                testResponseP(service);
+                testRequestP(
+                    service, HTTP_VERB_POST, "?comp=batch&restype=container",
+                    .contentType = "multipart/mixed; boundary=pgbackrest_batch",
+                    .content =
+                        "--pgbackrest_batch\r\n"
+                        "Content-Type: application/http\r\n"
+                        "Content-Transfer-Encoding: binary\r\n"
+                        "Content-ID: 0\r\n"
+                        "\r\n"
+                        "DELETE /account/container/path/test1.txt?sig=key HTTP/1.1\r\n"
+                        "content-length: 0\r\n"
+                        "\r\n"
+                        "--pgbackrest_batch--\r\n");
+                testResponseP(
+                    service, .code = 202,
+                    .content = "--batch_x\r\nContent-ID: 0\r\n\r\nHTTP/1.1 202 Accepted\r\n--batch_x--\r\n");
+                testRequestP(
+                    service, HTTP_VERB_POST, "?comp=batch&restype=container",
+                    .contentType = "multipart/mixed; boundary=pgbackrest_batch",
+                    .content =
+                        "--pgbackrest_batch\r\n"
+                        "Content-Type: application/http\r\n"
+                        "Content-Transfer-Encoding: binary\r\n"
+                        "Content-ID: 0\r\n"
+                        "\r\n"
+                        "DELETE /account/container/path/path1/xxx.zzz?sig=key HTTP/1.1\r\n"
+                        "content-length: 0\r\n"
+                        "\r\n"
+                        "--pgbackrest_batch--\r\n");
+                testResponseP(
+                    service, .code = 202,
+                    .content = "--batch_x\r\nContent-ID: 0\r\n\r\nHTTP/1.1 202 Accepted\r\n--batch_x--\r\n");
 
-                testRequestP(service, HTTP_VERB_DELETE, "/path/path1/xxx.zzz");
-                testResponseP(service);
+                TEST_RESULT_VOID(storagePathRemoveP(storage, STRDEF("/path"), .recurse = true), "remove");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("remove files from path error");
+
+                testRequestP(service, HTTP_VERB_GET, "?comp=list&prefix=path%2F&restype=container");
+                testResponseP(
+                    service,
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<EnumerationResults>"
+                        "    <Blobs>"
+                        "        <Blob>"
+                        "            <Name>path/test1.txt</Name>"
+                        "            <Properties/>"
+                        "        </Blob>"
+                        "    </Blobs>"
+                        "    <NextMarker/>"
+                        "</EnumerationResults>");
+
+                testRequestP(
+                    service, HTTP_VERB_POST, "?comp=batch&restype=container",
+                    .contentType = "multipart/mixed; boundary=pgbackrest_batch",
+                    .content =
+                        "--pgbackrest_batch\r\n"
+                        "Content-Type: application/http\r\n"
+                        "Content-Transfer-Encoding: binary\r\n"
+                        "Content-ID: 0\r\n"
+                        "\r\n"
+                        "DELETE /account/container/path/test1.txt?sig=key HTTP/1.1\r\n"
+                        "content-length: 0\r\n"
+                        "\r\n"
+                        "--pgbackrest_batch--\r\n");
+                testResponseP(
+                    service, .code = 202,
+                    .content =
+                        "--batch_x\r\nContent-ID: 0\r\n\r\nHTTP/1.1 403 This request is not authorized.\r\n--batch_x--\r\n");
+
+                TEST_ERROR(
+                    storagePathRemoveP(storage, STRDEF("/path"), .recurse = true), FileRemoveError,
+                    "unable to remove file '/path/test1.txt': [403] This request is not authorized.");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("remove files from path with retry");
+
+                driver->deleteMax = 2;
+
+                testRequestP(service, HTTP_VERB_GET, "?comp=list&prefix=path%2F&restype=container");
+                testResponseP(
+                    service,
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<EnumerationResults>"
+                        "    <Blobs>"
+                        "        <Blob>"
+                        "            <Name>path/test1.txt</Name>"
+                        "            <Properties/>"
+                        "        </Blob>"
+                        "        <Blob>"
+                        "            <Name>path/test2.txt</Name>"
+                        "            <Properties/>"
+                        "        </Blob>"
+                        "    </Blobs>"
+                        "    <NextMarker/>"
+                        "</EnumerationResults>");
+
+                testRequestP(
+                    service, HTTP_VERB_POST, "?comp=batch&restype=container",
+                    .contentType = "multipart/mixed; boundary=pgbackrest_batch",
+                    .content =
+                        "--pgbackrest_batch\r\n"
+                        "Content-Type: application/http\r\n"
+                        "Content-Transfer-Encoding: binary\r\n"
+                        "Content-ID: 0\r\n"
+                        "\r\n"
+                        "DELETE /account/container/path/test1.txt?sig=key HTTP/1.1\r\n"
+                        "content-length: 0\r\n"
+                        "\r\n"
+                        "--pgbackrest_batch\r\n"
+                        "Content-Type: application/http\r\n"
+                        "Content-Transfer-Encoding: binary\r\n"
+                        "Content-ID: 1\r\n"
+                        "\r\n"
+                        "DELETE /account/container/path/test2.txt?sig=key HTTP/1.1\r\n"
+                        "content-length: 0\r\n"
+                        "\r\n"
+                        "--pgbackrest_batch--\r\n");
+                testResponseP(
+                    service, .code = 202,
+                    .content =
+                        "--batch_x\r\nContent-ID: 0\r\n\r\nHTTP/1.1 202 Accepted\r\n"
+                        "--batch_x\r\nContent-ID: 1\r\n\r\nHTTP/1.1 500 Operation could not be completed within the specified"
+                        " time.\r\n"
+                        "--batch_x--\r\n");
+
+                // Only the part that failed is retried
+                testRequestP(
+                    service, HTTP_VERB_POST, "?comp=batch&restype=container",
+                    .contentType = "multipart/mixed; boundary=pgbackrest_batch",
+                    .content =
+                        "--pgbackrest_batch\r\n"
+                        "Content-Type: application/http\r\n"
+                        "Content-Transfer-Encoding: binary\r\n"
+                        "Content-ID: 0\r\n"
+                        "\r\n"
+                        "DELETE /account/container/path/test2.txt?sig=key HTTP/1.1\r\n"
+                        "content-length: 0\r\n"
+                        "\r\n"
+                        "--pgbackrest_batch--\r\n");
+                testResponseP(
+                    service, .code = 202,
+                    .content = "--batch_x\r\nContent-ID: 0\r\n\r\nHTTP/1.1 202 Accepted\r\n--batch_x--\r\n");
 
                 TEST_RESULT_VOID(storagePathRemoveP(storage, STRDEF("/path"), .recurse = true), "remove");
 
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("remove files from path retry timeout");
+
+                // Set the timeout to zero so there is no time to retry
+                HttpClientPub *const clientPub = (HttpClientPub *)driver->httpClient;
+                const TimeMSec timeout = clientPub->timeout;
+                clientPub->timeout = 0;
+
+                testRequestP(service, HTTP_VERB_GET, "?comp=list&prefix=path%2F&restype=container");
+                testResponseP(
+                    service,
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<EnumerationResults>"
+                        "    <Blobs>"
+                        "        <Blob>"
+                        "            <Name>path/test1.txt</Name>"
+                        "            <Properties/>"
+                        "        </Blob>"
+                        "    </Blobs>"
+                        "    <NextMarker/>"
+                        "</EnumerationResults>");
+
+                testRequestP(
+                    service, HTTP_VERB_POST, "?comp=batch&restype=container",
+                    .contentType = "multipart/mixed; boundary=pgbackrest_batch",
+                    .content =
+                        "--pgbackrest_batch\r\n"
+                        "Content-Type: application/http\r\n"
+                        "Content-Transfer-Encoding: binary\r\n"
+                        "Content-ID: 0\r\n"
+                        "\r\n"
+                        "DELETE /account/container/path/test1.txt?sig=key HTTP/1.1\r\n"
+                        "content-length: 0\r\n"
+                        "\r\n"
+                        "--pgbackrest_batch--\r\n");
+                testResponseP(
+                    service, .code = 202,
+                    .content = "--batch_x\r\nContent-ID: 0\r\n\r\nHTTP/1.1 503 Server Busy\r\n--batch_x--\r\n");
+
+                TEST_ERROR(
+                    storagePathRemoveP(storage, STRDEF("/path"), .recurse = true), FileRemoveError,
+                    "unable to remove file '/path/test1.txt': [503] Server Busy");
+
+                clientPub->timeout = timeout;
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("remove files from path with truncated response");
+
+                testRequestP(service, HTTP_VERB_GET, "?comp=list&prefix=path%2F&restype=container");
+                testResponseP(
+                    service,
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<EnumerationResults>"
+                        "    <Blobs>"
+                        "        <Blob>"
+                        "            <Name>path/test1.txt</Name>"
+                        "            <Properties/>"
+                        "        </Blob>"
+                        "        <Blob>"
+                        "            <Name>path/test2.txt</Name>"
+                        "            <Properties/>"
+                        "        </Blob>"
+                        "    </Blobs>"
+                        "    <NextMarker/>"
+                        "</EnumerationResults>");
+
+                testRequestP(
+                    service, HTTP_VERB_POST, "?comp=batch&restype=container",
+                    .contentType = "multipart/mixed; boundary=pgbackrest_batch",
+                    .content =
+                        "--pgbackrest_batch\r\n"
+                        "Content-Type: application/http\r\n"
+                        "Content-Transfer-Encoding: binary\r\n"
+                        "Content-ID: 0\r\n"
+                        "\r\n"
+                        "DELETE /account/container/path/test1.txt?sig=key HTTP/1.1\r\n"
+                        "content-length: 0\r\n"
+                        "\r\n"
+                        "--pgbackrest_batch\r\n"
+                        "Content-Type: application/http\r\n"
+                        "Content-Transfer-Encoding: binary\r\n"
+                        "Content-ID: 1\r\n"
+                        "\r\n"
+                        "DELETE /account/container/path/test2.txt?sig=key HTTP/1.1\r\n"
+                        "content-length: 0\r\n"
+                        "\r\n"
+                        "--pgbackrest_batch--\r\n");
+                testResponseP(
+                    service, .code = 202, .content = "--batch_x\r\nContent-ID: 1\r\n\r\nHTTP/1.1 202 Accepted\r\n");
+
+                TEST_ERROR(
+                    storagePathRemoveP(storage, STRDEF("/path"), .recurse = true), FormatError,
+                    "multipart response is missing status for Content-ID 0");
+
                 // -----------------------------------------------------------------------------------------------------------------
                 TEST_TITLE("remove files in empty subpath (nothing to do)");
 
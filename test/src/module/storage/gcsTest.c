@@ -68,10 +68,12 @@ typedef struct TestRequestParam
     VAR_PARAM_HEADER;
     bool noBucket;
     bool upload;
+    bool batch;
     bool noAuth;
     const char *object;
     const char *query;
     const char *range;
+    const char *contentType;
     const char *content;
 } TestRequestParam;
 
@@ -81,7 +83,9 @@ typedef struct TestRequestParam
 static void
 testRequest(IoWrite *write, const char *verb, TestRequestParam param)
 {
-    String *request = strNewFmt("%s %s/storage/v1/b%s", verb, param.upload ? "/upload" : "", param.noBucket ? "" : "/bucket/o");
+    String *request = param.batch ?
+        strNewFmt("%s /batch/storage/v1", verb) :
+        strNewFmt("%s %s/storage/v1/b%s", verb, param.upload ? "/upload" : "", param.noBucket ? "" : "/bucket/o");
 
     // Add object
     if (param.object != NULL)
@@ -105,6 +109,10 @@ testRequest(IoWrite *write, const char *verb, TestRequestParam param)
     if (param.range != NULL)
         strCatFmt(request, "content-range:bytes %s\r\n", param.range);
 
+    // Add content-type
+    if (param.contentType != NULL)
+        strCatFmt(request, "content-type:%s\r\n", param.contentType);
+
     // Add host
     strCatFmt(request, "host:%s\r\n", strZ(hrnServerHost()));
 
@@ -233,7 +241,7 @@ testRun(void)
             (StorageGcs *)storageDriver(
                 storageGcsNew(
                     STRDEF("/repo"), false, NULL, TEST_BUCKET_STR, storageGcsKeyTypeService, TEST_KEY_FILE_STR, TEST_CHUNK_SIZE,
-                    TEST_ENDPOINT_STR, TEST_TIMEOUT, true, NULL, NULL)),
+                    1, TEST_ENDPOINT_STR, TEST_TIMEOUT, true, NULL, NULL)),
             "read-only gcs storage - service key");
         TEST_RESULT_STR_Z(httpUrlHost(storage->authUrl), "test.com", "check host");
         TEST_RESULT_STR_Z(httpUrlPath(storage->authUrl), "/token", "check path");
@@ -258,7 +266,7 @@ testRun(void)
             (StorageGcs *)storageDriver(
                 storageGcsNew(
                     STRDEF("/repo"), true, NULL, TEST_BUCKET_STR, storageGcsKeyTypeService, TEST_KEY_FILE_STR, TEST_CHUNK_SIZE,
-                    TEST_ENDPOINT_STR, TEST_TIMEOUT, true, NULL, NULL)),
+                    1, TEST_ENDPOINT_STR, TEST_TIMEOUT, true, NULL, NULL)),
             "read/write gcs storage - service key");
 
         TEST_RESULT_STR_Z(
@@ -919,17 +927,47 @@ testRun(void)
                         "  ]"
                         "}");
 
-                testRequestP(service, HTTP_VERB_DELETE, .object = "path/to/test1.txt");
-                testResponseP(service);
-
-                testRequestP(service, HTTP_VERB_DELETE, .object = "path1/xxx.zzz");
-                testResponseP(service);
+                testRequestP(
+                    service, HTTP_VERB_POST, .batch = true, .contentType = "multipart/mixed; boundary=pgbackrest_batch",
+                    .content =
+                        "--pgbackrest_batch\r\n"
+                        "Content-Type: application/http\r\n"
+                        "Content-ID: 0\r\n"
+                        "\r\n"
+                        "DELETE /storage/v1/b/bucket/o/path%2Fto%2Ftest1.txt HTTP/1.1\r\n"
+                        "\r\n"
+                        "--pgbackrest_batch\r\n"
+                        "Content-Type: application/http\r\n"
+                        "Content-ID: 1\r\n"
+                        "\r\n"
+                        "DELETE /storage/v1/b/bucket/o/path1%2Fxxx.zzz HTTP/1.1\r\n"
+                        "\r\n"
+                        "--pgbackrest_batch--\r\n");
+                testResponseP(
+                    service,
+                    .content =
+                        "--batch_x\r\n"
+                        "Content-Type: application/http\r\n"
+                        "Content-ID: <response-1>\r\n"
+                        "\r\n"
+                        "HTTP/1.1 404 Not Found\r\n"
+                        "\r\n"
+                        "--batch_x\r\n"
+                        "Content-Type: application/http\r\n"
+                        "Content-ID: <response-0>\r\n"
+                        "\r\n"
+                        "HTTP/1.1 204 No Content\r\n"
+                        "\r\n"
+                        "--batch_x--\r\n");
 
                 TEST_RESULT_VOID(storagePathRemoveP(storage, STRDEF("/"), .recurse = true), "remove");
 
                 // -----------------------------------------------------------------------------------------------------------------
                 TEST_TITLE("remove files from path");
 
+                // Set deleteMax to a small value so more than one batch is sent
+                ((StorageGcs *)storageDriver(storage))->deleteMax = 1;
+
                 testRequestP(service, HTTP_VERB_GET, .query = "fields=nextPageToken%2Cprefixes%2Citems%28name%29&prefix=path%2F");
                 testResponseP(
                     service,
@@ -948,14 +986,182 @@ testRun(void)
                         "  ]"
                         "}");
 
-                testRequestP(service, HTTP_VERB_DELETE, .object = "path/test1.txt");
-                testResponseP(service);
+                testRequestP(
+                    service, HTTP_VERB_POST, .batch = true, .contentType = "multipart/mixed; boundary=pgbackrest_batch",
+                    .content =
+                        "--pgbackrest_batch\r\n"
+                        "Content-Type: application/http\r\n"
+                        "Content-ID: 0\r\n"
+                        "\r\n"
+                        "DELETE /storage/v1/b/bucket/o/path%2Ftest1.txt HTTP/1.1\r\n"
+                        "\r\n"
+                        "--pgbackrest_batch--\r\n");
+                testResponseP(
+                    service, .content = "--batch_x\r\nContent-ID: <response-0>\r\n\r\nHTTP/1.1 204 No Content\r\n--batch_x--\r\n");
+                testRequestP(
+                    service, HTTP_VERB_POST, .batch = true, .contentType = "multipart/mixed; boundary=pgbackrest_batch",
+                    .content =
+                        "--pgbackrest_batch\r\n"
+                        "Content-Type: application/http\r\n"
+                        "Content-ID: 0\r\n"
+                        "\r\n"
+                        "DELETE /storage/v1/b/bucket/o/path%2Fpath1%2Fxxx.zzz HTTP/1.1\r\n"
+                        "\r\n"
+                        "--pgbackrest_batch--\r\n");
+                testResponseP(
+                    service, .content = "--batch_x\r\nContent-ID: <response-0>\r\n\r\nHTTP/1.1 204 No Content\r\n--batch_x--\r\n");
 
-                testRequestP(service, HTTP_VERB_DELETE, .object = "path/path1/xxx.zzz");
-                testResponseP(service);
+                TEST_RESULT_VOID(storagePathRemoveP(storage, STRDEF("/path"), .recurse = true), "remove");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("remove files from path error");
+
+                testRequestP(service, HTTP_VERB_GET, .query = "fields=nextPageToken%2Cprefixes%2Citems%28name%29&prefix=path%2F");
+                testResponseP(
+                    service,
+                    .content =
+                        "{"
+                        "  \"items\": ["
+                        "    {"
+                        "      \"name\": \"path/test1.txt\""
+                        "    }"
+                        "  ]"
+                        "}");
+
+                testRequestP(
+                    service, HTTP_VERB_POST, .batch = true, .contentType = "multipart/mixed; boundary=pgbackrest_batch",
+                    .content =
+                        "--pgbackrest_batch\r\n"
+                        "Content-Type: application/http\r\n"
+                        "Content-ID: 0\r\n"
+                        "\r\n"
+                        "DELETE /storage/v1/b/bucket/o/path%2Ftest1.txt HTTP/1.1\r\n"
+                        "\r\n"
+                        "--pgbackrest_batch--\r\n");
+                testResponseP(
+                    service, .content = "--batch_x\r\nContent-ID: <response-0>\r\n\r\nHTTP/1.1 403 Forbidden\r\n--batch_x--\r\n");
+
+                TEST_ERROR(
+                    storagePathRemoveP(storage, STRDEF("/path"), .recurse = true), FileRemoveError,
+                    "unable to remove file '/path/test1.txt': [403] Forbidden");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("remove files from path with retry");
+
+                ((StorageGcs *)storageDriver(storage))->deleteMax = 2;
+
+                testRequestP(service, HTTP_VERB_GET, .query = "fields=nextPageToken%2Cprefixes%2Citems%28name%29&prefix=path%2F");
+                testResponseP(
+                    service,
+                    .content =
+                        "{"
+                        "  \"items\": ["
+                        "    {"
+                        "      \"name\": \"path/test1.txt\""
+                        "    },"
+                        "    {"
+                        "      \"name\": \"path/test2.txt\""
+                        "    }"
+                        "  ]"
+                        "}");
+
+                testRequestP(
+                    service, HTTP_VERB_POST, .batch = true, .contentType = "multipart/mixed; boundary=pgbackrest_batch",
+                    .content =
+                        "--pgbackrest_batch\r\n"
+                        "Content-Type: application/http\r\n"
+                        "Content-ID: 0\r\n"
+                        "\r\n"
+                        "DELETE /storage/v1/b/bucket/o/path%2Ftest1.txt HTTP/1.1\r\n"
+                        "\r\n"
+                        "--pgbackrest_batch\r\n"
+                        "Content-Type: application/http\r\n"
+                        "Content-ID: 1\r\n"
+                        "\r\n"
+                        "DELETE /storage/v1/b/bucket/o/path%2Ftest2.txt HTTP/1.1\r\n"
+                        "\r\n"
+                        "--pgbackrest_batch--\r\n");
+                testResponseP(
+                    service,
+                    .content =
+                        "--batch_x\r\nContent-ID: <response-0>\r\n\r\nHTTP/1.1 503 Service Unavailable\r\n"
+                        "--batch_x\r\nContent-ID: <response-1>\r\n\r\nHTTP/1.1 204 No Content\r\n--batch_x--\r\n");
+
+                // Only the part that failed is retried
+                testRequestP(
+                    service, HTTP_VERB_POST, .batch = true, .contentType = "multipart/mixed; boundary=pgbackrest_batch",
+                    .content =
+                        "--pgbackrest_batch\r\n"
+                        "Content-Type: application/http\r\n"
+                        "Content-ID: 0\r\n"
+                        "\r\n"
+                        "DELETE /storage/v1/b/bucket/o/path%2Ftest1.txt HTTP/1.1\r\n"
+                        "\r\n"
+                        "--pgbackrest_batch--\r\n");
+                testResponseP(
+                    service, .content = "--batch_x\r\nContent-ID: <response-0>\r\n\r\nHTTP/1.1 204 No Content\r\n--batch_x--\r\n");
 
                 TEST_RESULT_VOID(storagePathRemoveP(storage, STRDEF("/path"), .recurse = true), "remove");
 
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("remove files from path retry timeout");
+
+                // Set the timeout to zero so there is no time to retry
+                HttpClientPub *const clientPub = (HttpClientPub *)((StorageGcs *)storageDriver(storage))->httpClient;
+                const TimeMSec timeout = clientPub->timeout;
+                clientPub->timeout = 0;
+
+                testRequestP(service, HTTP_VERB_GET, .query = "fields=nextPageToken%2Cprefixes%2Citems%28name%29&prefix=path%2F");
+                testResponseP(service, .content = "{\"items\": [{\"name\": \"path/test1.txt\"}]}");
+
+                testRequestP(
+                    service, HTTP_VERB_POST, .batch = true, .contentType = "multipart/mixed; boundary=pgbackrest_batch",
+                    .content =
+                        "--pgbackrest_batch\r\n"
+                        "Content-Type: application/http\r\n"
+                        "Content-ID: 0\r\n"
+                        "\r\n"
+                        "DELETE /storage/v1/b/bucket/o/path%2Ftest1.txt HTTP/1.1\r\n"
+                        "\r\n"
+                        "--pgbackrest_batch--\r\n");
+                testResponseP(
+                    service,
+                    .content = "--batch_x\r\nContent-ID: <response-0>\r\n\r\nHTTP/1.1 429 Too Many Requests\r\n--batch_x--\r\n");
+
+                TEST_ERROR(
+                    storagePathRemoveP(storage, STRDEF("/path"), .recurse = true), FileRemoveError,
+                    "unable to remove file '/path/test1.txt': [429] Too Many Requests");
+
+                clientPub->timeout = timeout;
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("remove files from path with truncated response");
+
+                testRequestP(service, HTTP_VERB_GET, .query = "fields=nextPageToken%2Cprefixes%2Citems%28name%29&prefix=path%2F");
+                testResponseP(service, .content = "{\"items\": [{\"name\": \"path/test1.txt\"}, {\"name\": \"path/test2.txt\"}]}");
+
+                testRequestP(
+                    service, HTTP_VERB_POST, .batch = true, .contentType = "multipart/mixed; boundary=pgbackrest_batch",
+                    .content =
+                        "--pgbackrest_batch\r\n"
+                        "Content-Type: application/http\r\n"
+                        "Content-ID: 0\r\n"
+                        "\r\n"
+                        "DELETE /storage/v1/b/bucket/o/path%2Ftest1.txt HTTP/1.1\r\n"
+                        "\r\n"
+                        "--pgbackrest_batch\r\n"
+                        "Content-Type: application/http\r\n"
+                        "Content-ID: 1\r\n"
+                        "\r\n"
+                        "DELETE /storage/v1/b/bucket/o/path%2Ftest2.txt HTTP/1.1\r\n"
+                        "\r\n"
+                        "--pgbackrest_batch--\r\n");
+                testResponseP(service, .content = "--batch_x\r\nContent-ID: <response-1>\r\n\r\nHTTP/1.1 204 No Content\r\n");
+
+                TEST_ERROR(
+                    storagePathRemoveP(storage, STRDEF("/path"), .recurse = true), FormatError,
+                    "multipart response is missing status for Content-ID 0");
+
                 // -----------------------------------------------------------------------------------------------------------------
                 TEST_TITLE("remove files in empty subpath (nothing to do)");
 
@@ -862,6 +862,19 @@ testRun(void)
         TEST_ASSIGN(buffer, storageGetP(storageNewReadP(storageTest, STRDEF(TEST_PATH "/test.txt"), .limit = VARUINT64(7))), "get");
         TEST_RESULT_UINT(bufSize(buffer), 7, "check size");
         TEST_RESULT_BOOL(memcmp(bufPtrConst(buffer), "TESTFIL", bufSize(buffer)) == 0, true, "check content");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read bytes at offset");
+
+        TEST_ASSIGN(
+            buffer, storageGetP(storageNewReadP(storageTest, STRDEF(TEST_PATH "/test.txt"), .offset = 4, .limit = VARUINT64(3))),
+            "get");
+        TEST_RESULT_UINT(bufSize(buffer), 3, "check size");
+        TEST_RESULT_BOOL(memcmp(bufPtrConst(buffer), "FIL", bufSize(buffer)) == 0, true, "check content");
+
+        TEST_ASSIGN(buffer, storageGetP(storageNewReadP(storageTest, STRDEF(TEST_PATH "/test.txt"), .offset = 8)), "get to end");
+        TEST_RESULT_UINT(bufSize(buffer), 1, "check size");
+        TEST_RESULT_BOOL(memcmp(bufPtrConst(buffer), "\n", bufSize(buffer)) == 0, true, "check content");
     }
 
     // *****************************************************************************************************************************
@@ -988,6 +1001,48 @@ testRun(void)
         TEST_RESULT_VOID(storageReadFree(storageNewReadP(storageTest, fileName)), "   free file");
 
         TEST_RESULT_VOID(storageReadMove(NULL, memContextTop()), "   move null file");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read without caching");
+
+        buffer = bufNew(5 * 1024 * 1024 + 1);
+        memset(bufPtr(buffer), 'X', bufSize(buffer));
+        bufUsedSet(buffer, bufSize(buffer));
+
+        TEST_RESULT_VOID(storagePutP(storageNewWriteP(storageTest, fileName), buffer), "write test file");
+
+        outBuffer = bufNew(1024 * 1024);
+
+        TEST_ASSIGN(file, storageNewReadP(storageTest, fileName, .noCache = true), "new read file");
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(file)), true, "open file");
+
+        for (unsigned int readIdx = 0; readIdx < 4; readIdx++)
+        {
+            bufUsedZero(outBuffer);
+            ioRead(storageReadIo(file), outBuffer);
+        }
+
+        TEST_RESULT_UINT(((StorageReadPosix *)file->driver)->cacheDropped, 4 * 1024 * 1024, "chunk dropped");
+
+        bufUsedZero(outBuffer);
+        TEST_RESULT_UINT(ioRead(storageReadIo(file), outBuffer), 1024 * 1024, "read");
+        TEST_RESULT_UINT(((StorageReadPosix *)file->driver)->cacheDropped, 4 * 1024 * 1024, "partial chunk not dropped");
+
+        bufUsedZero(outBuffer);
+        TEST_RESULT_UINT(ioRead(storageReadIo(file), outBuffer), 1, "read to eof");
+        TEST_RESULT_UINT(((StorageReadPosix *)file->driver)->cacheDropped, bufSize(buffer), "all dropped at eof");
+        TEST_RESULT_VOID(ioReadClose(storageReadIo(file)), "close file");
+
+        TEST_ASSIGN(file, storageNewReadP(storageTest, fileName, .noCache = true, .offset = 1), "new read file");
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(file)), true, "open file");
+
+        bufUsedZero(outBuffer);
+        TEST_RESULT_UINT(ioRead(storageReadIo(file), outBuffer), 1024 * 1024, "read");
+        TEST_RESULT_UINT(((StorageReadPosix *)file->driver)->cacheDropped, 0, "nothing dropped");
+
+        StorageReadPosix *driver = file->driver;
+        TEST_RESULT_VOID(ioReadClose(storageReadIo(file)), "close file before eof");
+        TEST_RESULT_UINT(driver->cacheDropped, 1024 * 1024, "read bytes dropped on close");
     }
 
     // *****************************************************************************************************************************
@@ -1114,6 +1169,304 @@ testRun(void)
         TEST_RESULT_INT(storageInfoP(storageTest, fileName).mode, 0600, "    check file mode");
 
         storageRemoveP(storageTest, fileName, .errorOnMissing = true);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("sparse and preallocated writes");
+
+        // Zero blocks in the middle and at the end, a block that is zero except for one byte, and a partial zero block at the end.
+        // The io buffer size does not align with the sparse block size so blocks are split across writes.
+        Buffer *sparseBuffer = bufNew(STORAGE_WRITE_POSIX_BLOCK_SIZE * 5 + 100);
+        memset(bufPtr(sparseBuffer), 0, bufSize(sparseBuffer));
+        memset(bufPtr(sparseBuffer), 'a', STORAGE_WRITE_POSIX_BLOCK_SIZE);
+        bufPtr(sparseBuffer)[STORAGE_WRITE_POSIX_BLOCK_SIZE * 3 + 1] = 'b';
+        bufUsedSet(sparseBuffer, bufSize(sparseBuffer));
+
+        ioBufferSizeSet(20000);
+
+        TEST_ASSIGN(file, storageNewWriteP(storageTest, fileName, .sparse = true), "new sparse write file");
+        TEST_RESULT_VOID(ioWriteOpen(storageWriteIo(file)), "open file");
+        TEST_RESULT_VOID(ioWrite(storageWriteIo(file), sparseBuffer), "write to file");
+        TEST_RESULT_BOOL(((StorageWritePosix *)file->driver)->sizeSet, true, "zero blocks were skipped");
+        TEST_RESULT_VOID(ioWriteClose(storageWriteIo(file)), "close file");
+
+        TEST_RESULT_BOOL(bufEq(storageGetP(storageNewReadP(storageTest, fileName)), sparseBuffer), true, "check file contents");
+
+        TEST_ASSIGN(
+            file, storageNewWriteP(storageTest, fileName, .sparse = true, .preallocate = bufSize(sparseBuffer) * 2),
+            "new sparse write file with preallocation larger than file");
+        TEST_RESULT_VOID(ioWriteOpen(storageWriteIo(file)), "open file");
+        TEST_RESULT_VOID(ioWrite(storageWriteIo(file), sparseBuffer), "write to file");
+        TEST_RESULT_VOID(ioWriteClose(storageWriteIo(file)), "close file");
+
+        TEST_RESULT_BOOL(bufEq(storageGetP(storageNewReadP(storageTest, fileName)), sparseBuffer), true, "check file contents");
+
+        TEST_ASSIGN(
+            file, storageNewWriteP(storageTest, fileName, .preallocate = bufSize(sparseBuffer) * 2),
+            "new write file with preallocation larger than file");
+        TEST_RESULT_VOID(ioWriteOpen(storageWriteIo(file)), "open file");
+        TEST_RESULT_VOID(ioWrite(storageWriteIo(file), sparseBuffer), "write to file");
+        TEST_RESULT_VOID(ioWriteClose(storageWriteIo(file)), "close file");
+
+        TEST_RESULT_BOOL(bufEq(storageGetP(storageNewReadP(storageTest, fileName)), sparseBuffer), true, "check file contents");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("delta writes");
+
+        // Change a byte in a nonzero block and zero a block that was nonzero
+        Buffer *deltaBuffer = bufDup(sparseBuffer);
+        bufPtr(deltaBuffer)[10] = 'c';
+        bufPtr(deltaBuffer)[STORAGE_WRITE_POSIX_BLOCK_SIZE * 3 + 1] = 0;
+
+        TEST_ASSIGN(file, storageNewWriteP(storageTest, fileName, .delta = true, .noAtomic = true), "new delta write file");
+        TEST_RESULT_BOOL(storageWriteDeltaMatch(file), true, "delta match before write");
+        TEST_RESULT_VOID(ioWriteOpen(storageWriteIo(file)), "open file");
+        TEST_RESULT_VOID(ioWrite(storageWriteIo(file), deltaBuffer), "write to file");
+        TEST_RESULT_VOID(ioWriteClose(storageWriteIo(file)), "close file");
+        TEST_RESULT_BOOL(storageWriteDeltaMatch(file), false, "blocks written");
+
+        TEST_RESULT_BOOL(bufEq(storageGetP(storageNewReadP(storageTest, fileName)), deltaBuffer), true, "check file contents");
+
+        // Existing file matches so no blocks are written
+        TEST_ASSIGN(file, storageNewWriteP(storageTest, fileName, .delta = true, .noAtomic = true), "new delta write file");
+        TEST_RESULT_VOID(ioWriteOpen(storageWriteIo(file)), "open file");
+        TEST_RESULT_VOID(ioWrite(storageWriteIo(file), deltaBuffer), "write to file");
+        TEST_RESULT_VOID(ioWriteClose(storageWriteIo(file)), "close file");
+        TEST_RESULT_BOOL(storageWriteDeltaMatch(file), true, "no blocks written");
+
+        TEST_RESULT_BOOL(bufEq(storageGetP(storageNewReadP(storageTest, fileName)), deltaBuffer), true, "check file contents");
+
+        // Existing file is larger than the new file
+        bufUsedSet(deltaBuffer, STORAGE_WRITE_POSIX_BLOCK_SIZE + 1);
+
+        TEST_ASSIGN(file, storageNewWriteP(storageTest, fileName, .delta = true, .noAtomic = true), "new delta write file");
+        TEST_RESULT_VOID(ioWriteOpen(storageWriteIo(file)), "open file");
+        TEST_RESULT_VOID(ioWrite(storageWriteIo(file), deltaBuffer), "write to file");
+        TEST_RESULT_VOID(ioWriteClose(storageWriteIo(file)), "close file");
+
+        TEST_RESULT_BOOL(bufEq(storageGetP(storageNewReadP(storageTest, fileName)), deltaBuffer), true, "check file contents");
+
+        // Existing file is smaller than the new file, which also ends in zeroes
+        TEST_ASSIGN(
+            file, storageNewWriteP(storageTest, fileName, .delta = true, .sparse = true, .noAtomic = true),
+            "new delta write file");
+        TEST_RESULT_VOID(ioWriteOpen(storageWriteIo(file)), "open file");
+        TEST_RESULT_VOID(ioWrite(storageWriteIo(file), sparseBuffer), "write to file");
+        TEST_RESULT_VOID(ioWriteClose(storageWriteIo(file)), "close file");
+
+        TEST_RESULT_BOOL(bufEq(storageGetP(storageNewReadP(storageTest, fileName)), sparseBuffer), true, "check file contents");
+
+        // Missing file is created
+        storageRemoveP(storageTest, fileName, .errorOnMissing = true);
+
+        TEST_ASSIGN(file, storageNewWriteP(storageTest, fileName, .delta = true, .noAtomic = true), "new delta write file");
+        TEST_RESULT_VOID(ioWriteOpen(storageWriteIo(file)), "open file");
+        TEST_RESULT_VOID(ioWrite(storageWriteIo(file), sparseBuffer), "write to file");
+        TEST_RESULT_VOID(ioWriteClose(storageWriteIo(file)), "close file");
+
+        TEST_RESULT_BOOL(bufEq(storageGetP(storageNewReadP(storageTest, fileName)), sparseBuffer), true, "check file contents");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("sparse write errors");
+
+        TEST_ASSIGN(file, storageNewWriteP(storageTest, fileName, .sparse = true, .noAtomic = true), "new sparse write file");
+        TEST_RESULT_VOID(ioWriteOpen(storageWriteIo(file)), "open file");
+
+        // Close the file descriptor so operations will fail
+        close(((StorageWritePosix *)file->driver)->fd);
+
+        TEST_ERROR_FMT(
+            storageWritePosix(file->driver, BUFSTRDEF("data")), FileWriteError, "unable to write '%s': [9] Bad file descriptor",
+            strZ(fileName));
+        TEST_ERROR_FMT(
+            storageWritePosix(file->driver, bufNewC("\0\0", 2)), FileWriteError, "unable to seek in '%s': [9] Bad file descriptor",
+            strZ(fileName));
+
+        ((StorageWritePosix *)file->driver)->delta = true;
+
+        TEST_ERROR_FMT(
+            storageWritePosix(file->driver, BUFSTRDEF("data")), FileReadError, "unable to read '%s': [9] Bad file descriptor",
+            strZ(fileName));
+
+        ((StorageWritePosix *)file->driver)->sizeSet = true;
+
+        TEST_ERROR_FMT(
+            storageWritePosixClose(file->driver), FileWriteError, "unable to truncate '%s': [9] Bad file descriptor",
+            strZ(fileName));
+
+        // Clear the callback so the close on free will not fail
+        memContextCallbackClear(((StorageWritePosix *)file->driver)->memContext);
+
+        storageRemoveP(storageTest, fileName, .errorOnMissing = true);
+    }
+
+    // *****************************************************************************************************************************
+    if (testBegin("io_uring"))
+    {
+        const Storage *storageUring = storagePosixNewP(TEST_PATH_STR, .write = true, .uring = true);
+        const String *fileName = STRDEF(TEST_PATH "/test.file");
+        StorageWrite *write = NULL;
+        StorageRead *read = NULL;
+
+        // Use a small buffer so there are more reads and writes than slots
+        ioBufferSizeSet(64);
+
+        Buffer *buffer = bufNew(1000);
+
+        for (unsigned int idx = 0; idx < bufSize(buffer); idx++)
+            bufPtr(buffer)[idx] = (unsigned char)(idx % 251);
+
+        bufUsedSet(buffer, bufSize(buffer));
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("write and read file");
+
+        TEST_ASSIGN(write, storageNewWriteP(storageUring, fileName), "new write");
+        TEST_RESULT_VOID(ioWriteOpen(storageWriteIo(write)), "open");
+#ifdef HAVE_IO_URING
+        TEST_RESULT_BOOL(((StorageWritePosix *)write->driver)->uringQueue != NULL, true, "io_uring queue");
+#endif
+        TEST_RESULT_VOID(ioWrite(storageWriteIo(write), buffer), "write");
+        TEST_RESULT_VOID(ioWriteClose(storageWriteIo(write)), "close");
+
+        TEST_ASSIGN(read, storageNewReadP(storageUring, fileName), "new read");
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(read)), true, "open");
+#ifdef HAVE_IO_URING
+        TEST_RESULT_BOOL(((StorageReadPosix *)read->driver)->uringQueue != NULL, true, "io_uring queue");
+#endif
+        TEST_RESULT_BOOL(bufEq(ioReadBuf(storageReadIo(read)), buffer), true, "check contents");
+
+        TEST_RESULT_BOOL(
+            bufEq(storageGetP(storageNewReadP(storageTest, fileName)), buffer), true, "check contents without io_uring");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read with offset and limit");
+
+        TEST_RESULT_BOOL(
+            bufEq(
+                storageGetP(storageNewReadP(storageUring, fileName, .offset = 100, .limit = VARUINT64(300))),
+                BUF(bufPtr(buffer) + 100, 300)),
+            true, "check contents");
+        TEST_RESULT_BOOL(
+            bufEq(storageGetP(storageNewReadP(storageUring, fileName, .offset = 936)), BUF(bufPtr(buffer) + 936, 64)), true,
+            "check contents with size a multiple of buffer");
+        TEST_RESULT_UINT(bufUsed(storageGetP(storageNewReadP(storageUring, fileName, .limit = VARUINT64(0)))), 0, "zero limit");
+
+#ifdef HAVE_IO_URING
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("files share the storage queue until all slots are acquired");
+
+        StorageRead *readList[STORAGE_POSIX_URING_FILE_MAX + 1];
+
+        for (unsigned int readIdx = 0; readIdx < STORAGE_POSIX_URING_FILE_MAX + 1; readIdx++)
+        {
+            readList[readIdx] = storageNewReadP(storageUring, fileName);
+            TEST_RESULT_BOOL(ioReadOpen(storageReadIo(readList[readIdx])), true, "open");
+        }
+
+        StoragePosixUring *const uringQueue = ((StorageReadPosix *)readList[0]->driver)->uringQueue;
+
+        TEST_RESULT_BOOL(uringQueue != NULL, true, "io_uring queue");
+        TEST_RESULT_PTR(((StorageReadPosix *)readList[1]->driver)->uringQueue, uringQueue, "queue is shared");
+        TEST_RESULT_UINT(((StorageReadPosix *)readList[0]->driver)->uringSlotFirst, 0, "first slot");
+        TEST_RESULT_UINT(
+            ((StorageReadPosix *)readList[1]->driver)->uringSlotFirst, STORAGE_POSIX_URING_DEPTH, "first slot of second file");
+        TEST_RESULT_PTR(
+            ((StorageReadPosix *)readList[STORAGE_POSIX_URING_FILE_MAX]->driver)->uringQueue, NULL, "no slots for last file");
+
+        // Read the files in reverse order so completions for other files are processed while waiting
+        for (unsigned int readIdx = STORAGE_POSIX_URING_FILE_MAX + 1; readIdx > 0; readIdx--)
+            TEST_RESULT_BOOL(bufEq(ioReadBuf(storageReadIo(readList[readIdx - 1])), buffer), true, "check contents");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("slots are released when the file is closed or freed");
+
+        TEST_RESULT_VOID(ioReadClose(storageReadIo(readList[1])), "close second file");
+        TEST_RESULT_VOID(storageReadFree(readList[0]), "free first file");
+
+        TEST_ASSIGN(read, storageNewReadP(storageUring, fileName), "new read");
+        TEST_RESULT_BOOL(ioReadOpen(storageReadIo(read)), true, "open");
+        TEST_RESULT_UINT(((StorageReadPosix *)read->driver)->uringSlotFirst, 0, "first slot reused");
+        TEST_RESULT_BOOL(bufEq(ioReadBuf(storageReadIo(read)), buffer), true, "check contents");
+
+        TEST_ASSIGN(write, storageNewWriteP(storageUring, STRDEF(TEST_PATH "/test2.file")), "new write");
+        TEST_RESULT_VOID(ioWriteOpen(storageWriteIo(write)), "open");
+        TEST_RESULT_UINT(((StorageWritePosix *)write->driver)->uringSlotFirst, STORAGE_POSIX_URING_DEPTH, "second slot reused");
+        TEST_RESULT_VOID(ioWrite(storageWriteIo(write), buffer), "write");
+        TEST_RESULT_VOID(ioWriteClose(storageWriteIo(write)), "close");
+
+        for (unsigned int readIdx = 2; readIdx < STORAGE_POSIX_URING_FILE_MAX + 1; readIdx++)
+            storageReadFree(readList[readIdx]);
+
+        storageReadFree(read);
+
+        TEST_RESULT_BOOL(
+            bufEq(storageGetP(storageNewReadP(storageTest, STRDEF(TEST_PATH "/test2.file"))), buffer), true, "check contents");
+
+        HRN_STORAGE_REMOVE(storageTest, "test2.file", .errorOnMissing = true);
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("queue created by the parent is not used after fork");
+
+        HRN_FORK_BEGIN()
+        {
+            HRN_FORK_CHILD_BEGIN()
+            {
+                TEST_ASSIGN(read, storageNewReadP(storageUring, fileName), "new read");
+                TEST_RESULT_BOOL(ioReadOpen(storageReadIo(read)), true, "open");
+                TEST_RESULT_PTR(((StorageReadPosix *)read->driver)->uringQueue, NULL, "no io_uring queue");
+                TEST_RESULT_BOOL(bufEq(ioReadBuf(storageReadIo(read)), buffer), true, "check contents");
+            }
+            HRN_FORK_CHILD_END();
+        }
+        HRN_FORK_END();
+#endif
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("sparse write");
+
+        Buffer *sparseBuffer = bufNew(STORAGE_WRITE_POSIX_BLOCK_SIZE * 3);
+        memset(bufPtr(sparseBuffer), 0, bufSize(sparseBuffer));
+        memset(bufPtr(sparseBuffer) + STORAGE_WRITE_POSIX_BLOCK_SIZE, 'a', STORAGE_WRITE_POSIX_BLOCK_SIZE);
+        bufUsedSet(sparseBuffer, bufSize(sparseBuffer));
+
+        TEST_RESULT_VOID(
+            storagePutP(storageNewWriteP(storageUring, fileName, .sparse = true), sparseBuffer), "write sparse file");
+        TEST_RESULT_BOOL(bufEq(storageGetP(storageNewReadP(storageUring, fileName)), sparseBuffer), true, "check contents");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("free with writes in flight");
+
+        TEST_ASSIGN(write, storageNewWriteP(storageUring, fileName, .noAtomic = true), "new write");
+        TEST_RESULT_VOID(ioWriteOpen(storageWriteIo(write)), "open");
+        TEST_RESULT_VOID(ioWrite(storageWriteIo(write), buffer), "write");
+        TEST_RESULT_VOID(ioWriteFlush(storageWriteIo(write)), "flush");
+        TEST_RESULT_VOID(storageWriteFree(write), "free");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("read error");
+
+        TEST_ERROR_FMT(
+            storageGetP(storageNewReadP(storageUring, STRDEF(TEST_PATH))), FileReadError,
+            "unable to read '" TEST_PATH "': [21] Is a directory");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("write error");
+
+        TEST_ASSIGN(write, storageNewWriteP(storageUring, fileName, .noAtomic = true), "new write");
+        TEST_RESULT_VOID(ioWriteOpen(storageWriteIo(write)), "open");
+
+        // Close the file descriptor so operations will fail
+        close(((StorageWritePosix *)write->driver)->fd);
+
+        TEST_RESULT_VOID(storageWritePosix(write->driver, BUFSTRDEF("data")), "queue write");
+        TEST_ERROR_FMT(
+            storageWritePosixClose(write->driver), FileWriteError, "unable to write '%s': [9] Bad file descriptor",
+            strZ(fileName));
+
+        // Clear the callback so the close on free will not fail
+        memContextCallbackClear(((StorageWritePosix *)write->driver)->memContext);
+
+        storageRemoveP(storageTest, fileName, .errorOnMissing = true);
     }
 
     // *****************************************************************************************************************************
@@ -1206,6 +1559,64 @@ testRun(void)
         TEST_RESULT_PTR(storageRepoWrite(), storage, "get cached storage");
 
         TEST_RESULT_BOOL(storage->write, true, "get write enabled");
+        TEST_RESULT_PTR(storage->throttleRead, NULL, "no throttle");
+
+        // -------------------------------------------------------------------------------------------------------------------------
+        TEST_TITLE("throttle");
+
+        argList = strLstNew();
+        strLstAddZ(argList, "--stanza=db");
+        hrnCfgArgRawZ(argList, cfgOptPgPath, TEST_PATH "/pg");
+        strLstAddZ(argList, "--repo-path=" TEST_PATH);
+        hrnCfgArgRawZ(argList, cfgOptThrottleRead, "1MB");
+        hrnCfgArgRawZ(argList, cfgOptThrottleWriteIops, "10");
+        HRN_CFG_LOAD(cfgCmdBackup, argList);
+
+        TEST_ASSIGN(storage, storageRepo(), "new repo storage");
+        TEST_RESULT_BOOL(storageHelper.throttleRead != NULL, true, "read throttle");
+        TEST_RESULT_PTR(storage->throttleRead, storageHelper.throttleRead, "repo read throttle");
+        TEST_RESULT_PTR(storage->throttleWrite, storageHelper.throttleWrite, "repo write throttle");
+        TEST_RESULT_PTR(storagePg()->throttleRead, storageHelper.throttleRead, "pg read throttle");
+        TEST_RESULT_STR_Z(storageHelper.throttleFile, TEST_PATH "/lock/db.throttle", "throttle file");
+
+        TEST_RESULT_UINT(storageHelperThrottleLimitRead(NULL).byteRate, 1024 * 1024, "configured read bytes");
+        TEST_RESULT_UINT(storageHelperThrottleLimitRead(NULL).opRate, 0, "configured read ops");
+        TEST_RESULT_UINT(storageHelperThrottleLimitWrite(NULL).byteRate, 0, "configured write bytes");
+        TEST_RESULT_UINT(storageHelperThrottleLimitWrite(NULL).opRate, 10, "configured write ops");
+
+        HRN_STORAGE_PUT_Z(
+            storageTest, "lock/db.throttle",
+            "# limits\n"
+            "\n"
+            "throttle-read = 2MB\n"
+            "throttle-read-iops=5\n"
+            "throttle-write=100\n"
+            "throttle-write-iops=0\n"
+            "bogus=1\n"
+            "throttle-write\n"
+            "throttle-read-iops=x\n"
+            "throttle-write=1023\n"
+            "throttle-read-iops=1000001\n",
+            .timeModified = 1000000000);
+
+        TEST_RESULT_UINT(storageHelperThrottleLimitRead(NULL).byteRate, 2 * 1024 * 1024, "file read bytes");
+        TEST_RESULT_LOG(
+            "P00   WARN: unable to load 'bogus=1' from '" TEST_PATH "/lock/db.throttle': invalid option\n"
+            "P00   WARN: unable to load 'throttle-write' from '" TEST_PATH "/lock/db.throttle': missing '='\n"
+            "P00   WARN: unable to load 'throttle-read-iops=x' from '" TEST_PATH "/lock/db.throttle': unable to convert base 10"
+            " string 'x' to uint64\n"
+            "P00   WARN: unable to load 'throttle-write=1023' from '" TEST_PATH "/lock/db.throttle': value is out of range\n"
+            "P00   WARN: unable to load 'throttle-read-iops=1000001' from '" TEST_PATH "/lock/db.throttle': value is out of"
+            " range");
+
+        TEST_RESULT_UINT(storageHelperThrottleLimitRead(NULL).opRate, 5, "file read ops");
+        TEST_RESULT_UINT(storageHelperThrottleLimitWrite(NULL).byteRate, 100, "file write bytes");
+        TEST_RESULT_UINT(storageHelperThrottleLimitWrite(NULL).opRate, 0, "file write ops");
+
+        HRN_STORAGE_REMOVE(storageTest, "lock/db.throttle");
+
+        TEST_RESULT_UINT(storageHelperThrottleLimitRead(NULL).byteRate, 1024 * 1024, "configured read bytes");
+        TEST_RESULT_UINT(storageHelperThrottleLimitWrite(NULL).opRate, 10, "configured write ops");
     }
 
     // *****************************************************************************************************************************
@@ -26,6 +26,8 @@ typedef struct TestRequestParam
     const char *content;
     const char *accessKey;
     const char *securityToken;
+    const char *range;
+    const char *ifMatch;
 } TestRequestParam;
 
 #define testRequestP(write, s3, verb, path, ...)                                                                                   \
@@ -63,7 +65,15 @@ testRequest(IoWrite *write, Storage *s3, const char *verb, const char *path, Tes
         if (param.content != NULL)
             strCatZ(request, "content-md5;");
 
-        strCatZ(request, "host;x-amz-content-sha256;x-amz-date");
+        strCatZ(request, "host;");
+
+        if (param.ifMatch != NULL)
+            strCatZ(request, "if-match;");
+
+        if (param.range != NULL)
+            strCatZ(request, "range;");
+
+        strCatZ(request, "x-amz-content-sha256;x-amz-date");
 
         if (securityToken != NULL)
             strCatZ(request, ";x-amz-security-token");
@@ -93,6 +103,14 @@ testRequest(IoWrite *write, Storage *s3, const char *verb, const char *path, Tes
     else
         strCatFmt(request, "host:%s\r\n", strZ(hrnServerHost()));
 
+    // Add if-match
+    if (param.ifMatch != NULL)
+        strCatFmt(request, "if-match:%s\r\n", param.ifMatch);
+
+    // Add range
+    if (param.range != NULL)
+        strCatFmt(request, "range:bytes=%s\r\n", param.range);
+
     // Add content checksum and date if s3 service
     if (s3 != NULL)
     {
@@ -260,6 +278,9 @@ testRun(void)
         TEST_RESULT_STR(driver->accessKey, accessKey, "check access key");
         TEST_RESULT_STR(driver->secretAccessKey, secretAccessKey, "check secret access key");
         TEST_RESULT_STR(driver->securityToken, NULL, "check security token");
+        TEST_RESULT_UINT(driver->partConcurrency, 1, "check part concurrency");
+        TEST_RESULT_UINT(driver->downloadConcurrency, 1, "check download concurrency");
+        TEST_RESULT_UINT(driver->downloadRangeSize, 0, "check download range size");
         TEST_RESULT_STR(
             httpClientToLog(driver->httpClient),
             strNewFmt(
@@ -314,18 +335,23 @@ testRun(void)
         TEST_RESULT_BOOL(driver->signingKey != lastSigningKey, true, "check signing key was regenerated");
 
         // -------------------------------------------------------------------------------------------------------------------------
-        TEST_TITLE("config with token, endpoint with custom port, and ca-file/path");
+        TEST_TITLE("config with token, endpoint with custom port, ca-file/path, and upload/read concurrency");
 
         argList = strLstDup(commonArgWithoutEndpointList);
         hrnCfgArgRawZ(argList, cfgOptRepoS3Endpoint, "custom.endpoint:333");
         hrnCfgArgRawZ(argList, cfgOptRepoStorageCaPath, "/path/to/cert");
         hrnCfgArgRawZ(argList, cfgOptRepoStorageCaFile, HRN_PATH_REPO "/" HRN_SERVER_CERT_PREFIX ".crt");
+        hrnCfgArgRawZ(argList, cfgOptRepoS3UploadConcurrency, "4");
+        hrnCfgArgRawZ(argList, cfgOptRepoStorageReadConcurrency, "3");
         hrnCfgEnvRaw(cfgOptRepoS3Token, securityToken);
         HRN_CFG_LOAD(cfgCmdArchivePush, argList);
 
         driver = (StorageS3 *)storageDriver(storageRepoGet(0, false));
 
         TEST_RESULT_STR(driver->securityToken, securityToken, "check security token");
+        TEST_RESULT_UINT(driver->partConcurrency, 4, "check part concurrency");
+        TEST_RESULT_UINT(driver->downloadConcurrency, 3, "check download concurrency");
+        TEST_RESULT_UINT(driver->downloadRangeSize, STORAGE_RANGE_READ_SIZE_DEFAULT, "check download range size");
         TEST_RESULT_STR(
             httpClientToLog(driver->httpClient),
             strNewFmt(
@@ -429,6 +455,173 @@ testRun(void)
 
                 TEST_RESULT_STR_Z(strNewBuf(storageGetP(storageNewReadP(s3, STRDEF("file0.txt")))), "", "get zero-length file");
 
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("ignore missing file with range reads");
+
+                driver->downloadRangeSize = 16;
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/file.txt", .range = "0-15");
+                testResponseP(service, .code = 404);
+
+                TEST_RESULT_PTR(storageGetP(storageNewReadP(s3, STRDEF("file.txt"), .ignoreMissing = true)), NULL, "get file");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("get zero-length file with range reads");
+
+                // The first range is not satisfiable so the file is requested again without a range
+                testRequestP(service, s3, HTTP_VERB_GET, "/file0.txt", .range = "0-15");
+                testResponseP(service, .code = 416);
+                testRequestP(service, s3, HTTP_VERB_GET, "/file0.txt");
+                testResponseP(service);
+
+                TEST_RESULT_STR_Z(strNewBuf(storageGetP(storageNewReadP(s3, STRDEF("file0.txt")))), "", "get zero-length file");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("get file that fits in a single range");
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/file.txt", .range = "0-15");
+                testResponseP(
+                    service, .code = 206, .header = "content-range:bytes 0-9/10\r\netag:\"AAA\"", .content = "small file");
+
+                TEST_RESULT_STR_Z(strNewBuf(storageGetP(storageNewReadP(s3, STRDEF("file.txt")))), "small file", "get file");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("get file in sequential ranges");
+
+                // Later ranges are pinned to the etag of the first response
+                testRequestP(service, s3, HTTP_VERB_GET, "/file.txt", .range = "0-15");
+                testResponseP(
+                    service, .code = 206, .header = "content-range:bytes 0-15/45\r\netag:\"BBB\"", .content = "this is a sample");
+                testRequestP(service, s3, HTTP_VERB_GET, "/file.txt", .range = "16-31", .ifMatch = "\"BBB\"");
+                testResponseP(service, .code = 206, .header = "content-range:bytes 16-31/45", .content = " file that is re");
+                testRequestP(service, s3, HTTP_VERB_GET, "/file.txt", .range = "32-44", .ifMatch = "\"BBB\"");
+                testResponseP(service, .code = 206, .header = "content-range:bytes 32-44/45", .content = "ad in ranges!");
+
+                TEST_RESULT_STR_Z(
+                    strNewBuf(storageGetP(storageNewReadP(s3, STRDEF("file.txt")))),
+                    "this is a sample file that is read in ranges!", "get file");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("error when the file changes between ranges");
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/file.txt", .range = "0-15");
+                testResponseP(
+                    service, .code = 206, .header = "content-range:bytes 0-15/45\r\netag:\"CCC\"", .content = "this is a sample");
+                testRequestP(service, s3, HTTP_VERB_GET, "/file.txt", .range = "16-31", .ifMatch = "\"CCC\"");
+                testResponseP(service, .code = 412);
+
+                TEST_ERROR(
+                    storageGetP(storageNewReadP(s3, STRDEF("file.txt"))), ProtocolError,
+                    "HTTP request failed with 412:\n"
+                    "*** Path/Query ***:\n"
+                    "GET /file.txt\n"
+                    "*** Request Headers ***:\n"
+                    "authorization: <redacted>\n"
+                    "content-length: 0\n"
+                    "host: bucket." S3_TEST_HOST "\n"
+                    "if-match: \"CCC\"\n"
+                    "range: bytes=16-31\n"
+                    "x-amz-content-sha256: e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855\n"
+                    "x-amz-date: <redacted>\n"
+                    "x-amz-security-token: <redacted>");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("error when the size changes between ranges without an etag");
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/file.txt", .range = "0-15");
+                testResponseP(service, .code = 206, .header = "content-range:bytes 0-15/45", .content = "this is a sample");
+                testRequestP(service, s3, HTTP_VERB_GET, "/file.txt", .range = "16-31");
+                testResponseP(service, .code = 206, .header = "content-range:bytes 16-31/46", .content = " file that is re");
+
+                TEST_ERROR(
+                    storageGetP(storageNewReadP(s3, STRDEF("file.txt"))), FormatError,
+                    "object size changed from 45 to 46 during range read");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("error when range is ignored");
+
+                hrnServerScriptClose(service);
+                hrnServerScriptAccept(service);
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/file.txt", .range = "0-15");
+                testResponseP(service, .content = "this is a sample file that is read in ranges!");
+
+                TEST_ERROR(
+                    storageGetP(storageNewReadP(s3, STRDEF("file.txt"))), ProtocolError,
+                    "expected response 206 for range 0-15 but got 200");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("error on invalid content-range");
+
+                hrnServerScriptClose(service);
+                hrnServerScriptAccept(service);
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/file.txt", .range = "0-15");
+                testResponseP(service, .code = 206, .header = "content-range:0-15/45", .content = "this is a sample");
+
+                TEST_ERROR(
+                    storageGetP(storageNewReadP(s3, STRDEF("file.txt"))), FormatError, "invalid content-range '0-15/45'");
+
+                hrnServerScriptClose(service);
+                hrnServerScriptAccept(service);
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/file.txt", .range = "0-15");
+                testResponseP(service, .code = 206, .header = "content-range:bytes 0-15", .content = "this is a sample");
+
+                TEST_ERROR(
+                    storageGetP(storageNewReadP(s3, STRDEF("file.txt"))), FormatError, "invalid content-range 'bytes 0-15'");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("error when content-range does not match the range requested");
+
+                hrnServerScriptClose(service);
+                hrnServerScriptAccept(service);
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/file.txt", .range = "0-15");
+                testResponseP(service, .code = 206, .header = "content-range:bytes 0-7/45", .content = "this is ");
+
+                TEST_ERROR(
+                    storageGetP(storageNewReadP(s3, STRDEF("file.txt"))), FormatError,
+                    "content-range 'bytes 0-7/45' does not match range 0-15");
+
+                hrnServerScriptClose(service);
+                hrnServerScriptAccept(service);
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/file.txt", .range = "0-15");
+                testResponseP(service, .code = 206, .header = "content-range:bytes 1-16/45", .content = "his is a sample ");
+
+                TEST_ERROR(
+                    storageGetP(storageNewReadP(s3, STRDEF("file.txt"))), FormatError,
+                    "content-range 'bytes 1-16/45' does not match range 0-15");
+
+                hrnServerScriptClose(service);
+                hrnServerScriptAccept(service);
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("get part of file in concurrent ranges");
+
+                // The second range is requested on a new session while the first response is being read. The first response is
+                // read until the session is closed so the server can accept the new session.
+                driver->downloadConcurrency = 2;
+
+                testRequestP(service, s3, HTTP_VERB_GET, "/file.txt", .range = "4-19");
+                testResponseP(
+                    service, .code = 206, .header = "connection:close\r\ncontent-range:bytes 4-19/45\r\netag:\"DDD\"",
+                    .content = NULL);
+                hrnServerScriptReply(service, STRDEF(" is a sample fil"));
+                hrnServerScriptClose(service);
+
+                hrnServerScriptAccept(service);
+                testRequestP(service, s3, HTTP_VERB_GET, "/file.txt", .range = "20-33", .ifMatch = "\"DDD\"");
+                testResponseP(service, .code = 206, .header = "content-range:bytes 20-33/45", .content = "e that is read");
+
+                TEST_RESULT_STR_Z(
+                    strNewBuf(storageGetP(storageNewReadP(s3, STRDEF("file.txt"), .offset = 4, .limit = VARUINT64(30)))),
+                    " is a sample file that is read", "get file");
+
+                driver->downloadConcurrency = 1;
+                driver->downloadRangeSize = 0;
+
                 // -----------------------------------------------------------------------------------------------------------------
                 TEST_TITLE("switch to temp credentials");
 
@@ -570,7 +763,6 @@ testRun(void)
                 testRequestP(service, s3, HTTP_VERB_GET, "/file.txt", .accessKey = "x", .securityToken = "z");
                 testResponseP(service, .code = 303, .content = "CONTENT");
 
-                StorageRead *read = NULL;
                 TEST_ASSIGN(read, storageNewReadP(s3, STRDEF("file.txt"), .ignoreMissing = true), "new read file");
                 TEST_RESULT_BOOL(storageReadIgnoreMissing(read), true, "    check ignore missing");
                 TEST_RESULT_STR_Z(storageReadName(read), "/file.txt", "    check name");
@@ -781,6 +973,99 @@ testRun(void)
                 TEST_ASSIGN(write, storageNewWriteP(s3, STRDEF("file.txt")), "new write");
                 TEST_RESULT_VOID(storagePutP(write, BUFSTRDEF("12345678901234567890")), "write");
 
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("write file in concurrent parts");
+
+                // Each part is sent on its own session while the prior part is in flight. The server closes each session after the
+                // part response so the sessions are accepted in order.
+                driver->partConcurrency = 2;
+
+                testRequestP(service, s3, HTTP_VERB_POST, "/file.txt?uploads=");
+                testResponseP(
+                    service,
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<InitiateMultipartUploadResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "<Bucket>bucket</Bucket>"
+                        "<Key>file.txt</Key>"
+                        "<UploadId>CC77</UploadId>"
+                        "</InitiateMultipartUploadResult>");
+
+                testRequestP(service, s3, HTTP_VERB_PUT, "/file.txt?partNumber=1&uploadId=CC77", .content = "1234567890123456");
+                testResponseP(service, .header = "etag:CC771\r\nconnection:close");
+                hrnServerScriptClose(service);
+
+                hrnServerScriptAccept(service);
+                testRequestP(service, s3, HTTP_VERB_PUT, "/file.txt?partNumber=2&uploadId=CC77", .content = "7890123456789012");
+                testResponseP(service, .header = "etag:CC772\r\nconnection:close");
+                hrnServerScriptClose(service);
+
+                hrnServerScriptAccept(service);
+                testRequestP(service, s3, HTTP_VERB_PUT, "/file.txt?partNumber=3&uploadId=CC77", .content = "3456789012345678");
+                testResponseP(service, .header = "etag:CC773");
+
+                testRequestP(
+                    service, s3, HTTP_VERB_POST, "/file.txt?uploadId=CC77",
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                        "<CompleteMultipartUpload>"
+                        "<Part><PartNumber>1</PartNumber><ETag>CC771</ETag></Part>"
+                        "<Part><PartNumber>2</PartNumber><ETag>CC772</ETag></Part>"
+                        "<Part><PartNumber>3</PartNumber><ETag>CC773</ETag></Part>"
+                        "</CompleteMultipartUpload>\n");
+                testResponseP(
+                    service,
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<CompleteMultipartUploadResult><ETag>XXX</ETag></CompleteMultipartUploadResult>");
+
+                TEST_ASSIGN(write, storageNewWriteP(s3, STRDEF("file.txt")), "new write");
+                TEST_RESULT_VOID(storagePutP(write, BUFSTRDEF("123456789012345678901234567890123456789012345678")), "write");
+
+                // -----------------------------------------------------------------------------------------------------------------
+                TEST_TITLE("error on part while another part is in flight");
+
+                testRequestP(service, s3, HTTP_VERB_POST, "/file.txt?uploads=");
+                testResponseP(
+                    service,
+                    .content =
+                        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+                        "<InitiateMultipartUploadResult xmlns=\"http://s3.amazonaws.com/doc/2006-03-01/\">"
+                        "<Bucket>bucket</Bucket>"
+                        "<Key>file.txt</Key>"
+                        "<UploadId>EE88</UploadId>"
+                        "</InitiateMultipartUploadResult>");
+
+                testRequestP(service, s3, HTTP_VERB_PUT, "/file.txt?partNumber=1&uploadId=EE88", .content = "1234567890123456");
+                testResponseP(service, .code = 403, .header = "connection:close");
+                hrnServerScriptClose(service);
+
+                // The second part is sent but the response is never read since the write fails on the first part
+                hrnServerScriptAccept(service);
+                testRequestP(service, s3, HTTP_VERB_PUT, "/file.txt?partNumber=2&uploadId=EE88", .content = "7890123456789012");
+                testResponseP(service, .header = "etag:EE882");
+                hrnServerScriptClose(service);
+
+                TEST_ASSIGN(write, storageNewWriteP(s3, STRDEF("file.txt")), "new write");
+                TEST_ERROR(
+                    storagePutP(write, BUFSTRDEF("123456789012345678901234567890123456789012345678")), ProtocolError,
+                    "HTTP request failed with 403 (Forbidden):\n"
+                    "*** Path/Query ***:\n"
+                    "/file.txt?partNumber=1&uploadId=EE88\n"
+                    "*** Request Headers ***:\n"
+                    "authorization: <redacted>\n"
+                    "content-length: 16\n"
+                    "content-md5: Q+rAfTwowb755zAALHU+1A==\n"
+                    "host: bucket." S3_TEST_HOST "\n"
+                    "x-amz-content-sha256: 7a51d064a1a216a692f753fcdab276e4ff201a01d8b66f56d50d4d719fd0dc87\n"
+                    "x-amz-date: <redacted>\n"
+                    "x-amz-security-token: <redacted>\n"
+                    "*** Response Headers ***:\n"
+                    "connection: close");
+
+                hrnServerScriptAccept(service);
+                driver->partConcurrency = 1;
+
                 // -----------------------------------------------------------------------------------------------------------------
                 TEST_TITLE("file missing");
 